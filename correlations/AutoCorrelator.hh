@@ -0,0 +1,539 @@
+#ifndef CORRELATIONS_AUTOCORRELATOR_HH
+#define CORRELATIONS_AUTOCORRELATOR_HH
+/**
+ * @file   correlations/AutoCorrelator.hh
+ * @date   Sat Oct 17 07:52:02 2026
+ *
+ * @brief  Correlator that uses the fastest engine for each order
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <correlations/closed/FromQVector.hh>
+#include <correlations/recurrence/FromQVector.hh>
+#include <correlations/recursive/FromQVector.hh>
+#include <correlations/grouped/FromQVector.hh>
+#include <correlations/dag/FromQVector.hh>
+#include <correlations/Cost.hh>
+#include <correlations/Cache.hh>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#if defined(__unix__) || defined(__unix) || defined(unix) \
+  || defined(__APPLE__)
+# include <time.h>
+# include <unistd.h>
+# if defined(_POSIX_TIMERS) && _POSIX_TIMERS > 0
+#  define CORRELATIONS_AUTO_CLOCK
+# endif
+# define CORRELATIONS_AUTO_HOSTNAME
+#endif
+
+namespace correlations {
+  //____________________________________________________________________
+  /**
+   * Structure to calculate Cumulants with whichever of the @f$
+   * Q@f$-vector correlators is the fastest for each order.
+   *
+   * Which is the fastest depends on the order, on which harmonics
+   * are equal, and on how the code was compiled (e.g., @c
+   * CORRELATIONS_CLOSED_MAX).  When the correlator is prepared for a
+   * harmonic vector @f$ h=(h_1,\ldots,h_m)@f$, each of
+   * closed::FromQVector, recurrence::FromQVector,
+   * recursive::FromQVector, grouped::FromQVector, and
+   * dag::FromQVector is timed on a synthetic @f$ Q@f$-vector for
+   * each @f$ C\{n\}(h_1,\ldots,h_n)@f$, @f$ n=1,\ldots,m@f$.
+   * Engines that cannot do an order, or that correlations::CostModel
+   * estimates to be far slower than the best, are not timed.  The
+   * numerators of @f$ n@f$ particles are then calculated by the
+   * fastest engine for @f$ n@f$.  Other harmonics are calculated by
+   * the fastest engine that does not need to be prepared for the
+   * harmonics, and can do @f$ n@f$ particles.  Orders where no
+   * engine was timed - e.g., where all the prepared harmonics are
+   * equal - use the recurrence, or the recursive engine above
+   * Combinations::kMaxOrder.
+   *
+   * The calibration is written to a file in the cache directory (see
+   * correlations::Cache), with a name derived from the harmonics,
+   * the @f$ Q@f$-vector layout, the compiler and options, and the
+   * host, and is read back by later jobs rather than timing the
+   * engines again.
+   *
+   @code
+   correlations::HarmonicVector      h(8);
+   correlations::QVector             q(h, true);
+   correlations::AutoCorrelator      c(q, h);
+   c.print(std::cout);
+   while (moreEvents) {
+     ...
+     r += c.calculate(h);
+   }
+   @endcode
+   *
+   * @headerfile ""  <correlations/AutoCorrelator.hh>
+   */
+  struct AutoCorrelator : public FromQVector
+  {
+    /** Engine type */
+    typedef CostModel::EEngine EEngine;
+    /**
+     * Constructor
+     *
+     * @param q        Q vector to use
+     * @param h        Harmonics to calibrate for
+     * @param useCache Whether to read and write the calibration file
+     */
+    AutoCorrelator(QVector& q, const HarmonicVector& h, bool useCache=true)
+      : FromQVector(q), _closed(), _recurrence(), _recursive(), _grouped(),
+	_dag(), _engines(), _h(), _best(), _general(), _times(), _file()
+    {
+      setup();
+      prepare(q, h, useCache);
+    }
+    /**
+     * Constructor of a correlator not bound to a Q-vector.  Use
+     * prepare to calibrate.
+     */
+    AutoCorrelator()
+      : FromQVector(), _closed(), _recurrence(), _recursive(), _grouped(),
+	_dag(), _engines(), _h(), _best(), _general(), _times(), _file()
+    {
+      setup();
+    }
+    /**
+     * Calibrate for the harmonics @a h and @f$ Q@f$-vectors laid out
+     * like @a q, or read the calibration from the cache.  This is
+     * not thread-safe, and should be done before the correlator is
+     * used.
+     *
+     * @param q        Q-vector to take the layout from
+     * @param h        Harmonics
+     * @param useCache Whether to read and write the calibration file
+     *
+     * @return true if the calibration was read from the cache
+     */
+    bool prepare(const QVector& q, const HarmonicVector& h,
+		 bool useCache=true)
+    {
+      _h = h;
+      _dag.prepare(q, h);
+      _file.clear();
+
+      const std::string key  = identify(q);
+      const std::string base = useCache ? Cache::path("auto", key) : "";
+      if (!base.empty()) {
+	_file = base + ".cal";
+	if (read(key)) return true;
+      }
+      calibrate(q);
+      if (!_file.empty() && !write(key))
+	std::cerr << "Failed to write calibration to " << _file << std::endl;
+      return false;
+    }
+    /**
+     * Time each engine on a synthetic @f$ Q@f$-vector laid out like
+     * @a q, for all orders of the harmonics we are prepared for, and
+     * pick the fastest.
+     *
+     * @param q Q-vector to take the layout from
+     */
+    void calibrate(const QVector& q)
+    {
+      QVector       s(q);
+      Workspace     ws;
+      unsigned long x = 4357;
+      s.reset();
+      for (size_t i = 0; i < kParticles; i++) {
+	x = (x * 1103515245u + 12345u) & 0x7fffffffu;
+	s.fill(2 * M_PI * Real(x) / 0x80000000u, 1);
+      }
+
+      reset();
+      const Size n = _h.size();
+      for (Size m = 1; m <= n; m++) {
+	// Correlators of equal harmonics are all done the same way
+	if (std::count(_h.begin(), _h.begin() + m, _h[0]) == m) continue;
+
+	Real est[CostModel::kNEngines];
+	Real min = 0;
+	for (int e = 0; e < CostModel::kNEngines; e++) {
+	  est[e] = -1;
+	  if (!_engines[e]) continue;
+	  const Cost c = CostModel::cost(EEngine(e), m, _h);
+	  if (!c.ok) continue;
+	  est[e] = c.estimate();
+	  if (min <= 0 || est[e] < min) min = est[e];
+	}
+	for (int e = 0; e < CostModel::kNEngines; e++) {
+	  if (est[e] < 0 || est[e] > kPrune * min) continue;
+	  const Real t = measure(*_engines[e], s, ws, m);
+	  slot(m, EEngine(e)) = t;
+	  if (slot(m, _best[m]) < 0 || t < slot(m, _best[m]))
+	    _best[m] = EEngine(e);
+	  if (general(EEngine(e), m) &&
+	      (slot(m, _general[m]) < 0 || t < slot(m, _general[m])))
+	    _general[m] = EEngine(e);
+	}
+      }
+    }
+    /**
+     * @param n Number of particles
+     *
+     * @return The engine used for @a n particles of the prepared
+     * harmonics
+     */
+    EEngine engine(Size n) const
+    {
+      return n < _best.size() ? _best[n] : CostModel::kRecursive;
+    }
+    /**
+     * @param n Number of particles
+     * @param e Engine
+     *
+     * @return Time, in seconds, the engine @a e took to calculate a
+     * numerator of @a n particles, or negative if not timed
+     */
+    Real time(Size n, EEngine e) const
+    {
+      if (n >= _best.size()) return -1;
+      return _times[n * CostModel::kNEngines + e];
+    }
+    /**
+     * @return The calibration file, or empty if none
+     */
+    const std::string& file() const { return _file; }
+    /**
+     * Print the calibration
+     *
+     * @param o Output stream
+     */
+    void print(std::ostream& o) const
+    {
+      o << "# Time per numerator [us]\n"
+	<< "# " << std::setw(3) << "n";
+      for (int e = 0; e < CostModel::kNEngines; e++) {
+	if (!_engines[e]) continue;
+	o << ' ' << std::setw(10) << CostModel::name(EEngine(e));
+      }
+      o << ' ' << std::setw(10) << "use" << '\n';
+      for (Size n = 1; n < _best.size(); n++) {
+	o << "  " << std::setw(3) << n;
+	for (int e = 0; e < CostModel::kNEngines; e++) {
+	  if (!_engines[e]) continue;
+	  const Real t = time(n, EEngine(e));
+	  o << ' ' << std::setw(10);
+	  if (t < 0) o << '-';
+	  else       o << t * 1e6;
+	}
+	o << ' ' << std::setw(10) << CostModel::name(_best[n]) << '\n';
+      }
+      o << std::flush;
+    }
+    /**
+     * @return Name of the correlator
+     */
+    virtual const char* name() const { return "Automatic cumulant"; }
+  protected:
+    /** Type of list of engines */
+    typedef std::vector<EEngine> EngineVector;
+    /** Calibration constants */
+    enum {
+      /** Number of particles in the synthetic @f$ Q@f$-vector */
+      kParticles = 50,
+      /** Engines estimated this many times slower are not timed */
+      kPrune     = 20
+    };
+    /**
+     * Calculate the multi-particle correlation with the fastest
+     * engine for @a n and @a h
+     *
+     * @param q  Q-vector
+     * @param ws Workspace
+     * @param n  Order of correlation (number of particles to correlate)
+     * @param h  Harmonics
+     *
+     * @return @f$ QC{n}@f$
+     */
+    Complex ucN(const QVector& q, Workspace& ws,
+		const Size n, const HarmonicVector& h) const
+    {
+      if (n >= _best.size())
+	return _recursive.calculateNumerator(q, n, h, ws);
+      const bool prepared = std::equal(h.begin(), h.begin() + n, _h.begin());
+      const FromQVector* e = _engines[prepared ? _best[n] : _general[n]];
+      return e->calculateNumerator(q, n, h, ws);
+    }
+    /**
+     * Time the numerator of @a n particles of the prepared harmonics
+     * of engine @a e, repeating it for at least a millisecond.  The
+     * workspace is cleared before each call, as for a new event.
+     *
+     * @param e  Engine
+     * @param q  Q-vector
+     * @param ws Workspace
+     * @param n  Number of particles
+     *
+     * @return Time per call in seconds
+     */
+    Real measure(const FromQVector& e, const QVector& q, Workspace& ws,
+		 Size n) const
+    {
+      ws.use(q);
+      ws.clear();
+      Complex sum   = e.calculateNumerator(q, n, _h, ws);
+      size_t  calls = 0;
+      Real    t     = 0;
+      const Real start = now();
+      for (size_t m = 1; t < 1e-3; m *= 2) {
+	for (size_t i = 0; i < m; i++) {
+	  ws.clear();
+	  sum += e.calculateNumerator(q, n, _h, ws);
+	}
+	calls += m;
+	t     =  now() - start;
+      }
+      // Use the result, so the calls cannot be optimised away
+      if (sum != sum) std::cerr << "Invalid result" << std::endl;
+      return t / calls;
+    }
+    /**
+     * @return Current time, in seconds
+     */
+    static Real now()
+    {
+#ifdef CORRELATIONS_AUTO_CLOCK
+      timespec t;
+      clock_gettime(CLOCK_MONOTONIC, &t);
+      return t.tv_sec + 1e-9 * t.tv_nsec;
+#else
+      return Real(std::clock()) / CLOCKS_PER_SEC;
+#endif
+    }
+    /**
+     * Make the text that identifies a calibration: the harmonics,
+     * the layout of @a q, the compiler and options, and the host
+     *
+     * @param q Q-vector
+     *
+     * @return The text
+     */
+    std::string identify(const QVector& q) const
+    {
+      const QVector::Layout l = q.layout();
+      std::ostringstream    o;
+      o << "# correlations::AutoCorrelator h=";
+      for (size_t i = 0; i < _h.size(); i++) o << (i ? "," : "") << _h[i];
+      o << " layout=" << l.maxN << ',' << l.maxP << ',' << l.offN << ','
+	<< l.nStride << ',' << l.pStride << ',' << l.imOff << ',' << l.size
+	<< ',' << l.half << " closed=" << CORRELATIONS_CLOSED_MAX;
+#ifdef CORRELATIONS_LIBRARY
+      o << " library";
+#endif
+#ifdef __VERSION__
+      o << " compiler=" << __VERSION__;
+#endif
+#ifdef __OPTIMIZE__
+      o << " optimize";
+#endif
+#ifdef __FAST_MATH__
+      o << " fast-math";
+#endif
+#ifdef __AVX2__
+      o << " avx2";
+#endif
+#ifdef __AVX512F__
+      o << " avx512f";
+#endif
+#ifdef CORRELATIONS_AUTO_HOSTNAME
+      char host[256];
+      if (gethostname(host, sizeof(host)) == 0) {
+	host[sizeof(host) - 1] = '\0';
+	o << " host=" << host;
+      }
+#endif
+      return o.str();
+    }
+    /**
+     * Read the calibration from the cache file
+     *
+     * @param key Text that identifies the calibration
+     *
+     * @return true if the file was there and matched @a key
+     */
+    bool read(const std::string& key)
+    {
+      std::ifstream in(_file.c_str());
+      std::string   line;
+      if (!in || !std::getline(in, line) || line != key) return false;
+
+      reset();
+      const Size n = _h.size();
+      for (Size m = 1; m <= n; m++) {
+	int j, b, g;
+	if (!(in >> j >> b >> g) || j != m || !valid(b) || !valid(g) ||
+	    !general(EEngine(g), m)) {
+	  _best.clear();
+	  return false;
+	}
+	_best[m]    = EEngine(b);
+	_general[m] = EEngine(g);
+	for (int e = 0; e < CostModel::kNEngines; e++)
+	  in >> slot(m, EEngine(e));
+      }
+      if (in) return true;
+      _best.clear();
+      return false;
+    }
+    /**
+     * Write the calibration to the cache file
+     *
+     * @param key Text that identifies the calibration
+     *
+     * @return true on success
+     */
+    bool write(const std::string& key) const
+    {
+      // Write to a name of our own, and rename when done, so
+      // concurrent jobs never read a partial calibration
+      std::ostringstream tmp;
+      tmp << _file << ".";
+#ifdef CORRELATIONS_AUTO_HOSTNAME
+      tmp << getpid();
+#else
+      tmp << "tmp";
+#endif
+      std::ofstream out(tmp.str().c_str());
+      out << key << '\n' << std::setprecision(6);
+      for (Size m = 1; m < _best.size(); m++) {
+	out << m << ' ' << _best[m] << ' ' << _general[m];
+	for (int e = 0; e < CostModel::kNEngines; e++)
+	  out << ' ' << time(m, EEngine(e));
+	out << '\n';
+      }
+      out.close();
+      if (out && std::rename(tmp.str().c_str(), _file.c_str()) == 0)
+	return true;
+      std::remove(tmp.str().c_str());
+      return false;
+    }
+    /**
+     * Set all orders to use the fall-back engine, and clear the times
+     */
+    void reset()
+    {
+      const Size n = _h.size();
+      _best.resize(n + 1);
+      _general.resize(n + 1);
+      for (Size m = 0; m <= n; m++) _best[m] = _general[m] = fallback(m);
+      _times.assign((n + 1) * CostModel::kNEngines, -1);
+    }
+    /**
+     * @param n Number of particles
+     *
+     * @return Engine used for @a n particles when none was timed:
+     * the recurrence while its terms are tabulated, and the recursive
+     * engine above that
+     */
+    static EEngine fallback(Size n)
+    {
+      return (n <= Combinations::kMaxOrder ? CostModel::kRecurrence
+	      : CostModel::kRecursive);
+    }
+    /**
+     * @param e Engine
+     * @param n Number of particles
+     *
+     * @return true if @a e can calculate correlators of @a n
+     * particles of any harmonics, without being prepared for them
+     */
+    static bool general(EEngine e, Size n)
+    {
+      if (e == CostModel::kDag || e == CostModel::kNestedLoops) return false;
+      HarmonicVector h(n);
+      for (Size i = 0; i < n; i++) h[i] = i + 1;
+      return CostModel::cost(e, n, h).ok;
+    }
+    /**
+     * @param e Engine number
+     *
+     * @return true if @a e is one of our engines
+     */
+    bool valid(int e) const
+    {
+      return e >= 0 && e < CostModel::kNEngines && _engines[e];
+    }
+    /**
+     * @param n Number of particles
+     * @param e Engine
+     *
+     * @return Reference to the time of engine @a e for @a n particles
+     */
+    Real& slot(Size n, EEngine e)
+    {
+      return _times[n * CostModel::kNEngines + e];
+    }
+    /**
+     * Set up the table of engines
+     */
+    void setup()
+    {
+      _maxFixed = 0;
+      std::fill(_engines, _engines + CostModel::kNEngines,
+		static_cast<const FromQVector*>(0));
+      _engines[CostModel::kClosed]     = &_closed;
+      _engines[CostModel::kRecurrence] = &_recurrence;
+      _engines[CostModel::kRecursive]  = &_recursive;
+      _engines[CostModel::kGrouped]    = &_grouped;
+      _engines[CostModel::kDag]        = &_dag;
+    }
+    /** Closed-form engine */
+    closed::FromQVector     _closed;
+    /** Recurrence engine */
+    recurrence::FromQVector _recurrence;
+    /** Recursive engine */
+    recursive::FromQVector  _recursive;
+    /** Grouped engine */
+    grouped::FromQVector    _grouped;
+    /** Graph engine */
+    dag::FromQVector        _dag;
+    /** The engines, by CostModel::EEngine, or null */
+    const FromQVector*      _engines[CostModel::kNEngines];
+    /** Harmonics calibrated for */
+    HarmonicVector          _h;
+    /** Fastest engine of each number of particles */
+    EngineVector            _best;
+    /** Fastest engine, not prepared for the harmonics, of each order */
+    EngineVector            _general;
+    /** Time of each order and engine */
+    RealVector              _times;
+    /** Calibration file */
+    std::string             _file;
+  private:
+    /** Not copyable - the engine table points into this */
+    AutoCorrelator(const AutoCorrelator&);
+    /** Not assignable - the engine table points into this */
+    AutoCorrelator& operator=(const AutoCorrelator&);
+  };
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
@@ -0,0 +1,119 @@
+#ifndef CORRELATIONS_CACHE_HH
+#define CORRELATIONS_CACHE_HH
+/**
+ * @file   correlations/Cache.hh
+ * @date   Sat Oct 17 07:52:02 2026
+ *
+ * @brief  Files kept between runs
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#if defined(__unix__) || defined(__unix) || defined(unix) \
+  || defined(__APPLE__)
+# include <sys/stat.h>
+# define CORRELATIONS_CACHE_MKDIR
+#endif
+
+namespace correlations {
+  //____________________________________________________________________
+  /**
+   * The directory of files kept between runs, e.g., code compiled by
+   * jit::FromQVector and the calibrations of AutoCorrelator.
+   *
+   * Files are named from a hash of a text that identifies their
+   * content (see Cache::path).  Users should keep that text in the
+   * file, and check it when reading, so that a clash of hashes is
+   * caught.
+   *
+   * @headerfile ""  <correlations/Cache.hh>
+   */
+  struct Cache
+  {
+    /**
+     * Get the directory in which files are kept.  This is @c
+     * $CORRELATIONS_CACHE if set, otherwise @c
+     * $XDG_CACHE_HOME/correlations, or @c $HOME/.cache/correlations.
+     *
+     * @return The directory, or empty if none could be found
+     */
+    static std::string directory()
+    {
+      const char* e = std::getenv("CORRELATIONS_CACHE");
+      if (e && *e) return e;
+      e = std::getenv("XDG_CACHE_HOME");
+      if (e && *e) return std::string(e) + "/correlations";
+      e = std::getenv("HOME");
+      if (e && *e) return std::string(e) + "/.cache/correlations";
+      return "";
+    }
+    /**
+     * Get the path, without extension, of the file identified by @a
+     * text.  The directory is created if needed.
+     *
+     * @param prefix Prefix of the file name
+     * @param text   Text that identifies the content
+     *
+     * @return The path, or empty if there is no cache directory
+     */
+    static std::string path(const std::string& prefix,
+			    const std::string& text)
+    {
+      const std::string dir = directory();
+      if (dir.empty() || !makeDirectory(dir)) return "";
+
+      // Two FNV-1a hashes of the text
+      unsigned long h1 = 2166136261u;
+      unsigned long h2 = 84696351u;
+      for (size_t i = 0; i < text.size(); i++) {
+	h1 = ((h1 ^ (unsigned char)(text[i])) * 16777619u) & 0xffffffffu;
+	h2 = ((h2 ^ (unsigned char)(text[i])) * 16777619u) & 0xffffffffu;
+      }
+      char name[32];
+      std::sprintf(name, "-%08lx%08lx", h1, h2);
+      return dir + "/" + prefix + name;
+    }
+    /**
+     * Make a directory and its parents, if they do not exist
+     *
+     * @param dir Directory
+     *
+     * @return true if the directory exists
+     */
+    static bool makeDirectory(const std::string& dir)
+    {
+#ifdef CORRELATIONS_CACHE_MKDIR
+      for (size_t i = 1; i <= dir.size(); i++) {
+	if (i < dir.size() && dir[i] != '/') continue;
+	mkdir(dir.substr(0, i).c_str(), 0755);
+      }
+      struct stat s;
+      return stat(dir.c_str(), &s) == 0 && S_ISDIR(s.st_mode);
+#else
+      (void)dir;
+      return false;
+#endif
+    }
+  };
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
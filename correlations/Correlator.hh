@@ -67,6 +67,8 @@ namespace correlations {
     };
     /**
      * Calculate up to the 8-particle correlator with the specified harmonics.
+     * The harmonics are put in an array on the stack, and passed on
+     * to cArgs.
      *
      * @param h1 Harmonic 1
      * @param h2 Harmonic 2
@@ -89,12 +91,9 @@ namespace correlations {
 		     const Harmonic h8=kInvalidN) const
     {
       const Harmonic hs[] = { h1, h2, h3, h4, h5, h6, h7, h8 };
-      HarmonicVector hv;
-      for (Size i = 0; i < 8; i++) {
-	if (hs[i] == kInvalidN) break;
-	hv.push_back(hs[i]);
-      }
-      return calculate(hv);
+      Size n = 0;
+      while (n < 8 && hs[n] != kInvalidN) n++;
+      return cArgs(n, hs);
     }
     /**
      * Calculate the multi-particle correlation.
@@ -154,7 +153,24 @@ namespace correlations {
      */
     virtual ~Correlator() {}
   protected:
-    Correlator(Size maxFixed=8) : _maxFixed(maxFixed > 8 ? 8 : maxFixed) {}
+    Correlator(Size maxFixed=8)
+      : _maxFixed(maxFixed > 8 ? 8 : maxFixed)
+    {}
+    /**
+     * Calculate the @a n particle correlation of the harmonics in
+     * the array @a h.  This copies the harmonics into a vector and
+     * calls calculate.  Derived classes can do without the copy,
+     * which allocates.
+     *
+     * @param n How many particles to correlate
+     * @param h @f$=h_1,\ldots,h_n@f$ Harmonic of each term
+     *
+     * @return The correlator and the summed weights
+     */
+    virtual Result cArgs(const Size n, const Harmonic* h) const
+    {
+      return calculate(n, HarmonicVector(h, h + n));
+    }
     /**
      * Calculate the @a n particle correlation using harmonics @a h.
      *
@@ -0,0 +1,687 @@
+#ifndef CORRELATIONS_CORRELATORDAG_HH
+#define CORRELATIONS_CORRELATORDAG_HH
+/**
+ * @file   correlations/CorrelatorDag.hh
+ * @date   Sat Oct 17 07:04:15 2026
+ *
+ * @brief  A correlator compiled into a stream of instructions
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <correlations/Types.hh>
+#include <correlations/QVector.hh>
+#include <correlations/PlainComplex.hh>
+#include <correlations/Simd.hh>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace correlations {
+  //____________________________________________________________________
+  /**
+   * The @f$ n@f$-particle correlator of a fixed set of harmonics
+   * @f$ h_1,\ldots,h_n@f$, compiled into a directed acyclic graph of
+   * shared sub-expressions, and lowered to a stream of register
+   * instructions.
+   *
+   * Fully expanded, the correlator is a sum over the set partitions
+   * @f$\pi@f$ of @f$\{1,\ldots,n\}@f$ (see correlations::CorrelatorPlan)
+   * - @f$ B_n@f$ (the Bell number) terms of up to @f$ n@f$ factors.
+   * Most partial products are however repeated many times.  Taking
+   * out the block @f$ B@f$ containing the first harmonic gives
+   *
+   * @f[
+   *   C(M) = \sum_{B\subseteq M, m_1\in B} (-1)^{|B|-1}(|B|-1)!\,
+   *   Q_{\sum_{j\in B}h_j,|B|}\,C(M\setminus B)
+   * @f]
+   *
+   * with @f$ C(\emptyset)=1@f$.  Since @f$ C(M)@f$ only depends on
+   * the multi-set of harmonics in @f$ M@f$, the sub-expressions
+   * @f$ C(M)@f$ are interned by their sorted harmonics, so each is
+   * calculated once, and identical products @f$ Q\,C(M\setminus B)@f$
+   * within a sum are merged into one with a larger coefficient.
+   * For @f$ n@f$ different harmonics that is @f$ 2^{n-1}+1@f$
+   * nodes and about @f$ 3^{n-1}@f$ multiplications, compared to the
+   * @f$ \sum_k S(n,k)(k-1)@f$ of the expanded sum, and much less
+   * when harmonics are repeated.
+   *
+   * The graph is lowered to instructions on a file of complex
+   * registers - loads of @f$ Q_{h,p}@f$, and (fused) multiply-adds
+   * with a real coefficient.  Registers are reused once the value
+   * they hold is no longer needed, so the register file stays small.
+   * Per event, evaluate only runs through the instructions.
+   *
+   @code
+   correlations::QVector        q(h, true);
+   correlations::CorrelatorDag  d(q, h.size(), h);
+   correlations::PlainVector    z;
+   while (moreEvents) {
+     ...
+     correlations::Complex c = d.evaluate(q, z);
+   }
+   @endcode
+   *
+   * When many events are to be processed, e.g., from a
+   * correlations::QStoreReader, the graph can be evaluated for
+   * simd::kLanes events at a time, with the values of all events
+   * in the lanes of vector registers (see correlations::simd).
+   *
+   * The number of operations before (see naive) and after
+   * eliminating the common sub-expressions can be printed with the
+   * program cse.cc.
+   *
+   * A graph can be evaluated with any @f$ Q@f$-vector, but the
+   * pre-computed locations are only used if it has the same layout
+   * (see QVector::layout) as the one it was made for.
+   *
+   * @headerfile ""  <correlations/CorrelatorDag.hh>
+   */
+  struct CorrelatorDag
+  {
+    /** Operation codes */
+    enum EOp {
+      kLoad, /**< r[dst] = Q(factor a) */
+      kSet,  /**< r[dst] = coef * r[a] */
+      kAxpy, /**< r[dst] += coef * r[a] */
+      kMul,  /**< r[dst] = coef * r[a] * r[b] */
+      kMac   /**< r[dst] += coef * r[a] * r[b] */
+    };
+    /** Constructor of an empty graph */
+    CorrelatorDag()
+      : _h(0), _layout(), _factors(0), _code(0), _nNodes(0), _nRegs(0),
+	_result(0)
+    {}
+    /**
+     * Constructor.  Makes the graph for the @a n particle correlator
+     * with harmonics @a h, for @f$ Q@f$-vectors laid out like @a q.
+     *
+     * @param q Q-vector to take the layout from
+     * @param n Number of particles to correlate
+     * @param h Harmonics (at least @a n)
+     */
+    CorrelatorDag(const QVector& q, const Size n, const HarmonicVector& h)
+      : _h(h.begin(), h.begin() + n), _layout(), _factors(0), _code(0),
+	_nNodes(0), _nRegs(0), _result(0)
+    {
+      make(q);
+    }
+    /**
+     * Check if this is the graph of the @a n particle correlator with
+     * harmonics @a h
+     *
+     * @param n Number of particles
+     * @param h Harmonics
+     *
+     * @return true if so
+     */
+    bool matches(const Size n, const HarmonicVector& h) const
+    {
+      return n == _h.size() && std::equal(_h.begin(), _h.end(), h.begin());
+    }
+    /**
+     * Evaluate the correlator
+     *
+     * @param q Q-vector
+     * @param z Register file.  Resized as needed, so nothing is
+     *          allocated once it is big enough.
+     *
+     * @return The correlator
+     */
+    Complex evaluate(const QVector& q, PlainVector& z) const
+    {
+      if (_code.empty()) return Complex();
+      if (z.size() < _nRegs) z.resize(_nRegs);
+      PlainComplex* r    = &(z[0]);
+      const Real*   d    = q.data();
+      const bool    fast = q.layout() == _layout;
+      for (CodeVector::const_iterator i = _code.begin(); i != _code.end();
+	   ++i) {
+	switch (i->op) {
+	case kLoad: {
+	  const Factor& x = _factors[i->a];
+	  r[i->dst] = (fast ? PlainComplex(d[x.re], x.s * d[x.im])
+		       : PlainComplex(q(x.n, x.p)));
+	}
+	  break;
+	case kSet:  r[i->dst]  = i->coef * r[i->a];            break;
+	case kAxpy: r[i->dst] += i->coef * r[i->a];            break;
+	case kMul:  r[i->dst]  = i->coef * r[i->a] * r[i->b];  break;
+	case kMac:  r[i->dst].mac(i->coef, r[i->a], r[i->b]);  break;
+	}
+      }
+      return r[_result].complex();
+    }
+    /**
+     * Evaluate the correlator for several events at once.  The
+     * events are taken simd::kLanes at a time, and each instruction
+     * is executed for all of them with vector instructions.
+     *
+     * @param q  Q-vectors of the events
+     * @param nq Number of events
+     * @param r  On return, the correlator of each event
+     * @param z  Register file.  Resized as needed, so nothing is
+     *           allocated once it is big enough.
+     */
+    void evaluate(const QVector* const* q, const size_t nq, Complex* r,
+		  RealVector& z) const
+    {
+      const size_t nl = simd::kLanes;
+      if (_code.empty()) {
+	std::fill(r, r + nq, Complex());
+	return;
+      }
+      if (z.size() < 2 * nl * _nRegs) z.resize(2 * nl * _nRegs);
+      Real* regs = &(z[0]);
+      for (size_t e = 0; e < nq; e += nl) {
+	const size_t ne = std::min(nl, nq - e);
+	bool         fast[simd::kLanes];
+	for (size_t l = 0; l < ne; l++) fast[l] = q[e+l]->layout() == _layout;
+
+	for (CodeVector::const_iterator i = _code.begin(); i != _code.end();
+	     ++i) {
+	  // Real parts of a register first, then imaginary parts
+	  Real* dr = regs + 2 * nl * i->dst;
+	  Real* di = dr + nl;
+	  if (i->op == unsigned(kLoad)) {
+	    const Factor& x = _factors[i->a];
+	    for (size_t l = 0; l < nl; l++) {
+	      if (l >= ne)      dr[l] = di[l] = 0;
+	      else if (fast[l]) {
+		const Real* d = q[e+l]->data();
+		dr[l] = d[x.re];
+		di[l] = x.s * d[x.im];
+	      }
+	      else {
+		const Complex v = (*q[e+l])(x.n, x.p);
+		dr[l] = v.real();
+		di[l] = v.imag();
+	      }
+	    }
+	    continue;
+	  }
+	  const Real*      ar = regs + 2 * nl * i->a;
+	  const simd::Pack c  = simd::set1(i->coef);
+	  simd::Pack       xr = simd::load(ar);
+	  simd::Pack       xi = simd::load(ar + nl);
+	  if (i->op >= unsigned(kMul)) {
+	    const Real*      br = regs + 2 * nl * i->b;
+	    const simd::Pack yr = simd::load(br);
+	    const simd::Pack yi = simd::load(br + nl);
+	    const simd::Pack tr = simd::fnma(xi, yi, simd::mul(xr, yr));
+	    const simd::Pack ti = simd::fma(xi, yr, simd::mul(xr, yi));
+	    xr = tr;
+	    xi = ti;
+	  }
+	  if (i->op == unsigned(kSet) || i->op == unsigned(kMul)) {
+	    simd::store(dr, simd::mul(c, xr));
+	    simd::store(di, simd::mul(c, xi));
+	  }
+	  else {
+	    simd::store(dr, simd::fma(c, xr, simd::load(dr)));
+	    simd::store(di, simd::fma(c, xi, simd::load(di)));
+	  }
+	}
+	const Real* rr = regs + 2 * nl * _result;
+	for (size_t l = 0; l < ne; l++) r[e+l] = Complex(rr[l], rr[nl+l]);
+      }
+    }
+    /**
+     * @return Number of particles correlated
+     */
+    Size size() const { return _h.size(); }
+    /**
+     * @return The harmonics
+     */
+    const HarmonicVector& harmonics() const { return _h; }
+    /**
+     * @return Layout of the @f$ Q@f$-vectors the graph was made for
+     */
+    const QVector::Layout& layout() const { return _layout; }
+    /**
+     * @return Number of distinct sub-expressions @f$ C(M)@f$,
+     * including the result
+     */
+    size_t nNodes() const { return _nNodes; }
+    /**
+     * @return Number of distinct factors @f$ Q_{h,p}@f$
+     */
+    size_t nFactors() const { return _factors.size(); }
+    /**
+     * @return Number of instructions per evaluation
+     */
+    size_t nInstructions() const { return _code.size(); }
+    /**
+     * @return Number of complex registers used
+     */
+    size_t nRegisters() const { return _nRegs; }
+    /**
+     * Find the largest number of values that are live at once, from
+     * the instructions alone.  A value is live from the instruction
+     * that sets it to its last read.  As registers are reused as
+     * soon as their values are dead, this should be nRegisters.
+     *
+     * @return Largest number of live values
+     */
+    size_t nLive() const
+    {
+      if (_code.empty()) return 0;
+      // Go backwards, tracking which registers will be read again
+      std::vector<bool> live(_nRegs, false);
+      size_t            n    = 1;
+      size_t            peak = 0;
+      live[_result] = true;
+      for (size_t i = _code.size(); i > 0; i--) {
+	const Instruction& x   = _code[i - 1];
+	const bool         set = (x.op == unsigned(kLoad) ||
+				  x.op == unsigned(kSet) ||
+				  x.op == unsigned(kMul));
+	// The destination is needed while the operands are read
+	if (!live[x.dst]) {
+	  live[x.dst] = true;
+	  n++;
+	}
+	if (x.op != unsigned(kLoad) && !live[x.a]) {
+	  live[x.a] = true;
+	  n++;
+	}
+	if (x.op >= unsigned(kMul) && !live[x.b]) {
+	  live[x.b] = true;
+	  n++;
+	}
+	peak = std::max(peak, n);
+	// Before it is set, the destination holds nothing of use.  It
+	// is never an operand of the same instruction (see allocate).
+	if (set) {
+	  live[x.dst] = false;
+	  n--;
+	}
+      }
+      return peak;
+    }
+    /**
+     * @return Number of complex multiplications per evaluation
+     */
+    size_t nMultiplications() const { return count(kMul) + count(kMac); }
+    /**
+     * @return Number of complex additions per evaluation
+     */
+    size_t nAdditions() const { return count(kAxpy) + count(kMac); }
+    /**
+     * Number of operations needed to evaluate the fully expanded
+     * @a n particle correlator, i.e., without eliminating common
+     * sub-expressions.  Each of the @f$ S(n,k)@f$ terms with @f$
+     * k@f$ factors needs @f$ k-1@f$ multiplications, and all but the
+     * first are added to the sum.
+     *
+     * @param n   Number of particles
+     * @param mul On return, number of complex multiplications
+     * @param add On return, number of complex additions
+     *
+     * @return Number of terms
+     */
+    static Real naive(const Size n, Real& mul, Real& add)
+    {
+      // Stirling numbers of the second kind, S(m,k), row by row
+      RealVector s(n + 1, 0);
+      s[0] = 1;
+      for (Size m = 1; m <= n; m++) {
+	for (Size k = m; k > 0; k--) s[k] = k * s[k] + s[k-1];
+	s[0] = 0;
+      }
+      Real terms = 0;
+      mul        = 0;
+      for (Size k = 1; k <= n; k++) {
+	terms += s[k];
+	mul   += s[k] * (k - 1);
+      }
+      add = terms > 0 ? terms - 1 : 0;
+      return terms;
+    }
+    /**
+     * Print the instructions
+     *
+     * @param o Output stream
+     */
+    void print(std::ostream& o) const
+    {
+      o << "C{" << _h.size() << "}(";
+      for (size_t i = 0; i < _h.size(); i++)
+	o << (i == 0 ? "" : ",") << _h[i];
+      o << "): " << _nNodes << " nodes, " << _factors.size()
+	<< " factors, " << _code.size() << " instructions, " << _nRegs
+	<< " registers" << std::endl;
+      for (CodeVector::const_iterator i = _code.begin(); i != _code.end();
+	   ++i) {
+	o << "  r" << i->dst;
+	switch (i->op) {
+	case kLoad:
+	  o << "  = Q(" << _factors[i->a].n << "," << _factors[i->a].p << ")";
+	  break;
+	case kSet:  o << "  = " << i->coef << " * r" << i->a; break;
+	case kAxpy: o << " += " << i->coef << " * r" << i->a; break;
+	case kMul:
+	  o << "  = " << i->coef << " * r" << i->a << " * r" << i->b;
+	  break;
+	case kMac:
+	  o << " += " << i->coef << " * r" << i->a << " * r" << i->b;
+	  break;
+	}
+	o << std::endl;
+      }
+      o << "  return r" << _result << std::endl;
+    }
+    /**
+     * Write the instructions as the C++ function
+     *
+     @code
+     extern "C" void name(const double* d, double* r)
+     @endcode
+     *
+     * with the locations of the factors and the coefficients as
+     * constants, and complex arithmetic spelled out on real and
+     * imaginary parts, so the compiler can fold and schedule it all.
+     * The argument @c d is the storage (QVector::data) of a @f$
+     * Q@f$-vector with the layout the graph was made for, and on
+     * return @c r[0] and @c r[1] hold the real and imaginary part of
+     * the correlator.
+     *
+     * @param o    Output stream
+     * @param name Name of the function
+     */
+    void emit(std::ostream& o, const std::string& name) const
+    {
+      const std::streamsize prec = o.precision(17);
+      o << "// C{" << _h.size() << "}(";
+      for (size_t i = 0; i < _h.size(); i++)
+	o << (i == 0 ? "" : ",") << _h[i];
+      o << ")\nextern \"C\" void " << name
+	<< "(const double* d, double* r)\n{\n";
+      for (size_t i = 0; i < _nRegs; i++)
+	o << "  double r" << i << "r, r" << i << "i;\n";
+      for (CodeVector::const_iterator i = _code.begin(); i != _code.end();
+	   ++i) {
+	const unsigned int t = i->dst;
+	const unsigned int a = i->a;
+	const unsigned int b = i->b;
+	if (i->op == unsigned(kLoad)) {
+	  const Factor& x = _factors[a];
+	  o << "  r" << t << "r = d[" << x.re << "]; r" << t << "i = "
+	    << (x.s < 0 ? "-" : "") << "d[" << x.im << "];\n";
+	  continue;
+	}
+	const bool  acc = i->op == unsigned(kAxpy) || i->op == unsigned(kMac);
+	const char* eq  = acc ? " += " : " = ";
+	std::ostringstream c;
+	c.precision(17);
+	if      (i->coef == -1) c << "-";
+	else if (i->coef != 1)  c << i->coef << " * ";
+	if (i->op == unsigned(kSet) || i->op == unsigned(kAxpy)) {
+	  o << "  r" << t << "r" << eq << c.str() << "r" << a << "r; "
+	    << "r" << t << "i" << eq << c.str() << "r" << a << "i;\n";
+	  continue;
+	}
+	o << "  r" << t << "r" << eq << c.str() << "(r" << a << "r * r" << b
+	  << "r - r" << a << "i * r" << b << "i);\n"
+	  << "  r" << t << "i" << eq << c.str() << "(r" << a << "r * r" << b
+	  << "i + r" << a << "i * r" << b << "r);\n";
+      }
+      if (_code.empty()) o << "  r[0] = 0; r[1] = 0;\n";
+      else o << "  r[0] = r" << _result << "r; r[1] = r" << _result
+	     << "i;\n";
+      o << "}\n" << std::endl;
+      o.precision(prec);
+    }
+  protected:
+    /** A distinct factor @f$ Q_{n,p}@f$ */
+    struct Factor
+    {
+      Harmonic n;  /**< Harmonic */
+      Power    p;  /**< Power */
+      size_t   re; /**< Location of real part */
+      size_t   im; /**< Location of imaginary part */
+      Real     s;  /**< Sign of imaginary part */
+    };
+    /** An instruction */
+    struct Instruction
+    {
+      unsigned int op;   /**< Operation code (EOp) */
+      unsigned int dst;  /**< Destination register */
+      unsigned int a;    /**< First operand */
+      unsigned int b;    /**< Second operand */
+      Real         coef; /**< Coefficient */
+    };
+    /** Type of list of factors */
+    typedef std::vector<Factor> FactorVector;
+    /** Type of list of instructions */
+    typedef std::vector<Instruction> CodeVector;
+    /** Identifies a factor @f$ Q_{n,p}@f$ */
+    typedef std::pair<Harmonic,Power> FactorKey;
+    /** Map from factor to its index */
+    typedef std::map<FactorKey,unsigned int> FactorMap;
+    /** Map from sorted harmonics of a sub-expression to its value */
+    typedef std::map<HarmonicVector,unsigned int> NodeMap;
+    /** A product @f$ Q\,C(M)@f$ */
+    typedef std::pair<FactorKey,HarmonicVector> ProductKey;
+    /** Map from product to its coefficient */
+    typedef std::map<ProductKey,Real> ProductMap;
+    /** Marks the value @f$ C(\emptyset)=1@f$ */
+    enum { kOne = ~0u };
+    /**
+     * Count instructions of a kind
+     *
+     * @param op Operation code
+     *
+     * @return Number of instructions with that code
+     */
+    size_t count(EOp op) const
+    {
+      size_t n = 0;
+      for (CodeVector::const_iterator i = _code.begin(); i != _code.end();
+	   ++i) if (i->op == unsigned(op)) n++;
+      return n;
+    }
+    /**
+     * State while making the graph.  Instructions refer to values
+     * (each defined once), which are mapped to registers afterwards.
+     */
+    struct Builder
+    {
+      Builder() : factors(), loaded(), nodes(), nValues(0) {}
+      FactorMap                 factors; /**< Factor indices */
+      std::vector<unsigned int> loaded;  /**< Value of loaded factors */
+      NodeMap                   nodes;   /**< Values of sub-expressions */
+      unsigned int              nValues; /**< Number of values so far */
+    };
+    /**
+     * Get the value of the factor @f$ Q_{n,p}@f$, loading it if it
+     * was not already
+     *
+     * @param b Builder
+     * @param f Factor
+     *
+     * @return Value of the factor
+     */
+    unsigned int factor(Builder& b, const FactorKey& f)
+    {
+      FactorMap::iterator i = b.factors.find(f);
+      if (i == b.factors.end()) {
+	i = b.factors.insert(std::make_pair(f, unsigned(b.loaded.size())))
+	  .first;
+	b.loaded.push_back(kOne);
+      }
+      unsigned int& v = b.loaded[i->second];
+      if (v == unsigned(kOne)) {
+	v = b.nValues++;
+	Instruction x = { kLoad, v, i->second, 0, 1 };
+	_code.push_back(x);
+      }
+      return v;
+    }
+    /**
+     * Get the value of the sub-expression @f$ C(M)@f$, emitting the
+     * instructions to calculate it if it was not already
+     *
+     * @param b Builder
+     * @param m Sorted harmonics
+     *
+     * @return Value of the sub-expression
+     */
+    unsigned int node(Builder& b, const HarmonicVector& m)
+    {
+      if (m.empty()) return kOne;
+      NodeMap::const_iterator i = b.nodes.find(m);
+      if (i != b.nodes.end()) return i->second;
+
+      // Expand in the blocks containing the first harmonic, merging
+      // identical products
+      const size_t   n = m.size();
+      ProductMap     products;
+      HarmonicVector rest;
+      for (unsigned long mask = 0; mask < (1ul << (n - 1)); mask++) {
+	Harmonic sum  = m[0];
+	Power    size = 1;
+	rest.clear();
+	for (size_t j = 1; j < n; j++) {
+	  if (mask & (1ul << (j - 1))) {
+	    sum += m[j];
+	    size++;
+	  }
+	  else
+	    rest.push_back(m[j]);
+	}
+	Real coef = 1;
+	for (Power k = 2; k < size; k++) coef *= k;
+	if (size % 2 == 0) coef = -coef;
+	products[ProductKey(FactorKey(sum, size), rest)] += coef;
+      }
+
+      // A single harmonic is just a factor, and needs no instruction
+      if (n == 1) {
+	const unsigned int v = factor(b, FactorKey(m[0], 1));
+	b.nodes[m] = v;
+	_nNodes++;
+	return v;
+      }
+
+      // Make the sub-expressions first, then the sum
+      for (ProductMap::const_iterator p = products.begin();
+	   p != products.end(); ++p) node(b, p->first.second);
+      const unsigned int v     = b.nValues++;
+      bool               first = true;
+      for (ProductMap::const_iterator p = products.begin();
+	   p != products.end(); ++p) {
+	const unsigned int c = node(b, p->first.second);
+	const unsigned int f = factor(b, p->first.first);
+	Instruction x = { 0, v, f, c, p->second };
+	if (c == unsigned(kOne)) x.op = first ? kSet : kAxpy;
+	else                     x.op = first ? kMul : kMac;
+	_code.push_back(x);
+	first = false;
+      }
+      b.nodes[m] = v;
+      _nNodes++;
+      return v;
+    }
+    /**
+     * Assign registers to values.  A register is freed after the
+     * last read of the value it holds.
+     *
+     * @param nValues Number of values
+     */
+    void allocate(unsigned int nValues)
+    {
+      const size_t              none = size_t(-1);
+      std::vector<size_t>       last(nValues, none);
+      for (size_t i = 0; i < _code.size(); i++) {
+	// The operand of a load is a factor, not a value
+	if (_code[i].op != unsigned(kLoad)) last[_code[i].a] = i;
+	if (_code[i].op >= unsigned(kMul))  last[_code[i].b] = i;
+      }
+      last[_result] = _code.size();
+
+      std::vector<unsigned int> reg(nValues, 0);
+      std::vector<unsigned int> free;
+      for (size_t i = 0; i < _code.size(); i++) {
+	Instruction& x = _code[i];
+	if (x.op == unsigned(kLoad) || x.op == unsigned(kSet) ||
+	    x.op == unsigned(kMul)) {
+	  if (free.empty()) reg[x.dst] = _nRegs++;
+	  else {
+	    reg[x.dst] = free.back();
+	    free.pop_back();
+	  }
+	}
+	const bool         two = x.op >= unsigned(kMul);
+	const unsigned int a   = x.a;
+	const unsigned int b   = x.b;
+	x.dst = reg[x.dst];
+	if (x.op != unsigned(kLoad)) x.a = reg[a];
+	if (two)                     x.b = reg[b];
+	if (x.op != unsigned(kLoad) && last[a] == i) free.push_back(reg[a]);
+	if (two && b != a && last[b] == i)           free.push_back(reg[b]);
+      }
+      _result = reg[_result];
+    }
+    /**
+     * Make the graph and the instructions
+     *
+     * @param q Q-vector to take the layout from
+     */
+    void make(const QVector& q)
+    {
+      _layout = q.layout();
+      if (_h.empty()) return;
+
+      Builder        b;
+      HarmonicVector m(_h);
+      std::sort(m.begin(), m.end());
+      _result = node(b, m);
+      allocate(b.nValues);
+
+      _factors.resize(b.factors.size());
+      for (FactorMap::const_iterator i = b.factors.begin();
+	   i != b.factors.end(); ++i) {
+	Factor& f = _factors[i->second];
+	f.n = i->first.first;
+	f.p = i->first.second;
+	q.locate(f.n, f.p, f.re, f.im, f.s);
+      }
+    }
+    /** Harmonics */
+    HarmonicVector  _h;
+    /** Layout of Q-vector the factor locations are for */
+    QVector::Layout _layout;
+    /** Distinct factors */
+    FactorVector    _factors;
+    /** Instructions */
+    CodeVector      _code;
+    /** Number of sub-expressions */
+    size_t          _nNodes;
+    /** Number of registers */
+    size_t          _nRegs;
+    /** Register of the result */
+    unsigned int    _result;
+  };
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
@@ -0,0 +1,371 @@
+#ifndef CORRELATIONS_CORRELATORPLAN_HH
+#define CORRELATIONS_CORRELATORPLAN_HH
+/**
+ * @file   correlations/CorrelatorPlan.hh
+ * @date   Sat Oct 17 07:00:08 2026
+ *
+ * @brief  A correlator compiled into a flat list of terms
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <correlations/Types.hh>
+#include <correlations/QVector.hh>
+#include <correlations/PlainComplex.hh>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <iostream>
+
+namespace correlations {
+  //____________________________________________________________________
+  /**
+   * The @f$ n@f$-particle correlator of a fixed set of harmonics
+   * @f$ h_1,\ldots,h_n@f$, compiled into a flat list of terms.
+   *
+   * The correlator is a sum over the set partitions @f$\pi@f$ of
+   * @f$\{1,\ldots,n\}@f$
+   *
+   * @f[
+   *   C\{n\} = \sum_{\pi}\prod_{B\in\pi} (-1)^{|B|-1}(|B|-1)!\,
+   *   Q_{\sum_{j\in B}h_j,|B|}
+   * @f]
+   *
+   * When the plan is made, the partitions are enumerated once, terms
+   * with the same factors are merged (which happens a lot when
+   * harmonics are repeated), and the storage location of each
+   * distinct factor @f$ Q_{h,p}@f$ is looked up (see
+   * QVector::locate).  Per event, evaluate then only
+   *
+   * - loads the distinct factors from the @f$ Q@f$-vector, and
+   * - runs through the terms, multiplying factors and adding up.
+   *
+   * The terms are sorted so that consecutive terms share as many
+   * leading factors as possible, and partial products of shared
+   * factors are reused.
+   *
+   @code
+   correlations::QVector        q(h, true);
+   correlations::CorrelatorPlan p(q, h.size(), h);
+   correlations::PlainVector    z;
+   while (moreEvents) {
+     ...
+     correlations::Complex c = p.evaluate(q, z);
+   }
+   @endcode
+   *
+   * A plan can be evaluated with any @f$ Q@f$-vector, but the
+   * pre-computed locations are only used if it has the same layout
+   * (see QVector::layout) as the one the plan was made for.
+   *
+   * @headerfile ""  <correlations/CorrelatorPlan.hh>
+   */
+  struct CorrelatorPlan
+  {
+    /** Constructor of an empty plan */
+    CorrelatorPlan()
+      : _h(0), _layout(), _factors(0), _terms(0), _ids(0), _nMul(0)
+    {}
+    /**
+     * Constructor.  Makes the plan for the @a n particle correlator
+     * with harmonics @a h, for @f$ Q@f$-vectors laid out like @a q.
+     *
+     * @param q Q-vector to take the layout from
+     * @param n Number of particles to correlate
+     * @param h Harmonics (at least @a n)
+     */
+    CorrelatorPlan(const QVector& q, const Size n, const HarmonicVector& h)
+      : _h(h.begin(), h.begin() + n), _layout(), _factors(0), _terms(0),
+	_ids(0), _nMul(0)
+    {
+      make(q);
+    }
+    /**
+     * Check if this is the plan of the @a n particle correlator with
+     * harmonics @a h
+     *
+     * @param n Number of particles
+     * @param h Harmonics
+     *
+     * @return true if so
+     */
+    bool matches(const Size n, const HarmonicVector& h) const
+    {
+      return n == _h.size() && std::equal(_h.begin(), _h.end(), h.begin());
+    }
+    /**
+     * Evaluate the correlator
+     *
+     * @param q Q-vector
+     * @param z Scratch space.  Resized as needed, so nothing is
+     *          allocated once it is big enough.
+     *
+     * @return The correlator
+     */
+    Complex evaluate(const QVector& q, PlainVector& z) const
+    {
+      const size_t nf = _factors.size();
+      if (z.size() < nf + _h.size() + 1) z.resize(nf + _h.size() + 1);
+      PlainComplex* f = &(z[0]);
+      PlainComplex* s = f + nf;
+
+      // Load the factors
+      if (q.layout() == _layout) {
+	const Real* d = q.data();
+	for (size_t i = 0; i < nf; i++) {
+	  const Factor& x = _factors[i];
+	  f[i] = PlainComplex(d[x.re], x.s * d[x.im]);
+	}
+      }
+      else {
+	for (size_t i = 0; i < nf; i++)
+	  f[i] = q(_factors[i].n, _factors[i].p);
+      }
+
+      // Sum the terms.  s[j] is the product of the first j factors
+      // of the current term.
+      s[0] = PlainComplex(1, 0);
+      PlainComplex        r;
+      const unsigned int* id = _ids.empty() ? 0 : &(_ids[0]);
+      for (TermVector::const_iterator t = _terms.begin();
+	   t != _terms.end(); ++t) {
+	for (unsigned short j = t->shared; j < t->length; j++, id++)
+	  s[j+1] = s[j] * f[*id];
+	r += t->coef * s[t->length];
+      }
+      return r.complex();
+    }
+    /**
+     * @return Number of particles correlated
+     */
+    Size size() const { return _h.size(); }
+    /**
+     * @return The harmonics
+     */
+    const HarmonicVector& harmonics() const { return _h; }
+    /**
+     * @return Number of (merged) terms
+     */
+    size_t nTerms() const { return _terms.size(); }
+    /**
+     * @return Number of distinct factors @f$ Q_{h,p}@f$
+     */
+    size_t nFactors() const { return _factors.size(); }
+    /**
+     * @return Number of complex multiplications per evaluation
+     */
+    size_t nMultiplications() const { return _nMul; }
+    /**
+     * Print the plan
+     *
+     * @param o Output stream
+     */
+    void print(std::ostream& o) const
+    {
+      o << "C{" << _h.size() << "}(";
+      for (size_t i = 0; i < _h.size(); i++)
+	o << (i == 0 ? "" : ",") << _h[i];
+      o << "): " << _terms.size() << " terms, " << _factors.size()
+	<< " factors, " << _nMul << " multiplications" << std::endl;
+      const unsigned int* id = _ids.empty() ? 0 : &(_ids[0]);
+      std::vector<unsigned int> cur(_h.size() + 1, 0);
+      for (TermVector::const_iterator t = _terms.begin();
+	   t != _terms.end(); ++t) {
+	o << "  " << (t->coef < 0 ? "- " : "+ ") << std::abs(t->coef);
+	for (unsigned short j = t->shared; j < t->length; j++)
+	  cur[j] = *id++;
+	for (unsigned short j = 0; j < t->length; j++)
+	  o << " * Q(" << _factors[cur[j]].n << ","
+	    << _factors[cur[j]].p << ")";
+	o << std::endl;
+      }
+    }
+  protected:
+    /** A distinct factor @f$ Q_{n,p}@f$ */
+    struct Factor
+    {
+      Harmonic n;  /**< Harmonic */
+      Power    p;  /**< Power */
+      size_t   re; /**< Location of real part */
+      size_t   im; /**< Location of imaginary part */
+      Real     s;  /**< Sign of imaginary part */
+    };
+    /** A term */
+    struct Term
+    {
+      Real           coef;   /**< Coefficient */
+      unsigned short length; /**< Number of factors */
+      unsigned short shared; /**< Leading factors shared with previous */
+    };
+    /** Type of list of factors */
+    typedef std::vector<Factor> FactorVector;
+    /** Type of list of terms */
+    typedef std::vector<Term> TermVector;
+    /** Factors of a term, as sorted factor identifiers */
+    typedef std::vector<unsigned int> Key;
+    /** Type of map from factors to coefficient */
+    typedef std::map<Key,Real> TermMap;
+    /** Order factor identifiers by decreasing use */
+    struct ByUse
+    {
+      /**
+       * Constructor
+       *
+       * @param use Number of uses of each identifier
+       */
+      ByUse(const std::vector<size_t>& use) : _use(use) {}
+      /**
+       * @param a An identifier
+       * @param b Another identifier
+       *
+       * @return true if @a a is used more than @a b
+       */
+      bool operator()(unsigned int a, unsigned int b) const
+      {
+	return _use[a] != _use[b] ? _use[a] > _use[b] : a < b;
+      }
+      /** Number of uses of each identifier */
+      const std::vector<size_t>& _use;
+    };
+    /**
+     * Make the plan
+     *
+     * @param q Q-vector to take the layout from
+     */
+    void make(const QVector& q)
+    {
+      const Size n = _h.size();
+      _layout      = q.layout();
+      if (n == 0) return;
+
+      // Enumerate the set partitions as restricted growth strings:
+      // a[i] is the block of element i, and a[i] is at most one more
+      // than the largest block of the elements before it.
+      std::vector<Size>       a(n, 0);
+      std::vector<Size>       m(n, 0);  // m[i] = max(a[0..i])
+      std::vector<Harmonic>   sum(n);
+      std::vector<Size>       cnt(n);
+      std::map<std::pair<Harmonic,Power>,unsigned int> ids;
+      TermMap                 terms;
+      Key                     key;
+      while (true) {
+	const Size nb = m[n-1] + 1;
+	std::fill(sum.begin(), sum.begin() + nb, 0);
+	std::fill(cnt.begin(), cnt.begin() + nb, 0);
+	for (Size i = 0; i < n; i++) {
+	  sum[a[i]] += _h[i];
+	  cnt[a[i]]++;
+	}
+	Real coef = 1;
+	key.clear();
+	for (Size b = 0; b < nb; b++) {
+	  for (Size k = 2; k < cnt[b]; k++) coef *= k;
+	  if (cnt[b] % 2 == 0) coef = -coef;
+	  std::pair<Harmonic,Power> f(sum[b], cnt[b]);
+	  if (ids.find(f) == ids.end()) {
+	    const unsigned int id = ids.size();
+	    ids[f] = id;
+	  }
+	  key.push_back(ids[f]);
+	}
+	std::sort(key.begin(), key.end());
+	terms[key] += coef;
+
+	// Next restricted growth string
+	Size i = n - 1;
+	while (i > 0 && a[i] > m[i-1]) i--;
+	if (i == 0) break;
+	a[i]++;
+	m[i] = std::max(m[i-1], a[i]);
+	for (Size j = i + 1; j < n; j++) {
+	  a[j] = 0;
+	  m[j] = m[i];
+	}
+      }
+
+      // Renumber the factors so that the most used come first
+      std::vector<size_t> use(ids.size(), 0);
+      for (TermMap::const_iterator t = terms.begin(); t != terms.end(); ++t)
+	for (Key::const_iterator f = t->first.begin();
+	     f != t->first.end(); ++f) use[*f]++;
+      std::vector<unsigned int> order(ids.size());
+      for (size_t i = 0; i < order.size(); i++) order[i] = i;
+      std::sort(order.begin(), order.end(), ByUse(use));
+      std::vector<unsigned int> remap(ids.size());
+      for (size_t i = 0; i < order.size(); i++) remap[order[i]] = i;
+
+      _factors.resize(ids.size());
+      for (std::map<std::pair<Harmonic,Power>,unsigned int>::const_iterator
+	     i = ids.begin(); i != ids.end(); ++i) {
+	Factor& f = _factors[remap[i->second]];
+	f.n = i->first.first;
+	f.p = i->first.second;
+	q.locate(f.n, f.p, f.re, f.im, f.s);
+      }
+
+      // Sort the terms on the renumbered factors, so that terms with
+      // common leading factors are next to each other
+      TermMap sorted;
+      for (TermMap::const_iterator t = terms.begin(); t != terms.end(); ++t) {
+	if (t->second == 0) continue;
+	Key k(t->first.size());
+	for (size_t j = 0; j < k.size(); j++) k[j] = remap[t->first[j]];
+	std::sort(k.begin(), k.end());
+	sorted[k] = t->second;
+      }
+      _terms.reserve(sorted.size());
+      const Key* prev = 0;
+      for (TermMap::const_iterator t = sorted.begin(); t != sorted.end();
+	   ++t) {
+	const Key& k = t->first;
+	Term       e;
+	e.coef   = t->second;
+	e.length = k.size();
+	e.shared = 0;
+	if (prev)
+	  while (e.shared < e.length && e.shared < prev->size()
+		 && (*prev)[e.shared] == k[e.shared]) e.shared++;
+	// Always recompute the last factor, so that the partial
+	// product is there even if this term is a prefix of the
+	// previous one
+	if (e.shared == e.length) e.shared--;
+	for (unsigned short j = e.shared; j < e.length; j++)
+	  _ids.push_back(k[j]);
+	_nMul += e.length - e.shared - 1 + (e.shared > 0 ? 1 : 0);
+	_terms.push_back(e);
+	prev = &k;
+      }
+    }
+    /** Harmonics */
+    HarmonicVector  _h;
+    /** Layout of Q-vector the factor locations are for */
+    QVector::Layout _layout;
+    /** Distinct factors */
+    FactorVector    _factors;
+    /** Terms */
+    TermVector      _terms;
+    /** Identifiers of the factors of each term not shared with the
+	previous term */
+    std::vector<unsigned int> _ids;
+    /** Number of complex multiplications per evaluation */
+    size_t          _nMul;
+  };
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
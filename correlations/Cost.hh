@@ -0,0 +1,530 @@
+#ifndef CORRELATIONS_COST_HH
+#define CORRELATIONS_COST_HH
+/**
+ * @file   correlations/Cost.hh
+ * @date   Sat Oct 17 07:45:59 2026
+ *
+ * @brief  Operation counts of the correlator engines
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <correlations/Types.hh>
+#include <correlations/QVector.hh>
+#include <correlations/CorrelatorDag.hh>
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <set>
+#include <vector>
+
+namespace correlations {
+  //____________________________________________________________________
+  /**
+   * Number of operations done by a correlator to evaluate one
+   * correlator of one event.  Multiplications by real coefficients
+   * are not counted on their own, as they are folded into the
+   * complex multiplications and additions.
+   *
+   * The same structure, with the time or weight of each kind of
+   * operation in the members, serves as the unit costs of estimate.
+   *
+   * @headerfile ""  <correlations/Cost.hh>
+   */
+  struct Cost
+  {
+    /**
+     * Constructor
+     *
+     * @param m  Complex multiplications
+     * @param a  Complex additions
+     * @param l  Loads of @f$ Q@f$-vector components
+     * @param c  Function calls
+     * @param e  Complex exponentials
+     */
+    Cost(Real m=0, Real a=0, Real l=0, Real c=0, Real e=0)
+      : mul(m), add(a), loads(l), calls(c), exps(e), ok(true)
+    {}
+    /**
+     * Add the operations of @a o
+     *
+     * @param o Other count
+     *
+     * @return Reference to this
+     */
+    Cost& operator+=(const Cost& o)
+    {
+      mul   += o.mul;
+      add   += o.add;
+      loads += o.loads;
+      calls += o.calls;
+      exps  += o.exps;
+      ok    =  ok && o.ok;
+      return *this;
+    }
+    /**
+     * Multiply all counts by @a f
+     *
+     * @param f Factor
+     *
+     * @return Reference to this
+     */
+    Cost& operator*=(Real f)
+    {
+      mul   *= f;
+      add   *= f;
+      loads *= f;
+      calls *= f;
+      exps  *= f;
+      return *this;
+    }
+    /**
+     * Default unit costs, in approximate floating-point operations.
+     * A complex multiplication is 6, an addition 2, a load 2
+     * (address calculation and two reads), a call 10, and a complex
+     * exponential 40.
+     *
+     * @return Unit costs
+     */
+    static Cost units() { return Cost(6, 2, 2, 10, 40); }
+    /**
+     * Estimate the cost as the sum of the operations, each weighted
+     * by the corresponding member of @a u.
+     *
+     * @param u Unit costs (e.g., times) of each operation
+     *
+     * @return Estimated cost, or a very large value if not available
+     */
+    Real estimate(const Cost& u=units()) const
+    {
+      if (!ok) return 1e300;
+      return (mul * u.mul + add * u.add + loads * u.loads
+	      + calls * u.calls + exps * u.exps);
+    }
+    /**
+     * Print the counts
+     *
+     * @param o Output stream
+     */
+    void print(std::ostream& o) const
+    {
+      if (!ok) {
+	o << std::setw(12) << "n/a";
+	return;
+      }
+      o << std::setw(12) << mul   << ' '
+	<< std::setw(12) << add   << ' '
+	<< std::setw(12) << loads << ' '
+	<< std::setw(12) << calls << ' '
+	<< std::setw(12) << exps  << ' '
+	<< std::setw(12) << estimate();
+    }
+    /** Number of complex multiplications */
+    Real mul;
+    /** Number of complex additions and subtractions */
+    Real add;
+    /** Number of @f$ Q@f$-vector components read */
+    Real loads;
+    /** Number of calls of recursive functions */
+    Real calls;
+    /** Number of complex exponentials */
+    Real exps;
+    /** False if the engine cannot calculate the correlator */
+    bool ok;
+  };
+
+  //____________________________________________________________________
+  /**
+   * Operation counts of the correlator engines.
+   *
+   * The counts are for one call of Correlator::calculate, i.e., the
+   * numerator @f$ QC\{n\}(h_1,\ldots,h_n)@f$ and the denominator
+   * @f$ QC\{n\}(0,\ldots,0)@f$, and follow the code of each engine.
+   * They depend on the order @f$ n@f$, on which harmonics are equal
+   * (correlators of equal harmonics, like the denominator, are
+   * calculated by FromQVector::identical), and for the recursive and
+   * grouped engines on which sums of harmonics are equal.  For the
+   * nested loops they depend on the multiplicity @f$ M@f$ of the
+   * event instead.
+   *
+   * The counts can be used to pick an engine before running a
+   * production
+   *
+   @code
+   correlations::HarmonicVector h(8);
+   ...
+   correlations::CostModel::EEngine best = correlations::CostModel::fastest(h);
+   std::cout << "Use " << correlations::CostModel::name(best) << std::endl;
+   @endcode
+   *
+   * The program @c print prints tables of these (@c ./print @c -t
+   * @c cost).
+   *
+   * @headerfile ""  <correlations/Cost.hh>
+   */
+  struct CostModel
+  {
+    /** The engines */
+    enum EEngine {
+      kClosed,      /**< correlations::closed::FromQVector */
+      kRecurrence,  /**< correlations::recurrence::FromQVector */
+      kRecursive,   /**< correlations::recursive::FromQVector */
+      kGrouped,     /**< correlations::grouped::FromQVector */
+      kDag,         /**< correlations::dag::FromQVector */
+      kNestedLoops, /**< correlations::recursive::NestedLoops */
+      kNEngines
+    };
+    /**
+     * @param e Engine
+     *
+     * @return Name of the engine, as used by the test programs
+     */
+    static const char* name(EEngine e)
+    {
+      switch (e) {
+      case kClosed:      return "closed";
+      case kRecurrence:  return "recurrence";
+      case kRecursive:   return "recursive";
+      case kGrouped:     return "grouped";
+      case kDag:         return "dag";
+      case kNestedLoops: return "loops";
+      default:           break;
+      }
+      return "unknown";
+    }
+    /**
+     * Operations of engine @a e to calculate the @f$ n@f$-particle
+     * correlator of the harmonics @a h, numerator and denominator.
+     *
+     * @param e Engine
+     * @param n Number of particles
+     * @param h Harmonics
+     * @param m Multiplicity of events (nested loops only)
+     *
+     * @return Operation counts
+     */
+    static Cost cost(EEngine e, Size n, const HarmonicVector& h, Size m=100)
+    {
+      if (e == kNestedLoops) return nestedLoops(n, m);
+
+      Cost c = identical(n);
+      if (n > 0 && std::count(h.begin(), h.begin() + n, h[0]) == n)
+	c += identical(n);
+      else {
+	switch (e) {
+	case kClosed:     c += closed(n);           break;
+	case kRecurrence: c += recurrence(n);       break;
+	case kRecursive:  c += recursive(n, h);     break;
+	case kGrouped:    c += grouped(n, h);       break;
+	case kDag:        c += dag(n, h);           break;
+	default:          break;
+	}
+      }
+      return c;
+    }
+    /**
+     * Find the engine with the smallest estimated cost
+     *
+     * @param h Harmonics.  The correlator size is the size of @a h
+     * @param m Multiplicity of events
+     * @param u Unit costs of the operations
+     *
+     * @return The engine
+     */
+    static EEngine fastest(const HarmonicVector& h, Size m=100,
+			   const Cost& u=Cost::units())
+    {
+      EEngine best = kClosed;
+      Real    min  = 0;
+      for (int e = 0; e < kNEngines; e++) {
+	Real t = cost(EEngine(e), h.size(), h, m).estimate(u);
+	if (e != 0 && t >= min) continue;
+	best = EEngine(e);
+	min  = t;
+      }
+      return best;
+    }
+    /**
+     * Print a table of the operations of all engines for the
+     * correlators of @f$ 1,\ldots,n@f$ particles of the first
+     * harmonics of @a h
+     *
+     * @param o Output stream
+     * @param h Harmonics
+     * @param m Multiplicity of events (nested loops only)
+     */
+    static void print(std::ostream& o, const HarmonicVector& h, Size m=100)
+    {
+      o << "# " << std::setw(3) << "n" << ' ' << std::setw(10) << "engine";
+      const char* cols[] = { "mul", "add", "loads", "calls", "exps",
+			     "estimate", 0 };
+      for (const char** p = cols; *p; p++) o << ' ' << std::setw(12) << *p;
+      o << std::endl;
+      for (Size n = 1; n <= h.size(); n++) {
+	for (int e = 0; e < kNEngines; e++) {
+	  o << "  " << std::setw(3) << n << ' '
+	    << std::setw(10) << name(EEngine(e)) << ' ';
+	  cost(EEngine(e), n, h, m).print(o);
+	  o << '\n';
+	}
+      }
+      o << std::flush;
+    }
+    /**
+     * @{
+     * @name Numerators
+     */
+    /**
+     * Operations of FromQVector::identical, which all @f$ Q@f$-vector
+     * engines use for equal harmonics: @f$ n@f$ loads, and @f$
+     * n(n+1)/2@f$ multiply-adds.
+     *
+     * @param n Number of particles
+     *
+     * @return Operation counts
+     */
+    static Cost identical(Size n)
+    {
+      const Real t = Real(n) * (n + 1) / 2;
+      return Cost(t, t, n);
+    }
+    /**
+     * Operations of closed::expand.  Each of the @f$ 2^n-1@f$
+     * @f$ Q@f$-vector components is loaded once.  Each sub-set @f$
+     * S@f$ of @f$ s@f$ slots takes @f$ 2^{s-1}-1@f$ multiplications
+     * and additions.  The sub-sets are the full set, and the @f$
+     * \binom{n-1}{s}@f$ sub-sets of @f$ s@f$ of the last @f$ n-1@f$
+     * slots.
+     *
+     * @param n Number of particles
+     *
+     * @return Operation counts, not ok if @f$ n@f$ is larger than
+     * @c CORRELATIONS_CLOSED_MAX
+     */
+    static Cost closed(Size n)
+    {
+      Cost c;
+      if (n > CORRELATIONS_CLOSED_MAX) {
+	c.ok = false;
+	return c;
+      }
+      Real b = 1; // Binomial(n-1, s)
+      for (Size s = 1; s <= n; s++) {
+	const Real t = Real(1ul << (s - 1));
+	const Real k = (s < n ? b * (n - s) / s : 1); // # of sets
+	if (s < n) b = k;
+	c += Cost(t - 1, t - 1) *= k;
+      }
+      c += Cost(0, 0, Real((1ul << n) - 1));
+      return c;
+    }
+    /**
+     * Operations of recurrence::FromQVector.  The correlators of up
+     * to 3 particles are written out.  Beyond that, the correlator of
+     * each sub-set @f$ S@f$ of the first @f$ n-1@f$ slots, and of
+     * all @f$ n@f$, is calculated once, as a sum of @f$
+     * 2^{|S|-1}@f$ terms (see correlations::Combinations), each one
+     * load, multiplication, and addition.
+     *
+     * @param n Number of particles
+     *
+     * @return Operation counts
+     */
+    static Cost recurrence(Size n)
+    {
+      switch (n) {
+      case 0: return Cost();
+      case 1: return Cost(0, 0, 1);
+      case 2: return Cost(1, 1, 3);
+      case 3: return Cost(4, 4, 9);
+      }
+      Cost c;
+      Real b = 1; // Binomial(n-1, s)
+      for (Size s = 1; s <= n; s++) {
+	const Real t = Real(1ul << (s - 1));
+	const Real k = (s < n ? b * (n - s) / s : 1); // # of sets
+	if (s < n) b = k;
+	c += Cost(t, t, t) *= k;
+      }
+      c.calls += 1;
+      return c;
+    }
+    /**
+     * Operations of recursive::FromQVector.  This follows the
+     * recursion, including the look-ups of memoized results, so the
+     * count depends on which sums of harmonics are equal.  Each call,
+     * whether or not the result is memoized, counts as a call.
+     *
+     * @param n Number of particles
+     * @param h Harmonics
+     *
+     * @return Operation counts
+     */
+    static Cost recursive(Size n, const HarmonicVector& h)
+    {
+      std::vector<int>  hh(h.begin(), h.begin() + n);
+      std::vector<int>  cnt(n, 1);
+      Memo              memo;
+      Cost              c;
+      c.calls++;
+      recursive(n, hh, cnt, memo, c);
+      return c;
+    }
+    /**
+     * Operations of grouped::FromQVector.  Each of the @f$
+     * \prod_g(m_g+1)@f$ states, with @f$ c_g@f$ harmonics of group
+     * @f$ g@f$, takes @f$ c_f\prod_{g>f}(c_g+1)@f$ terms, where @f$
+     * f@f$ is the first group with @f$ c_f>0@f$, and each term one
+     * load, multiplication, and addition.
+     *
+     * @param n Number of particles
+     * @param h Harmonics
+     *
+     * @return Operation counts
+     */
+    static Cost grouped(Size n, const HarmonicVector& h)
+    {
+      HarmonicVector v(h.begin(), h.begin() + n);
+      std::sort(v.begin(), v.end());
+      std::vector<Size> m;
+      for (Size i = 0; i < n; i++) {
+	if (i > 0 && v[i] == v[i-1]) m.back()++;
+	else                         m.push_back(1);
+      }
+      // Iterate over all states c, except the empty one
+      std::vector<Size> c(m.size(), 0);
+      Real              t = 0;
+      while (true) {
+	size_t g = 0;
+	while (g < c.size() && c[g] == m[g]) c[g++] = 0;
+	if (g == c.size()) break;
+	c[g]++;
+	size_t f = 0;
+	while (c[f] == 0) f++;
+	Real s = c[f];
+	for (size_t j = f + 1; j < c.size(); j++) s *= c[j] + 1;
+	t += s;
+      }
+      return Cost(t, t, t);
+    }
+    /**
+     * Operations of dag::FromQVector, i.e., of the expression graph
+     * correlations::CorrelatorDag.  The code compiled by
+     * jit::FromQVector does the same operations.
+     *
+     * @param n Number of particles
+     * @param h Harmonics
+     *
+     * @return Operation counts
+     */
+    static Cost dag(Size n, const HarmonicVector& h)
+    {
+      HarmonicVector hn(h.begin(), h.begin() + n);
+      QVector        q(hn, false);
+      CorrelatorDag  d(q, n, hn);
+      return Cost(d.nMultiplications(), d.nAdditions(), d.nFactors());
+    }
+    /**
+     * Operations of recursive::NestedLoops, numerator and
+     * denominator, for events of multiplicity @a m.  Each of the
+     * @f$ m!/(m-n)!@f$ terms takes one complex exponential and
+     * addition, and each level of the loops is a call.
+     *
+     * @param n Number of particles
+     * @param m Multiplicity
+     *
+     * @return Operation counts
+     */
+    static Cost nestedLoops(Size n, Size m)
+    {
+      Real calls = 0;
+      Real p     = 1; // m!/(m-k)!
+      for (Size k = 0; k < n; k++) {
+	calls += p;
+	p     *= (k < m ? m - k : 0);
+      }
+      return Cost(0, p, 0, calls, p);
+    }
+    /* @} */
+  protected:
+    /** Memoized states of the recursive engine */
+    typedef std::set<std::vector<int> > Memo;
+    /**
+     * Count the operations of recursive::FromQVector::ucN2
+     *
+     * @param n    Number of slots
+     * @param h    Harmonics of slots
+     * @param cnt  Number of particles of slots
+     * @param memo Memoized states
+     * @param c    On return, incremented by the operations
+     */
+    static void recursive(Size n, std::vector<int>& h,
+			  std::vector<int>& cnt, Memo& memo, Cost& c)
+    {
+      const Size j = n - 1;
+      c.loads++;
+      if (n == 1) return;
+
+      memoized(j, h, cnt, memo, c);
+      c.mul++;
+      if (cnt[j] > 1) return;
+
+      for (Size i = 0; i < j; i++) {
+	h[i]   += h[j];
+	cnt[i] += 1;
+	memoized(j, h, cnt, memo, c);
+	c.add++;
+	cnt[i] -= 1;
+	h[i]   -= h[j];
+      }
+    }
+    /**
+     * Count the operations of recursive::FromQVector::memoN2
+     *
+     * @param n    Number of slots
+     * @param h    Harmonics of slots
+     * @param cnt  Number of particles of slots
+     * @param memo Memoized states
+     * @param c    On return, incremented by the operations
+     */
+    static void memoized(Size n, std::vector<int>& h,
+			 std::vector<int>& cnt, Memo& memo, Cost& c)
+    {
+      c.calls++;
+      if (n < 6) { // recursive::FromQVector::kMinMemo
+	recursive(n, h, cnt, memo, c);
+	return;
+      }
+      // Same key as in recursive::FromQVector::memoN2
+      std::vector<int> key(n + 1);
+      key[0] = n;
+      for (Size i = 0; i < n; i++) key[1+i] = h[i] * 256 + cnt[i];
+      for (Size i = 0; i < n; ) {
+	Size e = i;
+	while (e < n && cnt[e] == 1) e++;
+	if (e - i > 1) std::sort(key.begin() + 1 + i, key.begin() + 1 + e);
+	i = (e == i ? i + 1 : e);
+      }
+      if (!memo.insert(key).second) return;
+      recursive(n, h, cnt, memo, c);
+    }
+  };
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
@@ -26,6 +26,8 @@
  */
 #include <correlations/QVector.hh>
 #include <correlations/Correlator.hh>
+#include <correlations/Workspace.hh>
+#include <algorithm>
 
 
 namespace correlations {
@@ -53,18 +55,164 @@ namespace correlations {
    }
    std::cout << r.eval() << std::endl;
    @endcode
+   *
+   * The correlator above is bound to a Q-vector, and keeps its
+   * caches in a workspace of its own, so it must only be used by one
+   * thread at a time.  A correlator can also be used without binding
+   * it to a Q-vector, in which case the Q-vector and a
+   * correlations::Workspace are passed to each call:
+   *
+   @code
+   correlations::FromQVector c;
+   correlations::Workspace   ws;
+
+   while (moreEvents) {
+     ...
+     r += c.calculate(q, h, ws);
+   }
+   @endcode
+   *
+   * Such calls do not modify the correlator, so one correlator may
+   * serve many threads, each with its own Q-vector and workspace.
+   *
    * @headerfile ""  <correlations/FromQVector.hh>
    */
   struct FromQVector : public Correlator
   {
     virtual ~FromQVector() {}
+    /**
+     * Copy constructor.  The copy is bound to the same Q-vector, but
+     * has a workspace of its own.
+     *
+     * @param o Object to copy from
+     */
+    FromQVector(const FromQVector& o)
+      : Correlator(o), _q(o._q), _ws()
+    {}
+    /**
+     * Assignment operator.  Our workspace is cleared.
+     *
+     * @param o Object to assign from
+     *
+     * @return Reference to this
+     */
+    FromQVector& operator=(const FromQVector& o)
+    {
+      if (&o == this) return *this;
+      Correlator::operator=(o);
+      _q = o._q;
+      _ws.clear();
+      return *this;
+    }
+    using Correlator::calculate;
+    /**
+     * Calculate the multi-particle correlation of the Q-vector @a q.
+     * The correlator size is the size of @a h.
+     *
+     * @param q  Q-vector
+     * @param h  Harmonics
+     * @param ws Workspace to use
+     *
+     * @return The correlation
+     */
+    Result calculate(const QVector& q, const HarmonicVector& h,
+		     Workspace& ws) const
+    {
+      return calculate(q, h.size(), h, ws);
+    }
+    /**
+     * Calculate the @a n particle correlation of the Q-vector @a q.
+     * Apart from the workspace @a ws, nothing is modified, so
+     * several threads can use the same correlator at the same time,
+     * as long as they use different workspaces.
+     *
+     * @param q  Q-vector
+     * @param n  How many particles to correlate
+     * @param h  Harmonics
+     * @param ws Workspace to use
+     *
+     * @return The correlation
+     */
+    Result calculate(const QVector& q, const Size n,
+		     const HarmonicVector& h, Workspace& ws) const
+    {
+      ws.use(q);
+      Result r;
+      if (ws.lookup(this, n, h, r)) return r;
+
+      r = Result(numerator(q, ws, n, h), denominator(q, ws, n));
+      ws.remember(this, n, h, r);
+      return r;
+    }
+    /**
+     * Calculate only the numerator of the @a n particle correlation
+     * of the Q-vector @a q, i.e., without the denominator, and
+     * without looking up or remembering the result in the workspace.
+     * This is, e.g., used to time correlators against each other.
+     *
+     * @param q  Q-vector
+     * @param n  How many particles to correlate
+     * @param h  Harmonics
+     * @param ws Workspace to use
+     *
+     * @return @f$ \langle\exp[i(\sum_j^n h_j\phi_j)]\rangle@f$
+     */
+    Complex calculateNumerator(const QVector& q, const Size n,
+			       const HarmonicVector& h, Workspace& ws) const
+    {
+      ws.use(q);
+      return numerator(q, ws, n, h);
+    }
   protected:
     /**
-     * Constructor
+     * Constructor of a correlator bound to a Q-vector
      *
      * @param q Q vector to use
      */
-    FromQVector(QVector& q) : Correlator(0), _q(q) {}
+    FromQVector(QVector& q)
+      : Correlator(0), _q(&q), _ws()
+    {}
+    /**
+     * Constructor of a correlator not bound to any Q-vector.  Such a
+     * correlator can only be used by passing a Q-vector and a
+     * workspace to calculate.
+     */
+    FromQVector()
+      : Correlator(0), _q(0), _ws()
+    {}
+    /**
+     * Calculate the @a n particle correlation of the bound Q-vector,
+     * using our own workspace.
+     *
+     * @param n How many particles to correlate
+     * @param h Harmonic of each term
+     *
+     * @return The correlator and the summed weights
+     */
+    Result bound(const Size n, const HarmonicVector& h) const
+    {
+      if (!_q) {
+	std::cerr << name() << " not bound to a Q-vector" << std::endl;
+	return Result();
+      }
+      return calculate(*_q, n, h, _ws);
+    }
+    /**
+     * Calculate the @a n particle correlation of the harmonics in
+     * the array @a h, with our own Q-vector and workspace.  The
+     * harmonics are copied to the workspace, so nothing is
+     * allocated once that has room for them.
+     *
+     * @param n How many particles to correlate
+     * @param h Harmonic of each term
+     *
+     * @return The correlator and the summed weights
+     */
+    virtual Result cArgs(const Size n, const Harmonic* h) const
+    {
+      _ws.given.assign(h, h + n);
+      return bound(n, _ws.given);
+    }
     /**
      * @{
      * @name Drivers
@@ -79,14 +227,7 @@ namespace correlations {
      */
     virtual Result cN(const Size n, const HarmonicVector& h) const
     {
-      static HarmonicVector null(0);
-      if (null.size() <= 0) null.resize(_q.maxN());
-      static bool filled = false;
-      if (!filled) {
-        std::fill(null.begin(), null.end(), 0);
-        filled = true;
-      }
-      return Result(ucN(n, h), ucN(n, null).real());
+      return bound(n, h);
     }
     /**
      * Calculate 1-particle correlation.
@@ -100,7 +241,7 @@ namespace correlations {
      */
     virtual Result c1(const HarmonicVector& h) const
     {
-      return Result(uc1(h[0]), uc1(0).real());
+      return bound(1, h);
     }
     /**
      * Generic two-particle correlation.
@@ -114,7 +255,7 @@ namespace correlations {
      */
     virtual Result c2(const HarmonicVector& h) const
     {
-      return Result(uc2(h[0], h[1]), uc2(0, 0).real());
+      return bound(2, h);
     }
     /**
      * Generic 3-particle correlation.
@@ -128,7 +269,7 @@ namespace correlations {
      */
     virtual Result c3(const HarmonicVector& h) const
     {
-      return Result(uc3(h[0], h[1], h[2]), uc3(0,0,0).real());
+      return bound(3, h);
     }
     /**
      * Generic 4-particle correlation.
@@ -142,7 +283,7 @@ namespace correlations {
      */
     virtual Result c4(const HarmonicVector& h) const
     {
-      return Result(uc4(h[0],h[1],h[2],h[3]), uc4(0,0,0,0).real());
+      return bound(4, h);
     }
     /**
      * Calculate 5-particle correlator.
@@ -156,8 +297,7 @@ namespace correlations {
      */
     virtual Result c5(const HarmonicVector& h) const
     {
-      return Result(uc5(h[0], h[1], h[2], h[3], h[4]),
-                    uc5(0, 0, 0, 0, 0).real());
+      return bound(5, h);
     }
     /**
      * Calculate 6-particle correlator.
@@ -171,8 +311,7 @@ namespace correlations {
      */
     virtual Result c6(const HarmonicVector& h) const
     {
-      return Result(uc6(h[0],h[1],h[2],h[3],h[4],h[5]),
-                    uc6(0,   0,   0,   0,   0,   0).real());
+      return bound(6, h);
     }
     /**
      * Calculate 7-particle correlator.
@@ -186,9 +325,7 @@ namespace correlations {
      */
     virtual Result c7(const HarmonicVector& h) const
     {
-      std::cout << "Calculating C7" << std::endl;
-      return Result(uc7(h[0],h[1],h[2],h[3],h[4],h[5],h[6]),
-                    uc7(0,   0,   0,   0,   0,   0,   0).real());
+      return bound(7, h);
     }
     /**
      * Calculate 8-particle correlator.
@@ -202,9 +339,7 @@ namespace correlations {
      */
     virtual Result c8(const HarmonicVector& h) const
     {
-      std::cout << "Calculating C8" << std::endl;
-      return Result(uc8(h[0],h[1],h[2],h[3],h[4],h[5],h[6],h[7]),
-                    uc8(0,   0,   0,   0,   0,   0,   0,   0).real());
+      return bound(8, h);
     }
     /* @} */
     /**
@@ -215,25 +350,31 @@ namespace correlations {
      * Calculate the @f$ n@f$$-paricle correlator using harmonics
      * @f$ h = (h_1,\ldots,h_2)@f$
      *
-     * @param n The number of particles to correlate
-     * @param h Vector of harmonics.  @f$ n@f$ is set to the si
+     * @param q  Q-vector
+     * @param ws Workspace
+     * @param n  The number of particles to correlate
+     * @param h  Vector of harmonics.  @f$ n@f$ is set to the si
      *
      * @return @f$ \langle\exp[i(\sum_j^n h_j\phi_j)]\rangle@f$
      */
-    virtual Complex ucN(const Size n, const HarmonicVector& h) const = 0;
+    virtual Complex ucN(const QVector& q, Workspace& ws,
+			const Size n, const HarmonicVector& h) const = 0;
     /**
      * Generic 1-particle correlation.
      * @f[
      * QC\{1\} = \langle\exp[i(\sum_j^1 h_j\phi_j)]\rangle
      * @f]
      *
+     * @param q  Q-vector
+     * @param ws Workspace
      * @param n1 Harmonics @f$ h_1@f$
      *
      * @return @f$ QC\{1\}@f$
      */
-    virtual Complex uc1(const Harmonic n1) const
+    virtual Complex uc1(const QVector& q, Workspace&,
+                        const Harmonic n1) const
     {
-      return _q(n1, 1);
+      return q(n1, 1);
     }
     /**
      * Generic 2-particle correlation.
@@ -241,16 +382,20 @@ namespace correlations {
      * QC\{2\} = \langle\exp[i(\sum_j^2 h_j\phi_j)]\rangle
      * @f]
      *
+     * @param q  Q-vector
+     * @param ws Workspace
      * @param n1 1st Harmonic
      * @param n2 2nd Harmonic
      *
      * @return the correlator
      */
-    virtual Complex uc2(const Harmonic n1, const Harmonic n2) const
+    virtual Complex uc2(const QVector& q, Workspace& ws,
+                        const Harmonic n1, const Harmonic n2) const
     {
-      HarmonicVector h(2);
+      HarmonicVector& h = ws.args;
+      h.resize(2);
       h[0] = n1; h[1] = n2;
-      return ucN(h.size(), h);
+      return ucN(q, ws, h.size(), h);
     }
     /**
      * Generic 3-particle correlation.
@@ -258,19 +403,23 @@ namespace correlations {
      * QC\{3\} = \langle\exp[i(\sum_j^3 h_j\phi_j)]\rangle
      * @f]
      *
+     * @param q  Q-vector
+     * @param ws Workspace
      * @param n1 1st Harmonic
      * @param n2 2nd Harmonic
      * @param n3 3rd Harmonic
      *
      * @return the correlator
      */
-    virtual Complex uc3(const Harmonic n1,
-                       const Harmonic n2,
-                       const Harmonic n3) const
+    virtual Complex uc3(const QVector& q, Workspace& ws,
+                        const Harmonic n1,
+                        const Harmonic n2,
+                        const Harmonic n3) const
     {
-      HarmonicVector h(3);
+      HarmonicVector& h = ws.args;
+      h.resize(3);
       h[0] = n1; h[1] = n2; h[2] = n3;
-      return ucN(h.size(), h);
+      return ucN(q, ws, h.size(), h);
     }
     /**
      * Generic 4-particle correlation.
@@ -279,6 +428,8 @@ namespace correlations {
      * @f]
      *
      *
+     * @param q  Q-vector
+     * @param ws Workspace
      * @param n1 1st Harmonic
      * @param n2 2nd Harmonic
      * @param n3 3rd Harmonic
@@ -286,14 +437,16 @@ namespace correlations {
      *
      * @return the correlator
      */
-    virtual Complex uc4(const Harmonic n1,
+    virtual Complex uc4(const QVector& q, Workspace& ws,
+                        const Harmonic n1,
                         const Harmonic n2,
-                       const Harmonic n3,
-                       const Harmonic n4) const
+                        const Harmonic n3,
+                        const Harmonic n4) const
     {
-      HarmonicVector h(4);
+      HarmonicVector& h = ws.args;
+      h.resize(4);
       h[0] = n1; h[1] = n2; h[2] = n3; h[3] = n4;
-      return ucN(h.size(), h);
+      return ucN(q, ws, h.size(), h);
     }
     /**
      * Generic 5-particle correlation.
@@ -301,6 +454,8 @@ namespace correlations {
      * QC\{5\} = \langle\exp[i(\sum_j^5 h_j\phi_j)]\rangle
      * @f]
      *
+     * @param q  Q-vector
+     * @param ws Workspace
      * @param n1 1st Harmonic
      * @param n2 2nd Harmonic
      * @param n3 3rd Harmonic
@@ -309,16 +464,18 @@ namespace correlations {
      *
      * @return The correlator
      */
-    virtual Complex uc5(const Harmonic n1,
-                       const Harmonic n2,
-                       const Harmonic n3,
-                       const Harmonic n4,
-                       const Harmonic n5) const
+    virtual Complex uc5(const QVector& q, Workspace& ws,
+                        const Harmonic n1,
+                        const Harmonic n2,
+                        const Harmonic n3,
+                        const Harmonic n4,
+                        const Harmonic n5) const
     {
-      HarmonicVector h(5);
+      HarmonicVector& h = ws.args;
+      h.resize(5);
       h[0] = n1; h[1] = n2; h[2] = n3; h[3] = n4;
       h[4] = n5;
-      return ucN(h.size(), h);
+      return ucN(q, ws, h.size(), h);
     }
     /**
      * Calculate 6-particle correlator
@@ -326,6 +483,8 @@ namespace correlations {
      * C\{6\} = \langle\exp[i(\sum_j^6 h_j\phi_j)]\rangle
      * @f]
      *
+     * @param q  Q-vector
+     * @param ws Workspace
      * @param n1 1st Harmonic
      * @param n2 2nd Harmonic
      * @param n3 3rd Harmonic
@@ -335,17 +494,19 @@ namespace correlations {
      *
      * @return @f$QC\{6\}@f$
      */
-    virtual Complex uc6(const Harmonic n1,
-                       const Harmonic n2,
-                       const Harmonic n3,
-                       const Harmonic n4,
-                       const Harmonic n5,
-                       const Harmonic n6) const
+    virtual Complex uc6(const QVector& q, Workspace& ws,
+                        const Harmonic n1,
+                        const Harmonic n2,
+                        const Harmonic n3,
+                        const Harmonic n4,
+                        const Harmonic n5,
+                        const Harmonic n6) const
     {
-      HarmonicVector h(6);
+      HarmonicVector& h = ws.args;
+      h.resize(6);
       h[0] = n1; h[1] = n2; h[2] = n3; h[3] = n4;
       h[4] = n5; h[5] = n6; // h[6] = n7; h[7] = n8;
-      return ucN(h.size(), h);
+      return ucN(q, ws, h.size(), h);
     }
     /**
      * Calculate 7-particle correlator
@@ -353,6 +514,8 @@ namespace correlations {
      * C\{7\} = \langle\exp[i(\sum_j^7 h_j\phi_j)]\rangle
      * @f]
      *
+     * @param q  Q-vector
+     * @param ws Workspace
      * @param n1 1st Harmonic
      * @param n2 2nd Harmonic
      * @param n3 3rd Harmonic
@@ -363,18 +526,20 @@ namespace correlations {
      *
      * @return @f$QC\{7\}@f$
      */
-    virtual Complex uc7(const Harmonic n1,
-                       const Harmonic n2,
-                       const Harmonic n3,
-                       const Harmonic n4,
-                       const Harmonic n5,
-                       const Harmonic n6,
-                       const Harmonic n7) const
+    virtual Complex uc7(const QVector& q, Workspace& ws,
+                        const Harmonic n1,
+                        const Harmonic n2,
+                        const Harmonic n3,
+                        const Harmonic n4,
+                        const Harmonic n5,
+                        const Harmonic n6,
+                        const Harmonic n7) const
     {
-      HarmonicVector h(7);
+      HarmonicVector& h = ws.args;
+      h.resize(7);
       h[0] = n1; h[1] = n2; h[2] = n3; h[3] = n4;
       h[4] = n5; h[5] = n6; h[6] = n7; // h[7] = n8;
-      return ucN(h.size(), h);
+      return ucN(q, ws, h.size(), h);
     }
     /**
      * Calculate 8-particle correlator
@@ -382,6 +547,8 @@ namespace correlations {
      * C\{8\} = \langle\exp[i(\sum_j^8 h_j\phi_j)]\rangle
      * @f]
      *
+     * @param q  Q-vector
+     * @param ws Workspace
      * @param n1 1st Harmonic
      * @param n2 2nd Harmonic
      * @param n3 3rd Harmonic
@@ -393,22 +560,134 @@ namespace correlations {
      *
      * @return @f$QC\{8\}@f$
      */
-    virtual Complex uc8(const Harmonic n1,
-                       const Harmonic n2,
-                       const Harmonic n3,
-                       const Harmonic n4,
-                       const Harmonic n5,
-                       const Harmonic n6,
-                       const Harmonic n7,
-                       const Harmonic n8) const
+    virtual Complex uc8(const QVector& q, Workspace& ws,
+                        const Harmonic n1,
+                        const Harmonic n2,
+                        const Harmonic n3,
+                        const Harmonic n4,
+                        const Harmonic n5,
+                        const Harmonic n6,
+                        const Harmonic n7,
+                        const Harmonic n8) const
     {
-      HarmonicVector h(8);
+      HarmonicVector& h = ws.args;
+      h.resize(8);
       h[0] = n1; h[1] = n2; h[2] = n3; h[3] = n4;
       h[4] = n5; h[5] = n6; h[6] = n7; h[7] = n8;
-      return ucN(h.size(), h);
+      return ucN(q, ws, h.size(), h);
+    }
+    /* @} */
+    /**
+     * @{
+     * @name Numerators and denominators
+     */
+    /**
+     * Get the @a n particle correlator, using the fixed calculations
+     * for @a n up to our fixed cut, and the generic calculation
+     * above that.  If all harmonics are the same - as for the
+     * denominators - the correlator is instead calculated by
+     * identical, whatever the order.
+     *
+     * @param q  Q-vector
+     * @param ws Workspace
+     * @param n  How many particles to correlate
+     * @param h  Harmonics
+     *
+     * @return @f$ \langle\exp[i(\sum_j^n h_j\phi_j)]\rangle@f$
+     */
+    Complex numerator(const QVector& q, Workspace& ws,
+		      const Size n, const HarmonicVector& h) const
+    {
+      if (n > 0 && std::count(h.begin(), h.begin() + n, h[0]) == n)
+	return identical(q, ws, n, h[0]);
+      if (n > _maxFixed) return ucN(q, ws, n, h);
+
+      switch (n) {
+      case 1: return uc1(q, ws, h[0]);
+      case 2: return uc2(q, ws, h[0], h[1]);
+      case 3: return uc3(q, ws, h[0], h[1], h[2]);
+      case 4: return uc4(q, ws, h[0], h[1], h[2], h[3]);
+      case 5: return uc5(q, ws, h[0], h[1], h[2], h[3], h[4]);
+      case 6: return uc6(q, ws, h[0], h[1], h[2], h[3], h[4], h[5]);
+      case 7: return uc7(q, ws, h[0], h[1], h[2], h[3], h[4], h[5], h[6]);
+      case 8: return uc8(q, ws, h[0], h[1], h[2], h[3], h[4], h[5], h[6],
+			 h[7]);
+      }
+      std::cerr << "Number of correlators too big:" << n << std::endl;
+      return Complex();
+    }
+    /**
+     * Get the @a n particle correlator with all harmonics equal to
+     * @a k.  With @f$ x_j=w_je^{ik\phi_j}@f$ this is @f$ n!@f$ times
+     * the elementary symmetric polynomial @f$ e_n(x)@f$, which
+     * follows from the power sums @f$ p_i=\sum_j x_j^i=Q_{ik,i}@f$
+     * by the Newton identities
+     *
+     * @f[
+     *   c_j = j!\,e_j = \sum_{i=1}^{j} (-1)^{i-1}
+     *   \frac{(j-1)!}{(j-i)!}\, p_i\, c_{j-i}
+     * @f]
+     *
+     * with @f$ c_0=1@f$.  That takes @f$ n(n+1)/2@f$ multiplications,
+     * so even very high orders, or the denominators, are cheap.
+     *
+     * @param q  Q-vector
+     * @param ws Workspace
+     * @param n  How many particles to correlate
+     * @param k  Harmonic
+     *
+     * @return @f$ \langle\exp[ik(\sum_j^n\phi_j)]\rangle@f$
+     */
+    Complex identical(const QVector& q, Workspace& ws,
+		      const Size n, const Harmonic k) const
+    {
+      if (ws.z.size() < 2 * size_t(n) + 1) ws.z.resize(2 * size_t(n) + 1);
+      PlainComplex* c = &(ws.z[0]);
+      PlainComplex* p = c + n + 1;
+      c[0] = PlainComplex(1, 0);
+      for (Size i = 1; i <= n; i++) p[i-1] = q(i * k, i);
+      for (Size j = 1; j <= n; j++) {
+	PlainComplex r;
+	Real         a = 1;
+	for (Size i = 1; i <= j; i++) {
+	  r.mac(a, p[i-1], c[j-i]);
+	  a *= -Real(j - i);
+	}
+	c[j] = r;
+      }
+      return c[n].complex();
+    }
+    /**
+     * Get the @a n particle correlator with all harmonics zero,
+     * i.e., the sum of weights.  It only depends on the
+     * @f$Q@f$-vector, so it is calculated once per event and then
+     * cached in the workspace.
+     *
+     * @param q  Q-vector
+     * @param ws Workspace
+     * @param n  How many particles to correlate
+     *
+     * @return The real part of the @a n particle correlator with all
+     * zero harmonics.
+     */
+    Real denominator(const QVector& q, Workspace& ws, const Size n) const
+    {
+      if (n >= ws.den.size()) {
+	ws.den.resize(n+1);
+	ws.denOk.resize(n+1, false);
+      }
+      if (ws.denOk[n]) return ws.den[n];
+
+      if (ws.null.size() < n) ws.null.resize(n, 0);
+      ws.den[n]   = numerator(q, ws, n, ws.null).real();
+      ws.denOk[n] = true;
+      return ws.den[n];
     }
     /* @} */
-    QVector& _q;
+    /** The Q-vector we're bound to, if any */
+    const QVector* _q;
+    /** Workspace used for the bound Q-vector */
+    mutable Workspace _ws;
   };
 }
 #endif
@@ -0,0 +1,200 @@
+#ifndef CORRELATIONS_INCREMENTAL_HH
+#define CORRELATIONS_INCREMENTAL_HH
+/**
+ * @file   correlations/Incremental.hh
+ * @date   Sat Oct 17 07:09:52 2026
+ *
+ * @brief  Correlator updated as observations come in
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <correlations/Correlator.hh>
+#include <correlations/PlainComplex.hh>
+#include <algorithm>
+#include <cmath>
+
+namespace correlations {
+  //____________________________________________________________________
+  /**
+   * Structure to calculate the correlator of a fixed harmonic vector
+   * while the observations of an event come in, e.g., in an online
+   * trigger.
+   *
+   * For a harmonic vector @f$ h=(h_1,\ldots,h_m)@f$ the partial sums
+   *
+   * @f[
+   *   S(T) = \sum_{\mathrm{distinct}\ k_j} \prod_{j\in T}
+   *   w_{k_j}e^{ih_j\phi_{k_j}}
+   * @f]
+   *
+   * over tuples of distinct observations in the harmonic slots
+   * @f$ T\subseteq\{1,\ldots,m\}@f$ are kept.  An observation can
+   * take at most one of the slots, so adding one, with @f$
+   * x_j=we^{ih_j\phi}@f$, updates the sums as
+   *
+   * @f[
+   *   S(T) \leftarrow S(T) + \sum_{j\in T} x_j\,S(T\setminus\{j\})
+   * @f]
+   *
+   * which takes @f$ m2^{m-1}@f$ multiplications.  The sum of
+   * weights is updated the same way, but only depends on the number
+   * of slots.  The @f$ n@f$-particle correlator of the first @f$
+   * n@f$ harmonics is then just @f$ S(\{1,\ldots,n\})@f$, so reading
+   * it takes no time at all.  The result is the same as that of
+   * correlations::NestedLoops (up to rounding).
+   *
+   @code
+   correlations::HarmonicVector h(8);
+   correlations::Incremental    c(h);
+   while (moreEvents) {
+     c.reset();
+     while (moreObservations) {
+       c.fill(phi, weight);
+       if (trigger) r = c.calculate(h);
+     }
+   }
+   @endcode
+   *
+   * Only the harmonics given to the constructor - or the first
+   * @f$ n@f$ of them - can be correlated.
+   *
+   * @headerfile ""  <correlations/Incremental.hh>
+   */
+  struct Incremental : public Correlator
+  {
+    /**
+     * Constructor
+     *
+     * @param h          Harmonics
+     * @param useWeights Whether to use weights or not
+     */
+    Incremental(const HarmonicVector& h, bool useWeights=true)
+      : Correlator(0),
+	_h(h),
+	_useWeights(useWeights),
+	_s(size_t(1) << h.size()),
+	_d(h.size() + 1),
+	_x(h.size())
+    {
+      reset();
+    }
+    /**
+     * Forget all observations, e.g., at the start of an event
+     */
+    void reset()
+    {
+      std::fill(_s.begin(), _s.end(), PlainComplex());
+      std::fill(_d.begin(), _d.end(), 0);
+      _s[0] = PlainComplex(1, 0);
+      _d[0] = 1;
+    }
+    /**
+     * Add an observation
+     *
+     * @param phi    Angle
+     * @param weight Weight
+     */
+    void fill(const Real phi, const Real weight=1)
+    {
+      const Size m = _h.size();
+      const Real w = _useWeights ? weight : 1;
+      for (Size j = 0; j < m; j++)
+	_x[j] = PlainComplex(w * std::cos(_h[j] * phi),
+			     w * std::sin(_h[j] * phi));
+
+      // Larger sets first, so that the sums of the subsets are those
+      // before this observation
+      for (size_t t = _s.size() - 1; t > 0; t--) {
+	PlainComplex r;
+	for (Size j = 0; j < m; j++) {
+	  const size_t b = size_t(1) << j;
+	  if (t & b) r.mac(_x[j], _s[t ^ b]);
+	}
+	_s[t] += r;
+      }
+      for (Size k = m; k > 0; k--) _d[k] += k * w * _d[k-1];
+    }
+    /**
+     * Add observations
+     *
+     * @param phis    Angles
+     * @param weights Array of @a n weights.  If null, all weights
+     *                are taken to be 1.
+     * @param n       Number of observations
+     */
+    void fill(const Real* phis, const Real* weights, size_t n)
+    {
+      for (size_t i = 0; i < n; i++)
+	fill(phis[i], weights ? weights[i] : 1);
+    }
+    /**
+     * @return Name of the correlator
+     */
+    virtual const char* name() const { return "Incremental subsets"; }
+  protected:
+    /**
+     * Get the @a n particle correlation.  The harmonics @a h must be
+     * the first @a n of those given to the constructor.
+     *
+     * @param n How many particles to correlate
+     * @param h Harmonic of each term
+     *
+     * @return The correlator and the summed weights
+     */
+    virtual Result cN(const Size n, const HarmonicVector& h) const
+    {
+      if (n > _h.size() || !std::equal(h.begin(), h.begin() + n,
+				       _h.begin())) {
+	std::cerr << "Harmonics not among those of the incremental "
+		  << "correlator" << std::endl;
+	return Result();
+      }
+      return Result(_s[(size_t(1) << n) - 1].complex(), _d[n]);
+    }
+    /** @param h Harmonics  @return @f$ C\{1\}@f$ */
+    virtual Result c1(const HarmonicVector& h) const { return cN(1, h); }
+    /** @param h Harmonics  @return @f$ C\{2\}@f$ */
+    virtual Result c2(const HarmonicVector& h) const { return cN(2, h); }
+    /** @param h Harmonics  @return @f$ C\{3\}@f$ */
+    virtual Result c3(const HarmonicVector& h) const { return cN(3, h); }
+    /** @param h Harmonics  @return @f$ C\{4\}@f$ */
+    virtual Result c4(const HarmonicVector& h) const { return cN(4, h); }
+    /** @param h Harmonics  @return @f$ C\{5\}@f$ */
+    virtual Result c5(const HarmonicVector& h) const { return cN(5, h); }
+    /** @param h Harmonics  @return @f$ C\{6\}@f$ */
+    virtual Result c6(const HarmonicVector& h) const { return cN(6, h); }
+    /** @param h Harmonics  @return @f$ C\{7\}@f$ */
+    virtual Result c7(const HarmonicVector& h) const { return cN(7, h); }
+    /** @param h Harmonics  @return @f$ C\{8\}@f$ */
+    virtual Result c8(const HarmonicVector& h) const { return cN(8, h); }
+    /** Harmonics */
+    HarmonicVector _h;
+    /** Whether to use weights */
+    bool           _useWeights;
+    /** Sums over distinct observations for each subset of slots */
+    PlainVector    _s;
+    /** Sums of weights for each number of slots */
+    RealVector     _d;
+    /** Work buffer of the current observation's terms */
+    PlainVector    _x;
+  };
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
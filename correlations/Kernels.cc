@@ -0,0 +1,35 @@
+/**
+ * @file   correlations/Kernels.cc
+ * @date   Sat Oct 17 07:35:16 2026
+ *
+ * @brief  Out-of-line kernels of the library libcorrelations
+ *
+ * Build with
+ * <pre class="shell">
+ * make lib
+ * </pre>
+ * and see correlations/Kernels.hh on how to use the library.
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#undef  CORRELATIONS_LIBRARY
+#define CORRELATIONS_KERNEL
+#include <correlations/Kernels.hh>
+//
+// EOF
+//
@@ -0,0 +1,71 @@
+#ifndef CORRELATIONS_KERNELS_HH
+#define CORRELATIONS_KERNELS_HH
+/**
+ * @file   correlations/Kernels.hh
+ * @date   Sat Oct 17 07:35:16 2026
+ *
+ * @brief  Kernels of the closed-form and recurrence correlators
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <correlations/QVector.hh>
+#include <correlations/Workspace.hh>
+
+/**
+ * @file correlations/Kernels.hh
+ *
+ * The code is header-only by default, and the kernels are then
+ * compiled, inline, into each translation unit that uses
+ * correlations::closed::FromQVector or
+ * correlations::recurrence::FromQVector.  If @c CORRELATIONS_LIBRARY
+ * is defined, only the declarations below are seen, and the kernels
+ * are taken from the compiled library @c libcorrelations instead
+ *
+ * <pre class="shell">
+ * make lib
+ * g++ -DCORRELATIONS_LIBRARY -I. -c prog.cc
+ * g++ prog.o -L. -lcorrelations -o prog
+ * </pre>
+ *
+ * All translation units of a program must agree on whether @c
+ * CORRELATIONS_LIBRARY is defined.  The largest closed-form
+ * correlator is then that of the library (see @c
+ * CORRELATIONS_CLOSED_MAX).
+ */
+#ifdef CORRELATIONS_LIBRARY
+namespace correlations {
+  namespace closed {
+    Complex expand(const QVector& q, Size n, const Harmonic* h);
+  }
+  namespace recurrence {
+    Complex expand(const QVector& q, Workspace& ws, Size n,
+		   const Harmonic* h);
+  }
+}
+#else
+# ifndef CORRELATIONS_KERNEL
+/** Linkage of the kernels - inline unless building the library */
+#  define CORRELATIONS_KERNEL inline
+# endif
+# include <correlations/closed/Kernel.hh>
+# include <correlations/recurrence/Kernel.hh>
+#endif
+#endif
+// Local Variables:
+//  mode: C++
+// End:
@@ -0,0 +1,162 @@
+#ifndef CORRELATIONS_PLAINCOMPLEX_HH
+#define CORRELATIONS_PLAINCOMPLEX_HH
+/**
+ * @file   correlations/PlainComplex.hh
+ * @date   Sat Oct 17 08:42:46 2026
+ *
+ * @brief  Complex numbers with plain arithmetic for the kernels
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <correlations/Types.hh>
+
+namespace correlations {
+  //____________________________________________________________________
+  /**
+   * A complex number with plain arithmetic, used inside the kernels
+   * of the correlators.  Results are handed out as
+   * correlations::Complex.
+   *
+   * Multiplying two @c std::complex<double> in ISO C++ mode (without
+   * @c -ffast-math or @c -fcx-limited-range) follows Annex G of C99:
+   * if the textbook formula gives NaN, the product is recalculated
+   * by a call to @c __muldc3 so that infinities come out right.  The
+   * check is made for every product, and stops the compiler from
+   * scheduling or vectorising long chains of products.  Here
+   *
+   * @f[
+   *   (a+ib)(c+id) = (ac-bd) + i(ad+bc)
+   * @f]
+   *
+   * is used as is.  For the finite values of @f$ Q@f$-vectors this
+   * is the same as @c std::complex.  Infinite or NaN input is @e not
+   * treated specially - e.g., @f$ (\infty+i0)(0+i)@f$ gives NaN
+   * parts rather than an infinity - and so NaN propagates as in any
+   * other real arithmetic.
+   *
+   * The compiler is free to fuse the products and sums into
+   * multiply-add instructions if the target has those, and @c
+   * -ffp-contract=fast is given (the default of GCC outside of ISO
+   * mode, and given by @c NATIVE=1).  A fused
+   * operation rounds once rather than twice, so results may then
+   * differ in the last bit.  This is left to the compiler rather
+   * than forced by @c fma, as it can then pick which products to
+   * fuse to keep the chains of dependent operations short.
+   *
+   * @headerfile ""  <correlations/PlainComplex.hh>
+   */
+  struct PlainComplex
+  {
+    /**
+     * Constructor
+     *
+     * @param r Real part
+     * @param i Imaginary part
+     */
+    PlainComplex(Real r=0, Real i=0) : re(r), im(i) {}
+    /**
+     * Constructor
+     *
+     * @param z Complex number
+     */
+    PlainComplex(const Complex& z) : re(z.real()), im(z.imag()) {}
+    /** @return As correlations::Complex */
+    Complex complex() const { return Complex(re, im); }
+    /** @param z Number to add  @return This */
+    PlainComplex& operator+=(const PlainComplex& z)
+    {
+      re += z.re;
+      im += z.im;
+      return *this;
+    }
+    /** @param z Number to subtract  @return This */
+    PlainComplex& operator-=(const PlainComplex& z)
+    {
+      re -= z.re;
+      im -= z.im;
+      return *this;
+    }
+    /** @param z Number to multiply by  @return This */
+    PlainComplex& operator*=(const PlainComplex& z)
+    {
+      const Real r = re * z.re - im * z.im;
+      im           = re * z.im + im * z.re;
+      re           = r;
+      return *this;
+    }
+    /**
+     * Add @f$ ab@f$ to this
+     *
+     * @param a Factor
+     * @param b Factor
+     *
+     * @return This
+     */
+    PlainComplex& mac(const PlainComplex& a, const PlainComplex& b)
+    {
+      re += a.re * b.re - a.im * b.im;
+      im += a.re * b.im + a.im * b.re;
+      return *this;
+    }
+    /**
+     * Add @f$ fab@f$ to this
+     *
+     * @param f Real factor
+     * @param a Factor
+     * @param b Factor
+     *
+     * @return This
+     */
+    PlainComplex& mac(const Real f, const PlainComplex& a,
+		      const PlainComplex& b)
+    {
+      return mac(PlainComplex(f * a.re, f * a.im), b);
+    }
+    /** Real part */
+    Real re;
+    /** Imaginary part */
+    Real im;
+  };
+  /** Type of vector of complex numbers with plain arithmetic */
+  typedef std::vector<PlainComplex> PlainVector;
+
+  /** @return @f$ a+b@f$ */
+  inline PlainComplex operator+(PlainComplex a, const PlainComplex& b)
+  {
+    return a += b;
+  }
+  /** @return @f$ a-b@f$ */
+  inline PlainComplex operator-(PlainComplex a, const PlainComplex& b)
+  {
+    return a -= b;
+  }
+  /** @return @f$ ab@f$ */
+  inline PlainComplex operator*(PlainComplex a, const PlainComplex& b)
+  {
+    return a *= b;
+  }
+  /** @return @f$ fa@f$ */
+  inline PlainComplex operator*(const Real f, const PlainComplex& a)
+  {
+    return PlainComplex(f * a.re, f * a.im);
+  }
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
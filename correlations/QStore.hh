@@ -0,0 +1,414 @@
+#ifndef CORRELATIONS_QSTORE_HH
+#define CORRELATIONS_QSTORE_HH
+/**
+ * @file   correlations/QStore.hh
+ * @date   Sat Oct 17 06:42:58 2026
+ *
+ * @brief  Binary store of per-event Q-vectors
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <correlations/Types.hh>
+#include <correlations/QVector.hh>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#if defined(__unix__) || defined(__unix) || defined(unix) \
+  || defined(__APPLE__)
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+# define CORRELATIONS_QSTORE_MMAP
+#endif
+
+namespace correlations {
+  //____________________________________________________________________
+  /**
+   * Header of a @f$ Q@f$-vector store file.
+   *
+   * A store file consists of this 64 byte header followed by one
+   * record per event.  Each record is the sum of weights of the
+   * event followed by the internal storage of a correlations::QVector
+   * with the maximum harmonic and power given in the header, and in
+   * half storage mode (correlations::QVector::kHalf).  All records
+   * have the same size, so the file can be memory mapped and events
+   * accessed at random.  Numbers are stored in the native byte order.
+   *
+   * @headerfile "" <correlations/QStore.hh>
+   */
+  struct QStoreHeader
+  {
+    /** Magic string - always "CORRQST" */
+    char         magic[8];
+    /** Format version */
+    unsigned int version;
+    /** Size of correlations::Real in bytes */
+    unsigned int realSize;
+    /** Maximum harmonic stored */
+    unsigned int maxN;
+    /** Maximum power stored */
+    unsigned int maxP;
+    /** Non-zero if weights were used */
+    unsigned int useWeights;
+    /** Number of correlations::Real per event */
+    unsigned int recordSize;
+    /** Number of events */
+    unsigned int nEvents;
+    /** Padding to 64 bytes */
+    unsigned int pad[7];
+  };
+  /** Make sure the header has the advertised size */
+  typedef char QStoreHeaderSizeCheck[sizeof(QStoreHeader) == 64 ? 1 : -1];
+
+  //____________________________________________________________________
+  /**
+   * Write @f$ Q@f$-vectors of events to a store file (see
+   * correlations::QStoreHeader).
+   *
+   @code
+   correlations::QStoreWriter w("data.qst", 24, 8);
+   while (moreEvents) {
+     ...
+     w.event(phis, weights, n);
+   }
+   w.close();
+   @endcode
+   *
+   * @headerfile "" <correlations/QStore.hh>
+   */
+  struct QStoreWriter
+  {
+    /**
+     * Constructor
+     *
+     * @param filename   File to write to
+     * @param maxN       Maximum harmonic to store
+     * @param maxP       Maximum power to store
+     * @param useWeights Whether to use weights
+     */
+    QStoreWriter(const std::string& filename, Size maxN, Size maxP,
+		 bool useWeights=true)
+      : _out(filename.c_str(),
+	     std::ios::out | std::ios::binary | std::ios::trunc),
+	_q(maxN, maxP, useWeights, QVector::kHalf),
+	_header()
+    {
+      if (!_out) {
+	std::cerr << "Failed to open Q-vector store " << filename
+		  << " for writing" << std::endl;
+	return;
+      }
+      std::strncpy(_header.magic, "CORRQST", sizeof(_header.magic));
+      _header.version    = 1;
+      _header.realSize   = sizeof(Real);
+      _header.maxN       = maxN;
+      _header.maxP       = maxP;
+      _header.useWeights = useWeights;
+      _header.recordSize = 1 + _q.dataSize();
+      _header.nEvents    = 0;
+      _out.write(reinterpret_cast<const char*>(&_header), sizeof(_header));
+    }
+    /**
+     * Destructor.  Closes the file
+     */
+    ~QStoreWriter() { close(); }
+    /**
+     * @return true if the file is open for writing
+     */
+    bool isOpen() const { return _out.is_open() && _out.good(); }
+    /**
+     * Store an event from its observations
+     *
+     * @param phis    Array of @a n @f$\phi@f$ observations
+     * @param weights Array of @a n weights or null
+     * @param n       Number of observations
+     */
+    void event(const Real* phis, const Real* weights, size_t n)
+    {
+      _q.reset();
+      _q.fill(phis, weights, n);
+      write();
+    }
+    /**
+     * Store an event from its @f$ Q@f$-vector.  Components of the
+     * store not in @a q are stored as zero.
+     *
+     * @param q @f$ Q@f$-vector of the event
+     */
+    void event(const QVector& q)
+    {
+      _q.reset();
+      _q += q;
+      write();
+    }
+    /**
+     * Write the final header and close the file.
+     */
+    void close()
+    {
+      if (!_out.is_open()) return;
+      _out.seekp(0);
+      _out.write(reinterpret_cast<const char*>(&_header), sizeof(_header));
+      _out.close();
+    }
+    /**
+     * @return Number of events written so far
+     */
+    size_t nEvents() const { return _header.nEvents; }
+  protected:
+    QStoreWriter(const QStoreWriter&);
+    QStoreWriter& operator=(const QStoreWriter&);
+    /**
+     * Write the current event
+     */
+    void write()
+    {
+      if (!isOpen()) return;
+      const Real sumW = _q(0, 1).real();
+      _out.write(reinterpret_cast<const char*>(&sumW), sizeof(Real));
+      _out.write(reinterpret_cast<const char*>(_q.data()),
+		 _q.dataSize() * sizeof(Real));
+      _header.nEvents++;
+    }
+    /** Output file */
+    std::ofstream _out;
+    /** Q-vector in store layout */
+    QVector _q;
+    /** File header */
+    QStoreHeader _header;
+  };
+
+  //____________________________________________________________________
+  /**
+   * Read @f$ Q@f$-vectors of events from a store file (see
+   * correlations::QStoreHeader).  Where possible, the file is memory
+   * mapped.
+   *
+   * Any correlator that uses a @f$ Q@f$-vector can run directly on
+   * the @f$ Q@f$-vector of the reader, as long as the harmonics fit
+   * within the stored maximum harmonic and power (see fits).
+   *
+   @code
+   correlations::QStoreReader         r("data.qst");
+   correlations::closed::FromQVector  c(r.q());
+   correlations::Result               res;
+   if (!r.fits(h, h.size())) return;
+   while (r.event()) res += c.calculate(h);
+   @endcode
+   *
+   * @headerfile "" <correlations/QStore.hh>
+   */
+  struct QStoreReader
+  {
+    /**
+     * Constructor
+     *
+     * @param filename File to read from
+     */
+    QStoreReader(const std::string& filename)
+      : _header(),
+	_q(0, 0, true, QVector::kHalf),
+	_base(0),
+	_size(0),
+	_in(),
+	_buf(0),
+	_current(0),
+	_nEvents(0),
+	_sumW(0)
+    {
+      open(filename);
+    }
+    /**
+     * Destructor.  Unmaps or closes the file
+     */
+    ~QStoreReader()
+    {
+#ifdef CORRELATIONS_QSTORE_MMAP
+      if (_base) munmap(const_cast<char*>(_base), _size);
+#endif
+    }
+    /**
+     * @return true if the store was opened successfully
+     */
+    bool isOpen() const { return _header.recordSize > 0; }
+    /**
+     * @return Number of events in the store
+     */
+    size_t nEvents() const { return _nEvents; }
+    /**
+     * @return Maximum harmonic stored
+     */
+    Size maxN() const { return _header.maxN; }
+    /**
+     * @return Maximum power stored
+     */
+    Size maxP() const { return _header.maxP; }
+    /**
+     * @return true if weights were used
+     */
+    bool useWeights() const { return _header.useWeights; }
+    /**
+     * Check if the @a n first harmonics in @a h can be correlated
+     * with the stored @f$ Q@f$-vectors.  The largest harmonic needed
+     * is the largest absolute sum of a subset of the harmonics, and
+     * the largest power is the number of harmonics.
+     *
+     * @param h Harmonics
+     * @param n Number of harmonics to correlate
+     *
+     * @return true if all needed components are stored
+     */
+    bool fits(const HarmonicVector& h, Size n) const
+    {
+      int sp = 0, sn = 0;
+      for (Size i = 0; i < n && i < h.size(); i++) {
+	if (h[i] > 0) sp += h[i];
+	else          sn -= h[i];
+      }
+      return (std::max(sp, sn) <= int(_header.maxN) &&
+	      (!_header.useWeights || n <= _header.maxP));
+    }
+    /**
+     * @return The @f$ Q@f$-vector of the current event.  Correlators
+     * should be constructed on this.
+     */
+    QVector& q() { return _q; }
+    /**
+     * @return The sum of weights of the current event
+     */
+    Real sumW() const { return _sumW; }
+    /**
+     * Load the next event into q()
+     *
+     * @return false if there are no more events
+     */
+    bool event() { return event(_current); }
+    /**
+     * Load an event into q()
+     *
+     * @param i Event number (zero-based)
+     *
+     * @return false if @a i is out of range or the event could not be
+     * read
+     */
+    bool event(size_t i)
+    {
+      if (i >= _nEvents) return false;
+      const size_t rec  = _header.recordSize * sizeof(Real);
+      const char*  data = _base;
+      if (!data) {
+	_in.seekg(sizeof(QStoreHeader) + i * rec);
+	_in.read(&(_buf[0]), rec);
+	if (!_in) return false;
+	data = &(_buf[0]);
+      }
+      else
+	data += sizeof(QStoreHeader) + i * rec;
+      std::memcpy(&_sumW, data, sizeof(Real));
+      std::memcpy(_q.data(), data + sizeof(Real), rec - sizeof(Real));
+      _current = i + 1;
+      return true;
+    }
+    /**
+     * Go back to the first event
+     */
+    void rewind() { _current = 0; }
+  protected:
+    QStoreReader(const QStoreReader&);
+    QStoreReader& operator=(const QStoreReader&);
+    /**
+     * Open the file, check the header, and map the file
+     *
+     * @param filename File to open
+     */
+    void open(const std::string& filename)
+    {
+      _in.open(filename.c_str(), std::ios::in | std::ios::binary);
+      if (!_in) {
+	std::cerr << "Failed to open Q-vector store " << filename
+		  << std::endl;
+	return;
+      }
+      _in.read(reinterpret_cast<char*>(&_header), sizeof(_header));
+      _in.seekg(0, std::ios::end);
+      _size = _in.tellg();
+      if (!_in
+	  || std::strncmp(_header.magic, "CORRQST", sizeof(_header.magic))
+	  || _header.version != 1
+	  || _header.realSize != sizeof(Real)) {
+	std::cerr << filename << " is not a compatible Q-vector store"
+		  << std::endl;
+	_header.recordSize = 0;
+	return;
+      }
+      _q = QVector(_header.maxN, _header.maxP, _header.useWeights,
+		   QVector::kHalf);
+      if (_header.recordSize != 1 + _q.dataSize()) {
+	std::cerr << filename << " has unexpected record size "
+		  << _header.recordSize << std::endl;
+	_header.recordSize = 0;
+	return;
+      }
+      // If the writer did not close the file, the number of events
+      // in the header is 0, so we count the complete records.
+      const size_t rec = _header.recordSize * sizeof(Real);
+      const size_t nRec = (_size - sizeof(QStoreHeader)) / rec;
+      _nEvents = (_header.nEvents > 0 && _header.nEvents <= nRec
+		  ? _header.nEvents : nRec);
+#ifdef CORRELATIONS_QSTORE_MMAP
+      int fd = ::open(filename.c_str(), O_RDONLY);
+      if (fd >= 0) {
+	void* m = mmap(0, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (m != MAP_FAILED) {
+	  _base = static_cast<const char*>(m);
+	  _in.close();
+	  return;
+	}
+      }
+#endif
+      // Fall back to reading the records
+      _in.clear();
+      _buf.resize(rec);
+    }
+    /** File header */
+    QStoreHeader _header;
+    /** Q-vector of current event */
+    QVector _q;
+    /** Mapped file, or null */
+    const char* _base;
+    /** Size of file */
+    size_t _size;
+    /** Input stream if not mapped */
+    std::ifstream _in;
+    /** Record buffer if not mapped */
+    std::vector<char> _buf;
+    /** Next event */
+    size_t _current;
+    /** Number of events */
+    size_t _nEvents;
+    /** Sum of weights of current event */
+    Real _sumW;
+  };
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
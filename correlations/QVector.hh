@@ -25,6 +25,8 @@
  * along with this program.  If not, see http://www.gnu.org/licenses.
  */
 #include <correlations/Types.hh>
+#include <correlations/Simd.hh>
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
@@ -36,12 +38,52 @@ namespace correlations {
    * It provides member functions for reseting, filling and accessing
    * the individual @f$Q@f$ vector components.
    *
+   * Since @f$Q_{-n,p} = Q_{n,p}^*@f$, the negative harmonics are
+   * redundant.  By default both signs are stored (QVector::kFull),
+   * but with QVector::kHalf only @f$ n\ge0@f$ is stored and
+   * negative harmonics are returned as the conjugate.  This halves
+   * the memory and the work done by fill and reset.
+   *
+   * The correlators only ever read @f$Q_{\sum_{j\in S}h_j,|S|}@f$ for
+   * subsets @f$ S@f$ of the harmonic vector @f$ h@f$ (and
+   * @f$Q_{0,p}@f$ for the weights).  With QVector::kSparse, resizing
+   * to a harmonic vector (see resize(const HarmonicVector&)) records
+   * exactly those components, and fill only updates them.  All other
+   * components read as zero.
+   *
+   * If weights are not used, @f$ Q_{n,p}@f$ is the same for all
+   * powers @f$ p@f$.  Only one power plane is then stored and
+   * filled, and it is returned for any @f$ p@f$.
+   *
+   * By default the components are stored as complex numbers, with
+   * all powers of a harmonic next to each other.  With
+   * QVector::kSoA the real and imaginary parts are stored in two
+   * separate arrays, and with QVector::kPowerMajor all harmonics of
+   * a power are stored next to each other.  Which is faster depends
+   * on the access pattern of the correlator, but the default is
+   * typically the fastest for the closed forms - see the program @c
+   * bench.
+   *
+   * Since @f$ Q@f$-vectors are sums over observations, they can be
+   * added and subtracted.  This allows filling parts of an event
+   * independently (e.g., on separate threads, see
+   * fill(const Real*,const Real*,size_t,unsigned int)), and to form
+   * the @f$ Q@f$-vector of all but a sub-event without refilling.
+   *
    @code
    correlations::QVector q(3,2);
    
    // Fill vector
    q.reset();
    for (Int_t i = 0; i < nPhi; i++) q.fill(phi[i], weight[i])
+
+   // or, faster, fill all observations of the event in one go
+   q.reset();
+   q.fill(phi, weight, nPhi);
+
+   // Q-vector of all observations but those in the sub-event
+   correlations::QVector r(q);
+   r -= sub;
    
    // Show components
    for (short n=-2, n <= 2; n++)
@@ -52,6 +94,21 @@ namespace correlations {
    */
   struct QVector
   {
+    /**
+     * Storage modes
+     */
+    enum EStorage {
+      /** Store both positive and negative harmonics */
+      kFull = 0x0,
+      /** Store only non-negative harmonics */
+      kHalf = 0x1,
+      /** Only fill components needed by the harmonic vector */
+      kSparse = 0x2,
+      /** Store real and imaginary parts in separate arrays */
+      kSoA = 0x4,
+      /** Store all harmonics of a power next to each other */
+      kPowerMajor = 0x8
+    };
     /**
      * Constructor - creates a QVector with the specified maximum
      * harmonic order and maximum power of the harmonics
@@ -59,10 +116,15 @@ namespace correlations {
      * @param mN         Maximum harmonic order
      * @param mP         Maximum power
      * @param useWeights Whether to use weights or not
+     * @param storage    Storage mode (see QVector::EStorage)
      *
      */
-    QVector(Size mN, Size mP, bool useWeights)
-      : _maxN(mN), _maxP(mP), _useWeights(useWeights), _q(0)
+    QVector(Size mN, Size mP, bool useWeights, unsigned int storage=kFull)
+      : _maxN(mN), _maxP(mP), _useWeights(useWeights),
+	_half(storage & kHalf), _sparse(storage & kSparse),
+	_soa(storage & kSoA), _powerMajor(storage & kPowerMajor),
+	_offN(0), _nP(0), _nStride(0), _pStride(0), _imOff(0),
+	_d(0), _comps(0), _fillN(0), _work(0), _gen()
     {
       resize(mN, mP);
     }
@@ -71,26 +133,30 @@ namespace correlations {
      * 
      * @param h Harmonics vector
      * @param useWeights Whether to use weights
+     * @param storage    Storage mode (see QVector::EStorage)
      */
-    QVector(const HarmonicVector& h, bool useWeights) 
-      : _maxN(0), _maxP(0), _useWeights(useWeights), _q(0)
+    QVector(const HarmonicVector& h, bool useWeights,
+	    unsigned int storage=kFull)
+      : _maxN(0), _maxP(0), _useWeights(useWeights),
+	_half(storage & kHalf), _sparse(storage & kSparse),
+	_soa(storage & kSoA), _powerMajor(storage & kPowerMajor),
+	_offN(0), _nP(0), _nStride(0), _pStride(0), _imOff(0),
+	_d(0), _comps(0), _fillN(0), _work(0), _gen()
     {
       resize(h);
     }
     /**
-     * Resize the QVector - note this clears all content
+     * Resize the QVector - note this clears all content.  All
+     * components are filled.
      *
      * @param mN New maximum harmonic
      * @param mP New maximum power
      */
     void resize(Size mN, Size mP)
     {
-      _maxN = mN;
-      _maxP = mP;
-      // We store both the positive and the negative harmonics for
-      // efficiency reasons. So we need to index from -fMaxN-1 to fMaxN,
-      // which gives us a total of 2*fMaxN+1 places for N.
-      _q.resize((2*_maxN+1)*(_maxP+1));
+      setup(mN, mP);
+      for (Harmonic n = 0; n <= _maxN; n++)
+	for (Power p = 0; p <= _maxP; p++) addComponent(n, p);
     }
     /**
      * Resize the Q-vector to accommodate the harmonics specified in
@@ -98,16 +164,43 @@ namespace correlations {
      * the input vector, and maximum harmonic is set the the sum of
      * the absolute value of each element in the vector.
      *
+     * In sparse mode (QVector::kSparse), only the components
+     * @f$Q_{\sum_{j\in S}h_j,|S|}@f$ for the subsets @f$ S@f$ of @a h,
+     * and @f$ Q_{0,p}@f$ for @f$ p=1,\ldots,|h|@f$, are filled.
+     * This is enough to calculate any correlator of (a subset of)
+     * the harmonics in @a h.
+     *
      * @param h Harmonic vector to resize to
      */
     void resize(const HarmonicVector& h)
     {
-      _maxP = h.size();
-      _maxN = 0;
+      Size mN = 0;
       for (HarmonicVector::const_iterator i = h.begin(); i != h.end(); ++i)
 	// Older GCC does not have overload for integer types
-	_maxN += short(std::abs(float(*i)));
-      resize(_maxN, _maxP);
+	mN += short(std::abs(float(*i)));
+      if (!_sparse) {
+	resize(mN, h.size());
+	return;
+      }
+      setup(mN, h.size());
+
+      // Find the reachable (sum,count) pairs by adding one harmonic
+      // at a time.  reach[c*nn+s+mN] is true if some subset of c
+      // harmonics sums to s.
+      const size_t      nn = 2 * mN + 1;
+      std::vector<bool> reach((_maxP + 1) * nn, false);
+      reach[mN] = true;
+      for (size_t i = 0; i < h.size(); i++)
+	for (size_t c = i + 1; c > 0; c--)
+	  for (size_t s = 0; s < nn; s++) {
+	    if (!reach[(c - 1) * nn + s]) continue;
+	    reach[c * nn + size_t(int(s) + h[i])] = true;
+	  }
+      for (Harmonic n = 0; n <= _maxN; n++)
+	for (Power p = 1; p <= _maxP; p++)
+	  if (n == 0
+	      || reach[p * nn + mN + n]
+	      || reach[p * nn + mN - n]) addComponent(n, p);
     }
     /**
      * Reset all @f$Q@f$ vector component to @f$0+i0@f$
@@ -115,7 +208,16 @@ namespace correlations {
      */
     void reset(const Complex& q=Complex(0,0))
     {
-      std::fill(_q.begin(), _q.end(), q);
+      _gen.bump();
+      if (_soa) {
+	std::fill(_d.begin(), _d.begin() + _imOff, q.real());
+	std::fill(_d.begin() + _imOff, _d.end(), q.imag());
+	return;
+      }
+      for (size_t i = 0; i < _d.size(); i += 2) {
+	_d[i]   = q.real();
+	_d[i+1] = q.imag();
+      }
     }
     /**
      * @brief Get @f$Q_{n,p}@f$
@@ -128,48 +230,344 @@ namespace correlations {
      *
      * @return @f$ Q_{n,p}@f$ or @f$ Q^*_{-n,p}@f$ if @f$n<0@f$
      */
-    const Complex& operator()(Harmonic n, Power p) const
+    Complex operator()(Harmonic n, Power p) const
     {
-      return _q[index(n,p)];
-    }
-    /**
-    * @brief Get @f$Q_{n,p}@f$
-    *
-    * Get the @f$Q_{n,p} = \sum_{i=1}^{M} w_i^pe^{in\phi_i}@f$.
-    * Note that @f$Q_{-n,p} = Q_{n,p}^*@f$
-    *
-    * @param n The harmonic
-    * @param p The power
-    *
-    * @return @f$ Q_{n,p}@f$ or @f$ Q^*_{-n,p}@f$ if @f$n<0@f$
-    */
-    Complex& operator()(Harmonic n, Power p)
-    {
-      return _q[index(n,p)];
+      if (n < 0 && _half) {
+	const size_t i = index(-n,p);
+	return Complex(_d[i], -_d[i + _imOff]);
+      }
+      const size_t i = index(n,p);
+      return Complex(_d[i], _d[i + _imOff]);
     }
     /**
      * Fill in an obersvation
      *
+     * The harmonics @f$ e^{in\phi}@f$ are obtained by successive
+     * rotations of @f$ e^{i\phi}@f$, and the powers of the weight
+     * by repeated multiplication, so only one @f$\sin,\cos@f$ pair
+     * is evaluated per observation.
+     *
      * @param phi     Phi observation.
      * @param weight  Weight of this observation.
      */
     void fill(Real phi, Real weight)
     {
-      std::vector<Real> cs(_maxN+1);
-      std::vector<Real> sc(_maxN+1);
-      for (Harmonic n = 0; n <= _maxN; n++) {
-	cs[n] = cos(n * phi);
-	sc[n] = sin(n * phi);
-      }
-      for (Power p=0; p <= _maxP; p++) {
-	Real w = (!_useWeights || p == 0 ? 1 : pow(weight,p));
-	for (Harmonic n = 0; n <= _maxN; n++) {
-	  this->operator()(n,p) += Complex(w * cs[n], w * sc[n]);
-	  if (n == 0) continue;
-	  // Update the conjugate as well
-	  this->operator()(-n,p) += Complex(w * cs[n], -w * sc[n]);
+      _gen.bump();
+      const size_t nh = _fillN + 1;
+      const size_t np = _nP;
+      if (_work.size() < 2 * nh + np) _work.resize(2 * nh + np);
+      Real* hre = &(_work[0]);
+      Real* him = hre + nh;
+      Real* wp  = him + nh;
+
+      const Real c1 = cos(phi);
+      const Real s1 = sin(phi);
+      Real       cn = 1;
+      Real       sn = 0;
+      for (size_t k = 0; k < nh; k++) {
+	hre[k]       = cn;
+	him[k]       = sn;
+	const Real t = cn * c1 - sn * s1;
+	sn           = sn * c1 + cn * s1;
+	cn           = t;
+      }
+      if (!_useWeights) {
+	for (ComponentVector::const_iterator c = _comps.begin();
+	     c != _comps.end(); ++c) {
+	  accumulate(*c, hre[c->n], him[c->n]);
+	}
+	return;
+      }
+      wp[0] = 1;
+      for (size_t k = 1; k < np; k++) wp[k] = wp[k-1] * weight;
+
+      for (ComponentVector::const_iterator c = _comps.begin();
+	   c != _comps.end(); ++c) {
+	const Real r = wp[c->p] * hre[c->n];
+	const Real m = wp[c->p] * him[c->n];
+	accumulate(*c, r, m);
+      }
+    }
+    /**
+     * Fill in a batch of observations.
+     *
+     * This is equivalent to calling fill(Real,Real) for each
+     * observation, but the observations are processed
+     * correlations::simd::kLanes at a time using vector
+     * instructions (see correlations::simd).  Partial sums are kept
+     * per lane and only added to the @f$ Q@f$-vector at the end, so
+     * it is most efficient to pass all observations of an event in
+     * one call.
+     *
+     * @param phis    Array of @a n @f$\phi@f$ observations
+     * @param weights Array of @a n weights.  If null, or if weights
+     *                are not used, all weights are taken to be 1.
+     * @param n       Number of observations
+     */
+    void fill(const Real* phis, const Real* weights, size_t n)
+    {
+      using namespace simd;
+      _gen.bump();
+      const size_t nh = _fillN + 1;
+      const size_t np = _nP;
+      const size_t nc = _comps.size();
+      const bool   uw = _useWeights && weights;
+      // Per-lane accumulators for real and imaginary parts of each
+      // component, followed by the per-lane harmonics and powers of
+      // the weights.  The buffer only grows, so there is no
+      // allocation once warm.
+      const size_t nw = (2 * nc + 2 * nh + np) * kLanes;
+      if (_work.size() < nw) _work.resize(nw);
+      std::fill(_work.begin(), _work.begin() + 2 * nc * kLanes, Real(0));
+      Real* are = &(_work[0]);
+      Real* aim = are + nc * kLanes;
+      Real* hre = aim + nc * kLanes;
+      Real* him = hre + nh * kLanes;
+      Real* wps = him + nh * kLanes;
+
+      Real c1[kLanes], s1[kLanes], w1[kLanes], w0[kLanes];
+      for (size_t i = 0; i < n; i += kLanes) {
+	for (size_t l = 0; l < size_t(kLanes); l++) {
+	  // Pad the last block with observations that have all
+	  // harmonics, including the 0th, equal to 0
+	  const bool ok = i + l < n;
+	  c1[l] = ok ? cos(phis[i+l]) : 1;
+	  s1[l] = ok ? sin(phis[i+l]) : 0;
+	  w0[l] = ok ? 1 : 0;
+	  w1[l] = uw ? weights[std::min(i+l, n-1)] : 1;
+	}
+	// Harmonics by rotation
+	const Pack pc = load(c1);
+	const Pack ps = load(s1);
+	Pack       zr = load(w0);
+	Pack       zi = set1(0);
+	for (size_t k = 0; k < nh; k++) {
+	  store(hre + k * kLanes, zr);
+	  store(him + k * kLanes, zi);
+	  const Pack t = fnma(zi, ps, mul(zr, pc));
+	  zi           = fma(zi, pc, mul(zr, ps));
+	  zr           = t;
+	}
+	if (!_useWeights) {
+	  // Only the single power plane to fill, without weights
+	  for (size_t k = 0; k < nc; k++) {
+	    const Component& c  = _comps[k];
+	    Real*            ar = are + k * kLanes;
+	    Real*            ai = aim + k * kLanes;
+	    store(ar, add(load(hre + c.n * kLanes), load(ar)));
+	    store(ai, add(load(him + c.n * kLanes), load(ai)));
+	  }
+	  continue;
+	}
+	// Powers of the weights
+	const Pack pw = load(w1);
+	Pack       wp = set1(1);
+	for (size_t k = 0; k < np; k++) {
+	  store(wps + k * kLanes, wp);
+	  wp = mul(wp, pw);
+	}
+	// Accumulate weighted harmonics.  Components are ordered by
+	// harmonic, so we load each harmonic once.
+	for (size_t k = 0; k < nc; ) {
+	  const Harmonic h  = _comps[k].n;
+	  const Pack     hr = load(hre + h * kLanes);
+	  const Pack     hi = load(him + h * kLanes);
+	  for (; k < nc && _comps[k].n == h; k++) {
+	    Real*      ar = are + k * kLanes;
+	    Real*      ai = aim + k * kLanes;
+	    const Pack w  = load(wps + _comps[k].p * kLanes);
+	    store(ar, fma(w, hr, load(ar)));
+	    store(ai, fma(w, hi, load(ai)));
+	  }
+	}
+      }
+      // Reduce over lanes and add to the Q-vector
+      for (size_t k = 0; k < nc; k++) {
+	const Component& c = _comps[k];
+	const Real       r = hsum(are + k * kLanes);
+	const Real       m = hsum(aim + k * kLanes);
+	accumulate(c, r, m);
+      }
+    }
+    /**
+     * Fill in a batch of observations using several threads.
+     *
+     * Each thread fills a private partial @f$ Q@f$-vector from its
+     * share of the observations, and the partial vectors are then
+     * added to this in thread order, so the result does not depend
+     * on scheduling.  This is only worth it for very large events
+     * (e.g., pooled super-events).
+     *
+     * Threads are only used if the code is compiled with OpenMP
+     * (e.g., @c -fopenmp, or <tt>make OMP=1</tt>).  Otherwise, this
+     * is the same as fill(const Real*,const Real*,size_t).
+     *
+     * @param phis     Array of @a n @f$\phi@f$ observations
+     * @param weights  Array of @a n weights or null
+     * @param n        Number of observations
+     * @param nThreads Number of threads to use
+     */
+    void fill(const Real* phis, const Real* weights, size_t n,
+	      unsigned int nThreads)
+    {
+#ifdef _OPENMP
+      if (nThreads > 1 && n > nThreads * simd::kLanes) {
+	std::vector<QVector> parts(nThreads, *this);
+	const long           nt = nThreads;
+#pragma omp parallel for num_threads(nThreads) schedule(static)
+	for (long t = 0; t < nt; t++) {
+	  const size_t first = n * t / nt;
+	  const size_t last  = n * (t + 1) / nt;
+	  parts[t].reset();
+	  parts[t].fill(phis + first, weights ? weights + first : 0,
+			last - first);
 	}
+	for (long t = 0; t < nt; t++) merge(parts[t]);
+	return;
+      }
+#else
+      (void)nThreads;
+#endif
+      fill(phis, weights, n);
+    }
+    /**
+     * Add the components of another @f$ Q@f$-vector to this.  If
+     * the two vectors have the same dimensions and storage, this is
+     * a simple element-wise sum.  Otherwise, all components of this
+     * that are also in @a o are added.
+     *
+     * @param o    @f$ Q@f$-vector to add
+     * @param sign Multiply components of @a o by this (e.g., -1 to
+     *             subtract)
+     *
+     * @return Reference to this
+     */
+    QVector& merge(const QVector& o, Real sign=1)
+    {
+      _gen.bump();
+      if (isCompatible(o)) {
+	Real*       d  = &(_d[0]);
+	const Real* od = &(o._d[0]);
+	for (size_t i = 0; i < _d.size(); i++) d[i] += sign * od[i];
+	return *this;
+      }
+      const Harmonic mn = std::min(_maxN, o._maxN);
+      const Power    mp = _useWeights ? std::min(_maxP, o._maxP) : 0;
+      for (Harmonic n = (_half ? 0 : -mn); n <= mn; n++) {
+	for (Power p = 0; p <= mp; p++) {
+	  const size_t  i = index(n, p);
+	  const Complex c = o(n, p);
+	  _d[i]          += sign * c.real();
+	  _d[i + _imOff] += sign * c.imag();
+	}
+      }
+      return *this;
+    }
+    /**
+     * Add another @f$ Q@f$-vector to this (see merge)
+     *
+     * @param o @f$ Q@f$-vector to add
+     *
+     * @return Reference to this
+     */
+    QVector& operator+=(const QVector& o) { return merge(o, 1); }
+    /**
+     * Subtract another @f$ Q@f$-vector from this (see merge).  If
+     * @a o is filled from a subset of the observations of this, the
+     * result is the @f$ Q@f$-vector of the remaining observations.
+     *
+     * @param o @f$ Q@f$-vector to subtract
+     *
+     * @return Reference to this
+     */
+    QVector& operator-=(const QVector& o) { return merge(o, -1); }
+    /**
+     * Check if another @f$ Q@f$-vector has the same dimensions and
+     * storage as this.
+     *
+     * @param o @f$ Q@f$-vector to compare to
+     *
+     * @return true if the internal storage of this and @a o match
+     * element by element
+     */
+    bool isCompatible(const QVector& o) const
+    {
+      return layout() == o.layout();
+    }
+    /**
+     * Description of how the components are laid out in the internal
+     * storage.  Two @f$ Q@f$-vectors with equal layouts store
+     * @f$ Q_{n,p}@f$ at the same place (see locate).
+     */
+    struct Layout
+    {
+      /** Constructor */
+      Layout()
+	: maxN(0), maxP(0), offN(0), nStride(0), pStride(0), imOff(0),
+	  size(0), half(false)
+      {}
+      /**
+       * @param o Other layout
+       *
+       * @return true if this and @a o are the same
+       */
+      bool operator==(const Layout& o) const
+      {
+	return (maxN    == o.maxN    && maxP    == o.maxP    &&
+		offN    == o.offN    && nStride == o.nStride &&
+		pStride == o.pStride && imOff   == o.imOff   &&
+		size    == o.size    && half    == o.half);
       }
+      Size   maxN;    /**< Maximum harmonic */
+      Size   maxP;    /**< Maximum power */
+      Size   offN;    /**< Offset of harmonic zero */
+      size_t nStride; /**< Stride of harmonic index */
+      size_t pStride; /**< Stride of power index */
+      size_t imOff;   /**< Offset of imaginary parts */
+      size_t size;    /**< Size of storage */
+      bool   half;    /**< Only non-negative harmonics stored */
+    };
+    /**
+     * @return The layout of the internal storage
+     */
+    Layout layout() const
+    {
+      Layout l;
+      l.maxN    = _maxN;
+      l.maxP    = _maxP;
+      l.offN    = _offN;
+      l.nStride = _nStride;
+      l.pStride = _pStride;
+      l.imOff   = _imOff;
+      l.size    = _d.size();
+      l.half    = _half;
+      return l;
+    }
+    /**
+     * Locate @f$ Q_{n,p}@f$ in the internal storage (see data()), so
+     * that
+     * @f[
+     *   Q_{n,p} = d_{re} + i\,s\,d_{im}
+     * @f]
+     * The locations stay valid for any @f$ Q@f$-vector with the same
+     * layout().
+     *
+     * @param n  Harmonic
+     * @param p  Power
+     * @param re On return, index of the real part
+     * @param im On return, index of the imaginary part
+     * @param s  On return, sign of the imaginary part (-1 if the
+     *           component is stored as its conjugate)
+     */
+    void locate(Harmonic n, Power p, size_t& re, size_t& im, Real& s) const
+    {
+      s = 1;
+      if (n < 0 && _half) {
+	n = -n;
+	s = -1;
+      }
+      re = index(n, p);
+      im = re + _imOff;
     }
     /**
      * Get the maximum harmonic (minus 1)
@@ -183,9 +581,75 @@ namespace correlations {
      * @return Maximum power (minus 1)
      */
     Power maxP() const { return _maxP; }
-
+    /**
+     * @return true if only non-negative harmonics are stored
+     */
+    bool isHalf() const { return _half; }
+    /**
+     * @return true if only the components needed for the harmonic
+     * vector passed to resize(const HarmonicVector&) are filled.
+     */
+    bool isSparse() const { return _sparse; }
+    /**
+     * @return true if real and imaginary parts are stored in separate
+     * arrays (QVector::kSoA)
+     */
+    bool isSoA() const { return _soa; }
+    /**
+     * @return true if all harmonics of a given power are stored
+     * consecutively (QVector::kPowerMajor)
+     */
+    bool isPowerMajor() const { return _powerMajor; }
+    /**
+     * @return Number of (non-negative harmonic) components filled
+     */
+    size_t nFilled() const { return _comps.size(); }
+    /**
+     * Get the internal storage.  How the components are laid out
+     * depends on the storage flags, so this should only be used to
+     * copy data between Q-vectors for which isCompatible is true.
+     *
+     * @return Pointer to the dataSize() values of the internal storage
+     */
+    const Real* data() const { return &(_d[0]); }
+    /**
+     * Get the internal storage for writing.  This counts as a change
+     * of the content (see generation).
+     *
+     * @return Pointer to the dataSize() values of the internal storage
+     */
+    Real* data() { _gen.bump(); return &(_d[0]); }
+    /**
+     * Get the generation of the content.  This changes every time
+     * the content may have changed (reset, fill, merge, resize,
+     * assignment, or non-const data()), so correlators can cache
+     * results as long as the generation is the same.
+     *
+     * @return Generation of the content
+     */
+    unsigned long generation() const { return _gen.value; }
+    /**
+     * Get an identifier of this Q-vector, unique within the process.
+     * Together with generation, this identifies the content, so
+     * that a correlations::Workspace used with several Q-vectors
+     * knows when to forget its cached results.
+     *
+     * @return Identifier of this Q-vector
+     */
+    unsigned long identity() const { return _gen.id; }
+    /**
+     * @return Number of values in the internal storage
+     */
+    size_t dataSize() const { return _d.size(); }
+    /**
+     * Check that @f$Q_{-n,p} = Q_{n,p}^*@f$ for all stored components.
+     * This trivially holds in half storage mode.
+     *
+     * @return true if the Q-vector is consistent
+     */
     bool verify() const
     {
+      if (_half) return true;
       bool ret = true;
       for (Harmonic i = -_maxN; i <= _maxN; i++) {
 	if (i == 0) continue;
@@ -214,15 +678,145 @@ namespace correlations {
     }
   protected:
     /**
-     * Calculate index into internal storage for a given harmonic and
-     * power.  @b NB No bounds check.
+     * A component to fill
+     */
+    struct Component
+    {
+      Harmonic n; /**< Harmonic (non-negative) */
+      Power    p; /**< Power */
+      size_t   i; /**< Index of @f$\Re Q_{n,p}@f$ in storage */
+      size_t   j; /**< Index of @f$\Re Q_{-n,p}@f$ or @a i if not stored */
+    };
+    /** Type of list of components */
+    typedef std::vector<Component> ComponentVector;
+    /**
+     * Generation counter.  Assigning one counter to another gives a
+     * value different from both, so a Q-vector that is assigned to
+     * never looks unchanged.  Each counter also has an identifier
+     * unique within the process, so that a (identifier, value) pair
+     * tells one Q-vector content from another, even if a new
+     * Q-vector is created where an old one used to be.
+     */
+    struct Generation
+    {
+      /** Constructor */
+      Generation() : id(next()), value(1) {}
+      /** Copy constructor */
+      Generation(const Generation& o) : id(next()), value(o.value) {}
+      /**
+       * Assignment
+       *
+       * @param o Other counter
+       *
+       * @return Reference to this
+       */
+      Generation& operator=(const Generation& o)
+      {
+	value = std::max(value, o.value) + 1;
+	return *this;
+      }
+      /** Mark a change */
+      void bump() { value++; }
+      /**
+       * @return A new identifier.  This is thread-safe when compiled
+       * with GCC or Clang.
+       */
+      static unsigned long next()
+      {
+	static unsigned long last = 0;
+#ifdef __GNUC__
+	return __sync_add_and_fetch(&last, 1);
+#else
+	return ++last;
+#endif
+      }
+      /** Identifier */
+      unsigned long id;
+      /** Current value */
+      unsigned long value;
+    };
+    /**
+     * Set the size of the storage and clear the list of components
+     * to fill.
+     *
+     * @param mN New maximum harmonic
+     * @param mP New maximum power
+     */
+    void setup(Size mN, Size mP)
+    {
+      _gen.bump();
+      _maxN = mN;
+      _maxP = mP;
+      // Unless in half storage mode, we store both the positive and
+      // the negative harmonics for efficiency reasons. So we need to
+      // index from -fMaxN-1 to fMaxN, which gives us a total of
+      // 2*fMaxN+1 places for N.
+      _offN = _half ? 0 : _maxN;
+      // Without weights, all powers are the same, and we only store
+      // one.
+      _nP   = _useWeights ? _maxP+1 : 1;
+      // Strides of the harmonic and power indices, and the offset of
+      // the imaginary part relative to the real part.  In the
+      // array-of-structures layout real and imaginary parts are
+      // interleaved.
+      const Size nN = _offN + _maxN + 1;
+      const Size nC = _soa ? 1 : 2;
+      _nStride = nC * (_powerMajor ? 1 : _nP);
+      _pStride = _useWeights ? nC * (_powerMajor ? nN : 1) : 0;
+      _imOff   = _soa ? nN * _nP : 1;
+      _d.resize(2 * nN * _nP);
+      _comps.clear();
+      _fillN = 0;
+    }
+    /**
+     * Add a component to be filled.  Without weights all powers map
+     * to the same component, which is only added once.
+     *
+     * @param n Harmonic (non-negative)
+     * @param p Power
+     */
+    void addComponent(Harmonic n, Power p)
+    {
+      if (!_useWeights) {
+	p = 0;
+	if (!_comps.empty() && _comps.back().n == n) return;
+      }
+      Component c;
+      c.n    = n;
+      c.p    = p;
+      c.i    = index(n, p);
+      c.j    = (n == 0 || _half ? c.i : index(-n, p));
+      _fillN = std::max(_fillN, Size(n));
+      _comps.push_back(c);
+    }
+    /**
+     * Add to a component and its conjugate
+     *
+     * @param c Component
+     * @param r Real part to add
+     * @param m Imaginary part to add
+     */
+    void accumulate(const Component& c, Real r, Real m)
+    {
+      _d[c.i]          += r;
+      _d[c.i + _imOff] += m;
+      // Update the conjugate as well
+      if (c.j == c.i) return;
+      _d[c.j]          += r;
+      _d[c.j + _imOff] -= m;
+    }
+    /**
+     * Calculate index into internal storage of the real part for a
+     * given harmonic and power.  The imaginary part is at offset
+     * _imOff from that.  @b NB No bounds check, and in half storage
+     * mode @a n must be non-negative.
      *
      * @param n Harmonic
      * @param p Power
      *
      * @return Index into internal array
      */
-    unsigned short index(Harmonic n, Power p) const
+    size_t index(Harmonic n, Power p) const
     {
 #if 0
       if (p > _maxP) {
@@ -234,12 +828,25 @@ namespace correlations {
 	return 0xFFFF;
       }
 #endif
-      return ((n + _maxN) * (_maxP+1) + p);
+      return (n + _offN) * _nStride + p * _pStride;
     }
     Size           _maxN;         /**< Maximum harmonic order  */
     Size           _maxP;         /**< Maximum power of harmonic */
     bool           _useWeights;   /**< Wheter to use weights or not */
-    ComplexVector  _q;            /**< Internal storage of Q vector */
+    bool           _half;         /**< Only store non-negative harmonics */
+    bool           _sparse;       /**< Only fill needed components */
+    bool           _soa;          /**< Separate real and imaginary parts */
+    bool           _powerMajor;   /**< Harmonics of a power consecutive */
+    Size           _offN;         /**< Offset of harmonic zero */
+    Size           _nP;           /**< Number of stored powers */
+    size_t         _nStride;      /**< Stride of harmonic index */
+    size_t         _pStride;      /**< Stride of power index */
+    size_t         _imOff;        /**< Offset of imaginary parts */
+    RealVector     _d;            /**< Internal storage of Q vector */
+    ComponentVector _comps;       /**< Components to fill */
+    Size           _fillN;        /**< Largest harmonic to fill */
+    RealVector     _work;         /**< Scratch space for batched fill */
+    Generation     _gen;          /**< Generation of content */
   };
 }
 #endif
@@ -0,0 +1,167 @@
+#ifndef CORRELATIONS_SIMD_HH
+#define CORRELATIONS_SIMD_HH
+/**
+ * @file   correlations/Simd.hh
+ * @date   Sat Oct 17 06:22:39 2026
+ *
+ * @brief  Thin wrappers around vector instructions
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <correlations/Types.hh>
+#if !defined(CORRELATIONS_NO_SIMD) \
+  && (defined(__AVX512F__) || defined(__AVX2__))
+# include <immintrin.h>
+# if defined(__AVX512F__)
+#  define CORRELATIONS_SIMD_AVX512
+# else
+#  define CORRELATIONS_SIMD_AVX2
+# endif
+#endif
+
+namespace correlations {
+  /**
+   * Namespace for vector instruction wrappers.
+   *
+   * A correlations::simd::Pack holds correlations::simd::kLanes
+   * values of type correlations::Real.  Which instruction set is
+   * used is decided at compile time:
+   *
+   * - AVX-512 if @c __AVX512F__ is defined (e.g., @c -mavx512f or
+   *   @c -march=native on a capable machine)
+   * - AVX2 if @c __AVX2__ is defined (e.g., @c -mavx2 @c -mfma)
+   * - Otherwise a plain array of 4 values, which the compiler is
+   *   free to auto-vectorise.
+   *
+   * Defining @c CORRELATIONS_NO_SIMD forces the plain fallback.
+   * The vector instruction sets are only used if
+   * correlations::Real is @c double.
+   */
+  namespace simd {
+#if defined(CORRELATIONS_SIMD_AVX512) || defined(CORRELATIONS_SIMD_AVX2)
+    /** Make sure we are not asked to do vector math on non-doubles */
+    typedef char RealMustBeDouble[sizeof(Real) == sizeof(double) ? 1 : -1];
+#endif
+#if defined(CORRELATIONS_SIMD_AVX512)
+    /** Number of values in a pack */
+    enum { kLanes = 8 };
+    /** A pack of values */
+    typedef __m512d Pack;
+    inline Pack load(const Real* p)          { return _mm512_loadu_pd(p); }
+    inline void store(Real* p, Pack a)       { _mm512_storeu_pd(p, a); }
+    inline Pack set1(Real v)                 { return _mm512_set1_pd(v); }
+    inline Pack add(Pack a, Pack b)          { return _mm512_add_pd(a, b); }
+    inline Pack sub(Pack a, Pack b)          { return _mm512_sub_pd(a, b); }
+    inline Pack mul(Pack a, Pack b)          { return _mm512_mul_pd(a, b); }
+    /** @return @f$ ab+c@f$ */
+    inline Pack fma(Pack a, Pack b, Pack c)  { return _mm512_fmadd_pd(a,b,c); }
+    /** @return @f$ c-ab@f$ */
+    inline Pack fnma(Pack a, Pack b, Pack c) { return _mm512_fnmadd_pd(a,b,c); }
+#elif defined(CORRELATIONS_SIMD_AVX2)
+    /** Number of values in a pack */
+    enum { kLanes = 4 };
+    /** A pack of values */
+    typedef __m256d Pack;
+    inline Pack load(const Real* p)          { return _mm256_loadu_pd(p); }
+    inline void store(Real* p, Pack a)       { _mm256_storeu_pd(p, a); }
+    inline Pack set1(Real v)                 { return _mm256_set1_pd(v); }
+    inline Pack add(Pack a, Pack b)          { return _mm256_add_pd(a, b); }
+    inline Pack sub(Pack a, Pack b)          { return _mm256_sub_pd(a, b); }
+    inline Pack mul(Pack a, Pack b)          { return _mm256_mul_pd(a, b); }
+# ifdef __FMA__
+    /** @return @f$ ab+c@f$ */
+    inline Pack fma(Pack a, Pack b, Pack c)  { return _mm256_fmadd_pd(a,b,c); }
+    /** @return @f$ c-ab@f$ */
+    inline Pack fnma(Pack a, Pack b, Pack c) { return _mm256_fnmadd_pd(a,b,c); }
+# else
+    inline Pack fma(Pack a, Pack b, Pack c)  { return add(mul(a, b), c); }
+    inline Pack fnma(Pack a, Pack b, Pack c) { return sub(c, mul(a, b)); }
+# endif
+#else
+    /** Number of values in a pack */
+    enum { kLanes = 4 };
+    /** A pack of values */
+    struct Pack { Real v[kLanes]; };
+    inline Pack load(const Real* p)
+    {
+      Pack r;
+      for (int i = 0; i < kLanes; i++) r.v[i] = p[i];
+      return r;
+    }
+    inline void store(Real* p, const Pack& a)
+    {
+      for (int i = 0; i < kLanes; i++) p[i] = a.v[i];
+    }
+    inline Pack set1(Real v)
+    {
+      Pack r;
+      for (int i = 0; i < kLanes; i++) r.v[i] = v;
+      return r;
+    }
+    inline Pack add(const Pack& a, const Pack& b)
+    {
+      Pack r;
+      for (int i = 0; i < kLanes; i++) r.v[i] = a.v[i] + b.v[i];
+      return r;
+    }
+    inline Pack sub(const Pack& a, const Pack& b)
+    {
+      Pack r;
+      for (int i = 0; i < kLanes; i++) r.v[i] = a.v[i] - b.v[i];
+      return r;
+    }
+    inline Pack mul(const Pack& a, const Pack& b)
+    {
+      Pack r;
+      for (int i = 0; i < kLanes; i++) r.v[i] = a.v[i] * b.v[i];
+      return r;
+    }
+    /** @return @f$ ab+c@f$ */
+    inline Pack fma(const Pack& a, const Pack& b, const Pack& c)
+    {
+      Pack r;
+      for (int i = 0; i < kLanes; i++) r.v[i] = a.v[i] * b.v[i] + c.v[i];
+      return r;
+    }
+    /** @return @f$ c-ab@f$ */
+    inline Pack fnma(const Pack& a, const Pack& b, const Pack& c)
+    {
+      Pack r;
+      for (int i = 0; i < kLanes; i++) r.v[i] = c.v[i] - a.v[i] * b.v[i];
+      return r;
+    }
+#endif
+    /**
+     * Sum the lanes of an array of kLanes values
+     *
+     * @param p Pointer to kLanes values
+     *
+     * @return Sum of the values
+     */
+    inline Real hsum(const Real* p)
+    {
+      Real r = 0;
+      for (int i = 0; i < kLanes; i++) r += p[i];
+      return r;
+    }
+  }
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
@@ -27,6 +27,17 @@
 #include <vector>
 #include <complex>
 
+/**
+ * Largest correlator calculated by closed-form expressions (see
+ * correlations/closed/Kernel.hh).  Orders up to 8 are always
+ * available.  Orders 9 and 10 take much longer to compile, and are
+ * enabled by defining this to 9 or 10.  It is defined here, so that
+ * all code - e.g., correlations::CostModel - sees the same value.
+ */
+#ifndef CORRELATIONS_CLOSED_MAX
+# define CORRELATIONS_CLOSED_MAX 8
+#endif
+
 /**
  * Namespace for correlations code
  */
@@ -0,0 +1,423 @@
+#ifndef CORRELATIONS_WORKSPACE_HH
+#define CORRELATIONS_WORKSPACE_HH
+/**
+ * @file   correlations/Workspace.hh
+ * @date   Sat Oct 17 06:54:11 2026
+ *
+ * @brief  Caller owned scratch space and caches of correlators
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <correlations/Types.hh>
+#include <correlations/Result.hh>
+#include <correlations/QVector.hh>
+#include <correlations/PlainComplex.hh>
+#include <algorithm>
+
+namespace correlations {
+  //____________________________________________________________________
+  /**
+   * Memo of intermediate results of a recursion (see
+   * correlations::recursive::FromQVector).  Keys are lists of
+   * integers stored back to back in a flat arena (length first), and
+   * found through an open addressing hash table.  Nothing is
+   * released by clear, so there are no allocations once the memo is
+   * warm.
+   *
+   * @headerfile ""  <correlations/Workspace.hh>
+   */
+  struct Memo
+  {
+    /** Marks an empty table slot */
+    enum { kNone = size_t(-1) };
+    /** Constructor */
+    Memo() : arena(), offsets(), values(), table(64, size_t(kNone)) {}
+    /**
+     * Forget all entries
+     */
+    void clear()
+    {
+      arena.clear();
+      offsets.clear();
+      values.clear();
+      std::fill(table.begin(), table.end(), size_t(kNone));
+    }
+    /**
+     * @param o Offset of key in arena
+     *
+     * @return Hash of the key
+     */
+    size_t hash(size_t o) const
+    {
+      size_t r = 2166136261u;
+      for (size_t i = o; i <= o + size_t(arena[o]); i++)
+	r = (r ^ size_t(arena[i])) * 16777619u;
+      return r;
+    }
+    /**
+     * @param o1 Offset of one key
+     * @param o2 Offset of another key
+     *
+     * @return true if the keys are equal
+     */
+    bool equal(size_t o1, size_t o2) const
+    {
+      return std::equal(arena.begin() + o1,
+			arena.begin() + o1 + arena[o1] + 1,
+			arena.begin() + o2);
+    }
+    /**
+     * Find a key
+     *
+     * @param o    Offset of the key in the arena
+     * @param slot On return, the table slot of the key
+     *
+     * @return Index of the entry, or kNone if not found
+     */
+    size_t find(size_t o, size_t& slot) const
+    {
+      const size_t mask = table.size() - 1;
+      for (slot = hash(o) & mask; ; slot = (slot + 1) & mask) {
+	const size_t e = table[slot];
+	if (e == size_t(kNone)) return e;
+	if (arena[offsets[e]] == arena[o] && equal(offsets[e], o))
+	  return e;
+      }
+    }
+    /**
+     * Add an entry.  The key must already be in the arena.
+     *
+     * @param o Offset of the key in the arena
+     * @param v Value
+     */
+    void insert(size_t o, const Complex& v)
+    {
+      if (2 * (values.size() + 1) > table.size()) {
+	table.assign(2 * table.size(), size_t(kNone));
+	for (size_t e = 0; e < values.size(); e++) {
+	  size_t slot = 0;
+	  find(offsets[e], slot);
+	  table[slot] = e;
+	}
+      }
+      size_t slot = 0;
+      find(o, slot);
+      table[slot] = values.size();
+      offsets.push_back(o);
+      values.push_back(v);
+    }
+    /** Arena of keys */
+    std::vector<int>    arena;
+    /** Offset of each entry's key in the arena */
+    std::vector<size_t> offsets;
+    /** Value of each entry */
+    ComplexVector       values;
+    /** Hash table of entry indices */
+    std::vector<size_t> table;
+  };
+
+  //____________________________________________________________________
+  /**
+   * Tables of how the recurrence of
+   * correlations::recurrence::FromQVector splits each sub-set of @f$
+   * n@f$ slots.  The sub-set @f$ S@f$ (a bit mask) is the sum over
+   * the sub-sets @f$ c@f$ of @f$ S@f$ without its last slot of
+   *
+   * @f[
+   *   (-1)^{p-1}(p-1)!\,C(c)\,Q_{h_b,p}\quad b = S\setminus c,\ p=|b|
+   * @f]
+   *
+   * The terms of all sets needed for @f$ n@f$ slots - those of the
+   * first @f$ n-1@f$ slots, and all @f$ n@f$ - are stored as flat
+   * lists, in the order the recursion would visit them: largest
+   * @f$ c@f$ first, and sets of equal size in lexicographic order.
+   * A table is made the first time its order is asked for.
+   *
+   * @headerfile ""  <correlations/Workspace.hh>
+   */
+  struct Combinations
+  {
+    /** Largest order tabulated - the tables grow like @f$ 3^n@f$ */
+    enum { kMaxOrder = 12 };
+    /** One term of a sum */
+    struct Term
+    {
+      unsigned c; /**< Sub-set of the correlator */
+      unsigned b; /**< Complement of @c c in the set */
+      Power    p; /**< Number of slots in @c b */
+      Real     f; /**< Sign and factorial factor */
+    };
+    /** A vector of terms */
+    typedef std::vector<Term> TermVector;
+    /** A vector of sets */
+    typedef std::vector<unsigned> MaskVector;
+    /** The tables of one order */
+    struct Table
+    {
+      Table() : sets(), ends(), terms() {}
+      MaskVector          sets;  /**< Sets, sub-sets before sets */
+      std::vector<size_t> ends;  /**< End of the terms of each set */
+      TermVector          terms; /**< Terms of all sets */
+    };
+    /** Constructor */
+    Combinations() : tables() {}
+    /**
+     * Get the tables of @a n slots, making them if needed
+     *
+     * @param n Number of slots (at most kMaxOrder)
+     *
+     * @return The tables
+     */
+    const Table& table(const Size n)
+    {
+      if (tables.size() <= n) tables.resize(n + 1);
+      Table& t = tables[n];
+      if (t.sets.empty()) make(n, t);
+      return t;
+    }
+    /**
+     * Make the tables of @a n slots
+     *
+     * @param n Number of slots
+     * @param t On return, the tables
+     */
+    static void make(const Size n, Table& t)
+    {
+      const unsigned half = 1u << (n - 1);
+      const unsigned full = (1u << n) - 1;
+      std::vector<Real> f(n + 1, 1);
+      for (Size p = 2; p <= n; p++) f[p] = -f[p - 1] * (p - 1);
+
+      std::vector<Size> e(n), v(n);
+      for (unsigned s = 1; s <= half; s++) {
+	const unsigned set = (s == half ? full : s);
+	// Slots of the set, except the last
+	Size m = 0;
+	for (Size i = 0; i < n; i++) if (set & (1u << i)) e[m++] = i;
+	m--;
+	for (Size k = m + 1; k-- > 0; ) {
+	  for (Size i = 0; i < k; i++) v[i] = i;
+	  while (true) {
+	    unsigned c = 0;
+	    for (Size i = 0; i < k; i++) c |= 1u << e[v[i]];
+	    Term x;
+	    x.c = c;
+	    x.b = set & ~c;
+	    x.p = m + 1 - k;
+	    x.f = f[x.p];
+	    t.terms.push_back(x);
+	    // Next combination in lexicographic order
+	    Size i = k;
+	    while (i > 0 && v[i - 1] == m - k + i - 1) i--;
+	    if (i == 0) break;
+	    v[i - 1]++;
+	    for (Size j = i; j < k; j++) v[j] = v[j - 1] + 1;
+	  }
+	}
+	t.sets.push_back(set);
+	t.ends.push_back(t.terms.size());
+      }
+    }
+    /** Tables of each order */
+    std::vector<Table> tables;
+  };
+
+  //____________________________________________________________________
+  /**
+   * Scratch space and caches used by the correlators derived from
+   * correlations::FromQVector.
+   *
+   * The correlators themselves hold no state that changes during a
+   * calculation.  Everything that does - cached denominators and
+   * results, and the work buffers and memo of the recursive
+   * algorithms - lives in a workspace owned by the caller and passed
+   * to each call.  One correlator can therefore serve several
+   * threads at once, as long as each thread has its own workspace:
+   *
+   @code
+   correlations::closed::FromQVector c;
+   #pragma omp parallel
+   {
+     correlations::QVector    q(h, true);
+     correlations::Workspace  ws;
+     correlations::Result     r;
+     #pragma omp for
+     for (int e = 0; e < nEvents; e++) {
+       q.reset();
+       q.fill(phis[e], weights[e], mult[e]);
+       r += c.calculate(q, h, ws);
+     }
+     #pragma omp critical
+     total += r;
+   }
+   @endcode
+   *
+   * A workspace remembers which Q-vector content (see
+   * QVector::identity and QVector::generation) its caches refer to,
+   * and clears them when used with a different one.  Nothing is
+   * released by that, so a workspace does not allocate memory once
+   * it is warm.  Results are cached by the correlator that
+   * calculated them, as well as by size and harmonics, so a
+   * workspace can be shared by different correlators, e.g., to
+   * compare them, and each gets back its own results.
+   *
+   * @headerfile ""  <correlations/Workspace.hh>
+   */
+  struct Workspace
+  {
+    /** Maximum number of cached results */
+    enum { kCacheSize = 32 };
+    /** A vector of counts */
+    typedef std::vector<Size> SizeVector;
+    /** A vector of indices */
+    typedef std::vector<size_t> IndexVector;
+    /** Constructor */
+    Workspace()
+      : null(0), args(0), given(0), den(0), denOk(0), cache(0), cacheN(0),
+	cacheNext(0), memo(), comb(), cnt(0), hh(0), z(0), r(0), idx(0),
+	_qId(0), _qGen(0)
+    {}
+    /**
+     * Declare that the next calculations are for the Q-vector @a q.
+     * If that is not the content the caches refer to, the caches are
+     * cleared.
+     *
+     * @param q Q-vector
+     */
+    void use(const QVector& q)
+    {
+      if (q.identity() == _qId && q.generation() == _qGen) return;
+      clear();
+      _qId  = q.identity();
+      _qGen = q.generation();
+    }
+    /**
+     * Clear all caches
+     */
+    void clear()
+    {
+      std::fill(denOk.begin(), denOk.end(), false);
+      cacheN    = 0;
+      cacheNext = 0;
+      memo.clear();
+    }
+    /**
+     * Look up a result calculated earlier by @a c for the current
+     * Q-vector content.
+     *
+     * @param c Correlator that calculated the result
+     * @param n How many particles to correlate
+     * @param h Harmonics
+     * @param r On return, the cached result if found
+     *
+     * @return true if found
+     */
+    bool lookup(const void* c, const Size n, const HarmonicVector& h,
+		Result& r) const
+    {
+      for (CacheVector::const_iterator i = cache.begin();
+	   i != cache.begin() + cacheN; ++i) {
+	if (i->c != c || i->h.size() != n || !std::equal(h.begin(), h.begin() + n,
+					    i->h.begin())) continue;
+	r = i->r;
+	return true;
+      }
+      return false;
+    }
+    /**
+     * Remember a result calculated by @a c for the current Q-vector
+     * content.  At most kCacheSize results are kept.  Entries are
+     * reused, so once all have been used nothing is allocated.
+     *
+     * @param c Correlator that calculated the result
+     * @param n How many particles to correlate
+     * @param h Harmonics
+     * @param r Result
+     */
+    void remember(const void* c, const Size n, const HarmonicVector& h,
+		  const Result& r)
+    {
+      if (cache.size() <= cacheNext) cache.push_back(Cached());
+      Cached& e = cache[cacheNext];
+      e.c       = c;
+      e.h.assign(h.begin(), h.begin() + n);
+      e.r       = r;
+      cacheNext = (cacheNext + 1) % kCacheSize;
+      if (cacheN < size_t(kCacheSize)) cacheN++;
+    }
+    /** A cached result */
+    struct Cached
+    {
+      Cached() : c(0), h(), r() {}
+      /** @param o Object to copy from */
+      Cached(const Cached& o) : c(o.c), h(o.h), r(o.r) {}
+      /** @param o Object to assign from  @return Reference to this */
+      Cached& operator=(const Cached& o)
+      {
+	c = o.c;
+	h = o.h;
+	r = o.r;
+	return *this;
+      }
+      const void*    c; /**< Correlator */
+      HarmonicVector h; /**< Harmonics */
+      Result         r; /**< Result */
+    };
+    /** Type of cached results */
+    typedef std::vector<Cached> CacheVector;
+    /** All zero harmonics */
+    HarmonicVector    null;
+    /** Harmonics of fixed size calculations passed on as a vector */
+    HarmonicVector    args;
+    /** Harmonics given to Correlator::calculate as separate arguments */
+    HarmonicVector    given;
+    /** Cached denominators */
+    RealVector        den;
+    /** Which denominators are valid */
+    std::vector<bool> denOk;
+    /** Cached results */
+    CacheVector       cache;
+    /** Number of valid cached results */
+    size_t            cacheN;
+    /** Next cache entry to overwrite */
+    size_t            cacheNext;
+    /** Memo of intermediate results of recursions */
+    Memo              memo;
+    /** Tables of the recurrence */
+    Combinations      comb;
+    /** Work buffer of term counts */
+    SizeVector        cnt;
+    /** Work buffer of harmonics */
+    HarmonicVector    hh;
+    /** Work buffer of complex values */
+    PlainVector       z;
+    /** Work buffer of real values */
+    RealVector        r;
+    /** Work buffer of indices */
+    IndexVector       idx;
+  protected:
+    /** Identifier of Q-vector the caches refer to */
+    unsigned long     _qId;
+    /** Generation of Q-vector the caches refer to */
+    unsigned long     _qGen;
+  };
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
@@ -0,0 +1,46 @@
+// Generated by print -t closed -- do not edit
+#ifndef CORRELATIONS_CLOSED_EXPAND1_HH
+#define CORRELATIONS_CLOSED_EXPAND1_HH
+/**
+ * @file   correlations/closed/Expand1.hh
+ *
+ * @brief  Closed-form expression of the 1 particle correlator
+ *
+ * Generated by @c print @c -t @c closed.  Include this through
+ * correlations/Kernels.hh.
+ */
+#include <correlations/QVector.hh>
+
+namespace correlations {
+  namespace closed {
+    /** Part 0 of expand1 */
+    inline void
+    expand1Part0(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[1] =
+	Qr[1];
+      Ci[1] =
+	Qi[1];
+    }
+
+    /**
+     * @param q Q-vector
+     * @param h Harmonics (at least 1)
+     *
+     * @return @f$ QC\{1\}@f$
+     */
+    CORRELATIONS_KERNEL Complex expand1(const QVector& q, const Harmonic* h)
+    {
+      Real    Qr[2], Qi[2];
+      Real    Cr[2], Ci[2];
+      Complex z;
+      z = q(h[0], 1); Qr[1] = z.real(); Qi[1] = z.imag();
+      expand1Part0(Qr, Qi, Cr, Ci);
+      return Complex(Cr[1], Ci[1]);
+    }
+  }
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
@@ -0,0 +1,59 @@
+// Generated by print -t closed -- do not edit
+#ifndef CORRELATIONS_CLOSED_EXPAND2_HH
+#define CORRELATIONS_CLOSED_EXPAND2_HH
+/**
+ * @file   correlations/closed/Expand2.hh
+ *
+ * @brief  Closed-form expression of the 2 particle correlator
+ *
+ * Generated by @c print @c -t @c closed.  Include this through
+ * correlations/Kernels.hh.
+ */
+#include <correlations/QVector.hh>
+
+namespace correlations {
+  namespace closed {
+    /** Part 0 of expand2 */
+    inline void
+    expand2Part0(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[2] =
+	Qr[2];
+      Ci[2] =
+	Qi[2];
+
+      Cr[3] =
+	Qr[3];
+      Ci[3] =
+	Qi[3];
+      Cr[3] =
+	Qr[1] * Cr[2] - Qi[1] * Ci[2]
+	- Cr[3];
+      Ci[3] =
+	Qr[1] * Ci[2] + Qi[1] * Cr[2]
+	- Ci[3];
+    }
+
+    /**
+     * @param q Q-vector
+     * @param h Harmonics (at least 2)
+     *
+     * @return @f$ QC\{2\}@f$
+     */
+    CORRELATIONS_KERNEL Complex expand2(const QVector& q, const Harmonic* h)
+    {
+      Real    Qr[4], Qi[4];
+      Real    Cr[4], Ci[4];
+      Complex z;
+      z = q(h[0], 1); Qr[1] = z.real(); Qi[1] = z.imag();
+      z = q(h[1], 1); Qr[2] = z.real(); Qi[2] = z.imag();
+      z = q(h[0]+h[1], 2); Qr[3] = z.real(); Qi[3] = z.imag();
+      expand2Part0(Qr, Qi, Cr, Ci);
+      return Complex(Cr[3], Ci[3]);
+    }
+  }
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
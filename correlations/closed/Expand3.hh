@@ -0,0 +1,87 @@
+// Generated by print -t closed -- do not edit
+#ifndef CORRELATIONS_CLOSED_EXPAND3_HH
+#define CORRELATIONS_CLOSED_EXPAND3_HH
+/**
+ * @file   correlations/closed/Expand3.hh
+ *
+ * @brief  Closed-form expression of the 3 particle correlator
+ *
+ * Generated by @c print @c -t @c closed.  Include this through
+ * correlations/Kernels.hh.
+ */
+#include <correlations/QVector.hh>
+
+namespace correlations {
+  namespace closed {
+    /** Part 0 of expand3 */
+    inline void
+    expand3Part0(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[2] =
+	Qr[2];
+      Ci[2] =
+	Qi[2];
+
+      Cr[4] =
+	Qr[4];
+      Ci[4] =
+	Qi[4];
+
+      Cr[6] =
+	Qr[6];
+      Ci[6] =
+	Qi[6];
+      Cr[6] =
+	Qr[2] * Cr[4] - Qi[2] * Ci[4]
+	- Cr[6];
+      Ci[6] =
+	Qr[2] * Ci[4] + Qi[2] * Cr[4]
+	- Ci[6];
+
+      Cr[7] =
+	Qr[7];
+      Ci[7] =
+	Qi[7];
+      Cr[7] =
+	Qr[5] * Cr[2] - Qi[5] * Ci[2]
+	+ Qr[3] * Cr[4] - Qi[3] * Ci[4]
+	- 2. * Cr[7];
+      Ci[7] =
+	Qr[5] * Ci[2] + Qi[5] * Cr[2]
+	+ Qr[3] * Ci[4] + Qi[3] * Cr[4]
+	- 2. * Ci[7];
+      Cr[7] =
+	Qr[1] * Cr[6] - Qi[1] * Ci[6]
+	- Cr[7];
+      Ci[7] =
+	Qr[1] * Ci[6] + Qi[1] * Cr[6]
+	- Ci[7];
+    }
+
+    /**
+     * @param q Q-vector
+     * @param h Harmonics (at least 3)
+     *
+     * @return @f$ QC\{3\}@f$
+     */
+    CORRELATIONS_KERNEL Complex expand3(const QVector& q, const Harmonic* h)
+    {
+      Real    Qr[8], Qi[8];
+      Real    Cr[8], Ci[8];
+      Complex z;
+      z = q(h[0], 1); Qr[1] = z.real(); Qi[1] = z.imag();
+      z = q(h[1], 1); Qr[2] = z.real(); Qi[2] = z.imag();
+      z = q(h[0]+h[1], 2); Qr[3] = z.real(); Qi[3] = z.imag();
+      z = q(h[2], 1); Qr[4] = z.real(); Qi[4] = z.imag();
+      z = q(h[0]+h[2], 2); Qr[5] = z.real(); Qi[5] = z.imag();
+      z = q(h[1]+h[2], 2); Qr[6] = z.real(); Qi[6] = z.imag();
+      z = q(h[0]+h[1]+h[2], 3); Qr[7] = z.real(); Qi[7] = z.imag();
+      expand3Part0(Qr, Qi, Cr, Ci);
+      return Complex(Cr[7], Ci[7]);
+    }
+  }
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
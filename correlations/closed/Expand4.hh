@@ -0,0 +1,153 @@
+// Generated by print -t closed -- do not edit
+#ifndef CORRELATIONS_CLOSED_EXPAND4_HH
+#define CORRELATIONS_CLOSED_EXPAND4_HH
+/**
+ * @file   correlations/closed/Expand4.hh
+ *
+ * @brief  Closed-form expression of the 4 particle correlator
+ *
+ * Generated by @c print @c -t @c closed.  Include this through
+ * correlations/Kernels.hh.
+ */
+#include <correlations/QVector.hh>
+
+namespace correlations {
+  namespace closed {
+    /** Part 0 of expand4 */
+    inline void
+    expand4Part0(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[2] =
+	Qr[2];
+      Ci[2] =
+	Qi[2];
+
+      Cr[4] =
+	Qr[4];
+      Ci[4] =
+	Qi[4];
+
+      Cr[6] =
+	Qr[6];
+      Ci[6] =
+	Qi[6];
+      Cr[6] =
+	Qr[2] * Cr[4] - Qi[2] * Ci[4]
+	- Cr[6];
+      Ci[6] =
+	Qr[2] * Ci[4] + Qi[2] * Cr[4]
+	- Ci[6];
+
+      Cr[8] =
+	Qr[8];
+      Ci[8] =
+	Qi[8];
+
+      Cr[10] =
+	Qr[10];
+      Ci[10] =
+	Qi[10];
+      Cr[10] =
+	Qr[2] * Cr[8] - Qi[2] * Ci[8]
+	- Cr[10];
+      Ci[10] =
+	Qr[2] * Ci[8] + Qi[2] * Cr[8]
+	- Ci[10];
+
+      Cr[12] =
+	Qr[12];
+      Ci[12] =
+	Qi[12];
+      Cr[12] =
+	Qr[4] * Cr[8] - Qi[4] * Ci[8]
+	- Cr[12];
+      Ci[12] =
+	Qr[4] * Ci[8] + Qi[4] * Cr[8]
+	- Ci[12];
+
+      Cr[14] =
+	Qr[14];
+      Ci[14] =
+	Qi[14];
+      Cr[14] =
+	Qr[10] * Cr[4] - Qi[10] * Ci[4]
+	+ Qr[6] * Cr[8] - Qi[6] * Ci[8]
+	- 2. * Cr[14];
+      Ci[14] =
+	Qr[10] * Ci[4] + Qi[10] * Cr[4]
+	+ Qr[6] * Ci[8] + Qi[6] * Cr[8]
+	- 2. * Ci[14];
+      Cr[14] =
+	Qr[2] * Cr[12] - Qi[2] * Ci[12]
+	- Cr[14];
+      Ci[14] =
+	Qr[2] * Ci[12] + Qi[2] * Cr[12]
+	- Ci[14];
+
+      Cr[15] =
+	Qr[15];
+      Ci[15] =
+	Qi[15];
+      Cr[15] =
+	Qr[13] * Cr[2] - Qi[13] * Ci[2]
+	+ Qr[11] * Cr[4] - Qi[11] * Ci[4]
+	+ Qr[7] * Cr[8] - Qi[7] * Ci[8]
+	- 3. * Cr[15];
+      Ci[15] =
+	Qr[13] * Ci[2] + Qi[13] * Cr[2]
+	+ Qr[11] * Ci[4] + Qi[11] * Cr[4]
+	+ Qr[7] * Ci[8] + Qi[7] * Cr[8]
+	- 3. * Ci[15];
+      Cr[15] =
+	Qr[9] * Cr[6] - Qi[9] * Ci[6]
+	+ Qr[5] * Cr[10] - Qi[5] * Ci[10]
+	+ Qr[3] * Cr[12] - Qi[3] * Ci[12]
+	- 2. * Cr[15];
+      Ci[15] =
+	Qr[9] * Ci[6] + Qi[9] * Cr[6]
+	+ Qr[5] * Ci[10] + Qi[5] * Cr[10]
+	+ Qr[3] * Ci[12] + Qi[3] * Cr[12]
+	- 2. * Ci[15];
+      Cr[15] =
+	Qr[1] * Cr[14] - Qi[1] * Ci[14]
+	- Cr[15];
+      Ci[15] =
+	Qr[1] * Ci[14] + Qi[1] * Cr[14]
+	- Ci[15];
+    }
+
+    /**
+     * @param q Q-vector
+     * @param h Harmonics (at least 4)
+     *
+     * @return @f$ QC\{4\}@f$
+     */
+    CORRELATIONS_KERNEL Complex expand4(const QVector& q, const Harmonic* h)
+    {
+      Real    Qr[16], Qi[16];
+      Real    Cr[16], Ci[16];
+      Complex z;
+      z = q(h[0], 1); Qr[1] = z.real(); Qi[1] = z.imag();
+      z = q(h[1], 1); Qr[2] = z.real(); Qi[2] = z.imag();
+      z = q(h[0]+h[1], 2); Qr[3] = z.real(); Qi[3] = z.imag();
+      z = q(h[2], 1); Qr[4] = z.real(); Qi[4] = z.imag();
+      z = q(h[0]+h[2], 2); Qr[5] = z.real(); Qi[5] = z.imag();
+      z = q(h[1]+h[2], 2); Qr[6] = z.real(); Qi[6] = z.imag();
+      z = q(h[0]+h[1]+h[2], 3); Qr[7] = z.real(); Qi[7] = z.imag();
+      z = q(h[3], 1); Qr[8] = z.real(); Qi[8] = z.imag();
+      z = q(h[0]+h[3], 2); Qr[9] = z.real(); Qi[9] = z.imag();
+      z = q(h[1]+h[3], 2); Qr[10] = z.real(); Qi[10] = z.imag();
+      z = q(h[0]+h[1]+h[3], 3); Qr[11] = z.real(); Qi[11] = z.imag();
+      z = q(h[2]+h[3], 2); Qr[12] = z.real(); Qi[12] = z.imag();
+      z = q(h[0]+h[2]+h[3], 3); Qr[13] = z.real(); Qi[13] = z.imag();
+      z = q(h[1]+h[2]+h[3], 3); Qr[14] = z.real(); Qi[14] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3], 4); Qr[15] = z.real(); Qi[15] = z.imag();
+      expand4Part0(Qr, Qi, Cr, Ci);
+      return Complex(Cr[15], Ci[15]);
+    }
+  }
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
@@ -0,0 +1,315 @@
+// Generated by print -t closed -- do not edit
+#ifndef CORRELATIONS_CLOSED_EXPAND5_HH
+#define CORRELATIONS_CLOSED_EXPAND5_HH
+/**
+ * @file   correlations/closed/Expand5.hh
+ *
+ * @brief  Closed-form expression of the 5 particle correlator
+ *
+ * Generated by @c print @c -t @c closed.  Include this through
+ * correlations/Kernels.hh.
+ */
+#include <correlations/QVector.hh>
+
+namespace correlations {
+  namespace closed {
+    /** Part 0 of expand5 */
+    inline void
+    expand5Part0(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[2] =
+	Qr[2];
+      Ci[2] =
+	Qi[2];
+
+      Cr[4] =
+	Qr[4];
+      Ci[4] =
+	Qi[4];
+
+      Cr[6] =
+	Qr[6];
+      Ci[6] =
+	Qi[6];
+      Cr[6] =
+	Qr[2] * Cr[4] - Qi[2] * Ci[4]
+	- Cr[6];
+      Ci[6] =
+	Qr[2] * Ci[4] + Qi[2] * Cr[4]
+	- Ci[6];
+
+      Cr[8] =
+	Qr[8];
+      Ci[8] =
+	Qi[8];
+
+      Cr[10] =
+	Qr[10];
+      Ci[10] =
+	Qi[10];
+      Cr[10] =
+	Qr[2] * Cr[8] - Qi[2] * Ci[8]
+	- Cr[10];
+      Ci[10] =
+	Qr[2] * Ci[8] + Qi[2] * Cr[8]
+	- Ci[10];
+
+      Cr[12] =
+	Qr[12];
+      Ci[12] =
+	Qi[12];
+      Cr[12] =
+	Qr[4] * Cr[8] - Qi[4] * Ci[8]
+	- Cr[12];
+      Ci[12] =
+	Qr[4] * Ci[8] + Qi[4] * Cr[8]
+	- Ci[12];
+
+      Cr[14] =
+	Qr[14];
+      Ci[14] =
+	Qi[14];
+      Cr[14] =
+	Qr[10] * Cr[4] - Qi[10] * Ci[4]
+	+ Qr[6] * Cr[8] - Qi[6] * Ci[8]
+	- 2. * Cr[14];
+      Ci[14] =
+	Qr[10] * Ci[4] + Qi[10] * Cr[4]
+	+ Qr[6] * Ci[8] + Qi[6] * Cr[8]
+	- 2. * Ci[14];
+      Cr[14] =
+	Qr[2] * Cr[12] - Qi[2] * Ci[12]
+	- Cr[14];
+      Ci[14] =
+	Qr[2] * Ci[12] + Qi[2] * Cr[12]
+	- Ci[14];
+
+      Cr[16] =
+	Qr[16];
+      Ci[16] =
+	Qi[16];
+
+      Cr[18] =
+	Qr[18];
+      Ci[18] =
+	Qi[18];
+      Cr[18] =
+	Qr[2] * Cr[16] - Qi[2] * Ci[16]
+	- Cr[18];
+      Ci[18] =
+	Qr[2] * Ci[16] + Qi[2] * Cr[16]
+	- Ci[18];
+
+      Cr[20] =
+	Qr[20];
+      Ci[20] =
+	Qi[20];
+      Cr[20] =
+	Qr[4] * Cr[16] - Qi[4] * Ci[16]
+	- Cr[20];
+      Ci[20] =
+	Qr[4] * Ci[16] + Qi[4] * Cr[16]
+	- Ci[20];
+
+      Cr[22] =
+	Qr[22];
+      Ci[22] =
+	Qi[22];
+      Cr[22] =
+	Qr[18] * Cr[4] - Qi[18] * Ci[4]
+	+ Qr[6] * Cr[16] - Qi[6] * Ci[16]
+	- 2. * Cr[22];
+      Ci[22] =
+	Qr[18] * Ci[4] + Qi[18] * Cr[4]
+	+ Qr[6] * Ci[16] + Qi[6] * Cr[16]
+	- 2. * Ci[22];
+      Cr[22] =
+	Qr[2] * Cr[20] - Qi[2] * Ci[20]
+	- Cr[22];
+      Ci[22] =
+	Qr[2] * Ci[20] + Qi[2] * Cr[20]
+	- Ci[22];
+
+      Cr[24] =
+	Qr[24];
+      Ci[24] =
+	Qi[24];
+      Cr[24] =
+	Qr[8] * Cr[16] - Qi[8] * Ci[16]
+	- Cr[24];
+      Ci[24] =
+	Qr[8] * Ci[16] + Qi[8] * Cr[16]
+	- Ci[24];
+
+      Cr[26] =
+	Qr[26];
+      Ci[26] =
+	Qi[26];
+      Cr[26] =
+	Qr[18] * Cr[8] - Qi[18] * Ci[8]
+	+ Qr[10] * Cr[16] - Qi[10] * Ci[16]
+	- 2. * Cr[26];
+      Ci[26] =
+	Qr[18] * Ci[8] + Qi[18] * Cr[8]
+	+ Qr[10] * Ci[16] + Qi[10] * Cr[16]
+	- 2. * Ci[26];
+      Cr[26] =
+	Qr[2] * Cr[24] - Qi[2] * Ci[24]
+	- Cr[26];
+      Ci[26] =
+	Qr[2] * Ci[24] + Qi[2] * Cr[24]
+	- Ci[26];
+
+      Cr[28] =
+	Qr[28];
+      Ci[28] =
+	Qi[28];
+      Cr[28] =
+	Qr[20] * Cr[8] - Qi[20] * Ci[8]
+	+ Qr[12] * Cr[16] - Qi[12] * Ci[16]
+	- 2. * Cr[28];
+      Ci[28] =
+	Qr[20] * Ci[8] + Qi[20] * Cr[8]
+	+ Qr[12] * Ci[16] + Qi[12] * Cr[16]
+	- 2. * Ci[28];
+      Cr[28] =
+	Qr[4] * Cr[24] - Qi[4] * Ci[24]
+	- Cr[28];
+      Ci[28] =
+	Qr[4] * Ci[24] + Qi[4] * Cr[24]
+	- Ci[28];
+
+      Cr[30] =
+	Qr[30];
+      Ci[30] =
+	Qi[30];
+      Cr[30] =
+	Qr[26] * Cr[4] - Qi[26] * Ci[4]
+	+ Qr[22] * Cr[8] - Qi[22] * Ci[8]
+	+ Qr[14] * Cr[16] - Qi[14] * Ci[16]
+	- 3. * Cr[30];
+      Ci[30] =
+	Qr[26] * Ci[4] + Qi[26] * Cr[4]
+	+ Qr[22] * Ci[8] + Qi[22] * Cr[8]
+	+ Qr[14] * Ci[16] + Qi[14] * Cr[16]
+	- 3. * Ci[30];
+      Cr[30] =
+	Qr[18] * Cr[12] - Qi[18] * Ci[12]
+	+ Qr[10] * Cr[20] - Qi[10] * Ci[20]
+	+ Qr[6] * Cr[24] - Qi[6] * Ci[24]
+	- 2. * Cr[30];
+      Ci[30] =
+	Qr[18] * Ci[12] + Qi[18] * Cr[12]
+	+ Qr[10] * Ci[20] + Qi[10] * Cr[20]
+	+ Qr[6] * Ci[24] + Qi[6] * Cr[24]
+	- 2. * Ci[30];
+      Cr[30] =
+	Qr[2] * Cr[28] - Qi[2] * Ci[28]
+	- Cr[30];
+      Ci[30] =
+	Qr[2] * Ci[28] + Qi[2] * Cr[28]
+	- Ci[30];
+
+      Cr[31] =
+	Qr[31];
+      Ci[31] =
+	Qi[31];
+      Cr[31] =
+	Qr[29] * Cr[2] - Qi[29] * Ci[2]
+	+ Qr[27] * Cr[4] - Qi[27] * Ci[4]
+	+ Qr[23] * Cr[8] - Qi[23] * Ci[8]
+	+ Qr[15] * Cr[16] - Qi[15] * Ci[16]
+	- 4. * Cr[31];
+      Ci[31] =
+	Qr[29] * Ci[2] + Qi[29] * Cr[2]
+	+ Qr[27] * Ci[4] + Qi[27] * Cr[4]
+	+ Qr[23] * Ci[8] + Qi[23] * Cr[8]
+	+ Qr[15] * Ci[16] + Qi[15] * Cr[16]
+	- 4. * Ci[31];
+      Cr[31] =
+	Qr[25] * Cr[6] - Qi[25] * Ci[6]
+	+ Qr[21] * Cr[10] - Qi[21] * Ci[10]
+	+ Qr[19] * Cr[12] - Qi[19] * Ci[12]
+	+ Qr[13] * Cr[18] - Qi[13] * Ci[18]
+	+ Qr[11] * Cr[20] - Qi[11] * Ci[20]
+	+ Qr[7] * Cr[24] - Qi[7] * Ci[24]
+	- 3. * Cr[31];
+      Ci[31] =
+	Qr[25] * Ci[6] + Qi[25] * Cr[6]
+	+ Qr[21] * Ci[10] + Qi[21] * Cr[10]
+	+ Qr[19] * Ci[12] + Qi[19] * Cr[12]
+	+ Qr[13] * Ci[18] + Qi[13] * Cr[18]
+	+ Qr[11] * Ci[20] + Qi[11] * Cr[20]
+	+ Qr[7] * Ci[24] + Qi[7] * Cr[24]
+	- 3. * Ci[31];
+      Cr[31] =
+	Qr[17] * Cr[14] - Qi[17] * Ci[14]
+	+ Qr[9] * Cr[22] - Qi[9] * Ci[22]
+	+ Qr[5] * Cr[26] - Qi[5] * Ci[26]
+	+ Qr[3] * Cr[28] - Qi[3] * Ci[28]
+	- 2. * Cr[31];
+      Ci[31] =
+	Qr[17] * Ci[14] + Qi[17] * Cr[14]
+	+ Qr[9] * Ci[22] + Qi[9] * Cr[22]
+	+ Qr[5] * Ci[26] + Qi[5] * Cr[26]
+	+ Qr[3] * Ci[28] + Qi[3] * Cr[28]
+	- 2. * Ci[31];
+      Cr[31] =
+	Qr[1] * Cr[30] - Qi[1] * Ci[30]
+	- Cr[31];
+      Ci[31] =
+	Qr[1] * Ci[30] + Qi[1] * Cr[30]
+	- Ci[31];
+    }
+
+    /**
+     * @param q Q-vector
+     * @param h Harmonics (at least 5)
+     *
+     * @return @f$ QC\{5\}@f$
+     */
+    CORRELATIONS_KERNEL Complex expand5(const QVector& q, const Harmonic* h)
+    {
+      Real    Qr[32], Qi[32];
+      Real    Cr[32], Ci[32];
+      Complex z;
+      z = q(h[0], 1); Qr[1] = z.real(); Qi[1] = z.imag();
+      z = q(h[1], 1); Qr[2] = z.real(); Qi[2] = z.imag();
+      z = q(h[0]+h[1], 2); Qr[3] = z.real(); Qi[3] = z.imag();
+      z = q(h[2], 1); Qr[4] = z.real(); Qi[4] = z.imag();
+      z = q(h[0]+h[2], 2); Qr[5] = z.real(); Qi[5] = z.imag();
+      z = q(h[1]+h[2], 2); Qr[6] = z.real(); Qi[6] = z.imag();
+      z = q(h[0]+h[1]+h[2], 3); Qr[7] = z.real(); Qi[7] = z.imag();
+      z = q(h[3], 1); Qr[8] = z.real(); Qi[8] = z.imag();
+      z = q(h[0]+h[3], 2); Qr[9] = z.real(); Qi[9] = z.imag();
+      z = q(h[1]+h[3], 2); Qr[10] = z.real(); Qi[10] = z.imag();
+      z = q(h[0]+h[1]+h[3], 3); Qr[11] = z.real(); Qi[11] = z.imag();
+      z = q(h[2]+h[3], 2); Qr[12] = z.real(); Qi[12] = z.imag();
+      z = q(h[0]+h[2]+h[3], 3); Qr[13] = z.real(); Qi[13] = z.imag();
+      z = q(h[1]+h[2]+h[3], 3); Qr[14] = z.real(); Qi[14] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3], 4); Qr[15] = z.real(); Qi[15] = z.imag();
+      z = q(h[4], 1); Qr[16] = z.real(); Qi[16] = z.imag();
+      z = q(h[0]+h[4], 2); Qr[17] = z.real(); Qi[17] = z.imag();
+      z = q(h[1]+h[4], 2); Qr[18] = z.real(); Qi[18] = z.imag();
+      z = q(h[0]+h[1]+h[4], 3); Qr[19] = z.real(); Qi[19] = z.imag();
+      z = q(h[2]+h[4], 2); Qr[20] = z.real(); Qi[20] = z.imag();
+      z = q(h[0]+h[2]+h[4], 3); Qr[21] = z.real(); Qi[21] = z.imag();
+      z = q(h[1]+h[2]+h[4], 3); Qr[22] = z.real(); Qi[22] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4], 4); Qr[23] = z.real(); Qi[23] = z.imag();
+      z = q(h[3]+h[4], 2); Qr[24] = z.real(); Qi[24] = z.imag();
+      z = q(h[0]+h[3]+h[4], 3); Qr[25] = z.real(); Qi[25] = z.imag();
+      z = q(h[1]+h[3]+h[4], 3); Qr[26] = z.real(); Qi[26] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4], 4); Qr[27] = z.real(); Qi[27] = z.imag();
+      z = q(h[2]+h[3]+h[4], 3); Qr[28] = z.real(); Qi[28] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4], 4); Qr[29] = z.real(); Qi[29] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4], 4); Qr[30] = z.real(); Qi[30] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4], 5); Qr[31] = z.real(); Qi[31] = z.imag();
+      expand5Part0(Qr, Qi, Cr, Ci);
+      return Complex(Cr[31], Ci[31]);
+    }
+  }
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
@@ -0,0 +1,721 @@
+// Generated by print -t closed -- do not edit
+#ifndef CORRELATIONS_CLOSED_EXPAND6_HH
+#define CORRELATIONS_CLOSED_EXPAND6_HH
+/**
+ * @file   correlations/closed/Expand6.hh
+ *
+ * @brief  Closed-form expression of the 6 particle correlator
+ *
+ * Generated by @c print @c -t @c closed.  Include this through
+ * correlations/Kernels.hh.
+ */
+#include <correlations/QVector.hh>
+
+namespace correlations {
+  namespace closed {
+    /** Part 0 of expand6 */
+    inline void
+    expand6Part0(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[2] =
+	Qr[2];
+      Ci[2] =
+	Qi[2];
+
+      Cr[4] =
+	Qr[4];
+      Ci[4] =
+	Qi[4];
+
+      Cr[6] =
+	Qr[6];
+      Ci[6] =
+	Qi[6];
+      Cr[6] =
+	Qr[2] * Cr[4] - Qi[2] * Ci[4]
+	- Cr[6];
+      Ci[6] =
+	Qr[2] * Ci[4] + Qi[2] * Cr[4]
+	- Ci[6];
+
+      Cr[8] =
+	Qr[8];
+      Ci[8] =
+	Qi[8];
+
+      Cr[10] =
+	Qr[10];
+      Ci[10] =
+	Qi[10];
+      Cr[10] =
+	Qr[2] * Cr[8] - Qi[2] * Ci[8]
+	- Cr[10];
+      Ci[10] =
+	Qr[2] * Ci[8] + Qi[2] * Cr[8]
+	- Ci[10];
+
+      Cr[12] =
+	Qr[12];
+      Ci[12] =
+	Qi[12];
+      Cr[12] =
+	Qr[4] * Cr[8] - Qi[4] * Ci[8]
+	- Cr[12];
+      Ci[12] =
+	Qr[4] * Ci[8] + Qi[4] * Cr[8]
+	- Ci[12];
+
+      Cr[14] =
+	Qr[14];
+      Ci[14] =
+	Qi[14];
+      Cr[14] =
+	Qr[10] * Cr[4] - Qi[10] * Ci[4]
+	+ Qr[6] * Cr[8] - Qi[6] * Ci[8]
+	- 2. * Cr[14];
+      Ci[14] =
+	Qr[10] * Ci[4] + Qi[10] * Cr[4]
+	+ Qr[6] * Ci[8] + Qi[6] * Cr[8]
+	- 2. * Ci[14];
+      Cr[14] =
+	Qr[2] * Cr[12] - Qi[2] * Ci[12]
+	- Cr[14];
+      Ci[14] =
+	Qr[2] * Ci[12] + Qi[2] * Cr[12]
+	- Ci[14];
+
+      Cr[16] =
+	Qr[16];
+      Ci[16] =
+	Qi[16];
+
+      Cr[18] =
+	Qr[18];
+      Ci[18] =
+	Qi[18];
+      Cr[18] =
+	Qr[2] * Cr[16] - Qi[2] * Ci[16]
+	- Cr[18];
+      Ci[18] =
+	Qr[2] * Ci[16] + Qi[2] * Cr[16]
+	- Ci[18];
+
+      Cr[20] =
+	Qr[20];
+      Ci[20] =
+	Qi[20];
+      Cr[20] =
+	Qr[4] * Cr[16] - Qi[4] * Ci[16]
+	- Cr[20];
+      Ci[20] =
+	Qr[4] * Ci[16] + Qi[4] * Cr[16]
+	- Ci[20];
+
+      Cr[22] =
+	Qr[22];
+      Ci[22] =
+	Qi[22];
+      Cr[22] =
+	Qr[18] * Cr[4] - Qi[18] * Ci[4]
+	+ Qr[6] * Cr[16] - Qi[6] * Ci[16]
+	- 2. * Cr[22];
+      Ci[22] =
+	Qr[18] * Ci[4] + Qi[18] * Cr[4]
+	+ Qr[6] * Ci[16] + Qi[6] * Cr[16]
+	- 2. * Ci[22];
+      Cr[22] =
+	Qr[2] * Cr[20] - Qi[2] * Ci[20]
+	- Cr[22];
+      Ci[22] =
+	Qr[2] * Ci[20] + Qi[2] * Cr[20]
+	- Ci[22];
+
+      Cr[24] =
+	Qr[24];
+      Ci[24] =
+	Qi[24];
+      Cr[24] =
+	Qr[8] * Cr[16] - Qi[8] * Ci[16]
+	- Cr[24];
+      Ci[24] =
+	Qr[8] * Ci[16] + Qi[8] * Cr[16]
+	- Ci[24];
+
+      Cr[26] =
+	Qr[26];
+      Ci[26] =
+	Qi[26];
+      Cr[26] =
+	Qr[18] * Cr[8] - Qi[18] * Ci[8]
+	+ Qr[10] * Cr[16] - Qi[10] * Ci[16]
+	- 2. * Cr[26];
+      Ci[26] =
+	Qr[18] * Ci[8] + Qi[18] * Cr[8]
+	+ Qr[10] * Ci[16] + Qi[10] * Cr[16]
+	- 2. * Ci[26];
+      Cr[26] =
+	Qr[2] * Cr[24] - Qi[2] * Ci[24]
+	- Cr[26];
+      Ci[26] =
+	Qr[2] * Ci[24] + Qi[2] * Cr[24]
+	- Ci[26];
+
+      Cr[28] =
+	Qr[28];
+      Ci[28] =
+	Qi[28];
+      Cr[28] =
+	Qr[20] * Cr[8] - Qi[20] * Ci[8]
+	+ Qr[12] * Cr[16] - Qi[12] * Ci[16]
+	- 2. * Cr[28];
+      Ci[28] =
+	Qr[20] * Ci[8] + Qi[20] * Cr[8]
+	+ Qr[12] * Ci[16] + Qi[12] * Cr[16]
+	- 2. * Ci[28];
+      Cr[28] =
+	Qr[4] * Cr[24] - Qi[4] * Ci[24]
+	- Cr[28];
+      Ci[28] =
+	Qr[4] * Ci[24] + Qi[4] * Cr[24]
+	- Ci[28];
+
+      Cr[30] =
+	Qr[30];
+      Ci[30] =
+	Qi[30];
+      Cr[30] =
+	Qr[26] * Cr[4] - Qi[26] * Ci[4]
+	+ Qr[22] * Cr[8] - Qi[22] * Ci[8]
+	+ Qr[14] * Cr[16] - Qi[14] * Ci[16]
+	- 3. * Cr[30];
+      Ci[30] =
+	Qr[26] * Ci[4] + Qi[26] * Cr[4]
+	+ Qr[22] * Ci[8] + Qi[22] * Cr[8]
+	+ Qr[14] * Ci[16] + Qi[14] * Cr[16]
+	- 3. * Ci[30];
+      Cr[30] =
+	Qr[18] * Cr[12] - Qi[18] * Ci[12]
+	+ Qr[10] * Cr[20] - Qi[10] * Ci[20]
+	+ Qr[6] * Cr[24] - Qi[6] * Ci[24]
+	- 2. * Cr[30];
+      Ci[30] =
+	Qr[18] * Ci[12] + Qi[18] * Cr[12]
+	+ Qr[10] * Ci[20] + Qi[10] * Cr[20]
+	+ Qr[6] * Ci[24] + Qi[6] * Cr[24]
+	- 2. * Ci[30];
+      Cr[30] =
+	Qr[2] * Cr[28] - Qi[2] * Ci[28]
+	- Cr[30];
+      Ci[30] =
+	Qr[2] * Ci[28] + Qi[2] * Cr[28]
+	- Ci[30];
+
+      Cr[32] =
+	Qr[32];
+      Ci[32] =
+	Qi[32];
+
+      Cr[34] =
+	Qr[34];
+      Ci[34] =
+	Qi[34];
+      Cr[34] =
+	Qr[2] * Cr[32] - Qi[2] * Ci[32]
+	- Cr[34];
+      Ci[34] =
+	Qr[2] * Ci[32] + Qi[2] * Cr[32]
+	- Ci[34];
+
+      Cr[36] =
+	Qr[36];
+      Ci[36] =
+	Qi[36];
+      Cr[36] =
+	Qr[4] * Cr[32] - Qi[4] * Ci[32]
+	- Cr[36];
+      Ci[36] =
+	Qr[4] * Ci[32] + Qi[4] * Cr[32]
+	- Ci[36];
+
+      Cr[38] =
+	Qr[38];
+      Ci[38] =
+	Qi[38];
+      Cr[38] =
+	Qr[34] * Cr[4] - Qi[34] * Ci[4]
+	+ Qr[6] * Cr[32] - Qi[6] * Ci[32]
+	- 2. * Cr[38];
+      Ci[38] =
+	Qr[34] * Ci[4] + Qi[34] * Cr[4]
+	+ Qr[6] * Ci[32] + Qi[6] * Cr[32]
+	- 2. * Ci[38];
+      Cr[38] =
+	Qr[2] * Cr[36] - Qi[2] * Ci[36]
+	- Cr[38];
+      Ci[38] =
+	Qr[2] * Ci[36] + Qi[2] * Cr[36]
+	- Ci[38];
+
+      Cr[40] =
+	Qr[40];
+      Ci[40] =
+	Qi[40];
+      Cr[40] =
+	Qr[8] * Cr[32] - Qi[8] * Ci[32]
+	- Cr[40];
+      Ci[40] =
+	Qr[8] * Ci[32] + Qi[8] * Cr[32]
+	- Ci[40];
+
+      Cr[42] =
+	Qr[42];
+      Ci[42] =
+	Qi[42];
+      Cr[42] =
+	Qr[34] * Cr[8] - Qi[34] * Ci[8]
+	+ Qr[10] * Cr[32] - Qi[10] * Ci[32]
+	- 2. * Cr[42];
+      Ci[42] =
+	Qr[34] * Ci[8] + Qi[34] * Cr[8]
+	+ Qr[10] * Ci[32] + Qi[10] * Cr[32]
+	- 2. * Ci[42];
+      Cr[42] =
+	Qr[2] * Cr[40] - Qi[2] * Ci[40]
+	- Cr[42];
+      Ci[42] =
+	Qr[2] * Ci[40] + Qi[2] * Cr[40]
+	- Ci[42];
+
+      Cr[44] =
+	Qr[44];
+      Ci[44] =
+	Qi[44];
+      Cr[44] =
+	Qr[36] * Cr[8] - Qi[36] * Ci[8]
+	+ Qr[12] * Cr[32] - Qi[12] * Ci[32]
+	- 2. * Cr[44];
+      Ci[44] =
+	Qr[36] * Ci[8] + Qi[36] * Cr[8]
+	+ Qr[12] * Ci[32] + Qi[12] * Cr[32]
+	- 2. * Ci[44];
+      Cr[44] =
+	Qr[4] * Cr[40] - Qi[4] * Ci[40]
+	- Cr[44];
+      Ci[44] =
+	Qr[4] * Ci[40] + Qi[4] * Cr[40]
+	- Ci[44];
+
+      Cr[46] =
+	Qr[46];
+      Ci[46] =
+	Qi[46];
+      Cr[46] =
+	Qr[42] * Cr[4] - Qi[42] * Ci[4]
+	+ Qr[38] * Cr[8] - Qi[38] * Ci[8]
+	+ Qr[14] * Cr[32] - Qi[14] * Ci[32]
+	- 3. * Cr[46];
+      Ci[46] =
+	Qr[42] * Ci[4] + Qi[42] * Cr[4]
+	+ Qr[38] * Ci[8] + Qi[38] * Cr[8]
+	+ Qr[14] * Ci[32] + Qi[14] * Cr[32]
+	- 3. * Ci[46];
+      Cr[46] =
+	Qr[34] * Cr[12] - Qi[34] * Ci[12]
+	+ Qr[10] * Cr[36] - Qi[10] * Ci[36]
+	+ Qr[6] * Cr[40] - Qi[6] * Ci[40]
+	- 2. * Cr[46];
+      Ci[46] =
+	Qr[34] * Ci[12] + Qi[34] * Cr[12]
+	+ Qr[10] * Ci[36] + Qi[10] * Cr[36]
+	+ Qr[6] * Ci[40] + Qi[6] * Cr[40]
+	- 2. * Ci[46];
+      Cr[46] =
+	Qr[2] * Cr[44] - Qi[2] * Ci[44]
+	- Cr[46];
+      Ci[46] =
+	Qr[2] * Ci[44] + Qi[2] * Cr[44]
+	- Ci[46];
+
+      Cr[48] =
+	Qr[48];
+      Ci[48] =
+	Qi[48];
+      Cr[48] =
+	Qr[16] * Cr[32] - Qi[16] * Ci[32]
+	- Cr[48];
+      Ci[48] =
+	Qr[16] * Ci[32] + Qi[16] * Cr[32]
+	- Ci[48];
+
+      Cr[50] =
+	Qr[50];
+      Ci[50] =
+	Qi[50];
+      Cr[50] =
+	Qr[34] * Cr[16] - Qi[34] * Ci[16]
+	+ Qr[18] * Cr[32] - Qi[18] * Ci[32]
+	- 2. * Cr[50];
+      Ci[50] =
+	Qr[34] * Ci[16] + Qi[34] * Cr[16]
+	+ Qr[18] * Ci[32] + Qi[18] * Cr[32]
+	- 2. * Ci[50];
+      Cr[50] =
+	Qr[2] * Cr[48] - Qi[2] * Ci[48]
+	- Cr[50];
+      Ci[50] =
+	Qr[2] * Ci[48] + Qi[2] * Cr[48]
+	- Ci[50];
+
+      Cr[52] =
+	Qr[52];
+      Ci[52] =
+	Qi[52];
+      Cr[52] =
+	Qr[36] * Cr[16] - Qi[36] * Ci[16]
+	+ Qr[20] * Cr[32] - Qi[20] * Ci[32]
+	- 2. * Cr[52];
+      Ci[52] =
+	Qr[36] * Ci[16] + Qi[36] * Cr[16]
+	+ Qr[20] * Ci[32] + Qi[20] * Cr[32]
+	- 2. * Ci[52];
+      Cr[52] =
+	Qr[4] * Cr[48] - Qi[4] * Ci[48]
+	- Cr[52];
+      Ci[52] =
+	Qr[4] * Ci[48] + Qi[4] * Cr[48]
+	- Ci[52];
+
+      Cr[54] =
+	Qr[54];
+      Ci[54] =
+	Qi[54];
+      Cr[54] =
+	Qr[50] * Cr[4] - Qi[50] * Ci[4]
+	+ Qr[38] * Cr[16] - Qi[38] * Ci[16]
+	+ Qr[22] * Cr[32] - Qi[22] * Ci[32]
+	- 3. * Cr[54];
+      Ci[54] =
+	Qr[50] * Ci[4] + Qi[50] * Cr[4]
+	+ Qr[38] * Ci[16] + Qi[38] * Cr[16]
+	+ Qr[22] * Ci[32] + Qi[22] * Cr[32]
+	- 3. * Ci[54];
+      Cr[54] =
+	Qr[34] * Cr[20] - Qi[34] * Ci[20]
+	+ Qr[18] * Cr[36] - Qi[18] * Ci[36]
+	+ Qr[6] * Cr[48] - Qi[6] * Ci[48]
+	- 2. * Cr[54];
+      Ci[54] =
+	Qr[34] * Ci[20] + Qi[34] * Cr[20]
+	+ Qr[18] * Ci[36] + Qi[18] * Cr[36]
+	+ Qr[6] * Ci[48] + Qi[6] * Cr[48]
+	- 2. * Ci[54];
+      Cr[54] =
+	Qr[2] * Cr[52] - Qi[2] * Ci[52]
+	- Cr[54];
+      Ci[54] =
+	Qr[2] * Ci[52] + Qi[2] * Cr[52]
+	- Ci[54];
+
+      Cr[56] =
+	Qr[56];
+      Ci[56] =
+	Qi[56];
+      Cr[56] =
+	Qr[40] * Cr[16] - Qi[40] * Ci[16]
+	+ Qr[24] * Cr[32] - Qi[24] * Ci[32]
+	- 2. * Cr[56];
+      Ci[56] =
+	Qr[40] * Ci[16] + Qi[40] * Cr[16]
+	+ Qr[24] * Ci[32] + Qi[24] * Cr[32]
+	- 2. * Ci[56];
+      Cr[56] =
+	Qr[8] * Cr[48] - Qi[8] * Ci[48]
+	- Cr[56];
+      Ci[56] =
+	Qr[8] * Ci[48] + Qi[8] * Cr[48]
+	- Ci[56];
+
+      Cr[58] =
+	Qr[58];
+      Ci[58] =
+	Qi[58];
+      Cr[58] =
+	Qr[50] * Cr[8] - Qi[50] * Ci[8]
+	+ Qr[42] * Cr[16] - Qi[42] * Ci[16]
+	+ Qr[26] * Cr[32] - Qi[26] * Ci[32]
+	- 3. * Cr[58];
+      Ci[58] =
+	Qr[50] * Ci[8] + Qi[50] * Cr[8]
+	+ Qr[42] * Ci[16] + Qi[42] * Cr[16]
+	+ Qr[26] * Ci[32] + Qi[26] * Cr[32]
+	- 3. * Ci[58];
+      Cr[58] =
+	Qr[34] * Cr[24] - Qi[34] * Ci[24]
+	+ Qr[18] * Cr[40] - Qi[18] * Ci[40]
+	+ Qr[10] * Cr[48] - Qi[10] * Ci[48]
+	- 2. * Cr[58];
+      Ci[58] =
+	Qr[34] * Ci[24] + Qi[34] * Cr[24]
+	+ Qr[18] * Ci[40] + Qi[18] * Cr[40]
+	+ Qr[10] * Ci[48] + Qi[10] * Cr[48]
+	- 2. * Ci[58];
+      Cr[58] =
+	Qr[2] * Cr[56] - Qi[2] * Ci[56]
+	- Cr[58];
+      Ci[58] =
+	Qr[2] * Ci[56] + Qi[2] * Cr[56]
+	- Ci[58];
+
+      Cr[60] =
+	Qr[60];
+      Ci[60] =
+	Qi[60];
+      Cr[60] =
+	Qr[52] * Cr[8] - Qi[52] * Ci[8]
+	+ Qr[44] * Cr[16] - Qi[44] * Ci[16]
+	+ Qr[28] * Cr[32] - Qi[28] * Ci[32]
+	- 3. * Cr[60];
+      Ci[60] =
+	Qr[52] * Ci[8] + Qi[52] * Cr[8]
+	+ Qr[44] * Ci[16] + Qi[44] * Cr[16]
+	+ Qr[28] * Ci[32] + Qi[28] * Cr[32]
+	- 3. * Ci[60];
+      Cr[60] =
+	Qr[36] * Cr[24] - Qi[36] * Ci[24]
+	+ Qr[20] * Cr[40] - Qi[20] * Ci[40]
+	+ Qr[12] * Cr[48] - Qi[12] * Ci[48]
+	- 2. * Cr[60];
+      Ci[60] =
+	Qr[36] * Ci[24] + Qi[36] * Cr[24]
+	+ Qr[20] * Ci[40] + Qi[20] * Cr[40]
+	+ Qr[12] * Ci[48] + Qi[12] * Cr[48]
+	- 2. * Ci[60];
+      Cr[60] =
+	Qr[4] * Cr[56] - Qi[4] * Ci[56]
+	- Cr[60];
+      Ci[60] =
+	Qr[4] * Ci[56] + Qi[4] * Cr[56]
+	- Ci[60];
+
+      Cr[62] =
+	Qr[62];
+      Ci[62] =
+	Qi[62];
+      Cr[62] =
+	Qr[58] * Cr[4] - Qi[58] * Ci[4]
+	+ Qr[54] * Cr[8] - Qi[54] * Ci[8]
+	+ Qr[46] * Cr[16] - Qi[46] * Ci[16]
+	+ Qr[30] * Cr[32] - Qi[30] * Ci[32]
+	- 4. * Cr[62];
+      Ci[62] =
+	Qr[58] * Ci[4] + Qi[58] * Cr[4]
+	+ Qr[54] * Ci[8] + Qi[54] * Cr[8]
+	+ Qr[46] * Ci[16] + Qi[46] * Cr[16]
+	+ Qr[30] * Ci[32] + Qi[30] * Cr[32]
+	- 4. * Ci[62];
+      Cr[62] =
+	Qr[50] * Cr[12] - Qi[50] * Ci[12]
+	+ Qr[42] * Cr[20] - Qi[42] * Ci[20]
+	+ Qr[38] * Cr[24] - Qi[38] * Ci[24]
+	+ Qr[26] * Cr[36] - Qi[26] * Ci[36]
+	+ Qr[22] * Cr[40] - Qi[22] * Ci[40]
+	+ Qr[14] * Cr[48] - Qi[14] * Ci[48]
+	- 3. * Cr[62];
+      Ci[62] =
+	Qr[50] * Ci[12] + Qi[50] * Cr[12]
+	+ Qr[42] * Ci[20] + Qi[42] * Cr[20]
+	+ Qr[38] * Ci[24] + Qi[38] * Cr[24]
+	+ Qr[26] * Ci[36] + Qi[26] * Cr[36]
+	+ Qr[22] * Ci[40] + Qi[22] * Cr[40]
+	+ Qr[14] * Ci[48] + Qi[14] * Cr[48]
+	- 3. * Ci[62];
+      Cr[62] =
+	Qr[34] * Cr[28] - Qi[34] * Ci[28]
+	+ Qr[18] * Cr[44] - Qi[18] * Ci[44]
+	+ Qr[10] * Cr[52] - Qi[10] * Ci[52]
+	+ Qr[6] * Cr[56] - Qi[6] * Ci[56]
+	- 2. * Cr[62];
+      Ci[62] =
+	Qr[34] * Ci[28] + Qi[34] * Cr[28]
+	+ Qr[18] * Ci[44] + Qi[18] * Cr[44]
+	+ Qr[10] * Ci[52] + Qi[10] * Cr[52]
+	+ Qr[6] * Ci[56] + Qi[6] * Cr[56]
+	- 2. * Ci[62];
+      Cr[62] =
+	Qr[2] * Cr[60] - Qi[2] * Ci[60]
+	- Cr[62];
+      Ci[62] =
+	Qr[2] * Ci[60] + Qi[2] * Cr[60]
+	- Ci[62];
+
+      Cr[63] =
+	Qr[63];
+      Ci[63] =
+	Qi[63];
+      Cr[63] =
+	Qr[61] * Cr[2] - Qi[61] * Ci[2]
+	+ Qr[59] * Cr[4] - Qi[59] * Ci[4]
+	+ Qr[55] * Cr[8] - Qi[55] * Ci[8]
+	+ Qr[47] * Cr[16] - Qi[47] * Ci[16]
+	+ Qr[31] * Cr[32] - Qi[31] * Ci[32]
+	- 5. * Cr[63];
+      Ci[63] =
+	Qr[61] * Ci[2] + Qi[61] * Cr[2]
+	+ Qr[59] * Ci[4] + Qi[59] * Cr[4]
+	+ Qr[55] * Ci[8] + Qi[55] * Cr[8]
+	+ Qr[47] * Ci[16] + Qi[47] * Cr[16]
+	+ Qr[31] * Ci[32] + Qi[31] * Cr[32]
+	- 5. * Ci[63];
+      Cr[63] =
+	Qr[57] * Cr[6] - Qi[57] * Ci[6]
+	+ Qr[53] * Cr[10] - Qi[53] * Ci[10]
+	+ Qr[51] * Cr[12] - Qi[51] * Ci[12]
+	+ Qr[45] * Cr[18] - Qi[45] * Ci[18]
+	+ Qr[43] * Cr[20] - Qi[43] * Ci[20]
+	+ Qr[39] * Cr[24] - Qi[39] * Ci[24]
+	+ Qr[29] * Cr[34] - Qi[29] * Ci[34]
+	+ Qr[27] * Cr[36] - Qi[27] * Ci[36]
+	+ Qr[23] * Cr[40] - Qi[23] * Ci[40]
+	+ Qr[15] * Cr[48] - Qi[15] * Ci[48]
+	- 4. * Cr[63];
+      Ci[63] =
+	Qr[57] * Ci[6] + Qi[57] * Cr[6]
+	+ Qr[53] * Ci[10] + Qi[53] * Cr[10]
+	+ Qr[51] * Ci[12] + Qi[51] * Cr[12]
+	+ Qr[45] * Ci[18] + Qi[45] * Cr[18]
+	+ Qr[43] * Ci[20] + Qi[43] * Cr[20]
+	+ Qr[39] * Ci[24] + Qi[39] * Cr[24]
+	+ Qr[29] * Ci[34] + Qi[29] * Cr[34]
+	+ Qr[27] * Ci[36] + Qi[27] * Cr[36]
+	+ Qr[23] * Ci[40] + Qi[23] * Cr[40]
+	+ Qr[15] * Ci[48] + Qi[15] * Cr[48]
+	- 4. * Ci[63];
+      Cr[63] =
+	Qr[49] * Cr[14] - Qi[49] * Ci[14]
+	+ Qr[41] * Cr[22] - Qi[41] * Ci[22]
+	+ Qr[37] * Cr[26] - Qi[37] * Ci[26]
+	+ Qr[35] * Cr[28] - Qi[35] * Ci[28]
+	+ Qr[25] * Cr[38] - Qi[25] * Ci[38]
+	+ Qr[21] * Cr[42] - Qi[21] * Ci[42]
+	+ Qr[19] * Cr[44] - Qi[19] * Ci[44]
+	+ Qr[13] * Cr[50] - Qi[13] * Ci[50]
+	+ Qr[11] * Cr[52] - Qi[11] * Ci[52]
+	+ Qr[7] * Cr[56] - Qi[7] * Ci[56]
+	- 3. * Cr[63];
+      Ci[63] =
+	Qr[49] * Ci[14] + Qi[49] * Cr[14]
+	+ Qr[41] * Ci[22] + Qi[41] * Cr[22]
+	+ Qr[37] * Ci[26] + Qi[37] * Cr[26]
+	+ Qr[35] * Ci[28] + Qi[35] * Cr[28]
+	+ Qr[25] * Ci[38] + Qi[25] * Cr[38]
+	+ Qr[21] * Ci[42] + Qi[21] * Cr[42]
+	+ Qr[19] * Ci[44] + Qi[19] * Cr[44]
+	+ Qr[13] * Ci[50] + Qi[13] * Cr[50]
+	+ Qr[11] * Ci[52] + Qi[11] * Cr[52]
+	+ Qr[7] * Ci[56] + Qi[7] * Cr[56]
+	- 3. * Ci[63];
+      Cr[63] =
+	Qr[33] * Cr[30] - Qi[33] * Ci[30]
+	+ Qr[17] * Cr[46] - Qi[17] * Ci[46]
+	+ Qr[9] * Cr[54] - Qi[9] * Ci[54]
+	+ Qr[5] * Cr[58] - Qi[5] * Ci[58]
+	+ Qr[3] * Cr[60] - Qi[3] * Ci[60]
+	- 2. * Cr[63];
+      Ci[63] =
+	Qr[33] * Ci[30] + Qi[33] * Cr[30]
+	+ Qr[17] * Ci[46] + Qi[17] * Cr[46]
+	+ Qr[9] * Ci[54] + Qi[9] * Cr[54]
+	+ Qr[5] * Ci[58] + Qi[5] * Cr[58]
+	+ Qr[3] * Ci[60] + Qi[3] * Cr[60]
+	- 2. * Ci[63];
+      Cr[63] =
+	Qr[1] * Cr[62] - Qi[1] * Ci[62]
+	- Cr[63];
+      Ci[63] =
+	Qr[1] * Ci[62] + Qi[1] * Cr[62]
+	- Ci[63];
+    }
+
+    /**
+     * @param q Q-vector
+     * @param h Harmonics (at least 6)
+     *
+     * @return @f$ QC\{6\}@f$
+     */
+    CORRELATIONS_KERNEL Complex expand6(const QVector& q, const Harmonic* h)
+    {
+      Real    Qr[64], Qi[64];
+      Real    Cr[64], Ci[64];
+      Complex z;
+      z = q(h[0], 1); Qr[1] = z.real(); Qi[1] = z.imag();
+      z = q(h[1], 1); Qr[2] = z.real(); Qi[2] = z.imag();
+      z = q(h[0]+h[1], 2); Qr[3] = z.real(); Qi[3] = z.imag();
+      z = q(h[2], 1); Qr[4] = z.real(); Qi[4] = z.imag();
+      z = q(h[0]+h[2], 2); Qr[5] = z.real(); Qi[5] = z.imag();
+      z = q(h[1]+h[2], 2); Qr[6] = z.real(); Qi[6] = z.imag();
+      z = q(h[0]+h[1]+h[2], 3); Qr[7] = z.real(); Qi[7] = z.imag();
+      z = q(h[3], 1); Qr[8] = z.real(); Qi[8] = z.imag();
+      z = q(h[0]+h[3], 2); Qr[9] = z.real(); Qi[9] = z.imag();
+      z = q(h[1]+h[3], 2); Qr[10] = z.real(); Qi[10] = z.imag();
+      z = q(h[0]+h[1]+h[3], 3); Qr[11] = z.real(); Qi[11] = z.imag();
+      z = q(h[2]+h[3], 2); Qr[12] = z.real(); Qi[12] = z.imag();
+      z = q(h[0]+h[2]+h[3], 3); Qr[13] = z.real(); Qi[13] = z.imag();
+      z = q(h[1]+h[2]+h[3], 3); Qr[14] = z.real(); Qi[14] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3], 4); Qr[15] = z.real(); Qi[15] = z.imag();
+      z = q(h[4], 1); Qr[16] = z.real(); Qi[16] = z.imag();
+      z = q(h[0]+h[4], 2); Qr[17] = z.real(); Qi[17] = z.imag();
+      z = q(h[1]+h[4], 2); Qr[18] = z.real(); Qi[18] = z.imag();
+      z = q(h[0]+h[1]+h[4], 3); Qr[19] = z.real(); Qi[19] = z.imag();
+      z = q(h[2]+h[4], 2); Qr[20] = z.real(); Qi[20] = z.imag();
+      z = q(h[0]+h[2]+h[4], 3); Qr[21] = z.real(); Qi[21] = z.imag();
+      z = q(h[1]+h[2]+h[4], 3); Qr[22] = z.real(); Qi[22] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4], 4); Qr[23] = z.real(); Qi[23] = z.imag();
+      z = q(h[3]+h[4], 2); Qr[24] = z.real(); Qi[24] = z.imag();
+      z = q(h[0]+h[3]+h[4], 3); Qr[25] = z.real(); Qi[25] = z.imag();
+      z = q(h[1]+h[3]+h[4], 3); Qr[26] = z.real(); Qi[26] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4], 4); Qr[27] = z.real(); Qi[27] = z.imag();
+      z = q(h[2]+h[3]+h[4], 3); Qr[28] = z.real(); Qi[28] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4], 4); Qr[29] = z.real(); Qi[29] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4], 4); Qr[30] = z.real(); Qi[30] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4], 5); Qr[31] = z.real(); Qi[31] = z.imag();
+      z = q(h[5], 1); Qr[32] = z.real(); Qi[32] = z.imag();
+      z = q(h[0]+h[5], 2); Qr[33] = z.real(); Qi[33] = z.imag();
+      z = q(h[1]+h[5], 2); Qr[34] = z.real(); Qi[34] = z.imag();
+      z = q(h[0]+h[1]+h[5], 3); Qr[35] = z.real(); Qi[35] = z.imag();
+      z = q(h[2]+h[5], 2); Qr[36] = z.real(); Qi[36] = z.imag();
+      z = q(h[0]+h[2]+h[5], 3); Qr[37] = z.real(); Qi[37] = z.imag();
+      z = q(h[1]+h[2]+h[5], 3); Qr[38] = z.real(); Qi[38] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[5], 4); Qr[39] = z.real(); Qi[39] = z.imag();
+      z = q(h[3]+h[5], 2); Qr[40] = z.real(); Qi[40] = z.imag();
+      z = q(h[0]+h[3]+h[5], 3); Qr[41] = z.real(); Qi[41] = z.imag();
+      z = q(h[1]+h[3]+h[5], 3); Qr[42] = z.real(); Qi[42] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[5], 4); Qr[43] = z.real(); Qi[43] = z.imag();
+      z = q(h[2]+h[3]+h[5], 3); Qr[44] = z.real(); Qi[44] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[5], 4); Qr[45] = z.real(); Qi[45] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[5], 4); Qr[46] = z.real(); Qi[46] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[5], 5); Qr[47] = z.real(); Qi[47] = z.imag();
+      z = q(h[4]+h[5], 2); Qr[48] = z.real(); Qi[48] = z.imag();
+      z = q(h[0]+h[4]+h[5], 3); Qr[49] = z.real(); Qi[49] = z.imag();
+      z = q(h[1]+h[4]+h[5], 3); Qr[50] = z.real(); Qi[50] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[5], 4); Qr[51] = z.real(); Qi[51] = z.imag();
+      z = q(h[2]+h[4]+h[5], 3); Qr[52] = z.real(); Qi[52] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[5], 4); Qr[53] = z.real(); Qi[53] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[5], 4); Qr[54] = z.real(); Qi[54] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[5], 5); Qr[55] = z.real(); Qi[55] = z.imag();
+      z = q(h[3]+h[4]+h[5], 3); Qr[56] = z.real(); Qi[56] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[5], 4); Qr[57] = z.real(); Qi[57] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[5], 4); Qr[58] = z.real(); Qi[58] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[5], 5); Qr[59] = z.real(); Qi[59] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[5], 4); Qr[60] = z.real(); Qi[60] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[5], 5); Qr[61] = z.real(); Qi[61] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[5], 5); Qr[62] = z.real(); Qi[62] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[5], 6); Qr[63] = z.real(); Qi[63] = z.imag();
+      expand6Part0(Qr, Qi, Cr, Ci);
+      return Complex(Cr[63], Ci[63]);
+    }
+  }
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
@@ -0,0 +1,1767 @@
+// Generated by print -t closed -- do not edit
+#ifndef CORRELATIONS_CLOSED_EXPAND7_HH
+#define CORRELATIONS_CLOSED_EXPAND7_HH
+/**
+ * @file   correlations/closed/Expand7.hh
+ *
+ * @brief  Closed-form expression of the 7 particle correlator
+ *
+ * Generated by @c print @c -t @c closed.  Include this through
+ * correlations/Kernels.hh.
+ */
+#include <correlations/QVector.hh>
+
+namespace correlations {
+  namespace closed {
+    /** Part 0 of expand7 */
+    inline CORRELATIONS_NOINLINE void
+    expand7Part0(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[2] =
+	Qr[2];
+      Ci[2] =
+	Qi[2];
+
+      Cr[4] =
+	Qr[4];
+      Ci[4] =
+	Qi[4];
+
+      Cr[6] =
+	Qr[6];
+      Ci[6] =
+	Qi[6];
+      Cr[6] =
+	Qr[2] * Cr[4] - Qi[2] * Ci[4]
+	- Cr[6];
+      Ci[6] =
+	Qr[2] * Ci[4] + Qi[2] * Cr[4]
+	- Ci[6];
+
+      Cr[8] =
+	Qr[8];
+      Ci[8] =
+	Qi[8];
+
+      Cr[10] =
+	Qr[10];
+      Ci[10] =
+	Qi[10];
+      Cr[10] =
+	Qr[2] * Cr[8] - Qi[2] * Ci[8]
+	- Cr[10];
+      Ci[10] =
+	Qr[2] * Ci[8] + Qi[2] * Cr[8]
+	- Ci[10];
+
+      Cr[12] =
+	Qr[12];
+      Ci[12] =
+	Qi[12];
+      Cr[12] =
+	Qr[4] * Cr[8] - Qi[4] * Ci[8]
+	- Cr[12];
+      Ci[12] =
+	Qr[4] * Ci[8] + Qi[4] * Cr[8]
+	- Ci[12];
+
+      Cr[14] =
+	Qr[14];
+      Ci[14] =
+	Qi[14];
+      Cr[14] =
+	Qr[10] * Cr[4] - Qi[10] * Ci[4]
+	+ Qr[6] * Cr[8] - Qi[6] * Ci[8]
+	- 2. * Cr[14];
+      Ci[14] =
+	Qr[10] * Ci[4] + Qi[10] * Cr[4]
+	+ Qr[6] * Ci[8] + Qi[6] * Cr[8]
+	- 2. * Ci[14];
+      Cr[14] =
+	Qr[2] * Cr[12] - Qi[2] * Ci[12]
+	- Cr[14];
+      Ci[14] =
+	Qr[2] * Ci[12] + Qi[2] * Cr[12]
+	- Ci[14];
+
+      Cr[16] =
+	Qr[16];
+      Ci[16] =
+	Qi[16];
+
+      Cr[18] =
+	Qr[18];
+      Ci[18] =
+	Qi[18];
+      Cr[18] =
+	Qr[2] * Cr[16] - Qi[2] * Ci[16]
+	- Cr[18];
+      Ci[18] =
+	Qr[2] * Ci[16] + Qi[2] * Cr[16]
+	- Ci[18];
+
+      Cr[20] =
+	Qr[20];
+      Ci[20] =
+	Qi[20];
+      Cr[20] =
+	Qr[4] * Cr[16] - Qi[4] * Ci[16]
+	- Cr[20];
+      Ci[20] =
+	Qr[4] * Ci[16] + Qi[4] * Cr[16]
+	- Ci[20];
+
+      Cr[22] =
+	Qr[22];
+      Ci[22] =
+	Qi[22];
+      Cr[22] =
+	Qr[18] * Cr[4] - Qi[18] * Ci[4]
+	+ Qr[6] * Cr[16] - Qi[6] * Ci[16]
+	- 2. * Cr[22];
+      Ci[22] =
+	Qr[18] * Ci[4] + Qi[18] * Cr[4]
+	+ Qr[6] * Ci[16] + Qi[6] * Cr[16]
+	- 2. * Ci[22];
+      Cr[22] =
+	Qr[2] * Cr[20] - Qi[2] * Ci[20]
+	- Cr[22];
+      Ci[22] =
+	Qr[2] * Ci[20] + Qi[2] * Cr[20]
+	- Ci[22];
+
+      Cr[24] =
+	Qr[24];
+      Ci[24] =
+	Qi[24];
+      Cr[24] =
+	Qr[8] * Cr[16] - Qi[8] * Ci[16]
+	- Cr[24];
+      Ci[24] =
+	Qr[8] * Ci[16] + Qi[8] * Cr[16]
+	- Ci[24];
+
+      Cr[26] =
+	Qr[26];
+      Ci[26] =
+	Qi[26];
+      Cr[26] =
+	Qr[18] * Cr[8] - Qi[18] * Ci[8]
+	+ Qr[10] * Cr[16] - Qi[10] * Ci[16]
+	- 2. * Cr[26];
+      Ci[26] =
+	Qr[18] * Ci[8] + Qi[18] * Cr[8]
+	+ Qr[10] * Ci[16] + Qi[10] * Cr[16]
+	- 2. * Ci[26];
+      Cr[26] =
+	Qr[2] * Cr[24] - Qi[2] * Ci[24]
+	- Cr[26];
+      Ci[26] =
+	Qr[2] * Ci[24] + Qi[2] * Cr[24]
+	- Ci[26];
+
+      Cr[28] =
+	Qr[28];
+      Ci[28] =
+	Qi[28];
+      Cr[28] =
+	Qr[20] * Cr[8] - Qi[20] * Ci[8]
+	+ Qr[12] * Cr[16] - Qi[12] * Ci[16]
+	- 2. * Cr[28];
+      Ci[28] =
+	Qr[20] * Ci[8] + Qi[20] * Cr[8]
+	+ Qr[12] * Ci[16] + Qi[12] * Cr[16]
+	- 2. * Ci[28];
+      Cr[28] =
+	Qr[4] * Cr[24] - Qi[4] * Ci[24]
+	- Cr[28];
+      Ci[28] =
+	Qr[4] * Ci[24] + Qi[4] * Cr[24]
+	- Ci[28];
+
+      Cr[30] =
+	Qr[30];
+      Ci[30] =
+	Qi[30];
+      Cr[30] =
+	Qr[26] * Cr[4] - Qi[26] * Ci[4]
+	+ Qr[22] * Cr[8] - Qi[22] * Ci[8]
+	+ Qr[14] * Cr[16] - Qi[14] * Ci[16]
+	- 3. * Cr[30];
+      Ci[30] =
+	Qr[26] * Ci[4] + Qi[26] * Cr[4]
+	+ Qr[22] * Ci[8] + Qi[22] * Cr[8]
+	+ Qr[14] * Ci[16] + Qi[14] * Cr[16]
+	- 3. * Ci[30];
+      Cr[30] =
+	Qr[18] * Cr[12] - Qi[18] * Ci[12]
+	+ Qr[10] * Cr[20] - Qi[10] * Ci[20]
+	+ Qr[6] * Cr[24] - Qi[6] * Ci[24]
+	- 2. * Cr[30];
+      Ci[30] =
+	Qr[18] * Ci[12] + Qi[18] * Cr[12]
+	+ Qr[10] * Ci[20] + Qi[10] * Cr[20]
+	+ Qr[6] * Ci[24] + Qi[6] * Cr[24]
+	- 2. * Ci[30];
+      Cr[30] =
+	Qr[2] * Cr[28] - Qi[2] * Ci[28]
+	- Cr[30];
+      Ci[30] =
+	Qr[2] * Ci[28] + Qi[2] * Cr[28]
+	- Ci[30];
+
+      Cr[32] =
+	Qr[32];
+      Ci[32] =
+	Qi[32];
+
+      Cr[34] =
+	Qr[34];
+      Ci[34] =
+	Qi[34];
+      Cr[34] =
+	Qr[2] * Cr[32] - Qi[2] * Ci[32]
+	- Cr[34];
+      Ci[34] =
+	Qr[2] * Ci[32] + Qi[2] * Cr[32]
+	- Ci[34];
+
+      Cr[36] =
+	Qr[36];
+      Ci[36] =
+	Qi[36];
+      Cr[36] =
+	Qr[4] * Cr[32] - Qi[4] * Ci[32]
+	- Cr[36];
+      Ci[36] =
+	Qr[4] * Ci[32] + Qi[4] * Cr[32]
+	- Ci[36];
+
+      Cr[38] =
+	Qr[38];
+      Ci[38] =
+	Qi[38];
+      Cr[38] =
+	Qr[34] * Cr[4] - Qi[34] * Ci[4]
+	+ Qr[6] * Cr[32] - Qi[6] * Ci[32]
+	- 2. * Cr[38];
+      Ci[38] =
+	Qr[34] * Ci[4] + Qi[34] * Cr[4]
+	+ Qr[6] * Ci[32] + Qi[6] * Cr[32]
+	- 2. * Ci[38];
+      Cr[38] =
+	Qr[2] * Cr[36] - Qi[2] * Ci[36]
+	- Cr[38];
+      Ci[38] =
+	Qr[2] * Ci[36] + Qi[2] * Cr[36]
+	- Ci[38];
+
+      Cr[40] =
+	Qr[40];
+      Ci[40] =
+	Qi[40];
+      Cr[40] =
+	Qr[8] * Cr[32] - Qi[8] * Ci[32]
+	- Cr[40];
+      Ci[40] =
+	Qr[8] * Ci[32] + Qi[8] * Cr[32]
+	- Ci[40];
+
+      Cr[42] =
+	Qr[42];
+      Ci[42] =
+	Qi[42];
+      Cr[42] =
+	Qr[34] * Cr[8] - Qi[34] * Ci[8]
+	+ Qr[10] * Cr[32] - Qi[10] * Ci[32]
+	- 2. * Cr[42];
+      Ci[42] =
+	Qr[34] * Ci[8] + Qi[34] * Cr[8]
+	+ Qr[10] * Ci[32] + Qi[10] * Cr[32]
+	- 2. * Ci[42];
+      Cr[42] =
+	Qr[2] * Cr[40] - Qi[2] * Ci[40]
+	- Cr[42];
+      Ci[42] =
+	Qr[2] * Ci[40] + Qi[2] * Cr[40]
+	- Ci[42];
+
+      Cr[44] =
+	Qr[44];
+      Ci[44] =
+	Qi[44];
+      Cr[44] =
+	Qr[36] * Cr[8] - Qi[36] * Ci[8]
+	+ Qr[12] * Cr[32] - Qi[12] * Ci[32]
+	- 2. * Cr[44];
+      Ci[44] =
+	Qr[36] * Ci[8] + Qi[36] * Cr[8]
+	+ Qr[12] * Ci[32] + Qi[12] * Cr[32]
+	- 2. * Ci[44];
+      Cr[44] =
+	Qr[4] * Cr[40] - Qi[4] * Ci[40]
+	- Cr[44];
+      Ci[44] =
+	Qr[4] * Ci[40] + Qi[4] * Cr[40]
+	- Ci[44];
+
+      Cr[46] =
+	Qr[46];
+      Ci[46] =
+	Qi[46];
+      Cr[46] =
+	Qr[42] * Cr[4] - Qi[42] * Ci[4]
+	+ Qr[38] * Cr[8] - Qi[38] * Ci[8]
+	+ Qr[14] * Cr[32] - Qi[14] * Ci[32]
+	- 3. * Cr[46];
+      Ci[46] =
+	Qr[42] * Ci[4] + Qi[42] * Cr[4]
+	+ Qr[38] * Ci[8] + Qi[38] * Cr[8]
+	+ Qr[14] * Ci[32] + Qi[14] * Cr[32]
+	- 3. * Ci[46];
+      Cr[46] =
+	Qr[34] * Cr[12] - Qi[34] * Ci[12]
+	+ Qr[10] * Cr[36] - Qi[10] * Ci[36]
+	+ Qr[6] * Cr[40] - Qi[6] * Ci[40]
+	- 2. * Cr[46];
+      Ci[46] =
+	Qr[34] * Ci[12] + Qi[34] * Cr[12]
+	+ Qr[10] * Ci[36] + Qi[10] * Cr[36]
+	+ Qr[6] * Ci[40] + Qi[6] * Cr[40]
+	- 2. * Ci[46];
+      Cr[46] =
+	Qr[2] * Cr[44] - Qi[2] * Ci[44]
+	- Cr[46];
+      Ci[46] =
+	Qr[2] * Ci[44] + Qi[2] * Cr[44]
+	- Ci[46];
+
+      Cr[48] =
+	Qr[48];
+      Ci[48] =
+	Qi[48];
+      Cr[48] =
+	Qr[16] * Cr[32] - Qi[16] * Ci[32]
+	- Cr[48];
+      Ci[48] =
+	Qr[16] * Ci[32] + Qi[16] * Cr[32]
+	- Ci[48];
+
+      Cr[50] =
+	Qr[50];
+      Ci[50] =
+	Qi[50];
+      Cr[50] =
+	Qr[34] * Cr[16] - Qi[34] * Ci[16]
+	+ Qr[18] * Cr[32] - Qi[18] * Ci[32]
+	- 2. * Cr[50];
+      Ci[50] =
+	Qr[34] * Ci[16] + Qi[34] * Cr[16]
+	+ Qr[18] * Ci[32] + Qi[18] * Cr[32]
+	- 2. * Ci[50];
+      Cr[50] =
+	Qr[2] * Cr[48] - Qi[2] * Ci[48]
+	- Cr[50];
+      Ci[50] =
+	Qr[2] * Ci[48] + Qi[2] * Cr[48]
+	- Ci[50];
+
+      Cr[52] =
+	Qr[52];
+      Ci[52] =
+	Qi[52];
+      Cr[52] =
+	Qr[36] * Cr[16] - Qi[36] * Ci[16]
+	+ Qr[20] * Cr[32] - Qi[20] * Ci[32]
+	- 2. * Cr[52];
+      Ci[52] =
+	Qr[36] * Ci[16] + Qi[36] * Cr[16]
+	+ Qr[20] * Ci[32] + Qi[20] * Cr[32]
+	- 2. * Ci[52];
+      Cr[52] =
+	Qr[4] * Cr[48] - Qi[4] * Ci[48]
+	- Cr[52];
+      Ci[52] =
+	Qr[4] * Ci[48] + Qi[4] * Cr[48]
+	- Ci[52];
+
+      Cr[54] =
+	Qr[54];
+      Ci[54] =
+	Qi[54];
+      Cr[54] =
+	Qr[50] * Cr[4] - Qi[50] * Ci[4]
+	+ Qr[38] * Cr[16] - Qi[38] * Ci[16]
+	+ Qr[22] * Cr[32] - Qi[22] * Ci[32]
+	- 3. * Cr[54];
+      Ci[54] =
+	Qr[50] * Ci[4] + Qi[50] * Cr[4]
+	+ Qr[38] * Ci[16] + Qi[38] * Cr[16]
+	+ Qr[22] * Ci[32] + Qi[22] * Cr[32]
+	- 3. * Ci[54];
+      Cr[54] =
+	Qr[34] * Cr[20] - Qi[34] * Ci[20]
+	+ Qr[18] * Cr[36] - Qi[18] * Ci[36]
+	+ Qr[6] * Cr[48] - Qi[6] * Ci[48]
+	- 2. * Cr[54];
+      Ci[54] =
+	Qr[34] * Ci[20] + Qi[34] * Cr[20]
+	+ Qr[18] * Ci[36] + Qi[18] * Cr[36]
+	+ Qr[6] * Ci[48] + Qi[6] * Cr[48]
+	- 2. * Ci[54];
+      Cr[54] =
+	Qr[2] * Cr[52] - Qi[2] * Ci[52]
+	- Cr[54];
+      Ci[54] =
+	Qr[2] * Ci[52] + Qi[2] * Cr[52]
+	- Ci[54];
+
+      Cr[56] =
+	Qr[56];
+      Ci[56] =
+	Qi[56];
+      Cr[56] =
+	Qr[40] * Cr[16] - Qi[40] * Ci[16]
+	+ Qr[24] * Cr[32] - Qi[24] * Ci[32]
+	- 2. * Cr[56];
+      Ci[56] =
+	Qr[40] * Ci[16] + Qi[40] * Cr[16]
+	+ Qr[24] * Ci[32] + Qi[24] * Cr[32]
+	- 2. * Ci[56];
+      Cr[56] =
+	Qr[8] * Cr[48] - Qi[8] * Ci[48]
+	- Cr[56];
+      Ci[56] =
+	Qr[8] * Ci[48] + Qi[8] * Cr[48]
+	- Ci[56];
+
+      Cr[58] =
+	Qr[58];
+      Ci[58] =
+	Qi[58];
+      Cr[58] =
+	Qr[50] * Cr[8] - Qi[50] * Ci[8]
+	+ Qr[42] * Cr[16] - Qi[42] * Ci[16]
+	+ Qr[26] * Cr[32] - Qi[26] * Ci[32]
+	- 3. * Cr[58];
+      Ci[58] =
+	Qr[50] * Ci[8] + Qi[50] * Cr[8]
+	+ Qr[42] * Ci[16] + Qi[42] * Cr[16]
+	+ Qr[26] * Ci[32] + Qi[26] * Cr[32]
+	- 3. * Ci[58];
+      Cr[58] =
+	Qr[34] * Cr[24] - Qi[34] * Ci[24]
+	+ Qr[18] * Cr[40] - Qi[18] * Ci[40]
+	+ Qr[10] * Cr[48] - Qi[10] * Ci[48]
+	- 2. * Cr[58];
+      Ci[58] =
+	Qr[34] * Ci[24] + Qi[34] * Cr[24]
+	+ Qr[18] * Ci[40] + Qi[18] * Cr[40]
+	+ Qr[10] * Ci[48] + Qi[10] * Cr[48]
+	- 2. * Ci[58];
+      Cr[58] =
+	Qr[2] * Cr[56] - Qi[2] * Ci[56]
+	- Cr[58];
+      Ci[58] =
+	Qr[2] * Ci[56] + Qi[2] * Cr[56]
+	- Ci[58];
+
+      Cr[60] =
+	Qr[60];
+      Ci[60] =
+	Qi[60];
+      Cr[60] =
+	Qr[52] * Cr[8] - Qi[52] * Ci[8]
+	+ Qr[44] * Cr[16] - Qi[44] * Ci[16]
+	+ Qr[28] * Cr[32] - Qi[28] * Ci[32]
+	- 3. * Cr[60];
+      Ci[60] =
+	Qr[52] * Ci[8] + Qi[52] * Cr[8]
+	+ Qr[44] * Ci[16] + Qi[44] * Cr[16]
+	+ Qr[28] * Ci[32] + Qi[28] * Cr[32]
+	- 3. * Ci[60];
+      Cr[60] =
+	Qr[36] * Cr[24] - Qi[36] * Ci[24]
+	+ Qr[20] * Cr[40] - Qi[20] * Ci[40]
+	+ Qr[12] * Cr[48] - Qi[12] * Ci[48]
+	- 2. * Cr[60];
+      Ci[60] =
+	Qr[36] * Ci[24] + Qi[36] * Cr[24]
+	+ Qr[20] * Ci[40] + Qi[20] * Cr[40]
+	+ Qr[12] * Ci[48] + Qi[12] * Cr[48]
+	- 2. * Ci[60];
+      Cr[60] =
+	Qr[4] * Cr[56] - Qi[4] * Ci[56]
+	- Cr[60];
+      Ci[60] =
+	Qr[4] * Ci[56] + Qi[4] * Cr[56]
+	- Ci[60];
+
+      Cr[62] =
+	Qr[62];
+      Ci[62] =
+	Qi[62];
+      Cr[62] =
+	Qr[58] * Cr[4] - Qi[58] * Ci[4]
+	+ Qr[54] * Cr[8] - Qi[54] * Ci[8]
+	+ Qr[46] * Cr[16] - Qi[46] * Ci[16]
+	+ Qr[30] * Cr[32] - Qi[30] * Ci[32]
+	- 4. * Cr[62];
+      Ci[62] =
+	Qr[58] * Ci[4] + Qi[58] * Cr[4]
+	+ Qr[54] * Ci[8] + Qi[54] * Cr[8]
+	+ Qr[46] * Ci[16] + Qi[46] * Cr[16]
+	+ Qr[30] * Ci[32] + Qi[30] * Cr[32]
+	- 4. * Ci[62];
+      Cr[62] =
+	Qr[50] * Cr[12] - Qi[50] * Ci[12]
+	+ Qr[42] * Cr[20] - Qi[42] * Ci[20]
+	+ Qr[38] * Cr[24] - Qi[38] * Ci[24]
+	+ Qr[26] * Cr[36] - Qi[26] * Ci[36]
+	+ Qr[22] * Cr[40] - Qi[22] * Ci[40]
+	+ Qr[14] * Cr[48] - Qi[14] * Ci[48]
+	- 3. * Cr[62];
+      Ci[62] =
+	Qr[50] * Ci[12] + Qi[50] * Cr[12]
+	+ Qr[42] * Ci[20] + Qi[42] * Cr[20]
+	+ Qr[38] * Ci[24] + Qi[38] * Cr[24]
+	+ Qr[26] * Ci[36] + Qi[26] * Cr[36]
+	+ Qr[22] * Ci[40] + Qi[22] * Cr[40]
+	+ Qr[14] * Ci[48] + Qi[14] * Cr[48]
+	- 3. * Ci[62];
+      Cr[62] =
+	Qr[34] * Cr[28] - Qi[34] * Ci[28]
+	+ Qr[18] * Cr[44] - Qi[18] * Ci[44]
+	+ Qr[10] * Cr[52] - Qi[10] * Ci[52]
+	+ Qr[6] * Cr[56] - Qi[6] * Ci[56]
+	- 2. * Cr[62];
+      Ci[62] =
+	Qr[34] * Ci[28] + Qi[34] * Cr[28]
+	+ Qr[18] * Ci[44] + Qi[18] * Cr[44]
+	+ Qr[10] * Ci[52] + Qi[10] * Cr[52]
+	+ Qr[6] * Ci[56] + Qi[6] * Cr[56]
+	- 2. * Ci[62];
+      Cr[62] =
+	Qr[2] * Cr[60] - Qi[2] * Ci[60]
+	- Cr[62];
+      Ci[62] =
+	Qr[2] * Ci[60] + Qi[2] * Cr[60]
+	- Ci[62];
+
+      Cr[64] =
+	Qr[64];
+      Ci[64] =
+	Qi[64];
+
+      Cr[66] =
+	Qr[66];
+      Ci[66] =
+	Qi[66];
+      Cr[66] =
+	Qr[2] * Cr[64] - Qi[2] * Ci[64]
+	- Cr[66];
+      Ci[66] =
+	Qr[2] * Ci[64] + Qi[2] * Cr[64]
+	- Ci[66];
+
+      Cr[68] =
+	Qr[68];
+      Ci[68] =
+	Qi[68];
+      Cr[68] =
+	Qr[4] * Cr[64] - Qi[4] * Ci[64]
+	- Cr[68];
+      Ci[68] =
+	Qr[4] * Ci[64] + Qi[4] * Cr[64]
+	- Ci[68];
+
+      Cr[70] =
+	Qr[70];
+      Ci[70] =
+	Qi[70];
+      Cr[70] =
+	Qr[66] * Cr[4] - Qi[66] * Ci[4]
+	+ Qr[6] * Cr[64] - Qi[6] * Ci[64]
+	- 2. * Cr[70];
+      Ci[70] =
+	Qr[66] * Ci[4] + Qi[66] * Cr[4]
+	+ Qr[6] * Ci[64] + Qi[6] * Cr[64]
+	- 2. * Ci[70];
+      Cr[70] =
+	Qr[2] * Cr[68] - Qi[2] * Ci[68]
+	- Cr[70];
+      Ci[70] =
+	Qr[2] * Ci[68] + Qi[2] * Cr[68]
+	- Ci[70];
+    }
+
+    /** Part 1 of expand7 */
+    inline CORRELATIONS_NOINLINE void
+    expand7Part1(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[72] =
+	Qr[72];
+      Ci[72] =
+	Qi[72];
+      Cr[72] =
+	Qr[8] * Cr[64] - Qi[8] * Ci[64]
+	- Cr[72];
+      Ci[72] =
+	Qr[8] * Ci[64] + Qi[8] * Cr[64]
+	- Ci[72];
+
+      Cr[74] =
+	Qr[74];
+      Ci[74] =
+	Qi[74];
+      Cr[74] =
+	Qr[66] * Cr[8] - Qi[66] * Ci[8]
+	+ Qr[10] * Cr[64] - Qi[10] * Ci[64]
+	- 2. * Cr[74];
+      Ci[74] =
+	Qr[66] * Ci[8] + Qi[66] * Cr[8]
+	+ Qr[10] * Ci[64] + Qi[10] * Cr[64]
+	- 2. * Ci[74];
+      Cr[74] =
+	Qr[2] * Cr[72] - Qi[2] * Ci[72]
+	- Cr[74];
+      Ci[74] =
+	Qr[2] * Ci[72] + Qi[2] * Cr[72]
+	- Ci[74];
+
+      Cr[76] =
+	Qr[76];
+      Ci[76] =
+	Qi[76];
+      Cr[76] =
+	Qr[68] * Cr[8] - Qi[68] * Ci[8]
+	+ Qr[12] * Cr[64] - Qi[12] * Ci[64]
+	- 2. * Cr[76];
+      Ci[76] =
+	Qr[68] * Ci[8] + Qi[68] * Cr[8]
+	+ Qr[12] * Ci[64] + Qi[12] * Cr[64]
+	- 2. * Ci[76];
+      Cr[76] =
+	Qr[4] * Cr[72] - Qi[4] * Ci[72]
+	- Cr[76];
+      Ci[76] =
+	Qr[4] * Ci[72] + Qi[4] * Cr[72]
+	- Ci[76];
+
+      Cr[78] =
+	Qr[78];
+      Ci[78] =
+	Qi[78];
+      Cr[78] =
+	Qr[74] * Cr[4] - Qi[74] * Ci[4]
+	+ Qr[70] * Cr[8] - Qi[70] * Ci[8]
+	+ Qr[14] * Cr[64] - Qi[14] * Ci[64]
+	- 3. * Cr[78];
+      Ci[78] =
+	Qr[74] * Ci[4] + Qi[74] * Cr[4]
+	+ Qr[70] * Ci[8] + Qi[70] * Cr[8]
+	+ Qr[14] * Ci[64] + Qi[14] * Cr[64]
+	- 3. * Ci[78];
+      Cr[78] =
+	Qr[66] * Cr[12] - Qi[66] * Ci[12]
+	+ Qr[10] * Cr[68] - Qi[10] * Ci[68]
+	+ Qr[6] * Cr[72] - Qi[6] * Ci[72]
+	- 2. * Cr[78];
+      Ci[78] =
+	Qr[66] * Ci[12] + Qi[66] * Cr[12]
+	+ Qr[10] * Ci[68] + Qi[10] * Cr[68]
+	+ Qr[6] * Ci[72] + Qi[6] * Cr[72]
+	- 2. * Ci[78];
+      Cr[78] =
+	Qr[2] * Cr[76] - Qi[2] * Ci[76]
+	- Cr[78];
+      Ci[78] =
+	Qr[2] * Ci[76] + Qi[2] * Cr[76]
+	- Ci[78];
+
+      Cr[80] =
+	Qr[80];
+      Ci[80] =
+	Qi[80];
+      Cr[80] =
+	Qr[16] * Cr[64] - Qi[16] * Ci[64]
+	- Cr[80];
+      Ci[80] =
+	Qr[16] * Ci[64] + Qi[16] * Cr[64]
+	- Ci[80];
+
+      Cr[82] =
+	Qr[82];
+      Ci[82] =
+	Qi[82];
+      Cr[82] =
+	Qr[66] * Cr[16] - Qi[66] * Ci[16]
+	+ Qr[18] * Cr[64] - Qi[18] * Ci[64]
+	- 2. * Cr[82];
+      Ci[82] =
+	Qr[66] * Ci[16] + Qi[66] * Cr[16]
+	+ Qr[18] * Ci[64] + Qi[18] * Cr[64]
+	- 2. * Ci[82];
+      Cr[82] =
+	Qr[2] * Cr[80] - Qi[2] * Ci[80]
+	- Cr[82];
+      Ci[82] =
+	Qr[2] * Ci[80] + Qi[2] * Cr[80]
+	- Ci[82];
+
+      Cr[84] =
+	Qr[84];
+      Ci[84] =
+	Qi[84];
+      Cr[84] =
+	Qr[68] * Cr[16] - Qi[68] * Ci[16]
+	+ Qr[20] * Cr[64] - Qi[20] * Ci[64]
+	- 2. * Cr[84];
+      Ci[84] =
+	Qr[68] * Ci[16] + Qi[68] * Cr[16]
+	+ Qr[20] * Ci[64] + Qi[20] * Cr[64]
+	- 2. * Ci[84];
+      Cr[84] =
+	Qr[4] * Cr[80] - Qi[4] * Ci[80]
+	- Cr[84];
+      Ci[84] =
+	Qr[4] * Ci[80] + Qi[4] * Cr[80]
+	- Ci[84];
+
+      Cr[86] =
+	Qr[86];
+      Ci[86] =
+	Qi[86];
+      Cr[86] =
+	Qr[82] * Cr[4] - Qi[82] * Ci[4]
+	+ Qr[70] * Cr[16] - Qi[70] * Ci[16]
+	+ Qr[22] * Cr[64] - Qi[22] * Ci[64]
+	- 3. * Cr[86];
+      Ci[86] =
+	Qr[82] * Ci[4] + Qi[82] * Cr[4]
+	+ Qr[70] * Ci[16] + Qi[70] * Cr[16]
+	+ Qr[22] * Ci[64] + Qi[22] * Cr[64]
+	- 3. * Ci[86];
+      Cr[86] =
+	Qr[66] * Cr[20] - Qi[66] * Ci[20]
+	+ Qr[18] * Cr[68] - Qi[18] * Ci[68]
+	+ Qr[6] * Cr[80] - Qi[6] * Ci[80]
+	- 2. * Cr[86];
+      Ci[86] =
+	Qr[66] * Ci[20] + Qi[66] * Cr[20]
+	+ Qr[18] * Ci[68] + Qi[18] * Cr[68]
+	+ Qr[6] * Ci[80] + Qi[6] * Cr[80]
+	- 2. * Ci[86];
+      Cr[86] =
+	Qr[2] * Cr[84] - Qi[2] * Ci[84]
+	- Cr[86];
+      Ci[86] =
+	Qr[2] * Ci[84] + Qi[2] * Cr[84]
+	- Ci[86];
+
+      Cr[88] =
+	Qr[88];
+      Ci[88] =
+	Qi[88];
+      Cr[88] =
+	Qr[72] * Cr[16] - Qi[72] * Ci[16]
+	+ Qr[24] * Cr[64] - Qi[24] * Ci[64]
+	- 2. * Cr[88];
+      Ci[88] =
+	Qr[72] * Ci[16] + Qi[72] * Cr[16]
+	+ Qr[24] * Ci[64] + Qi[24] * Cr[64]
+	- 2. * Ci[88];
+      Cr[88] =
+	Qr[8] * Cr[80] - Qi[8] * Ci[80]
+	- Cr[88];
+      Ci[88] =
+	Qr[8] * Ci[80] + Qi[8] * Cr[80]
+	- Ci[88];
+
+      Cr[90] =
+	Qr[90];
+      Ci[90] =
+	Qi[90];
+      Cr[90] =
+	Qr[82] * Cr[8] - Qi[82] * Ci[8]
+	+ Qr[74] * Cr[16] - Qi[74] * Ci[16]
+	+ Qr[26] * Cr[64] - Qi[26] * Ci[64]
+	- 3. * Cr[90];
+      Ci[90] =
+	Qr[82] * Ci[8] + Qi[82] * Cr[8]
+	+ Qr[74] * Ci[16] + Qi[74] * Cr[16]
+	+ Qr[26] * Ci[64] + Qi[26] * Cr[64]
+	- 3. * Ci[90];
+      Cr[90] =
+	Qr[66] * Cr[24] - Qi[66] * Ci[24]
+	+ Qr[18] * Cr[72] - Qi[18] * Ci[72]
+	+ Qr[10] * Cr[80] - Qi[10] * Ci[80]
+	- 2. * Cr[90];
+      Ci[90] =
+	Qr[66] * Ci[24] + Qi[66] * Cr[24]
+	+ Qr[18] * Ci[72] + Qi[18] * Cr[72]
+	+ Qr[10] * Ci[80] + Qi[10] * Cr[80]
+	- 2. * Ci[90];
+      Cr[90] =
+	Qr[2] * Cr[88] - Qi[2] * Ci[88]
+	- Cr[90];
+      Ci[90] =
+	Qr[2] * Ci[88] + Qi[2] * Cr[88]
+	- Ci[90];
+
+      Cr[92] =
+	Qr[92];
+      Ci[92] =
+	Qi[92];
+      Cr[92] =
+	Qr[84] * Cr[8] - Qi[84] * Ci[8]
+	+ Qr[76] * Cr[16] - Qi[76] * Ci[16]
+	+ Qr[28] * Cr[64] - Qi[28] * Ci[64]
+	- 3. * Cr[92];
+      Ci[92] =
+	Qr[84] * Ci[8] + Qi[84] * Cr[8]
+	+ Qr[76] * Ci[16] + Qi[76] * Cr[16]
+	+ Qr[28] * Ci[64] + Qi[28] * Cr[64]
+	- 3. * Ci[92];
+      Cr[92] =
+	Qr[68] * Cr[24] - Qi[68] * Ci[24]
+	+ Qr[20] * Cr[72] - Qi[20] * Ci[72]
+	+ Qr[12] * Cr[80] - Qi[12] * Ci[80]
+	- 2. * Cr[92];
+      Ci[92] =
+	Qr[68] * Ci[24] + Qi[68] * Cr[24]
+	+ Qr[20] * Ci[72] + Qi[20] * Cr[72]
+	+ Qr[12] * Ci[80] + Qi[12] * Cr[80]
+	- 2. * Ci[92];
+      Cr[92] =
+	Qr[4] * Cr[88] - Qi[4] * Ci[88]
+	- Cr[92];
+      Ci[92] =
+	Qr[4] * Ci[88] + Qi[4] * Cr[88]
+	- Ci[92];
+
+      Cr[94] =
+	Qr[94];
+      Ci[94] =
+	Qi[94];
+      Cr[94] =
+	Qr[90] * Cr[4] - Qi[90] * Ci[4]
+	+ Qr[86] * Cr[8] - Qi[86] * Ci[8]
+	+ Qr[78] * Cr[16] - Qi[78] * Ci[16]
+	+ Qr[30] * Cr[64] - Qi[30] * Ci[64]
+	- 4. * Cr[94];
+      Ci[94] =
+	Qr[90] * Ci[4] + Qi[90] * Cr[4]
+	+ Qr[86] * Ci[8] + Qi[86] * Cr[8]
+	+ Qr[78] * Ci[16] + Qi[78] * Cr[16]
+	+ Qr[30] * Ci[64] + Qi[30] * Cr[64]
+	- 4. * Ci[94];
+      Cr[94] =
+	Qr[82] * Cr[12] - Qi[82] * Ci[12]
+	+ Qr[74] * Cr[20] - Qi[74] * Ci[20]
+	+ Qr[70] * Cr[24] - Qi[70] * Ci[24]
+	+ Qr[26] * Cr[68] - Qi[26] * Ci[68]
+	+ Qr[22] * Cr[72] - Qi[22] * Ci[72]
+	+ Qr[14] * Cr[80] - Qi[14] * Ci[80]
+	- 3. * Cr[94];
+      Ci[94] =
+	Qr[82] * Ci[12] + Qi[82] * Cr[12]
+	+ Qr[74] * Ci[20] + Qi[74] * Cr[20]
+	+ Qr[70] * Ci[24] + Qi[70] * Cr[24]
+	+ Qr[26] * Ci[68] + Qi[26] * Cr[68]
+	+ Qr[22] * Ci[72] + Qi[22] * Cr[72]
+	+ Qr[14] * Ci[80] + Qi[14] * Cr[80]
+	- 3. * Ci[94];
+      Cr[94] =
+	Qr[66] * Cr[28] - Qi[66] * Ci[28]
+	+ Qr[18] * Cr[76] - Qi[18] * Ci[76]
+	+ Qr[10] * Cr[84] - Qi[10] * Ci[84]
+	+ Qr[6] * Cr[88] - Qi[6] * Ci[88]
+	- 2. * Cr[94];
+      Ci[94] =
+	Qr[66] * Ci[28] + Qi[66] * Cr[28]
+	+ Qr[18] * Ci[76] + Qi[18] * Cr[76]
+	+ Qr[10] * Ci[84] + Qi[10] * Cr[84]
+	+ Qr[6] * Ci[88] + Qi[6] * Cr[88]
+	- 2. * Ci[94];
+      Cr[94] =
+	Qr[2] * Cr[92] - Qi[2] * Ci[92]
+	- Cr[94];
+      Ci[94] =
+	Qr[2] * Ci[92] + Qi[2] * Cr[92]
+	- Ci[94];
+
+      Cr[96] =
+	Qr[96];
+      Ci[96] =
+	Qi[96];
+      Cr[96] =
+	Qr[32] * Cr[64] - Qi[32] * Ci[64]
+	- Cr[96];
+      Ci[96] =
+	Qr[32] * Ci[64] + Qi[32] * Cr[64]
+	- Ci[96];
+
+      Cr[98] =
+	Qr[98];
+      Ci[98] =
+	Qi[98];
+      Cr[98] =
+	Qr[66] * Cr[32] - Qi[66] * Ci[32]
+	+ Qr[34] * Cr[64] - Qi[34] * Ci[64]
+	- 2. * Cr[98];
+      Ci[98] =
+	Qr[66] * Ci[32] + Qi[66] * Cr[32]
+	+ Qr[34] * Ci[64] + Qi[34] * Cr[64]
+	- 2. * Ci[98];
+      Cr[98] =
+	Qr[2] * Cr[96] - Qi[2] * Ci[96]
+	- Cr[98];
+      Ci[98] =
+	Qr[2] * Ci[96] + Qi[2] * Cr[96]
+	- Ci[98];
+
+      Cr[100] =
+	Qr[100];
+      Ci[100] =
+	Qi[100];
+      Cr[100] =
+	Qr[68] * Cr[32] - Qi[68] * Ci[32]
+	+ Qr[36] * Cr[64] - Qi[36] * Ci[64]
+	- 2. * Cr[100];
+      Ci[100] =
+	Qr[68] * Ci[32] + Qi[68] * Cr[32]
+	+ Qr[36] * Ci[64] + Qi[36] * Cr[64]
+	- 2. * Ci[100];
+      Cr[100] =
+	Qr[4] * Cr[96] - Qi[4] * Ci[96]
+	- Cr[100];
+      Ci[100] =
+	Qr[4] * Ci[96] + Qi[4] * Cr[96]
+	- Ci[100];
+
+      Cr[102] =
+	Qr[102];
+      Ci[102] =
+	Qi[102];
+      Cr[102] =
+	Qr[98] * Cr[4] - Qi[98] * Ci[4]
+	+ Qr[70] * Cr[32] - Qi[70] * Ci[32]
+	+ Qr[38] * Cr[64] - Qi[38] * Ci[64]
+	- 3. * Cr[102];
+      Ci[102] =
+	Qr[98] * Ci[4] + Qi[98] * Cr[4]
+	+ Qr[70] * Ci[32] + Qi[70] * Cr[32]
+	+ Qr[38] * Ci[64] + Qi[38] * Cr[64]
+	- 3. * Ci[102];
+      Cr[102] =
+	Qr[66] * Cr[36] - Qi[66] * Ci[36]
+	+ Qr[34] * Cr[68] - Qi[34] * Ci[68]
+	+ Qr[6] * Cr[96] - Qi[6] * Ci[96]
+	- 2. * Cr[102];
+      Ci[102] =
+	Qr[66] * Ci[36] + Qi[66] * Cr[36]
+	+ Qr[34] * Ci[68] + Qi[34] * Cr[68]
+	+ Qr[6] * Ci[96] + Qi[6] * Cr[96]
+	- 2. * Ci[102];
+      Cr[102] =
+	Qr[2] * Cr[100] - Qi[2] * Ci[100]
+	- Cr[102];
+      Ci[102] =
+	Qr[2] * Ci[100] + Qi[2] * Cr[100]
+	- Ci[102];
+
+      Cr[104] =
+	Qr[104];
+      Ci[104] =
+	Qi[104];
+      Cr[104] =
+	Qr[72] * Cr[32] - Qi[72] * Ci[32]
+	+ Qr[40] * Cr[64] - Qi[40] * Ci[64]
+	- 2. * Cr[104];
+      Ci[104] =
+	Qr[72] * Ci[32] + Qi[72] * Cr[32]
+	+ Qr[40] * Ci[64] + Qi[40] * Cr[64]
+	- 2. * Ci[104];
+      Cr[104] =
+	Qr[8] * Cr[96] - Qi[8] * Ci[96]
+	- Cr[104];
+      Ci[104] =
+	Qr[8] * Ci[96] + Qi[8] * Cr[96]
+	- Ci[104];
+
+      Cr[106] =
+	Qr[106];
+      Ci[106] =
+	Qi[106];
+      Cr[106] =
+	Qr[98] * Cr[8] - Qi[98] * Ci[8]
+	+ Qr[74] * Cr[32] - Qi[74] * Ci[32]
+	+ Qr[42] * Cr[64] - Qi[42] * Ci[64]
+	- 3. * Cr[106];
+      Ci[106] =
+	Qr[98] * Ci[8] + Qi[98] * Cr[8]
+	+ Qr[74] * Ci[32] + Qi[74] * Cr[32]
+	+ Qr[42] * Ci[64] + Qi[42] * Cr[64]
+	- 3. * Ci[106];
+      Cr[106] =
+	Qr[66] * Cr[40] - Qi[66] * Ci[40]
+	+ Qr[34] * Cr[72] - Qi[34] * Ci[72]
+	+ Qr[10] * Cr[96] - Qi[10] * Ci[96]
+	- 2. * Cr[106];
+      Ci[106] =
+	Qr[66] * Ci[40] + Qi[66] * Cr[40]
+	+ Qr[34] * Ci[72] + Qi[34] * Cr[72]
+	+ Qr[10] * Ci[96] + Qi[10] * Cr[96]
+	- 2. * Ci[106];
+      Cr[106] =
+	Qr[2] * Cr[104] - Qi[2] * Ci[104]
+	- Cr[106];
+      Ci[106] =
+	Qr[2] * Ci[104] + Qi[2] * Cr[104]
+	- Ci[106];
+
+      Cr[108] =
+	Qr[108];
+      Ci[108] =
+	Qi[108];
+      Cr[108] =
+	Qr[100] * Cr[8] - Qi[100] * Ci[8]
+	+ Qr[76] * Cr[32] - Qi[76] * Ci[32]
+	+ Qr[44] * Cr[64] - Qi[44] * Ci[64]
+	- 3. * Cr[108];
+      Ci[108] =
+	Qr[100] * Ci[8] + Qi[100] * Cr[8]
+	+ Qr[76] * Ci[32] + Qi[76] * Cr[32]
+	+ Qr[44] * Ci[64] + Qi[44] * Cr[64]
+	- 3. * Ci[108];
+      Cr[108] =
+	Qr[68] * Cr[40] - Qi[68] * Ci[40]
+	+ Qr[36] * Cr[72] - Qi[36] * Ci[72]
+	+ Qr[12] * Cr[96] - Qi[12] * Ci[96]
+	- 2. * Cr[108];
+      Ci[108] =
+	Qr[68] * Ci[40] + Qi[68] * Cr[40]
+	+ Qr[36] * Ci[72] + Qi[36] * Cr[72]
+	+ Qr[12] * Ci[96] + Qi[12] * Cr[96]
+	- 2. * Ci[108];
+      Cr[108] =
+	Qr[4] * Cr[104] - Qi[4] * Ci[104]
+	- Cr[108];
+      Ci[108] =
+	Qr[4] * Ci[104] + Qi[4] * Cr[104]
+	- Ci[108];
+
+      Cr[110] =
+	Qr[110];
+      Ci[110] =
+	Qi[110];
+      Cr[110] =
+	Qr[106] * Cr[4] - Qi[106] * Ci[4]
+	+ Qr[102] * Cr[8] - Qi[102] * Ci[8]
+	+ Qr[78] * Cr[32] - Qi[78] * Ci[32]
+	+ Qr[46] * Cr[64] - Qi[46] * Ci[64]
+	- 4. * Cr[110];
+      Ci[110] =
+	Qr[106] * Ci[4] + Qi[106] * Cr[4]
+	+ Qr[102] * Ci[8] + Qi[102] * Cr[8]
+	+ Qr[78] * Ci[32] + Qi[78] * Cr[32]
+	+ Qr[46] * Ci[64] + Qi[46] * Cr[64]
+	- 4. * Ci[110];
+      Cr[110] =
+	Qr[98] * Cr[12] - Qi[98] * Ci[12]
+	+ Qr[74] * Cr[36] - Qi[74] * Ci[36]
+	+ Qr[70] * Cr[40] - Qi[70] * Ci[40]
+	+ Qr[42] * Cr[68] - Qi[42] * Ci[68]
+	+ Qr[38] * Cr[72] - Qi[38] * Ci[72]
+	+ Qr[14] * Cr[96] - Qi[14] * Ci[96]
+	- 3. * Cr[110];
+      Ci[110] =
+	Qr[98] * Ci[12] + Qi[98] * Cr[12]
+	+ Qr[74] * Ci[36] + Qi[74] * Cr[36]
+	+ Qr[70] * Ci[40] + Qi[70] * Cr[40]
+	+ Qr[42] * Ci[68] + Qi[42] * Cr[68]
+	+ Qr[38] * Ci[72] + Qi[38] * Cr[72]
+	+ Qr[14] * Ci[96] + Qi[14] * Cr[96]
+	- 3. * Ci[110];
+      Cr[110] =
+	Qr[66] * Cr[44] - Qi[66] * Ci[44]
+	+ Qr[34] * Cr[76] - Qi[34] * Ci[76]
+	+ Qr[10] * Cr[100] - Qi[10] * Ci[100]
+	+ Qr[6] * Cr[104] - Qi[6] * Ci[104]
+	- 2. * Cr[110];
+      Ci[110] =
+	Qr[66] * Ci[44] + Qi[66] * Cr[44]
+	+ Qr[34] * Ci[76] + Qi[34] * Cr[76]
+	+ Qr[10] * Ci[100] + Qi[10] * Cr[100]
+	+ Qr[6] * Ci[104] + Qi[6] * Cr[104]
+	- 2. * Ci[110];
+      Cr[110] =
+	Qr[2] * Cr[108] - Qi[2] * Ci[108]
+	- Cr[110];
+      Ci[110] =
+	Qr[2] * Ci[108] + Qi[2] * Cr[108]
+	- Ci[110];
+
+      Cr[112] =
+	Qr[112];
+      Ci[112] =
+	Qi[112];
+      Cr[112] =
+	Qr[80] * Cr[32] - Qi[80] * Ci[32]
+	+ Qr[48] * Cr[64] - Qi[48] * Ci[64]
+	- 2. * Cr[112];
+      Ci[112] =
+	Qr[80] * Ci[32] + Qi[80] * Cr[32]
+	+ Qr[48] * Ci[64] + Qi[48] * Cr[64]
+	- 2. * Ci[112];
+      Cr[112] =
+	Qr[16] * Cr[96] - Qi[16] * Ci[96]
+	- Cr[112];
+      Ci[112] =
+	Qr[16] * Ci[96] + Qi[16] * Cr[96]
+	- Ci[112];
+    }
+
+    /** Part 2 of expand7 */
+    inline CORRELATIONS_NOINLINE void
+    expand7Part2(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[114] =
+	Qr[114];
+      Ci[114] =
+	Qi[114];
+      Cr[114] =
+	Qr[98] * Cr[16] - Qi[98] * Ci[16]
+	+ Qr[82] * Cr[32] - Qi[82] * Ci[32]
+	+ Qr[50] * Cr[64] - Qi[50] * Ci[64]
+	- 3. * Cr[114];
+      Ci[114] =
+	Qr[98] * Ci[16] + Qi[98] * Cr[16]
+	+ Qr[82] * Ci[32] + Qi[82] * Cr[32]
+	+ Qr[50] * Ci[64] + Qi[50] * Cr[64]
+	- 3. * Ci[114];
+      Cr[114] =
+	Qr[66] * Cr[48] - Qi[66] * Ci[48]
+	+ Qr[34] * Cr[80] - Qi[34] * Ci[80]
+	+ Qr[18] * Cr[96] - Qi[18] * Ci[96]
+	- 2. * Cr[114];
+      Ci[114] =
+	Qr[66] * Ci[48] + Qi[66] * Cr[48]
+	+ Qr[34] * Ci[80] + Qi[34] * Cr[80]
+	+ Qr[18] * Ci[96] + Qi[18] * Cr[96]
+	- 2. * Ci[114];
+      Cr[114] =
+	Qr[2] * Cr[112] - Qi[2] * Ci[112]
+	- Cr[114];
+      Ci[114] =
+	Qr[2] * Ci[112] + Qi[2] * Cr[112]
+	- Ci[114];
+
+      Cr[116] =
+	Qr[116];
+      Ci[116] =
+	Qi[116];
+      Cr[116] =
+	Qr[100] * Cr[16] - Qi[100] * Ci[16]
+	+ Qr[84] * Cr[32] - Qi[84] * Ci[32]
+	+ Qr[52] * Cr[64] - Qi[52] * Ci[64]
+	- 3. * Cr[116];
+      Ci[116] =
+	Qr[100] * Ci[16] + Qi[100] * Cr[16]
+	+ Qr[84] * Ci[32] + Qi[84] * Cr[32]
+	+ Qr[52] * Ci[64] + Qi[52] * Cr[64]
+	- 3. * Ci[116];
+      Cr[116] =
+	Qr[68] * Cr[48] - Qi[68] * Ci[48]
+	+ Qr[36] * Cr[80] - Qi[36] * Ci[80]
+	+ Qr[20] * Cr[96] - Qi[20] * Ci[96]
+	- 2. * Cr[116];
+      Ci[116] =
+	Qr[68] * Ci[48] + Qi[68] * Cr[48]
+	+ Qr[36] * Ci[80] + Qi[36] * Cr[80]
+	+ Qr[20] * Ci[96] + Qi[20] * Cr[96]
+	- 2. * Ci[116];
+      Cr[116] =
+	Qr[4] * Cr[112] - Qi[4] * Ci[112]
+	- Cr[116];
+      Ci[116] =
+	Qr[4] * Ci[112] + Qi[4] * Cr[112]
+	- Ci[116];
+
+      Cr[118] =
+	Qr[118];
+      Ci[118] =
+	Qi[118];
+      Cr[118] =
+	Qr[114] * Cr[4] - Qi[114] * Ci[4]
+	+ Qr[102] * Cr[16] - Qi[102] * Ci[16]
+	+ Qr[86] * Cr[32] - Qi[86] * Ci[32]
+	+ Qr[54] * Cr[64] - Qi[54] * Ci[64]
+	- 4. * Cr[118];
+      Ci[118] =
+	Qr[114] * Ci[4] + Qi[114] * Cr[4]
+	+ Qr[102] * Ci[16] + Qi[102] * Cr[16]
+	+ Qr[86] * Ci[32] + Qi[86] * Cr[32]
+	+ Qr[54] * Ci[64] + Qi[54] * Cr[64]
+	- 4. * Ci[118];
+      Cr[118] =
+	Qr[98] * Cr[20] - Qi[98] * Ci[20]
+	+ Qr[82] * Cr[36] - Qi[82] * Ci[36]
+	+ Qr[70] * Cr[48] - Qi[70] * Ci[48]
+	+ Qr[50] * Cr[68] - Qi[50] * Ci[68]
+	+ Qr[38] * Cr[80] - Qi[38] * Ci[80]
+	+ Qr[22] * Cr[96] - Qi[22] * Ci[96]
+	- 3. * Cr[118];
+      Ci[118] =
+	Qr[98] * Ci[20] + Qi[98] * Cr[20]
+	+ Qr[82] * Ci[36] + Qi[82] * Cr[36]
+	+ Qr[70] * Ci[48] + Qi[70] * Cr[48]
+	+ Qr[50] * Ci[68] + Qi[50] * Cr[68]
+	+ Qr[38] * Ci[80] + Qi[38] * Cr[80]
+	+ Qr[22] * Ci[96] + Qi[22] * Cr[96]
+	- 3. * Ci[118];
+      Cr[118] =
+	Qr[66] * Cr[52] - Qi[66] * Ci[52]
+	+ Qr[34] * Cr[84] - Qi[34] * Ci[84]
+	+ Qr[18] * Cr[100] - Qi[18] * Ci[100]
+	+ Qr[6] * Cr[112] - Qi[6] * Ci[112]
+	- 2. * Cr[118];
+      Ci[118] =
+	Qr[66] * Ci[52] + Qi[66] * Cr[52]
+	+ Qr[34] * Ci[84] + Qi[34] * Cr[84]
+	+ Qr[18] * Ci[100] + Qi[18] * Cr[100]
+	+ Qr[6] * Ci[112] + Qi[6] * Cr[112]
+	- 2. * Ci[118];
+      Cr[118] =
+	Qr[2] * Cr[116] - Qi[2] * Ci[116]
+	- Cr[118];
+      Ci[118] =
+	Qr[2] * Ci[116] + Qi[2] * Cr[116]
+	- Ci[118];
+
+      Cr[120] =
+	Qr[120];
+      Ci[120] =
+	Qi[120];
+      Cr[120] =
+	Qr[104] * Cr[16] - Qi[104] * Ci[16]
+	+ Qr[88] * Cr[32] - Qi[88] * Ci[32]
+	+ Qr[56] * Cr[64] - Qi[56] * Ci[64]
+	- 3. * Cr[120];
+      Ci[120] =
+	Qr[104] * Ci[16] + Qi[104] * Cr[16]
+	+ Qr[88] * Ci[32] + Qi[88] * Cr[32]
+	+ Qr[56] * Ci[64] + Qi[56] * Cr[64]
+	- 3. * Ci[120];
+      Cr[120] =
+	Qr[72] * Cr[48] - Qi[72] * Ci[48]
+	+ Qr[40] * Cr[80] - Qi[40] * Ci[80]
+	+ Qr[24] * Cr[96] - Qi[24] * Ci[96]
+	- 2. * Cr[120];
+      Ci[120] =
+	Qr[72] * Ci[48] + Qi[72] * Cr[48]
+	+ Qr[40] * Ci[80] + Qi[40] * Cr[80]
+	+ Qr[24] * Ci[96] + Qi[24] * Cr[96]
+	- 2. * Ci[120];
+      Cr[120] =
+	Qr[8] * Cr[112] - Qi[8] * Ci[112]
+	- Cr[120];
+      Ci[120] =
+	Qr[8] * Ci[112] + Qi[8] * Cr[112]
+	- Ci[120];
+
+      Cr[122] =
+	Qr[122];
+      Ci[122] =
+	Qi[122];
+      Cr[122] =
+	Qr[114] * Cr[8] - Qi[114] * Ci[8]
+	+ Qr[106] * Cr[16] - Qi[106] * Ci[16]
+	+ Qr[90] * Cr[32] - Qi[90] * Ci[32]
+	+ Qr[58] * Cr[64] - Qi[58] * Ci[64]
+	- 4. * Cr[122];
+      Ci[122] =
+	Qr[114] * Ci[8] + Qi[114] * Cr[8]
+	+ Qr[106] * Ci[16] + Qi[106] * Cr[16]
+	+ Qr[90] * Ci[32] + Qi[90] * Cr[32]
+	+ Qr[58] * Ci[64] + Qi[58] * Cr[64]
+	- 4. * Ci[122];
+      Cr[122] =
+	Qr[98] * Cr[24] - Qi[98] * Ci[24]
+	+ Qr[82] * Cr[40] - Qi[82] * Ci[40]
+	+ Qr[74] * Cr[48] - Qi[74] * Ci[48]
+	+ Qr[50] * Cr[72] - Qi[50] * Ci[72]
+	+ Qr[42] * Cr[80] - Qi[42] * Ci[80]
+	+ Qr[26] * Cr[96] - Qi[26] * Ci[96]
+	- 3. * Cr[122];
+      Ci[122] =
+	Qr[98] * Ci[24] + Qi[98] * Cr[24]
+	+ Qr[82] * Ci[40] + Qi[82] * Cr[40]
+	+ Qr[74] * Ci[48] + Qi[74] * Cr[48]
+	+ Qr[50] * Ci[72] + Qi[50] * Cr[72]
+	+ Qr[42] * Ci[80] + Qi[42] * Cr[80]
+	+ Qr[26] * Ci[96] + Qi[26] * Cr[96]
+	- 3. * Ci[122];
+      Cr[122] =
+	Qr[66] * Cr[56] - Qi[66] * Ci[56]
+	+ Qr[34] * Cr[88] - Qi[34] * Ci[88]
+	+ Qr[18] * Cr[104] - Qi[18] * Ci[104]
+	+ Qr[10] * Cr[112] - Qi[10] * Ci[112]
+	- 2. * Cr[122];
+      Ci[122] =
+	Qr[66] * Ci[56] + Qi[66] * Cr[56]
+	+ Qr[34] * Ci[88] + Qi[34] * Cr[88]
+	+ Qr[18] * Ci[104] + Qi[18] * Cr[104]
+	+ Qr[10] * Ci[112] + Qi[10] * Cr[112]
+	- 2. * Ci[122];
+      Cr[122] =
+	Qr[2] * Cr[120] - Qi[2] * Ci[120]
+	- Cr[122];
+      Ci[122] =
+	Qr[2] * Ci[120] + Qi[2] * Cr[120]
+	- Ci[122];
+
+      Cr[124] =
+	Qr[124];
+      Ci[124] =
+	Qi[124];
+      Cr[124] =
+	Qr[116] * Cr[8] - Qi[116] * Ci[8]
+	+ Qr[108] * Cr[16] - Qi[108] * Ci[16]
+	+ Qr[92] * Cr[32] - Qi[92] * Ci[32]
+	+ Qr[60] * Cr[64] - Qi[60] * Ci[64]
+	- 4. * Cr[124];
+      Ci[124] =
+	Qr[116] * Ci[8] + Qi[116] * Cr[8]
+	+ Qr[108] * Ci[16] + Qi[108] * Cr[16]
+	+ Qr[92] * Ci[32] + Qi[92] * Cr[32]
+	+ Qr[60] * Ci[64] + Qi[60] * Cr[64]
+	- 4. * Ci[124];
+      Cr[124] =
+	Qr[100] * Cr[24] - Qi[100] * Ci[24]
+	+ Qr[84] * Cr[40] - Qi[84] * Ci[40]
+	+ Qr[76] * Cr[48] - Qi[76] * Ci[48]
+	+ Qr[52] * Cr[72] - Qi[52] * Ci[72]
+	+ Qr[44] * Cr[80] - Qi[44] * Ci[80]
+	+ Qr[28] * Cr[96] - Qi[28] * Ci[96]
+	- 3. * Cr[124];
+      Ci[124] =
+	Qr[100] * Ci[24] + Qi[100] * Cr[24]
+	+ Qr[84] * Ci[40] + Qi[84] * Cr[40]
+	+ Qr[76] * Ci[48] + Qi[76] * Cr[48]
+	+ Qr[52] * Ci[72] + Qi[52] * Cr[72]
+	+ Qr[44] * Ci[80] + Qi[44] * Cr[80]
+	+ Qr[28] * Ci[96] + Qi[28] * Cr[96]
+	- 3. * Ci[124];
+      Cr[124] =
+	Qr[68] * Cr[56] - Qi[68] * Ci[56]
+	+ Qr[36] * Cr[88] - Qi[36] * Ci[88]
+	+ Qr[20] * Cr[104] - Qi[20] * Ci[104]
+	+ Qr[12] * Cr[112] - Qi[12] * Ci[112]
+	- 2. * Cr[124];
+      Ci[124] =
+	Qr[68] * Ci[56] + Qi[68] * Cr[56]
+	+ Qr[36] * Ci[88] + Qi[36] * Cr[88]
+	+ Qr[20] * Ci[104] + Qi[20] * Cr[104]
+	+ Qr[12] * Ci[112] + Qi[12] * Cr[112]
+	- 2. * Ci[124];
+      Cr[124] =
+	Qr[4] * Cr[120] - Qi[4] * Ci[120]
+	- Cr[124];
+      Ci[124] =
+	Qr[4] * Ci[120] + Qi[4] * Cr[120]
+	- Ci[124];
+
+      Cr[126] =
+	Qr[126];
+      Ci[126] =
+	Qi[126];
+      Cr[126] =
+	Qr[122] * Cr[4] - Qi[122] * Ci[4]
+	+ Qr[118] * Cr[8] - Qi[118] * Ci[8]
+	+ Qr[110] * Cr[16] - Qi[110] * Ci[16]
+	+ Qr[94] * Cr[32] - Qi[94] * Ci[32]
+	+ Qr[62] * Cr[64] - Qi[62] * Ci[64]
+	- 5. * Cr[126];
+      Ci[126] =
+	Qr[122] * Ci[4] + Qi[122] * Cr[4]
+	+ Qr[118] * Ci[8] + Qi[118] * Cr[8]
+	+ Qr[110] * Ci[16] + Qi[110] * Cr[16]
+	+ Qr[94] * Ci[32] + Qi[94] * Cr[32]
+	+ Qr[62] * Ci[64] + Qi[62] * Cr[64]
+	- 5. * Ci[126];
+      Cr[126] =
+	Qr[114] * Cr[12] - Qi[114] * Ci[12]
+	+ Qr[106] * Cr[20] - Qi[106] * Ci[20]
+	+ Qr[102] * Cr[24] - Qi[102] * Ci[24]
+	+ Qr[90] * Cr[36] - Qi[90] * Ci[36]
+	+ Qr[86] * Cr[40] - Qi[86] * Ci[40]
+	+ Qr[78] * Cr[48] - Qi[78] * Ci[48]
+	+ Qr[58] * Cr[68] - Qi[58] * Ci[68]
+	+ Qr[54] * Cr[72] - Qi[54] * Ci[72]
+	+ Qr[46] * Cr[80] - Qi[46] * Ci[80]
+	+ Qr[30] * Cr[96] - Qi[30] * Ci[96]
+	- 4. * Cr[126];
+      Ci[126] =
+	Qr[114] * Ci[12] + Qi[114] * Cr[12]
+	+ Qr[106] * Ci[20] + Qi[106] * Cr[20]
+	+ Qr[102] * Ci[24] + Qi[102] * Cr[24]
+	+ Qr[90] * Ci[36] + Qi[90] * Cr[36]
+	+ Qr[86] * Ci[40] + Qi[86] * Cr[40]
+	+ Qr[78] * Ci[48] + Qi[78] * Cr[48]
+	+ Qr[58] * Ci[68] + Qi[58] * Cr[68]
+	+ Qr[54] * Ci[72] + Qi[54] * Cr[72]
+	+ Qr[46] * Ci[80] + Qi[46] * Cr[80]
+	+ Qr[30] * Ci[96] + Qi[30] * Cr[96]
+	- 4. * Ci[126];
+      Cr[126] =
+	Qr[98] * Cr[28] - Qi[98] * Ci[28]
+	+ Qr[82] * Cr[44] - Qi[82] * Ci[44]
+	+ Qr[74] * Cr[52] - Qi[74] * Ci[52]
+	+ Qr[70] * Cr[56] - Qi[70] * Ci[56]
+	+ Qr[50] * Cr[76] - Qi[50] * Ci[76]
+	+ Qr[42] * Cr[84] - Qi[42] * Ci[84]
+	+ Qr[38] * Cr[88] - Qi[38] * Ci[88]
+	+ Qr[26] * Cr[100] - Qi[26] * Ci[100]
+	+ Qr[22] * Cr[104] - Qi[22] * Ci[104]
+	+ Qr[14] * Cr[112] - Qi[14] * Ci[112]
+	- 3. * Cr[126];
+      Ci[126] =
+	Qr[98] * Ci[28] + Qi[98] * Cr[28]
+	+ Qr[82] * Ci[44] + Qi[82] * Cr[44]
+	+ Qr[74] * Ci[52] + Qi[74] * Cr[52]
+	+ Qr[70] * Ci[56] + Qi[70] * Cr[56]
+	+ Qr[50] * Ci[76] + Qi[50] * Cr[76]
+	+ Qr[42] * Ci[84] + Qi[42] * Cr[84]
+	+ Qr[38] * Ci[88] + Qi[38] * Cr[88]
+	+ Qr[26] * Ci[100] + Qi[26] * Cr[100]
+	+ Qr[22] * Ci[104] + Qi[22] * Cr[104]
+	+ Qr[14] * Ci[112] + Qi[14] * Cr[112]
+	- 3. * Ci[126];
+      Cr[126] =
+	Qr[66] * Cr[60] - Qi[66] * Ci[60]
+	+ Qr[34] * Cr[92] - Qi[34] * Ci[92]
+	+ Qr[18] * Cr[108] - Qi[18] * Ci[108]
+	+ Qr[10] * Cr[116] - Qi[10] * Ci[116]
+	+ Qr[6] * Cr[120] - Qi[6] * Ci[120]
+	- 2. * Cr[126];
+      Ci[126] =
+	Qr[66] * Ci[60] + Qi[66] * Cr[60]
+	+ Qr[34] * Ci[92] + Qi[34] * Cr[92]
+	+ Qr[18] * Ci[108] + Qi[18] * Cr[108]
+	+ Qr[10] * Ci[116] + Qi[10] * Cr[116]
+	+ Qr[6] * Ci[120] + Qi[6] * Cr[120]
+	- 2. * Ci[126];
+      Cr[126] =
+	Qr[2] * Cr[124] - Qi[2] * Ci[124]
+	- Cr[126];
+      Ci[126] =
+	Qr[2] * Ci[124] + Qi[2] * Cr[124]
+	- Ci[126];
+
+      Cr[127] =
+	Qr[127];
+      Ci[127] =
+	Qi[127];
+      Cr[127] =
+	Qr[125] * Cr[2] - Qi[125] * Ci[2]
+	+ Qr[123] * Cr[4] - Qi[123] * Ci[4]
+	+ Qr[119] * Cr[8] - Qi[119] * Ci[8]
+	+ Qr[111] * Cr[16] - Qi[111] * Ci[16]
+	+ Qr[95] * Cr[32] - Qi[95] * Ci[32]
+	+ Qr[63] * Cr[64] - Qi[63] * Ci[64]
+	- 6. * Cr[127];
+      Ci[127] =
+	Qr[125] * Ci[2] + Qi[125] * Cr[2]
+	+ Qr[123] * Ci[4] + Qi[123] * Cr[4]
+	+ Qr[119] * Ci[8] + Qi[119] * Cr[8]
+	+ Qr[111] * Ci[16] + Qi[111] * Cr[16]
+	+ Qr[95] * Ci[32] + Qi[95] * Cr[32]
+	+ Qr[63] * Ci[64] + Qi[63] * Cr[64]
+	- 6. * Ci[127];
+      Cr[127] =
+	Qr[121] * Cr[6] - Qi[121] * Ci[6]
+	+ Qr[117] * Cr[10] - Qi[117] * Ci[10]
+	+ Qr[115] * Cr[12] - Qi[115] * Ci[12]
+	+ Qr[109] * Cr[18] - Qi[109] * Ci[18]
+	+ Qr[107] * Cr[20] - Qi[107] * Ci[20]
+	+ Qr[103] * Cr[24] - Qi[103] * Ci[24]
+	+ Qr[93] * Cr[34] - Qi[93] * Ci[34]
+	+ Qr[91] * Cr[36] - Qi[91] * Ci[36]
+	+ Qr[87] * Cr[40] - Qi[87] * Ci[40]
+	+ Qr[79] * Cr[48] - Qi[79] * Ci[48]
+	+ Qr[61] * Cr[66] - Qi[61] * Ci[66]
+	+ Qr[59] * Cr[68] - Qi[59] * Ci[68]
+	+ Qr[55] * Cr[72] - Qi[55] * Ci[72]
+	+ Qr[47] * Cr[80] - Qi[47] * Ci[80]
+	+ Qr[31] * Cr[96] - Qi[31] * Ci[96]
+	- 5. * Cr[127];
+      Ci[127] =
+	Qr[121] * Ci[6] + Qi[121] * Cr[6]
+	+ Qr[117] * Ci[10] + Qi[117] * Cr[10]
+	+ Qr[115] * Ci[12] + Qi[115] * Cr[12]
+	+ Qr[109] * Ci[18] + Qi[109] * Cr[18]
+	+ Qr[107] * Ci[20] + Qi[107] * Cr[20]
+	+ Qr[103] * Ci[24] + Qi[103] * Cr[24]
+	+ Qr[93] * Ci[34] + Qi[93] * Cr[34]
+	+ Qr[91] * Ci[36] + Qi[91] * Cr[36]
+	+ Qr[87] * Ci[40] + Qi[87] * Cr[40]
+	+ Qr[79] * Ci[48] + Qi[79] * Cr[48]
+	+ Qr[61] * Ci[66] + Qi[61] * Cr[66]
+	+ Qr[59] * Ci[68] + Qi[59] * Cr[68]
+	+ Qr[55] * Ci[72] + Qi[55] * Cr[72]
+	+ Qr[47] * Ci[80] + Qi[47] * Cr[80]
+	+ Qr[31] * Ci[96] + Qi[31] * Cr[96]
+	- 5. * Ci[127];
+      Cr[127] =
+	Qr[113] * Cr[14] - Qi[113] * Ci[14]
+	+ Qr[105] * Cr[22] - Qi[105] * Ci[22]
+	+ Qr[101] * Cr[26] - Qi[101] * Ci[26]
+	+ Qr[99] * Cr[28] - Qi[99] * Ci[28]
+	+ Qr[89] * Cr[38] - Qi[89] * Ci[38]
+	+ Qr[85] * Cr[42] - Qi[85] * Ci[42]
+	+ Qr[83] * Cr[44] - Qi[83] * Ci[44]
+	+ Qr[77] * Cr[50] - Qi[77] * Ci[50]
+	+ Qr[75] * Cr[52] - Qi[75] * Ci[52]
+	+ Qr[71] * Cr[56] - Qi[71] * Ci[56]
+	+ Qr[57] * Cr[70] - Qi[57] * Ci[70]
+	+ Qr[53] * Cr[74] - Qi[53] * Ci[74]
+	+ Qr[51] * Cr[76] - Qi[51] * Ci[76]
+	+ Qr[45] * Cr[82] - Qi[45] * Ci[82]
+	+ Qr[43] * Cr[84] - Qi[43] * Ci[84]
+	+ Qr[39] * Cr[88] - Qi[39] * Ci[88]
+	+ Qr[29] * Cr[98] - Qi[29] * Ci[98]
+	+ Qr[27] * Cr[100] - Qi[27] * Ci[100]
+	+ Qr[23] * Cr[104] - Qi[23] * Ci[104]
+	+ Qr[15] * Cr[112] - Qi[15] * Ci[112]
+	- 4. * Cr[127];
+      Ci[127] =
+	Qr[113] * Ci[14] + Qi[113] * Cr[14]
+	+ Qr[105] * Ci[22] + Qi[105] * Cr[22]
+	+ Qr[101] * Ci[26] + Qi[101] * Cr[26]
+	+ Qr[99] * Ci[28] + Qi[99] * Cr[28]
+	+ Qr[89] * Ci[38] + Qi[89] * Cr[38]
+	+ Qr[85] * Ci[42] + Qi[85] * Cr[42]
+	+ Qr[83] * Ci[44] + Qi[83] * Cr[44]
+	+ Qr[77] * Ci[50] + Qi[77] * Cr[50]
+	+ Qr[75] * Ci[52] + Qi[75] * Cr[52]
+	+ Qr[71] * Ci[56] + Qi[71] * Cr[56]
+	+ Qr[57] * Ci[70] + Qi[57] * Cr[70]
+	+ Qr[53] * Ci[74] + Qi[53] * Cr[74]
+	+ Qr[51] * Ci[76] + Qi[51] * Cr[76]
+	+ Qr[45] * Ci[82] + Qi[45] * Cr[82]
+	+ Qr[43] * Ci[84] + Qi[43] * Cr[84]
+	+ Qr[39] * Ci[88] + Qi[39] * Cr[88]
+	+ Qr[29] * Ci[98] + Qi[29] * Cr[98]
+	+ Qr[27] * Ci[100] + Qi[27] * Cr[100]
+	+ Qr[23] * Ci[104] + Qi[23] * Cr[104]
+	+ Qr[15] * Ci[112] + Qi[15] * Cr[112]
+	- 4. * Ci[127];
+      Cr[127] =
+	Qr[97] * Cr[30] - Qi[97] * Ci[30]
+	+ Qr[81] * Cr[46] - Qi[81] * Ci[46]
+	+ Qr[73] * Cr[54] - Qi[73] * Ci[54]
+	+ Qr[69] * Cr[58] - Qi[69] * Ci[58]
+	+ Qr[67] * Cr[60] - Qi[67] * Ci[60]
+	+ Qr[49] * Cr[78] - Qi[49] * Ci[78]
+	+ Qr[41] * Cr[86] - Qi[41] * Ci[86]
+	+ Qr[37] * Cr[90] - Qi[37] * Ci[90]
+	+ Qr[35] * Cr[92] - Qi[35] * Ci[92]
+	+ Qr[25] * Cr[102] - Qi[25] * Ci[102]
+	+ Qr[21] * Cr[106] - Qi[21] * Ci[106]
+	+ Qr[19] * Cr[108] - Qi[19] * Ci[108]
+	+ Qr[13] * Cr[114] - Qi[13] * Ci[114]
+	+ Qr[11] * Cr[116] - Qi[11] * Ci[116]
+	+ Qr[7] * Cr[120] - Qi[7] * Ci[120]
+	- 3. * Cr[127];
+      Ci[127] =
+	Qr[97] * Ci[30] + Qi[97] * Cr[30]
+	+ Qr[81] * Ci[46] + Qi[81] * Cr[46]
+	+ Qr[73] * Ci[54] + Qi[73] * Cr[54]
+	+ Qr[69] * Ci[58] + Qi[69] * Cr[58]
+	+ Qr[67] * Ci[60] + Qi[67] * Cr[60]
+	+ Qr[49] * Ci[78] + Qi[49] * Cr[78]
+	+ Qr[41] * Ci[86] + Qi[41] * Cr[86]
+	+ Qr[37] * Ci[90] + Qi[37] * Cr[90]
+	+ Qr[35] * Ci[92] + Qi[35] * Cr[92]
+	+ Qr[25] * Ci[102] + Qi[25] * Cr[102]
+	+ Qr[21] * Ci[106] + Qi[21] * Cr[106]
+	+ Qr[19] * Ci[108] + Qi[19] * Cr[108]
+	+ Qr[13] * Ci[114] + Qi[13] * Cr[114]
+	+ Qr[11] * Ci[116] + Qi[11] * Cr[116]
+	+ Qr[7] * Ci[120] + Qi[7] * Cr[120]
+	- 3. * Ci[127];
+      Cr[127] =
+	Qr[65] * Cr[62] - Qi[65] * Ci[62]
+	+ Qr[33] * Cr[94] - Qi[33] * Ci[94]
+	+ Qr[17] * Cr[110] - Qi[17] * Ci[110]
+	+ Qr[9] * Cr[118] - Qi[9] * Ci[118]
+	+ Qr[5] * Cr[122] - Qi[5] * Ci[122]
+	+ Qr[3] * Cr[124] - Qi[3] * Ci[124]
+	- 2. * Cr[127];
+      Ci[127] =
+	Qr[65] * Ci[62] + Qi[65] * Cr[62]
+	+ Qr[33] * Ci[94] + Qi[33] * Cr[94]
+	+ Qr[17] * Ci[110] + Qi[17] * Cr[110]
+	+ Qr[9] * Ci[118] + Qi[9] * Cr[118]
+	+ Qr[5] * Ci[122] + Qi[5] * Cr[122]
+	+ Qr[3] * Ci[124] + Qi[3] * Cr[124]
+	- 2. * Ci[127];
+      Cr[127] =
+	Qr[1] * Cr[126] - Qi[1] * Ci[126]
+	- Cr[127];
+      Ci[127] =
+	Qr[1] * Ci[126] + Qi[1] * Cr[126]
+	- Ci[127];
+    }
+
+    /**
+     * @param q Q-vector
+     * @param h Harmonics (at least 7)
+     *
+     * @return @f$ QC\{7\}@f$
+     */
+    CORRELATIONS_KERNEL Complex expand7(const QVector& q, const Harmonic* h)
+    {
+      Real    Qr[128], Qi[128];
+      Real    Cr[128], Ci[128];
+      Complex z;
+      z = q(h[0], 1); Qr[1] = z.real(); Qi[1] = z.imag();
+      z = q(h[1], 1); Qr[2] = z.real(); Qi[2] = z.imag();
+      z = q(h[0]+h[1], 2); Qr[3] = z.real(); Qi[3] = z.imag();
+      z = q(h[2], 1); Qr[4] = z.real(); Qi[4] = z.imag();
+      z = q(h[0]+h[2], 2); Qr[5] = z.real(); Qi[5] = z.imag();
+      z = q(h[1]+h[2], 2); Qr[6] = z.real(); Qi[6] = z.imag();
+      z = q(h[0]+h[1]+h[2], 3); Qr[7] = z.real(); Qi[7] = z.imag();
+      z = q(h[3], 1); Qr[8] = z.real(); Qi[8] = z.imag();
+      z = q(h[0]+h[3], 2); Qr[9] = z.real(); Qi[9] = z.imag();
+      z = q(h[1]+h[3], 2); Qr[10] = z.real(); Qi[10] = z.imag();
+      z = q(h[0]+h[1]+h[3], 3); Qr[11] = z.real(); Qi[11] = z.imag();
+      z = q(h[2]+h[3], 2); Qr[12] = z.real(); Qi[12] = z.imag();
+      z = q(h[0]+h[2]+h[3], 3); Qr[13] = z.real(); Qi[13] = z.imag();
+      z = q(h[1]+h[2]+h[3], 3); Qr[14] = z.real(); Qi[14] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3], 4); Qr[15] = z.real(); Qi[15] = z.imag();
+      z = q(h[4], 1); Qr[16] = z.real(); Qi[16] = z.imag();
+      z = q(h[0]+h[4], 2); Qr[17] = z.real(); Qi[17] = z.imag();
+      z = q(h[1]+h[4], 2); Qr[18] = z.real(); Qi[18] = z.imag();
+      z = q(h[0]+h[1]+h[4], 3); Qr[19] = z.real(); Qi[19] = z.imag();
+      z = q(h[2]+h[4], 2); Qr[20] = z.real(); Qi[20] = z.imag();
+      z = q(h[0]+h[2]+h[4], 3); Qr[21] = z.real(); Qi[21] = z.imag();
+      z = q(h[1]+h[2]+h[4], 3); Qr[22] = z.real(); Qi[22] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4], 4); Qr[23] = z.real(); Qi[23] = z.imag();
+      z = q(h[3]+h[4], 2); Qr[24] = z.real(); Qi[24] = z.imag();
+      z = q(h[0]+h[3]+h[4], 3); Qr[25] = z.real(); Qi[25] = z.imag();
+      z = q(h[1]+h[3]+h[4], 3); Qr[26] = z.real(); Qi[26] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4], 4); Qr[27] = z.real(); Qi[27] = z.imag();
+      z = q(h[2]+h[3]+h[4], 3); Qr[28] = z.real(); Qi[28] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4], 4); Qr[29] = z.real(); Qi[29] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4], 4); Qr[30] = z.real(); Qi[30] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4], 5); Qr[31] = z.real(); Qi[31] = z.imag();
+      z = q(h[5], 1); Qr[32] = z.real(); Qi[32] = z.imag();
+      z = q(h[0]+h[5], 2); Qr[33] = z.real(); Qi[33] = z.imag();
+      z = q(h[1]+h[5], 2); Qr[34] = z.real(); Qi[34] = z.imag();
+      z = q(h[0]+h[1]+h[5], 3); Qr[35] = z.real(); Qi[35] = z.imag();
+      z = q(h[2]+h[5], 2); Qr[36] = z.real(); Qi[36] = z.imag();
+      z = q(h[0]+h[2]+h[5], 3); Qr[37] = z.real(); Qi[37] = z.imag();
+      z = q(h[1]+h[2]+h[5], 3); Qr[38] = z.real(); Qi[38] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[5], 4); Qr[39] = z.real(); Qi[39] = z.imag();
+      z = q(h[3]+h[5], 2); Qr[40] = z.real(); Qi[40] = z.imag();
+      z = q(h[0]+h[3]+h[5], 3); Qr[41] = z.real(); Qi[41] = z.imag();
+      z = q(h[1]+h[3]+h[5], 3); Qr[42] = z.real(); Qi[42] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[5], 4); Qr[43] = z.real(); Qi[43] = z.imag();
+      z = q(h[2]+h[3]+h[5], 3); Qr[44] = z.real(); Qi[44] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[5], 4); Qr[45] = z.real(); Qi[45] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[5], 4); Qr[46] = z.real(); Qi[46] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[5], 5); Qr[47] = z.real(); Qi[47] = z.imag();
+      z = q(h[4]+h[5], 2); Qr[48] = z.real(); Qi[48] = z.imag();
+      z = q(h[0]+h[4]+h[5], 3); Qr[49] = z.real(); Qi[49] = z.imag();
+      z = q(h[1]+h[4]+h[5], 3); Qr[50] = z.real(); Qi[50] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[5], 4); Qr[51] = z.real(); Qi[51] = z.imag();
+      z = q(h[2]+h[4]+h[5], 3); Qr[52] = z.real(); Qi[52] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[5], 4); Qr[53] = z.real(); Qi[53] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[5], 4); Qr[54] = z.real(); Qi[54] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[5], 5); Qr[55] = z.real(); Qi[55] = z.imag();
+      z = q(h[3]+h[4]+h[5], 3); Qr[56] = z.real(); Qi[56] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[5], 4); Qr[57] = z.real(); Qi[57] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[5], 4); Qr[58] = z.real(); Qi[58] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[5], 5); Qr[59] = z.real(); Qi[59] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[5], 4); Qr[60] = z.real(); Qi[60] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[5], 5); Qr[61] = z.real(); Qi[61] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[5], 5); Qr[62] = z.real(); Qi[62] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[5], 6); Qr[63] = z.real(); Qi[63] = z.imag();
+      z = q(h[6], 1); Qr[64] = z.real(); Qi[64] = z.imag();
+      z = q(h[0]+h[6], 2); Qr[65] = z.real(); Qi[65] = z.imag();
+      z = q(h[1]+h[6], 2); Qr[66] = z.real(); Qi[66] = z.imag();
+      z = q(h[0]+h[1]+h[6], 3); Qr[67] = z.real(); Qi[67] = z.imag();
+      z = q(h[2]+h[6], 2); Qr[68] = z.real(); Qi[68] = z.imag();
+      z = q(h[0]+h[2]+h[6], 3); Qr[69] = z.real(); Qi[69] = z.imag();
+      z = q(h[1]+h[2]+h[6], 3); Qr[70] = z.real(); Qi[70] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[6], 4); Qr[71] = z.real(); Qi[71] = z.imag();
+      z = q(h[3]+h[6], 2); Qr[72] = z.real(); Qi[72] = z.imag();
+      z = q(h[0]+h[3]+h[6], 3); Qr[73] = z.real(); Qi[73] = z.imag();
+      z = q(h[1]+h[3]+h[6], 3); Qr[74] = z.real(); Qi[74] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[6], 4); Qr[75] = z.real(); Qi[75] = z.imag();
+      z = q(h[2]+h[3]+h[6], 3); Qr[76] = z.real(); Qi[76] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[6], 4); Qr[77] = z.real(); Qi[77] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[6], 4); Qr[78] = z.real(); Qi[78] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[6], 5); Qr[79] = z.real(); Qi[79] = z.imag();
+      z = q(h[4]+h[6], 2); Qr[80] = z.real(); Qi[80] = z.imag();
+      z = q(h[0]+h[4]+h[6], 3); Qr[81] = z.real(); Qi[81] = z.imag();
+      z = q(h[1]+h[4]+h[6], 3); Qr[82] = z.real(); Qi[82] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[6], 4); Qr[83] = z.real(); Qi[83] = z.imag();
+      z = q(h[2]+h[4]+h[6], 3); Qr[84] = z.real(); Qi[84] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[6], 4); Qr[85] = z.real(); Qi[85] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[6], 4); Qr[86] = z.real(); Qi[86] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[6], 5); Qr[87] = z.real(); Qi[87] = z.imag();
+      z = q(h[3]+h[4]+h[6], 3); Qr[88] = z.real(); Qi[88] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[6], 4); Qr[89] = z.real(); Qi[89] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[6], 4); Qr[90] = z.real(); Qi[90] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[6], 5); Qr[91] = z.real(); Qi[91] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[6], 4); Qr[92] = z.real(); Qi[92] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[6], 5); Qr[93] = z.real(); Qi[93] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[6], 5); Qr[94] = z.real(); Qi[94] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[6], 6); Qr[95] = z.real(); Qi[95] = z.imag();
+      z = q(h[5]+h[6], 2); Qr[96] = z.real(); Qi[96] = z.imag();
+      z = q(h[0]+h[5]+h[6], 3); Qr[97] = z.real(); Qi[97] = z.imag();
+      z = q(h[1]+h[5]+h[6], 3); Qr[98] = z.real(); Qi[98] = z.imag();
+      z = q(h[0]+h[1]+h[5]+h[6], 4); Qr[99] = z.real(); Qi[99] = z.imag();
+      z = q(h[2]+h[5]+h[6], 3); Qr[100] = z.real(); Qi[100] = z.imag();
+      z = q(h[0]+h[2]+h[5]+h[6], 4); Qr[101] = z.real(); Qi[101] = z.imag();
+      z = q(h[1]+h[2]+h[5]+h[6], 4); Qr[102] = z.real(); Qi[102] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[5]+h[6], 5); Qr[103] = z.real(); Qi[103] = z.imag();
+      z = q(h[3]+h[5]+h[6], 3); Qr[104] = z.real(); Qi[104] = z.imag();
+      z = q(h[0]+h[3]+h[5]+h[6], 4); Qr[105] = z.real(); Qi[105] = z.imag();
+      z = q(h[1]+h[3]+h[5]+h[6], 4); Qr[106] = z.real(); Qi[106] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[5]+h[6], 5); Qr[107] = z.real(); Qi[107] = z.imag();
+      z = q(h[2]+h[3]+h[5]+h[6], 4); Qr[108] = z.real(); Qi[108] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[5]+h[6], 5); Qr[109] = z.real(); Qi[109] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[5]+h[6], 5); Qr[110] = z.real(); Qi[110] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[5]+h[6], 6); Qr[111] = z.real(); Qi[111] = z.imag();
+      z = q(h[4]+h[5]+h[6], 3); Qr[112] = z.real(); Qi[112] = z.imag();
+      z = q(h[0]+h[4]+h[5]+h[6], 4); Qr[113] = z.real(); Qi[113] = z.imag();
+      z = q(h[1]+h[4]+h[5]+h[6], 4); Qr[114] = z.real(); Qi[114] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[5]+h[6], 5); Qr[115] = z.real(); Qi[115] = z.imag();
+      z = q(h[2]+h[4]+h[5]+h[6], 4); Qr[116] = z.real(); Qi[116] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[5]+h[6], 5); Qr[117] = z.real(); Qi[117] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[5]+h[6], 5); Qr[118] = z.real(); Qi[118] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[5]+h[6], 6); Qr[119] = z.real(); Qi[119] = z.imag();
+      z = q(h[3]+h[4]+h[5]+h[6], 4); Qr[120] = z.real(); Qi[120] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[5]+h[6], 5); Qr[121] = z.real(); Qi[121] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[5]+h[6], 5); Qr[122] = z.real(); Qi[122] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[5]+h[6], 6); Qr[123] = z.real(); Qi[123] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[5]+h[6], 5); Qr[124] = z.real(); Qi[124] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[5]+h[6], 6); Qr[125] = z.real(); Qi[125] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[5]+h[6], 6); Qr[126] = z.real(); Qi[126] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[5]+h[6], 7); Qr[127] = z.real(); Qi[127] = z.imag();
+      expand7Part0(Qr, Qi, Cr, Ci);
+      expand7Part1(Qr, Qi, Cr, Ci);
+      expand7Part2(Qr, Qi, Cr, Ci);
+      return Complex(Cr[127], Ci[127]);
+    }
+  }
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
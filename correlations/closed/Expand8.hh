@@ -0,0 +1,4481 @@
+// Generated by print -t closed -- do not edit
+#ifndef CORRELATIONS_CLOSED_EXPAND8_HH
+#define CORRELATIONS_CLOSED_EXPAND8_HH
+/**
+ * @file   correlations/closed/Expand8.hh
+ *
+ * @brief  Closed-form expression of the 8 particle correlator
+ *
+ * Generated by @c print @c -t @c closed.  Include this through
+ * correlations/Kernels.hh.
+ */
+#include <correlations/QVector.hh>
+
+namespace correlations {
+  namespace closed {
+    /** Part 0 of expand8 */
+    inline CORRELATIONS_NOINLINE void
+    expand8Part0(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[2] =
+	Qr[2];
+      Ci[2] =
+	Qi[2];
+
+      Cr[4] =
+	Qr[4];
+      Ci[4] =
+	Qi[4];
+
+      Cr[6] =
+	Qr[6];
+      Ci[6] =
+	Qi[6];
+      Cr[6] =
+	Qr[2] * Cr[4] - Qi[2] * Ci[4]
+	- Cr[6];
+      Ci[6] =
+	Qr[2] * Ci[4] + Qi[2] * Cr[4]
+	- Ci[6];
+
+      Cr[8] =
+	Qr[8];
+      Ci[8] =
+	Qi[8];
+
+      Cr[10] =
+	Qr[10];
+      Ci[10] =
+	Qi[10];
+      Cr[10] =
+	Qr[2] * Cr[8] - Qi[2] * Ci[8]
+	- Cr[10];
+      Ci[10] =
+	Qr[2] * Ci[8] + Qi[2] * Cr[8]
+	- Ci[10];
+
+      Cr[12] =
+	Qr[12];
+      Ci[12] =
+	Qi[12];
+      Cr[12] =
+	Qr[4] * Cr[8] - Qi[4] * Ci[8]
+	- Cr[12];
+      Ci[12] =
+	Qr[4] * Ci[8] + Qi[4] * Cr[8]
+	- Ci[12];
+
+      Cr[14] =
+	Qr[14];
+      Ci[14] =
+	Qi[14];
+      Cr[14] =
+	Qr[10] * Cr[4] - Qi[10] * Ci[4]
+	+ Qr[6] * Cr[8] - Qi[6] * Ci[8]
+	- 2. * Cr[14];
+      Ci[14] =
+	Qr[10] * Ci[4] + Qi[10] * Cr[4]
+	+ Qr[6] * Ci[8] + Qi[6] * Cr[8]
+	- 2. * Ci[14];
+      Cr[14] =
+	Qr[2] * Cr[12] - Qi[2] * Ci[12]
+	- Cr[14];
+      Ci[14] =
+	Qr[2] * Ci[12] + Qi[2] * Cr[12]
+	- Ci[14];
+
+      Cr[16] =
+	Qr[16];
+      Ci[16] =
+	Qi[16];
+
+      Cr[18] =
+	Qr[18];
+      Ci[18] =
+	Qi[18];
+      Cr[18] =
+	Qr[2] * Cr[16] - Qi[2] * Ci[16]
+	- Cr[18];
+      Ci[18] =
+	Qr[2] * Ci[16] + Qi[2] * Cr[16]
+	- Ci[18];
+
+      Cr[20] =
+	Qr[20];
+      Ci[20] =
+	Qi[20];
+      Cr[20] =
+	Qr[4] * Cr[16] - Qi[4] * Ci[16]
+	- Cr[20];
+      Ci[20] =
+	Qr[4] * Ci[16] + Qi[4] * Cr[16]
+	- Ci[20];
+
+      Cr[22] =
+	Qr[22];
+      Ci[22] =
+	Qi[22];
+      Cr[22] =
+	Qr[18] * Cr[4] - Qi[18] * Ci[4]
+	+ Qr[6] * Cr[16] - Qi[6] * Ci[16]
+	- 2. * Cr[22];
+      Ci[22] =
+	Qr[18] * Ci[4] + Qi[18] * Cr[4]
+	+ Qr[6] * Ci[16] + Qi[6] * Cr[16]
+	- 2. * Ci[22];
+      Cr[22] =
+	Qr[2] * Cr[20] - Qi[2] * Ci[20]
+	- Cr[22];
+      Ci[22] =
+	Qr[2] * Ci[20] + Qi[2] * Cr[20]
+	- Ci[22];
+
+      Cr[24] =
+	Qr[24];
+      Ci[24] =
+	Qi[24];
+      Cr[24] =
+	Qr[8] * Cr[16] - Qi[8] * Ci[16]
+	- Cr[24];
+      Ci[24] =
+	Qr[8] * Ci[16] + Qi[8] * Cr[16]
+	- Ci[24];
+
+      Cr[26] =
+	Qr[26];
+      Ci[26] =
+	Qi[26];
+      Cr[26] =
+	Qr[18] * Cr[8] - Qi[18] * Ci[8]
+	+ Qr[10] * Cr[16] - Qi[10] * Ci[16]
+	- 2. * Cr[26];
+      Ci[26] =
+	Qr[18] * Ci[8] + Qi[18] * Cr[8]
+	+ Qr[10] * Ci[16] + Qi[10] * Cr[16]
+	- 2. * Ci[26];
+      Cr[26] =
+	Qr[2] * Cr[24] - Qi[2] * Ci[24]
+	- Cr[26];
+      Ci[26] =
+	Qr[2] * Ci[24] + Qi[2] * Cr[24]
+	- Ci[26];
+
+      Cr[28] =
+	Qr[28];
+      Ci[28] =
+	Qi[28];
+      Cr[28] =
+	Qr[20] * Cr[8] - Qi[20] * Ci[8]
+	+ Qr[12] * Cr[16] - Qi[12] * Ci[16]
+	- 2. * Cr[28];
+      Ci[28] =
+	Qr[20] * Ci[8] + Qi[20] * Cr[8]
+	+ Qr[12] * Ci[16] + Qi[12] * Cr[16]
+	- 2. * Ci[28];
+      Cr[28] =
+	Qr[4] * Cr[24] - Qi[4] * Ci[24]
+	- Cr[28];
+      Ci[28] =
+	Qr[4] * Ci[24] + Qi[4] * Cr[24]
+	- Ci[28];
+
+      Cr[30] =
+	Qr[30];
+      Ci[30] =
+	Qi[30];
+      Cr[30] =
+	Qr[26] * Cr[4] - Qi[26] * Ci[4]
+	+ Qr[22] * Cr[8] - Qi[22] * Ci[8]
+	+ Qr[14] * Cr[16] - Qi[14] * Ci[16]
+	- 3. * Cr[30];
+      Ci[30] =
+	Qr[26] * Ci[4] + Qi[26] * Cr[4]
+	+ Qr[22] * Ci[8] + Qi[22] * Cr[8]
+	+ Qr[14] * Ci[16] + Qi[14] * Cr[16]
+	- 3. * Ci[30];
+      Cr[30] =
+	Qr[18] * Cr[12] - Qi[18] * Ci[12]
+	+ Qr[10] * Cr[20] - Qi[10] * Ci[20]
+	+ Qr[6] * Cr[24] - Qi[6] * Ci[24]
+	- 2. * Cr[30];
+      Ci[30] =
+	Qr[18] * Ci[12] + Qi[18] * Cr[12]
+	+ Qr[10] * Ci[20] + Qi[10] * Cr[20]
+	+ Qr[6] * Ci[24] + Qi[6] * Cr[24]
+	- 2. * Ci[30];
+      Cr[30] =
+	Qr[2] * Cr[28] - Qi[2] * Ci[28]
+	- Cr[30];
+      Ci[30] =
+	Qr[2] * Ci[28] + Qi[2] * Cr[28]
+	- Ci[30];
+
+      Cr[32] =
+	Qr[32];
+      Ci[32] =
+	Qi[32];
+
+      Cr[34] =
+	Qr[34];
+      Ci[34] =
+	Qi[34];
+      Cr[34] =
+	Qr[2] * Cr[32] - Qi[2] * Ci[32]
+	- Cr[34];
+      Ci[34] =
+	Qr[2] * Ci[32] + Qi[2] * Cr[32]
+	- Ci[34];
+
+      Cr[36] =
+	Qr[36];
+      Ci[36] =
+	Qi[36];
+      Cr[36] =
+	Qr[4] * Cr[32] - Qi[4] * Ci[32]
+	- Cr[36];
+      Ci[36] =
+	Qr[4] * Ci[32] + Qi[4] * Cr[32]
+	- Ci[36];
+
+      Cr[38] =
+	Qr[38];
+      Ci[38] =
+	Qi[38];
+      Cr[38] =
+	Qr[34] * Cr[4] - Qi[34] * Ci[4]
+	+ Qr[6] * Cr[32] - Qi[6] * Ci[32]
+	- 2. * Cr[38];
+      Ci[38] =
+	Qr[34] * Ci[4] + Qi[34] * Cr[4]
+	+ Qr[6] * Ci[32] + Qi[6] * Cr[32]
+	- 2. * Ci[38];
+      Cr[38] =
+	Qr[2] * Cr[36] - Qi[2] * Ci[36]
+	- Cr[38];
+      Ci[38] =
+	Qr[2] * Ci[36] + Qi[2] * Cr[36]
+	- Ci[38];
+
+      Cr[40] =
+	Qr[40];
+      Ci[40] =
+	Qi[40];
+      Cr[40] =
+	Qr[8] * Cr[32] - Qi[8] * Ci[32]
+	- Cr[40];
+      Ci[40] =
+	Qr[8] * Ci[32] + Qi[8] * Cr[32]
+	- Ci[40];
+
+      Cr[42] =
+	Qr[42];
+      Ci[42] =
+	Qi[42];
+      Cr[42] =
+	Qr[34] * Cr[8] - Qi[34] * Ci[8]
+	+ Qr[10] * Cr[32] - Qi[10] * Ci[32]
+	- 2. * Cr[42];
+      Ci[42] =
+	Qr[34] * Ci[8] + Qi[34] * Cr[8]
+	+ Qr[10] * Ci[32] + Qi[10] * Cr[32]
+	- 2. * Ci[42];
+      Cr[42] =
+	Qr[2] * Cr[40] - Qi[2] * Ci[40]
+	- Cr[42];
+      Ci[42] =
+	Qr[2] * Ci[40] + Qi[2] * Cr[40]
+	- Ci[42];
+
+      Cr[44] =
+	Qr[44];
+      Ci[44] =
+	Qi[44];
+      Cr[44] =
+	Qr[36] * Cr[8] - Qi[36] * Ci[8]
+	+ Qr[12] * Cr[32] - Qi[12] * Ci[32]
+	- 2. * Cr[44];
+      Ci[44] =
+	Qr[36] * Ci[8] + Qi[36] * Cr[8]
+	+ Qr[12] * Ci[32] + Qi[12] * Cr[32]
+	- 2. * Ci[44];
+      Cr[44] =
+	Qr[4] * Cr[40] - Qi[4] * Ci[40]
+	- Cr[44];
+      Ci[44] =
+	Qr[4] * Ci[40] + Qi[4] * Cr[40]
+	- Ci[44];
+
+      Cr[46] =
+	Qr[46];
+      Ci[46] =
+	Qi[46];
+      Cr[46] =
+	Qr[42] * Cr[4] - Qi[42] * Ci[4]
+	+ Qr[38] * Cr[8] - Qi[38] * Ci[8]
+	+ Qr[14] * Cr[32] - Qi[14] * Ci[32]
+	- 3. * Cr[46];
+      Ci[46] =
+	Qr[42] * Ci[4] + Qi[42] * Cr[4]
+	+ Qr[38] * Ci[8] + Qi[38] * Cr[8]
+	+ Qr[14] * Ci[32] + Qi[14] * Cr[32]
+	- 3. * Ci[46];
+      Cr[46] =
+	Qr[34] * Cr[12] - Qi[34] * Ci[12]
+	+ Qr[10] * Cr[36] - Qi[10] * Ci[36]
+	+ Qr[6] * Cr[40] - Qi[6] * Ci[40]
+	- 2. * Cr[46];
+      Ci[46] =
+	Qr[34] * Ci[12] + Qi[34] * Cr[12]
+	+ Qr[10] * Ci[36] + Qi[10] * Cr[36]
+	+ Qr[6] * Ci[40] + Qi[6] * Cr[40]
+	- 2. * Ci[46];
+      Cr[46] =
+	Qr[2] * Cr[44] - Qi[2] * Ci[44]
+	- Cr[46];
+      Ci[46] =
+	Qr[2] * Ci[44] + Qi[2] * Cr[44]
+	- Ci[46];
+
+      Cr[48] =
+	Qr[48];
+      Ci[48] =
+	Qi[48];
+      Cr[48] =
+	Qr[16] * Cr[32] - Qi[16] * Ci[32]
+	- Cr[48];
+      Ci[48] =
+	Qr[16] * Ci[32] + Qi[16] * Cr[32]
+	- Ci[48];
+
+      Cr[50] =
+	Qr[50];
+      Ci[50] =
+	Qi[50];
+      Cr[50] =
+	Qr[34] * Cr[16] - Qi[34] * Ci[16]
+	+ Qr[18] * Cr[32] - Qi[18] * Ci[32]
+	- 2. * Cr[50];
+      Ci[50] =
+	Qr[34] * Ci[16] + Qi[34] * Cr[16]
+	+ Qr[18] * Ci[32] + Qi[18] * Cr[32]
+	- 2. * Ci[50];
+      Cr[50] =
+	Qr[2] * Cr[48] - Qi[2] * Ci[48]
+	- Cr[50];
+      Ci[50] =
+	Qr[2] * Ci[48] + Qi[2] * Cr[48]
+	- Ci[50];
+
+      Cr[52] =
+	Qr[52];
+      Ci[52] =
+	Qi[52];
+      Cr[52] =
+	Qr[36] * Cr[16] - Qi[36] * Ci[16]
+	+ Qr[20] * Cr[32] - Qi[20] * Ci[32]
+	- 2. * Cr[52];
+      Ci[52] =
+	Qr[36] * Ci[16] + Qi[36] * Cr[16]
+	+ Qr[20] * Ci[32] + Qi[20] * Cr[32]
+	- 2. * Ci[52];
+      Cr[52] =
+	Qr[4] * Cr[48] - Qi[4] * Ci[48]
+	- Cr[52];
+      Ci[52] =
+	Qr[4] * Ci[48] + Qi[4] * Cr[48]
+	- Ci[52];
+
+      Cr[54] =
+	Qr[54];
+      Ci[54] =
+	Qi[54];
+      Cr[54] =
+	Qr[50] * Cr[4] - Qi[50] * Ci[4]
+	+ Qr[38] * Cr[16] - Qi[38] * Ci[16]
+	+ Qr[22] * Cr[32] - Qi[22] * Ci[32]
+	- 3. * Cr[54];
+      Ci[54] =
+	Qr[50] * Ci[4] + Qi[50] * Cr[4]
+	+ Qr[38] * Ci[16] + Qi[38] * Cr[16]
+	+ Qr[22] * Ci[32] + Qi[22] * Cr[32]
+	- 3. * Ci[54];
+      Cr[54] =
+	Qr[34] * Cr[20] - Qi[34] * Ci[20]
+	+ Qr[18] * Cr[36] - Qi[18] * Ci[36]
+	+ Qr[6] * Cr[48] - Qi[6] * Ci[48]
+	- 2. * Cr[54];
+      Ci[54] =
+	Qr[34] * Ci[20] + Qi[34] * Cr[20]
+	+ Qr[18] * Ci[36] + Qi[18] * Cr[36]
+	+ Qr[6] * Ci[48] + Qi[6] * Cr[48]
+	- 2. * Ci[54];
+      Cr[54] =
+	Qr[2] * Cr[52] - Qi[2] * Ci[52]
+	- Cr[54];
+      Ci[54] =
+	Qr[2] * Ci[52] + Qi[2] * Cr[52]
+	- Ci[54];
+
+      Cr[56] =
+	Qr[56];
+      Ci[56] =
+	Qi[56];
+      Cr[56] =
+	Qr[40] * Cr[16] - Qi[40] * Ci[16]
+	+ Qr[24] * Cr[32] - Qi[24] * Ci[32]
+	- 2. * Cr[56];
+      Ci[56] =
+	Qr[40] * Ci[16] + Qi[40] * Cr[16]
+	+ Qr[24] * Ci[32] + Qi[24] * Cr[32]
+	- 2. * Ci[56];
+      Cr[56] =
+	Qr[8] * Cr[48] - Qi[8] * Ci[48]
+	- Cr[56];
+      Ci[56] =
+	Qr[8] * Ci[48] + Qi[8] * Cr[48]
+	- Ci[56];
+
+      Cr[58] =
+	Qr[58];
+      Ci[58] =
+	Qi[58];
+      Cr[58] =
+	Qr[50] * Cr[8] - Qi[50] * Ci[8]
+	+ Qr[42] * Cr[16] - Qi[42] * Ci[16]
+	+ Qr[26] * Cr[32] - Qi[26] * Ci[32]
+	- 3. * Cr[58];
+      Ci[58] =
+	Qr[50] * Ci[8] + Qi[50] * Cr[8]
+	+ Qr[42] * Ci[16] + Qi[42] * Cr[16]
+	+ Qr[26] * Ci[32] + Qi[26] * Cr[32]
+	- 3. * Ci[58];
+      Cr[58] =
+	Qr[34] * Cr[24] - Qi[34] * Ci[24]
+	+ Qr[18] * Cr[40] - Qi[18] * Ci[40]
+	+ Qr[10] * Cr[48] - Qi[10] * Ci[48]
+	- 2. * Cr[58];
+      Ci[58] =
+	Qr[34] * Ci[24] + Qi[34] * Cr[24]
+	+ Qr[18] * Ci[40] + Qi[18] * Cr[40]
+	+ Qr[10] * Ci[48] + Qi[10] * Cr[48]
+	- 2. * Ci[58];
+      Cr[58] =
+	Qr[2] * Cr[56] - Qi[2] * Ci[56]
+	- Cr[58];
+      Ci[58] =
+	Qr[2] * Ci[56] + Qi[2] * Cr[56]
+	- Ci[58];
+
+      Cr[60] =
+	Qr[60];
+      Ci[60] =
+	Qi[60];
+      Cr[60] =
+	Qr[52] * Cr[8] - Qi[52] * Ci[8]
+	+ Qr[44] * Cr[16] - Qi[44] * Ci[16]
+	+ Qr[28] * Cr[32] - Qi[28] * Ci[32]
+	- 3. * Cr[60];
+      Ci[60] =
+	Qr[52] * Ci[8] + Qi[52] * Cr[8]
+	+ Qr[44] * Ci[16] + Qi[44] * Cr[16]
+	+ Qr[28] * Ci[32] + Qi[28] * Cr[32]
+	- 3. * Ci[60];
+      Cr[60] =
+	Qr[36] * Cr[24] - Qi[36] * Ci[24]
+	+ Qr[20] * Cr[40] - Qi[20] * Ci[40]
+	+ Qr[12] * Cr[48] - Qi[12] * Ci[48]
+	- 2. * Cr[60];
+      Ci[60] =
+	Qr[36] * Ci[24] + Qi[36] * Cr[24]
+	+ Qr[20] * Ci[40] + Qi[20] * Cr[40]
+	+ Qr[12] * Ci[48] + Qi[12] * Cr[48]
+	- 2. * Ci[60];
+      Cr[60] =
+	Qr[4] * Cr[56] - Qi[4] * Ci[56]
+	- Cr[60];
+      Ci[60] =
+	Qr[4] * Ci[56] + Qi[4] * Cr[56]
+	- Ci[60];
+
+      Cr[62] =
+	Qr[62];
+      Ci[62] =
+	Qi[62];
+      Cr[62] =
+	Qr[58] * Cr[4] - Qi[58] * Ci[4]
+	+ Qr[54] * Cr[8] - Qi[54] * Ci[8]
+	+ Qr[46] * Cr[16] - Qi[46] * Ci[16]
+	+ Qr[30] * Cr[32] - Qi[30] * Ci[32]
+	- 4. * Cr[62];
+      Ci[62] =
+	Qr[58] * Ci[4] + Qi[58] * Cr[4]
+	+ Qr[54] * Ci[8] + Qi[54] * Cr[8]
+	+ Qr[46] * Ci[16] + Qi[46] * Cr[16]
+	+ Qr[30] * Ci[32] + Qi[30] * Cr[32]
+	- 4. * Ci[62];
+      Cr[62] =
+	Qr[50] * Cr[12] - Qi[50] * Ci[12]
+	+ Qr[42] * Cr[20] - Qi[42] * Ci[20]
+	+ Qr[38] * Cr[24] - Qi[38] * Ci[24]
+	+ Qr[26] * Cr[36] - Qi[26] * Ci[36]
+	+ Qr[22] * Cr[40] - Qi[22] * Ci[40]
+	+ Qr[14] * Cr[48] - Qi[14] * Ci[48]
+	- 3. * Cr[62];
+      Ci[62] =
+	Qr[50] * Ci[12] + Qi[50] * Cr[12]
+	+ Qr[42] * Ci[20] + Qi[42] * Cr[20]
+	+ Qr[38] * Ci[24] + Qi[38] * Cr[24]
+	+ Qr[26] * Ci[36] + Qi[26] * Cr[36]
+	+ Qr[22] * Ci[40] + Qi[22] * Cr[40]
+	+ Qr[14] * Ci[48] + Qi[14] * Cr[48]
+	- 3. * Ci[62];
+      Cr[62] =
+	Qr[34] * Cr[28] - Qi[34] * Ci[28]
+	+ Qr[18] * Cr[44] - Qi[18] * Ci[44]
+	+ Qr[10] * Cr[52] - Qi[10] * Ci[52]
+	+ Qr[6] * Cr[56] - Qi[6] * Ci[56]
+	- 2. * Cr[62];
+      Ci[62] =
+	Qr[34] * Ci[28] + Qi[34] * Cr[28]
+	+ Qr[18] * Ci[44] + Qi[18] * Cr[44]
+	+ Qr[10] * Ci[52] + Qi[10] * Cr[52]
+	+ Qr[6] * Ci[56] + Qi[6] * Cr[56]
+	- 2. * Ci[62];
+      Cr[62] =
+	Qr[2] * Cr[60] - Qi[2] * Ci[60]
+	- Cr[62];
+      Ci[62] =
+	Qr[2] * Ci[60] + Qi[2] * Cr[60]
+	- Ci[62];
+
+      Cr[64] =
+	Qr[64];
+      Ci[64] =
+	Qi[64];
+
+      Cr[66] =
+	Qr[66];
+      Ci[66] =
+	Qi[66];
+      Cr[66] =
+	Qr[2] * Cr[64] - Qi[2] * Ci[64]
+	- Cr[66];
+      Ci[66] =
+	Qr[2] * Ci[64] + Qi[2] * Cr[64]
+	- Ci[66];
+
+      Cr[68] =
+	Qr[68];
+      Ci[68] =
+	Qi[68];
+      Cr[68] =
+	Qr[4] * Cr[64] - Qi[4] * Ci[64]
+	- Cr[68];
+      Ci[68] =
+	Qr[4] * Ci[64] + Qi[4] * Cr[64]
+	- Ci[68];
+
+      Cr[70] =
+	Qr[70];
+      Ci[70] =
+	Qi[70];
+      Cr[70] =
+	Qr[66] * Cr[4] - Qi[66] * Ci[4]
+	+ Qr[6] * Cr[64] - Qi[6] * Ci[64]
+	- 2. * Cr[70];
+      Ci[70] =
+	Qr[66] * Ci[4] + Qi[66] * Cr[4]
+	+ Qr[6] * Ci[64] + Qi[6] * Cr[64]
+	- 2. * Ci[70];
+      Cr[70] =
+	Qr[2] * Cr[68] - Qi[2] * Ci[68]
+	- Cr[70];
+      Ci[70] =
+	Qr[2] * Ci[68] + Qi[2] * Cr[68]
+	- Ci[70];
+    }
+
+    /** Part 1 of expand8 */
+    inline CORRELATIONS_NOINLINE void
+    expand8Part1(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[72] =
+	Qr[72];
+      Ci[72] =
+	Qi[72];
+      Cr[72] =
+	Qr[8] * Cr[64] - Qi[8] * Ci[64]
+	- Cr[72];
+      Ci[72] =
+	Qr[8] * Ci[64] + Qi[8] * Cr[64]
+	- Ci[72];
+
+      Cr[74] =
+	Qr[74];
+      Ci[74] =
+	Qi[74];
+      Cr[74] =
+	Qr[66] * Cr[8] - Qi[66] * Ci[8]
+	+ Qr[10] * Cr[64] - Qi[10] * Ci[64]
+	- 2. * Cr[74];
+      Ci[74] =
+	Qr[66] * Ci[8] + Qi[66] * Cr[8]
+	+ Qr[10] * Ci[64] + Qi[10] * Cr[64]
+	- 2. * Ci[74];
+      Cr[74] =
+	Qr[2] * Cr[72] - Qi[2] * Ci[72]
+	- Cr[74];
+      Ci[74] =
+	Qr[2] * Ci[72] + Qi[2] * Cr[72]
+	- Ci[74];
+
+      Cr[76] =
+	Qr[76];
+      Ci[76] =
+	Qi[76];
+      Cr[76] =
+	Qr[68] * Cr[8] - Qi[68] * Ci[8]
+	+ Qr[12] * Cr[64] - Qi[12] * Ci[64]
+	- 2. * Cr[76];
+      Ci[76] =
+	Qr[68] * Ci[8] + Qi[68] * Cr[8]
+	+ Qr[12] * Ci[64] + Qi[12] * Cr[64]
+	- 2. * Ci[76];
+      Cr[76] =
+	Qr[4] * Cr[72] - Qi[4] * Ci[72]
+	- Cr[76];
+      Ci[76] =
+	Qr[4] * Ci[72] + Qi[4] * Cr[72]
+	- Ci[76];
+
+      Cr[78] =
+	Qr[78];
+      Ci[78] =
+	Qi[78];
+      Cr[78] =
+	Qr[74] * Cr[4] - Qi[74] * Ci[4]
+	+ Qr[70] * Cr[8] - Qi[70] * Ci[8]
+	+ Qr[14] * Cr[64] - Qi[14] * Ci[64]
+	- 3. * Cr[78];
+      Ci[78] =
+	Qr[74] * Ci[4] + Qi[74] * Cr[4]
+	+ Qr[70] * Ci[8] + Qi[70] * Cr[8]
+	+ Qr[14] * Ci[64] + Qi[14] * Cr[64]
+	- 3. * Ci[78];
+      Cr[78] =
+	Qr[66] * Cr[12] - Qi[66] * Ci[12]
+	+ Qr[10] * Cr[68] - Qi[10] * Ci[68]
+	+ Qr[6] * Cr[72] - Qi[6] * Ci[72]
+	- 2. * Cr[78];
+      Ci[78] =
+	Qr[66] * Ci[12] + Qi[66] * Cr[12]
+	+ Qr[10] * Ci[68] + Qi[10] * Cr[68]
+	+ Qr[6] * Ci[72] + Qi[6] * Cr[72]
+	- 2. * Ci[78];
+      Cr[78] =
+	Qr[2] * Cr[76] - Qi[2] * Ci[76]
+	- Cr[78];
+      Ci[78] =
+	Qr[2] * Ci[76] + Qi[2] * Cr[76]
+	- Ci[78];
+
+      Cr[80] =
+	Qr[80];
+      Ci[80] =
+	Qi[80];
+      Cr[80] =
+	Qr[16] * Cr[64] - Qi[16] * Ci[64]
+	- Cr[80];
+      Ci[80] =
+	Qr[16] * Ci[64] + Qi[16] * Cr[64]
+	- Ci[80];
+
+      Cr[82] =
+	Qr[82];
+      Ci[82] =
+	Qi[82];
+      Cr[82] =
+	Qr[66] * Cr[16] - Qi[66] * Ci[16]
+	+ Qr[18] * Cr[64] - Qi[18] * Ci[64]
+	- 2. * Cr[82];
+      Ci[82] =
+	Qr[66] * Ci[16] + Qi[66] * Cr[16]
+	+ Qr[18] * Ci[64] + Qi[18] * Cr[64]
+	- 2. * Ci[82];
+      Cr[82] =
+	Qr[2] * Cr[80] - Qi[2] * Ci[80]
+	- Cr[82];
+      Ci[82] =
+	Qr[2] * Ci[80] + Qi[2] * Cr[80]
+	- Ci[82];
+
+      Cr[84] =
+	Qr[84];
+      Ci[84] =
+	Qi[84];
+      Cr[84] =
+	Qr[68] * Cr[16] - Qi[68] * Ci[16]
+	+ Qr[20] * Cr[64] - Qi[20] * Ci[64]
+	- 2. * Cr[84];
+      Ci[84] =
+	Qr[68] * Ci[16] + Qi[68] * Cr[16]
+	+ Qr[20] * Ci[64] + Qi[20] * Cr[64]
+	- 2. * Ci[84];
+      Cr[84] =
+	Qr[4] * Cr[80] - Qi[4] * Ci[80]
+	- Cr[84];
+      Ci[84] =
+	Qr[4] * Ci[80] + Qi[4] * Cr[80]
+	- Ci[84];
+
+      Cr[86] =
+	Qr[86];
+      Ci[86] =
+	Qi[86];
+      Cr[86] =
+	Qr[82] * Cr[4] - Qi[82] * Ci[4]
+	+ Qr[70] * Cr[16] - Qi[70] * Ci[16]
+	+ Qr[22] * Cr[64] - Qi[22] * Ci[64]
+	- 3. * Cr[86];
+      Ci[86] =
+	Qr[82] * Ci[4] + Qi[82] * Cr[4]
+	+ Qr[70] * Ci[16] + Qi[70] * Cr[16]
+	+ Qr[22] * Ci[64] + Qi[22] * Cr[64]
+	- 3. * Ci[86];
+      Cr[86] =
+	Qr[66] * Cr[20] - Qi[66] * Ci[20]
+	+ Qr[18] * Cr[68] - Qi[18] * Ci[68]
+	+ Qr[6] * Cr[80] - Qi[6] * Ci[80]
+	- 2. * Cr[86];
+      Ci[86] =
+	Qr[66] * Ci[20] + Qi[66] * Cr[20]
+	+ Qr[18] * Ci[68] + Qi[18] * Cr[68]
+	+ Qr[6] * Ci[80] + Qi[6] * Cr[80]
+	- 2. * Ci[86];
+      Cr[86] =
+	Qr[2] * Cr[84] - Qi[2] * Ci[84]
+	- Cr[86];
+      Ci[86] =
+	Qr[2] * Ci[84] + Qi[2] * Cr[84]
+	- Ci[86];
+
+      Cr[88] =
+	Qr[88];
+      Ci[88] =
+	Qi[88];
+      Cr[88] =
+	Qr[72] * Cr[16] - Qi[72] * Ci[16]
+	+ Qr[24] * Cr[64] - Qi[24] * Ci[64]
+	- 2. * Cr[88];
+      Ci[88] =
+	Qr[72] * Ci[16] + Qi[72] * Cr[16]
+	+ Qr[24] * Ci[64] + Qi[24] * Cr[64]
+	- 2. * Ci[88];
+      Cr[88] =
+	Qr[8] * Cr[80] - Qi[8] * Ci[80]
+	- Cr[88];
+      Ci[88] =
+	Qr[8] * Ci[80] + Qi[8] * Cr[80]
+	- Ci[88];
+
+      Cr[90] =
+	Qr[90];
+      Ci[90] =
+	Qi[90];
+      Cr[90] =
+	Qr[82] * Cr[8] - Qi[82] * Ci[8]
+	+ Qr[74] * Cr[16] - Qi[74] * Ci[16]
+	+ Qr[26] * Cr[64] - Qi[26] * Ci[64]
+	- 3. * Cr[90];
+      Ci[90] =
+	Qr[82] * Ci[8] + Qi[82] * Cr[8]
+	+ Qr[74] * Ci[16] + Qi[74] * Cr[16]
+	+ Qr[26] * Ci[64] + Qi[26] * Cr[64]
+	- 3. * Ci[90];
+      Cr[90] =
+	Qr[66] * Cr[24] - Qi[66] * Ci[24]
+	+ Qr[18] * Cr[72] - Qi[18] * Ci[72]
+	+ Qr[10] * Cr[80] - Qi[10] * Ci[80]
+	- 2. * Cr[90];
+      Ci[90] =
+	Qr[66] * Ci[24] + Qi[66] * Cr[24]
+	+ Qr[18] * Ci[72] + Qi[18] * Cr[72]
+	+ Qr[10] * Ci[80] + Qi[10] * Cr[80]
+	- 2. * Ci[90];
+      Cr[90] =
+	Qr[2] * Cr[88] - Qi[2] * Ci[88]
+	- Cr[90];
+      Ci[90] =
+	Qr[2] * Ci[88] + Qi[2] * Cr[88]
+	- Ci[90];
+
+      Cr[92] =
+	Qr[92];
+      Ci[92] =
+	Qi[92];
+      Cr[92] =
+	Qr[84] * Cr[8] - Qi[84] * Ci[8]
+	+ Qr[76] * Cr[16] - Qi[76] * Ci[16]
+	+ Qr[28] * Cr[64] - Qi[28] * Ci[64]
+	- 3. * Cr[92];
+      Ci[92] =
+	Qr[84] * Ci[8] + Qi[84] * Cr[8]
+	+ Qr[76] * Ci[16] + Qi[76] * Cr[16]
+	+ Qr[28] * Ci[64] + Qi[28] * Cr[64]
+	- 3. * Ci[92];
+      Cr[92] =
+	Qr[68] * Cr[24] - Qi[68] * Ci[24]
+	+ Qr[20] * Cr[72] - Qi[20] * Ci[72]
+	+ Qr[12] * Cr[80] - Qi[12] * Ci[80]
+	- 2. * Cr[92];
+      Ci[92] =
+	Qr[68] * Ci[24] + Qi[68] * Cr[24]
+	+ Qr[20] * Ci[72] + Qi[20] * Cr[72]
+	+ Qr[12] * Ci[80] + Qi[12] * Cr[80]
+	- 2. * Ci[92];
+      Cr[92] =
+	Qr[4] * Cr[88] - Qi[4] * Ci[88]
+	- Cr[92];
+      Ci[92] =
+	Qr[4] * Ci[88] + Qi[4] * Cr[88]
+	- Ci[92];
+
+      Cr[94] =
+	Qr[94];
+      Ci[94] =
+	Qi[94];
+      Cr[94] =
+	Qr[90] * Cr[4] - Qi[90] * Ci[4]
+	+ Qr[86] * Cr[8] - Qi[86] * Ci[8]
+	+ Qr[78] * Cr[16] - Qi[78] * Ci[16]
+	+ Qr[30] * Cr[64] - Qi[30] * Ci[64]
+	- 4. * Cr[94];
+      Ci[94] =
+	Qr[90] * Ci[4] + Qi[90] * Cr[4]
+	+ Qr[86] * Ci[8] + Qi[86] * Cr[8]
+	+ Qr[78] * Ci[16] + Qi[78] * Cr[16]
+	+ Qr[30] * Ci[64] + Qi[30] * Cr[64]
+	- 4. * Ci[94];
+      Cr[94] =
+	Qr[82] * Cr[12] - Qi[82] * Ci[12]
+	+ Qr[74] * Cr[20] - Qi[74] * Ci[20]
+	+ Qr[70] * Cr[24] - Qi[70] * Ci[24]
+	+ Qr[26] * Cr[68] - Qi[26] * Ci[68]
+	+ Qr[22] * Cr[72] - Qi[22] * Ci[72]
+	+ Qr[14] * Cr[80] - Qi[14] * Ci[80]
+	- 3. * Cr[94];
+      Ci[94] =
+	Qr[82] * Ci[12] + Qi[82] * Cr[12]
+	+ Qr[74] * Ci[20] + Qi[74] * Cr[20]
+	+ Qr[70] * Ci[24] + Qi[70] * Cr[24]
+	+ Qr[26] * Ci[68] + Qi[26] * Cr[68]
+	+ Qr[22] * Ci[72] + Qi[22] * Cr[72]
+	+ Qr[14] * Ci[80] + Qi[14] * Cr[80]
+	- 3. * Ci[94];
+      Cr[94] =
+	Qr[66] * Cr[28] - Qi[66] * Ci[28]
+	+ Qr[18] * Cr[76] - Qi[18] * Ci[76]
+	+ Qr[10] * Cr[84] - Qi[10] * Ci[84]
+	+ Qr[6] * Cr[88] - Qi[6] * Ci[88]
+	- 2. * Cr[94];
+      Ci[94] =
+	Qr[66] * Ci[28] + Qi[66] * Cr[28]
+	+ Qr[18] * Ci[76] + Qi[18] * Cr[76]
+	+ Qr[10] * Ci[84] + Qi[10] * Cr[84]
+	+ Qr[6] * Ci[88] + Qi[6] * Cr[88]
+	- 2. * Ci[94];
+      Cr[94] =
+	Qr[2] * Cr[92] - Qi[2] * Ci[92]
+	- Cr[94];
+      Ci[94] =
+	Qr[2] * Ci[92] + Qi[2] * Cr[92]
+	- Ci[94];
+
+      Cr[96] =
+	Qr[96];
+      Ci[96] =
+	Qi[96];
+      Cr[96] =
+	Qr[32] * Cr[64] - Qi[32] * Ci[64]
+	- Cr[96];
+      Ci[96] =
+	Qr[32] * Ci[64] + Qi[32] * Cr[64]
+	- Ci[96];
+
+      Cr[98] =
+	Qr[98];
+      Ci[98] =
+	Qi[98];
+      Cr[98] =
+	Qr[66] * Cr[32] - Qi[66] * Ci[32]
+	+ Qr[34] * Cr[64] - Qi[34] * Ci[64]
+	- 2. * Cr[98];
+      Ci[98] =
+	Qr[66] * Ci[32] + Qi[66] * Cr[32]
+	+ Qr[34] * Ci[64] + Qi[34] * Cr[64]
+	- 2. * Ci[98];
+      Cr[98] =
+	Qr[2] * Cr[96] - Qi[2] * Ci[96]
+	- Cr[98];
+      Ci[98] =
+	Qr[2] * Ci[96] + Qi[2] * Cr[96]
+	- Ci[98];
+
+      Cr[100] =
+	Qr[100];
+      Ci[100] =
+	Qi[100];
+      Cr[100] =
+	Qr[68] * Cr[32] - Qi[68] * Ci[32]
+	+ Qr[36] * Cr[64] - Qi[36] * Ci[64]
+	- 2. * Cr[100];
+      Ci[100] =
+	Qr[68] * Ci[32] + Qi[68] * Cr[32]
+	+ Qr[36] * Ci[64] + Qi[36] * Cr[64]
+	- 2. * Ci[100];
+      Cr[100] =
+	Qr[4] * Cr[96] - Qi[4] * Ci[96]
+	- Cr[100];
+      Ci[100] =
+	Qr[4] * Ci[96] + Qi[4] * Cr[96]
+	- Ci[100];
+
+      Cr[102] =
+	Qr[102];
+      Ci[102] =
+	Qi[102];
+      Cr[102] =
+	Qr[98] * Cr[4] - Qi[98] * Ci[4]
+	+ Qr[70] * Cr[32] - Qi[70] * Ci[32]
+	+ Qr[38] * Cr[64] - Qi[38] * Ci[64]
+	- 3. * Cr[102];
+      Ci[102] =
+	Qr[98] * Ci[4] + Qi[98] * Cr[4]
+	+ Qr[70] * Ci[32] + Qi[70] * Cr[32]
+	+ Qr[38] * Ci[64] + Qi[38] * Cr[64]
+	- 3. * Ci[102];
+      Cr[102] =
+	Qr[66] * Cr[36] - Qi[66] * Ci[36]
+	+ Qr[34] * Cr[68] - Qi[34] * Ci[68]
+	+ Qr[6] * Cr[96] - Qi[6] * Ci[96]
+	- 2. * Cr[102];
+      Ci[102] =
+	Qr[66] * Ci[36] + Qi[66] * Cr[36]
+	+ Qr[34] * Ci[68] + Qi[34] * Cr[68]
+	+ Qr[6] * Ci[96] + Qi[6] * Cr[96]
+	- 2. * Ci[102];
+      Cr[102] =
+	Qr[2] * Cr[100] - Qi[2] * Ci[100]
+	- Cr[102];
+      Ci[102] =
+	Qr[2] * Ci[100] + Qi[2] * Cr[100]
+	- Ci[102];
+
+      Cr[104] =
+	Qr[104];
+      Ci[104] =
+	Qi[104];
+      Cr[104] =
+	Qr[72] * Cr[32] - Qi[72] * Ci[32]
+	+ Qr[40] * Cr[64] - Qi[40] * Ci[64]
+	- 2. * Cr[104];
+      Ci[104] =
+	Qr[72] * Ci[32] + Qi[72] * Cr[32]
+	+ Qr[40] * Ci[64] + Qi[40] * Cr[64]
+	- 2. * Ci[104];
+      Cr[104] =
+	Qr[8] * Cr[96] - Qi[8] * Ci[96]
+	- Cr[104];
+      Ci[104] =
+	Qr[8] * Ci[96] + Qi[8] * Cr[96]
+	- Ci[104];
+
+      Cr[106] =
+	Qr[106];
+      Ci[106] =
+	Qi[106];
+      Cr[106] =
+	Qr[98] * Cr[8] - Qi[98] * Ci[8]
+	+ Qr[74] * Cr[32] - Qi[74] * Ci[32]
+	+ Qr[42] * Cr[64] - Qi[42] * Ci[64]
+	- 3. * Cr[106];
+      Ci[106] =
+	Qr[98] * Ci[8] + Qi[98] * Cr[8]
+	+ Qr[74] * Ci[32] + Qi[74] * Cr[32]
+	+ Qr[42] * Ci[64] + Qi[42] * Cr[64]
+	- 3. * Ci[106];
+      Cr[106] =
+	Qr[66] * Cr[40] - Qi[66] * Ci[40]
+	+ Qr[34] * Cr[72] - Qi[34] * Ci[72]
+	+ Qr[10] * Cr[96] - Qi[10] * Ci[96]
+	- 2. * Cr[106];
+      Ci[106] =
+	Qr[66] * Ci[40] + Qi[66] * Cr[40]
+	+ Qr[34] * Ci[72] + Qi[34] * Cr[72]
+	+ Qr[10] * Ci[96] + Qi[10] * Cr[96]
+	- 2. * Ci[106];
+      Cr[106] =
+	Qr[2] * Cr[104] - Qi[2] * Ci[104]
+	- Cr[106];
+      Ci[106] =
+	Qr[2] * Ci[104] + Qi[2] * Cr[104]
+	- Ci[106];
+
+      Cr[108] =
+	Qr[108];
+      Ci[108] =
+	Qi[108];
+      Cr[108] =
+	Qr[100] * Cr[8] - Qi[100] * Ci[8]
+	+ Qr[76] * Cr[32] - Qi[76] * Ci[32]
+	+ Qr[44] * Cr[64] - Qi[44] * Ci[64]
+	- 3. * Cr[108];
+      Ci[108] =
+	Qr[100] * Ci[8] + Qi[100] * Cr[8]
+	+ Qr[76] * Ci[32] + Qi[76] * Cr[32]
+	+ Qr[44] * Ci[64] + Qi[44] * Cr[64]
+	- 3. * Ci[108];
+      Cr[108] =
+	Qr[68] * Cr[40] - Qi[68] * Ci[40]
+	+ Qr[36] * Cr[72] - Qi[36] * Ci[72]
+	+ Qr[12] * Cr[96] - Qi[12] * Ci[96]
+	- 2. * Cr[108];
+      Ci[108] =
+	Qr[68] * Ci[40] + Qi[68] * Cr[40]
+	+ Qr[36] * Ci[72] + Qi[36] * Cr[72]
+	+ Qr[12] * Ci[96] + Qi[12] * Cr[96]
+	- 2. * Ci[108];
+      Cr[108] =
+	Qr[4] * Cr[104] - Qi[4] * Ci[104]
+	- Cr[108];
+      Ci[108] =
+	Qr[4] * Ci[104] + Qi[4] * Cr[104]
+	- Ci[108];
+
+      Cr[110] =
+	Qr[110];
+      Ci[110] =
+	Qi[110];
+      Cr[110] =
+	Qr[106] * Cr[4] - Qi[106] * Ci[4]
+	+ Qr[102] * Cr[8] - Qi[102] * Ci[8]
+	+ Qr[78] * Cr[32] - Qi[78] * Ci[32]
+	+ Qr[46] * Cr[64] - Qi[46] * Ci[64]
+	- 4. * Cr[110];
+      Ci[110] =
+	Qr[106] * Ci[4] + Qi[106] * Cr[4]
+	+ Qr[102] * Ci[8] + Qi[102] * Cr[8]
+	+ Qr[78] * Ci[32] + Qi[78] * Cr[32]
+	+ Qr[46] * Ci[64] + Qi[46] * Cr[64]
+	- 4. * Ci[110];
+      Cr[110] =
+	Qr[98] * Cr[12] - Qi[98] * Ci[12]
+	+ Qr[74] * Cr[36] - Qi[74] * Ci[36]
+	+ Qr[70] * Cr[40] - Qi[70] * Ci[40]
+	+ Qr[42] * Cr[68] - Qi[42] * Ci[68]
+	+ Qr[38] * Cr[72] - Qi[38] * Ci[72]
+	+ Qr[14] * Cr[96] - Qi[14] * Ci[96]
+	- 3. * Cr[110];
+      Ci[110] =
+	Qr[98] * Ci[12] + Qi[98] * Cr[12]
+	+ Qr[74] * Ci[36] + Qi[74] * Cr[36]
+	+ Qr[70] * Ci[40] + Qi[70] * Cr[40]
+	+ Qr[42] * Ci[68] + Qi[42] * Cr[68]
+	+ Qr[38] * Ci[72] + Qi[38] * Cr[72]
+	+ Qr[14] * Ci[96] + Qi[14] * Cr[96]
+	- 3. * Ci[110];
+      Cr[110] =
+	Qr[66] * Cr[44] - Qi[66] * Ci[44]
+	+ Qr[34] * Cr[76] - Qi[34] * Ci[76]
+	+ Qr[10] * Cr[100] - Qi[10] * Ci[100]
+	+ Qr[6] * Cr[104] - Qi[6] * Ci[104]
+	- 2. * Cr[110];
+      Ci[110] =
+	Qr[66] * Ci[44] + Qi[66] * Cr[44]
+	+ Qr[34] * Ci[76] + Qi[34] * Cr[76]
+	+ Qr[10] * Ci[100] + Qi[10] * Cr[100]
+	+ Qr[6] * Ci[104] + Qi[6] * Cr[104]
+	- 2. * Ci[110];
+      Cr[110] =
+	Qr[2] * Cr[108] - Qi[2] * Ci[108]
+	- Cr[110];
+      Ci[110] =
+	Qr[2] * Ci[108] + Qi[2] * Cr[108]
+	- Ci[110];
+
+      Cr[112] =
+	Qr[112];
+      Ci[112] =
+	Qi[112];
+      Cr[112] =
+	Qr[80] * Cr[32] - Qi[80] * Ci[32]
+	+ Qr[48] * Cr[64] - Qi[48] * Ci[64]
+	- 2. * Cr[112];
+      Ci[112] =
+	Qr[80] * Ci[32] + Qi[80] * Cr[32]
+	+ Qr[48] * Ci[64] + Qi[48] * Cr[64]
+	- 2. * Ci[112];
+      Cr[112] =
+	Qr[16] * Cr[96] - Qi[16] * Ci[96]
+	- Cr[112];
+      Ci[112] =
+	Qr[16] * Ci[96] + Qi[16] * Cr[96]
+	- Ci[112];
+    }
+
+    /** Part 2 of expand8 */
+    inline CORRELATIONS_NOINLINE void
+    expand8Part2(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[114] =
+	Qr[114];
+      Ci[114] =
+	Qi[114];
+      Cr[114] =
+	Qr[98] * Cr[16] - Qi[98] * Ci[16]
+	+ Qr[82] * Cr[32] - Qi[82] * Ci[32]
+	+ Qr[50] * Cr[64] - Qi[50] * Ci[64]
+	- 3. * Cr[114];
+      Ci[114] =
+	Qr[98] * Ci[16] + Qi[98] * Cr[16]
+	+ Qr[82] * Ci[32] + Qi[82] * Cr[32]
+	+ Qr[50] * Ci[64] + Qi[50] * Cr[64]
+	- 3. * Ci[114];
+      Cr[114] =
+	Qr[66] * Cr[48] - Qi[66] * Ci[48]
+	+ Qr[34] * Cr[80] - Qi[34] * Ci[80]
+	+ Qr[18] * Cr[96] - Qi[18] * Ci[96]
+	- 2. * Cr[114];
+      Ci[114] =
+	Qr[66] * Ci[48] + Qi[66] * Cr[48]
+	+ Qr[34] * Ci[80] + Qi[34] * Cr[80]
+	+ Qr[18] * Ci[96] + Qi[18] * Cr[96]
+	- 2. * Ci[114];
+      Cr[114] =
+	Qr[2] * Cr[112] - Qi[2] * Ci[112]
+	- Cr[114];
+      Ci[114] =
+	Qr[2] * Ci[112] + Qi[2] * Cr[112]
+	- Ci[114];
+
+      Cr[116] =
+	Qr[116];
+      Ci[116] =
+	Qi[116];
+      Cr[116] =
+	Qr[100] * Cr[16] - Qi[100] * Ci[16]
+	+ Qr[84] * Cr[32] - Qi[84] * Ci[32]
+	+ Qr[52] * Cr[64] - Qi[52] * Ci[64]
+	- 3. * Cr[116];
+      Ci[116] =
+	Qr[100] * Ci[16] + Qi[100] * Cr[16]
+	+ Qr[84] * Ci[32] + Qi[84] * Cr[32]
+	+ Qr[52] * Ci[64] + Qi[52] * Cr[64]
+	- 3. * Ci[116];
+      Cr[116] =
+	Qr[68] * Cr[48] - Qi[68] * Ci[48]
+	+ Qr[36] * Cr[80] - Qi[36] * Ci[80]
+	+ Qr[20] * Cr[96] - Qi[20] * Ci[96]
+	- 2. * Cr[116];
+      Ci[116] =
+	Qr[68] * Ci[48] + Qi[68] * Cr[48]
+	+ Qr[36] * Ci[80] + Qi[36] * Cr[80]
+	+ Qr[20] * Ci[96] + Qi[20] * Cr[96]
+	- 2. * Ci[116];
+      Cr[116] =
+	Qr[4] * Cr[112] - Qi[4] * Ci[112]
+	- Cr[116];
+      Ci[116] =
+	Qr[4] * Ci[112] + Qi[4] * Cr[112]
+	- Ci[116];
+
+      Cr[118] =
+	Qr[118];
+      Ci[118] =
+	Qi[118];
+      Cr[118] =
+	Qr[114] * Cr[4] - Qi[114] * Ci[4]
+	+ Qr[102] * Cr[16] - Qi[102] * Ci[16]
+	+ Qr[86] * Cr[32] - Qi[86] * Ci[32]
+	+ Qr[54] * Cr[64] - Qi[54] * Ci[64]
+	- 4. * Cr[118];
+      Ci[118] =
+	Qr[114] * Ci[4] + Qi[114] * Cr[4]
+	+ Qr[102] * Ci[16] + Qi[102] * Cr[16]
+	+ Qr[86] * Ci[32] + Qi[86] * Cr[32]
+	+ Qr[54] * Ci[64] + Qi[54] * Cr[64]
+	- 4. * Ci[118];
+      Cr[118] =
+	Qr[98] * Cr[20] - Qi[98] * Ci[20]
+	+ Qr[82] * Cr[36] - Qi[82] * Ci[36]
+	+ Qr[70] * Cr[48] - Qi[70] * Ci[48]
+	+ Qr[50] * Cr[68] - Qi[50] * Ci[68]
+	+ Qr[38] * Cr[80] - Qi[38] * Ci[80]
+	+ Qr[22] * Cr[96] - Qi[22] * Ci[96]
+	- 3. * Cr[118];
+      Ci[118] =
+	Qr[98] * Ci[20] + Qi[98] * Cr[20]
+	+ Qr[82] * Ci[36] + Qi[82] * Cr[36]
+	+ Qr[70] * Ci[48] + Qi[70] * Cr[48]
+	+ Qr[50] * Ci[68] + Qi[50] * Cr[68]
+	+ Qr[38] * Ci[80] + Qi[38] * Cr[80]
+	+ Qr[22] * Ci[96] + Qi[22] * Cr[96]
+	- 3. * Ci[118];
+      Cr[118] =
+	Qr[66] * Cr[52] - Qi[66] * Ci[52]
+	+ Qr[34] * Cr[84] - Qi[34] * Ci[84]
+	+ Qr[18] * Cr[100] - Qi[18] * Ci[100]
+	+ Qr[6] * Cr[112] - Qi[6] * Ci[112]
+	- 2. * Cr[118];
+      Ci[118] =
+	Qr[66] * Ci[52] + Qi[66] * Cr[52]
+	+ Qr[34] * Ci[84] + Qi[34] * Cr[84]
+	+ Qr[18] * Ci[100] + Qi[18] * Cr[100]
+	+ Qr[6] * Ci[112] + Qi[6] * Cr[112]
+	- 2. * Ci[118];
+      Cr[118] =
+	Qr[2] * Cr[116] - Qi[2] * Ci[116]
+	- Cr[118];
+      Ci[118] =
+	Qr[2] * Ci[116] + Qi[2] * Cr[116]
+	- Ci[118];
+
+      Cr[120] =
+	Qr[120];
+      Ci[120] =
+	Qi[120];
+      Cr[120] =
+	Qr[104] * Cr[16] - Qi[104] * Ci[16]
+	+ Qr[88] * Cr[32] - Qi[88] * Ci[32]
+	+ Qr[56] * Cr[64] - Qi[56] * Ci[64]
+	- 3. * Cr[120];
+      Ci[120] =
+	Qr[104] * Ci[16] + Qi[104] * Cr[16]
+	+ Qr[88] * Ci[32] + Qi[88] * Cr[32]
+	+ Qr[56] * Ci[64] + Qi[56] * Cr[64]
+	- 3. * Ci[120];
+      Cr[120] =
+	Qr[72] * Cr[48] - Qi[72] * Ci[48]
+	+ Qr[40] * Cr[80] - Qi[40] * Ci[80]
+	+ Qr[24] * Cr[96] - Qi[24] * Ci[96]
+	- 2. * Cr[120];
+      Ci[120] =
+	Qr[72] * Ci[48] + Qi[72] * Cr[48]
+	+ Qr[40] * Ci[80] + Qi[40] * Cr[80]
+	+ Qr[24] * Ci[96] + Qi[24] * Cr[96]
+	- 2. * Ci[120];
+      Cr[120] =
+	Qr[8] * Cr[112] - Qi[8] * Ci[112]
+	- Cr[120];
+      Ci[120] =
+	Qr[8] * Ci[112] + Qi[8] * Cr[112]
+	- Ci[120];
+
+      Cr[122] =
+	Qr[122];
+      Ci[122] =
+	Qi[122];
+      Cr[122] =
+	Qr[114] * Cr[8] - Qi[114] * Ci[8]
+	+ Qr[106] * Cr[16] - Qi[106] * Ci[16]
+	+ Qr[90] * Cr[32] - Qi[90] * Ci[32]
+	+ Qr[58] * Cr[64] - Qi[58] * Ci[64]
+	- 4. * Cr[122];
+      Ci[122] =
+	Qr[114] * Ci[8] + Qi[114] * Cr[8]
+	+ Qr[106] * Ci[16] + Qi[106] * Cr[16]
+	+ Qr[90] * Ci[32] + Qi[90] * Cr[32]
+	+ Qr[58] * Ci[64] + Qi[58] * Cr[64]
+	- 4. * Ci[122];
+      Cr[122] =
+	Qr[98] * Cr[24] - Qi[98] * Ci[24]
+	+ Qr[82] * Cr[40] - Qi[82] * Ci[40]
+	+ Qr[74] * Cr[48] - Qi[74] * Ci[48]
+	+ Qr[50] * Cr[72] - Qi[50] * Ci[72]
+	+ Qr[42] * Cr[80] - Qi[42] * Ci[80]
+	+ Qr[26] * Cr[96] - Qi[26] * Ci[96]
+	- 3. * Cr[122];
+      Ci[122] =
+	Qr[98] * Ci[24] + Qi[98] * Cr[24]
+	+ Qr[82] * Ci[40] + Qi[82] * Cr[40]
+	+ Qr[74] * Ci[48] + Qi[74] * Cr[48]
+	+ Qr[50] * Ci[72] + Qi[50] * Cr[72]
+	+ Qr[42] * Ci[80] + Qi[42] * Cr[80]
+	+ Qr[26] * Ci[96] + Qi[26] * Cr[96]
+	- 3. * Ci[122];
+      Cr[122] =
+	Qr[66] * Cr[56] - Qi[66] * Ci[56]
+	+ Qr[34] * Cr[88] - Qi[34] * Ci[88]
+	+ Qr[18] * Cr[104] - Qi[18] * Ci[104]
+	+ Qr[10] * Cr[112] - Qi[10] * Ci[112]
+	- 2. * Cr[122];
+      Ci[122] =
+	Qr[66] * Ci[56] + Qi[66] * Cr[56]
+	+ Qr[34] * Ci[88] + Qi[34] * Cr[88]
+	+ Qr[18] * Ci[104] + Qi[18] * Cr[104]
+	+ Qr[10] * Ci[112] + Qi[10] * Cr[112]
+	- 2. * Ci[122];
+      Cr[122] =
+	Qr[2] * Cr[120] - Qi[2] * Ci[120]
+	- Cr[122];
+      Ci[122] =
+	Qr[2] * Ci[120] + Qi[2] * Cr[120]
+	- Ci[122];
+
+      Cr[124] =
+	Qr[124];
+      Ci[124] =
+	Qi[124];
+      Cr[124] =
+	Qr[116] * Cr[8] - Qi[116] * Ci[8]
+	+ Qr[108] * Cr[16] - Qi[108] * Ci[16]
+	+ Qr[92] * Cr[32] - Qi[92] * Ci[32]
+	+ Qr[60] * Cr[64] - Qi[60] * Ci[64]
+	- 4. * Cr[124];
+      Ci[124] =
+	Qr[116] * Ci[8] + Qi[116] * Cr[8]
+	+ Qr[108] * Ci[16] + Qi[108] * Cr[16]
+	+ Qr[92] * Ci[32] + Qi[92] * Cr[32]
+	+ Qr[60] * Ci[64] + Qi[60] * Cr[64]
+	- 4. * Ci[124];
+      Cr[124] =
+	Qr[100] * Cr[24] - Qi[100] * Ci[24]
+	+ Qr[84] * Cr[40] - Qi[84] * Ci[40]
+	+ Qr[76] * Cr[48] - Qi[76] * Ci[48]
+	+ Qr[52] * Cr[72] - Qi[52] * Ci[72]
+	+ Qr[44] * Cr[80] - Qi[44] * Ci[80]
+	+ Qr[28] * Cr[96] - Qi[28] * Ci[96]
+	- 3. * Cr[124];
+      Ci[124] =
+	Qr[100] * Ci[24] + Qi[100] * Cr[24]
+	+ Qr[84] * Ci[40] + Qi[84] * Cr[40]
+	+ Qr[76] * Ci[48] + Qi[76] * Cr[48]
+	+ Qr[52] * Ci[72] + Qi[52] * Cr[72]
+	+ Qr[44] * Ci[80] + Qi[44] * Cr[80]
+	+ Qr[28] * Ci[96] + Qi[28] * Cr[96]
+	- 3. * Ci[124];
+      Cr[124] =
+	Qr[68] * Cr[56] - Qi[68] * Ci[56]
+	+ Qr[36] * Cr[88] - Qi[36] * Ci[88]
+	+ Qr[20] * Cr[104] - Qi[20] * Ci[104]
+	+ Qr[12] * Cr[112] - Qi[12] * Ci[112]
+	- 2. * Cr[124];
+      Ci[124] =
+	Qr[68] * Ci[56] + Qi[68] * Cr[56]
+	+ Qr[36] * Ci[88] + Qi[36] * Cr[88]
+	+ Qr[20] * Ci[104] + Qi[20] * Cr[104]
+	+ Qr[12] * Ci[112] + Qi[12] * Cr[112]
+	- 2. * Ci[124];
+      Cr[124] =
+	Qr[4] * Cr[120] - Qi[4] * Ci[120]
+	- Cr[124];
+      Ci[124] =
+	Qr[4] * Ci[120] + Qi[4] * Cr[120]
+	- Ci[124];
+
+      Cr[126] =
+	Qr[126];
+      Ci[126] =
+	Qi[126];
+      Cr[126] =
+	Qr[122] * Cr[4] - Qi[122] * Ci[4]
+	+ Qr[118] * Cr[8] - Qi[118] * Ci[8]
+	+ Qr[110] * Cr[16] - Qi[110] * Ci[16]
+	+ Qr[94] * Cr[32] - Qi[94] * Ci[32]
+	+ Qr[62] * Cr[64] - Qi[62] * Ci[64]
+	- 5. * Cr[126];
+      Ci[126] =
+	Qr[122] * Ci[4] + Qi[122] * Cr[4]
+	+ Qr[118] * Ci[8] + Qi[118] * Cr[8]
+	+ Qr[110] * Ci[16] + Qi[110] * Cr[16]
+	+ Qr[94] * Ci[32] + Qi[94] * Cr[32]
+	+ Qr[62] * Ci[64] + Qi[62] * Cr[64]
+	- 5. * Ci[126];
+      Cr[126] =
+	Qr[114] * Cr[12] - Qi[114] * Ci[12]
+	+ Qr[106] * Cr[20] - Qi[106] * Ci[20]
+	+ Qr[102] * Cr[24] - Qi[102] * Ci[24]
+	+ Qr[90] * Cr[36] - Qi[90] * Ci[36]
+	+ Qr[86] * Cr[40] - Qi[86] * Ci[40]
+	+ Qr[78] * Cr[48] - Qi[78] * Ci[48]
+	+ Qr[58] * Cr[68] - Qi[58] * Ci[68]
+	+ Qr[54] * Cr[72] - Qi[54] * Ci[72]
+	+ Qr[46] * Cr[80] - Qi[46] * Ci[80]
+	+ Qr[30] * Cr[96] - Qi[30] * Ci[96]
+	- 4. * Cr[126];
+      Ci[126] =
+	Qr[114] * Ci[12] + Qi[114] * Cr[12]
+	+ Qr[106] * Ci[20] + Qi[106] * Cr[20]
+	+ Qr[102] * Ci[24] + Qi[102] * Cr[24]
+	+ Qr[90] * Ci[36] + Qi[90] * Cr[36]
+	+ Qr[86] * Ci[40] + Qi[86] * Cr[40]
+	+ Qr[78] * Ci[48] + Qi[78] * Cr[48]
+	+ Qr[58] * Ci[68] + Qi[58] * Cr[68]
+	+ Qr[54] * Ci[72] + Qi[54] * Cr[72]
+	+ Qr[46] * Ci[80] + Qi[46] * Cr[80]
+	+ Qr[30] * Ci[96] + Qi[30] * Cr[96]
+	- 4. * Ci[126];
+      Cr[126] =
+	Qr[98] * Cr[28] - Qi[98] * Ci[28]
+	+ Qr[82] * Cr[44] - Qi[82] * Ci[44]
+	+ Qr[74] * Cr[52] - Qi[74] * Ci[52]
+	+ Qr[70] * Cr[56] - Qi[70] * Ci[56]
+	+ Qr[50] * Cr[76] - Qi[50] * Ci[76]
+	+ Qr[42] * Cr[84] - Qi[42] * Ci[84]
+	+ Qr[38] * Cr[88] - Qi[38] * Ci[88]
+	+ Qr[26] * Cr[100] - Qi[26] * Ci[100]
+	+ Qr[22] * Cr[104] - Qi[22] * Ci[104]
+	+ Qr[14] * Cr[112] - Qi[14] * Ci[112]
+	- 3. * Cr[126];
+      Ci[126] =
+	Qr[98] * Ci[28] + Qi[98] * Cr[28]
+	+ Qr[82] * Ci[44] + Qi[82] * Cr[44]
+	+ Qr[74] * Ci[52] + Qi[74] * Cr[52]
+	+ Qr[70] * Ci[56] + Qi[70] * Cr[56]
+	+ Qr[50] * Ci[76] + Qi[50] * Cr[76]
+	+ Qr[42] * Ci[84] + Qi[42] * Cr[84]
+	+ Qr[38] * Ci[88] + Qi[38] * Cr[88]
+	+ Qr[26] * Ci[100] + Qi[26] * Cr[100]
+	+ Qr[22] * Ci[104] + Qi[22] * Cr[104]
+	+ Qr[14] * Ci[112] + Qi[14] * Cr[112]
+	- 3. * Ci[126];
+      Cr[126] =
+	Qr[66] * Cr[60] - Qi[66] * Ci[60]
+	+ Qr[34] * Cr[92] - Qi[34] * Ci[92]
+	+ Qr[18] * Cr[108] - Qi[18] * Ci[108]
+	+ Qr[10] * Cr[116] - Qi[10] * Ci[116]
+	+ Qr[6] * Cr[120] - Qi[6] * Ci[120]
+	- 2. * Cr[126];
+      Ci[126] =
+	Qr[66] * Ci[60] + Qi[66] * Cr[60]
+	+ Qr[34] * Ci[92] + Qi[34] * Cr[92]
+	+ Qr[18] * Ci[108] + Qi[18] * Cr[108]
+	+ Qr[10] * Ci[116] + Qi[10] * Cr[116]
+	+ Qr[6] * Ci[120] + Qi[6] * Cr[120]
+	- 2. * Ci[126];
+      Cr[126] =
+	Qr[2] * Cr[124] - Qi[2] * Ci[124]
+	- Cr[126];
+      Ci[126] =
+	Qr[2] * Ci[124] + Qi[2] * Cr[124]
+	- Ci[126];
+
+      Cr[128] =
+	Qr[128];
+      Ci[128] =
+	Qi[128];
+
+      Cr[130] =
+	Qr[130];
+      Ci[130] =
+	Qi[130];
+      Cr[130] =
+	Qr[2] * Cr[128] - Qi[2] * Ci[128]
+	- Cr[130];
+      Ci[130] =
+	Qr[2] * Ci[128] + Qi[2] * Cr[128]
+	- Ci[130];
+
+      Cr[132] =
+	Qr[132];
+      Ci[132] =
+	Qi[132];
+      Cr[132] =
+	Qr[4] * Cr[128] - Qi[4] * Ci[128]
+	- Cr[132];
+      Ci[132] =
+	Qr[4] * Ci[128] + Qi[4] * Cr[128]
+	- Ci[132];
+
+      Cr[134] =
+	Qr[134];
+      Ci[134] =
+	Qi[134];
+      Cr[134] =
+	Qr[130] * Cr[4] - Qi[130] * Ci[4]
+	+ Qr[6] * Cr[128] - Qi[6] * Ci[128]
+	- 2. * Cr[134];
+      Ci[134] =
+	Qr[130] * Ci[4] + Qi[130] * Cr[4]
+	+ Qr[6] * Ci[128] + Qi[6] * Cr[128]
+	- 2. * Ci[134];
+      Cr[134] =
+	Qr[2] * Cr[132] - Qi[2] * Ci[132]
+	- Cr[134];
+      Ci[134] =
+	Qr[2] * Ci[132] + Qi[2] * Cr[132]
+	- Ci[134];
+
+      Cr[136] =
+	Qr[136];
+      Ci[136] =
+	Qi[136];
+      Cr[136] =
+	Qr[8] * Cr[128] - Qi[8] * Ci[128]
+	- Cr[136];
+      Ci[136] =
+	Qr[8] * Ci[128] + Qi[8] * Cr[128]
+	- Ci[136];
+
+      Cr[138] =
+	Qr[138];
+      Ci[138] =
+	Qi[138];
+      Cr[138] =
+	Qr[130] * Cr[8] - Qi[130] * Ci[8]
+	+ Qr[10] * Cr[128] - Qi[10] * Ci[128]
+	- 2. * Cr[138];
+      Ci[138] =
+	Qr[130] * Ci[8] + Qi[130] * Cr[8]
+	+ Qr[10] * Ci[128] + Qi[10] * Cr[128]
+	- 2. * Ci[138];
+      Cr[138] =
+	Qr[2] * Cr[136] - Qi[2] * Ci[136]
+	- Cr[138];
+      Ci[138] =
+	Qr[2] * Ci[136] + Qi[2] * Cr[136]
+	- Ci[138];
+
+      Cr[140] =
+	Qr[140];
+      Ci[140] =
+	Qi[140];
+      Cr[140] =
+	Qr[132] * Cr[8] - Qi[132] * Ci[8]
+	+ Qr[12] * Cr[128] - Qi[12] * Ci[128]
+	- 2. * Cr[140];
+      Ci[140] =
+	Qr[132] * Ci[8] + Qi[132] * Cr[8]
+	+ Qr[12] * Ci[128] + Qi[12] * Cr[128]
+	- 2. * Ci[140];
+      Cr[140] =
+	Qr[4] * Cr[136] - Qi[4] * Ci[136]
+	- Cr[140];
+      Ci[140] =
+	Qr[4] * Ci[136] + Qi[4] * Cr[136]
+	- Ci[140];
+
+      Cr[142] =
+	Qr[142];
+      Ci[142] =
+	Qi[142];
+      Cr[142] =
+	Qr[138] * Cr[4] - Qi[138] * Ci[4]
+	+ Qr[134] * Cr[8] - Qi[134] * Ci[8]
+	+ Qr[14] * Cr[128] - Qi[14] * Ci[128]
+	- 3. * Cr[142];
+      Ci[142] =
+	Qr[138] * Ci[4] + Qi[138] * Cr[4]
+	+ Qr[134] * Ci[8] + Qi[134] * Cr[8]
+	+ Qr[14] * Ci[128] + Qi[14] * Cr[128]
+	- 3. * Ci[142];
+      Cr[142] =
+	Qr[130] * Cr[12] - Qi[130] * Ci[12]
+	+ Qr[10] * Cr[132] - Qi[10] * Ci[132]
+	+ Qr[6] * Cr[136] - Qi[6] * Ci[136]
+	- 2. * Cr[142];
+      Ci[142] =
+	Qr[130] * Ci[12] + Qi[130] * Cr[12]
+	+ Qr[10] * Ci[132] + Qi[10] * Cr[132]
+	+ Qr[6] * Ci[136] + Qi[6] * Cr[136]
+	- 2. * Ci[142];
+      Cr[142] =
+	Qr[2] * Cr[140] - Qi[2] * Ci[140]
+	- Cr[142];
+      Ci[142] =
+	Qr[2] * Ci[140] + Qi[2] * Cr[140]
+	- Ci[142];
+    }
+
+    /** Part 3 of expand8 */
+    inline CORRELATIONS_NOINLINE void
+    expand8Part3(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[144] =
+	Qr[144];
+      Ci[144] =
+	Qi[144];
+      Cr[144] =
+	Qr[16] * Cr[128] - Qi[16] * Ci[128]
+	- Cr[144];
+      Ci[144] =
+	Qr[16] * Ci[128] + Qi[16] * Cr[128]
+	- Ci[144];
+
+      Cr[146] =
+	Qr[146];
+      Ci[146] =
+	Qi[146];
+      Cr[146] =
+	Qr[130] * Cr[16] - Qi[130] * Ci[16]
+	+ Qr[18] * Cr[128] - Qi[18] * Ci[128]
+	- 2. * Cr[146];
+      Ci[146] =
+	Qr[130] * Ci[16] + Qi[130] * Cr[16]
+	+ Qr[18] * Ci[128] + Qi[18] * Cr[128]
+	- 2. * Ci[146];
+      Cr[146] =
+	Qr[2] * Cr[144] - Qi[2] * Ci[144]
+	- Cr[146];
+      Ci[146] =
+	Qr[2] * Ci[144] + Qi[2] * Cr[144]
+	- Ci[146];
+
+      Cr[148] =
+	Qr[148];
+      Ci[148] =
+	Qi[148];
+      Cr[148] =
+	Qr[132] * Cr[16] - Qi[132] * Ci[16]
+	+ Qr[20] * Cr[128] - Qi[20] * Ci[128]
+	- 2. * Cr[148];
+      Ci[148] =
+	Qr[132] * Ci[16] + Qi[132] * Cr[16]
+	+ Qr[20] * Ci[128] + Qi[20] * Cr[128]
+	- 2. * Ci[148];
+      Cr[148] =
+	Qr[4] * Cr[144] - Qi[4] * Ci[144]
+	- Cr[148];
+      Ci[148] =
+	Qr[4] * Ci[144] + Qi[4] * Cr[144]
+	- Ci[148];
+
+      Cr[150] =
+	Qr[150];
+      Ci[150] =
+	Qi[150];
+      Cr[150] =
+	Qr[146] * Cr[4] - Qi[146] * Ci[4]
+	+ Qr[134] * Cr[16] - Qi[134] * Ci[16]
+	+ Qr[22] * Cr[128] - Qi[22] * Ci[128]
+	- 3. * Cr[150];
+      Ci[150] =
+	Qr[146] * Ci[4] + Qi[146] * Cr[4]
+	+ Qr[134] * Ci[16] + Qi[134] * Cr[16]
+	+ Qr[22] * Ci[128] + Qi[22] * Cr[128]
+	- 3. * Ci[150];
+      Cr[150] =
+	Qr[130] * Cr[20] - Qi[130] * Ci[20]
+	+ Qr[18] * Cr[132] - Qi[18] * Ci[132]
+	+ Qr[6] * Cr[144] - Qi[6] * Ci[144]
+	- 2. * Cr[150];
+      Ci[150] =
+	Qr[130] * Ci[20] + Qi[130] * Cr[20]
+	+ Qr[18] * Ci[132] + Qi[18] * Cr[132]
+	+ Qr[6] * Ci[144] + Qi[6] * Cr[144]
+	- 2. * Ci[150];
+      Cr[150] =
+	Qr[2] * Cr[148] - Qi[2] * Ci[148]
+	- Cr[150];
+      Ci[150] =
+	Qr[2] * Ci[148] + Qi[2] * Cr[148]
+	- Ci[150];
+
+      Cr[152] =
+	Qr[152];
+      Ci[152] =
+	Qi[152];
+      Cr[152] =
+	Qr[136] * Cr[16] - Qi[136] * Ci[16]
+	+ Qr[24] * Cr[128] - Qi[24] * Ci[128]
+	- 2. * Cr[152];
+      Ci[152] =
+	Qr[136] * Ci[16] + Qi[136] * Cr[16]
+	+ Qr[24] * Ci[128] + Qi[24] * Cr[128]
+	- 2. * Ci[152];
+      Cr[152] =
+	Qr[8] * Cr[144] - Qi[8] * Ci[144]
+	- Cr[152];
+      Ci[152] =
+	Qr[8] * Ci[144] + Qi[8] * Cr[144]
+	- Ci[152];
+
+      Cr[154] =
+	Qr[154];
+      Ci[154] =
+	Qi[154];
+      Cr[154] =
+	Qr[146] * Cr[8] - Qi[146] * Ci[8]
+	+ Qr[138] * Cr[16] - Qi[138] * Ci[16]
+	+ Qr[26] * Cr[128] - Qi[26] * Ci[128]
+	- 3. * Cr[154];
+      Ci[154] =
+	Qr[146] * Ci[8] + Qi[146] * Cr[8]
+	+ Qr[138] * Ci[16] + Qi[138] * Cr[16]
+	+ Qr[26] * Ci[128] + Qi[26] * Cr[128]
+	- 3. * Ci[154];
+      Cr[154] =
+	Qr[130] * Cr[24] - Qi[130] * Ci[24]
+	+ Qr[18] * Cr[136] - Qi[18] * Ci[136]
+	+ Qr[10] * Cr[144] - Qi[10] * Ci[144]
+	- 2. * Cr[154];
+      Ci[154] =
+	Qr[130] * Ci[24] + Qi[130] * Cr[24]
+	+ Qr[18] * Ci[136] + Qi[18] * Cr[136]
+	+ Qr[10] * Ci[144] + Qi[10] * Cr[144]
+	- 2. * Ci[154];
+      Cr[154] =
+	Qr[2] * Cr[152] - Qi[2] * Ci[152]
+	- Cr[154];
+      Ci[154] =
+	Qr[2] * Ci[152] + Qi[2] * Cr[152]
+	- Ci[154];
+
+      Cr[156] =
+	Qr[156];
+      Ci[156] =
+	Qi[156];
+      Cr[156] =
+	Qr[148] * Cr[8] - Qi[148] * Ci[8]
+	+ Qr[140] * Cr[16] - Qi[140] * Ci[16]
+	+ Qr[28] * Cr[128] - Qi[28] * Ci[128]
+	- 3. * Cr[156];
+      Ci[156] =
+	Qr[148] * Ci[8] + Qi[148] * Cr[8]
+	+ Qr[140] * Ci[16] + Qi[140] * Cr[16]
+	+ Qr[28] * Ci[128] + Qi[28] * Cr[128]
+	- 3. * Ci[156];
+      Cr[156] =
+	Qr[132] * Cr[24] - Qi[132] * Ci[24]
+	+ Qr[20] * Cr[136] - Qi[20] * Ci[136]
+	+ Qr[12] * Cr[144] - Qi[12] * Ci[144]
+	- 2. * Cr[156];
+      Ci[156] =
+	Qr[132] * Ci[24] + Qi[132] * Cr[24]
+	+ Qr[20] * Ci[136] + Qi[20] * Cr[136]
+	+ Qr[12] * Ci[144] + Qi[12] * Cr[144]
+	- 2. * Ci[156];
+      Cr[156] =
+	Qr[4] * Cr[152] - Qi[4] * Ci[152]
+	- Cr[156];
+      Ci[156] =
+	Qr[4] * Ci[152] + Qi[4] * Cr[152]
+	- Ci[156];
+
+      Cr[158] =
+	Qr[158];
+      Ci[158] =
+	Qi[158];
+      Cr[158] =
+	Qr[154] * Cr[4] - Qi[154] * Ci[4]
+	+ Qr[150] * Cr[8] - Qi[150] * Ci[8]
+	+ Qr[142] * Cr[16] - Qi[142] * Ci[16]
+	+ Qr[30] * Cr[128] - Qi[30] * Ci[128]
+	- 4. * Cr[158];
+      Ci[158] =
+	Qr[154] * Ci[4] + Qi[154] * Cr[4]
+	+ Qr[150] * Ci[8] + Qi[150] * Cr[8]
+	+ Qr[142] * Ci[16] + Qi[142] * Cr[16]
+	+ Qr[30] * Ci[128] + Qi[30] * Cr[128]
+	- 4. * Ci[158];
+      Cr[158] =
+	Qr[146] * Cr[12] - Qi[146] * Ci[12]
+	+ Qr[138] * Cr[20] - Qi[138] * Ci[20]
+	+ Qr[134] * Cr[24] - Qi[134] * Ci[24]
+	+ Qr[26] * Cr[132] - Qi[26] * Ci[132]
+	+ Qr[22] * Cr[136] - Qi[22] * Ci[136]
+	+ Qr[14] * Cr[144] - Qi[14] * Ci[144]
+	- 3. * Cr[158];
+      Ci[158] =
+	Qr[146] * Ci[12] + Qi[146] * Cr[12]
+	+ Qr[138] * Ci[20] + Qi[138] * Cr[20]
+	+ Qr[134] * Ci[24] + Qi[134] * Cr[24]
+	+ Qr[26] * Ci[132] + Qi[26] * Cr[132]
+	+ Qr[22] * Ci[136] + Qi[22] * Cr[136]
+	+ Qr[14] * Ci[144] + Qi[14] * Cr[144]
+	- 3. * Ci[158];
+      Cr[158] =
+	Qr[130] * Cr[28] - Qi[130] * Ci[28]
+	+ Qr[18] * Cr[140] - Qi[18] * Ci[140]
+	+ Qr[10] * Cr[148] - Qi[10] * Ci[148]
+	+ Qr[6] * Cr[152] - Qi[6] * Ci[152]
+	- 2. * Cr[158];
+      Ci[158] =
+	Qr[130] * Ci[28] + Qi[130] * Cr[28]
+	+ Qr[18] * Ci[140] + Qi[18] * Cr[140]
+	+ Qr[10] * Ci[148] + Qi[10] * Cr[148]
+	+ Qr[6] * Ci[152] + Qi[6] * Cr[152]
+	- 2. * Ci[158];
+      Cr[158] =
+	Qr[2] * Cr[156] - Qi[2] * Ci[156]
+	- Cr[158];
+      Ci[158] =
+	Qr[2] * Ci[156] + Qi[2] * Cr[156]
+	- Ci[158];
+
+      Cr[160] =
+	Qr[160];
+      Ci[160] =
+	Qi[160];
+      Cr[160] =
+	Qr[32] * Cr[128] - Qi[32] * Ci[128]
+	- Cr[160];
+      Ci[160] =
+	Qr[32] * Ci[128] + Qi[32] * Cr[128]
+	- Ci[160];
+
+      Cr[162] =
+	Qr[162];
+      Ci[162] =
+	Qi[162];
+      Cr[162] =
+	Qr[130] * Cr[32] - Qi[130] * Ci[32]
+	+ Qr[34] * Cr[128] - Qi[34] * Ci[128]
+	- 2. * Cr[162];
+      Ci[162] =
+	Qr[130] * Ci[32] + Qi[130] * Cr[32]
+	+ Qr[34] * Ci[128] + Qi[34] * Cr[128]
+	- 2. * Ci[162];
+      Cr[162] =
+	Qr[2] * Cr[160] - Qi[2] * Ci[160]
+	- Cr[162];
+      Ci[162] =
+	Qr[2] * Ci[160] + Qi[2] * Cr[160]
+	- Ci[162];
+
+      Cr[164] =
+	Qr[164];
+      Ci[164] =
+	Qi[164];
+      Cr[164] =
+	Qr[132] * Cr[32] - Qi[132] * Ci[32]
+	+ Qr[36] * Cr[128] - Qi[36] * Ci[128]
+	- 2. * Cr[164];
+      Ci[164] =
+	Qr[132] * Ci[32] + Qi[132] * Cr[32]
+	+ Qr[36] * Ci[128] + Qi[36] * Cr[128]
+	- 2. * Ci[164];
+      Cr[164] =
+	Qr[4] * Cr[160] - Qi[4] * Ci[160]
+	- Cr[164];
+      Ci[164] =
+	Qr[4] * Ci[160] + Qi[4] * Cr[160]
+	- Ci[164];
+
+      Cr[166] =
+	Qr[166];
+      Ci[166] =
+	Qi[166];
+      Cr[166] =
+	Qr[162] * Cr[4] - Qi[162] * Ci[4]
+	+ Qr[134] * Cr[32] - Qi[134] * Ci[32]
+	+ Qr[38] * Cr[128] - Qi[38] * Ci[128]
+	- 3. * Cr[166];
+      Ci[166] =
+	Qr[162] * Ci[4] + Qi[162] * Cr[4]
+	+ Qr[134] * Ci[32] + Qi[134] * Cr[32]
+	+ Qr[38] * Ci[128] + Qi[38] * Cr[128]
+	- 3. * Ci[166];
+      Cr[166] =
+	Qr[130] * Cr[36] - Qi[130] * Ci[36]
+	+ Qr[34] * Cr[132] - Qi[34] * Ci[132]
+	+ Qr[6] * Cr[160] - Qi[6] * Ci[160]
+	- 2. * Cr[166];
+      Ci[166] =
+	Qr[130] * Ci[36] + Qi[130] * Cr[36]
+	+ Qr[34] * Ci[132] + Qi[34] * Cr[132]
+	+ Qr[6] * Ci[160] + Qi[6] * Cr[160]
+	- 2. * Ci[166];
+      Cr[166] =
+	Qr[2] * Cr[164] - Qi[2] * Ci[164]
+	- Cr[166];
+      Ci[166] =
+	Qr[2] * Ci[164] + Qi[2] * Cr[164]
+	- Ci[166];
+
+      Cr[168] =
+	Qr[168];
+      Ci[168] =
+	Qi[168];
+      Cr[168] =
+	Qr[136] * Cr[32] - Qi[136] * Ci[32]
+	+ Qr[40] * Cr[128] - Qi[40] * Ci[128]
+	- 2. * Cr[168];
+      Ci[168] =
+	Qr[136] * Ci[32] + Qi[136] * Cr[32]
+	+ Qr[40] * Ci[128] + Qi[40] * Cr[128]
+	- 2. * Ci[168];
+      Cr[168] =
+	Qr[8] * Cr[160] - Qi[8] * Ci[160]
+	- Cr[168];
+      Ci[168] =
+	Qr[8] * Ci[160] + Qi[8] * Cr[160]
+	- Ci[168];
+
+      Cr[170] =
+	Qr[170];
+      Ci[170] =
+	Qi[170];
+      Cr[170] =
+	Qr[162] * Cr[8] - Qi[162] * Ci[8]
+	+ Qr[138] * Cr[32] - Qi[138] * Ci[32]
+	+ Qr[42] * Cr[128] - Qi[42] * Ci[128]
+	- 3. * Cr[170];
+      Ci[170] =
+	Qr[162] * Ci[8] + Qi[162] * Cr[8]
+	+ Qr[138] * Ci[32] + Qi[138] * Cr[32]
+	+ Qr[42] * Ci[128] + Qi[42] * Cr[128]
+	- 3. * Ci[170];
+      Cr[170] =
+	Qr[130] * Cr[40] - Qi[130] * Ci[40]
+	+ Qr[34] * Cr[136] - Qi[34] * Ci[136]
+	+ Qr[10] * Cr[160] - Qi[10] * Ci[160]
+	- 2. * Cr[170];
+      Ci[170] =
+	Qr[130] * Ci[40] + Qi[130] * Cr[40]
+	+ Qr[34] * Ci[136] + Qi[34] * Cr[136]
+	+ Qr[10] * Ci[160] + Qi[10] * Cr[160]
+	- 2. * Ci[170];
+      Cr[170] =
+	Qr[2] * Cr[168] - Qi[2] * Ci[168]
+	- Cr[170];
+      Ci[170] =
+	Qr[2] * Ci[168] + Qi[2] * Cr[168]
+	- Ci[170];
+
+      Cr[172] =
+	Qr[172];
+      Ci[172] =
+	Qi[172];
+      Cr[172] =
+	Qr[164] * Cr[8] - Qi[164] * Ci[8]
+	+ Qr[140] * Cr[32] - Qi[140] * Ci[32]
+	+ Qr[44] * Cr[128] - Qi[44] * Ci[128]
+	- 3. * Cr[172];
+      Ci[172] =
+	Qr[164] * Ci[8] + Qi[164] * Cr[8]
+	+ Qr[140] * Ci[32] + Qi[140] * Cr[32]
+	+ Qr[44] * Ci[128] + Qi[44] * Cr[128]
+	- 3. * Ci[172];
+      Cr[172] =
+	Qr[132] * Cr[40] - Qi[132] * Ci[40]
+	+ Qr[36] * Cr[136] - Qi[36] * Ci[136]
+	+ Qr[12] * Cr[160] - Qi[12] * Ci[160]
+	- 2. * Cr[172];
+      Ci[172] =
+	Qr[132] * Ci[40] + Qi[132] * Cr[40]
+	+ Qr[36] * Ci[136] + Qi[36] * Cr[136]
+	+ Qr[12] * Ci[160] + Qi[12] * Cr[160]
+	- 2. * Ci[172];
+      Cr[172] =
+	Qr[4] * Cr[168] - Qi[4] * Ci[168]
+	- Cr[172];
+      Ci[172] =
+	Qr[4] * Ci[168] + Qi[4] * Cr[168]
+	- Ci[172];
+
+      Cr[174] =
+	Qr[174];
+      Ci[174] =
+	Qi[174];
+      Cr[174] =
+	Qr[170] * Cr[4] - Qi[170] * Ci[4]
+	+ Qr[166] * Cr[8] - Qi[166] * Ci[8]
+	+ Qr[142] * Cr[32] - Qi[142] * Ci[32]
+	+ Qr[46] * Cr[128] - Qi[46] * Ci[128]
+	- 4. * Cr[174];
+      Ci[174] =
+	Qr[170] * Ci[4] + Qi[170] * Cr[4]
+	+ Qr[166] * Ci[8] + Qi[166] * Cr[8]
+	+ Qr[142] * Ci[32] + Qi[142] * Cr[32]
+	+ Qr[46] * Ci[128] + Qi[46] * Cr[128]
+	- 4. * Ci[174];
+      Cr[174] =
+	Qr[162] * Cr[12] - Qi[162] * Ci[12]
+	+ Qr[138] * Cr[36] - Qi[138] * Ci[36]
+	+ Qr[134] * Cr[40] - Qi[134] * Ci[40]
+	+ Qr[42] * Cr[132] - Qi[42] * Ci[132]
+	+ Qr[38] * Cr[136] - Qi[38] * Ci[136]
+	+ Qr[14] * Cr[160] - Qi[14] * Ci[160]
+	- 3. * Cr[174];
+      Ci[174] =
+	Qr[162] * Ci[12] + Qi[162] * Cr[12]
+	+ Qr[138] * Ci[36] + Qi[138] * Cr[36]
+	+ Qr[134] * Ci[40] + Qi[134] * Cr[40]
+	+ Qr[42] * Ci[132] + Qi[42] * Cr[132]
+	+ Qr[38] * Ci[136] + Qi[38] * Cr[136]
+	+ Qr[14] * Ci[160] + Qi[14] * Cr[160]
+	- 3. * Ci[174];
+      Cr[174] =
+	Qr[130] * Cr[44] - Qi[130] * Ci[44]
+	+ Qr[34] * Cr[140] - Qi[34] * Ci[140]
+	+ Qr[10] * Cr[164] - Qi[10] * Ci[164]
+	+ Qr[6] * Cr[168] - Qi[6] * Ci[168]
+	- 2. * Cr[174];
+      Ci[174] =
+	Qr[130] * Ci[44] + Qi[130] * Cr[44]
+	+ Qr[34] * Ci[140] + Qi[34] * Cr[140]
+	+ Qr[10] * Ci[164] + Qi[10] * Cr[164]
+	+ Qr[6] * Ci[168] + Qi[6] * Cr[168]
+	- 2. * Ci[174];
+      Cr[174] =
+	Qr[2] * Cr[172] - Qi[2] * Ci[172]
+	- Cr[174];
+      Ci[174] =
+	Qr[2] * Ci[172] + Qi[2] * Cr[172]
+	- Ci[174];
+
+      Cr[176] =
+	Qr[176];
+      Ci[176] =
+	Qi[176];
+      Cr[176] =
+	Qr[144] * Cr[32] - Qi[144] * Ci[32]
+	+ Qr[48] * Cr[128] - Qi[48] * Ci[128]
+	- 2. * Cr[176];
+      Ci[176] =
+	Qr[144] * Ci[32] + Qi[144] * Cr[32]
+	+ Qr[48] * Ci[128] + Qi[48] * Cr[128]
+	- 2. * Ci[176];
+      Cr[176] =
+	Qr[16] * Cr[160] - Qi[16] * Ci[160]
+	- Cr[176];
+      Ci[176] =
+	Qr[16] * Ci[160] + Qi[16] * Cr[160]
+	- Ci[176];
+
+      Cr[178] =
+	Qr[178];
+      Ci[178] =
+	Qi[178];
+      Cr[178] =
+	Qr[162] * Cr[16] - Qi[162] * Ci[16]
+	+ Qr[146] * Cr[32] - Qi[146] * Ci[32]
+	+ Qr[50] * Cr[128] - Qi[50] * Ci[128]
+	- 3. * Cr[178];
+      Ci[178] =
+	Qr[162] * Ci[16] + Qi[162] * Cr[16]
+	+ Qr[146] * Ci[32] + Qi[146] * Cr[32]
+	+ Qr[50] * Ci[128] + Qi[50] * Cr[128]
+	- 3. * Ci[178];
+      Cr[178] =
+	Qr[130] * Cr[48] - Qi[130] * Ci[48]
+	+ Qr[34] * Cr[144] - Qi[34] * Ci[144]
+	+ Qr[18] * Cr[160] - Qi[18] * Ci[160]
+	- 2. * Cr[178];
+      Ci[178] =
+	Qr[130] * Ci[48] + Qi[130] * Cr[48]
+	+ Qr[34] * Ci[144] + Qi[34] * Cr[144]
+	+ Qr[18] * Ci[160] + Qi[18] * Cr[160]
+	- 2. * Ci[178];
+      Cr[178] =
+	Qr[2] * Cr[176] - Qi[2] * Ci[176]
+	- Cr[178];
+      Ci[178] =
+	Qr[2] * Ci[176] + Qi[2] * Cr[176]
+	- Ci[178];
+
+      Cr[180] =
+	Qr[180];
+      Ci[180] =
+	Qi[180];
+      Cr[180] =
+	Qr[164] * Cr[16] - Qi[164] * Ci[16]
+	+ Qr[148] * Cr[32] - Qi[148] * Ci[32]
+	+ Qr[52] * Cr[128] - Qi[52] * Ci[128]
+	- 3. * Cr[180];
+      Ci[180] =
+	Qr[164] * Ci[16] + Qi[164] * Cr[16]
+	+ Qr[148] * Ci[32] + Qi[148] * Cr[32]
+	+ Qr[52] * Ci[128] + Qi[52] * Cr[128]
+	- 3. * Ci[180];
+      Cr[180] =
+	Qr[132] * Cr[48] - Qi[132] * Ci[48]
+	+ Qr[36] * Cr[144] - Qi[36] * Ci[144]
+	+ Qr[20] * Cr[160] - Qi[20] * Ci[160]
+	- 2. * Cr[180];
+      Ci[180] =
+	Qr[132] * Ci[48] + Qi[132] * Cr[48]
+	+ Qr[36] * Ci[144] + Qi[36] * Cr[144]
+	+ Qr[20] * Ci[160] + Qi[20] * Cr[160]
+	- 2. * Ci[180];
+      Cr[180] =
+	Qr[4] * Cr[176] - Qi[4] * Ci[176]
+	- Cr[180];
+      Ci[180] =
+	Qr[4] * Ci[176] + Qi[4] * Cr[176]
+	- Ci[180];
+    }
+
+    /** Part 4 of expand8 */
+    inline CORRELATIONS_NOINLINE void
+    expand8Part4(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[182] =
+	Qr[182];
+      Ci[182] =
+	Qi[182];
+      Cr[182] =
+	Qr[178] * Cr[4] - Qi[178] * Ci[4]
+	+ Qr[166] * Cr[16] - Qi[166] * Ci[16]
+	+ Qr[150] * Cr[32] - Qi[150] * Ci[32]
+	+ Qr[54] * Cr[128] - Qi[54] * Ci[128]
+	- 4. * Cr[182];
+      Ci[182] =
+	Qr[178] * Ci[4] + Qi[178] * Cr[4]
+	+ Qr[166] * Ci[16] + Qi[166] * Cr[16]
+	+ Qr[150] * Ci[32] + Qi[150] * Cr[32]
+	+ Qr[54] * Ci[128] + Qi[54] * Cr[128]
+	- 4. * Ci[182];
+      Cr[182] =
+	Qr[162] * Cr[20] - Qi[162] * Ci[20]
+	+ Qr[146] * Cr[36] - Qi[146] * Ci[36]
+	+ Qr[134] * Cr[48] - Qi[134] * Ci[48]
+	+ Qr[50] * Cr[132] - Qi[50] * Ci[132]
+	+ Qr[38] * Cr[144] - Qi[38] * Ci[144]
+	+ Qr[22] * Cr[160] - Qi[22] * Ci[160]
+	- 3. * Cr[182];
+      Ci[182] =
+	Qr[162] * Ci[20] + Qi[162] * Cr[20]
+	+ Qr[146] * Ci[36] + Qi[146] * Cr[36]
+	+ Qr[134] * Ci[48] + Qi[134] * Cr[48]
+	+ Qr[50] * Ci[132] + Qi[50] * Cr[132]
+	+ Qr[38] * Ci[144] + Qi[38] * Cr[144]
+	+ Qr[22] * Ci[160] + Qi[22] * Cr[160]
+	- 3. * Ci[182];
+      Cr[182] =
+	Qr[130] * Cr[52] - Qi[130] * Ci[52]
+	+ Qr[34] * Cr[148] - Qi[34] * Ci[148]
+	+ Qr[18] * Cr[164] - Qi[18] * Ci[164]
+	+ Qr[6] * Cr[176] - Qi[6] * Ci[176]
+	- 2. * Cr[182];
+      Ci[182] =
+	Qr[130] * Ci[52] + Qi[130] * Cr[52]
+	+ Qr[34] * Ci[148] + Qi[34] * Cr[148]
+	+ Qr[18] * Ci[164] + Qi[18] * Cr[164]
+	+ Qr[6] * Ci[176] + Qi[6] * Cr[176]
+	- 2. * Ci[182];
+      Cr[182] =
+	Qr[2] * Cr[180] - Qi[2] * Ci[180]
+	- Cr[182];
+      Ci[182] =
+	Qr[2] * Ci[180] + Qi[2] * Cr[180]
+	- Ci[182];
+
+      Cr[184] =
+	Qr[184];
+      Ci[184] =
+	Qi[184];
+      Cr[184] =
+	Qr[168] * Cr[16] - Qi[168] * Ci[16]
+	+ Qr[152] * Cr[32] - Qi[152] * Ci[32]
+	+ Qr[56] * Cr[128] - Qi[56] * Ci[128]
+	- 3. * Cr[184];
+      Ci[184] =
+	Qr[168] * Ci[16] + Qi[168] * Cr[16]
+	+ Qr[152] * Ci[32] + Qi[152] * Cr[32]
+	+ Qr[56] * Ci[128] + Qi[56] * Cr[128]
+	- 3. * Ci[184];
+      Cr[184] =
+	Qr[136] * Cr[48] - Qi[136] * Ci[48]
+	+ Qr[40] * Cr[144] - Qi[40] * Ci[144]
+	+ Qr[24] * Cr[160] - Qi[24] * Ci[160]
+	- 2. * Cr[184];
+      Ci[184] =
+	Qr[136] * Ci[48] + Qi[136] * Cr[48]
+	+ Qr[40] * Ci[144] + Qi[40] * Cr[144]
+	+ Qr[24] * Ci[160] + Qi[24] * Cr[160]
+	- 2. * Ci[184];
+      Cr[184] =
+	Qr[8] * Cr[176] - Qi[8] * Ci[176]
+	- Cr[184];
+      Ci[184] =
+	Qr[8] * Ci[176] + Qi[8] * Cr[176]
+	- Ci[184];
+
+      Cr[186] =
+	Qr[186];
+      Ci[186] =
+	Qi[186];
+      Cr[186] =
+	Qr[178] * Cr[8] - Qi[178] * Ci[8]
+	+ Qr[170] * Cr[16] - Qi[170] * Ci[16]
+	+ Qr[154] * Cr[32] - Qi[154] * Ci[32]
+	+ Qr[58] * Cr[128] - Qi[58] * Ci[128]
+	- 4. * Cr[186];
+      Ci[186] =
+	Qr[178] * Ci[8] + Qi[178] * Cr[8]
+	+ Qr[170] * Ci[16] + Qi[170] * Cr[16]
+	+ Qr[154] * Ci[32] + Qi[154] * Cr[32]
+	+ Qr[58] * Ci[128] + Qi[58] * Cr[128]
+	- 4. * Ci[186];
+      Cr[186] =
+	Qr[162] * Cr[24] - Qi[162] * Ci[24]
+	+ Qr[146] * Cr[40] - Qi[146] * Ci[40]
+	+ Qr[138] * Cr[48] - Qi[138] * Ci[48]
+	+ Qr[50] * Cr[136] - Qi[50] * Ci[136]
+	+ Qr[42] * Cr[144] - Qi[42] * Ci[144]
+	+ Qr[26] * Cr[160] - Qi[26] * Ci[160]
+	- 3. * Cr[186];
+      Ci[186] =
+	Qr[162] * Ci[24] + Qi[162] * Cr[24]
+	+ Qr[146] * Ci[40] + Qi[146] * Cr[40]
+	+ Qr[138] * Ci[48] + Qi[138] * Cr[48]
+	+ Qr[50] * Ci[136] + Qi[50] * Cr[136]
+	+ Qr[42] * Ci[144] + Qi[42] * Cr[144]
+	+ Qr[26] * Ci[160] + Qi[26] * Cr[160]
+	- 3. * Ci[186];
+      Cr[186] =
+	Qr[130] * Cr[56] - Qi[130] * Ci[56]
+	+ Qr[34] * Cr[152] - Qi[34] * Ci[152]
+	+ Qr[18] * Cr[168] - Qi[18] * Ci[168]
+	+ Qr[10] * Cr[176] - Qi[10] * Ci[176]
+	- 2. * Cr[186];
+      Ci[186] =
+	Qr[130] * Ci[56] + Qi[130] * Cr[56]
+	+ Qr[34] * Ci[152] + Qi[34] * Cr[152]
+	+ Qr[18] * Ci[168] + Qi[18] * Cr[168]
+	+ Qr[10] * Ci[176] + Qi[10] * Cr[176]
+	- 2. * Ci[186];
+      Cr[186] =
+	Qr[2] * Cr[184] - Qi[2] * Ci[184]
+	- Cr[186];
+      Ci[186] =
+	Qr[2] * Ci[184] + Qi[2] * Cr[184]
+	- Ci[186];
+
+      Cr[188] =
+	Qr[188];
+      Ci[188] =
+	Qi[188];
+      Cr[188] =
+	Qr[180] * Cr[8] - Qi[180] * Ci[8]
+	+ Qr[172] * Cr[16] - Qi[172] * Ci[16]
+	+ Qr[156] * Cr[32] - Qi[156] * Ci[32]
+	+ Qr[60] * Cr[128] - Qi[60] * Ci[128]
+	- 4. * Cr[188];
+      Ci[188] =
+	Qr[180] * Ci[8] + Qi[180] * Cr[8]
+	+ Qr[172] * Ci[16] + Qi[172] * Cr[16]
+	+ Qr[156] * Ci[32] + Qi[156] * Cr[32]
+	+ Qr[60] * Ci[128] + Qi[60] * Cr[128]
+	- 4. * Ci[188];
+      Cr[188] =
+	Qr[164] * Cr[24] - Qi[164] * Ci[24]
+	+ Qr[148] * Cr[40] - Qi[148] * Ci[40]
+	+ Qr[140] * Cr[48] - Qi[140] * Ci[48]
+	+ Qr[52] * Cr[136] - Qi[52] * Ci[136]
+	+ Qr[44] * Cr[144] - Qi[44] * Ci[144]
+	+ Qr[28] * Cr[160] - Qi[28] * Ci[160]
+	- 3. * Cr[188];
+      Ci[188] =
+	Qr[164] * Ci[24] + Qi[164] * Cr[24]
+	+ Qr[148] * Ci[40] + Qi[148] * Cr[40]
+	+ Qr[140] * Ci[48] + Qi[140] * Cr[48]
+	+ Qr[52] * Ci[136] + Qi[52] * Cr[136]
+	+ Qr[44] * Ci[144] + Qi[44] * Cr[144]
+	+ Qr[28] * Ci[160] + Qi[28] * Cr[160]
+	- 3. * Ci[188];
+      Cr[188] =
+	Qr[132] * Cr[56] - Qi[132] * Ci[56]
+	+ Qr[36] * Cr[152] - Qi[36] * Ci[152]
+	+ Qr[20] * Cr[168] - Qi[20] * Ci[168]
+	+ Qr[12] * Cr[176] - Qi[12] * Ci[176]
+	- 2. * Cr[188];
+      Ci[188] =
+	Qr[132] * Ci[56] + Qi[132] * Cr[56]
+	+ Qr[36] * Ci[152] + Qi[36] * Cr[152]
+	+ Qr[20] * Ci[168] + Qi[20] * Cr[168]
+	+ Qr[12] * Ci[176] + Qi[12] * Cr[176]
+	- 2. * Ci[188];
+      Cr[188] =
+	Qr[4] * Cr[184] - Qi[4] * Ci[184]
+	- Cr[188];
+      Ci[188] =
+	Qr[4] * Ci[184] + Qi[4] * Cr[184]
+	- Ci[188];
+
+      Cr[190] =
+	Qr[190];
+      Ci[190] =
+	Qi[190];
+      Cr[190] =
+	Qr[186] * Cr[4] - Qi[186] * Ci[4]
+	+ Qr[182] * Cr[8] - Qi[182] * Ci[8]
+	+ Qr[174] * Cr[16] - Qi[174] * Ci[16]
+	+ Qr[158] * Cr[32] - Qi[158] * Ci[32]
+	+ Qr[62] * Cr[128] - Qi[62] * Ci[128]
+	- 5. * Cr[190];
+      Ci[190] =
+	Qr[186] * Ci[4] + Qi[186] * Cr[4]
+	+ Qr[182] * Ci[8] + Qi[182] * Cr[8]
+	+ Qr[174] * Ci[16] + Qi[174] * Cr[16]
+	+ Qr[158] * Ci[32] + Qi[158] * Cr[32]
+	+ Qr[62] * Ci[128] + Qi[62] * Cr[128]
+	- 5. * Ci[190];
+      Cr[190] =
+	Qr[178] * Cr[12] - Qi[178] * Ci[12]
+	+ Qr[170] * Cr[20] - Qi[170] * Ci[20]
+	+ Qr[166] * Cr[24] - Qi[166] * Ci[24]
+	+ Qr[154] * Cr[36] - Qi[154] * Ci[36]
+	+ Qr[150] * Cr[40] - Qi[150] * Ci[40]
+	+ Qr[142] * Cr[48] - Qi[142] * Ci[48]
+	+ Qr[58] * Cr[132] - Qi[58] * Ci[132]
+	+ Qr[54] * Cr[136] - Qi[54] * Ci[136]
+	+ Qr[46] * Cr[144] - Qi[46] * Ci[144]
+	+ Qr[30] * Cr[160] - Qi[30] * Ci[160]
+	- 4. * Cr[190];
+      Ci[190] =
+	Qr[178] * Ci[12] + Qi[178] * Cr[12]
+	+ Qr[170] * Ci[20] + Qi[170] * Cr[20]
+	+ Qr[166] * Ci[24] + Qi[166] * Cr[24]
+	+ Qr[154] * Ci[36] + Qi[154] * Cr[36]
+	+ Qr[150] * Ci[40] + Qi[150] * Cr[40]
+	+ Qr[142] * Ci[48] + Qi[142] * Cr[48]
+	+ Qr[58] * Ci[132] + Qi[58] * Cr[132]
+	+ Qr[54] * Ci[136] + Qi[54] * Cr[136]
+	+ Qr[46] * Ci[144] + Qi[46] * Cr[144]
+	+ Qr[30] * Ci[160] + Qi[30] * Cr[160]
+	- 4. * Ci[190];
+      Cr[190] =
+	Qr[162] * Cr[28] - Qi[162] * Ci[28]
+	+ Qr[146] * Cr[44] - Qi[146] * Ci[44]
+	+ Qr[138] * Cr[52] - Qi[138] * Ci[52]
+	+ Qr[134] * Cr[56] - Qi[134] * Ci[56]
+	+ Qr[50] * Cr[140] - Qi[50] * Ci[140]
+	+ Qr[42] * Cr[148] - Qi[42] * Ci[148]
+	+ Qr[38] * Cr[152] - Qi[38] * Ci[152]
+	+ Qr[26] * Cr[164] - Qi[26] * Ci[164]
+	+ Qr[22] * Cr[168] - Qi[22] * Ci[168]
+	+ Qr[14] * Cr[176] - Qi[14] * Ci[176]
+	- 3. * Cr[190];
+      Ci[190] =
+	Qr[162] * Ci[28] + Qi[162] * Cr[28]
+	+ Qr[146] * Ci[44] + Qi[146] * Cr[44]
+	+ Qr[138] * Ci[52] + Qi[138] * Cr[52]
+	+ Qr[134] * Ci[56] + Qi[134] * Cr[56]
+	+ Qr[50] * Ci[140] + Qi[50] * Cr[140]
+	+ Qr[42] * Ci[148] + Qi[42] * Cr[148]
+	+ Qr[38] * Ci[152] + Qi[38] * Cr[152]
+	+ Qr[26] * Ci[164] + Qi[26] * Cr[164]
+	+ Qr[22] * Ci[168] + Qi[22] * Cr[168]
+	+ Qr[14] * Ci[176] + Qi[14] * Cr[176]
+	- 3. * Ci[190];
+      Cr[190] =
+	Qr[130] * Cr[60] - Qi[130] * Ci[60]
+	+ Qr[34] * Cr[156] - Qi[34] * Ci[156]
+	+ Qr[18] * Cr[172] - Qi[18] * Ci[172]
+	+ Qr[10] * Cr[180] - Qi[10] * Ci[180]
+	+ Qr[6] * Cr[184] - Qi[6] * Ci[184]
+	- 2. * Cr[190];
+      Ci[190] =
+	Qr[130] * Ci[60] + Qi[130] * Cr[60]
+	+ Qr[34] * Ci[156] + Qi[34] * Cr[156]
+	+ Qr[18] * Ci[172] + Qi[18] * Cr[172]
+	+ Qr[10] * Ci[180] + Qi[10] * Cr[180]
+	+ Qr[6] * Ci[184] + Qi[6] * Cr[184]
+	- 2. * Ci[190];
+      Cr[190] =
+	Qr[2] * Cr[188] - Qi[2] * Ci[188]
+	- Cr[190];
+      Ci[190] =
+	Qr[2] * Ci[188] + Qi[2] * Cr[188]
+	- Ci[190];
+
+      Cr[192] =
+	Qr[192];
+      Ci[192] =
+	Qi[192];
+      Cr[192] =
+	Qr[64] * Cr[128] - Qi[64] * Ci[128]
+	- Cr[192];
+      Ci[192] =
+	Qr[64] * Ci[128] + Qi[64] * Cr[128]
+	- Ci[192];
+
+      Cr[194] =
+	Qr[194];
+      Ci[194] =
+	Qi[194];
+      Cr[194] =
+	Qr[130] * Cr[64] - Qi[130] * Ci[64]
+	+ Qr[66] * Cr[128] - Qi[66] * Ci[128]
+	- 2. * Cr[194];
+      Ci[194] =
+	Qr[130] * Ci[64] + Qi[130] * Cr[64]
+	+ Qr[66] * Ci[128] + Qi[66] * Cr[128]
+	- 2. * Ci[194];
+      Cr[194] =
+	Qr[2] * Cr[192] - Qi[2] * Ci[192]
+	- Cr[194];
+      Ci[194] =
+	Qr[2] * Ci[192] + Qi[2] * Cr[192]
+	- Ci[194];
+
+      Cr[196] =
+	Qr[196];
+      Ci[196] =
+	Qi[196];
+      Cr[196] =
+	Qr[132] * Cr[64] - Qi[132] * Ci[64]
+	+ Qr[68] * Cr[128] - Qi[68] * Ci[128]
+	- 2. * Cr[196];
+      Ci[196] =
+	Qr[132] * Ci[64] + Qi[132] * Cr[64]
+	+ Qr[68] * Ci[128] + Qi[68] * Cr[128]
+	- 2. * Ci[196];
+      Cr[196] =
+	Qr[4] * Cr[192] - Qi[4] * Ci[192]
+	- Cr[196];
+      Ci[196] =
+	Qr[4] * Ci[192] + Qi[4] * Cr[192]
+	- Ci[196];
+
+      Cr[198] =
+	Qr[198];
+      Ci[198] =
+	Qi[198];
+      Cr[198] =
+	Qr[194] * Cr[4] - Qi[194] * Ci[4]
+	+ Qr[134] * Cr[64] - Qi[134] * Ci[64]
+	+ Qr[70] * Cr[128] - Qi[70] * Ci[128]
+	- 3. * Cr[198];
+      Ci[198] =
+	Qr[194] * Ci[4] + Qi[194] * Cr[4]
+	+ Qr[134] * Ci[64] + Qi[134] * Cr[64]
+	+ Qr[70] * Ci[128] + Qi[70] * Cr[128]
+	- 3. * Ci[198];
+      Cr[198] =
+	Qr[130] * Cr[68] - Qi[130] * Ci[68]
+	+ Qr[66] * Cr[132] - Qi[66] * Ci[132]
+	+ Qr[6] * Cr[192] - Qi[6] * Ci[192]
+	- 2. * Cr[198];
+      Ci[198] =
+	Qr[130] * Ci[68] + Qi[130] * Cr[68]
+	+ Qr[66] * Ci[132] + Qi[66] * Cr[132]
+	+ Qr[6] * Ci[192] + Qi[6] * Cr[192]
+	- 2. * Ci[198];
+      Cr[198] =
+	Qr[2] * Cr[196] - Qi[2] * Ci[196]
+	- Cr[198];
+      Ci[198] =
+	Qr[2] * Ci[196] + Qi[2] * Cr[196]
+	- Ci[198];
+
+      Cr[200] =
+	Qr[200];
+      Ci[200] =
+	Qi[200];
+      Cr[200] =
+	Qr[136] * Cr[64] - Qi[136] * Ci[64]
+	+ Qr[72] * Cr[128] - Qi[72] * Ci[128]
+	- 2. * Cr[200];
+      Ci[200] =
+	Qr[136] * Ci[64] + Qi[136] * Cr[64]
+	+ Qr[72] * Ci[128] + Qi[72] * Cr[128]
+	- 2. * Ci[200];
+      Cr[200] =
+	Qr[8] * Cr[192] - Qi[8] * Ci[192]
+	- Cr[200];
+      Ci[200] =
+	Qr[8] * Ci[192] + Qi[8] * Cr[192]
+	- Ci[200];
+
+      Cr[202] =
+	Qr[202];
+      Ci[202] =
+	Qi[202];
+      Cr[202] =
+	Qr[194] * Cr[8] - Qi[194] * Ci[8]
+	+ Qr[138] * Cr[64] - Qi[138] * Ci[64]
+	+ Qr[74] * Cr[128] - Qi[74] * Ci[128]
+	- 3. * Cr[202];
+      Ci[202] =
+	Qr[194] * Ci[8] + Qi[194] * Cr[8]
+	+ Qr[138] * Ci[64] + Qi[138] * Cr[64]
+	+ Qr[74] * Ci[128] + Qi[74] * Cr[128]
+	- 3. * Ci[202];
+      Cr[202] =
+	Qr[130] * Cr[72] - Qi[130] * Ci[72]
+	+ Qr[66] * Cr[136] - Qi[66] * Ci[136]
+	+ Qr[10] * Cr[192] - Qi[10] * Ci[192]
+	- 2. * Cr[202];
+      Ci[202] =
+	Qr[130] * Ci[72] + Qi[130] * Cr[72]
+	+ Qr[66] * Ci[136] + Qi[66] * Cr[136]
+	+ Qr[10] * Ci[192] + Qi[10] * Cr[192]
+	- 2. * Ci[202];
+      Cr[202] =
+	Qr[2] * Cr[200] - Qi[2] * Ci[200]
+	- Cr[202];
+      Ci[202] =
+	Qr[2] * Ci[200] + Qi[2] * Cr[200]
+	- Ci[202];
+
+      Cr[204] =
+	Qr[204];
+      Ci[204] =
+	Qi[204];
+      Cr[204] =
+	Qr[196] * Cr[8] - Qi[196] * Ci[8]
+	+ Qr[140] * Cr[64] - Qi[140] * Ci[64]
+	+ Qr[76] * Cr[128] - Qi[76] * Ci[128]
+	- 3. * Cr[204];
+      Ci[204] =
+	Qr[196] * Ci[8] + Qi[196] * Cr[8]
+	+ Qr[140] * Ci[64] + Qi[140] * Cr[64]
+	+ Qr[76] * Ci[128] + Qi[76] * Cr[128]
+	- 3. * Ci[204];
+      Cr[204] =
+	Qr[132] * Cr[72] - Qi[132] * Ci[72]
+	+ Qr[68] * Cr[136] - Qi[68] * Ci[136]
+	+ Qr[12] * Cr[192] - Qi[12] * Ci[192]
+	- 2. * Cr[204];
+      Ci[204] =
+	Qr[132] * Ci[72] + Qi[132] * Cr[72]
+	+ Qr[68] * Ci[136] + Qi[68] * Cr[136]
+	+ Qr[12] * Ci[192] + Qi[12] * Cr[192]
+	- 2. * Ci[204];
+      Cr[204] =
+	Qr[4] * Cr[200] - Qi[4] * Ci[200]
+	- Cr[204];
+      Ci[204] =
+	Qr[4] * Ci[200] + Qi[4] * Cr[200]
+	- Ci[204];
+
+      Cr[206] =
+	Qr[206];
+      Ci[206] =
+	Qi[206];
+      Cr[206] =
+	Qr[202] * Cr[4] - Qi[202] * Ci[4]
+	+ Qr[198] * Cr[8] - Qi[198] * Ci[8]
+	+ Qr[142] * Cr[64] - Qi[142] * Ci[64]
+	+ Qr[78] * Cr[128] - Qi[78] * Ci[128]
+	- 4. * Cr[206];
+      Ci[206] =
+	Qr[202] * Ci[4] + Qi[202] * Cr[4]
+	+ Qr[198] * Ci[8] + Qi[198] * Cr[8]
+	+ Qr[142] * Ci[64] + Qi[142] * Cr[64]
+	+ Qr[78] * Ci[128] + Qi[78] * Cr[128]
+	- 4. * Ci[206];
+      Cr[206] =
+	Qr[194] * Cr[12] - Qi[194] * Ci[12]
+	+ Qr[138] * Cr[68] - Qi[138] * Ci[68]
+	+ Qr[134] * Cr[72] - Qi[134] * Ci[72]
+	+ Qr[74] * Cr[132] - Qi[74] * Ci[132]
+	+ Qr[70] * Cr[136] - Qi[70] * Ci[136]
+	+ Qr[14] * Cr[192] - Qi[14] * Ci[192]
+	- 3. * Cr[206];
+      Ci[206] =
+	Qr[194] * Ci[12] + Qi[194] * Cr[12]
+	+ Qr[138] * Ci[68] + Qi[138] * Cr[68]
+	+ Qr[134] * Ci[72] + Qi[134] * Cr[72]
+	+ Qr[74] * Ci[132] + Qi[74] * Cr[132]
+	+ Qr[70] * Ci[136] + Qi[70] * Cr[136]
+	+ Qr[14] * Ci[192] + Qi[14] * Cr[192]
+	- 3. * Ci[206];
+      Cr[206] =
+	Qr[130] * Cr[76] - Qi[130] * Ci[76]
+	+ Qr[66] * Cr[140] - Qi[66] * Ci[140]
+	+ Qr[10] * Cr[196] - Qi[10] * Ci[196]
+	+ Qr[6] * Cr[200] - Qi[6] * Ci[200]
+	- 2. * Cr[206];
+      Ci[206] =
+	Qr[130] * Ci[76] + Qi[130] * Cr[76]
+	+ Qr[66] * Ci[140] + Qi[66] * Cr[140]
+	+ Qr[10] * Ci[196] + Qi[10] * Cr[196]
+	+ Qr[6] * Ci[200] + Qi[6] * Cr[200]
+	- 2. * Ci[206];
+      Cr[206] =
+	Qr[2] * Cr[204] - Qi[2] * Ci[204]
+	- Cr[206];
+      Ci[206] =
+	Qr[2] * Ci[204] + Qi[2] * Cr[204]
+	- Ci[206];
+    }
+
+    /** Part 5 of expand8 */
+    inline CORRELATIONS_NOINLINE void
+    expand8Part5(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[208] =
+	Qr[208];
+      Ci[208] =
+	Qi[208];
+      Cr[208] =
+	Qr[144] * Cr[64] - Qi[144] * Ci[64]
+	+ Qr[80] * Cr[128] - Qi[80] * Ci[128]
+	- 2. * Cr[208];
+      Ci[208] =
+	Qr[144] * Ci[64] + Qi[144] * Cr[64]
+	+ Qr[80] * Ci[128] + Qi[80] * Cr[128]
+	- 2. * Ci[208];
+      Cr[208] =
+	Qr[16] * Cr[192] - Qi[16] * Ci[192]
+	- Cr[208];
+      Ci[208] =
+	Qr[16] * Ci[192] + Qi[16] * Cr[192]
+	- Ci[208];
+
+      Cr[210] =
+	Qr[210];
+      Ci[210] =
+	Qi[210];
+      Cr[210] =
+	Qr[194] * Cr[16] - Qi[194] * Ci[16]
+	+ Qr[146] * Cr[64] - Qi[146] * Ci[64]
+	+ Qr[82] * Cr[128] - Qi[82] * Ci[128]
+	- 3. * Cr[210];
+      Ci[210] =
+	Qr[194] * Ci[16] + Qi[194] * Cr[16]
+	+ Qr[146] * Ci[64] + Qi[146] * Cr[64]
+	+ Qr[82] * Ci[128] + Qi[82] * Cr[128]
+	- 3. * Ci[210];
+      Cr[210] =
+	Qr[130] * Cr[80] - Qi[130] * Ci[80]
+	+ Qr[66] * Cr[144] - Qi[66] * Ci[144]
+	+ Qr[18] * Cr[192] - Qi[18] * Ci[192]
+	- 2. * Cr[210];
+      Ci[210] =
+	Qr[130] * Ci[80] + Qi[130] * Cr[80]
+	+ Qr[66] * Ci[144] + Qi[66] * Cr[144]
+	+ Qr[18] * Ci[192] + Qi[18] * Cr[192]
+	- 2. * Ci[210];
+      Cr[210] =
+	Qr[2] * Cr[208] - Qi[2] * Ci[208]
+	- Cr[210];
+      Ci[210] =
+	Qr[2] * Ci[208] + Qi[2] * Cr[208]
+	- Ci[210];
+
+      Cr[212] =
+	Qr[212];
+      Ci[212] =
+	Qi[212];
+      Cr[212] =
+	Qr[196] * Cr[16] - Qi[196] * Ci[16]
+	+ Qr[148] * Cr[64] - Qi[148] * Ci[64]
+	+ Qr[84] * Cr[128] - Qi[84] * Ci[128]
+	- 3. * Cr[212];
+      Ci[212] =
+	Qr[196] * Ci[16] + Qi[196] * Cr[16]
+	+ Qr[148] * Ci[64] + Qi[148] * Cr[64]
+	+ Qr[84] * Ci[128] + Qi[84] * Cr[128]
+	- 3. * Ci[212];
+      Cr[212] =
+	Qr[132] * Cr[80] - Qi[132] * Ci[80]
+	+ Qr[68] * Cr[144] - Qi[68] * Ci[144]
+	+ Qr[20] * Cr[192] - Qi[20] * Ci[192]
+	- 2. * Cr[212];
+      Ci[212] =
+	Qr[132] * Ci[80] + Qi[132] * Cr[80]
+	+ Qr[68] * Ci[144] + Qi[68] * Cr[144]
+	+ Qr[20] * Ci[192] + Qi[20] * Cr[192]
+	- 2. * Ci[212];
+      Cr[212] =
+	Qr[4] * Cr[208] - Qi[4] * Ci[208]
+	- Cr[212];
+      Ci[212] =
+	Qr[4] * Ci[208] + Qi[4] * Cr[208]
+	- Ci[212];
+
+      Cr[214] =
+	Qr[214];
+      Ci[214] =
+	Qi[214];
+      Cr[214] =
+	Qr[210] * Cr[4] - Qi[210] * Ci[4]
+	+ Qr[198] * Cr[16] - Qi[198] * Ci[16]
+	+ Qr[150] * Cr[64] - Qi[150] * Ci[64]
+	+ Qr[86] * Cr[128] - Qi[86] * Ci[128]
+	- 4. * Cr[214];
+      Ci[214] =
+	Qr[210] * Ci[4] + Qi[210] * Cr[4]
+	+ Qr[198] * Ci[16] + Qi[198] * Cr[16]
+	+ Qr[150] * Ci[64] + Qi[150] * Cr[64]
+	+ Qr[86] * Ci[128] + Qi[86] * Cr[128]
+	- 4. * Ci[214];
+      Cr[214] =
+	Qr[194] * Cr[20] - Qi[194] * Ci[20]
+	+ Qr[146] * Cr[68] - Qi[146] * Ci[68]
+	+ Qr[134] * Cr[80] - Qi[134] * Ci[80]
+	+ Qr[82] * Cr[132] - Qi[82] * Ci[132]
+	+ Qr[70] * Cr[144] - Qi[70] * Ci[144]
+	+ Qr[22] * Cr[192] - Qi[22] * Ci[192]
+	- 3. * Cr[214];
+      Ci[214] =
+	Qr[194] * Ci[20] + Qi[194] * Cr[20]
+	+ Qr[146] * Ci[68] + Qi[146] * Cr[68]
+	+ Qr[134] * Ci[80] + Qi[134] * Cr[80]
+	+ Qr[82] * Ci[132] + Qi[82] * Cr[132]
+	+ Qr[70] * Ci[144] + Qi[70] * Cr[144]
+	+ Qr[22] * Ci[192] + Qi[22] * Cr[192]
+	- 3. * Ci[214];
+      Cr[214] =
+	Qr[130] * Cr[84] - Qi[130] * Ci[84]
+	+ Qr[66] * Cr[148] - Qi[66] * Ci[148]
+	+ Qr[18] * Cr[196] - Qi[18] * Ci[196]
+	+ Qr[6] * Cr[208] - Qi[6] * Ci[208]
+	- 2. * Cr[214];
+      Ci[214] =
+	Qr[130] * Ci[84] + Qi[130] * Cr[84]
+	+ Qr[66] * Ci[148] + Qi[66] * Cr[148]
+	+ Qr[18] * Ci[196] + Qi[18] * Cr[196]
+	+ Qr[6] * Ci[208] + Qi[6] * Cr[208]
+	- 2. * Ci[214];
+      Cr[214] =
+	Qr[2] * Cr[212] - Qi[2] * Ci[212]
+	- Cr[214];
+      Ci[214] =
+	Qr[2] * Ci[212] + Qi[2] * Cr[212]
+	- Ci[214];
+
+      Cr[216] =
+	Qr[216];
+      Ci[216] =
+	Qi[216];
+      Cr[216] =
+	Qr[200] * Cr[16] - Qi[200] * Ci[16]
+	+ Qr[152] * Cr[64] - Qi[152] * Ci[64]
+	+ Qr[88] * Cr[128] - Qi[88] * Ci[128]
+	- 3. * Cr[216];
+      Ci[216] =
+	Qr[200] * Ci[16] + Qi[200] * Cr[16]
+	+ Qr[152] * Ci[64] + Qi[152] * Cr[64]
+	+ Qr[88] * Ci[128] + Qi[88] * Cr[128]
+	- 3. * Ci[216];
+      Cr[216] =
+	Qr[136] * Cr[80] - Qi[136] * Ci[80]
+	+ Qr[72] * Cr[144] - Qi[72] * Ci[144]
+	+ Qr[24] * Cr[192] - Qi[24] * Ci[192]
+	- 2. * Cr[216];
+      Ci[216] =
+	Qr[136] * Ci[80] + Qi[136] * Cr[80]
+	+ Qr[72] * Ci[144] + Qi[72] * Cr[144]
+	+ Qr[24] * Ci[192] + Qi[24] * Cr[192]
+	- 2. * Ci[216];
+      Cr[216] =
+	Qr[8] * Cr[208] - Qi[8] * Ci[208]
+	- Cr[216];
+      Ci[216] =
+	Qr[8] * Ci[208] + Qi[8] * Cr[208]
+	- Ci[216];
+
+      Cr[218] =
+	Qr[218];
+      Ci[218] =
+	Qi[218];
+      Cr[218] =
+	Qr[210] * Cr[8] - Qi[210] * Ci[8]
+	+ Qr[202] * Cr[16] - Qi[202] * Ci[16]
+	+ Qr[154] * Cr[64] - Qi[154] * Ci[64]
+	+ Qr[90] * Cr[128] - Qi[90] * Ci[128]
+	- 4. * Cr[218];
+      Ci[218] =
+	Qr[210] * Ci[8] + Qi[210] * Cr[8]
+	+ Qr[202] * Ci[16] + Qi[202] * Cr[16]
+	+ Qr[154] * Ci[64] + Qi[154] * Cr[64]
+	+ Qr[90] * Ci[128] + Qi[90] * Cr[128]
+	- 4. * Ci[218];
+      Cr[218] =
+	Qr[194] * Cr[24] - Qi[194] * Ci[24]
+	+ Qr[146] * Cr[72] - Qi[146] * Ci[72]
+	+ Qr[138] * Cr[80] - Qi[138] * Ci[80]
+	+ Qr[82] * Cr[136] - Qi[82] * Ci[136]
+	+ Qr[74] * Cr[144] - Qi[74] * Ci[144]
+	+ Qr[26] * Cr[192] - Qi[26] * Ci[192]
+	- 3. * Cr[218];
+      Ci[218] =
+	Qr[194] * Ci[24] + Qi[194] * Cr[24]
+	+ Qr[146] * Ci[72] + Qi[146] * Cr[72]
+	+ Qr[138] * Ci[80] + Qi[138] * Cr[80]
+	+ Qr[82] * Ci[136] + Qi[82] * Cr[136]
+	+ Qr[74] * Ci[144] + Qi[74] * Cr[144]
+	+ Qr[26] * Ci[192] + Qi[26] * Cr[192]
+	- 3. * Ci[218];
+      Cr[218] =
+	Qr[130] * Cr[88] - Qi[130] * Ci[88]
+	+ Qr[66] * Cr[152] - Qi[66] * Ci[152]
+	+ Qr[18] * Cr[200] - Qi[18] * Ci[200]
+	+ Qr[10] * Cr[208] - Qi[10] * Ci[208]
+	- 2. * Cr[218];
+      Ci[218] =
+	Qr[130] * Ci[88] + Qi[130] * Cr[88]
+	+ Qr[66] * Ci[152] + Qi[66] * Cr[152]
+	+ Qr[18] * Ci[200] + Qi[18] * Cr[200]
+	+ Qr[10] * Ci[208] + Qi[10] * Cr[208]
+	- 2. * Ci[218];
+      Cr[218] =
+	Qr[2] * Cr[216] - Qi[2] * Ci[216]
+	- Cr[218];
+      Ci[218] =
+	Qr[2] * Ci[216] + Qi[2] * Cr[216]
+	- Ci[218];
+
+      Cr[220] =
+	Qr[220];
+      Ci[220] =
+	Qi[220];
+      Cr[220] =
+	Qr[212] * Cr[8] - Qi[212] * Ci[8]
+	+ Qr[204] * Cr[16] - Qi[204] * Ci[16]
+	+ Qr[156] * Cr[64] - Qi[156] * Ci[64]
+	+ Qr[92] * Cr[128] - Qi[92] * Ci[128]
+	- 4. * Cr[220];
+      Ci[220] =
+	Qr[212] * Ci[8] + Qi[212] * Cr[8]
+	+ Qr[204] * Ci[16] + Qi[204] * Cr[16]
+	+ Qr[156] * Ci[64] + Qi[156] * Cr[64]
+	+ Qr[92] * Ci[128] + Qi[92] * Cr[128]
+	- 4. * Ci[220];
+      Cr[220] =
+	Qr[196] * Cr[24] - Qi[196] * Ci[24]
+	+ Qr[148] * Cr[72] - Qi[148] * Ci[72]
+	+ Qr[140] * Cr[80] - Qi[140] * Ci[80]
+	+ Qr[84] * Cr[136] - Qi[84] * Ci[136]
+	+ Qr[76] * Cr[144] - Qi[76] * Ci[144]
+	+ Qr[28] * Cr[192] - Qi[28] * Ci[192]
+	- 3. * Cr[220];
+      Ci[220] =
+	Qr[196] * Ci[24] + Qi[196] * Cr[24]
+	+ Qr[148] * Ci[72] + Qi[148] * Cr[72]
+	+ Qr[140] * Ci[80] + Qi[140] * Cr[80]
+	+ Qr[84] * Ci[136] + Qi[84] * Cr[136]
+	+ Qr[76] * Ci[144] + Qi[76] * Cr[144]
+	+ Qr[28] * Ci[192] + Qi[28] * Cr[192]
+	- 3. * Ci[220];
+      Cr[220] =
+	Qr[132] * Cr[88] - Qi[132] * Ci[88]
+	+ Qr[68] * Cr[152] - Qi[68] * Ci[152]
+	+ Qr[20] * Cr[200] - Qi[20] * Ci[200]
+	+ Qr[12] * Cr[208] - Qi[12] * Ci[208]
+	- 2. * Cr[220];
+      Ci[220] =
+	Qr[132] * Ci[88] + Qi[132] * Cr[88]
+	+ Qr[68] * Ci[152] + Qi[68] * Cr[152]
+	+ Qr[20] * Ci[200] + Qi[20] * Cr[200]
+	+ Qr[12] * Ci[208] + Qi[12] * Cr[208]
+	- 2. * Ci[220];
+      Cr[220] =
+	Qr[4] * Cr[216] - Qi[4] * Ci[216]
+	- Cr[220];
+      Ci[220] =
+	Qr[4] * Ci[216] + Qi[4] * Cr[216]
+	- Ci[220];
+
+      Cr[222] =
+	Qr[222];
+      Ci[222] =
+	Qi[222];
+      Cr[222] =
+	Qr[218] * Cr[4] - Qi[218] * Ci[4]
+	+ Qr[214] * Cr[8] - Qi[214] * Ci[8]
+	+ Qr[206] * Cr[16] - Qi[206] * Ci[16]
+	+ Qr[158] * Cr[64] - Qi[158] * Ci[64]
+	+ Qr[94] * Cr[128] - Qi[94] * Ci[128]
+	- 5. * Cr[222];
+      Ci[222] =
+	Qr[218] * Ci[4] + Qi[218] * Cr[4]
+	+ Qr[214] * Ci[8] + Qi[214] * Cr[8]
+	+ Qr[206] * Ci[16] + Qi[206] * Cr[16]
+	+ Qr[158] * Ci[64] + Qi[158] * Cr[64]
+	+ Qr[94] * Ci[128] + Qi[94] * Cr[128]
+	- 5. * Ci[222];
+      Cr[222] =
+	Qr[210] * Cr[12] - Qi[210] * Ci[12]
+	+ Qr[202] * Cr[20] - Qi[202] * Ci[20]
+	+ Qr[198] * Cr[24] - Qi[198] * Ci[24]
+	+ Qr[154] * Cr[68] - Qi[154] * Ci[68]
+	+ Qr[150] * Cr[72] - Qi[150] * Ci[72]
+	+ Qr[142] * Cr[80] - Qi[142] * Ci[80]
+	+ Qr[90] * Cr[132] - Qi[90] * Ci[132]
+	+ Qr[86] * Cr[136] - Qi[86] * Ci[136]
+	+ Qr[78] * Cr[144] - Qi[78] * Ci[144]
+	+ Qr[30] * Cr[192] - Qi[30] * Ci[192]
+	- 4. * Cr[222];
+      Ci[222] =
+	Qr[210] * Ci[12] + Qi[210] * Cr[12]
+	+ Qr[202] * Ci[20] + Qi[202] * Cr[20]
+	+ Qr[198] * Ci[24] + Qi[198] * Cr[24]
+	+ Qr[154] * Ci[68] + Qi[154] * Cr[68]
+	+ Qr[150] * Ci[72] + Qi[150] * Cr[72]
+	+ Qr[142] * Ci[80] + Qi[142] * Cr[80]
+	+ Qr[90] * Ci[132] + Qi[90] * Cr[132]
+	+ Qr[86] * Ci[136] + Qi[86] * Cr[136]
+	+ Qr[78] * Ci[144] + Qi[78] * Cr[144]
+	+ Qr[30] * Ci[192] + Qi[30] * Cr[192]
+	- 4. * Ci[222];
+      Cr[222] =
+	Qr[194] * Cr[28] - Qi[194] * Ci[28]
+	+ Qr[146] * Cr[76] - Qi[146] * Ci[76]
+	+ Qr[138] * Cr[84] - Qi[138] * Ci[84]
+	+ Qr[134] * Cr[88] - Qi[134] * Ci[88]
+	+ Qr[82] * Cr[140] - Qi[82] * Ci[140]
+	+ Qr[74] * Cr[148] - Qi[74] * Ci[148]
+	+ Qr[70] * Cr[152] - Qi[70] * Ci[152]
+	+ Qr[26] * Cr[196] - Qi[26] * Ci[196]
+	+ Qr[22] * Cr[200] - Qi[22] * Ci[200]
+	+ Qr[14] * Cr[208] - Qi[14] * Ci[208]
+	- 3. * Cr[222];
+      Ci[222] =
+	Qr[194] * Ci[28] + Qi[194] * Cr[28]
+	+ Qr[146] * Ci[76] + Qi[146] * Cr[76]
+	+ Qr[138] * Ci[84] + Qi[138] * Cr[84]
+	+ Qr[134] * Ci[88] + Qi[134] * Cr[88]
+	+ Qr[82] * Ci[140] + Qi[82] * Cr[140]
+	+ Qr[74] * Ci[148] + Qi[74] * Cr[148]
+	+ Qr[70] * Ci[152] + Qi[70] * Cr[152]
+	+ Qr[26] * Ci[196] + Qi[26] * Cr[196]
+	+ Qr[22] * Ci[200] + Qi[22] * Cr[200]
+	+ Qr[14] * Ci[208] + Qi[14] * Cr[208]
+	- 3. * Ci[222];
+      Cr[222] =
+	Qr[130] * Cr[92] - Qi[130] * Ci[92]
+	+ Qr[66] * Cr[156] - Qi[66] * Ci[156]
+	+ Qr[18] * Cr[204] - Qi[18] * Ci[204]
+	+ Qr[10] * Cr[212] - Qi[10] * Ci[212]
+	+ Qr[6] * Cr[216] - Qi[6] * Ci[216]
+	- 2. * Cr[222];
+      Ci[222] =
+	Qr[130] * Ci[92] + Qi[130] * Cr[92]
+	+ Qr[66] * Ci[156] + Qi[66] * Cr[156]
+	+ Qr[18] * Ci[204] + Qi[18] * Cr[204]
+	+ Qr[10] * Ci[212] + Qi[10] * Cr[212]
+	+ Qr[6] * Ci[216] + Qi[6] * Cr[216]
+	- 2. * Ci[222];
+      Cr[222] =
+	Qr[2] * Cr[220] - Qi[2] * Ci[220]
+	- Cr[222];
+      Ci[222] =
+	Qr[2] * Ci[220] + Qi[2] * Cr[220]
+	- Ci[222];
+
+      Cr[224] =
+	Qr[224];
+      Ci[224] =
+	Qi[224];
+      Cr[224] =
+	Qr[160] * Cr[64] - Qi[160] * Ci[64]
+	+ Qr[96] * Cr[128] - Qi[96] * Ci[128]
+	- 2. * Cr[224];
+      Ci[224] =
+	Qr[160] * Ci[64] + Qi[160] * Cr[64]
+	+ Qr[96] * Ci[128] + Qi[96] * Cr[128]
+	- 2. * Ci[224];
+      Cr[224] =
+	Qr[32] * Cr[192] - Qi[32] * Ci[192]
+	- Cr[224];
+      Ci[224] =
+	Qr[32] * Ci[192] + Qi[32] * Cr[192]
+	- Ci[224];
+
+      Cr[226] =
+	Qr[226];
+      Ci[226] =
+	Qi[226];
+      Cr[226] =
+	Qr[194] * Cr[32] - Qi[194] * Ci[32]
+	+ Qr[162] * Cr[64] - Qi[162] * Ci[64]
+	+ Qr[98] * Cr[128] - Qi[98] * Ci[128]
+	- 3. * Cr[226];
+      Ci[226] =
+	Qr[194] * Ci[32] + Qi[194] * Cr[32]
+	+ Qr[162] * Ci[64] + Qi[162] * Cr[64]
+	+ Qr[98] * Ci[128] + Qi[98] * Cr[128]
+	- 3. * Ci[226];
+      Cr[226] =
+	Qr[130] * Cr[96] - Qi[130] * Ci[96]
+	+ Qr[66] * Cr[160] - Qi[66] * Ci[160]
+	+ Qr[34] * Cr[192] - Qi[34] * Ci[192]
+	- 2. * Cr[226];
+      Ci[226] =
+	Qr[130] * Ci[96] + Qi[130] * Cr[96]
+	+ Qr[66] * Ci[160] + Qi[66] * Cr[160]
+	+ Qr[34] * Ci[192] + Qi[34] * Cr[192]
+	- 2. * Ci[226];
+      Cr[226] =
+	Qr[2] * Cr[224] - Qi[2] * Ci[224]
+	- Cr[226];
+      Ci[226] =
+	Qr[2] * Ci[224] + Qi[2] * Cr[224]
+	- Ci[226];
+
+      Cr[228] =
+	Qr[228];
+      Ci[228] =
+	Qi[228];
+      Cr[228] =
+	Qr[196] * Cr[32] - Qi[196] * Ci[32]
+	+ Qr[164] * Cr[64] - Qi[164] * Ci[64]
+	+ Qr[100] * Cr[128] - Qi[100] * Ci[128]
+	- 3. * Cr[228];
+      Ci[228] =
+	Qr[196] * Ci[32] + Qi[196] * Cr[32]
+	+ Qr[164] * Ci[64] + Qi[164] * Cr[64]
+	+ Qr[100] * Ci[128] + Qi[100] * Cr[128]
+	- 3. * Ci[228];
+      Cr[228] =
+	Qr[132] * Cr[96] - Qi[132] * Ci[96]
+	+ Qr[68] * Cr[160] - Qi[68] * Ci[160]
+	+ Qr[36] * Cr[192] - Qi[36] * Ci[192]
+	- 2. * Cr[228];
+      Ci[228] =
+	Qr[132] * Ci[96] + Qi[132] * Cr[96]
+	+ Qr[68] * Ci[160] + Qi[68] * Cr[160]
+	+ Qr[36] * Ci[192] + Qi[36] * Cr[192]
+	- 2. * Ci[228];
+      Cr[228] =
+	Qr[4] * Cr[224] - Qi[4] * Ci[224]
+	- Cr[228];
+      Ci[228] =
+	Qr[4] * Ci[224] + Qi[4] * Cr[224]
+	- Ci[228];
+    }
+
+    /** Part 6 of expand8 */
+    inline CORRELATIONS_NOINLINE void
+    expand8Part6(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[230] =
+	Qr[230];
+      Ci[230] =
+	Qi[230];
+      Cr[230] =
+	Qr[226] * Cr[4] - Qi[226] * Ci[4]
+	+ Qr[198] * Cr[32] - Qi[198] * Ci[32]
+	+ Qr[166] * Cr[64] - Qi[166] * Ci[64]
+	+ Qr[102] * Cr[128] - Qi[102] * Ci[128]
+	- 4. * Cr[230];
+      Ci[230] =
+	Qr[226] * Ci[4] + Qi[226] * Cr[4]
+	+ Qr[198] * Ci[32] + Qi[198] * Cr[32]
+	+ Qr[166] * Ci[64] + Qi[166] * Cr[64]
+	+ Qr[102] * Ci[128] + Qi[102] * Cr[128]
+	- 4. * Ci[230];
+      Cr[230] =
+	Qr[194] * Cr[36] - Qi[194] * Ci[36]
+	+ Qr[162] * Cr[68] - Qi[162] * Ci[68]
+	+ Qr[134] * Cr[96] - Qi[134] * Ci[96]
+	+ Qr[98] * Cr[132] - Qi[98] * Ci[132]
+	+ Qr[70] * Cr[160] - Qi[70] * Ci[160]
+	+ Qr[38] * Cr[192] - Qi[38] * Ci[192]
+	- 3. * Cr[230];
+      Ci[230] =
+	Qr[194] * Ci[36] + Qi[194] * Cr[36]
+	+ Qr[162] * Ci[68] + Qi[162] * Cr[68]
+	+ Qr[134] * Ci[96] + Qi[134] * Cr[96]
+	+ Qr[98] * Ci[132] + Qi[98] * Cr[132]
+	+ Qr[70] * Ci[160] + Qi[70] * Cr[160]
+	+ Qr[38] * Ci[192] + Qi[38] * Cr[192]
+	- 3. * Ci[230];
+      Cr[230] =
+	Qr[130] * Cr[100] - Qi[130] * Ci[100]
+	+ Qr[66] * Cr[164] - Qi[66] * Ci[164]
+	+ Qr[34] * Cr[196] - Qi[34] * Ci[196]
+	+ Qr[6] * Cr[224] - Qi[6] * Ci[224]
+	- 2. * Cr[230];
+      Ci[230] =
+	Qr[130] * Ci[100] + Qi[130] * Cr[100]
+	+ Qr[66] * Ci[164] + Qi[66] * Cr[164]
+	+ Qr[34] * Ci[196] + Qi[34] * Cr[196]
+	+ Qr[6] * Ci[224] + Qi[6] * Cr[224]
+	- 2. * Ci[230];
+      Cr[230] =
+	Qr[2] * Cr[228] - Qi[2] * Ci[228]
+	- Cr[230];
+      Ci[230] =
+	Qr[2] * Ci[228] + Qi[2] * Cr[228]
+	- Ci[230];
+
+      Cr[232] =
+	Qr[232];
+      Ci[232] =
+	Qi[232];
+      Cr[232] =
+	Qr[200] * Cr[32] - Qi[200] * Ci[32]
+	+ Qr[168] * Cr[64] - Qi[168] * Ci[64]
+	+ Qr[104] * Cr[128] - Qi[104] * Ci[128]
+	- 3. * Cr[232];
+      Ci[232] =
+	Qr[200] * Ci[32] + Qi[200] * Cr[32]
+	+ Qr[168] * Ci[64] + Qi[168] * Cr[64]
+	+ Qr[104] * Ci[128] + Qi[104] * Cr[128]
+	- 3. * Ci[232];
+      Cr[232] =
+	Qr[136] * Cr[96] - Qi[136] * Ci[96]
+	+ Qr[72] * Cr[160] - Qi[72] * Ci[160]
+	+ Qr[40] * Cr[192] - Qi[40] * Ci[192]
+	- 2. * Cr[232];
+      Ci[232] =
+	Qr[136] * Ci[96] + Qi[136] * Cr[96]
+	+ Qr[72] * Ci[160] + Qi[72] * Cr[160]
+	+ Qr[40] * Ci[192] + Qi[40] * Cr[192]
+	- 2. * Ci[232];
+      Cr[232] =
+	Qr[8] * Cr[224] - Qi[8] * Ci[224]
+	- Cr[232];
+      Ci[232] =
+	Qr[8] * Ci[224] + Qi[8] * Cr[224]
+	- Ci[232];
+
+      Cr[234] =
+	Qr[234];
+      Ci[234] =
+	Qi[234];
+      Cr[234] =
+	Qr[226] * Cr[8] - Qi[226] * Ci[8]
+	+ Qr[202] * Cr[32] - Qi[202] * Ci[32]
+	+ Qr[170] * Cr[64] - Qi[170] * Ci[64]
+	+ Qr[106] * Cr[128] - Qi[106] * Ci[128]
+	- 4. * Cr[234];
+      Ci[234] =
+	Qr[226] * Ci[8] + Qi[226] * Cr[8]
+	+ Qr[202] * Ci[32] + Qi[202] * Cr[32]
+	+ Qr[170] * Ci[64] + Qi[170] * Cr[64]
+	+ Qr[106] * Ci[128] + Qi[106] * Cr[128]
+	- 4. * Ci[234];
+      Cr[234] =
+	Qr[194] * Cr[40] - Qi[194] * Ci[40]
+	+ Qr[162] * Cr[72] - Qi[162] * Ci[72]
+	+ Qr[138] * Cr[96] - Qi[138] * Ci[96]
+	+ Qr[98] * Cr[136] - Qi[98] * Ci[136]
+	+ Qr[74] * Cr[160] - Qi[74] * Ci[160]
+	+ Qr[42] * Cr[192] - Qi[42] * Ci[192]
+	- 3. * Cr[234];
+      Ci[234] =
+	Qr[194] * Ci[40] + Qi[194] * Cr[40]
+	+ Qr[162] * Ci[72] + Qi[162] * Cr[72]
+	+ Qr[138] * Ci[96] + Qi[138] * Cr[96]
+	+ Qr[98] * Ci[136] + Qi[98] * Cr[136]
+	+ Qr[74] * Ci[160] + Qi[74] * Cr[160]
+	+ Qr[42] * Ci[192] + Qi[42] * Cr[192]
+	- 3. * Ci[234];
+      Cr[234] =
+	Qr[130] * Cr[104] - Qi[130] * Ci[104]
+	+ Qr[66] * Cr[168] - Qi[66] * Ci[168]
+	+ Qr[34] * Cr[200] - Qi[34] * Ci[200]
+	+ Qr[10] * Cr[224] - Qi[10] * Ci[224]
+	- 2. * Cr[234];
+      Ci[234] =
+	Qr[130] * Ci[104] + Qi[130] * Cr[104]
+	+ Qr[66] * Ci[168] + Qi[66] * Cr[168]
+	+ Qr[34] * Ci[200] + Qi[34] * Cr[200]
+	+ Qr[10] * Ci[224] + Qi[10] * Cr[224]
+	- 2. * Ci[234];
+      Cr[234] =
+	Qr[2] * Cr[232] - Qi[2] * Ci[232]
+	- Cr[234];
+      Ci[234] =
+	Qr[2] * Ci[232] + Qi[2] * Cr[232]
+	- Ci[234];
+
+      Cr[236] =
+	Qr[236];
+      Ci[236] =
+	Qi[236];
+      Cr[236] =
+	Qr[228] * Cr[8] - Qi[228] * Ci[8]
+	+ Qr[204] * Cr[32] - Qi[204] * Ci[32]
+	+ Qr[172] * Cr[64] - Qi[172] * Ci[64]
+	+ Qr[108] * Cr[128] - Qi[108] * Ci[128]
+	- 4. * Cr[236];
+      Ci[236] =
+	Qr[228] * Ci[8] + Qi[228] * Cr[8]
+	+ Qr[204] * Ci[32] + Qi[204] * Cr[32]
+	+ Qr[172] * Ci[64] + Qi[172] * Cr[64]
+	+ Qr[108] * Ci[128] + Qi[108] * Cr[128]
+	- 4. * Ci[236];
+      Cr[236] =
+	Qr[196] * Cr[40] - Qi[196] * Ci[40]
+	+ Qr[164] * Cr[72] - Qi[164] * Ci[72]
+	+ Qr[140] * Cr[96] - Qi[140] * Ci[96]
+	+ Qr[100] * Cr[136] - Qi[100] * Ci[136]
+	+ Qr[76] * Cr[160] - Qi[76] * Ci[160]
+	+ Qr[44] * Cr[192] - Qi[44] * Ci[192]
+	- 3. * Cr[236];
+      Ci[236] =
+	Qr[196] * Ci[40] + Qi[196] * Cr[40]
+	+ Qr[164] * Ci[72] + Qi[164] * Cr[72]
+	+ Qr[140] * Ci[96] + Qi[140] * Cr[96]
+	+ Qr[100] * Ci[136] + Qi[100] * Cr[136]
+	+ Qr[76] * Ci[160] + Qi[76] * Cr[160]
+	+ Qr[44] * Ci[192] + Qi[44] * Cr[192]
+	- 3. * Ci[236];
+      Cr[236] =
+	Qr[132] * Cr[104] - Qi[132] * Ci[104]
+	+ Qr[68] * Cr[168] - Qi[68] * Ci[168]
+	+ Qr[36] * Cr[200] - Qi[36] * Ci[200]
+	+ Qr[12] * Cr[224] - Qi[12] * Ci[224]
+	- 2. * Cr[236];
+      Ci[236] =
+	Qr[132] * Ci[104] + Qi[132] * Cr[104]
+	+ Qr[68] * Ci[168] + Qi[68] * Cr[168]
+	+ Qr[36] * Ci[200] + Qi[36] * Cr[200]
+	+ Qr[12] * Ci[224] + Qi[12] * Cr[224]
+	- 2. * Ci[236];
+      Cr[236] =
+	Qr[4] * Cr[232] - Qi[4] * Ci[232]
+	- Cr[236];
+      Ci[236] =
+	Qr[4] * Ci[232] + Qi[4] * Cr[232]
+	- Ci[236];
+
+      Cr[238] =
+	Qr[238];
+      Ci[238] =
+	Qi[238];
+      Cr[238] =
+	Qr[234] * Cr[4] - Qi[234] * Ci[4]
+	+ Qr[230] * Cr[8] - Qi[230] * Ci[8]
+	+ Qr[206] * Cr[32] - Qi[206] * Ci[32]
+	+ Qr[174] * Cr[64] - Qi[174] * Ci[64]
+	+ Qr[110] * Cr[128] - Qi[110] * Ci[128]
+	- 5. * Cr[238];
+      Ci[238] =
+	Qr[234] * Ci[4] + Qi[234] * Cr[4]
+	+ Qr[230] * Ci[8] + Qi[230] * Cr[8]
+	+ Qr[206] * Ci[32] + Qi[206] * Cr[32]
+	+ Qr[174] * Ci[64] + Qi[174] * Cr[64]
+	+ Qr[110] * Ci[128] + Qi[110] * Cr[128]
+	- 5. * Ci[238];
+      Cr[238] =
+	Qr[226] * Cr[12] - Qi[226] * Ci[12]
+	+ Qr[202] * Cr[36] - Qi[202] * Ci[36]
+	+ Qr[198] * Cr[40] - Qi[198] * Ci[40]
+	+ Qr[170] * Cr[68] - Qi[170] * Ci[68]
+	+ Qr[166] * Cr[72] - Qi[166] * Ci[72]
+	+ Qr[142] * Cr[96] - Qi[142] * Ci[96]
+	+ Qr[106] * Cr[132] - Qi[106] * Ci[132]
+	+ Qr[102] * Cr[136] - Qi[102] * Ci[136]
+	+ Qr[78] * Cr[160] - Qi[78] * Ci[160]
+	+ Qr[46] * Cr[192] - Qi[46] * Ci[192]
+	- 4. * Cr[238];
+      Ci[238] =
+	Qr[226] * Ci[12] + Qi[226] * Cr[12]
+	+ Qr[202] * Ci[36] + Qi[202] * Cr[36]
+	+ Qr[198] * Ci[40] + Qi[198] * Cr[40]
+	+ Qr[170] * Ci[68] + Qi[170] * Cr[68]
+	+ Qr[166] * Ci[72] + Qi[166] * Cr[72]
+	+ Qr[142] * Ci[96] + Qi[142] * Cr[96]
+	+ Qr[106] * Ci[132] + Qi[106] * Cr[132]
+	+ Qr[102] * Ci[136] + Qi[102] * Cr[136]
+	+ Qr[78] * Ci[160] + Qi[78] * Cr[160]
+	+ Qr[46] * Ci[192] + Qi[46] * Cr[192]
+	- 4. * Ci[238];
+      Cr[238] =
+	Qr[194] * Cr[44] - Qi[194] * Ci[44]
+	+ Qr[162] * Cr[76] - Qi[162] * Ci[76]
+	+ Qr[138] * Cr[100] - Qi[138] * Ci[100]
+	+ Qr[134] * Cr[104] - Qi[134] * Ci[104]
+	+ Qr[98] * Cr[140] - Qi[98] * Ci[140]
+	+ Qr[74] * Cr[164] - Qi[74] * Ci[164]
+	+ Qr[70] * Cr[168] - Qi[70] * Ci[168]
+	+ Qr[42] * Cr[196] - Qi[42] * Ci[196]
+	+ Qr[38] * Cr[200] - Qi[38] * Ci[200]
+	+ Qr[14] * Cr[224] - Qi[14] * Ci[224]
+	- 3. * Cr[238];
+      Ci[238] =
+	Qr[194] * Ci[44] + Qi[194] * Cr[44]
+	+ Qr[162] * Ci[76] + Qi[162] * Cr[76]
+	+ Qr[138] * Ci[100] + Qi[138] * Cr[100]
+	+ Qr[134] * Ci[104] + Qi[134] * Cr[104]
+	+ Qr[98] * Ci[140] + Qi[98] * Cr[140]
+	+ Qr[74] * Ci[164] + Qi[74] * Cr[164]
+	+ Qr[70] * Ci[168] + Qi[70] * Cr[168]
+	+ Qr[42] * Ci[196] + Qi[42] * Cr[196]
+	+ Qr[38] * Ci[200] + Qi[38] * Cr[200]
+	+ Qr[14] * Ci[224] + Qi[14] * Cr[224]
+	- 3. * Ci[238];
+      Cr[238] =
+	Qr[130] * Cr[108] - Qi[130] * Ci[108]
+	+ Qr[66] * Cr[172] - Qi[66] * Ci[172]
+	+ Qr[34] * Cr[204] - Qi[34] * Ci[204]
+	+ Qr[10] * Cr[228] - Qi[10] * Ci[228]
+	+ Qr[6] * Cr[232] - Qi[6] * Ci[232]
+	- 2. * Cr[238];
+      Ci[238] =
+	Qr[130] * Ci[108] + Qi[130] * Cr[108]
+	+ Qr[66] * Ci[172] + Qi[66] * Cr[172]
+	+ Qr[34] * Ci[204] + Qi[34] * Cr[204]
+	+ Qr[10] * Ci[228] + Qi[10] * Cr[228]
+	+ Qr[6] * Ci[232] + Qi[6] * Cr[232]
+	- 2. * Ci[238];
+      Cr[238] =
+	Qr[2] * Cr[236] - Qi[2] * Ci[236]
+	- Cr[238];
+      Ci[238] =
+	Qr[2] * Ci[236] + Qi[2] * Cr[236]
+	- Ci[238];
+
+      Cr[240] =
+	Qr[240];
+      Ci[240] =
+	Qi[240];
+      Cr[240] =
+	Qr[208] * Cr[32] - Qi[208] * Ci[32]
+	+ Qr[176] * Cr[64] - Qi[176] * Ci[64]
+	+ Qr[112] * Cr[128] - Qi[112] * Ci[128]
+	- 3. * Cr[240];
+      Ci[240] =
+	Qr[208] * Ci[32] + Qi[208] * Cr[32]
+	+ Qr[176] * Ci[64] + Qi[176] * Cr[64]
+	+ Qr[112] * Ci[128] + Qi[112] * Cr[128]
+	- 3. * Ci[240];
+      Cr[240] =
+	Qr[144] * Cr[96] - Qi[144] * Ci[96]
+	+ Qr[80] * Cr[160] - Qi[80] * Ci[160]
+	+ Qr[48] * Cr[192] - Qi[48] * Ci[192]
+	- 2. * Cr[240];
+      Ci[240] =
+	Qr[144] * Ci[96] + Qi[144] * Cr[96]
+	+ Qr[80] * Ci[160] + Qi[80] * Cr[160]
+	+ Qr[48] * Ci[192] + Qi[48] * Cr[192]
+	- 2. * Ci[240];
+      Cr[240] =
+	Qr[16] * Cr[224] - Qi[16] * Ci[224]
+	- Cr[240];
+      Ci[240] =
+	Qr[16] * Ci[224] + Qi[16] * Cr[224]
+	- Ci[240];
+
+      Cr[242] =
+	Qr[242];
+      Ci[242] =
+	Qi[242];
+      Cr[242] =
+	Qr[226] * Cr[16] - Qi[226] * Ci[16]
+	+ Qr[210] * Cr[32] - Qi[210] * Ci[32]
+	+ Qr[178] * Cr[64] - Qi[178] * Ci[64]
+	+ Qr[114] * Cr[128] - Qi[114] * Ci[128]
+	- 4. * Cr[242];
+      Ci[242] =
+	Qr[226] * Ci[16] + Qi[226] * Cr[16]
+	+ Qr[210] * Ci[32] + Qi[210] * Cr[32]
+	+ Qr[178] * Ci[64] + Qi[178] * Cr[64]
+	+ Qr[114] * Ci[128] + Qi[114] * Cr[128]
+	- 4. * Ci[242];
+      Cr[242] =
+	Qr[194] * Cr[48] - Qi[194] * Ci[48]
+	+ Qr[162] * Cr[80] - Qi[162] * Ci[80]
+	+ Qr[146] * Cr[96] - Qi[146] * Ci[96]
+	+ Qr[98] * Cr[144] - Qi[98] * Ci[144]
+	+ Qr[82] * Cr[160] - Qi[82] * Ci[160]
+	+ Qr[50] * Cr[192] - Qi[50] * Ci[192]
+	- 3. * Cr[242];
+      Ci[242] =
+	Qr[194] * Ci[48] + Qi[194] * Cr[48]
+	+ Qr[162] * Ci[80] + Qi[162] * Cr[80]
+	+ Qr[146] * Ci[96] + Qi[146] * Cr[96]
+	+ Qr[98] * Ci[144] + Qi[98] * Cr[144]
+	+ Qr[82] * Ci[160] + Qi[82] * Cr[160]
+	+ Qr[50] * Ci[192] + Qi[50] * Cr[192]
+	- 3. * Ci[242];
+      Cr[242] =
+	Qr[130] * Cr[112] - Qi[130] * Ci[112]
+	+ Qr[66] * Cr[176] - Qi[66] * Ci[176]
+	+ Qr[34] * Cr[208] - Qi[34] * Ci[208]
+	+ Qr[18] * Cr[224] - Qi[18] * Ci[224]
+	- 2. * Cr[242];
+      Ci[242] =
+	Qr[130] * Ci[112] + Qi[130] * Cr[112]
+	+ Qr[66] * Ci[176] + Qi[66] * Cr[176]
+	+ Qr[34] * Ci[208] + Qi[34] * Cr[208]
+	+ Qr[18] * Ci[224] + Qi[18] * Cr[224]
+	- 2. * Ci[242];
+      Cr[242] =
+	Qr[2] * Cr[240] - Qi[2] * Ci[240]
+	- Cr[242];
+      Ci[242] =
+	Qr[2] * Ci[240] + Qi[2] * Cr[240]
+	- Ci[242];
+
+      Cr[244] =
+	Qr[244];
+      Ci[244] =
+	Qi[244];
+      Cr[244] =
+	Qr[228] * Cr[16] - Qi[228] * Ci[16]
+	+ Qr[212] * Cr[32] - Qi[212] * Ci[32]
+	+ Qr[180] * Cr[64] - Qi[180] * Ci[64]
+	+ Qr[116] * Cr[128] - Qi[116] * Ci[128]
+	- 4. * Cr[244];
+      Ci[244] =
+	Qr[228] * Ci[16] + Qi[228] * Cr[16]
+	+ Qr[212] * Ci[32] + Qi[212] * Cr[32]
+	+ Qr[180] * Ci[64] + Qi[180] * Cr[64]
+	+ Qr[116] * Ci[128] + Qi[116] * Cr[128]
+	- 4. * Ci[244];
+      Cr[244] =
+	Qr[196] * Cr[48] - Qi[196] * Ci[48]
+	+ Qr[164] * Cr[80] - Qi[164] * Ci[80]
+	+ Qr[148] * Cr[96] - Qi[148] * Ci[96]
+	+ Qr[100] * Cr[144] - Qi[100] * Ci[144]
+	+ Qr[84] * Cr[160] - Qi[84] * Ci[160]
+	+ Qr[52] * Cr[192] - Qi[52] * Ci[192]
+	- 3. * Cr[244];
+      Ci[244] =
+	Qr[196] * Ci[48] + Qi[196] * Cr[48]
+	+ Qr[164] * Ci[80] + Qi[164] * Cr[80]
+	+ Qr[148] * Ci[96] + Qi[148] * Cr[96]
+	+ Qr[100] * Ci[144] + Qi[100] * Cr[144]
+	+ Qr[84] * Ci[160] + Qi[84] * Cr[160]
+	+ Qr[52] * Ci[192] + Qi[52] * Cr[192]
+	- 3. * Ci[244];
+      Cr[244] =
+	Qr[132] * Cr[112] - Qi[132] * Ci[112]
+	+ Qr[68] * Cr[176] - Qi[68] * Ci[176]
+	+ Qr[36] * Cr[208] - Qi[36] * Ci[208]
+	+ Qr[20] * Cr[224] - Qi[20] * Ci[224]
+	- 2. * Cr[244];
+      Ci[244] =
+	Qr[132] * Ci[112] + Qi[132] * Cr[112]
+	+ Qr[68] * Ci[176] + Qi[68] * Cr[176]
+	+ Qr[36] * Ci[208] + Qi[36] * Cr[208]
+	+ Qr[20] * Ci[224] + Qi[20] * Cr[224]
+	- 2. * Ci[244];
+      Cr[244] =
+	Qr[4] * Cr[240] - Qi[4] * Ci[240]
+	- Cr[244];
+      Ci[244] =
+	Qr[4] * Ci[240] + Qi[4] * Cr[240]
+	- Ci[244];
+    }
+
+    /** Part 7 of expand8 */
+    inline CORRELATIONS_NOINLINE void
+    expand8Part7(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[246] =
+	Qr[246];
+      Ci[246] =
+	Qi[246];
+      Cr[246] =
+	Qr[242] * Cr[4] - Qi[242] * Ci[4]
+	+ Qr[230] * Cr[16] - Qi[230] * Ci[16]
+	+ Qr[214] * Cr[32] - Qi[214] * Ci[32]
+	+ Qr[182] * Cr[64] - Qi[182] * Ci[64]
+	+ Qr[118] * Cr[128] - Qi[118] * Ci[128]
+	- 5. * Cr[246];
+      Ci[246] =
+	Qr[242] * Ci[4] + Qi[242] * Cr[4]
+	+ Qr[230] * Ci[16] + Qi[230] * Cr[16]
+	+ Qr[214] * Ci[32] + Qi[214] * Cr[32]
+	+ Qr[182] * Ci[64] + Qi[182] * Cr[64]
+	+ Qr[118] * Ci[128] + Qi[118] * Cr[128]
+	- 5. * Ci[246];
+      Cr[246] =
+	Qr[226] * Cr[20] - Qi[226] * Ci[20]
+	+ Qr[210] * Cr[36] - Qi[210] * Ci[36]
+	+ Qr[198] * Cr[48] - Qi[198] * Ci[48]
+	+ Qr[178] * Cr[68] - Qi[178] * Ci[68]
+	+ Qr[166] * Cr[80] - Qi[166] * Ci[80]
+	+ Qr[150] * Cr[96] - Qi[150] * Ci[96]
+	+ Qr[114] * Cr[132] - Qi[114] * Ci[132]
+	+ Qr[102] * Cr[144] - Qi[102] * Ci[144]
+	+ Qr[86] * Cr[160] - Qi[86] * Ci[160]
+	+ Qr[54] * Cr[192] - Qi[54] * Ci[192]
+	- 4. * Cr[246];
+      Ci[246] =
+	Qr[226] * Ci[20] + Qi[226] * Cr[20]
+	+ Qr[210] * Ci[36] + Qi[210] * Cr[36]
+	+ Qr[198] * Ci[48] + Qi[198] * Cr[48]
+	+ Qr[178] * Ci[68] + Qi[178] * Cr[68]
+	+ Qr[166] * Ci[80] + Qi[166] * Cr[80]
+	+ Qr[150] * Ci[96] + Qi[150] * Cr[96]
+	+ Qr[114] * Ci[132] + Qi[114] * Cr[132]
+	+ Qr[102] * Ci[144] + Qi[102] * Cr[144]
+	+ Qr[86] * Ci[160] + Qi[86] * Cr[160]
+	+ Qr[54] * Ci[192] + Qi[54] * Cr[192]
+	- 4. * Ci[246];
+      Cr[246] =
+	Qr[194] * Cr[52] - Qi[194] * Ci[52]
+	+ Qr[162] * Cr[84] - Qi[162] * Ci[84]
+	+ Qr[146] * Cr[100] - Qi[146] * Ci[100]
+	+ Qr[134] * Cr[112] - Qi[134] * Ci[112]
+	+ Qr[98] * Cr[148] - Qi[98] * Ci[148]
+	+ Qr[82] * Cr[164] - Qi[82] * Ci[164]
+	+ Qr[70] * Cr[176] - Qi[70] * Ci[176]
+	+ Qr[50] * Cr[196] - Qi[50] * Ci[196]
+	+ Qr[38] * Cr[208] - Qi[38] * Ci[208]
+	+ Qr[22] * Cr[224] - Qi[22] * Ci[224]
+	- 3. * Cr[246];
+      Ci[246] =
+	Qr[194] * Ci[52] + Qi[194] * Cr[52]
+	+ Qr[162] * Ci[84] + Qi[162] * Cr[84]
+	+ Qr[146] * Ci[100] + Qi[146] * Cr[100]
+	+ Qr[134] * Ci[112] + Qi[134] * Cr[112]
+	+ Qr[98] * Ci[148] + Qi[98] * Cr[148]
+	+ Qr[82] * Ci[164] + Qi[82] * Cr[164]
+	+ Qr[70] * Ci[176] + Qi[70] * Cr[176]
+	+ Qr[50] * Ci[196] + Qi[50] * Cr[196]
+	+ Qr[38] * Ci[208] + Qi[38] * Cr[208]
+	+ Qr[22] * Ci[224] + Qi[22] * Cr[224]
+	- 3. * Ci[246];
+      Cr[246] =
+	Qr[130] * Cr[116] - Qi[130] * Ci[116]
+	+ Qr[66] * Cr[180] - Qi[66] * Ci[180]
+	+ Qr[34] * Cr[212] - Qi[34] * Ci[212]
+	+ Qr[18] * Cr[228] - Qi[18] * Ci[228]
+	+ Qr[6] * Cr[240] - Qi[6] * Ci[240]
+	- 2. * Cr[246];
+      Ci[246] =
+	Qr[130] * Ci[116] + Qi[130] * Cr[116]
+	+ Qr[66] * Ci[180] + Qi[66] * Cr[180]
+	+ Qr[34] * Ci[212] + Qi[34] * Cr[212]
+	+ Qr[18] * Ci[228] + Qi[18] * Cr[228]
+	+ Qr[6] * Ci[240] + Qi[6] * Cr[240]
+	- 2. * Ci[246];
+      Cr[246] =
+	Qr[2] * Cr[244] - Qi[2] * Ci[244]
+	- Cr[246];
+      Ci[246] =
+	Qr[2] * Ci[244] + Qi[2] * Cr[244]
+	- Ci[246];
+
+      Cr[248] =
+	Qr[248];
+      Ci[248] =
+	Qi[248];
+      Cr[248] =
+	Qr[232] * Cr[16] - Qi[232] * Ci[16]
+	+ Qr[216] * Cr[32] - Qi[216] * Ci[32]
+	+ Qr[184] * Cr[64] - Qi[184] * Ci[64]
+	+ Qr[120] * Cr[128] - Qi[120] * Ci[128]
+	- 4. * Cr[248];
+      Ci[248] =
+	Qr[232] * Ci[16] + Qi[232] * Cr[16]
+	+ Qr[216] * Ci[32] + Qi[216] * Cr[32]
+	+ Qr[184] * Ci[64] + Qi[184] * Cr[64]
+	+ Qr[120] * Ci[128] + Qi[120] * Cr[128]
+	- 4. * Ci[248];
+      Cr[248] =
+	Qr[200] * Cr[48] - Qi[200] * Ci[48]
+	+ Qr[168] * Cr[80] - Qi[168] * Ci[80]
+	+ Qr[152] * Cr[96] - Qi[152] * Ci[96]
+	+ Qr[104] * Cr[144] - Qi[104] * Ci[144]
+	+ Qr[88] * Cr[160] - Qi[88] * Ci[160]
+	+ Qr[56] * Cr[192] - Qi[56] * Ci[192]
+	- 3. * Cr[248];
+      Ci[248] =
+	Qr[200] * Ci[48] + Qi[200] * Cr[48]
+	+ Qr[168] * Ci[80] + Qi[168] * Cr[80]
+	+ Qr[152] * Ci[96] + Qi[152] * Cr[96]
+	+ Qr[104] * Ci[144] + Qi[104] * Cr[144]
+	+ Qr[88] * Ci[160] + Qi[88] * Cr[160]
+	+ Qr[56] * Ci[192] + Qi[56] * Cr[192]
+	- 3. * Ci[248];
+      Cr[248] =
+	Qr[136] * Cr[112] - Qi[136] * Ci[112]
+	+ Qr[72] * Cr[176] - Qi[72] * Ci[176]
+	+ Qr[40] * Cr[208] - Qi[40] * Ci[208]
+	+ Qr[24] * Cr[224] - Qi[24] * Ci[224]
+	- 2. * Cr[248];
+      Ci[248] =
+	Qr[136] * Ci[112] + Qi[136] * Cr[112]
+	+ Qr[72] * Ci[176] + Qi[72] * Cr[176]
+	+ Qr[40] * Ci[208] + Qi[40] * Cr[208]
+	+ Qr[24] * Ci[224] + Qi[24] * Cr[224]
+	- 2. * Ci[248];
+      Cr[248] =
+	Qr[8] * Cr[240] - Qi[8] * Ci[240]
+	- Cr[248];
+      Ci[248] =
+	Qr[8] * Ci[240] + Qi[8] * Cr[240]
+	- Ci[248];
+
+      Cr[250] =
+	Qr[250];
+      Ci[250] =
+	Qi[250];
+      Cr[250] =
+	Qr[242] * Cr[8] - Qi[242] * Ci[8]
+	+ Qr[234] * Cr[16] - Qi[234] * Ci[16]
+	+ Qr[218] * Cr[32] - Qi[218] * Ci[32]
+	+ Qr[186] * Cr[64] - Qi[186] * Ci[64]
+	+ Qr[122] * Cr[128] - Qi[122] * Ci[128]
+	- 5. * Cr[250];
+      Ci[250] =
+	Qr[242] * Ci[8] + Qi[242] * Cr[8]
+	+ Qr[234] * Ci[16] + Qi[234] * Cr[16]
+	+ Qr[218] * Ci[32] + Qi[218] * Cr[32]
+	+ Qr[186] * Ci[64] + Qi[186] * Cr[64]
+	+ Qr[122] * Ci[128] + Qi[122] * Cr[128]
+	- 5. * Ci[250];
+      Cr[250] =
+	Qr[226] * Cr[24] - Qi[226] * Ci[24]
+	+ Qr[210] * Cr[40] - Qi[210] * Ci[40]
+	+ Qr[202] * Cr[48] - Qi[202] * Ci[48]
+	+ Qr[178] * Cr[72] - Qi[178] * Ci[72]
+	+ Qr[170] * Cr[80] - Qi[170] * Ci[80]
+	+ Qr[154] * Cr[96] - Qi[154] * Ci[96]
+	+ Qr[114] * Cr[136] - Qi[114] * Ci[136]
+	+ Qr[106] * Cr[144] - Qi[106] * Ci[144]
+	+ Qr[90] * Cr[160] - Qi[90] * Ci[160]
+	+ Qr[58] * Cr[192] - Qi[58] * Ci[192]
+	- 4. * Cr[250];
+      Ci[250] =
+	Qr[226] * Ci[24] + Qi[226] * Cr[24]
+	+ Qr[210] * Ci[40] + Qi[210] * Cr[40]
+	+ Qr[202] * Ci[48] + Qi[202] * Cr[48]
+	+ Qr[178] * Ci[72] + Qi[178] * Cr[72]
+	+ Qr[170] * Ci[80] + Qi[170] * Cr[80]
+	+ Qr[154] * Ci[96] + Qi[154] * Cr[96]
+	+ Qr[114] * Ci[136] + Qi[114] * Cr[136]
+	+ Qr[106] * Ci[144] + Qi[106] * Cr[144]
+	+ Qr[90] * Ci[160] + Qi[90] * Cr[160]
+	+ Qr[58] * Ci[192] + Qi[58] * Cr[192]
+	- 4. * Ci[250];
+      Cr[250] =
+	Qr[194] * Cr[56] - Qi[194] * Ci[56]
+	+ Qr[162] * Cr[88] - Qi[162] * Ci[88]
+	+ Qr[146] * Cr[104] - Qi[146] * Ci[104]
+	+ Qr[138] * Cr[112] - Qi[138] * Ci[112]
+	+ Qr[98] * Cr[152] - Qi[98] * Ci[152]
+	+ Qr[82] * Cr[168] - Qi[82] * Ci[168]
+	+ Qr[74] * Cr[176] - Qi[74] * Ci[176]
+	+ Qr[50] * Cr[200] - Qi[50] * Ci[200]
+	+ Qr[42] * Cr[208] - Qi[42] * Ci[208]
+	+ Qr[26] * Cr[224] - Qi[26] * Ci[224]
+	- 3. * Cr[250];
+      Ci[250] =
+	Qr[194] * Ci[56] + Qi[194] * Cr[56]
+	+ Qr[162] * Ci[88] + Qi[162] * Cr[88]
+	+ Qr[146] * Ci[104] + Qi[146] * Cr[104]
+	+ Qr[138] * Ci[112] + Qi[138] * Cr[112]
+	+ Qr[98] * Ci[152] + Qi[98] * Cr[152]
+	+ Qr[82] * Ci[168] + Qi[82] * Cr[168]
+	+ Qr[74] * Ci[176] + Qi[74] * Cr[176]
+	+ Qr[50] * Ci[200] + Qi[50] * Cr[200]
+	+ Qr[42] * Ci[208] + Qi[42] * Cr[208]
+	+ Qr[26] * Ci[224] + Qi[26] * Cr[224]
+	- 3. * Ci[250];
+      Cr[250] =
+	Qr[130] * Cr[120] - Qi[130] * Ci[120]
+	+ Qr[66] * Cr[184] - Qi[66] * Ci[184]
+	+ Qr[34] * Cr[216] - Qi[34] * Ci[216]
+	+ Qr[18] * Cr[232] - Qi[18] * Ci[232]
+	+ Qr[10] * Cr[240] - Qi[10] * Ci[240]
+	- 2. * Cr[250];
+      Ci[250] =
+	Qr[130] * Ci[120] + Qi[130] * Cr[120]
+	+ Qr[66] * Ci[184] + Qi[66] * Cr[184]
+	+ Qr[34] * Ci[216] + Qi[34] * Cr[216]
+	+ Qr[18] * Ci[232] + Qi[18] * Cr[232]
+	+ Qr[10] * Ci[240] + Qi[10] * Cr[240]
+	- 2. * Ci[250];
+      Cr[250] =
+	Qr[2] * Cr[248] - Qi[2] * Ci[248]
+	- Cr[250];
+      Ci[250] =
+	Qr[2] * Ci[248] + Qi[2] * Cr[248]
+	- Ci[250];
+
+      Cr[252] =
+	Qr[252];
+      Ci[252] =
+	Qi[252];
+      Cr[252] =
+	Qr[244] * Cr[8] - Qi[244] * Ci[8]
+	+ Qr[236] * Cr[16] - Qi[236] * Ci[16]
+	+ Qr[220] * Cr[32] - Qi[220] * Ci[32]
+	+ Qr[188] * Cr[64] - Qi[188] * Ci[64]
+	+ Qr[124] * Cr[128] - Qi[124] * Ci[128]
+	- 5. * Cr[252];
+      Ci[252] =
+	Qr[244] * Ci[8] + Qi[244] * Cr[8]
+	+ Qr[236] * Ci[16] + Qi[236] * Cr[16]
+	+ Qr[220] * Ci[32] + Qi[220] * Cr[32]
+	+ Qr[188] * Ci[64] + Qi[188] * Cr[64]
+	+ Qr[124] * Ci[128] + Qi[124] * Cr[128]
+	- 5. * Ci[252];
+      Cr[252] =
+	Qr[228] * Cr[24] - Qi[228] * Ci[24]
+	+ Qr[212] * Cr[40] - Qi[212] * Ci[40]
+	+ Qr[204] * Cr[48] - Qi[204] * Ci[48]
+	+ Qr[180] * Cr[72] - Qi[180] * Ci[72]
+	+ Qr[172] * Cr[80] - Qi[172] * Ci[80]
+	+ Qr[156] * Cr[96] - Qi[156] * Ci[96]
+	+ Qr[116] * Cr[136] - Qi[116] * Ci[136]
+	+ Qr[108] * Cr[144] - Qi[108] * Ci[144]
+	+ Qr[92] * Cr[160] - Qi[92] * Ci[160]
+	+ Qr[60] * Cr[192] - Qi[60] * Ci[192]
+	- 4. * Cr[252];
+      Ci[252] =
+	Qr[228] * Ci[24] + Qi[228] * Cr[24]
+	+ Qr[212] * Ci[40] + Qi[212] * Cr[40]
+	+ Qr[204] * Ci[48] + Qi[204] * Cr[48]
+	+ Qr[180] * Ci[72] + Qi[180] * Cr[72]
+	+ Qr[172] * Ci[80] + Qi[172] * Cr[80]
+	+ Qr[156] * Ci[96] + Qi[156] * Cr[96]
+	+ Qr[116] * Ci[136] + Qi[116] * Cr[136]
+	+ Qr[108] * Ci[144] + Qi[108] * Cr[144]
+	+ Qr[92] * Ci[160] + Qi[92] * Cr[160]
+	+ Qr[60] * Ci[192] + Qi[60] * Cr[192]
+	- 4. * Ci[252];
+      Cr[252] =
+	Qr[196] * Cr[56] - Qi[196] * Ci[56]
+	+ Qr[164] * Cr[88] - Qi[164] * Ci[88]
+	+ Qr[148] * Cr[104] - Qi[148] * Ci[104]
+	+ Qr[140] * Cr[112] - Qi[140] * Ci[112]
+	+ Qr[100] * Cr[152] - Qi[100] * Ci[152]
+	+ Qr[84] * Cr[168] - Qi[84] * Ci[168]
+	+ Qr[76] * Cr[176] - Qi[76] * Ci[176]
+	+ Qr[52] * Cr[200] - Qi[52] * Ci[200]
+	+ Qr[44] * Cr[208] - Qi[44] * Ci[208]
+	+ Qr[28] * Cr[224] - Qi[28] * Ci[224]
+	- 3. * Cr[252];
+      Ci[252] =
+	Qr[196] * Ci[56] + Qi[196] * Cr[56]
+	+ Qr[164] * Ci[88] + Qi[164] * Cr[88]
+	+ Qr[148] * Ci[104] + Qi[148] * Cr[104]
+	+ Qr[140] * Ci[112] + Qi[140] * Cr[112]
+	+ Qr[100] * Ci[152] + Qi[100] * Cr[152]
+	+ Qr[84] * Ci[168] + Qi[84] * Cr[168]
+	+ Qr[76] * Ci[176] + Qi[76] * Cr[176]
+	+ Qr[52] * Ci[200] + Qi[52] * Cr[200]
+	+ Qr[44] * Ci[208] + Qi[44] * Cr[208]
+	+ Qr[28] * Ci[224] + Qi[28] * Cr[224]
+	- 3. * Ci[252];
+      Cr[252] =
+	Qr[132] * Cr[120] - Qi[132] * Ci[120]
+	+ Qr[68] * Cr[184] - Qi[68] * Ci[184]
+	+ Qr[36] * Cr[216] - Qi[36] * Ci[216]
+	+ Qr[20] * Cr[232] - Qi[20] * Ci[232]
+	+ Qr[12] * Cr[240] - Qi[12] * Ci[240]
+	- 2. * Cr[252];
+      Ci[252] =
+	Qr[132] * Ci[120] + Qi[132] * Cr[120]
+	+ Qr[68] * Ci[184] + Qi[68] * Cr[184]
+	+ Qr[36] * Ci[216] + Qi[36] * Cr[216]
+	+ Qr[20] * Ci[232] + Qi[20] * Cr[232]
+	+ Qr[12] * Ci[240] + Qi[12] * Cr[240]
+	- 2. * Ci[252];
+      Cr[252] =
+	Qr[4] * Cr[248] - Qi[4] * Ci[248]
+	- Cr[252];
+      Ci[252] =
+	Qr[4] * Ci[248] + Qi[4] * Cr[248]
+	- Ci[252];
+
+      Cr[254] =
+	Qr[254];
+      Ci[254] =
+	Qi[254];
+      Cr[254] =
+	Qr[250] * Cr[4] - Qi[250] * Ci[4]
+	+ Qr[246] * Cr[8] - Qi[246] * Ci[8]
+	+ Qr[238] * Cr[16] - Qi[238] * Ci[16]
+	+ Qr[222] * Cr[32] - Qi[222] * Ci[32]
+	+ Qr[190] * Cr[64] - Qi[190] * Ci[64]
+	+ Qr[126] * Cr[128] - Qi[126] * Ci[128]
+	- 6. * Cr[254];
+      Ci[254] =
+	Qr[250] * Ci[4] + Qi[250] * Cr[4]
+	+ Qr[246] * Ci[8] + Qi[246] * Cr[8]
+	+ Qr[238] * Ci[16] + Qi[238] * Cr[16]
+	+ Qr[222] * Ci[32] + Qi[222] * Cr[32]
+	+ Qr[190] * Ci[64] + Qi[190] * Cr[64]
+	+ Qr[126] * Ci[128] + Qi[126] * Cr[128]
+	- 6. * Ci[254];
+      Cr[254] =
+	Qr[242] * Cr[12] - Qi[242] * Ci[12]
+	+ Qr[234] * Cr[20] - Qi[234] * Ci[20]
+	+ Qr[230] * Cr[24] - Qi[230] * Ci[24]
+	+ Qr[218] * Cr[36] - Qi[218] * Ci[36]
+	+ Qr[214] * Cr[40] - Qi[214] * Ci[40]
+	+ Qr[206] * Cr[48] - Qi[206] * Ci[48]
+	+ Qr[186] * Cr[68] - Qi[186] * Ci[68]
+	+ Qr[182] * Cr[72] - Qi[182] * Ci[72]
+	+ Qr[174] * Cr[80] - Qi[174] * Ci[80]
+	+ Qr[158] * Cr[96] - Qi[158] * Ci[96]
+	+ Qr[122] * Cr[132] - Qi[122] * Ci[132]
+	+ Qr[118] * Cr[136] - Qi[118] * Ci[136]
+	+ Qr[110] * Cr[144] - Qi[110] * Ci[144]
+	+ Qr[94] * Cr[160] - Qi[94] * Ci[160]
+	+ Qr[62] * Cr[192] - Qi[62] * Ci[192]
+	- 5. * Cr[254];
+      Ci[254] =
+	Qr[242] * Ci[12] + Qi[242] * Cr[12]
+	+ Qr[234] * Ci[20] + Qi[234] * Cr[20]
+	+ Qr[230] * Ci[24] + Qi[230] * Cr[24]
+	+ Qr[218] * Ci[36] + Qi[218] * Cr[36]
+	+ Qr[214] * Ci[40] + Qi[214] * Cr[40]
+	+ Qr[206] * Ci[48] + Qi[206] * Cr[48]
+	+ Qr[186] * Ci[68] + Qi[186] * Cr[68]
+	+ Qr[182] * Ci[72] + Qi[182] * Cr[72]
+	+ Qr[174] * Ci[80] + Qi[174] * Cr[80]
+	+ Qr[158] * Ci[96] + Qi[158] * Cr[96]
+	+ Qr[122] * Ci[132] + Qi[122] * Cr[132]
+	+ Qr[118] * Ci[136] + Qi[118] * Cr[136]
+	+ Qr[110] * Ci[144] + Qi[110] * Cr[144]
+	+ Qr[94] * Ci[160] + Qi[94] * Cr[160]
+	+ Qr[62] * Ci[192] + Qi[62] * Cr[192]
+	- 5. * Ci[254];
+      Cr[254] =
+	Qr[226] * Cr[28] - Qi[226] * Ci[28]
+	+ Qr[210] * Cr[44] - Qi[210] * Ci[44]
+	+ Qr[202] * Cr[52] - Qi[202] * Ci[52]
+	+ Qr[198] * Cr[56] - Qi[198] * Ci[56]
+	+ Qr[178] * Cr[76] - Qi[178] * Ci[76]
+	+ Qr[170] * Cr[84] - Qi[170] * Ci[84]
+	+ Qr[166] * Cr[88] - Qi[166] * Ci[88]
+	+ Qr[154] * Cr[100] - Qi[154] * Ci[100]
+	+ Qr[150] * Cr[104] - Qi[150] * Ci[104]
+	+ Qr[142] * Cr[112] - Qi[142] * Ci[112]
+	+ Qr[114] * Cr[140] - Qi[114] * Ci[140]
+	+ Qr[106] * Cr[148] - Qi[106] * Ci[148]
+	+ Qr[102] * Cr[152] - Qi[102] * Ci[152]
+	+ Qr[90] * Cr[164] - Qi[90] * Ci[164]
+	+ Qr[86] * Cr[168] - Qi[86] * Ci[168]
+	+ Qr[78] * Cr[176] - Qi[78] * Ci[176]
+	+ Qr[58] * Cr[196] - Qi[58] * Ci[196]
+	+ Qr[54] * Cr[200] - Qi[54] * Ci[200]
+	+ Qr[46] * Cr[208] - Qi[46] * Ci[208]
+	+ Qr[30] * Cr[224] - Qi[30] * Ci[224]
+	- 4. * Cr[254];
+      Ci[254] =
+	Qr[226] * Ci[28] + Qi[226] * Cr[28]
+	+ Qr[210] * Ci[44] + Qi[210] * Cr[44]
+	+ Qr[202] * Ci[52] + Qi[202] * Cr[52]
+	+ Qr[198] * Ci[56] + Qi[198] * Cr[56]
+	+ Qr[178] * Ci[76] + Qi[178] * Cr[76]
+	+ Qr[170] * Ci[84] + Qi[170] * Cr[84]
+	+ Qr[166] * Ci[88] + Qi[166] * Cr[88]
+	+ Qr[154] * Ci[100] + Qi[154] * Cr[100]
+	+ Qr[150] * Ci[104] + Qi[150] * Cr[104]
+	+ Qr[142] * Ci[112] + Qi[142] * Cr[112]
+	+ Qr[114] * Ci[140] + Qi[114] * Cr[140]
+	+ Qr[106] * Ci[148] + Qi[106] * Cr[148]
+	+ Qr[102] * Ci[152] + Qi[102] * Cr[152]
+	+ Qr[90] * Ci[164] + Qi[90] * Cr[164]
+	+ Qr[86] * Ci[168] + Qi[86] * Cr[168]
+	+ Qr[78] * Ci[176] + Qi[78] * Cr[176]
+	+ Qr[58] * Ci[196] + Qi[58] * Cr[196]
+	+ Qr[54] * Ci[200] + Qi[54] * Cr[200]
+	+ Qr[46] * Ci[208] + Qi[46] * Cr[208]
+	+ Qr[30] * Ci[224] + Qi[30] * Cr[224]
+	- 4. * Ci[254];
+      Cr[254] =
+	Qr[194] * Cr[60] - Qi[194] * Ci[60]
+	+ Qr[162] * Cr[92] - Qi[162] * Ci[92]
+	+ Qr[146] * Cr[108] - Qi[146] * Ci[108]
+	+ Qr[138] * Cr[116] - Qi[138] * Ci[116]
+	+ Qr[134] * Cr[120] - Qi[134] * Ci[120]
+	+ Qr[98] * Cr[156] - Qi[98] * Ci[156]
+	+ Qr[82] * Cr[172] - Qi[82] * Ci[172]
+	+ Qr[74] * Cr[180] - Qi[74] * Ci[180]
+	+ Qr[70] * Cr[184] - Qi[70] * Ci[184]
+	+ Qr[50] * Cr[204] - Qi[50] * Ci[204]
+	+ Qr[42] * Cr[212] - Qi[42] * Ci[212]
+	+ Qr[38] * Cr[216] - Qi[38] * Ci[216]
+	+ Qr[26] * Cr[228] - Qi[26] * Ci[228]
+	+ Qr[22] * Cr[232] - Qi[22] * Ci[232]
+	+ Qr[14] * Cr[240] - Qi[14] * Ci[240]
+	- 3. * Cr[254];
+      Ci[254] =
+	Qr[194] * Ci[60] + Qi[194] * Cr[60]
+	+ Qr[162] * Ci[92] + Qi[162] * Cr[92]
+	+ Qr[146] * Ci[108] + Qi[146] * Cr[108]
+	+ Qr[138] * Ci[116] + Qi[138] * Cr[116]
+	+ Qr[134] * Ci[120] + Qi[134] * Cr[120]
+	+ Qr[98] * Ci[156] + Qi[98] * Cr[156]
+	+ Qr[82] * Ci[172] + Qi[82] * Cr[172]
+	+ Qr[74] * Ci[180] + Qi[74] * Cr[180]
+	+ Qr[70] * Ci[184] + Qi[70] * Cr[184]
+	+ Qr[50] * Ci[204] + Qi[50] * Cr[204]
+	+ Qr[42] * Ci[212] + Qi[42] * Cr[212]
+	+ Qr[38] * Ci[216] + Qi[38] * Cr[216]
+	+ Qr[26] * Ci[228] + Qi[26] * Cr[228]
+	+ Qr[22] * Ci[232] + Qi[22] * Cr[232]
+	+ Qr[14] * Ci[240] + Qi[14] * Cr[240]
+	- 3. * Ci[254];
+      Cr[254] =
+	Qr[130] * Cr[124] - Qi[130] * Ci[124]
+	+ Qr[66] * Cr[188] - Qi[66] * Ci[188]
+	+ Qr[34] * Cr[220] - Qi[34] * Ci[220]
+	+ Qr[18] * Cr[236] - Qi[18] * Ci[236]
+	+ Qr[10] * Cr[244] - Qi[10] * Ci[244]
+	+ Qr[6] * Cr[248] - Qi[6] * Ci[248]
+	- 2. * Cr[254];
+      Ci[254] =
+	Qr[130] * Ci[124] + Qi[130] * Cr[124]
+	+ Qr[66] * Ci[188] + Qi[66] * Cr[188]
+	+ Qr[34] * Ci[220] + Qi[34] * Cr[220]
+	+ Qr[18] * Ci[236] + Qi[18] * Cr[236]
+	+ Qr[10] * Ci[244] + Qi[10] * Cr[244]
+	+ Qr[6] * Ci[248] + Qi[6] * Cr[248]
+	- 2. * Ci[254];
+      Cr[254] =
+	Qr[2] * Cr[252] - Qi[2] * Ci[252]
+	- Cr[254];
+      Ci[254] =
+	Qr[2] * Ci[252] + Qi[2] * Cr[252]
+	- Ci[254];
+    }
+
+    /** Part 8 of expand8 */
+    inline CORRELATIONS_NOINLINE void
+    expand8Part8(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[255] =
+	Qr[255];
+      Ci[255] =
+	Qi[255];
+      Cr[255] =
+	Qr[253] * Cr[2] - Qi[253] * Ci[2]
+	+ Qr[251] * Cr[4] - Qi[251] * Ci[4]
+	+ Qr[247] * Cr[8] - Qi[247] * Ci[8]
+	+ Qr[239] * Cr[16] - Qi[239] * Ci[16]
+	+ Qr[223] * Cr[32] - Qi[223] * Ci[32]
+	+ Qr[191] * Cr[64] - Qi[191] * Ci[64]
+	+ Qr[127] * Cr[128] - Qi[127] * Ci[128]
+	- 7. * Cr[255];
+      Ci[255] =
+	Qr[253] * Ci[2] + Qi[253] * Cr[2]
+	+ Qr[251] * Ci[4] + Qi[251] * Cr[4]
+	+ Qr[247] * Ci[8] + Qi[247] * Cr[8]
+	+ Qr[239] * Ci[16] + Qi[239] * Cr[16]
+	+ Qr[223] * Ci[32] + Qi[223] * Cr[32]
+	+ Qr[191] * Ci[64] + Qi[191] * Cr[64]
+	+ Qr[127] * Ci[128] + Qi[127] * Cr[128]
+	- 7. * Ci[255];
+      Cr[255] =
+	Qr[249] * Cr[6] - Qi[249] * Ci[6]
+	+ Qr[245] * Cr[10] - Qi[245] * Ci[10]
+	+ Qr[243] * Cr[12] - Qi[243] * Ci[12]
+	+ Qr[237] * Cr[18] - Qi[237] * Ci[18]
+	+ Qr[235] * Cr[20] - Qi[235] * Ci[20]
+	+ Qr[231] * Cr[24] - Qi[231] * Ci[24]
+	+ Qr[221] * Cr[34] - Qi[221] * Ci[34]
+	+ Qr[219] * Cr[36] - Qi[219] * Ci[36]
+	+ Qr[215] * Cr[40] - Qi[215] * Ci[40]
+	+ Qr[207] * Cr[48] - Qi[207] * Ci[48]
+	+ Qr[189] * Cr[66] - Qi[189] * Ci[66]
+	+ Qr[187] * Cr[68] - Qi[187] * Ci[68]
+	+ Qr[183] * Cr[72] - Qi[183] * Ci[72]
+	+ Qr[175] * Cr[80] - Qi[175] * Ci[80]
+	+ Qr[159] * Cr[96] - Qi[159] * Ci[96]
+	+ Qr[125] * Cr[130] - Qi[125] * Ci[130]
+	+ Qr[123] * Cr[132] - Qi[123] * Ci[132]
+	+ Qr[119] * Cr[136] - Qi[119] * Ci[136]
+	+ Qr[111] * Cr[144] - Qi[111] * Ci[144]
+	+ Qr[95] * Cr[160] - Qi[95] * Ci[160]
+	+ Qr[63] * Cr[192] - Qi[63] * Ci[192]
+	- 6. * Cr[255];
+      Ci[255] =
+	Qr[249] * Ci[6] + Qi[249] * Cr[6]
+	+ Qr[245] * Ci[10] + Qi[245] * Cr[10]
+	+ Qr[243] * Ci[12] + Qi[243] * Cr[12]
+	+ Qr[237] * Ci[18] + Qi[237] * Cr[18]
+	+ Qr[235] * Ci[20] + Qi[235] * Cr[20]
+	+ Qr[231] * Ci[24] + Qi[231] * Cr[24]
+	+ Qr[221] * Ci[34] + Qi[221] * Cr[34]
+	+ Qr[219] * Ci[36] + Qi[219] * Cr[36]
+	+ Qr[215] * Ci[40] + Qi[215] * Cr[40]
+	+ Qr[207] * Ci[48] + Qi[207] * Cr[48]
+	+ Qr[189] * Ci[66] + Qi[189] * Cr[66]
+	+ Qr[187] * Ci[68] + Qi[187] * Cr[68]
+	+ Qr[183] * Ci[72] + Qi[183] * Cr[72]
+	+ Qr[175] * Ci[80] + Qi[175] * Cr[80]
+	+ Qr[159] * Ci[96] + Qi[159] * Cr[96]
+	+ Qr[125] * Ci[130] + Qi[125] * Cr[130]
+	+ Qr[123] * Ci[132] + Qi[123] * Cr[132]
+	+ Qr[119] * Ci[136] + Qi[119] * Cr[136]
+	+ Qr[111] * Ci[144] + Qi[111] * Cr[144]
+	+ Qr[95] * Ci[160] + Qi[95] * Cr[160]
+	+ Qr[63] * Ci[192] + Qi[63] * Cr[192]
+	- 6. * Ci[255];
+      Cr[255] =
+	Qr[241] * Cr[14] - Qi[241] * Ci[14]
+	+ Qr[233] * Cr[22] - Qi[233] * Ci[22]
+	+ Qr[229] * Cr[26] - Qi[229] * Ci[26]
+	+ Qr[227] * Cr[28] - Qi[227] * Ci[28]
+	+ Qr[217] * Cr[38] - Qi[217] * Ci[38]
+	+ Qr[213] * Cr[42] - Qi[213] * Ci[42]
+	+ Qr[211] * Cr[44] - Qi[211] * Ci[44]
+	+ Qr[205] * Cr[50] - Qi[205] * Ci[50]
+	+ Qr[203] * Cr[52] - Qi[203] * Ci[52]
+	+ Qr[199] * Cr[56] - Qi[199] * Ci[56]
+	+ Qr[185] * Cr[70] - Qi[185] * Ci[70]
+	+ Qr[181] * Cr[74] - Qi[181] * Ci[74]
+	+ Qr[179] * Cr[76] - Qi[179] * Ci[76]
+	+ Qr[173] * Cr[82] - Qi[173] * Ci[82]
+	+ Qr[171] * Cr[84] - Qi[171] * Ci[84]
+	+ Qr[167] * Cr[88] - Qi[167] * Ci[88]
+	+ Qr[157] * Cr[98] - Qi[157] * Ci[98]
+	+ Qr[155] * Cr[100] - Qi[155] * Ci[100]
+	+ Qr[151] * Cr[104] - Qi[151] * Ci[104]
+	+ Qr[143] * Cr[112] - Qi[143] * Ci[112]
+	+ Qr[121] * Cr[134] - Qi[121] * Ci[134]
+	+ Qr[117] * Cr[138] - Qi[117] * Ci[138]
+	+ Qr[115] * Cr[140] - Qi[115] * Ci[140]
+	+ Qr[109] * Cr[146] - Qi[109] * Ci[146]
+	+ Qr[107] * Cr[148] - Qi[107] * Ci[148]
+	+ Qr[103] * Cr[152] - Qi[103] * Ci[152]
+	+ Qr[93] * Cr[162] - Qi[93] * Ci[162]
+	+ Qr[91] * Cr[164] - Qi[91] * Ci[164]
+	+ Qr[87] * Cr[168] - Qi[87] * Ci[168]
+	+ Qr[79] * Cr[176] - Qi[79] * Ci[176]
+	+ Qr[61] * Cr[194] - Qi[61] * Ci[194]
+	+ Qr[59] * Cr[196] - Qi[59] * Ci[196]
+	+ Qr[55] * Cr[200] - Qi[55] * Ci[200]
+	+ Qr[47] * Cr[208] - Qi[47] * Ci[208]
+	+ Qr[31] * Cr[224] - Qi[31] * Ci[224]
+	- 5. * Cr[255];
+      Ci[255] =
+	Qr[241] * Ci[14] + Qi[241] * Cr[14]
+	+ Qr[233] * Ci[22] + Qi[233] * Cr[22]
+	+ Qr[229] * Ci[26] + Qi[229] * Cr[26]
+	+ Qr[227] * Ci[28] + Qi[227] * Cr[28]
+	+ Qr[217] * Ci[38] + Qi[217] * Cr[38]
+	+ Qr[213] * Ci[42] + Qi[213] * Cr[42]
+	+ Qr[211] * Ci[44] + Qi[211] * Cr[44]
+	+ Qr[205] * Ci[50] + Qi[205] * Cr[50]
+	+ Qr[203] * Ci[52] + Qi[203] * Cr[52]
+	+ Qr[199] * Ci[56] + Qi[199] * Cr[56]
+	+ Qr[185] * Ci[70] + Qi[185] * Cr[70]
+	+ Qr[181] * Ci[74] + Qi[181] * Cr[74]
+	+ Qr[179] * Ci[76] + Qi[179] * Cr[76]
+	+ Qr[173] * Ci[82] + Qi[173] * Cr[82]
+	+ Qr[171] * Ci[84] + Qi[171] * Cr[84]
+	+ Qr[167] * Ci[88] + Qi[167] * Cr[88]
+	+ Qr[157] * Ci[98] + Qi[157] * Cr[98]
+	+ Qr[155] * Ci[100] + Qi[155] * Cr[100]
+	+ Qr[151] * Ci[104] + Qi[151] * Cr[104]
+	+ Qr[143] * Ci[112] + Qi[143] * Cr[112]
+	+ Qr[121] * Ci[134] + Qi[121] * Cr[134]
+	+ Qr[117] * Ci[138] + Qi[117] * Cr[138]
+	+ Qr[115] * Ci[140] + Qi[115] * Cr[140]
+	+ Qr[109] * Ci[146] + Qi[109] * Cr[146]
+	+ Qr[107] * Ci[148] + Qi[107] * Cr[148]
+	+ Qr[103] * Ci[152] + Qi[103] * Cr[152]
+	+ Qr[93] * Ci[162] + Qi[93] * Cr[162]
+	+ Qr[91] * Ci[164] + Qi[91] * Cr[164]
+	+ Qr[87] * Ci[168] + Qi[87] * Cr[168]
+	+ Qr[79] * Ci[176] + Qi[79] * Cr[176]
+	+ Qr[61] * Ci[194] + Qi[61] * Cr[194]
+	+ Qr[59] * Ci[196] + Qi[59] * Cr[196]
+	+ Qr[55] * Ci[200] + Qi[55] * Cr[200]
+	+ Qr[47] * Ci[208] + Qi[47] * Cr[208]
+	+ Qr[31] * Ci[224] + Qi[31] * Cr[224]
+	- 5. * Ci[255];
+      Cr[255] =
+	Qr[225] * Cr[30] - Qi[225] * Ci[30]
+	+ Qr[209] * Cr[46] - Qi[209] * Ci[46]
+	+ Qr[201] * Cr[54] - Qi[201] * Ci[54]
+	+ Qr[197] * Cr[58] - Qi[197] * Ci[58]
+	+ Qr[195] * Cr[60] - Qi[195] * Ci[60]
+	+ Qr[177] * Cr[78] - Qi[177] * Ci[78]
+	+ Qr[169] * Cr[86] - Qi[169] * Ci[86]
+	+ Qr[165] * Cr[90] - Qi[165] * Ci[90]
+	+ Qr[163] * Cr[92] - Qi[163] * Ci[92]
+	+ Qr[153] * Cr[102] - Qi[153] * Ci[102]
+	+ Qr[149] * Cr[106] - Qi[149] * Ci[106]
+	+ Qr[147] * Cr[108] - Qi[147] * Ci[108]
+	+ Qr[141] * Cr[114] - Qi[141] * Ci[114]
+	+ Qr[139] * Cr[116] - Qi[139] * Ci[116]
+	+ Qr[135] * Cr[120] - Qi[135] * Ci[120]
+	+ Qr[113] * Cr[142] - Qi[113] * Ci[142]
+	+ Qr[105] * Cr[150] - Qi[105] * Ci[150]
+	+ Qr[101] * Cr[154] - Qi[101] * Ci[154]
+	+ Qr[99] * Cr[156] - Qi[99] * Ci[156]
+	+ Qr[89] * Cr[166] - Qi[89] * Ci[166]
+	+ Qr[85] * Cr[170] - Qi[85] * Ci[170]
+	+ Qr[83] * Cr[172] - Qi[83] * Ci[172]
+	+ Qr[77] * Cr[178] - Qi[77] * Ci[178]
+	+ Qr[75] * Cr[180] - Qi[75] * Ci[180]
+	+ Qr[71] * Cr[184] - Qi[71] * Ci[184]
+	+ Qr[57] * Cr[198] - Qi[57] * Ci[198]
+	+ Qr[53] * Cr[202] - Qi[53] * Ci[202]
+	+ Qr[51] * Cr[204] - Qi[51] * Ci[204]
+	+ Qr[45] * Cr[210] - Qi[45] * Ci[210]
+	+ Qr[43] * Cr[212] - Qi[43] * Ci[212]
+	+ Qr[39] * Cr[216] - Qi[39] * Ci[216]
+	+ Qr[29] * Cr[226] - Qi[29] * Ci[226]
+	+ Qr[27] * Cr[228] - Qi[27] * Ci[228]
+	+ Qr[23] * Cr[232] - Qi[23] * Ci[232]
+	+ Qr[15] * Cr[240] - Qi[15] * Ci[240]
+	- 4. * Cr[255];
+      Ci[255] =
+	Qr[225] * Ci[30] + Qi[225] * Cr[30]
+	+ Qr[209] * Ci[46] + Qi[209] * Cr[46]
+	+ Qr[201] * Ci[54] + Qi[201] * Cr[54]
+	+ Qr[197] * Ci[58] + Qi[197] * Cr[58]
+	+ Qr[195] * Ci[60] + Qi[195] * Cr[60]
+	+ Qr[177] * Ci[78] + Qi[177] * Cr[78]
+	+ Qr[169] * Ci[86] + Qi[169] * Cr[86]
+	+ Qr[165] * Ci[90] + Qi[165] * Cr[90]
+	+ Qr[163] * Ci[92] + Qi[163] * Cr[92]
+	+ Qr[153] * Ci[102] + Qi[153] * Cr[102]
+	+ Qr[149] * Ci[106] + Qi[149] * Cr[106]
+	+ Qr[147] * Ci[108] + Qi[147] * Cr[108]
+	+ Qr[141] * Ci[114] + Qi[141] * Cr[114]
+	+ Qr[139] * Ci[116] + Qi[139] * Cr[116]
+	+ Qr[135] * Ci[120] + Qi[135] * Cr[120]
+	+ Qr[113] * Ci[142] + Qi[113] * Cr[142]
+	+ Qr[105] * Ci[150] + Qi[105] * Cr[150]
+	+ Qr[101] * Ci[154] + Qi[101] * Cr[154]
+	+ Qr[99] * Ci[156] + Qi[99] * Cr[156]
+	+ Qr[89] * Ci[166] + Qi[89] * Cr[166]
+	+ Qr[85] * Ci[170] + Qi[85] * Cr[170]
+	+ Qr[83] * Ci[172] + Qi[83] * Cr[172]
+	+ Qr[77] * Ci[178] + Qi[77] * Cr[178]
+	+ Qr[75] * Ci[180] + Qi[75] * Cr[180]
+	+ Qr[71] * Ci[184] + Qi[71] * Cr[184]
+	+ Qr[57] * Ci[198] + Qi[57] * Cr[198]
+	+ Qr[53] * Ci[202] + Qi[53] * Cr[202]
+	+ Qr[51] * Ci[204] + Qi[51] * Cr[204]
+	+ Qr[45] * Ci[210] + Qi[45] * Cr[210]
+	+ Qr[43] * Ci[212] + Qi[43] * Cr[212]
+	+ Qr[39] * Ci[216] + Qi[39] * Cr[216]
+	+ Qr[29] * Ci[226] + Qi[29] * Cr[226]
+	+ Qr[27] * Ci[228] + Qi[27] * Cr[228]
+	+ Qr[23] * Ci[232] + Qi[23] * Cr[232]
+	+ Qr[15] * Ci[240] + Qi[15] * Cr[240]
+	- 4. * Ci[255];
+      Cr[255] =
+	Qr[193] * Cr[62] - Qi[193] * Ci[62]
+	+ Qr[161] * Cr[94] - Qi[161] * Ci[94]
+	+ Qr[145] * Cr[110] - Qi[145] * Ci[110]
+	+ Qr[137] * Cr[118] - Qi[137] * Ci[118]
+	+ Qr[133] * Cr[122] - Qi[133] * Ci[122]
+	+ Qr[131] * Cr[124] - Qi[131] * Ci[124]
+	+ Qr[97] * Cr[158] - Qi[97] * Ci[158]
+	+ Qr[81] * Cr[174] - Qi[81] * Ci[174]
+	+ Qr[73] * Cr[182] - Qi[73] * Ci[182]
+	+ Qr[69] * Cr[186] - Qi[69] * Ci[186]
+	+ Qr[67] * Cr[188] - Qi[67] * Ci[188]
+	+ Qr[49] * Cr[206] - Qi[49] * Ci[206]
+	+ Qr[41] * Cr[214] - Qi[41] * Ci[214]
+	+ Qr[37] * Cr[218] - Qi[37] * Ci[218]
+	+ Qr[35] * Cr[220] - Qi[35] * Ci[220]
+	+ Qr[25] * Cr[230] - Qi[25] * Ci[230]
+	+ Qr[21] * Cr[234] - Qi[21] * Ci[234]
+	+ Qr[19] * Cr[236] - Qi[19] * Ci[236]
+	+ Qr[13] * Cr[242] - Qi[13] * Ci[242]
+	+ Qr[11] * Cr[244] - Qi[11] * Ci[244]
+	+ Qr[7] * Cr[248] - Qi[7] * Ci[248]
+	- 3. * Cr[255];
+      Ci[255] =
+	Qr[193] * Ci[62] + Qi[193] * Cr[62]
+	+ Qr[161] * Ci[94] + Qi[161] * Cr[94]
+	+ Qr[145] * Ci[110] + Qi[145] * Cr[110]
+	+ Qr[137] * Ci[118] + Qi[137] * Cr[118]
+	+ Qr[133] * Ci[122] + Qi[133] * Cr[122]
+	+ Qr[131] * Ci[124] + Qi[131] * Cr[124]
+	+ Qr[97] * Ci[158] + Qi[97] * Cr[158]
+	+ Qr[81] * Ci[174] + Qi[81] * Cr[174]
+	+ Qr[73] * Ci[182] + Qi[73] * Cr[182]
+	+ Qr[69] * Ci[186] + Qi[69] * Cr[186]
+	+ Qr[67] * Ci[188] + Qi[67] * Cr[188]
+	+ Qr[49] * Ci[206] + Qi[49] * Cr[206]
+	+ Qr[41] * Ci[214] + Qi[41] * Cr[214]
+	+ Qr[37] * Ci[218] + Qi[37] * Cr[218]
+	+ Qr[35] * Ci[220] + Qi[35] * Cr[220]
+	+ Qr[25] * Ci[230] + Qi[25] * Cr[230]
+	+ Qr[21] * Ci[234] + Qi[21] * Cr[234]
+	+ Qr[19] * Ci[236] + Qi[19] * Cr[236]
+	+ Qr[13] * Ci[242] + Qi[13] * Cr[242]
+	+ Qr[11] * Ci[244] + Qi[11] * Cr[244]
+	+ Qr[7] * Ci[248] + Qi[7] * Cr[248]
+	- 3. * Ci[255];
+      Cr[255] =
+	Qr[129] * Cr[126] - Qi[129] * Ci[126]
+	+ Qr[65] * Cr[190] - Qi[65] * Ci[190]
+	+ Qr[33] * Cr[222] - Qi[33] * Ci[222]
+	+ Qr[17] * Cr[238] - Qi[17] * Ci[238]
+	+ Qr[9] * Cr[246] - Qi[9] * Ci[246]
+	+ Qr[5] * Cr[250] - Qi[5] * Ci[250]
+	+ Qr[3] * Cr[252] - Qi[3] * Ci[252]
+	- 2. * Cr[255];
+      Ci[255] =
+	Qr[129] * Ci[126] + Qi[129] * Cr[126]
+	+ Qr[65] * Ci[190] + Qi[65] * Cr[190]
+	+ Qr[33] * Ci[222] + Qi[33] * Cr[222]
+	+ Qr[17] * Ci[238] + Qi[17] * Cr[238]
+	+ Qr[9] * Ci[246] + Qi[9] * Cr[246]
+	+ Qr[5] * Ci[250] + Qi[5] * Cr[250]
+	+ Qr[3] * Ci[252] + Qi[3] * Cr[252]
+	- 2. * Ci[255];
+      Cr[255] =
+	Qr[1] * Cr[254] - Qi[1] * Ci[254]
+	- Cr[255];
+      Ci[255] =
+	Qr[1] * Ci[254] + Qi[1] * Cr[254]
+	- Ci[255];
+    }
+
+    /**
+     * @param q Q-vector
+     * @param h Harmonics (at least 8)
+     *
+     * @return @f$ QC\{8\}@f$
+     */
+    CORRELATIONS_KERNEL Complex expand8(const QVector& q, const Harmonic* h)
+    {
+      Real    Qr[256], Qi[256];
+      Real    Cr[256], Ci[256];
+      Complex z;
+      z = q(h[0], 1); Qr[1] = z.real(); Qi[1] = z.imag();
+      z = q(h[1], 1); Qr[2] = z.real(); Qi[2] = z.imag();
+      z = q(h[0]+h[1], 2); Qr[3] = z.real(); Qi[3] = z.imag();
+      z = q(h[2], 1); Qr[4] = z.real(); Qi[4] = z.imag();
+      z = q(h[0]+h[2], 2); Qr[5] = z.real(); Qi[5] = z.imag();
+      z = q(h[1]+h[2], 2); Qr[6] = z.real(); Qi[6] = z.imag();
+      z = q(h[0]+h[1]+h[2], 3); Qr[7] = z.real(); Qi[7] = z.imag();
+      z = q(h[3], 1); Qr[8] = z.real(); Qi[8] = z.imag();
+      z = q(h[0]+h[3], 2); Qr[9] = z.real(); Qi[9] = z.imag();
+      z = q(h[1]+h[3], 2); Qr[10] = z.real(); Qi[10] = z.imag();
+      z = q(h[0]+h[1]+h[3], 3); Qr[11] = z.real(); Qi[11] = z.imag();
+      z = q(h[2]+h[3], 2); Qr[12] = z.real(); Qi[12] = z.imag();
+      z = q(h[0]+h[2]+h[3], 3); Qr[13] = z.real(); Qi[13] = z.imag();
+      z = q(h[1]+h[2]+h[3], 3); Qr[14] = z.real(); Qi[14] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3], 4); Qr[15] = z.real(); Qi[15] = z.imag();
+      z = q(h[4], 1); Qr[16] = z.real(); Qi[16] = z.imag();
+      z = q(h[0]+h[4], 2); Qr[17] = z.real(); Qi[17] = z.imag();
+      z = q(h[1]+h[4], 2); Qr[18] = z.real(); Qi[18] = z.imag();
+      z = q(h[0]+h[1]+h[4], 3); Qr[19] = z.real(); Qi[19] = z.imag();
+      z = q(h[2]+h[4], 2); Qr[20] = z.real(); Qi[20] = z.imag();
+      z = q(h[0]+h[2]+h[4], 3); Qr[21] = z.real(); Qi[21] = z.imag();
+      z = q(h[1]+h[2]+h[4], 3); Qr[22] = z.real(); Qi[22] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4], 4); Qr[23] = z.real(); Qi[23] = z.imag();
+      z = q(h[3]+h[4], 2); Qr[24] = z.real(); Qi[24] = z.imag();
+      z = q(h[0]+h[3]+h[4], 3); Qr[25] = z.real(); Qi[25] = z.imag();
+      z = q(h[1]+h[3]+h[4], 3); Qr[26] = z.real(); Qi[26] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4], 4); Qr[27] = z.real(); Qi[27] = z.imag();
+      z = q(h[2]+h[3]+h[4], 3); Qr[28] = z.real(); Qi[28] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4], 4); Qr[29] = z.real(); Qi[29] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4], 4); Qr[30] = z.real(); Qi[30] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4], 5); Qr[31] = z.real(); Qi[31] = z.imag();
+      z = q(h[5], 1); Qr[32] = z.real(); Qi[32] = z.imag();
+      z = q(h[0]+h[5], 2); Qr[33] = z.real(); Qi[33] = z.imag();
+      z = q(h[1]+h[5], 2); Qr[34] = z.real(); Qi[34] = z.imag();
+      z = q(h[0]+h[1]+h[5], 3); Qr[35] = z.real(); Qi[35] = z.imag();
+      z = q(h[2]+h[5], 2); Qr[36] = z.real(); Qi[36] = z.imag();
+      z = q(h[0]+h[2]+h[5], 3); Qr[37] = z.real(); Qi[37] = z.imag();
+      z = q(h[1]+h[2]+h[5], 3); Qr[38] = z.real(); Qi[38] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[5], 4); Qr[39] = z.real(); Qi[39] = z.imag();
+      z = q(h[3]+h[5], 2); Qr[40] = z.real(); Qi[40] = z.imag();
+      z = q(h[0]+h[3]+h[5], 3); Qr[41] = z.real(); Qi[41] = z.imag();
+      z = q(h[1]+h[3]+h[5], 3); Qr[42] = z.real(); Qi[42] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[5], 4); Qr[43] = z.real(); Qi[43] = z.imag();
+      z = q(h[2]+h[3]+h[5], 3); Qr[44] = z.real(); Qi[44] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[5], 4); Qr[45] = z.real(); Qi[45] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[5], 4); Qr[46] = z.real(); Qi[46] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[5], 5); Qr[47] = z.real(); Qi[47] = z.imag();
+      z = q(h[4]+h[5], 2); Qr[48] = z.real(); Qi[48] = z.imag();
+      z = q(h[0]+h[4]+h[5], 3); Qr[49] = z.real(); Qi[49] = z.imag();
+      z = q(h[1]+h[4]+h[5], 3); Qr[50] = z.real(); Qi[50] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[5], 4); Qr[51] = z.real(); Qi[51] = z.imag();
+      z = q(h[2]+h[4]+h[5], 3); Qr[52] = z.real(); Qi[52] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[5], 4); Qr[53] = z.real(); Qi[53] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[5], 4); Qr[54] = z.real(); Qi[54] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[5], 5); Qr[55] = z.real(); Qi[55] = z.imag();
+      z = q(h[3]+h[4]+h[5], 3); Qr[56] = z.real(); Qi[56] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[5], 4); Qr[57] = z.real(); Qi[57] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[5], 4); Qr[58] = z.real(); Qi[58] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[5], 5); Qr[59] = z.real(); Qi[59] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[5], 4); Qr[60] = z.real(); Qi[60] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[5], 5); Qr[61] = z.real(); Qi[61] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[5], 5); Qr[62] = z.real(); Qi[62] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[5], 6); Qr[63] = z.real(); Qi[63] = z.imag();
+      z = q(h[6], 1); Qr[64] = z.real(); Qi[64] = z.imag();
+      z = q(h[0]+h[6], 2); Qr[65] = z.real(); Qi[65] = z.imag();
+      z = q(h[1]+h[6], 2); Qr[66] = z.real(); Qi[66] = z.imag();
+      z = q(h[0]+h[1]+h[6], 3); Qr[67] = z.real(); Qi[67] = z.imag();
+      z = q(h[2]+h[6], 2); Qr[68] = z.real(); Qi[68] = z.imag();
+      z = q(h[0]+h[2]+h[6], 3); Qr[69] = z.real(); Qi[69] = z.imag();
+      z = q(h[1]+h[2]+h[6], 3); Qr[70] = z.real(); Qi[70] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[6], 4); Qr[71] = z.real(); Qi[71] = z.imag();
+      z = q(h[3]+h[6], 2); Qr[72] = z.real(); Qi[72] = z.imag();
+      z = q(h[0]+h[3]+h[6], 3); Qr[73] = z.real(); Qi[73] = z.imag();
+      z = q(h[1]+h[3]+h[6], 3); Qr[74] = z.real(); Qi[74] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[6], 4); Qr[75] = z.real(); Qi[75] = z.imag();
+      z = q(h[2]+h[3]+h[6], 3); Qr[76] = z.real(); Qi[76] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[6], 4); Qr[77] = z.real(); Qi[77] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[6], 4); Qr[78] = z.real(); Qi[78] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[6], 5); Qr[79] = z.real(); Qi[79] = z.imag();
+      z = q(h[4]+h[6], 2); Qr[80] = z.real(); Qi[80] = z.imag();
+      z = q(h[0]+h[4]+h[6], 3); Qr[81] = z.real(); Qi[81] = z.imag();
+      z = q(h[1]+h[4]+h[6], 3); Qr[82] = z.real(); Qi[82] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[6], 4); Qr[83] = z.real(); Qi[83] = z.imag();
+      z = q(h[2]+h[4]+h[6], 3); Qr[84] = z.real(); Qi[84] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[6], 4); Qr[85] = z.real(); Qi[85] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[6], 4); Qr[86] = z.real(); Qi[86] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[6], 5); Qr[87] = z.real(); Qi[87] = z.imag();
+      z = q(h[3]+h[4]+h[6], 3); Qr[88] = z.real(); Qi[88] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[6], 4); Qr[89] = z.real(); Qi[89] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[6], 4); Qr[90] = z.real(); Qi[90] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[6], 5); Qr[91] = z.real(); Qi[91] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[6], 4); Qr[92] = z.real(); Qi[92] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[6], 5); Qr[93] = z.real(); Qi[93] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[6], 5); Qr[94] = z.real(); Qi[94] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[6], 6); Qr[95] = z.real(); Qi[95] = z.imag();
+      z = q(h[5]+h[6], 2); Qr[96] = z.real(); Qi[96] = z.imag();
+      z = q(h[0]+h[5]+h[6], 3); Qr[97] = z.real(); Qi[97] = z.imag();
+      z = q(h[1]+h[5]+h[6], 3); Qr[98] = z.real(); Qi[98] = z.imag();
+      z = q(h[0]+h[1]+h[5]+h[6], 4); Qr[99] = z.real(); Qi[99] = z.imag();
+      z = q(h[2]+h[5]+h[6], 3); Qr[100] = z.real(); Qi[100] = z.imag();
+      z = q(h[0]+h[2]+h[5]+h[6], 4); Qr[101] = z.real(); Qi[101] = z.imag();
+      z = q(h[1]+h[2]+h[5]+h[6], 4); Qr[102] = z.real(); Qi[102] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[5]+h[6], 5); Qr[103] = z.real(); Qi[103] = z.imag();
+      z = q(h[3]+h[5]+h[6], 3); Qr[104] = z.real(); Qi[104] = z.imag();
+      z = q(h[0]+h[3]+h[5]+h[6], 4); Qr[105] = z.real(); Qi[105] = z.imag();
+      z = q(h[1]+h[3]+h[5]+h[6], 4); Qr[106] = z.real(); Qi[106] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[5]+h[6], 5); Qr[107] = z.real(); Qi[107] = z.imag();
+      z = q(h[2]+h[3]+h[5]+h[6], 4); Qr[108] = z.real(); Qi[108] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[5]+h[6], 5); Qr[109] = z.real(); Qi[109] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[5]+h[6], 5); Qr[110] = z.real(); Qi[110] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[5]+h[6], 6); Qr[111] = z.real(); Qi[111] = z.imag();
+      z = q(h[4]+h[5]+h[6], 3); Qr[112] = z.real(); Qi[112] = z.imag();
+      z = q(h[0]+h[4]+h[5]+h[6], 4); Qr[113] = z.real(); Qi[113] = z.imag();
+      z = q(h[1]+h[4]+h[5]+h[6], 4); Qr[114] = z.real(); Qi[114] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[5]+h[6], 5); Qr[115] = z.real(); Qi[115] = z.imag();
+      z = q(h[2]+h[4]+h[5]+h[6], 4); Qr[116] = z.real(); Qi[116] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[5]+h[6], 5); Qr[117] = z.real(); Qi[117] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[5]+h[6], 5); Qr[118] = z.real(); Qi[118] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[5]+h[6], 6); Qr[119] = z.real(); Qi[119] = z.imag();
+      z = q(h[3]+h[4]+h[5]+h[6], 4); Qr[120] = z.real(); Qi[120] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[5]+h[6], 5); Qr[121] = z.real(); Qi[121] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[5]+h[6], 5); Qr[122] = z.real(); Qi[122] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[5]+h[6], 6); Qr[123] = z.real(); Qi[123] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[5]+h[6], 5); Qr[124] = z.real(); Qi[124] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[5]+h[6], 6); Qr[125] = z.real(); Qi[125] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[5]+h[6], 6); Qr[126] = z.real(); Qi[126] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[5]+h[6], 7); Qr[127] = z.real(); Qi[127] = z.imag();
+      z = q(h[7], 1); Qr[128] = z.real(); Qi[128] = z.imag();
+      z = q(h[0]+h[7], 2); Qr[129] = z.real(); Qi[129] = z.imag();
+      z = q(h[1]+h[7], 2); Qr[130] = z.real(); Qi[130] = z.imag();
+      z = q(h[0]+h[1]+h[7], 3); Qr[131] = z.real(); Qi[131] = z.imag();
+      z = q(h[2]+h[7], 2); Qr[132] = z.real(); Qi[132] = z.imag();
+      z = q(h[0]+h[2]+h[7], 3); Qr[133] = z.real(); Qi[133] = z.imag();
+      z = q(h[1]+h[2]+h[7], 3); Qr[134] = z.real(); Qi[134] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[7], 4); Qr[135] = z.real(); Qi[135] = z.imag();
+      z = q(h[3]+h[7], 2); Qr[136] = z.real(); Qi[136] = z.imag();
+      z = q(h[0]+h[3]+h[7], 3); Qr[137] = z.real(); Qi[137] = z.imag();
+      z = q(h[1]+h[3]+h[7], 3); Qr[138] = z.real(); Qi[138] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[7], 4); Qr[139] = z.real(); Qi[139] = z.imag();
+      z = q(h[2]+h[3]+h[7], 3); Qr[140] = z.real(); Qi[140] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[7], 4); Qr[141] = z.real(); Qi[141] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[7], 4); Qr[142] = z.real(); Qi[142] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[7], 5); Qr[143] = z.real(); Qi[143] = z.imag();
+      z = q(h[4]+h[7], 2); Qr[144] = z.real(); Qi[144] = z.imag();
+      z = q(h[0]+h[4]+h[7], 3); Qr[145] = z.real(); Qi[145] = z.imag();
+      z = q(h[1]+h[4]+h[7], 3); Qr[146] = z.real(); Qi[146] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[7], 4); Qr[147] = z.real(); Qi[147] = z.imag();
+      z = q(h[2]+h[4]+h[7], 3); Qr[148] = z.real(); Qi[148] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[7], 4); Qr[149] = z.real(); Qi[149] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[7], 4); Qr[150] = z.real(); Qi[150] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[7], 5); Qr[151] = z.real(); Qi[151] = z.imag();
+      z = q(h[3]+h[4]+h[7], 3); Qr[152] = z.real(); Qi[152] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[7], 4); Qr[153] = z.real(); Qi[153] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[7], 4); Qr[154] = z.real(); Qi[154] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[7], 5); Qr[155] = z.real(); Qi[155] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[7], 4); Qr[156] = z.real(); Qi[156] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[7], 5); Qr[157] = z.real(); Qi[157] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[7], 5); Qr[158] = z.real(); Qi[158] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[7], 6); Qr[159] = z.real(); Qi[159] = z.imag();
+      z = q(h[5]+h[7], 2); Qr[160] = z.real(); Qi[160] = z.imag();
+      z = q(h[0]+h[5]+h[7], 3); Qr[161] = z.real(); Qi[161] = z.imag();
+      z = q(h[1]+h[5]+h[7], 3); Qr[162] = z.real(); Qi[162] = z.imag();
+      z = q(h[0]+h[1]+h[5]+h[7], 4); Qr[163] = z.real(); Qi[163] = z.imag();
+      z = q(h[2]+h[5]+h[7], 3); Qr[164] = z.real(); Qi[164] = z.imag();
+      z = q(h[0]+h[2]+h[5]+h[7], 4); Qr[165] = z.real(); Qi[165] = z.imag();
+      z = q(h[1]+h[2]+h[5]+h[7], 4); Qr[166] = z.real(); Qi[166] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[5]+h[7], 5); Qr[167] = z.real(); Qi[167] = z.imag();
+      z = q(h[3]+h[5]+h[7], 3); Qr[168] = z.real(); Qi[168] = z.imag();
+      z = q(h[0]+h[3]+h[5]+h[7], 4); Qr[169] = z.real(); Qi[169] = z.imag();
+      z = q(h[1]+h[3]+h[5]+h[7], 4); Qr[170] = z.real(); Qi[170] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[5]+h[7], 5); Qr[171] = z.real(); Qi[171] = z.imag();
+      z = q(h[2]+h[3]+h[5]+h[7], 4); Qr[172] = z.real(); Qi[172] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[5]+h[7], 5); Qr[173] = z.real(); Qi[173] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[5]+h[7], 5); Qr[174] = z.real(); Qi[174] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[5]+h[7], 6); Qr[175] = z.real(); Qi[175] = z.imag();
+      z = q(h[4]+h[5]+h[7], 3); Qr[176] = z.real(); Qi[176] = z.imag();
+      z = q(h[0]+h[4]+h[5]+h[7], 4); Qr[177] = z.real(); Qi[177] = z.imag();
+      z = q(h[1]+h[4]+h[5]+h[7], 4); Qr[178] = z.real(); Qi[178] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[5]+h[7], 5); Qr[179] = z.real(); Qi[179] = z.imag();
+      z = q(h[2]+h[4]+h[5]+h[7], 4); Qr[180] = z.real(); Qi[180] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[5]+h[7], 5); Qr[181] = z.real(); Qi[181] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[5]+h[7], 5); Qr[182] = z.real(); Qi[182] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[5]+h[7], 6); Qr[183] = z.real(); Qi[183] = z.imag();
+      z = q(h[3]+h[4]+h[5]+h[7], 4); Qr[184] = z.real(); Qi[184] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[5]+h[7], 5); Qr[185] = z.real(); Qi[185] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[5]+h[7], 5); Qr[186] = z.real(); Qi[186] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[5]+h[7], 6); Qr[187] = z.real(); Qi[187] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[5]+h[7], 5); Qr[188] = z.real(); Qi[188] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[5]+h[7], 6); Qr[189] = z.real(); Qi[189] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[5]+h[7], 6); Qr[190] = z.real(); Qi[190] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[5]+h[7], 7); Qr[191] = z.real(); Qi[191] = z.imag();
+      z = q(h[6]+h[7], 2); Qr[192] = z.real(); Qi[192] = z.imag();
+      z = q(h[0]+h[6]+h[7], 3); Qr[193] = z.real(); Qi[193] = z.imag();
+      z = q(h[1]+h[6]+h[7], 3); Qr[194] = z.real(); Qi[194] = z.imag();
+      z = q(h[0]+h[1]+h[6]+h[7], 4); Qr[195] = z.real(); Qi[195] = z.imag();
+      z = q(h[2]+h[6]+h[7], 3); Qr[196] = z.real(); Qi[196] = z.imag();
+      z = q(h[0]+h[2]+h[6]+h[7], 4); Qr[197] = z.real(); Qi[197] = z.imag();
+      z = q(h[1]+h[2]+h[6]+h[7], 4); Qr[198] = z.real(); Qi[198] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[6]+h[7], 5); Qr[199] = z.real(); Qi[199] = z.imag();
+      z = q(h[3]+h[6]+h[7], 3); Qr[200] = z.real(); Qi[200] = z.imag();
+      z = q(h[0]+h[3]+h[6]+h[7], 4); Qr[201] = z.real(); Qi[201] = z.imag();
+      z = q(h[1]+h[3]+h[6]+h[7], 4); Qr[202] = z.real(); Qi[202] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[6]+h[7], 5); Qr[203] = z.real(); Qi[203] = z.imag();
+      z = q(h[2]+h[3]+h[6]+h[7], 4); Qr[204] = z.real(); Qi[204] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[6]+h[7], 5); Qr[205] = z.real(); Qi[205] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[6]+h[7], 5); Qr[206] = z.real(); Qi[206] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[6]+h[7], 6); Qr[207] = z.real(); Qi[207] = z.imag();
+      z = q(h[4]+h[6]+h[7], 3); Qr[208] = z.real(); Qi[208] = z.imag();
+      z = q(h[0]+h[4]+h[6]+h[7], 4); Qr[209] = z.real(); Qi[209] = z.imag();
+      z = q(h[1]+h[4]+h[6]+h[7], 4); Qr[210] = z.real(); Qi[210] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[6]+h[7], 5); Qr[211] = z.real(); Qi[211] = z.imag();
+      z = q(h[2]+h[4]+h[6]+h[7], 4); Qr[212] = z.real(); Qi[212] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[6]+h[7], 5); Qr[213] = z.real(); Qi[213] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[6]+h[7], 5); Qr[214] = z.real(); Qi[214] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[6]+h[7], 6); Qr[215] = z.real(); Qi[215] = z.imag();
+      z = q(h[3]+h[4]+h[6]+h[7], 4); Qr[216] = z.real(); Qi[216] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[6]+h[7], 5); Qr[217] = z.real(); Qi[217] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[6]+h[7], 5); Qr[218] = z.real(); Qi[218] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[6]+h[7], 6); Qr[219] = z.real(); Qi[219] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[6]+h[7], 5); Qr[220] = z.real(); Qi[220] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[6]+h[7], 6); Qr[221] = z.real(); Qi[221] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[6]+h[7], 6); Qr[222] = z.real(); Qi[222] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[6]+h[7], 7); Qr[223] = z.real(); Qi[223] = z.imag();
+      z = q(h[5]+h[6]+h[7], 3); Qr[224] = z.real(); Qi[224] = z.imag();
+      z = q(h[0]+h[5]+h[6]+h[7], 4); Qr[225] = z.real(); Qi[225] = z.imag();
+      z = q(h[1]+h[5]+h[6]+h[7], 4); Qr[226] = z.real(); Qi[226] = z.imag();
+      z = q(h[0]+h[1]+h[5]+h[6]+h[7], 5); Qr[227] = z.real(); Qi[227] = z.imag();
+      z = q(h[2]+h[5]+h[6]+h[7], 4); Qr[228] = z.real(); Qi[228] = z.imag();
+      z = q(h[0]+h[2]+h[5]+h[6]+h[7], 5); Qr[229] = z.real(); Qi[229] = z.imag();
+      z = q(h[1]+h[2]+h[5]+h[6]+h[7], 5); Qr[230] = z.real(); Qi[230] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[5]+h[6]+h[7], 6); Qr[231] = z.real(); Qi[231] = z.imag();
+      z = q(h[3]+h[5]+h[6]+h[7], 4); Qr[232] = z.real(); Qi[232] = z.imag();
+      z = q(h[0]+h[3]+h[5]+h[6]+h[7], 5); Qr[233] = z.real(); Qi[233] = z.imag();
+      z = q(h[1]+h[3]+h[5]+h[6]+h[7], 5); Qr[234] = z.real(); Qi[234] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[5]+h[6]+h[7], 6); Qr[235] = z.real(); Qi[235] = z.imag();
+      z = q(h[2]+h[3]+h[5]+h[6]+h[7], 5); Qr[236] = z.real(); Qi[236] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[5]+h[6]+h[7], 6); Qr[237] = z.real(); Qi[237] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[5]+h[6]+h[7], 6); Qr[238] = z.real(); Qi[238] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[5]+h[6]+h[7], 7); Qr[239] = z.real(); Qi[239] = z.imag();
+      z = q(h[4]+h[5]+h[6]+h[7], 4); Qr[240] = z.real(); Qi[240] = z.imag();
+      z = q(h[0]+h[4]+h[5]+h[6]+h[7], 5); Qr[241] = z.real(); Qi[241] = z.imag();
+      z = q(h[1]+h[4]+h[5]+h[6]+h[7], 5); Qr[242] = z.real(); Qi[242] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[5]+h[6]+h[7], 6); Qr[243] = z.real(); Qi[243] = z.imag();
+      z = q(h[2]+h[4]+h[5]+h[6]+h[7], 5); Qr[244] = z.real(); Qi[244] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[5]+h[6]+h[7], 6); Qr[245] = z.real(); Qi[245] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[5]+h[6]+h[7], 6); Qr[246] = z.real(); Qi[246] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[5]+h[6]+h[7], 7); Qr[247] = z.real(); Qi[247] = z.imag();
+      z = q(h[3]+h[4]+h[5]+h[6]+h[7], 5); Qr[248] = z.real(); Qi[248] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[5]+h[6]+h[7], 6); Qr[249] = z.real(); Qi[249] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[5]+h[6]+h[7], 6); Qr[250] = z.real(); Qi[250] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[5]+h[6]+h[7], 7); Qr[251] = z.real(); Qi[251] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[5]+h[6]+h[7], 6); Qr[252] = z.real(); Qi[252] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[5]+h[6]+h[7], 7); Qr[253] = z.real(); Qi[253] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[5]+h[6]+h[7], 7); Qr[254] = z.real(); Qi[254] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[5]+h[6]+h[7], 8); Qr[255] = z.real(); Qi[255] = z.imag();
+      expand8Part0(Qr, Qi, Cr, Ci);
+      expand8Part1(Qr, Qi, Cr, Ci);
+      expand8Part2(Qr, Qi, Cr, Ci);
+      expand8Part3(Qr, Qi, Cr, Ci);
+      expand8Part4(Qr, Qi, Cr, Ci);
+      expand8Part5(Qr, Qi, Cr, Ci);
+      expand8Part6(Qr, Qi, Cr, Ci);
+      expand8Part7(Qr, Qi, Cr, Ci);
+      expand8Part8(Qr, Qi, Cr, Ci);
+      return Complex(Cr[255], Ci[255]);
+    }
+  }
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
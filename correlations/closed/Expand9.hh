@@ -0,0 +1,11643 @@
+// Generated by print -t closed -- do not edit
+#ifndef CORRELATIONS_CLOSED_EXPAND9_HH
+#define CORRELATIONS_CLOSED_EXPAND9_HH
+/**
+ * @file   correlations/closed/Expand9.hh
+ *
+ * @brief  Closed-form expression of the 9 particle correlator
+ *
+ * Generated by @c print @c -t @c closed.  Include this through
+ * correlations/Kernels.hh.
+ */
+#include <correlations/QVector.hh>
+
+namespace correlations {
+  namespace closed {
+    /** Part 0 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part0(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[2] =
+	Qr[2];
+      Ci[2] =
+	Qi[2];
+
+      Cr[4] =
+	Qr[4];
+      Ci[4] =
+	Qi[4];
+
+      Cr[6] =
+	Qr[6];
+      Ci[6] =
+	Qi[6];
+      Cr[6] =
+	Qr[2] * Cr[4] - Qi[2] * Ci[4]
+	- Cr[6];
+      Ci[6] =
+	Qr[2] * Ci[4] + Qi[2] * Cr[4]
+	- Ci[6];
+
+      Cr[8] =
+	Qr[8];
+      Ci[8] =
+	Qi[8];
+
+      Cr[10] =
+	Qr[10];
+      Ci[10] =
+	Qi[10];
+      Cr[10] =
+	Qr[2] * Cr[8] - Qi[2] * Ci[8]
+	- Cr[10];
+      Ci[10] =
+	Qr[2] * Ci[8] + Qi[2] * Cr[8]
+	- Ci[10];
+
+      Cr[12] =
+	Qr[12];
+      Ci[12] =
+	Qi[12];
+      Cr[12] =
+	Qr[4] * Cr[8] - Qi[4] * Ci[8]
+	- Cr[12];
+      Ci[12] =
+	Qr[4] * Ci[8] + Qi[4] * Cr[8]
+	- Ci[12];
+
+      Cr[14] =
+	Qr[14];
+      Ci[14] =
+	Qi[14];
+      Cr[14] =
+	Qr[10] * Cr[4] - Qi[10] * Ci[4]
+	+ Qr[6] * Cr[8] - Qi[6] * Ci[8]
+	- 2. * Cr[14];
+      Ci[14] =
+	Qr[10] * Ci[4] + Qi[10] * Cr[4]
+	+ Qr[6] * Ci[8] + Qi[6] * Cr[8]
+	- 2. * Ci[14];
+      Cr[14] =
+	Qr[2] * Cr[12] - Qi[2] * Ci[12]
+	- Cr[14];
+      Ci[14] =
+	Qr[2] * Ci[12] + Qi[2] * Cr[12]
+	- Ci[14];
+
+      Cr[16] =
+	Qr[16];
+      Ci[16] =
+	Qi[16];
+
+      Cr[18] =
+	Qr[18];
+      Ci[18] =
+	Qi[18];
+      Cr[18] =
+	Qr[2] * Cr[16] - Qi[2] * Ci[16]
+	- Cr[18];
+      Ci[18] =
+	Qr[2] * Ci[16] + Qi[2] * Cr[16]
+	- Ci[18];
+
+      Cr[20] =
+	Qr[20];
+      Ci[20] =
+	Qi[20];
+      Cr[20] =
+	Qr[4] * Cr[16] - Qi[4] * Ci[16]
+	- Cr[20];
+      Ci[20] =
+	Qr[4] * Ci[16] + Qi[4] * Cr[16]
+	- Ci[20];
+
+      Cr[22] =
+	Qr[22];
+      Ci[22] =
+	Qi[22];
+      Cr[22] =
+	Qr[18] * Cr[4] - Qi[18] * Ci[4]
+	+ Qr[6] * Cr[16] - Qi[6] * Ci[16]
+	- 2. * Cr[22];
+      Ci[22] =
+	Qr[18] * Ci[4] + Qi[18] * Cr[4]
+	+ Qr[6] * Ci[16] + Qi[6] * Cr[16]
+	- 2. * Ci[22];
+      Cr[22] =
+	Qr[2] * Cr[20] - Qi[2] * Ci[20]
+	- Cr[22];
+      Ci[22] =
+	Qr[2] * Ci[20] + Qi[2] * Cr[20]
+	- Ci[22];
+
+      Cr[24] =
+	Qr[24];
+      Ci[24] =
+	Qi[24];
+      Cr[24] =
+	Qr[8] * Cr[16] - Qi[8] * Ci[16]
+	- Cr[24];
+      Ci[24] =
+	Qr[8] * Ci[16] + Qi[8] * Cr[16]
+	- Ci[24];
+
+      Cr[26] =
+	Qr[26];
+      Ci[26] =
+	Qi[26];
+      Cr[26] =
+	Qr[18] * Cr[8] - Qi[18] * Ci[8]
+	+ Qr[10] * Cr[16] - Qi[10] * Ci[16]
+	- 2. * Cr[26];
+      Ci[26] =
+	Qr[18] * Ci[8] + Qi[18] * Cr[8]
+	+ Qr[10] * Ci[16] + Qi[10] * Cr[16]
+	- 2. * Ci[26];
+      Cr[26] =
+	Qr[2] * Cr[24] - Qi[2] * Ci[24]
+	- Cr[26];
+      Ci[26] =
+	Qr[2] * Ci[24] + Qi[2] * Cr[24]
+	- Ci[26];
+
+      Cr[28] =
+	Qr[28];
+      Ci[28] =
+	Qi[28];
+      Cr[28] =
+	Qr[20] * Cr[8] - Qi[20] * Ci[8]
+	+ Qr[12] * Cr[16] - Qi[12] * Ci[16]
+	- 2. * Cr[28];
+      Ci[28] =
+	Qr[20] * Ci[8] + Qi[20] * Cr[8]
+	+ Qr[12] * Ci[16] + Qi[12] * Cr[16]
+	- 2. * Ci[28];
+      Cr[28] =
+	Qr[4] * Cr[24] - Qi[4] * Ci[24]
+	- Cr[28];
+      Ci[28] =
+	Qr[4] * Ci[24] + Qi[4] * Cr[24]
+	- Ci[28];
+
+      Cr[30] =
+	Qr[30];
+      Ci[30] =
+	Qi[30];
+      Cr[30] =
+	Qr[26] * Cr[4] - Qi[26] * Ci[4]
+	+ Qr[22] * Cr[8] - Qi[22] * Ci[8]
+	+ Qr[14] * Cr[16] - Qi[14] * Ci[16]
+	- 3. * Cr[30];
+      Ci[30] =
+	Qr[26] * Ci[4] + Qi[26] * Cr[4]
+	+ Qr[22] * Ci[8] + Qi[22] * Cr[8]
+	+ Qr[14] * Ci[16] + Qi[14] * Cr[16]
+	- 3. * Ci[30];
+      Cr[30] =
+	Qr[18] * Cr[12] - Qi[18] * Ci[12]
+	+ Qr[10] * Cr[20] - Qi[10] * Ci[20]
+	+ Qr[6] * Cr[24] - Qi[6] * Ci[24]
+	- 2. * Cr[30];
+      Ci[30] =
+	Qr[18] * Ci[12] + Qi[18] * Cr[12]
+	+ Qr[10] * Ci[20] + Qi[10] * Cr[20]
+	+ Qr[6] * Ci[24] + Qi[6] * Cr[24]
+	- 2. * Ci[30];
+      Cr[30] =
+	Qr[2] * Cr[28] - Qi[2] * Ci[28]
+	- Cr[30];
+      Ci[30] =
+	Qr[2] * Ci[28] + Qi[2] * Cr[28]
+	- Ci[30];
+
+      Cr[32] =
+	Qr[32];
+      Ci[32] =
+	Qi[32];
+
+      Cr[34] =
+	Qr[34];
+      Ci[34] =
+	Qi[34];
+      Cr[34] =
+	Qr[2] * Cr[32] - Qi[2] * Ci[32]
+	- Cr[34];
+      Ci[34] =
+	Qr[2] * Ci[32] + Qi[2] * Cr[32]
+	- Ci[34];
+
+      Cr[36] =
+	Qr[36];
+      Ci[36] =
+	Qi[36];
+      Cr[36] =
+	Qr[4] * Cr[32] - Qi[4] * Ci[32]
+	- Cr[36];
+      Ci[36] =
+	Qr[4] * Ci[32] + Qi[4] * Cr[32]
+	- Ci[36];
+
+      Cr[38] =
+	Qr[38];
+      Ci[38] =
+	Qi[38];
+      Cr[38] =
+	Qr[34] * Cr[4] - Qi[34] * Ci[4]
+	+ Qr[6] * Cr[32] - Qi[6] * Ci[32]
+	- 2. * Cr[38];
+      Ci[38] =
+	Qr[34] * Ci[4] + Qi[34] * Cr[4]
+	+ Qr[6] * Ci[32] + Qi[6] * Cr[32]
+	- 2. * Ci[38];
+      Cr[38] =
+	Qr[2] * Cr[36] - Qi[2] * Ci[36]
+	- Cr[38];
+      Ci[38] =
+	Qr[2] * Ci[36] + Qi[2] * Cr[36]
+	- Ci[38];
+
+      Cr[40] =
+	Qr[40];
+      Ci[40] =
+	Qi[40];
+      Cr[40] =
+	Qr[8] * Cr[32] - Qi[8] * Ci[32]
+	- Cr[40];
+      Ci[40] =
+	Qr[8] * Ci[32] + Qi[8] * Cr[32]
+	- Ci[40];
+
+      Cr[42] =
+	Qr[42];
+      Ci[42] =
+	Qi[42];
+      Cr[42] =
+	Qr[34] * Cr[8] - Qi[34] * Ci[8]
+	+ Qr[10] * Cr[32] - Qi[10] * Ci[32]
+	- 2. * Cr[42];
+      Ci[42] =
+	Qr[34] * Ci[8] + Qi[34] * Cr[8]
+	+ Qr[10] * Ci[32] + Qi[10] * Cr[32]
+	- 2. * Ci[42];
+      Cr[42] =
+	Qr[2] * Cr[40] - Qi[2] * Ci[40]
+	- Cr[42];
+      Ci[42] =
+	Qr[2] * Ci[40] + Qi[2] * Cr[40]
+	- Ci[42];
+
+      Cr[44] =
+	Qr[44];
+      Ci[44] =
+	Qi[44];
+      Cr[44] =
+	Qr[36] * Cr[8] - Qi[36] * Ci[8]
+	+ Qr[12] * Cr[32] - Qi[12] * Ci[32]
+	- 2. * Cr[44];
+      Ci[44] =
+	Qr[36] * Ci[8] + Qi[36] * Cr[8]
+	+ Qr[12] * Ci[32] + Qi[12] * Cr[32]
+	- 2. * Ci[44];
+      Cr[44] =
+	Qr[4] * Cr[40] - Qi[4] * Ci[40]
+	- Cr[44];
+      Ci[44] =
+	Qr[4] * Ci[40] + Qi[4] * Cr[40]
+	- Ci[44];
+
+      Cr[46] =
+	Qr[46];
+      Ci[46] =
+	Qi[46];
+      Cr[46] =
+	Qr[42] * Cr[4] - Qi[42] * Ci[4]
+	+ Qr[38] * Cr[8] - Qi[38] * Ci[8]
+	+ Qr[14] * Cr[32] - Qi[14] * Ci[32]
+	- 3. * Cr[46];
+      Ci[46] =
+	Qr[42] * Ci[4] + Qi[42] * Cr[4]
+	+ Qr[38] * Ci[8] + Qi[38] * Cr[8]
+	+ Qr[14] * Ci[32] + Qi[14] * Cr[32]
+	- 3. * Ci[46];
+      Cr[46] =
+	Qr[34] * Cr[12] - Qi[34] * Ci[12]
+	+ Qr[10] * Cr[36] - Qi[10] * Ci[36]
+	+ Qr[6] * Cr[40] - Qi[6] * Ci[40]
+	- 2. * Cr[46];
+      Ci[46] =
+	Qr[34] * Ci[12] + Qi[34] * Cr[12]
+	+ Qr[10] * Ci[36] + Qi[10] * Cr[36]
+	+ Qr[6] * Ci[40] + Qi[6] * Cr[40]
+	- 2. * Ci[46];
+      Cr[46] =
+	Qr[2] * Cr[44] - Qi[2] * Ci[44]
+	- Cr[46];
+      Ci[46] =
+	Qr[2] * Ci[44] + Qi[2] * Cr[44]
+	- Ci[46];
+
+      Cr[48] =
+	Qr[48];
+      Ci[48] =
+	Qi[48];
+      Cr[48] =
+	Qr[16] * Cr[32] - Qi[16] * Ci[32]
+	- Cr[48];
+      Ci[48] =
+	Qr[16] * Ci[32] + Qi[16] * Cr[32]
+	- Ci[48];
+
+      Cr[50] =
+	Qr[50];
+      Ci[50] =
+	Qi[50];
+      Cr[50] =
+	Qr[34] * Cr[16] - Qi[34] * Ci[16]
+	+ Qr[18] * Cr[32] - Qi[18] * Ci[32]
+	- 2. * Cr[50];
+      Ci[50] =
+	Qr[34] * Ci[16] + Qi[34] * Cr[16]
+	+ Qr[18] * Ci[32] + Qi[18] * Cr[32]
+	- 2. * Ci[50];
+      Cr[50] =
+	Qr[2] * Cr[48] - Qi[2] * Ci[48]
+	- Cr[50];
+      Ci[50] =
+	Qr[2] * Ci[48] + Qi[2] * Cr[48]
+	- Ci[50];
+
+      Cr[52] =
+	Qr[52];
+      Ci[52] =
+	Qi[52];
+      Cr[52] =
+	Qr[36] * Cr[16] - Qi[36] * Ci[16]
+	+ Qr[20] * Cr[32] - Qi[20] * Ci[32]
+	- 2. * Cr[52];
+      Ci[52] =
+	Qr[36] * Ci[16] + Qi[36] * Cr[16]
+	+ Qr[20] * Ci[32] + Qi[20] * Cr[32]
+	- 2. * Ci[52];
+      Cr[52] =
+	Qr[4] * Cr[48] - Qi[4] * Ci[48]
+	- Cr[52];
+      Ci[52] =
+	Qr[4] * Ci[48] + Qi[4] * Cr[48]
+	- Ci[52];
+
+      Cr[54] =
+	Qr[54];
+      Ci[54] =
+	Qi[54];
+      Cr[54] =
+	Qr[50] * Cr[4] - Qi[50] * Ci[4]
+	+ Qr[38] * Cr[16] - Qi[38] * Ci[16]
+	+ Qr[22] * Cr[32] - Qi[22] * Ci[32]
+	- 3. * Cr[54];
+      Ci[54] =
+	Qr[50] * Ci[4] + Qi[50] * Cr[4]
+	+ Qr[38] * Ci[16] + Qi[38] * Cr[16]
+	+ Qr[22] * Ci[32] + Qi[22] * Cr[32]
+	- 3. * Ci[54];
+      Cr[54] =
+	Qr[34] * Cr[20] - Qi[34] * Ci[20]
+	+ Qr[18] * Cr[36] - Qi[18] * Ci[36]
+	+ Qr[6] * Cr[48] - Qi[6] * Ci[48]
+	- 2. * Cr[54];
+      Ci[54] =
+	Qr[34] * Ci[20] + Qi[34] * Cr[20]
+	+ Qr[18] * Ci[36] + Qi[18] * Cr[36]
+	+ Qr[6] * Ci[48] + Qi[6] * Cr[48]
+	- 2. * Ci[54];
+      Cr[54] =
+	Qr[2] * Cr[52] - Qi[2] * Ci[52]
+	- Cr[54];
+      Ci[54] =
+	Qr[2] * Ci[52] + Qi[2] * Cr[52]
+	- Ci[54];
+
+      Cr[56] =
+	Qr[56];
+      Ci[56] =
+	Qi[56];
+      Cr[56] =
+	Qr[40] * Cr[16] - Qi[40] * Ci[16]
+	+ Qr[24] * Cr[32] - Qi[24] * Ci[32]
+	- 2. * Cr[56];
+      Ci[56] =
+	Qr[40] * Ci[16] + Qi[40] * Cr[16]
+	+ Qr[24] * Ci[32] + Qi[24] * Cr[32]
+	- 2. * Ci[56];
+      Cr[56] =
+	Qr[8] * Cr[48] - Qi[8] * Ci[48]
+	- Cr[56];
+      Ci[56] =
+	Qr[8] * Ci[48] + Qi[8] * Cr[48]
+	- Ci[56];
+
+      Cr[58] =
+	Qr[58];
+      Ci[58] =
+	Qi[58];
+      Cr[58] =
+	Qr[50] * Cr[8] - Qi[50] * Ci[8]
+	+ Qr[42] * Cr[16] - Qi[42] * Ci[16]
+	+ Qr[26] * Cr[32] - Qi[26] * Ci[32]
+	- 3. * Cr[58];
+      Ci[58] =
+	Qr[50] * Ci[8] + Qi[50] * Cr[8]
+	+ Qr[42] * Ci[16] + Qi[42] * Cr[16]
+	+ Qr[26] * Ci[32] + Qi[26] * Cr[32]
+	- 3. * Ci[58];
+      Cr[58] =
+	Qr[34] * Cr[24] - Qi[34] * Ci[24]
+	+ Qr[18] * Cr[40] - Qi[18] * Ci[40]
+	+ Qr[10] * Cr[48] - Qi[10] * Ci[48]
+	- 2. * Cr[58];
+      Ci[58] =
+	Qr[34] * Ci[24] + Qi[34] * Cr[24]
+	+ Qr[18] * Ci[40] + Qi[18] * Cr[40]
+	+ Qr[10] * Ci[48] + Qi[10] * Cr[48]
+	- 2. * Ci[58];
+      Cr[58] =
+	Qr[2] * Cr[56] - Qi[2] * Ci[56]
+	- Cr[58];
+      Ci[58] =
+	Qr[2] * Ci[56] + Qi[2] * Cr[56]
+	- Ci[58];
+
+      Cr[60] =
+	Qr[60];
+      Ci[60] =
+	Qi[60];
+      Cr[60] =
+	Qr[52] * Cr[8] - Qi[52] * Ci[8]
+	+ Qr[44] * Cr[16] - Qi[44] * Ci[16]
+	+ Qr[28] * Cr[32] - Qi[28] * Ci[32]
+	- 3. * Cr[60];
+      Ci[60] =
+	Qr[52] * Ci[8] + Qi[52] * Cr[8]
+	+ Qr[44] * Ci[16] + Qi[44] * Cr[16]
+	+ Qr[28] * Ci[32] + Qi[28] * Cr[32]
+	- 3. * Ci[60];
+      Cr[60] =
+	Qr[36] * Cr[24] - Qi[36] * Ci[24]
+	+ Qr[20] * Cr[40] - Qi[20] * Ci[40]
+	+ Qr[12] * Cr[48] - Qi[12] * Ci[48]
+	- 2. * Cr[60];
+      Ci[60] =
+	Qr[36] * Ci[24] + Qi[36] * Cr[24]
+	+ Qr[20] * Ci[40] + Qi[20] * Cr[40]
+	+ Qr[12] * Ci[48] + Qi[12] * Cr[48]
+	- 2. * Ci[60];
+      Cr[60] =
+	Qr[4] * Cr[56] - Qi[4] * Ci[56]
+	- Cr[60];
+      Ci[60] =
+	Qr[4] * Ci[56] + Qi[4] * Cr[56]
+	- Ci[60];
+
+      Cr[62] =
+	Qr[62];
+      Ci[62] =
+	Qi[62];
+      Cr[62] =
+	Qr[58] * Cr[4] - Qi[58] * Ci[4]
+	+ Qr[54] * Cr[8] - Qi[54] * Ci[8]
+	+ Qr[46] * Cr[16] - Qi[46] * Ci[16]
+	+ Qr[30] * Cr[32] - Qi[30] * Ci[32]
+	- 4. * Cr[62];
+      Ci[62] =
+	Qr[58] * Ci[4] + Qi[58] * Cr[4]
+	+ Qr[54] * Ci[8] + Qi[54] * Cr[8]
+	+ Qr[46] * Ci[16] + Qi[46] * Cr[16]
+	+ Qr[30] * Ci[32] + Qi[30] * Cr[32]
+	- 4. * Ci[62];
+      Cr[62] =
+	Qr[50] * Cr[12] - Qi[50] * Ci[12]
+	+ Qr[42] * Cr[20] - Qi[42] * Ci[20]
+	+ Qr[38] * Cr[24] - Qi[38] * Ci[24]
+	+ Qr[26] * Cr[36] - Qi[26] * Ci[36]
+	+ Qr[22] * Cr[40] - Qi[22] * Ci[40]
+	+ Qr[14] * Cr[48] - Qi[14] * Ci[48]
+	- 3. * Cr[62];
+      Ci[62] =
+	Qr[50] * Ci[12] + Qi[50] * Cr[12]
+	+ Qr[42] * Ci[20] + Qi[42] * Cr[20]
+	+ Qr[38] * Ci[24] + Qi[38] * Cr[24]
+	+ Qr[26] * Ci[36] + Qi[26] * Cr[36]
+	+ Qr[22] * Ci[40] + Qi[22] * Cr[40]
+	+ Qr[14] * Ci[48] + Qi[14] * Cr[48]
+	- 3. * Ci[62];
+      Cr[62] =
+	Qr[34] * Cr[28] - Qi[34] * Ci[28]
+	+ Qr[18] * Cr[44] - Qi[18] * Ci[44]
+	+ Qr[10] * Cr[52] - Qi[10] * Ci[52]
+	+ Qr[6] * Cr[56] - Qi[6] * Ci[56]
+	- 2. * Cr[62];
+      Ci[62] =
+	Qr[34] * Ci[28] + Qi[34] * Cr[28]
+	+ Qr[18] * Ci[44] + Qi[18] * Cr[44]
+	+ Qr[10] * Ci[52] + Qi[10] * Cr[52]
+	+ Qr[6] * Ci[56] + Qi[6] * Cr[56]
+	- 2. * Ci[62];
+      Cr[62] =
+	Qr[2] * Cr[60] - Qi[2] * Ci[60]
+	- Cr[62];
+      Ci[62] =
+	Qr[2] * Ci[60] + Qi[2] * Cr[60]
+	- Ci[62];
+
+      Cr[64] =
+	Qr[64];
+      Ci[64] =
+	Qi[64];
+
+      Cr[66] =
+	Qr[66];
+      Ci[66] =
+	Qi[66];
+      Cr[66] =
+	Qr[2] * Cr[64] - Qi[2] * Ci[64]
+	- Cr[66];
+      Ci[66] =
+	Qr[2] * Ci[64] + Qi[2] * Cr[64]
+	- Ci[66];
+
+      Cr[68] =
+	Qr[68];
+      Ci[68] =
+	Qi[68];
+      Cr[68] =
+	Qr[4] * Cr[64] - Qi[4] * Ci[64]
+	- Cr[68];
+      Ci[68] =
+	Qr[4] * Ci[64] + Qi[4] * Cr[64]
+	- Ci[68];
+
+      Cr[70] =
+	Qr[70];
+      Ci[70] =
+	Qi[70];
+      Cr[70] =
+	Qr[66] * Cr[4] - Qi[66] * Ci[4]
+	+ Qr[6] * Cr[64] - Qi[6] * Ci[64]
+	- 2. * Cr[70];
+      Ci[70] =
+	Qr[66] * Ci[4] + Qi[66] * Cr[4]
+	+ Qr[6] * Ci[64] + Qi[6] * Cr[64]
+	- 2. * Ci[70];
+      Cr[70] =
+	Qr[2] * Cr[68] - Qi[2] * Ci[68]
+	- Cr[70];
+      Ci[70] =
+	Qr[2] * Ci[68] + Qi[2] * Cr[68]
+	- Ci[70];
+    }
+
+    /** Part 1 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part1(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[72] =
+	Qr[72];
+      Ci[72] =
+	Qi[72];
+      Cr[72] =
+	Qr[8] * Cr[64] - Qi[8] * Ci[64]
+	- Cr[72];
+      Ci[72] =
+	Qr[8] * Ci[64] + Qi[8] * Cr[64]
+	- Ci[72];
+
+      Cr[74] =
+	Qr[74];
+      Ci[74] =
+	Qi[74];
+      Cr[74] =
+	Qr[66] * Cr[8] - Qi[66] * Ci[8]
+	+ Qr[10] * Cr[64] - Qi[10] * Ci[64]
+	- 2. * Cr[74];
+      Ci[74] =
+	Qr[66] * Ci[8] + Qi[66] * Cr[8]
+	+ Qr[10] * Ci[64] + Qi[10] * Cr[64]
+	- 2. * Ci[74];
+      Cr[74] =
+	Qr[2] * Cr[72] - Qi[2] * Ci[72]
+	- Cr[74];
+      Ci[74] =
+	Qr[2] * Ci[72] + Qi[2] * Cr[72]
+	- Ci[74];
+
+      Cr[76] =
+	Qr[76];
+      Ci[76] =
+	Qi[76];
+      Cr[76] =
+	Qr[68] * Cr[8] - Qi[68] * Ci[8]
+	+ Qr[12] * Cr[64] - Qi[12] * Ci[64]
+	- 2. * Cr[76];
+      Ci[76] =
+	Qr[68] * Ci[8] + Qi[68] * Cr[8]
+	+ Qr[12] * Ci[64] + Qi[12] * Cr[64]
+	- 2. * Ci[76];
+      Cr[76] =
+	Qr[4] * Cr[72] - Qi[4] * Ci[72]
+	- Cr[76];
+      Ci[76] =
+	Qr[4] * Ci[72] + Qi[4] * Cr[72]
+	- Ci[76];
+
+      Cr[78] =
+	Qr[78];
+      Ci[78] =
+	Qi[78];
+      Cr[78] =
+	Qr[74] * Cr[4] - Qi[74] * Ci[4]
+	+ Qr[70] * Cr[8] - Qi[70] * Ci[8]
+	+ Qr[14] * Cr[64] - Qi[14] * Ci[64]
+	- 3. * Cr[78];
+      Ci[78] =
+	Qr[74] * Ci[4] + Qi[74] * Cr[4]
+	+ Qr[70] * Ci[8] + Qi[70] * Cr[8]
+	+ Qr[14] * Ci[64] + Qi[14] * Cr[64]
+	- 3. * Ci[78];
+      Cr[78] =
+	Qr[66] * Cr[12] - Qi[66] * Ci[12]
+	+ Qr[10] * Cr[68] - Qi[10] * Ci[68]
+	+ Qr[6] * Cr[72] - Qi[6] * Ci[72]
+	- 2. * Cr[78];
+      Ci[78] =
+	Qr[66] * Ci[12] + Qi[66] * Cr[12]
+	+ Qr[10] * Ci[68] + Qi[10] * Cr[68]
+	+ Qr[6] * Ci[72] + Qi[6] * Cr[72]
+	- 2. * Ci[78];
+      Cr[78] =
+	Qr[2] * Cr[76] - Qi[2] * Ci[76]
+	- Cr[78];
+      Ci[78] =
+	Qr[2] * Ci[76] + Qi[2] * Cr[76]
+	- Ci[78];
+
+      Cr[80] =
+	Qr[80];
+      Ci[80] =
+	Qi[80];
+      Cr[80] =
+	Qr[16] * Cr[64] - Qi[16] * Ci[64]
+	- Cr[80];
+      Ci[80] =
+	Qr[16] * Ci[64] + Qi[16] * Cr[64]
+	- Ci[80];
+
+      Cr[82] =
+	Qr[82];
+      Ci[82] =
+	Qi[82];
+      Cr[82] =
+	Qr[66] * Cr[16] - Qi[66] * Ci[16]
+	+ Qr[18] * Cr[64] - Qi[18] * Ci[64]
+	- 2. * Cr[82];
+      Ci[82] =
+	Qr[66] * Ci[16] + Qi[66] * Cr[16]
+	+ Qr[18] * Ci[64] + Qi[18] * Cr[64]
+	- 2. * Ci[82];
+      Cr[82] =
+	Qr[2] * Cr[80] - Qi[2] * Ci[80]
+	- Cr[82];
+      Ci[82] =
+	Qr[2] * Ci[80] + Qi[2] * Cr[80]
+	- Ci[82];
+
+      Cr[84] =
+	Qr[84];
+      Ci[84] =
+	Qi[84];
+      Cr[84] =
+	Qr[68] * Cr[16] - Qi[68] * Ci[16]
+	+ Qr[20] * Cr[64] - Qi[20] * Ci[64]
+	- 2. * Cr[84];
+      Ci[84] =
+	Qr[68] * Ci[16] + Qi[68] * Cr[16]
+	+ Qr[20] * Ci[64] + Qi[20] * Cr[64]
+	- 2. * Ci[84];
+      Cr[84] =
+	Qr[4] * Cr[80] - Qi[4] * Ci[80]
+	- Cr[84];
+      Ci[84] =
+	Qr[4] * Ci[80] + Qi[4] * Cr[80]
+	- Ci[84];
+
+      Cr[86] =
+	Qr[86];
+      Ci[86] =
+	Qi[86];
+      Cr[86] =
+	Qr[82] * Cr[4] - Qi[82] * Ci[4]
+	+ Qr[70] * Cr[16] - Qi[70] * Ci[16]
+	+ Qr[22] * Cr[64] - Qi[22] * Ci[64]
+	- 3. * Cr[86];
+      Ci[86] =
+	Qr[82] * Ci[4] + Qi[82] * Cr[4]
+	+ Qr[70] * Ci[16] + Qi[70] * Cr[16]
+	+ Qr[22] * Ci[64] + Qi[22] * Cr[64]
+	- 3. * Ci[86];
+      Cr[86] =
+	Qr[66] * Cr[20] - Qi[66] * Ci[20]
+	+ Qr[18] * Cr[68] - Qi[18] * Ci[68]
+	+ Qr[6] * Cr[80] - Qi[6] * Ci[80]
+	- 2. * Cr[86];
+      Ci[86] =
+	Qr[66] * Ci[20] + Qi[66] * Cr[20]
+	+ Qr[18] * Ci[68] + Qi[18] * Cr[68]
+	+ Qr[6] * Ci[80] + Qi[6] * Cr[80]
+	- 2. * Ci[86];
+      Cr[86] =
+	Qr[2] * Cr[84] - Qi[2] * Ci[84]
+	- Cr[86];
+      Ci[86] =
+	Qr[2] * Ci[84] + Qi[2] * Cr[84]
+	- Ci[86];
+
+      Cr[88] =
+	Qr[88];
+      Ci[88] =
+	Qi[88];
+      Cr[88] =
+	Qr[72] * Cr[16] - Qi[72] * Ci[16]
+	+ Qr[24] * Cr[64] - Qi[24] * Ci[64]
+	- 2. * Cr[88];
+      Ci[88] =
+	Qr[72] * Ci[16] + Qi[72] * Cr[16]
+	+ Qr[24] * Ci[64] + Qi[24] * Cr[64]
+	- 2. * Ci[88];
+      Cr[88] =
+	Qr[8] * Cr[80] - Qi[8] * Ci[80]
+	- Cr[88];
+      Ci[88] =
+	Qr[8] * Ci[80] + Qi[8] * Cr[80]
+	- Ci[88];
+
+      Cr[90] =
+	Qr[90];
+      Ci[90] =
+	Qi[90];
+      Cr[90] =
+	Qr[82] * Cr[8] - Qi[82] * Ci[8]
+	+ Qr[74] * Cr[16] - Qi[74] * Ci[16]
+	+ Qr[26] * Cr[64] - Qi[26] * Ci[64]
+	- 3. * Cr[90];
+      Ci[90] =
+	Qr[82] * Ci[8] + Qi[82] * Cr[8]
+	+ Qr[74] * Ci[16] + Qi[74] * Cr[16]
+	+ Qr[26] * Ci[64] + Qi[26] * Cr[64]
+	- 3. * Ci[90];
+      Cr[90] =
+	Qr[66] * Cr[24] - Qi[66] * Ci[24]
+	+ Qr[18] * Cr[72] - Qi[18] * Ci[72]
+	+ Qr[10] * Cr[80] - Qi[10] * Ci[80]
+	- 2. * Cr[90];
+      Ci[90] =
+	Qr[66] * Ci[24] + Qi[66] * Cr[24]
+	+ Qr[18] * Ci[72] + Qi[18] * Cr[72]
+	+ Qr[10] * Ci[80] + Qi[10] * Cr[80]
+	- 2. * Ci[90];
+      Cr[90] =
+	Qr[2] * Cr[88] - Qi[2] * Ci[88]
+	- Cr[90];
+      Ci[90] =
+	Qr[2] * Ci[88] + Qi[2] * Cr[88]
+	- Ci[90];
+
+      Cr[92] =
+	Qr[92];
+      Ci[92] =
+	Qi[92];
+      Cr[92] =
+	Qr[84] * Cr[8] - Qi[84] * Ci[8]
+	+ Qr[76] * Cr[16] - Qi[76] * Ci[16]
+	+ Qr[28] * Cr[64] - Qi[28] * Ci[64]
+	- 3. * Cr[92];
+      Ci[92] =
+	Qr[84] * Ci[8] + Qi[84] * Cr[8]
+	+ Qr[76] * Ci[16] + Qi[76] * Cr[16]
+	+ Qr[28] * Ci[64] + Qi[28] * Cr[64]
+	- 3. * Ci[92];
+      Cr[92] =
+	Qr[68] * Cr[24] - Qi[68] * Ci[24]
+	+ Qr[20] * Cr[72] - Qi[20] * Ci[72]
+	+ Qr[12] * Cr[80] - Qi[12] * Ci[80]
+	- 2. * Cr[92];
+      Ci[92] =
+	Qr[68] * Ci[24] + Qi[68] * Cr[24]
+	+ Qr[20] * Ci[72] + Qi[20] * Cr[72]
+	+ Qr[12] * Ci[80] + Qi[12] * Cr[80]
+	- 2. * Ci[92];
+      Cr[92] =
+	Qr[4] * Cr[88] - Qi[4] * Ci[88]
+	- Cr[92];
+      Ci[92] =
+	Qr[4] * Ci[88] + Qi[4] * Cr[88]
+	- Ci[92];
+
+      Cr[94] =
+	Qr[94];
+      Ci[94] =
+	Qi[94];
+      Cr[94] =
+	Qr[90] * Cr[4] - Qi[90] * Ci[4]
+	+ Qr[86] * Cr[8] - Qi[86] * Ci[8]
+	+ Qr[78] * Cr[16] - Qi[78] * Ci[16]
+	+ Qr[30] * Cr[64] - Qi[30] * Ci[64]
+	- 4. * Cr[94];
+      Ci[94] =
+	Qr[90] * Ci[4] + Qi[90] * Cr[4]
+	+ Qr[86] * Ci[8] + Qi[86] * Cr[8]
+	+ Qr[78] * Ci[16] + Qi[78] * Cr[16]
+	+ Qr[30] * Ci[64] + Qi[30] * Cr[64]
+	- 4. * Ci[94];
+      Cr[94] =
+	Qr[82] * Cr[12] - Qi[82] * Ci[12]
+	+ Qr[74] * Cr[20] - Qi[74] * Ci[20]
+	+ Qr[70] * Cr[24] - Qi[70] * Ci[24]
+	+ Qr[26] * Cr[68] - Qi[26] * Ci[68]
+	+ Qr[22] * Cr[72] - Qi[22] * Ci[72]
+	+ Qr[14] * Cr[80] - Qi[14] * Ci[80]
+	- 3. * Cr[94];
+      Ci[94] =
+	Qr[82] * Ci[12] + Qi[82] * Cr[12]
+	+ Qr[74] * Ci[20] + Qi[74] * Cr[20]
+	+ Qr[70] * Ci[24] + Qi[70] * Cr[24]
+	+ Qr[26] * Ci[68] + Qi[26] * Cr[68]
+	+ Qr[22] * Ci[72] + Qi[22] * Cr[72]
+	+ Qr[14] * Ci[80] + Qi[14] * Cr[80]
+	- 3. * Ci[94];
+      Cr[94] =
+	Qr[66] * Cr[28] - Qi[66] * Ci[28]
+	+ Qr[18] * Cr[76] - Qi[18] * Ci[76]
+	+ Qr[10] * Cr[84] - Qi[10] * Ci[84]
+	+ Qr[6] * Cr[88] - Qi[6] * Ci[88]
+	- 2. * Cr[94];
+      Ci[94] =
+	Qr[66] * Ci[28] + Qi[66] * Cr[28]
+	+ Qr[18] * Ci[76] + Qi[18] * Cr[76]
+	+ Qr[10] * Ci[84] + Qi[10] * Cr[84]
+	+ Qr[6] * Ci[88] + Qi[6] * Cr[88]
+	- 2. * Ci[94];
+      Cr[94] =
+	Qr[2] * Cr[92] - Qi[2] * Ci[92]
+	- Cr[94];
+      Ci[94] =
+	Qr[2] * Ci[92] + Qi[2] * Cr[92]
+	- Ci[94];
+
+      Cr[96] =
+	Qr[96];
+      Ci[96] =
+	Qi[96];
+      Cr[96] =
+	Qr[32] * Cr[64] - Qi[32] * Ci[64]
+	- Cr[96];
+      Ci[96] =
+	Qr[32] * Ci[64] + Qi[32] * Cr[64]
+	- Ci[96];
+
+      Cr[98] =
+	Qr[98];
+      Ci[98] =
+	Qi[98];
+      Cr[98] =
+	Qr[66] * Cr[32] - Qi[66] * Ci[32]
+	+ Qr[34] * Cr[64] - Qi[34] * Ci[64]
+	- 2. * Cr[98];
+      Ci[98] =
+	Qr[66] * Ci[32] + Qi[66] * Cr[32]
+	+ Qr[34] * Ci[64] + Qi[34] * Cr[64]
+	- 2. * Ci[98];
+      Cr[98] =
+	Qr[2] * Cr[96] - Qi[2] * Ci[96]
+	- Cr[98];
+      Ci[98] =
+	Qr[2] * Ci[96] + Qi[2] * Cr[96]
+	- Ci[98];
+
+      Cr[100] =
+	Qr[100];
+      Ci[100] =
+	Qi[100];
+      Cr[100] =
+	Qr[68] * Cr[32] - Qi[68] * Ci[32]
+	+ Qr[36] * Cr[64] - Qi[36] * Ci[64]
+	- 2. * Cr[100];
+      Ci[100] =
+	Qr[68] * Ci[32] + Qi[68] * Cr[32]
+	+ Qr[36] * Ci[64] + Qi[36] * Cr[64]
+	- 2. * Ci[100];
+      Cr[100] =
+	Qr[4] * Cr[96] - Qi[4] * Ci[96]
+	- Cr[100];
+      Ci[100] =
+	Qr[4] * Ci[96] + Qi[4] * Cr[96]
+	- Ci[100];
+
+      Cr[102] =
+	Qr[102];
+      Ci[102] =
+	Qi[102];
+      Cr[102] =
+	Qr[98] * Cr[4] - Qi[98] * Ci[4]
+	+ Qr[70] * Cr[32] - Qi[70] * Ci[32]
+	+ Qr[38] * Cr[64] - Qi[38] * Ci[64]
+	- 3. * Cr[102];
+      Ci[102] =
+	Qr[98] * Ci[4] + Qi[98] * Cr[4]
+	+ Qr[70] * Ci[32] + Qi[70] * Cr[32]
+	+ Qr[38] * Ci[64] + Qi[38] * Cr[64]
+	- 3. * Ci[102];
+      Cr[102] =
+	Qr[66] * Cr[36] - Qi[66] * Ci[36]
+	+ Qr[34] * Cr[68] - Qi[34] * Ci[68]
+	+ Qr[6] * Cr[96] - Qi[6] * Ci[96]
+	- 2. * Cr[102];
+      Ci[102] =
+	Qr[66] * Ci[36] + Qi[66] * Cr[36]
+	+ Qr[34] * Ci[68] + Qi[34] * Cr[68]
+	+ Qr[6] * Ci[96] + Qi[6] * Cr[96]
+	- 2. * Ci[102];
+      Cr[102] =
+	Qr[2] * Cr[100] - Qi[2] * Ci[100]
+	- Cr[102];
+      Ci[102] =
+	Qr[2] * Ci[100] + Qi[2] * Cr[100]
+	- Ci[102];
+
+      Cr[104] =
+	Qr[104];
+      Ci[104] =
+	Qi[104];
+      Cr[104] =
+	Qr[72] * Cr[32] - Qi[72] * Ci[32]
+	+ Qr[40] * Cr[64] - Qi[40] * Ci[64]
+	- 2. * Cr[104];
+      Ci[104] =
+	Qr[72] * Ci[32] + Qi[72] * Cr[32]
+	+ Qr[40] * Ci[64] + Qi[40] * Cr[64]
+	- 2. * Ci[104];
+      Cr[104] =
+	Qr[8] * Cr[96] - Qi[8] * Ci[96]
+	- Cr[104];
+      Ci[104] =
+	Qr[8] * Ci[96] + Qi[8] * Cr[96]
+	- Ci[104];
+
+      Cr[106] =
+	Qr[106];
+      Ci[106] =
+	Qi[106];
+      Cr[106] =
+	Qr[98] * Cr[8] - Qi[98] * Ci[8]
+	+ Qr[74] * Cr[32] - Qi[74] * Ci[32]
+	+ Qr[42] * Cr[64] - Qi[42] * Ci[64]
+	- 3. * Cr[106];
+      Ci[106] =
+	Qr[98] * Ci[8] + Qi[98] * Cr[8]
+	+ Qr[74] * Ci[32] + Qi[74] * Cr[32]
+	+ Qr[42] * Ci[64] + Qi[42] * Cr[64]
+	- 3. * Ci[106];
+      Cr[106] =
+	Qr[66] * Cr[40] - Qi[66] * Ci[40]
+	+ Qr[34] * Cr[72] - Qi[34] * Ci[72]
+	+ Qr[10] * Cr[96] - Qi[10] * Ci[96]
+	- 2. * Cr[106];
+      Ci[106] =
+	Qr[66] * Ci[40] + Qi[66] * Cr[40]
+	+ Qr[34] * Ci[72] + Qi[34] * Cr[72]
+	+ Qr[10] * Ci[96] + Qi[10] * Cr[96]
+	- 2. * Ci[106];
+      Cr[106] =
+	Qr[2] * Cr[104] - Qi[2] * Ci[104]
+	- Cr[106];
+      Ci[106] =
+	Qr[2] * Ci[104] + Qi[2] * Cr[104]
+	- Ci[106];
+
+      Cr[108] =
+	Qr[108];
+      Ci[108] =
+	Qi[108];
+      Cr[108] =
+	Qr[100] * Cr[8] - Qi[100] * Ci[8]
+	+ Qr[76] * Cr[32] - Qi[76] * Ci[32]
+	+ Qr[44] * Cr[64] - Qi[44] * Ci[64]
+	- 3. * Cr[108];
+      Ci[108] =
+	Qr[100] * Ci[8] + Qi[100] * Cr[8]
+	+ Qr[76] * Ci[32] + Qi[76] * Cr[32]
+	+ Qr[44] * Ci[64] + Qi[44] * Cr[64]
+	- 3. * Ci[108];
+      Cr[108] =
+	Qr[68] * Cr[40] - Qi[68] * Ci[40]
+	+ Qr[36] * Cr[72] - Qi[36] * Ci[72]
+	+ Qr[12] * Cr[96] - Qi[12] * Ci[96]
+	- 2. * Cr[108];
+      Ci[108] =
+	Qr[68] * Ci[40] + Qi[68] * Cr[40]
+	+ Qr[36] * Ci[72] + Qi[36] * Cr[72]
+	+ Qr[12] * Ci[96] + Qi[12] * Cr[96]
+	- 2. * Ci[108];
+      Cr[108] =
+	Qr[4] * Cr[104] - Qi[4] * Ci[104]
+	- Cr[108];
+      Ci[108] =
+	Qr[4] * Ci[104] + Qi[4] * Cr[104]
+	- Ci[108];
+
+      Cr[110] =
+	Qr[110];
+      Ci[110] =
+	Qi[110];
+      Cr[110] =
+	Qr[106] * Cr[4] - Qi[106] * Ci[4]
+	+ Qr[102] * Cr[8] - Qi[102] * Ci[8]
+	+ Qr[78] * Cr[32] - Qi[78] * Ci[32]
+	+ Qr[46] * Cr[64] - Qi[46] * Ci[64]
+	- 4. * Cr[110];
+      Ci[110] =
+	Qr[106] * Ci[4] + Qi[106] * Cr[4]
+	+ Qr[102] * Ci[8] + Qi[102] * Cr[8]
+	+ Qr[78] * Ci[32] + Qi[78] * Cr[32]
+	+ Qr[46] * Ci[64] + Qi[46] * Cr[64]
+	- 4. * Ci[110];
+      Cr[110] =
+	Qr[98] * Cr[12] - Qi[98] * Ci[12]
+	+ Qr[74] * Cr[36] - Qi[74] * Ci[36]
+	+ Qr[70] * Cr[40] - Qi[70] * Ci[40]
+	+ Qr[42] * Cr[68] - Qi[42] * Ci[68]
+	+ Qr[38] * Cr[72] - Qi[38] * Ci[72]
+	+ Qr[14] * Cr[96] - Qi[14] * Ci[96]
+	- 3. * Cr[110];
+      Ci[110] =
+	Qr[98] * Ci[12] + Qi[98] * Cr[12]
+	+ Qr[74] * Ci[36] + Qi[74] * Cr[36]
+	+ Qr[70] * Ci[40] + Qi[70] * Cr[40]
+	+ Qr[42] * Ci[68] + Qi[42] * Cr[68]
+	+ Qr[38] * Ci[72] + Qi[38] * Cr[72]
+	+ Qr[14] * Ci[96] + Qi[14] * Cr[96]
+	- 3. * Ci[110];
+      Cr[110] =
+	Qr[66] * Cr[44] - Qi[66] * Ci[44]
+	+ Qr[34] * Cr[76] - Qi[34] * Ci[76]
+	+ Qr[10] * Cr[100] - Qi[10] * Ci[100]
+	+ Qr[6] * Cr[104] - Qi[6] * Ci[104]
+	- 2. * Cr[110];
+      Ci[110] =
+	Qr[66] * Ci[44] + Qi[66] * Cr[44]
+	+ Qr[34] * Ci[76] + Qi[34] * Cr[76]
+	+ Qr[10] * Ci[100] + Qi[10] * Cr[100]
+	+ Qr[6] * Ci[104] + Qi[6] * Cr[104]
+	- 2. * Ci[110];
+      Cr[110] =
+	Qr[2] * Cr[108] - Qi[2] * Ci[108]
+	- Cr[110];
+      Ci[110] =
+	Qr[2] * Ci[108] + Qi[2] * Cr[108]
+	- Ci[110];
+
+      Cr[112] =
+	Qr[112];
+      Ci[112] =
+	Qi[112];
+      Cr[112] =
+	Qr[80] * Cr[32] - Qi[80] * Ci[32]
+	+ Qr[48] * Cr[64] - Qi[48] * Ci[64]
+	- 2. * Cr[112];
+      Ci[112] =
+	Qr[80] * Ci[32] + Qi[80] * Cr[32]
+	+ Qr[48] * Ci[64] + Qi[48] * Cr[64]
+	- 2. * Ci[112];
+      Cr[112] =
+	Qr[16] * Cr[96] - Qi[16] * Ci[96]
+	- Cr[112];
+      Ci[112] =
+	Qr[16] * Ci[96] + Qi[16] * Cr[96]
+	- Ci[112];
+    }
+
+    /** Part 2 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part2(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[114] =
+	Qr[114];
+      Ci[114] =
+	Qi[114];
+      Cr[114] =
+	Qr[98] * Cr[16] - Qi[98] * Ci[16]
+	+ Qr[82] * Cr[32] - Qi[82] * Ci[32]
+	+ Qr[50] * Cr[64] - Qi[50] * Ci[64]
+	- 3. * Cr[114];
+      Ci[114] =
+	Qr[98] * Ci[16] + Qi[98] * Cr[16]
+	+ Qr[82] * Ci[32] + Qi[82] * Cr[32]
+	+ Qr[50] * Ci[64] + Qi[50] * Cr[64]
+	- 3. * Ci[114];
+      Cr[114] =
+	Qr[66] * Cr[48] - Qi[66] * Ci[48]
+	+ Qr[34] * Cr[80] - Qi[34] * Ci[80]
+	+ Qr[18] * Cr[96] - Qi[18] * Ci[96]
+	- 2. * Cr[114];
+      Ci[114] =
+	Qr[66] * Ci[48] + Qi[66] * Cr[48]
+	+ Qr[34] * Ci[80] + Qi[34] * Cr[80]
+	+ Qr[18] * Ci[96] + Qi[18] * Cr[96]
+	- 2. * Ci[114];
+      Cr[114] =
+	Qr[2] * Cr[112] - Qi[2] * Ci[112]
+	- Cr[114];
+      Ci[114] =
+	Qr[2] * Ci[112] + Qi[2] * Cr[112]
+	- Ci[114];
+
+      Cr[116] =
+	Qr[116];
+      Ci[116] =
+	Qi[116];
+      Cr[116] =
+	Qr[100] * Cr[16] - Qi[100] * Ci[16]
+	+ Qr[84] * Cr[32] - Qi[84] * Ci[32]
+	+ Qr[52] * Cr[64] - Qi[52] * Ci[64]
+	- 3. * Cr[116];
+      Ci[116] =
+	Qr[100] * Ci[16] + Qi[100] * Cr[16]
+	+ Qr[84] * Ci[32] + Qi[84] * Cr[32]
+	+ Qr[52] * Ci[64] + Qi[52] * Cr[64]
+	- 3. * Ci[116];
+      Cr[116] =
+	Qr[68] * Cr[48] - Qi[68] * Ci[48]
+	+ Qr[36] * Cr[80] - Qi[36] * Ci[80]
+	+ Qr[20] * Cr[96] - Qi[20] * Ci[96]
+	- 2. * Cr[116];
+      Ci[116] =
+	Qr[68] * Ci[48] + Qi[68] * Cr[48]
+	+ Qr[36] * Ci[80] + Qi[36] * Cr[80]
+	+ Qr[20] * Ci[96] + Qi[20] * Cr[96]
+	- 2. * Ci[116];
+      Cr[116] =
+	Qr[4] * Cr[112] - Qi[4] * Ci[112]
+	- Cr[116];
+      Ci[116] =
+	Qr[4] * Ci[112] + Qi[4] * Cr[112]
+	- Ci[116];
+
+      Cr[118] =
+	Qr[118];
+      Ci[118] =
+	Qi[118];
+      Cr[118] =
+	Qr[114] * Cr[4] - Qi[114] * Ci[4]
+	+ Qr[102] * Cr[16] - Qi[102] * Ci[16]
+	+ Qr[86] * Cr[32] - Qi[86] * Ci[32]
+	+ Qr[54] * Cr[64] - Qi[54] * Ci[64]
+	- 4. * Cr[118];
+      Ci[118] =
+	Qr[114] * Ci[4] + Qi[114] * Cr[4]
+	+ Qr[102] * Ci[16] + Qi[102] * Cr[16]
+	+ Qr[86] * Ci[32] + Qi[86] * Cr[32]
+	+ Qr[54] * Ci[64] + Qi[54] * Cr[64]
+	- 4. * Ci[118];
+      Cr[118] =
+	Qr[98] * Cr[20] - Qi[98] * Ci[20]
+	+ Qr[82] * Cr[36] - Qi[82] * Ci[36]
+	+ Qr[70] * Cr[48] - Qi[70] * Ci[48]
+	+ Qr[50] * Cr[68] - Qi[50] * Ci[68]
+	+ Qr[38] * Cr[80] - Qi[38] * Ci[80]
+	+ Qr[22] * Cr[96] - Qi[22] * Ci[96]
+	- 3. * Cr[118];
+      Ci[118] =
+	Qr[98] * Ci[20] + Qi[98] * Cr[20]
+	+ Qr[82] * Ci[36] + Qi[82] * Cr[36]
+	+ Qr[70] * Ci[48] + Qi[70] * Cr[48]
+	+ Qr[50] * Ci[68] + Qi[50] * Cr[68]
+	+ Qr[38] * Ci[80] + Qi[38] * Cr[80]
+	+ Qr[22] * Ci[96] + Qi[22] * Cr[96]
+	- 3. * Ci[118];
+      Cr[118] =
+	Qr[66] * Cr[52] - Qi[66] * Ci[52]
+	+ Qr[34] * Cr[84] - Qi[34] * Ci[84]
+	+ Qr[18] * Cr[100] - Qi[18] * Ci[100]
+	+ Qr[6] * Cr[112] - Qi[6] * Ci[112]
+	- 2. * Cr[118];
+      Ci[118] =
+	Qr[66] * Ci[52] + Qi[66] * Cr[52]
+	+ Qr[34] * Ci[84] + Qi[34] * Cr[84]
+	+ Qr[18] * Ci[100] + Qi[18] * Cr[100]
+	+ Qr[6] * Ci[112] + Qi[6] * Cr[112]
+	- 2. * Ci[118];
+      Cr[118] =
+	Qr[2] * Cr[116] - Qi[2] * Ci[116]
+	- Cr[118];
+      Ci[118] =
+	Qr[2] * Ci[116] + Qi[2] * Cr[116]
+	- Ci[118];
+
+      Cr[120] =
+	Qr[120];
+      Ci[120] =
+	Qi[120];
+      Cr[120] =
+	Qr[104] * Cr[16] - Qi[104] * Ci[16]
+	+ Qr[88] * Cr[32] - Qi[88] * Ci[32]
+	+ Qr[56] * Cr[64] - Qi[56] * Ci[64]
+	- 3. * Cr[120];
+      Ci[120] =
+	Qr[104] * Ci[16] + Qi[104] * Cr[16]
+	+ Qr[88] * Ci[32] + Qi[88] * Cr[32]
+	+ Qr[56] * Ci[64] + Qi[56] * Cr[64]
+	- 3. * Ci[120];
+      Cr[120] =
+	Qr[72] * Cr[48] - Qi[72] * Ci[48]
+	+ Qr[40] * Cr[80] - Qi[40] * Ci[80]
+	+ Qr[24] * Cr[96] - Qi[24] * Ci[96]
+	- 2. * Cr[120];
+      Ci[120] =
+	Qr[72] * Ci[48] + Qi[72] * Cr[48]
+	+ Qr[40] * Ci[80] + Qi[40] * Cr[80]
+	+ Qr[24] * Ci[96] + Qi[24] * Cr[96]
+	- 2. * Ci[120];
+      Cr[120] =
+	Qr[8] * Cr[112] - Qi[8] * Ci[112]
+	- Cr[120];
+      Ci[120] =
+	Qr[8] * Ci[112] + Qi[8] * Cr[112]
+	- Ci[120];
+
+      Cr[122] =
+	Qr[122];
+      Ci[122] =
+	Qi[122];
+      Cr[122] =
+	Qr[114] * Cr[8] - Qi[114] * Ci[8]
+	+ Qr[106] * Cr[16] - Qi[106] * Ci[16]
+	+ Qr[90] * Cr[32] - Qi[90] * Ci[32]
+	+ Qr[58] * Cr[64] - Qi[58] * Ci[64]
+	- 4. * Cr[122];
+      Ci[122] =
+	Qr[114] * Ci[8] + Qi[114] * Cr[8]
+	+ Qr[106] * Ci[16] + Qi[106] * Cr[16]
+	+ Qr[90] * Ci[32] + Qi[90] * Cr[32]
+	+ Qr[58] * Ci[64] + Qi[58] * Cr[64]
+	- 4. * Ci[122];
+      Cr[122] =
+	Qr[98] * Cr[24] - Qi[98] * Ci[24]
+	+ Qr[82] * Cr[40] - Qi[82] * Ci[40]
+	+ Qr[74] * Cr[48] - Qi[74] * Ci[48]
+	+ Qr[50] * Cr[72] - Qi[50] * Ci[72]
+	+ Qr[42] * Cr[80] - Qi[42] * Ci[80]
+	+ Qr[26] * Cr[96] - Qi[26] * Ci[96]
+	- 3. * Cr[122];
+      Ci[122] =
+	Qr[98] * Ci[24] + Qi[98] * Cr[24]
+	+ Qr[82] * Ci[40] + Qi[82] * Cr[40]
+	+ Qr[74] * Ci[48] + Qi[74] * Cr[48]
+	+ Qr[50] * Ci[72] + Qi[50] * Cr[72]
+	+ Qr[42] * Ci[80] + Qi[42] * Cr[80]
+	+ Qr[26] * Ci[96] + Qi[26] * Cr[96]
+	- 3. * Ci[122];
+      Cr[122] =
+	Qr[66] * Cr[56] - Qi[66] * Ci[56]
+	+ Qr[34] * Cr[88] - Qi[34] * Ci[88]
+	+ Qr[18] * Cr[104] - Qi[18] * Ci[104]
+	+ Qr[10] * Cr[112] - Qi[10] * Ci[112]
+	- 2. * Cr[122];
+      Ci[122] =
+	Qr[66] * Ci[56] + Qi[66] * Cr[56]
+	+ Qr[34] * Ci[88] + Qi[34] * Cr[88]
+	+ Qr[18] * Ci[104] + Qi[18] * Cr[104]
+	+ Qr[10] * Ci[112] + Qi[10] * Cr[112]
+	- 2. * Ci[122];
+      Cr[122] =
+	Qr[2] * Cr[120] - Qi[2] * Ci[120]
+	- Cr[122];
+      Ci[122] =
+	Qr[2] * Ci[120] + Qi[2] * Cr[120]
+	- Ci[122];
+
+      Cr[124] =
+	Qr[124];
+      Ci[124] =
+	Qi[124];
+      Cr[124] =
+	Qr[116] * Cr[8] - Qi[116] * Ci[8]
+	+ Qr[108] * Cr[16] - Qi[108] * Ci[16]
+	+ Qr[92] * Cr[32] - Qi[92] * Ci[32]
+	+ Qr[60] * Cr[64] - Qi[60] * Ci[64]
+	- 4. * Cr[124];
+      Ci[124] =
+	Qr[116] * Ci[8] + Qi[116] * Cr[8]
+	+ Qr[108] * Ci[16] + Qi[108] * Cr[16]
+	+ Qr[92] * Ci[32] + Qi[92] * Cr[32]
+	+ Qr[60] * Ci[64] + Qi[60] * Cr[64]
+	- 4. * Ci[124];
+      Cr[124] =
+	Qr[100] * Cr[24] - Qi[100] * Ci[24]
+	+ Qr[84] * Cr[40] - Qi[84] * Ci[40]
+	+ Qr[76] * Cr[48] - Qi[76] * Ci[48]
+	+ Qr[52] * Cr[72] - Qi[52] * Ci[72]
+	+ Qr[44] * Cr[80] - Qi[44] * Ci[80]
+	+ Qr[28] * Cr[96] - Qi[28] * Ci[96]
+	- 3. * Cr[124];
+      Ci[124] =
+	Qr[100] * Ci[24] + Qi[100] * Cr[24]
+	+ Qr[84] * Ci[40] + Qi[84] * Cr[40]
+	+ Qr[76] * Ci[48] + Qi[76] * Cr[48]
+	+ Qr[52] * Ci[72] + Qi[52] * Cr[72]
+	+ Qr[44] * Ci[80] + Qi[44] * Cr[80]
+	+ Qr[28] * Ci[96] + Qi[28] * Cr[96]
+	- 3. * Ci[124];
+      Cr[124] =
+	Qr[68] * Cr[56] - Qi[68] * Ci[56]
+	+ Qr[36] * Cr[88] - Qi[36] * Ci[88]
+	+ Qr[20] * Cr[104] - Qi[20] * Ci[104]
+	+ Qr[12] * Cr[112] - Qi[12] * Ci[112]
+	- 2. * Cr[124];
+      Ci[124] =
+	Qr[68] * Ci[56] + Qi[68] * Cr[56]
+	+ Qr[36] * Ci[88] + Qi[36] * Cr[88]
+	+ Qr[20] * Ci[104] + Qi[20] * Cr[104]
+	+ Qr[12] * Ci[112] + Qi[12] * Cr[112]
+	- 2. * Ci[124];
+      Cr[124] =
+	Qr[4] * Cr[120] - Qi[4] * Ci[120]
+	- Cr[124];
+      Ci[124] =
+	Qr[4] * Ci[120] + Qi[4] * Cr[120]
+	- Ci[124];
+
+      Cr[126] =
+	Qr[126];
+      Ci[126] =
+	Qi[126];
+      Cr[126] =
+	Qr[122] * Cr[4] - Qi[122] * Ci[4]
+	+ Qr[118] * Cr[8] - Qi[118] * Ci[8]
+	+ Qr[110] * Cr[16] - Qi[110] * Ci[16]
+	+ Qr[94] * Cr[32] - Qi[94] * Ci[32]
+	+ Qr[62] * Cr[64] - Qi[62] * Ci[64]
+	- 5. * Cr[126];
+      Ci[126] =
+	Qr[122] * Ci[4] + Qi[122] * Cr[4]
+	+ Qr[118] * Ci[8] + Qi[118] * Cr[8]
+	+ Qr[110] * Ci[16] + Qi[110] * Cr[16]
+	+ Qr[94] * Ci[32] + Qi[94] * Cr[32]
+	+ Qr[62] * Ci[64] + Qi[62] * Cr[64]
+	- 5. * Ci[126];
+      Cr[126] =
+	Qr[114] * Cr[12] - Qi[114] * Ci[12]
+	+ Qr[106] * Cr[20] - Qi[106] * Ci[20]
+	+ Qr[102] * Cr[24] - Qi[102] * Ci[24]
+	+ Qr[90] * Cr[36] - Qi[90] * Ci[36]
+	+ Qr[86] * Cr[40] - Qi[86] * Ci[40]
+	+ Qr[78] * Cr[48] - Qi[78] * Ci[48]
+	+ Qr[58] * Cr[68] - Qi[58] * Ci[68]
+	+ Qr[54] * Cr[72] - Qi[54] * Ci[72]
+	+ Qr[46] * Cr[80] - Qi[46] * Ci[80]
+	+ Qr[30] * Cr[96] - Qi[30] * Ci[96]
+	- 4. * Cr[126];
+      Ci[126] =
+	Qr[114] * Ci[12] + Qi[114] * Cr[12]
+	+ Qr[106] * Ci[20] + Qi[106] * Cr[20]
+	+ Qr[102] * Ci[24] + Qi[102] * Cr[24]
+	+ Qr[90] * Ci[36] + Qi[90] * Cr[36]
+	+ Qr[86] * Ci[40] + Qi[86] * Cr[40]
+	+ Qr[78] * Ci[48] + Qi[78] * Cr[48]
+	+ Qr[58] * Ci[68] + Qi[58] * Cr[68]
+	+ Qr[54] * Ci[72] + Qi[54] * Cr[72]
+	+ Qr[46] * Ci[80] + Qi[46] * Cr[80]
+	+ Qr[30] * Ci[96] + Qi[30] * Cr[96]
+	- 4. * Ci[126];
+      Cr[126] =
+	Qr[98] * Cr[28] - Qi[98] * Ci[28]
+	+ Qr[82] * Cr[44] - Qi[82] * Ci[44]
+	+ Qr[74] * Cr[52] - Qi[74] * Ci[52]
+	+ Qr[70] * Cr[56] - Qi[70] * Ci[56]
+	+ Qr[50] * Cr[76] - Qi[50] * Ci[76]
+	+ Qr[42] * Cr[84] - Qi[42] * Ci[84]
+	+ Qr[38] * Cr[88] - Qi[38] * Ci[88]
+	+ Qr[26] * Cr[100] - Qi[26] * Ci[100]
+	+ Qr[22] * Cr[104] - Qi[22] * Ci[104]
+	+ Qr[14] * Cr[112] - Qi[14] * Ci[112]
+	- 3. * Cr[126];
+      Ci[126] =
+	Qr[98] * Ci[28] + Qi[98] * Cr[28]
+	+ Qr[82] * Ci[44] + Qi[82] * Cr[44]
+	+ Qr[74] * Ci[52] + Qi[74] * Cr[52]
+	+ Qr[70] * Ci[56] + Qi[70] * Cr[56]
+	+ Qr[50] * Ci[76] + Qi[50] * Cr[76]
+	+ Qr[42] * Ci[84] + Qi[42] * Cr[84]
+	+ Qr[38] * Ci[88] + Qi[38] * Cr[88]
+	+ Qr[26] * Ci[100] + Qi[26] * Cr[100]
+	+ Qr[22] * Ci[104] + Qi[22] * Cr[104]
+	+ Qr[14] * Ci[112] + Qi[14] * Cr[112]
+	- 3. * Ci[126];
+      Cr[126] =
+	Qr[66] * Cr[60] - Qi[66] * Ci[60]
+	+ Qr[34] * Cr[92] - Qi[34] * Ci[92]
+	+ Qr[18] * Cr[108] - Qi[18] * Ci[108]
+	+ Qr[10] * Cr[116] - Qi[10] * Ci[116]
+	+ Qr[6] * Cr[120] - Qi[6] * Ci[120]
+	- 2. * Cr[126];
+      Ci[126] =
+	Qr[66] * Ci[60] + Qi[66] * Cr[60]
+	+ Qr[34] * Ci[92] + Qi[34] * Cr[92]
+	+ Qr[18] * Ci[108] + Qi[18] * Cr[108]
+	+ Qr[10] * Ci[116] + Qi[10] * Cr[116]
+	+ Qr[6] * Ci[120] + Qi[6] * Cr[120]
+	- 2. * Ci[126];
+      Cr[126] =
+	Qr[2] * Cr[124] - Qi[2] * Ci[124]
+	- Cr[126];
+      Ci[126] =
+	Qr[2] * Ci[124] + Qi[2] * Cr[124]
+	- Ci[126];
+
+      Cr[128] =
+	Qr[128];
+      Ci[128] =
+	Qi[128];
+
+      Cr[130] =
+	Qr[130];
+      Ci[130] =
+	Qi[130];
+      Cr[130] =
+	Qr[2] * Cr[128] - Qi[2] * Ci[128]
+	- Cr[130];
+      Ci[130] =
+	Qr[2] * Ci[128] + Qi[2] * Cr[128]
+	- Ci[130];
+
+      Cr[132] =
+	Qr[132];
+      Ci[132] =
+	Qi[132];
+      Cr[132] =
+	Qr[4] * Cr[128] - Qi[4] * Ci[128]
+	- Cr[132];
+      Ci[132] =
+	Qr[4] * Ci[128] + Qi[4] * Cr[128]
+	- Ci[132];
+
+      Cr[134] =
+	Qr[134];
+      Ci[134] =
+	Qi[134];
+      Cr[134] =
+	Qr[130] * Cr[4] - Qi[130] * Ci[4]
+	+ Qr[6] * Cr[128] - Qi[6] * Ci[128]
+	- 2. * Cr[134];
+      Ci[134] =
+	Qr[130] * Ci[4] + Qi[130] * Cr[4]
+	+ Qr[6] * Ci[128] + Qi[6] * Cr[128]
+	- 2. * Ci[134];
+      Cr[134] =
+	Qr[2] * Cr[132] - Qi[2] * Ci[132]
+	- Cr[134];
+      Ci[134] =
+	Qr[2] * Ci[132] + Qi[2] * Cr[132]
+	- Ci[134];
+
+      Cr[136] =
+	Qr[136];
+      Ci[136] =
+	Qi[136];
+      Cr[136] =
+	Qr[8] * Cr[128] - Qi[8] * Ci[128]
+	- Cr[136];
+      Ci[136] =
+	Qr[8] * Ci[128] + Qi[8] * Cr[128]
+	- Ci[136];
+
+      Cr[138] =
+	Qr[138];
+      Ci[138] =
+	Qi[138];
+      Cr[138] =
+	Qr[130] * Cr[8] - Qi[130] * Ci[8]
+	+ Qr[10] * Cr[128] - Qi[10] * Ci[128]
+	- 2. * Cr[138];
+      Ci[138] =
+	Qr[130] * Ci[8] + Qi[130] * Cr[8]
+	+ Qr[10] * Ci[128] + Qi[10] * Cr[128]
+	- 2. * Ci[138];
+      Cr[138] =
+	Qr[2] * Cr[136] - Qi[2] * Ci[136]
+	- Cr[138];
+      Ci[138] =
+	Qr[2] * Ci[136] + Qi[2] * Cr[136]
+	- Ci[138];
+
+      Cr[140] =
+	Qr[140];
+      Ci[140] =
+	Qi[140];
+      Cr[140] =
+	Qr[132] * Cr[8] - Qi[132] * Ci[8]
+	+ Qr[12] * Cr[128] - Qi[12] * Ci[128]
+	- 2. * Cr[140];
+      Ci[140] =
+	Qr[132] * Ci[8] + Qi[132] * Cr[8]
+	+ Qr[12] * Ci[128] + Qi[12] * Cr[128]
+	- 2. * Ci[140];
+      Cr[140] =
+	Qr[4] * Cr[136] - Qi[4] * Ci[136]
+	- Cr[140];
+      Ci[140] =
+	Qr[4] * Ci[136] + Qi[4] * Cr[136]
+	- Ci[140];
+
+      Cr[142] =
+	Qr[142];
+      Ci[142] =
+	Qi[142];
+      Cr[142] =
+	Qr[138] * Cr[4] - Qi[138] * Ci[4]
+	+ Qr[134] * Cr[8] - Qi[134] * Ci[8]
+	+ Qr[14] * Cr[128] - Qi[14] * Ci[128]
+	- 3. * Cr[142];
+      Ci[142] =
+	Qr[138] * Ci[4] + Qi[138] * Cr[4]
+	+ Qr[134] * Ci[8] + Qi[134] * Cr[8]
+	+ Qr[14] * Ci[128] + Qi[14] * Cr[128]
+	- 3. * Ci[142];
+      Cr[142] =
+	Qr[130] * Cr[12] - Qi[130] * Ci[12]
+	+ Qr[10] * Cr[132] - Qi[10] * Ci[132]
+	+ Qr[6] * Cr[136] - Qi[6] * Ci[136]
+	- 2. * Cr[142];
+      Ci[142] =
+	Qr[130] * Ci[12] + Qi[130] * Cr[12]
+	+ Qr[10] * Ci[132] + Qi[10] * Cr[132]
+	+ Qr[6] * Ci[136] + Qi[6] * Cr[136]
+	- 2. * Ci[142];
+      Cr[142] =
+	Qr[2] * Cr[140] - Qi[2] * Ci[140]
+	- Cr[142];
+      Ci[142] =
+	Qr[2] * Ci[140] + Qi[2] * Cr[140]
+	- Ci[142];
+    }
+
+    /** Part 3 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part3(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[144] =
+	Qr[144];
+      Ci[144] =
+	Qi[144];
+      Cr[144] =
+	Qr[16] * Cr[128] - Qi[16] * Ci[128]
+	- Cr[144];
+      Ci[144] =
+	Qr[16] * Ci[128] + Qi[16] * Cr[128]
+	- Ci[144];
+
+      Cr[146] =
+	Qr[146];
+      Ci[146] =
+	Qi[146];
+      Cr[146] =
+	Qr[130] * Cr[16] - Qi[130] * Ci[16]
+	+ Qr[18] * Cr[128] - Qi[18] * Ci[128]
+	- 2. * Cr[146];
+      Ci[146] =
+	Qr[130] * Ci[16] + Qi[130] * Cr[16]
+	+ Qr[18] * Ci[128] + Qi[18] * Cr[128]
+	- 2. * Ci[146];
+      Cr[146] =
+	Qr[2] * Cr[144] - Qi[2] * Ci[144]
+	- Cr[146];
+      Ci[146] =
+	Qr[2] * Ci[144] + Qi[2] * Cr[144]
+	- Ci[146];
+
+      Cr[148] =
+	Qr[148];
+      Ci[148] =
+	Qi[148];
+      Cr[148] =
+	Qr[132] * Cr[16] - Qi[132] * Ci[16]
+	+ Qr[20] * Cr[128] - Qi[20] * Ci[128]
+	- 2. * Cr[148];
+      Ci[148] =
+	Qr[132] * Ci[16] + Qi[132] * Cr[16]
+	+ Qr[20] * Ci[128] + Qi[20] * Cr[128]
+	- 2. * Ci[148];
+      Cr[148] =
+	Qr[4] * Cr[144] - Qi[4] * Ci[144]
+	- Cr[148];
+      Ci[148] =
+	Qr[4] * Ci[144] + Qi[4] * Cr[144]
+	- Ci[148];
+
+      Cr[150] =
+	Qr[150];
+      Ci[150] =
+	Qi[150];
+      Cr[150] =
+	Qr[146] * Cr[4] - Qi[146] * Ci[4]
+	+ Qr[134] * Cr[16] - Qi[134] * Ci[16]
+	+ Qr[22] * Cr[128] - Qi[22] * Ci[128]
+	- 3. * Cr[150];
+      Ci[150] =
+	Qr[146] * Ci[4] + Qi[146] * Cr[4]
+	+ Qr[134] * Ci[16] + Qi[134] * Cr[16]
+	+ Qr[22] * Ci[128] + Qi[22] * Cr[128]
+	- 3. * Ci[150];
+      Cr[150] =
+	Qr[130] * Cr[20] - Qi[130] * Ci[20]
+	+ Qr[18] * Cr[132] - Qi[18] * Ci[132]
+	+ Qr[6] * Cr[144] - Qi[6] * Ci[144]
+	- 2. * Cr[150];
+      Ci[150] =
+	Qr[130] * Ci[20] + Qi[130] * Cr[20]
+	+ Qr[18] * Ci[132] + Qi[18] * Cr[132]
+	+ Qr[6] * Ci[144] + Qi[6] * Cr[144]
+	- 2. * Ci[150];
+      Cr[150] =
+	Qr[2] * Cr[148] - Qi[2] * Ci[148]
+	- Cr[150];
+      Ci[150] =
+	Qr[2] * Ci[148] + Qi[2] * Cr[148]
+	- Ci[150];
+
+      Cr[152] =
+	Qr[152];
+      Ci[152] =
+	Qi[152];
+      Cr[152] =
+	Qr[136] * Cr[16] - Qi[136] * Ci[16]
+	+ Qr[24] * Cr[128] - Qi[24] * Ci[128]
+	- 2. * Cr[152];
+      Ci[152] =
+	Qr[136] * Ci[16] + Qi[136] * Cr[16]
+	+ Qr[24] * Ci[128] + Qi[24] * Cr[128]
+	- 2. * Ci[152];
+      Cr[152] =
+	Qr[8] * Cr[144] - Qi[8] * Ci[144]
+	- Cr[152];
+      Ci[152] =
+	Qr[8] * Ci[144] + Qi[8] * Cr[144]
+	- Ci[152];
+
+      Cr[154] =
+	Qr[154];
+      Ci[154] =
+	Qi[154];
+      Cr[154] =
+	Qr[146] * Cr[8] - Qi[146] * Ci[8]
+	+ Qr[138] * Cr[16] - Qi[138] * Ci[16]
+	+ Qr[26] * Cr[128] - Qi[26] * Ci[128]
+	- 3. * Cr[154];
+      Ci[154] =
+	Qr[146] * Ci[8] + Qi[146] * Cr[8]
+	+ Qr[138] * Ci[16] + Qi[138] * Cr[16]
+	+ Qr[26] * Ci[128] + Qi[26] * Cr[128]
+	- 3. * Ci[154];
+      Cr[154] =
+	Qr[130] * Cr[24] - Qi[130] * Ci[24]
+	+ Qr[18] * Cr[136] - Qi[18] * Ci[136]
+	+ Qr[10] * Cr[144] - Qi[10] * Ci[144]
+	- 2. * Cr[154];
+      Ci[154] =
+	Qr[130] * Ci[24] + Qi[130] * Cr[24]
+	+ Qr[18] * Ci[136] + Qi[18] * Cr[136]
+	+ Qr[10] * Ci[144] + Qi[10] * Cr[144]
+	- 2. * Ci[154];
+      Cr[154] =
+	Qr[2] * Cr[152] - Qi[2] * Ci[152]
+	- Cr[154];
+      Ci[154] =
+	Qr[2] * Ci[152] + Qi[2] * Cr[152]
+	- Ci[154];
+
+      Cr[156] =
+	Qr[156];
+      Ci[156] =
+	Qi[156];
+      Cr[156] =
+	Qr[148] * Cr[8] - Qi[148] * Ci[8]
+	+ Qr[140] * Cr[16] - Qi[140] * Ci[16]
+	+ Qr[28] * Cr[128] - Qi[28] * Ci[128]
+	- 3. * Cr[156];
+      Ci[156] =
+	Qr[148] * Ci[8] + Qi[148] * Cr[8]
+	+ Qr[140] * Ci[16] + Qi[140] * Cr[16]
+	+ Qr[28] * Ci[128] + Qi[28] * Cr[128]
+	- 3. * Ci[156];
+      Cr[156] =
+	Qr[132] * Cr[24] - Qi[132] * Ci[24]
+	+ Qr[20] * Cr[136] - Qi[20] * Ci[136]
+	+ Qr[12] * Cr[144] - Qi[12] * Ci[144]
+	- 2. * Cr[156];
+      Ci[156] =
+	Qr[132] * Ci[24] + Qi[132] * Cr[24]
+	+ Qr[20] * Ci[136] + Qi[20] * Cr[136]
+	+ Qr[12] * Ci[144] + Qi[12] * Cr[144]
+	- 2. * Ci[156];
+      Cr[156] =
+	Qr[4] * Cr[152] - Qi[4] * Ci[152]
+	- Cr[156];
+      Ci[156] =
+	Qr[4] * Ci[152] + Qi[4] * Cr[152]
+	- Ci[156];
+
+      Cr[158] =
+	Qr[158];
+      Ci[158] =
+	Qi[158];
+      Cr[158] =
+	Qr[154] * Cr[4] - Qi[154] * Ci[4]
+	+ Qr[150] * Cr[8] - Qi[150] * Ci[8]
+	+ Qr[142] * Cr[16] - Qi[142] * Ci[16]
+	+ Qr[30] * Cr[128] - Qi[30] * Ci[128]
+	- 4. * Cr[158];
+      Ci[158] =
+	Qr[154] * Ci[4] + Qi[154] * Cr[4]
+	+ Qr[150] * Ci[8] + Qi[150] * Cr[8]
+	+ Qr[142] * Ci[16] + Qi[142] * Cr[16]
+	+ Qr[30] * Ci[128] + Qi[30] * Cr[128]
+	- 4. * Ci[158];
+      Cr[158] =
+	Qr[146] * Cr[12] - Qi[146] * Ci[12]
+	+ Qr[138] * Cr[20] - Qi[138] * Ci[20]
+	+ Qr[134] * Cr[24] - Qi[134] * Ci[24]
+	+ Qr[26] * Cr[132] - Qi[26] * Ci[132]
+	+ Qr[22] * Cr[136] - Qi[22] * Ci[136]
+	+ Qr[14] * Cr[144] - Qi[14] * Ci[144]
+	- 3. * Cr[158];
+      Ci[158] =
+	Qr[146] * Ci[12] + Qi[146] * Cr[12]
+	+ Qr[138] * Ci[20] + Qi[138] * Cr[20]
+	+ Qr[134] * Ci[24] + Qi[134] * Cr[24]
+	+ Qr[26] * Ci[132] + Qi[26] * Cr[132]
+	+ Qr[22] * Ci[136] + Qi[22] * Cr[136]
+	+ Qr[14] * Ci[144] + Qi[14] * Cr[144]
+	- 3. * Ci[158];
+      Cr[158] =
+	Qr[130] * Cr[28] - Qi[130] * Ci[28]
+	+ Qr[18] * Cr[140] - Qi[18] * Ci[140]
+	+ Qr[10] * Cr[148] - Qi[10] * Ci[148]
+	+ Qr[6] * Cr[152] - Qi[6] * Ci[152]
+	- 2. * Cr[158];
+      Ci[158] =
+	Qr[130] * Ci[28] + Qi[130] * Cr[28]
+	+ Qr[18] * Ci[140] + Qi[18] * Cr[140]
+	+ Qr[10] * Ci[148] + Qi[10] * Cr[148]
+	+ Qr[6] * Ci[152] + Qi[6] * Cr[152]
+	- 2. * Ci[158];
+      Cr[158] =
+	Qr[2] * Cr[156] - Qi[2] * Ci[156]
+	- Cr[158];
+      Ci[158] =
+	Qr[2] * Ci[156] + Qi[2] * Cr[156]
+	- Ci[158];
+
+      Cr[160] =
+	Qr[160];
+      Ci[160] =
+	Qi[160];
+      Cr[160] =
+	Qr[32] * Cr[128] - Qi[32] * Ci[128]
+	- Cr[160];
+      Ci[160] =
+	Qr[32] * Ci[128] + Qi[32] * Cr[128]
+	- Ci[160];
+
+      Cr[162] =
+	Qr[162];
+      Ci[162] =
+	Qi[162];
+      Cr[162] =
+	Qr[130] * Cr[32] - Qi[130] * Ci[32]
+	+ Qr[34] * Cr[128] - Qi[34] * Ci[128]
+	- 2. * Cr[162];
+      Ci[162] =
+	Qr[130] * Ci[32] + Qi[130] * Cr[32]
+	+ Qr[34] * Ci[128] + Qi[34] * Cr[128]
+	- 2. * Ci[162];
+      Cr[162] =
+	Qr[2] * Cr[160] - Qi[2] * Ci[160]
+	- Cr[162];
+      Ci[162] =
+	Qr[2] * Ci[160] + Qi[2] * Cr[160]
+	- Ci[162];
+
+      Cr[164] =
+	Qr[164];
+      Ci[164] =
+	Qi[164];
+      Cr[164] =
+	Qr[132] * Cr[32] - Qi[132] * Ci[32]
+	+ Qr[36] * Cr[128] - Qi[36] * Ci[128]
+	- 2. * Cr[164];
+      Ci[164] =
+	Qr[132] * Ci[32] + Qi[132] * Cr[32]
+	+ Qr[36] * Ci[128] + Qi[36] * Cr[128]
+	- 2. * Ci[164];
+      Cr[164] =
+	Qr[4] * Cr[160] - Qi[4] * Ci[160]
+	- Cr[164];
+      Ci[164] =
+	Qr[4] * Ci[160] + Qi[4] * Cr[160]
+	- Ci[164];
+
+      Cr[166] =
+	Qr[166];
+      Ci[166] =
+	Qi[166];
+      Cr[166] =
+	Qr[162] * Cr[4] - Qi[162] * Ci[4]
+	+ Qr[134] * Cr[32] - Qi[134] * Ci[32]
+	+ Qr[38] * Cr[128] - Qi[38] * Ci[128]
+	- 3. * Cr[166];
+      Ci[166] =
+	Qr[162] * Ci[4] + Qi[162] * Cr[4]
+	+ Qr[134] * Ci[32] + Qi[134] * Cr[32]
+	+ Qr[38] * Ci[128] + Qi[38] * Cr[128]
+	- 3. * Ci[166];
+      Cr[166] =
+	Qr[130] * Cr[36] - Qi[130] * Ci[36]
+	+ Qr[34] * Cr[132] - Qi[34] * Ci[132]
+	+ Qr[6] * Cr[160] - Qi[6] * Ci[160]
+	- 2. * Cr[166];
+      Ci[166] =
+	Qr[130] * Ci[36] + Qi[130] * Cr[36]
+	+ Qr[34] * Ci[132] + Qi[34] * Cr[132]
+	+ Qr[6] * Ci[160] + Qi[6] * Cr[160]
+	- 2. * Ci[166];
+      Cr[166] =
+	Qr[2] * Cr[164] - Qi[2] * Ci[164]
+	- Cr[166];
+      Ci[166] =
+	Qr[2] * Ci[164] + Qi[2] * Cr[164]
+	- Ci[166];
+
+      Cr[168] =
+	Qr[168];
+      Ci[168] =
+	Qi[168];
+      Cr[168] =
+	Qr[136] * Cr[32] - Qi[136] * Ci[32]
+	+ Qr[40] * Cr[128] - Qi[40] * Ci[128]
+	- 2. * Cr[168];
+      Ci[168] =
+	Qr[136] * Ci[32] + Qi[136] * Cr[32]
+	+ Qr[40] * Ci[128] + Qi[40] * Cr[128]
+	- 2. * Ci[168];
+      Cr[168] =
+	Qr[8] * Cr[160] - Qi[8] * Ci[160]
+	- Cr[168];
+      Ci[168] =
+	Qr[8] * Ci[160] + Qi[8] * Cr[160]
+	- Ci[168];
+
+      Cr[170] =
+	Qr[170];
+      Ci[170] =
+	Qi[170];
+      Cr[170] =
+	Qr[162] * Cr[8] - Qi[162] * Ci[8]
+	+ Qr[138] * Cr[32] - Qi[138] * Ci[32]
+	+ Qr[42] * Cr[128] - Qi[42] * Ci[128]
+	- 3. * Cr[170];
+      Ci[170] =
+	Qr[162] * Ci[8] + Qi[162] * Cr[8]
+	+ Qr[138] * Ci[32] + Qi[138] * Cr[32]
+	+ Qr[42] * Ci[128] + Qi[42] * Cr[128]
+	- 3. * Ci[170];
+      Cr[170] =
+	Qr[130] * Cr[40] - Qi[130] * Ci[40]
+	+ Qr[34] * Cr[136] - Qi[34] * Ci[136]
+	+ Qr[10] * Cr[160] - Qi[10] * Ci[160]
+	- 2. * Cr[170];
+      Ci[170] =
+	Qr[130] * Ci[40] + Qi[130] * Cr[40]
+	+ Qr[34] * Ci[136] + Qi[34] * Cr[136]
+	+ Qr[10] * Ci[160] + Qi[10] * Cr[160]
+	- 2. * Ci[170];
+      Cr[170] =
+	Qr[2] * Cr[168] - Qi[2] * Ci[168]
+	- Cr[170];
+      Ci[170] =
+	Qr[2] * Ci[168] + Qi[2] * Cr[168]
+	- Ci[170];
+
+      Cr[172] =
+	Qr[172];
+      Ci[172] =
+	Qi[172];
+      Cr[172] =
+	Qr[164] * Cr[8] - Qi[164] * Ci[8]
+	+ Qr[140] * Cr[32] - Qi[140] * Ci[32]
+	+ Qr[44] * Cr[128] - Qi[44] * Ci[128]
+	- 3. * Cr[172];
+      Ci[172] =
+	Qr[164] * Ci[8] + Qi[164] * Cr[8]
+	+ Qr[140] * Ci[32] + Qi[140] * Cr[32]
+	+ Qr[44] * Ci[128] + Qi[44] * Cr[128]
+	- 3. * Ci[172];
+      Cr[172] =
+	Qr[132] * Cr[40] - Qi[132] * Ci[40]
+	+ Qr[36] * Cr[136] - Qi[36] * Ci[136]
+	+ Qr[12] * Cr[160] - Qi[12] * Ci[160]
+	- 2. * Cr[172];
+      Ci[172] =
+	Qr[132] * Ci[40] + Qi[132] * Cr[40]
+	+ Qr[36] * Ci[136] + Qi[36] * Cr[136]
+	+ Qr[12] * Ci[160] + Qi[12] * Cr[160]
+	- 2. * Ci[172];
+      Cr[172] =
+	Qr[4] * Cr[168] - Qi[4] * Ci[168]
+	- Cr[172];
+      Ci[172] =
+	Qr[4] * Ci[168] + Qi[4] * Cr[168]
+	- Ci[172];
+
+      Cr[174] =
+	Qr[174];
+      Ci[174] =
+	Qi[174];
+      Cr[174] =
+	Qr[170] * Cr[4] - Qi[170] * Ci[4]
+	+ Qr[166] * Cr[8] - Qi[166] * Ci[8]
+	+ Qr[142] * Cr[32] - Qi[142] * Ci[32]
+	+ Qr[46] * Cr[128] - Qi[46] * Ci[128]
+	- 4. * Cr[174];
+      Ci[174] =
+	Qr[170] * Ci[4] + Qi[170] * Cr[4]
+	+ Qr[166] * Ci[8] + Qi[166] * Cr[8]
+	+ Qr[142] * Ci[32] + Qi[142] * Cr[32]
+	+ Qr[46] * Ci[128] + Qi[46] * Cr[128]
+	- 4. * Ci[174];
+      Cr[174] =
+	Qr[162] * Cr[12] - Qi[162] * Ci[12]
+	+ Qr[138] * Cr[36] - Qi[138] * Ci[36]
+	+ Qr[134] * Cr[40] - Qi[134] * Ci[40]
+	+ Qr[42] * Cr[132] - Qi[42] * Ci[132]
+	+ Qr[38] * Cr[136] - Qi[38] * Ci[136]
+	+ Qr[14] * Cr[160] - Qi[14] * Ci[160]
+	- 3. * Cr[174];
+      Ci[174] =
+	Qr[162] * Ci[12] + Qi[162] * Cr[12]
+	+ Qr[138] * Ci[36] + Qi[138] * Cr[36]
+	+ Qr[134] * Ci[40] + Qi[134] * Cr[40]
+	+ Qr[42] * Ci[132] + Qi[42] * Cr[132]
+	+ Qr[38] * Ci[136] + Qi[38] * Cr[136]
+	+ Qr[14] * Ci[160] + Qi[14] * Cr[160]
+	- 3. * Ci[174];
+      Cr[174] =
+	Qr[130] * Cr[44] - Qi[130] * Ci[44]
+	+ Qr[34] * Cr[140] - Qi[34] * Ci[140]
+	+ Qr[10] * Cr[164] - Qi[10] * Ci[164]
+	+ Qr[6] * Cr[168] - Qi[6] * Ci[168]
+	- 2. * Cr[174];
+      Ci[174] =
+	Qr[130] * Ci[44] + Qi[130] * Cr[44]
+	+ Qr[34] * Ci[140] + Qi[34] * Cr[140]
+	+ Qr[10] * Ci[164] + Qi[10] * Cr[164]
+	+ Qr[6] * Ci[168] + Qi[6] * Cr[168]
+	- 2. * Ci[174];
+      Cr[174] =
+	Qr[2] * Cr[172] - Qi[2] * Ci[172]
+	- Cr[174];
+      Ci[174] =
+	Qr[2] * Ci[172] + Qi[2] * Cr[172]
+	- Ci[174];
+
+      Cr[176] =
+	Qr[176];
+      Ci[176] =
+	Qi[176];
+      Cr[176] =
+	Qr[144] * Cr[32] - Qi[144] * Ci[32]
+	+ Qr[48] * Cr[128] - Qi[48] * Ci[128]
+	- 2. * Cr[176];
+      Ci[176] =
+	Qr[144] * Ci[32] + Qi[144] * Cr[32]
+	+ Qr[48] * Ci[128] + Qi[48] * Cr[128]
+	- 2. * Ci[176];
+      Cr[176] =
+	Qr[16] * Cr[160] - Qi[16] * Ci[160]
+	- Cr[176];
+      Ci[176] =
+	Qr[16] * Ci[160] + Qi[16] * Cr[160]
+	- Ci[176];
+
+      Cr[178] =
+	Qr[178];
+      Ci[178] =
+	Qi[178];
+      Cr[178] =
+	Qr[162] * Cr[16] - Qi[162] * Ci[16]
+	+ Qr[146] * Cr[32] - Qi[146] * Ci[32]
+	+ Qr[50] * Cr[128] - Qi[50] * Ci[128]
+	- 3. * Cr[178];
+      Ci[178] =
+	Qr[162] * Ci[16] + Qi[162] * Cr[16]
+	+ Qr[146] * Ci[32] + Qi[146] * Cr[32]
+	+ Qr[50] * Ci[128] + Qi[50] * Cr[128]
+	- 3. * Ci[178];
+      Cr[178] =
+	Qr[130] * Cr[48] - Qi[130] * Ci[48]
+	+ Qr[34] * Cr[144] - Qi[34] * Ci[144]
+	+ Qr[18] * Cr[160] - Qi[18] * Ci[160]
+	- 2. * Cr[178];
+      Ci[178] =
+	Qr[130] * Ci[48] + Qi[130] * Cr[48]
+	+ Qr[34] * Ci[144] + Qi[34] * Cr[144]
+	+ Qr[18] * Ci[160] + Qi[18] * Cr[160]
+	- 2. * Ci[178];
+      Cr[178] =
+	Qr[2] * Cr[176] - Qi[2] * Ci[176]
+	- Cr[178];
+      Ci[178] =
+	Qr[2] * Ci[176] + Qi[2] * Cr[176]
+	- Ci[178];
+
+      Cr[180] =
+	Qr[180];
+      Ci[180] =
+	Qi[180];
+      Cr[180] =
+	Qr[164] * Cr[16] - Qi[164] * Ci[16]
+	+ Qr[148] * Cr[32] - Qi[148] * Ci[32]
+	+ Qr[52] * Cr[128] - Qi[52] * Ci[128]
+	- 3. * Cr[180];
+      Ci[180] =
+	Qr[164] * Ci[16] + Qi[164] * Cr[16]
+	+ Qr[148] * Ci[32] + Qi[148] * Cr[32]
+	+ Qr[52] * Ci[128] + Qi[52] * Cr[128]
+	- 3. * Ci[180];
+      Cr[180] =
+	Qr[132] * Cr[48] - Qi[132] * Ci[48]
+	+ Qr[36] * Cr[144] - Qi[36] * Ci[144]
+	+ Qr[20] * Cr[160] - Qi[20] * Ci[160]
+	- 2. * Cr[180];
+      Ci[180] =
+	Qr[132] * Ci[48] + Qi[132] * Cr[48]
+	+ Qr[36] * Ci[144] + Qi[36] * Cr[144]
+	+ Qr[20] * Ci[160] + Qi[20] * Cr[160]
+	- 2. * Ci[180];
+      Cr[180] =
+	Qr[4] * Cr[176] - Qi[4] * Ci[176]
+	- Cr[180];
+      Ci[180] =
+	Qr[4] * Ci[176] + Qi[4] * Cr[176]
+	- Ci[180];
+    }
+
+    /** Part 4 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part4(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[182] =
+	Qr[182];
+      Ci[182] =
+	Qi[182];
+      Cr[182] =
+	Qr[178] * Cr[4] - Qi[178] * Ci[4]
+	+ Qr[166] * Cr[16] - Qi[166] * Ci[16]
+	+ Qr[150] * Cr[32] - Qi[150] * Ci[32]
+	+ Qr[54] * Cr[128] - Qi[54] * Ci[128]
+	- 4. * Cr[182];
+      Ci[182] =
+	Qr[178] * Ci[4] + Qi[178] * Cr[4]
+	+ Qr[166] * Ci[16] + Qi[166] * Cr[16]
+	+ Qr[150] * Ci[32] + Qi[150] * Cr[32]
+	+ Qr[54] * Ci[128] + Qi[54] * Cr[128]
+	- 4. * Ci[182];
+      Cr[182] =
+	Qr[162] * Cr[20] - Qi[162] * Ci[20]
+	+ Qr[146] * Cr[36] - Qi[146] * Ci[36]
+	+ Qr[134] * Cr[48] - Qi[134] * Ci[48]
+	+ Qr[50] * Cr[132] - Qi[50] * Ci[132]
+	+ Qr[38] * Cr[144] - Qi[38] * Ci[144]
+	+ Qr[22] * Cr[160] - Qi[22] * Ci[160]
+	- 3. * Cr[182];
+      Ci[182] =
+	Qr[162] * Ci[20] + Qi[162] * Cr[20]
+	+ Qr[146] * Ci[36] + Qi[146] * Cr[36]
+	+ Qr[134] * Ci[48] + Qi[134] * Cr[48]
+	+ Qr[50] * Ci[132] + Qi[50] * Cr[132]
+	+ Qr[38] * Ci[144] + Qi[38] * Cr[144]
+	+ Qr[22] * Ci[160] + Qi[22] * Cr[160]
+	- 3. * Ci[182];
+      Cr[182] =
+	Qr[130] * Cr[52] - Qi[130] * Ci[52]
+	+ Qr[34] * Cr[148] - Qi[34] * Ci[148]
+	+ Qr[18] * Cr[164] - Qi[18] * Ci[164]
+	+ Qr[6] * Cr[176] - Qi[6] * Ci[176]
+	- 2. * Cr[182];
+      Ci[182] =
+	Qr[130] * Ci[52] + Qi[130] * Cr[52]
+	+ Qr[34] * Ci[148] + Qi[34] * Cr[148]
+	+ Qr[18] * Ci[164] + Qi[18] * Cr[164]
+	+ Qr[6] * Ci[176] + Qi[6] * Cr[176]
+	- 2. * Ci[182];
+      Cr[182] =
+	Qr[2] * Cr[180] - Qi[2] * Ci[180]
+	- Cr[182];
+      Ci[182] =
+	Qr[2] * Ci[180] + Qi[2] * Cr[180]
+	- Ci[182];
+
+      Cr[184] =
+	Qr[184];
+      Ci[184] =
+	Qi[184];
+      Cr[184] =
+	Qr[168] * Cr[16] - Qi[168] * Ci[16]
+	+ Qr[152] * Cr[32] - Qi[152] * Ci[32]
+	+ Qr[56] * Cr[128] - Qi[56] * Ci[128]
+	- 3. * Cr[184];
+      Ci[184] =
+	Qr[168] * Ci[16] + Qi[168] * Cr[16]
+	+ Qr[152] * Ci[32] + Qi[152] * Cr[32]
+	+ Qr[56] * Ci[128] + Qi[56] * Cr[128]
+	- 3. * Ci[184];
+      Cr[184] =
+	Qr[136] * Cr[48] - Qi[136] * Ci[48]
+	+ Qr[40] * Cr[144] - Qi[40] * Ci[144]
+	+ Qr[24] * Cr[160] - Qi[24] * Ci[160]
+	- 2. * Cr[184];
+      Ci[184] =
+	Qr[136] * Ci[48] + Qi[136] * Cr[48]
+	+ Qr[40] * Ci[144] + Qi[40] * Cr[144]
+	+ Qr[24] * Ci[160] + Qi[24] * Cr[160]
+	- 2. * Ci[184];
+      Cr[184] =
+	Qr[8] * Cr[176] - Qi[8] * Ci[176]
+	- Cr[184];
+      Ci[184] =
+	Qr[8] * Ci[176] + Qi[8] * Cr[176]
+	- Ci[184];
+
+      Cr[186] =
+	Qr[186];
+      Ci[186] =
+	Qi[186];
+      Cr[186] =
+	Qr[178] * Cr[8] - Qi[178] * Ci[8]
+	+ Qr[170] * Cr[16] - Qi[170] * Ci[16]
+	+ Qr[154] * Cr[32] - Qi[154] * Ci[32]
+	+ Qr[58] * Cr[128] - Qi[58] * Ci[128]
+	- 4. * Cr[186];
+      Ci[186] =
+	Qr[178] * Ci[8] + Qi[178] * Cr[8]
+	+ Qr[170] * Ci[16] + Qi[170] * Cr[16]
+	+ Qr[154] * Ci[32] + Qi[154] * Cr[32]
+	+ Qr[58] * Ci[128] + Qi[58] * Cr[128]
+	- 4. * Ci[186];
+      Cr[186] =
+	Qr[162] * Cr[24] - Qi[162] * Ci[24]
+	+ Qr[146] * Cr[40] - Qi[146] * Ci[40]
+	+ Qr[138] * Cr[48] - Qi[138] * Ci[48]
+	+ Qr[50] * Cr[136] - Qi[50] * Ci[136]
+	+ Qr[42] * Cr[144] - Qi[42] * Ci[144]
+	+ Qr[26] * Cr[160] - Qi[26] * Ci[160]
+	- 3. * Cr[186];
+      Ci[186] =
+	Qr[162] * Ci[24] + Qi[162] * Cr[24]
+	+ Qr[146] * Ci[40] + Qi[146] * Cr[40]
+	+ Qr[138] * Ci[48] + Qi[138] * Cr[48]
+	+ Qr[50] * Ci[136] + Qi[50] * Cr[136]
+	+ Qr[42] * Ci[144] + Qi[42] * Cr[144]
+	+ Qr[26] * Ci[160] + Qi[26] * Cr[160]
+	- 3. * Ci[186];
+      Cr[186] =
+	Qr[130] * Cr[56] - Qi[130] * Ci[56]
+	+ Qr[34] * Cr[152] - Qi[34] * Ci[152]
+	+ Qr[18] * Cr[168] - Qi[18] * Ci[168]
+	+ Qr[10] * Cr[176] - Qi[10] * Ci[176]
+	- 2. * Cr[186];
+      Ci[186] =
+	Qr[130] * Ci[56] + Qi[130] * Cr[56]
+	+ Qr[34] * Ci[152] + Qi[34] * Cr[152]
+	+ Qr[18] * Ci[168] + Qi[18] * Cr[168]
+	+ Qr[10] * Ci[176] + Qi[10] * Cr[176]
+	- 2. * Ci[186];
+      Cr[186] =
+	Qr[2] * Cr[184] - Qi[2] * Ci[184]
+	- Cr[186];
+      Ci[186] =
+	Qr[2] * Ci[184] + Qi[2] * Cr[184]
+	- Ci[186];
+
+      Cr[188] =
+	Qr[188];
+      Ci[188] =
+	Qi[188];
+      Cr[188] =
+	Qr[180] * Cr[8] - Qi[180] * Ci[8]
+	+ Qr[172] * Cr[16] - Qi[172] * Ci[16]
+	+ Qr[156] * Cr[32] - Qi[156] * Ci[32]
+	+ Qr[60] * Cr[128] - Qi[60] * Ci[128]
+	- 4. * Cr[188];
+      Ci[188] =
+	Qr[180] * Ci[8] + Qi[180] * Cr[8]
+	+ Qr[172] * Ci[16] + Qi[172] * Cr[16]
+	+ Qr[156] * Ci[32] + Qi[156] * Cr[32]
+	+ Qr[60] * Ci[128] + Qi[60] * Cr[128]
+	- 4. * Ci[188];
+      Cr[188] =
+	Qr[164] * Cr[24] - Qi[164] * Ci[24]
+	+ Qr[148] * Cr[40] - Qi[148] * Ci[40]
+	+ Qr[140] * Cr[48] - Qi[140] * Ci[48]
+	+ Qr[52] * Cr[136] - Qi[52] * Ci[136]
+	+ Qr[44] * Cr[144] - Qi[44] * Ci[144]
+	+ Qr[28] * Cr[160] - Qi[28] * Ci[160]
+	- 3. * Cr[188];
+      Ci[188] =
+	Qr[164] * Ci[24] + Qi[164] * Cr[24]
+	+ Qr[148] * Ci[40] + Qi[148] * Cr[40]
+	+ Qr[140] * Ci[48] + Qi[140] * Cr[48]
+	+ Qr[52] * Ci[136] + Qi[52] * Cr[136]
+	+ Qr[44] * Ci[144] + Qi[44] * Cr[144]
+	+ Qr[28] * Ci[160] + Qi[28] * Cr[160]
+	- 3. * Ci[188];
+      Cr[188] =
+	Qr[132] * Cr[56] - Qi[132] * Ci[56]
+	+ Qr[36] * Cr[152] - Qi[36] * Ci[152]
+	+ Qr[20] * Cr[168] - Qi[20] * Ci[168]
+	+ Qr[12] * Cr[176] - Qi[12] * Ci[176]
+	- 2. * Cr[188];
+      Ci[188] =
+	Qr[132] * Ci[56] + Qi[132] * Cr[56]
+	+ Qr[36] * Ci[152] + Qi[36] * Cr[152]
+	+ Qr[20] * Ci[168] + Qi[20] * Cr[168]
+	+ Qr[12] * Ci[176] + Qi[12] * Cr[176]
+	- 2. * Ci[188];
+      Cr[188] =
+	Qr[4] * Cr[184] - Qi[4] * Ci[184]
+	- Cr[188];
+      Ci[188] =
+	Qr[4] * Ci[184] + Qi[4] * Cr[184]
+	- Ci[188];
+
+      Cr[190] =
+	Qr[190];
+      Ci[190] =
+	Qi[190];
+      Cr[190] =
+	Qr[186] * Cr[4] - Qi[186] * Ci[4]
+	+ Qr[182] * Cr[8] - Qi[182] * Ci[8]
+	+ Qr[174] * Cr[16] - Qi[174] * Ci[16]
+	+ Qr[158] * Cr[32] - Qi[158] * Ci[32]
+	+ Qr[62] * Cr[128] - Qi[62] * Ci[128]
+	- 5. * Cr[190];
+      Ci[190] =
+	Qr[186] * Ci[4] + Qi[186] * Cr[4]
+	+ Qr[182] * Ci[8] + Qi[182] * Cr[8]
+	+ Qr[174] * Ci[16] + Qi[174] * Cr[16]
+	+ Qr[158] * Ci[32] + Qi[158] * Cr[32]
+	+ Qr[62] * Ci[128] + Qi[62] * Cr[128]
+	- 5. * Ci[190];
+      Cr[190] =
+	Qr[178] * Cr[12] - Qi[178] * Ci[12]
+	+ Qr[170] * Cr[20] - Qi[170] * Ci[20]
+	+ Qr[166] * Cr[24] - Qi[166] * Ci[24]
+	+ Qr[154] * Cr[36] - Qi[154] * Ci[36]
+	+ Qr[150] * Cr[40] - Qi[150] * Ci[40]
+	+ Qr[142] * Cr[48] - Qi[142] * Ci[48]
+	+ Qr[58] * Cr[132] - Qi[58] * Ci[132]
+	+ Qr[54] * Cr[136] - Qi[54] * Ci[136]
+	+ Qr[46] * Cr[144] - Qi[46] * Ci[144]
+	+ Qr[30] * Cr[160] - Qi[30] * Ci[160]
+	- 4. * Cr[190];
+      Ci[190] =
+	Qr[178] * Ci[12] + Qi[178] * Cr[12]
+	+ Qr[170] * Ci[20] + Qi[170] * Cr[20]
+	+ Qr[166] * Ci[24] + Qi[166] * Cr[24]
+	+ Qr[154] * Ci[36] + Qi[154] * Cr[36]
+	+ Qr[150] * Ci[40] + Qi[150] * Cr[40]
+	+ Qr[142] * Ci[48] + Qi[142] * Cr[48]
+	+ Qr[58] * Ci[132] + Qi[58] * Cr[132]
+	+ Qr[54] * Ci[136] + Qi[54] * Cr[136]
+	+ Qr[46] * Ci[144] + Qi[46] * Cr[144]
+	+ Qr[30] * Ci[160] + Qi[30] * Cr[160]
+	- 4. * Ci[190];
+      Cr[190] =
+	Qr[162] * Cr[28] - Qi[162] * Ci[28]
+	+ Qr[146] * Cr[44] - Qi[146] * Ci[44]
+	+ Qr[138] * Cr[52] - Qi[138] * Ci[52]
+	+ Qr[134] * Cr[56] - Qi[134] * Ci[56]
+	+ Qr[50] * Cr[140] - Qi[50] * Ci[140]
+	+ Qr[42] * Cr[148] - Qi[42] * Ci[148]
+	+ Qr[38] * Cr[152] - Qi[38] * Ci[152]
+	+ Qr[26] * Cr[164] - Qi[26] * Ci[164]
+	+ Qr[22] * Cr[168] - Qi[22] * Ci[168]
+	+ Qr[14] * Cr[176] - Qi[14] * Ci[176]
+	- 3. * Cr[190];
+      Ci[190] =
+	Qr[162] * Ci[28] + Qi[162] * Cr[28]
+	+ Qr[146] * Ci[44] + Qi[146] * Cr[44]
+	+ Qr[138] * Ci[52] + Qi[138] * Cr[52]
+	+ Qr[134] * Ci[56] + Qi[134] * Cr[56]
+	+ Qr[50] * Ci[140] + Qi[50] * Cr[140]
+	+ Qr[42] * Ci[148] + Qi[42] * Cr[148]
+	+ Qr[38] * Ci[152] + Qi[38] * Cr[152]
+	+ Qr[26] * Ci[164] + Qi[26] * Cr[164]
+	+ Qr[22] * Ci[168] + Qi[22] * Cr[168]
+	+ Qr[14] * Ci[176] + Qi[14] * Cr[176]
+	- 3. * Ci[190];
+      Cr[190] =
+	Qr[130] * Cr[60] - Qi[130] * Ci[60]
+	+ Qr[34] * Cr[156] - Qi[34] * Ci[156]
+	+ Qr[18] * Cr[172] - Qi[18] * Ci[172]
+	+ Qr[10] * Cr[180] - Qi[10] * Ci[180]
+	+ Qr[6] * Cr[184] - Qi[6] * Ci[184]
+	- 2. * Cr[190];
+      Ci[190] =
+	Qr[130] * Ci[60] + Qi[130] * Cr[60]
+	+ Qr[34] * Ci[156] + Qi[34] * Cr[156]
+	+ Qr[18] * Ci[172] + Qi[18] * Cr[172]
+	+ Qr[10] * Ci[180] + Qi[10] * Cr[180]
+	+ Qr[6] * Ci[184] + Qi[6] * Cr[184]
+	- 2. * Ci[190];
+      Cr[190] =
+	Qr[2] * Cr[188] - Qi[2] * Ci[188]
+	- Cr[190];
+      Ci[190] =
+	Qr[2] * Ci[188] + Qi[2] * Cr[188]
+	- Ci[190];
+
+      Cr[192] =
+	Qr[192];
+      Ci[192] =
+	Qi[192];
+      Cr[192] =
+	Qr[64] * Cr[128] - Qi[64] * Ci[128]
+	- Cr[192];
+      Ci[192] =
+	Qr[64] * Ci[128] + Qi[64] * Cr[128]
+	- Ci[192];
+
+      Cr[194] =
+	Qr[194];
+      Ci[194] =
+	Qi[194];
+      Cr[194] =
+	Qr[130] * Cr[64] - Qi[130] * Ci[64]
+	+ Qr[66] * Cr[128] - Qi[66] * Ci[128]
+	- 2. * Cr[194];
+      Ci[194] =
+	Qr[130] * Ci[64] + Qi[130] * Cr[64]
+	+ Qr[66] * Ci[128] + Qi[66] * Cr[128]
+	- 2. * Ci[194];
+      Cr[194] =
+	Qr[2] * Cr[192] - Qi[2] * Ci[192]
+	- Cr[194];
+      Ci[194] =
+	Qr[2] * Ci[192] + Qi[2] * Cr[192]
+	- Ci[194];
+
+      Cr[196] =
+	Qr[196];
+      Ci[196] =
+	Qi[196];
+      Cr[196] =
+	Qr[132] * Cr[64] - Qi[132] * Ci[64]
+	+ Qr[68] * Cr[128] - Qi[68] * Ci[128]
+	- 2. * Cr[196];
+      Ci[196] =
+	Qr[132] * Ci[64] + Qi[132] * Cr[64]
+	+ Qr[68] * Ci[128] + Qi[68] * Cr[128]
+	- 2. * Ci[196];
+      Cr[196] =
+	Qr[4] * Cr[192] - Qi[4] * Ci[192]
+	- Cr[196];
+      Ci[196] =
+	Qr[4] * Ci[192] + Qi[4] * Cr[192]
+	- Ci[196];
+
+      Cr[198] =
+	Qr[198];
+      Ci[198] =
+	Qi[198];
+      Cr[198] =
+	Qr[194] * Cr[4] - Qi[194] * Ci[4]
+	+ Qr[134] * Cr[64] - Qi[134] * Ci[64]
+	+ Qr[70] * Cr[128] - Qi[70] * Ci[128]
+	- 3. * Cr[198];
+      Ci[198] =
+	Qr[194] * Ci[4] + Qi[194] * Cr[4]
+	+ Qr[134] * Ci[64] + Qi[134] * Cr[64]
+	+ Qr[70] * Ci[128] + Qi[70] * Cr[128]
+	- 3. * Ci[198];
+      Cr[198] =
+	Qr[130] * Cr[68] - Qi[130] * Ci[68]
+	+ Qr[66] * Cr[132] - Qi[66] * Ci[132]
+	+ Qr[6] * Cr[192] - Qi[6] * Ci[192]
+	- 2. * Cr[198];
+      Ci[198] =
+	Qr[130] * Ci[68] + Qi[130] * Cr[68]
+	+ Qr[66] * Ci[132] + Qi[66] * Cr[132]
+	+ Qr[6] * Ci[192] + Qi[6] * Cr[192]
+	- 2. * Ci[198];
+      Cr[198] =
+	Qr[2] * Cr[196] - Qi[2] * Ci[196]
+	- Cr[198];
+      Ci[198] =
+	Qr[2] * Ci[196] + Qi[2] * Cr[196]
+	- Ci[198];
+
+      Cr[200] =
+	Qr[200];
+      Ci[200] =
+	Qi[200];
+      Cr[200] =
+	Qr[136] * Cr[64] - Qi[136] * Ci[64]
+	+ Qr[72] * Cr[128] - Qi[72] * Ci[128]
+	- 2. * Cr[200];
+      Ci[200] =
+	Qr[136] * Ci[64] + Qi[136] * Cr[64]
+	+ Qr[72] * Ci[128] + Qi[72] * Cr[128]
+	- 2. * Ci[200];
+      Cr[200] =
+	Qr[8] * Cr[192] - Qi[8] * Ci[192]
+	- Cr[200];
+      Ci[200] =
+	Qr[8] * Ci[192] + Qi[8] * Cr[192]
+	- Ci[200];
+
+      Cr[202] =
+	Qr[202];
+      Ci[202] =
+	Qi[202];
+      Cr[202] =
+	Qr[194] * Cr[8] - Qi[194] * Ci[8]
+	+ Qr[138] * Cr[64] - Qi[138] * Ci[64]
+	+ Qr[74] * Cr[128] - Qi[74] * Ci[128]
+	- 3. * Cr[202];
+      Ci[202] =
+	Qr[194] * Ci[8] + Qi[194] * Cr[8]
+	+ Qr[138] * Ci[64] + Qi[138] * Cr[64]
+	+ Qr[74] * Ci[128] + Qi[74] * Cr[128]
+	- 3. * Ci[202];
+      Cr[202] =
+	Qr[130] * Cr[72] - Qi[130] * Ci[72]
+	+ Qr[66] * Cr[136] - Qi[66] * Ci[136]
+	+ Qr[10] * Cr[192] - Qi[10] * Ci[192]
+	- 2. * Cr[202];
+      Ci[202] =
+	Qr[130] * Ci[72] + Qi[130] * Cr[72]
+	+ Qr[66] * Ci[136] + Qi[66] * Cr[136]
+	+ Qr[10] * Ci[192] + Qi[10] * Cr[192]
+	- 2. * Ci[202];
+      Cr[202] =
+	Qr[2] * Cr[200] - Qi[2] * Ci[200]
+	- Cr[202];
+      Ci[202] =
+	Qr[2] * Ci[200] + Qi[2] * Cr[200]
+	- Ci[202];
+
+      Cr[204] =
+	Qr[204];
+      Ci[204] =
+	Qi[204];
+      Cr[204] =
+	Qr[196] * Cr[8] - Qi[196] * Ci[8]
+	+ Qr[140] * Cr[64] - Qi[140] * Ci[64]
+	+ Qr[76] * Cr[128] - Qi[76] * Ci[128]
+	- 3. * Cr[204];
+      Ci[204] =
+	Qr[196] * Ci[8] + Qi[196] * Cr[8]
+	+ Qr[140] * Ci[64] + Qi[140] * Cr[64]
+	+ Qr[76] * Ci[128] + Qi[76] * Cr[128]
+	- 3. * Ci[204];
+      Cr[204] =
+	Qr[132] * Cr[72] - Qi[132] * Ci[72]
+	+ Qr[68] * Cr[136] - Qi[68] * Ci[136]
+	+ Qr[12] * Cr[192] - Qi[12] * Ci[192]
+	- 2. * Cr[204];
+      Ci[204] =
+	Qr[132] * Ci[72] + Qi[132] * Cr[72]
+	+ Qr[68] * Ci[136] + Qi[68] * Cr[136]
+	+ Qr[12] * Ci[192] + Qi[12] * Cr[192]
+	- 2. * Ci[204];
+      Cr[204] =
+	Qr[4] * Cr[200] - Qi[4] * Ci[200]
+	- Cr[204];
+      Ci[204] =
+	Qr[4] * Ci[200] + Qi[4] * Cr[200]
+	- Ci[204];
+
+      Cr[206] =
+	Qr[206];
+      Ci[206] =
+	Qi[206];
+      Cr[206] =
+	Qr[202] * Cr[4] - Qi[202] * Ci[4]
+	+ Qr[198] * Cr[8] - Qi[198] * Ci[8]
+	+ Qr[142] * Cr[64] - Qi[142] * Ci[64]
+	+ Qr[78] * Cr[128] - Qi[78] * Ci[128]
+	- 4. * Cr[206];
+      Ci[206] =
+	Qr[202] * Ci[4] + Qi[202] * Cr[4]
+	+ Qr[198] * Ci[8] + Qi[198] * Cr[8]
+	+ Qr[142] * Ci[64] + Qi[142] * Cr[64]
+	+ Qr[78] * Ci[128] + Qi[78] * Cr[128]
+	- 4. * Ci[206];
+      Cr[206] =
+	Qr[194] * Cr[12] - Qi[194] * Ci[12]
+	+ Qr[138] * Cr[68] - Qi[138] * Ci[68]
+	+ Qr[134] * Cr[72] - Qi[134] * Ci[72]
+	+ Qr[74] * Cr[132] - Qi[74] * Ci[132]
+	+ Qr[70] * Cr[136] - Qi[70] * Ci[136]
+	+ Qr[14] * Cr[192] - Qi[14] * Ci[192]
+	- 3. * Cr[206];
+      Ci[206] =
+	Qr[194] * Ci[12] + Qi[194] * Cr[12]
+	+ Qr[138] * Ci[68] + Qi[138] * Cr[68]
+	+ Qr[134] * Ci[72] + Qi[134] * Cr[72]
+	+ Qr[74] * Ci[132] + Qi[74] * Cr[132]
+	+ Qr[70] * Ci[136] + Qi[70] * Cr[136]
+	+ Qr[14] * Ci[192] + Qi[14] * Cr[192]
+	- 3. * Ci[206];
+      Cr[206] =
+	Qr[130] * Cr[76] - Qi[130] * Ci[76]
+	+ Qr[66] * Cr[140] - Qi[66] * Ci[140]
+	+ Qr[10] * Cr[196] - Qi[10] * Ci[196]
+	+ Qr[6] * Cr[200] - Qi[6] * Ci[200]
+	- 2. * Cr[206];
+      Ci[206] =
+	Qr[130] * Ci[76] + Qi[130] * Cr[76]
+	+ Qr[66] * Ci[140] + Qi[66] * Cr[140]
+	+ Qr[10] * Ci[196] + Qi[10] * Cr[196]
+	+ Qr[6] * Ci[200] + Qi[6] * Cr[200]
+	- 2. * Ci[206];
+      Cr[206] =
+	Qr[2] * Cr[204] - Qi[2] * Ci[204]
+	- Cr[206];
+      Ci[206] =
+	Qr[2] * Ci[204] + Qi[2] * Cr[204]
+	- Ci[206];
+    }
+
+    /** Part 5 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part5(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[208] =
+	Qr[208];
+      Ci[208] =
+	Qi[208];
+      Cr[208] =
+	Qr[144] * Cr[64] - Qi[144] * Ci[64]
+	+ Qr[80] * Cr[128] - Qi[80] * Ci[128]
+	- 2. * Cr[208];
+      Ci[208] =
+	Qr[144] * Ci[64] + Qi[144] * Cr[64]
+	+ Qr[80] * Ci[128] + Qi[80] * Cr[128]
+	- 2. * Ci[208];
+      Cr[208] =
+	Qr[16] * Cr[192] - Qi[16] * Ci[192]
+	- Cr[208];
+      Ci[208] =
+	Qr[16] * Ci[192] + Qi[16] * Cr[192]
+	- Ci[208];
+
+      Cr[210] =
+	Qr[210];
+      Ci[210] =
+	Qi[210];
+      Cr[210] =
+	Qr[194] * Cr[16] - Qi[194] * Ci[16]
+	+ Qr[146] * Cr[64] - Qi[146] * Ci[64]
+	+ Qr[82] * Cr[128] - Qi[82] * Ci[128]
+	- 3. * Cr[210];
+      Ci[210] =
+	Qr[194] * Ci[16] + Qi[194] * Cr[16]
+	+ Qr[146] * Ci[64] + Qi[146] * Cr[64]
+	+ Qr[82] * Ci[128] + Qi[82] * Cr[128]
+	- 3. * Ci[210];
+      Cr[210] =
+	Qr[130] * Cr[80] - Qi[130] * Ci[80]
+	+ Qr[66] * Cr[144] - Qi[66] * Ci[144]
+	+ Qr[18] * Cr[192] - Qi[18] * Ci[192]
+	- 2. * Cr[210];
+      Ci[210] =
+	Qr[130] * Ci[80] + Qi[130] * Cr[80]
+	+ Qr[66] * Ci[144] + Qi[66] * Cr[144]
+	+ Qr[18] * Ci[192] + Qi[18] * Cr[192]
+	- 2. * Ci[210];
+      Cr[210] =
+	Qr[2] * Cr[208] - Qi[2] * Ci[208]
+	- Cr[210];
+      Ci[210] =
+	Qr[2] * Ci[208] + Qi[2] * Cr[208]
+	- Ci[210];
+
+      Cr[212] =
+	Qr[212];
+      Ci[212] =
+	Qi[212];
+      Cr[212] =
+	Qr[196] * Cr[16] - Qi[196] * Ci[16]
+	+ Qr[148] * Cr[64] - Qi[148] * Ci[64]
+	+ Qr[84] * Cr[128] - Qi[84] * Ci[128]
+	- 3. * Cr[212];
+      Ci[212] =
+	Qr[196] * Ci[16] + Qi[196] * Cr[16]
+	+ Qr[148] * Ci[64] + Qi[148] * Cr[64]
+	+ Qr[84] * Ci[128] + Qi[84] * Cr[128]
+	- 3. * Ci[212];
+      Cr[212] =
+	Qr[132] * Cr[80] - Qi[132] * Ci[80]
+	+ Qr[68] * Cr[144] - Qi[68] * Ci[144]
+	+ Qr[20] * Cr[192] - Qi[20] * Ci[192]
+	- 2. * Cr[212];
+      Ci[212] =
+	Qr[132] * Ci[80] + Qi[132] * Cr[80]
+	+ Qr[68] * Ci[144] + Qi[68] * Cr[144]
+	+ Qr[20] * Ci[192] + Qi[20] * Cr[192]
+	- 2. * Ci[212];
+      Cr[212] =
+	Qr[4] * Cr[208] - Qi[4] * Ci[208]
+	- Cr[212];
+      Ci[212] =
+	Qr[4] * Ci[208] + Qi[4] * Cr[208]
+	- Ci[212];
+
+      Cr[214] =
+	Qr[214];
+      Ci[214] =
+	Qi[214];
+      Cr[214] =
+	Qr[210] * Cr[4] - Qi[210] * Ci[4]
+	+ Qr[198] * Cr[16] - Qi[198] * Ci[16]
+	+ Qr[150] * Cr[64] - Qi[150] * Ci[64]
+	+ Qr[86] * Cr[128] - Qi[86] * Ci[128]
+	- 4. * Cr[214];
+      Ci[214] =
+	Qr[210] * Ci[4] + Qi[210] * Cr[4]
+	+ Qr[198] * Ci[16] + Qi[198] * Cr[16]
+	+ Qr[150] * Ci[64] + Qi[150] * Cr[64]
+	+ Qr[86] * Ci[128] + Qi[86] * Cr[128]
+	- 4. * Ci[214];
+      Cr[214] =
+	Qr[194] * Cr[20] - Qi[194] * Ci[20]
+	+ Qr[146] * Cr[68] - Qi[146] * Ci[68]
+	+ Qr[134] * Cr[80] - Qi[134] * Ci[80]
+	+ Qr[82] * Cr[132] - Qi[82] * Ci[132]
+	+ Qr[70] * Cr[144] - Qi[70] * Ci[144]
+	+ Qr[22] * Cr[192] - Qi[22] * Ci[192]
+	- 3. * Cr[214];
+      Ci[214] =
+	Qr[194] * Ci[20] + Qi[194] * Cr[20]
+	+ Qr[146] * Ci[68] + Qi[146] * Cr[68]
+	+ Qr[134] * Ci[80] + Qi[134] * Cr[80]
+	+ Qr[82] * Ci[132] + Qi[82] * Cr[132]
+	+ Qr[70] * Ci[144] + Qi[70] * Cr[144]
+	+ Qr[22] * Ci[192] + Qi[22] * Cr[192]
+	- 3. * Ci[214];
+      Cr[214] =
+	Qr[130] * Cr[84] - Qi[130] * Ci[84]
+	+ Qr[66] * Cr[148] - Qi[66] * Ci[148]
+	+ Qr[18] * Cr[196] - Qi[18] * Ci[196]
+	+ Qr[6] * Cr[208] - Qi[6] * Ci[208]
+	- 2. * Cr[214];
+      Ci[214] =
+	Qr[130] * Ci[84] + Qi[130] * Cr[84]
+	+ Qr[66] * Ci[148] + Qi[66] * Cr[148]
+	+ Qr[18] * Ci[196] + Qi[18] * Cr[196]
+	+ Qr[6] * Ci[208] + Qi[6] * Cr[208]
+	- 2. * Ci[214];
+      Cr[214] =
+	Qr[2] * Cr[212] - Qi[2] * Ci[212]
+	- Cr[214];
+      Ci[214] =
+	Qr[2] * Ci[212] + Qi[2] * Cr[212]
+	- Ci[214];
+
+      Cr[216] =
+	Qr[216];
+      Ci[216] =
+	Qi[216];
+      Cr[216] =
+	Qr[200] * Cr[16] - Qi[200] * Ci[16]
+	+ Qr[152] * Cr[64] - Qi[152] * Ci[64]
+	+ Qr[88] * Cr[128] - Qi[88] * Ci[128]
+	- 3. * Cr[216];
+      Ci[216] =
+	Qr[200] * Ci[16] + Qi[200] * Cr[16]
+	+ Qr[152] * Ci[64] + Qi[152] * Cr[64]
+	+ Qr[88] * Ci[128] + Qi[88] * Cr[128]
+	- 3. * Ci[216];
+      Cr[216] =
+	Qr[136] * Cr[80] - Qi[136] * Ci[80]
+	+ Qr[72] * Cr[144] - Qi[72] * Ci[144]
+	+ Qr[24] * Cr[192] - Qi[24] * Ci[192]
+	- 2. * Cr[216];
+      Ci[216] =
+	Qr[136] * Ci[80] + Qi[136] * Cr[80]
+	+ Qr[72] * Ci[144] + Qi[72] * Cr[144]
+	+ Qr[24] * Ci[192] + Qi[24] * Cr[192]
+	- 2. * Ci[216];
+      Cr[216] =
+	Qr[8] * Cr[208] - Qi[8] * Ci[208]
+	- Cr[216];
+      Ci[216] =
+	Qr[8] * Ci[208] + Qi[8] * Cr[208]
+	- Ci[216];
+
+      Cr[218] =
+	Qr[218];
+      Ci[218] =
+	Qi[218];
+      Cr[218] =
+	Qr[210] * Cr[8] - Qi[210] * Ci[8]
+	+ Qr[202] * Cr[16] - Qi[202] * Ci[16]
+	+ Qr[154] * Cr[64] - Qi[154] * Ci[64]
+	+ Qr[90] * Cr[128] - Qi[90] * Ci[128]
+	- 4. * Cr[218];
+      Ci[218] =
+	Qr[210] * Ci[8] + Qi[210] * Cr[8]
+	+ Qr[202] * Ci[16] + Qi[202] * Cr[16]
+	+ Qr[154] * Ci[64] + Qi[154] * Cr[64]
+	+ Qr[90] * Ci[128] + Qi[90] * Cr[128]
+	- 4. * Ci[218];
+      Cr[218] =
+	Qr[194] * Cr[24] - Qi[194] * Ci[24]
+	+ Qr[146] * Cr[72] - Qi[146] * Ci[72]
+	+ Qr[138] * Cr[80] - Qi[138] * Ci[80]
+	+ Qr[82] * Cr[136] - Qi[82] * Ci[136]
+	+ Qr[74] * Cr[144] - Qi[74] * Ci[144]
+	+ Qr[26] * Cr[192] - Qi[26] * Ci[192]
+	- 3. * Cr[218];
+      Ci[218] =
+	Qr[194] * Ci[24] + Qi[194] * Cr[24]
+	+ Qr[146] * Ci[72] + Qi[146] * Cr[72]
+	+ Qr[138] * Ci[80] + Qi[138] * Cr[80]
+	+ Qr[82] * Ci[136] + Qi[82] * Cr[136]
+	+ Qr[74] * Ci[144] + Qi[74] * Cr[144]
+	+ Qr[26] * Ci[192] + Qi[26] * Cr[192]
+	- 3. * Ci[218];
+      Cr[218] =
+	Qr[130] * Cr[88] - Qi[130] * Ci[88]
+	+ Qr[66] * Cr[152] - Qi[66] * Ci[152]
+	+ Qr[18] * Cr[200] - Qi[18] * Ci[200]
+	+ Qr[10] * Cr[208] - Qi[10] * Ci[208]
+	- 2. * Cr[218];
+      Ci[218] =
+	Qr[130] * Ci[88] + Qi[130] * Cr[88]
+	+ Qr[66] * Ci[152] + Qi[66] * Cr[152]
+	+ Qr[18] * Ci[200] + Qi[18] * Cr[200]
+	+ Qr[10] * Ci[208] + Qi[10] * Cr[208]
+	- 2. * Ci[218];
+      Cr[218] =
+	Qr[2] * Cr[216] - Qi[2] * Ci[216]
+	- Cr[218];
+      Ci[218] =
+	Qr[2] * Ci[216] + Qi[2] * Cr[216]
+	- Ci[218];
+
+      Cr[220] =
+	Qr[220];
+      Ci[220] =
+	Qi[220];
+      Cr[220] =
+	Qr[212] * Cr[8] - Qi[212] * Ci[8]
+	+ Qr[204] * Cr[16] - Qi[204] * Ci[16]
+	+ Qr[156] * Cr[64] - Qi[156] * Ci[64]
+	+ Qr[92] * Cr[128] - Qi[92] * Ci[128]
+	- 4. * Cr[220];
+      Ci[220] =
+	Qr[212] * Ci[8] + Qi[212] * Cr[8]
+	+ Qr[204] * Ci[16] + Qi[204] * Cr[16]
+	+ Qr[156] * Ci[64] + Qi[156] * Cr[64]
+	+ Qr[92] * Ci[128] + Qi[92] * Cr[128]
+	- 4. * Ci[220];
+      Cr[220] =
+	Qr[196] * Cr[24] - Qi[196] * Ci[24]
+	+ Qr[148] * Cr[72] - Qi[148] * Ci[72]
+	+ Qr[140] * Cr[80] - Qi[140] * Ci[80]
+	+ Qr[84] * Cr[136] - Qi[84] * Ci[136]
+	+ Qr[76] * Cr[144] - Qi[76] * Ci[144]
+	+ Qr[28] * Cr[192] - Qi[28] * Ci[192]
+	- 3. * Cr[220];
+      Ci[220] =
+	Qr[196] * Ci[24] + Qi[196] * Cr[24]
+	+ Qr[148] * Ci[72] + Qi[148] * Cr[72]
+	+ Qr[140] * Ci[80] + Qi[140] * Cr[80]
+	+ Qr[84] * Ci[136] + Qi[84] * Cr[136]
+	+ Qr[76] * Ci[144] + Qi[76] * Cr[144]
+	+ Qr[28] * Ci[192] + Qi[28] * Cr[192]
+	- 3. * Ci[220];
+      Cr[220] =
+	Qr[132] * Cr[88] - Qi[132] * Ci[88]
+	+ Qr[68] * Cr[152] - Qi[68] * Ci[152]
+	+ Qr[20] * Cr[200] - Qi[20] * Ci[200]
+	+ Qr[12] * Cr[208] - Qi[12] * Ci[208]
+	- 2. * Cr[220];
+      Ci[220] =
+	Qr[132] * Ci[88] + Qi[132] * Cr[88]
+	+ Qr[68] * Ci[152] + Qi[68] * Cr[152]
+	+ Qr[20] * Ci[200] + Qi[20] * Cr[200]
+	+ Qr[12] * Ci[208] + Qi[12] * Cr[208]
+	- 2. * Ci[220];
+      Cr[220] =
+	Qr[4] * Cr[216] - Qi[4] * Ci[216]
+	- Cr[220];
+      Ci[220] =
+	Qr[4] * Ci[216] + Qi[4] * Cr[216]
+	- Ci[220];
+
+      Cr[222] =
+	Qr[222];
+      Ci[222] =
+	Qi[222];
+      Cr[222] =
+	Qr[218] * Cr[4] - Qi[218] * Ci[4]
+	+ Qr[214] * Cr[8] - Qi[214] * Ci[8]
+	+ Qr[206] * Cr[16] - Qi[206] * Ci[16]
+	+ Qr[158] * Cr[64] - Qi[158] * Ci[64]
+	+ Qr[94] * Cr[128] - Qi[94] * Ci[128]
+	- 5. * Cr[222];
+      Ci[222] =
+	Qr[218] * Ci[4] + Qi[218] * Cr[4]
+	+ Qr[214] * Ci[8] + Qi[214] * Cr[8]
+	+ Qr[206] * Ci[16] + Qi[206] * Cr[16]
+	+ Qr[158] * Ci[64] + Qi[158] * Cr[64]
+	+ Qr[94] * Ci[128] + Qi[94] * Cr[128]
+	- 5. * Ci[222];
+      Cr[222] =
+	Qr[210] * Cr[12] - Qi[210] * Ci[12]
+	+ Qr[202] * Cr[20] - Qi[202] * Ci[20]
+	+ Qr[198] * Cr[24] - Qi[198] * Ci[24]
+	+ Qr[154] * Cr[68] - Qi[154] * Ci[68]
+	+ Qr[150] * Cr[72] - Qi[150] * Ci[72]
+	+ Qr[142] * Cr[80] - Qi[142] * Ci[80]
+	+ Qr[90] * Cr[132] - Qi[90] * Ci[132]
+	+ Qr[86] * Cr[136] - Qi[86] * Ci[136]
+	+ Qr[78] * Cr[144] - Qi[78] * Ci[144]
+	+ Qr[30] * Cr[192] - Qi[30] * Ci[192]
+	- 4. * Cr[222];
+      Ci[222] =
+	Qr[210] * Ci[12] + Qi[210] * Cr[12]
+	+ Qr[202] * Ci[20] + Qi[202] * Cr[20]
+	+ Qr[198] * Ci[24] + Qi[198] * Cr[24]
+	+ Qr[154] * Ci[68] + Qi[154] * Cr[68]
+	+ Qr[150] * Ci[72] + Qi[150] * Cr[72]
+	+ Qr[142] * Ci[80] + Qi[142] * Cr[80]
+	+ Qr[90] * Ci[132] + Qi[90] * Cr[132]
+	+ Qr[86] * Ci[136] + Qi[86] * Cr[136]
+	+ Qr[78] * Ci[144] + Qi[78] * Cr[144]
+	+ Qr[30] * Ci[192] + Qi[30] * Cr[192]
+	- 4. * Ci[222];
+      Cr[222] =
+	Qr[194] * Cr[28] - Qi[194] * Ci[28]
+	+ Qr[146] * Cr[76] - Qi[146] * Ci[76]
+	+ Qr[138] * Cr[84] - Qi[138] * Ci[84]
+	+ Qr[134] * Cr[88] - Qi[134] * Ci[88]
+	+ Qr[82] * Cr[140] - Qi[82] * Ci[140]
+	+ Qr[74] * Cr[148] - Qi[74] * Ci[148]
+	+ Qr[70] * Cr[152] - Qi[70] * Ci[152]
+	+ Qr[26] * Cr[196] - Qi[26] * Ci[196]
+	+ Qr[22] * Cr[200] - Qi[22] * Ci[200]
+	+ Qr[14] * Cr[208] - Qi[14] * Ci[208]
+	- 3. * Cr[222];
+      Ci[222] =
+	Qr[194] * Ci[28] + Qi[194] * Cr[28]
+	+ Qr[146] * Ci[76] + Qi[146] * Cr[76]
+	+ Qr[138] * Ci[84] + Qi[138] * Cr[84]
+	+ Qr[134] * Ci[88] + Qi[134] * Cr[88]
+	+ Qr[82] * Ci[140] + Qi[82] * Cr[140]
+	+ Qr[74] * Ci[148] + Qi[74] * Cr[148]
+	+ Qr[70] * Ci[152] + Qi[70] * Cr[152]
+	+ Qr[26] * Ci[196] + Qi[26] * Cr[196]
+	+ Qr[22] * Ci[200] + Qi[22] * Cr[200]
+	+ Qr[14] * Ci[208] + Qi[14] * Cr[208]
+	- 3. * Ci[222];
+      Cr[222] =
+	Qr[130] * Cr[92] - Qi[130] * Ci[92]
+	+ Qr[66] * Cr[156] - Qi[66] * Ci[156]
+	+ Qr[18] * Cr[204] - Qi[18] * Ci[204]
+	+ Qr[10] * Cr[212] - Qi[10] * Ci[212]
+	+ Qr[6] * Cr[216] - Qi[6] * Ci[216]
+	- 2. * Cr[222];
+      Ci[222] =
+	Qr[130] * Ci[92] + Qi[130] * Cr[92]
+	+ Qr[66] * Ci[156] + Qi[66] * Cr[156]
+	+ Qr[18] * Ci[204] + Qi[18] * Cr[204]
+	+ Qr[10] * Ci[212] + Qi[10] * Cr[212]
+	+ Qr[6] * Ci[216] + Qi[6] * Cr[216]
+	- 2. * Ci[222];
+      Cr[222] =
+	Qr[2] * Cr[220] - Qi[2] * Ci[220]
+	- Cr[222];
+      Ci[222] =
+	Qr[2] * Ci[220] + Qi[2] * Cr[220]
+	- Ci[222];
+
+      Cr[224] =
+	Qr[224];
+      Ci[224] =
+	Qi[224];
+      Cr[224] =
+	Qr[160] * Cr[64] - Qi[160] * Ci[64]
+	+ Qr[96] * Cr[128] - Qi[96] * Ci[128]
+	- 2. * Cr[224];
+      Ci[224] =
+	Qr[160] * Ci[64] + Qi[160] * Cr[64]
+	+ Qr[96] * Ci[128] + Qi[96] * Cr[128]
+	- 2. * Ci[224];
+      Cr[224] =
+	Qr[32] * Cr[192] - Qi[32] * Ci[192]
+	- Cr[224];
+      Ci[224] =
+	Qr[32] * Ci[192] + Qi[32] * Cr[192]
+	- Ci[224];
+
+      Cr[226] =
+	Qr[226];
+      Ci[226] =
+	Qi[226];
+      Cr[226] =
+	Qr[194] * Cr[32] - Qi[194] * Ci[32]
+	+ Qr[162] * Cr[64] - Qi[162] * Ci[64]
+	+ Qr[98] * Cr[128] - Qi[98] * Ci[128]
+	- 3. * Cr[226];
+      Ci[226] =
+	Qr[194] * Ci[32] + Qi[194] * Cr[32]
+	+ Qr[162] * Ci[64] + Qi[162] * Cr[64]
+	+ Qr[98] * Ci[128] + Qi[98] * Cr[128]
+	- 3. * Ci[226];
+      Cr[226] =
+	Qr[130] * Cr[96] - Qi[130] * Ci[96]
+	+ Qr[66] * Cr[160] - Qi[66] * Ci[160]
+	+ Qr[34] * Cr[192] - Qi[34] * Ci[192]
+	- 2. * Cr[226];
+      Ci[226] =
+	Qr[130] * Ci[96] + Qi[130] * Cr[96]
+	+ Qr[66] * Ci[160] + Qi[66] * Cr[160]
+	+ Qr[34] * Ci[192] + Qi[34] * Cr[192]
+	- 2. * Ci[226];
+      Cr[226] =
+	Qr[2] * Cr[224] - Qi[2] * Ci[224]
+	- Cr[226];
+      Ci[226] =
+	Qr[2] * Ci[224] + Qi[2] * Cr[224]
+	- Ci[226];
+
+      Cr[228] =
+	Qr[228];
+      Ci[228] =
+	Qi[228];
+      Cr[228] =
+	Qr[196] * Cr[32] - Qi[196] * Ci[32]
+	+ Qr[164] * Cr[64] - Qi[164] * Ci[64]
+	+ Qr[100] * Cr[128] - Qi[100] * Ci[128]
+	- 3. * Cr[228];
+      Ci[228] =
+	Qr[196] * Ci[32] + Qi[196] * Cr[32]
+	+ Qr[164] * Ci[64] + Qi[164] * Cr[64]
+	+ Qr[100] * Ci[128] + Qi[100] * Cr[128]
+	- 3. * Ci[228];
+      Cr[228] =
+	Qr[132] * Cr[96] - Qi[132] * Ci[96]
+	+ Qr[68] * Cr[160] - Qi[68] * Ci[160]
+	+ Qr[36] * Cr[192] - Qi[36] * Ci[192]
+	- 2. * Cr[228];
+      Ci[228] =
+	Qr[132] * Ci[96] + Qi[132] * Cr[96]
+	+ Qr[68] * Ci[160] + Qi[68] * Cr[160]
+	+ Qr[36] * Ci[192] + Qi[36] * Cr[192]
+	- 2. * Ci[228];
+      Cr[228] =
+	Qr[4] * Cr[224] - Qi[4] * Ci[224]
+	- Cr[228];
+      Ci[228] =
+	Qr[4] * Ci[224] + Qi[4] * Cr[224]
+	- Ci[228];
+    }
+
+    /** Part 6 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part6(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[230] =
+	Qr[230];
+      Ci[230] =
+	Qi[230];
+      Cr[230] =
+	Qr[226] * Cr[4] - Qi[226] * Ci[4]
+	+ Qr[198] * Cr[32] - Qi[198] * Ci[32]
+	+ Qr[166] * Cr[64] - Qi[166] * Ci[64]
+	+ Qr[102] * Cr[128] - Qi[102] * Ci[128]
+	- 4. * Cr[230];
+      Ci[230] =
+	Qr[226] * Ci[4] + Qi[226] * Cr[4]
+	+ Qr[198] * Ci[32] + Qi[198] * Cr[32]
+	+ Qr[166] * Ci[64] + Qi[166] * Cr[64]
+	+ Qr[102] * Ci[128] + Qi[102] * Cr[128]
+	- 4. * Ci[230];
+      Cr[230] =
+	Qr[194] * Cr[36] - Qi[194] * Ci[36]
+	+ Qr[162] * Cr[68] - Qi[162] * Ci[68]
+	+ Qr[134] * Cr[96] - Qi[134] * Ci[96]
+	+ Qr[98] * Cr[132] - Qi[98] * Ci[132]
+	+ Qr[70] * Cr[160] - Qi[70] * Ci[160]
+	+ Qr[38] * Cr[192] - Qi[38] * Ci[192]
+	- 3. * Cr[230];
+      Ci[230] =
+	Qr[194] * Ci[36] + Qi[194] * Cr[36]
+	+ Qr[162] * Ci[68] + Qi[162] * Cr[68]
+	+ Qr[134] * Ci[96] + Qi[134] * Cr[96]
+	+ Qr[98] * Ci[132] + Qi[98] * Cr[132]
+	+ Qr[70] * Ci[160] + Qi[70] * Cr[160]
+	+ Qr[38] * Ci[192] + Qi[38] * Cr[192]
+	- 3. * Ci[230];
+      Cr[230] =
+	Qr[130] * Cr[100] - Qi[130] * Ci[100]
+	+ Qr[66] * Cr[164] - Qi[66] * Ci[164]
+	+ Qr[34] * Cr[196] - Qi[34] * Ci[196]
+	+ Qr[6] * Cr[224] - Qi[6] * Ci[224]
+	- 2. * Cr[230];
+      Ci[230] =
+	Qr[130] * Ci[100] + Qi[130] * Cr[100]
+	+ Qr[66] * Ci[164] + Qi[66] * Cr[164]
+	+ Qr[34] * Ci[196] + Qi[34] * Cr[196]
+	+ Qr[6] * Ci[224] + Qi[6] * Cr[224]
+	- 2. * Ci[230];
+      Cr[230] =
+	Qr[2] * Cr[228] - Qi[2] * Ci[228]
+	- Cr[230];
+      Ci[230] =
+	Qr[2] * Ci[228] + Qi[2] * Cr[228]
+	- Ci[230];
+
+      Cr[232] =
+	Qr[232];
+      Ci[232] =
+	Qi[232];
+      Cr[232] =
+	Qr[200] * Cr[32] - Qi[200] * Ci[32]
+	+ Qr[168] * Cr[64] - Qi[168] * Ci[64]
+	+ Qr[104] * Cr[128] - Qi[104] * Ci[128]
+	- 3. * Cr[232];
+      Ci[232] =
+	Qr[200] * Ci[32] + Qi[200] * Cr[32]
+	+ Qr[168] * Ci[64] + Qi[168] * Cr[64]
+	+ Qr[104] * Ci[128] + Qi[104] * Cr[128]
+	- 3. * Ci[232];
+      Cr[232] =
+	Qr[136] * Cr[96] - Qi[136] * Ci[96]
+	+ Qr[72] * Cr[160] - Qi[72] * Ci[160]
+	+ Qr[40] * Cr[192] - Qi[40] * Ci[192]
+	- 2. * Cr[232];
+      Ci[232] =
+	Qr[136] * Ci[96] + Qi[136] * Cr[96]
+	+ Qr[72] * Ci[160] + Qi[72] * Cr[160]
+	+ Qr[40] * Ci[192] + Qi[40] * Cr[192]
+	- 2. * Ci[232];
+      Cr[232] =
+	Qr[8] * Cr[224] - Qi[8] * Ci[224]
+	- Cr[232];
+      Ci[232] =
+	Qr[8] * Ci[224] + Qi[8] * Cr[224]
+	- Ci[232];
+
+      Cr[234] =
+	Qr[234];
+      Ci[234] =
+	Qi[234];
+      Cr[234] =
+	Qr[226] * Cr[8] - Qi[226] * Ci[8]
+	+ Qr[202] * Cr[32] - Qi[202] * Ci[32]
+	+ Qr[170] * Cr[64] - Qi[170] * Ci[64]
+	+ Qr[106] * Cr[128] - Qi[106] * Ci[128]
+	- 4. * Cr[234];
+      Ci[234] =
+	Qr[226] * Ci[8] + Qi[226] * Cr[8]
+	+ Qr[202] * Ci[32] + Qi[202] * Cr[32]
+	+ Qr[170] * Ci[64] + Qi[170] * Cr[64]
+	+ Qr[106] * Ci[128] + Qi[106] * Cr[128]
+	- 4. * Ci[234];
+      Cr[234] =
+	Qr[194] * Cr[40] - Qi[194] * Ci[40]
+	+ Qr[162] * Cr[72] - Qi[162] * Ci[72]
+	+ Qr[138] * Cr[96] - Qi[138] * Ci[96]
+	+ Qr[98] * Cr[136] - Qi[98] * Ci[136]
+	+ Qr[74] * Cr[160] - Qi[74] * Ci[160]
+	+ Qr[42] * Cr[192] - Qi[42] * Ci[192]
+	- 3. * Cr[234];
+      Ci[234] =
+	Qr[194] * Ci[40] + Qi[194] * Cr[40]
+	+ Qr[162] * Ci[72] + Qi[162] * Cr[72]
+	+ Qr[138] * Ci[96] + Qi[138] * Cr[96]
+	+ Qr[98] * Ci[136] + Qi[98] * Cr[136]
+	+ Qr[74] * Ci[160] + Qi[74] * Cr[160]
+	+ Qr[42] * Ci[192] + Qi[42] * Cr[192]
+	- 3. * Ci[234];
+      Cr[234] =
+	Qr[130] * Cr[104] - Qi[130] * Ci[104]
+	+ Qr[66] * Cr[168] - Qi[66] * Ci[168]
+	+ Qr[34] * Cr[200] - Qi[34] * Ci[200]
+	+ Qr[10] * Cr[224] - Qi[10] * Ci[224]
+	- 2. * Cr[234];
+      Ci[234] =
+	Qr[130] * Ci[104] + Qi[130] * Cr[104]
+	+ Qr[66] * Ci[168] + Qi[66] * Cr[168]
+	+ Qr[34] * Ci[200] + Qi[34] * Cr[200]
+	+ Qr[10] * Ci[224] + Qi[10] * Cr[224]
+	- 2. * Ci[234];
+      Cr[234] =
+	Qr[2] * Cr[232] - Qi[2] * Ci[232]
+	- Cr[234];
+      Ci[234] =
+	Qr[2] * Ci[232] + Qi[2] * Cr[232]
+	- Ci[234];
+
+      Cr[236] =
+	Qr[236];
+      Ci[236] =
+	Qi[236];
+      Cr[236] =
+	Qr[228] * Cr[8] - Qi[228] * Ci[8]
+	+ Qr[204] * Cr[32] - Qi[204] * Ci[32]
+	+ Qr[172] * Cr[64] - Qi[172] * Ci[64]
+	+ Qr[108] * Cr[128] - Qi[108] * Ci[128]
+	- 4. * Cr[236];
+      Ci[236] =
+	Qr[228] * Ci[8] + Qi[228] * Cr[8]
+	+ Qr[204] * Ci[32] + Qi[204] * Cr[32]
+	+ Qr[172] * Ci[64] + Qi[172] * Cr[64]
+	+ Qr[108] * Ci[128] + Qi[108] * Cr[128]
+	- 4. * Ci[236];
+      Cr[236] =
+	Qr[196] * Cr[40] - Qi[196] * Ci[40]
+	+ Qr[164] * Cr[72] - Qi[164] * Ci[72]
+	+ Qr[140] * Cr[96] - Qi[140] * Ci[96]
+	+ Qr[100] * Cr[136] - Qi[100] * Ci[136]
+	+ Qr[76] * Cr[160] - Qi[76] * Ci[160]
+	+ Qr[44] * Cr[192] - Qi[44] * Ci[192]
+	- 3. * Cr[236];
+      Ci[236] =
+	Qr[196] * Ci[40] + Qi[196] * Cr[40]
+	+ Qr[164] * Ci[72] + Qi[164] * Cr[72]
+	+ Qr[140] * Ci[96] + Qi[140] * Cr[96]
+	+ Qr[100] * Ci[136] + Qi[100] * Cr[136]
+	+ Qr[76] * Ci[160] + Qi[76] * Cr[160]
+	+ Qr[44] * Ci[192] + Qi[44] * Cr[192]
+	- 3. * Ci[236];
+      Cr[236] =
+	Qr[132] * Cr[104] - Qi[132] * Ci[104]
+	+ Qr[68] * Cr[168] - Qi[68] * Ci[168]
+	+ Qr[36] * Cr[200] - Qi[36] * Ci[200]
+	+ Qr[12] * Cr[224] - Qi[12] * Ci[224]
+	- 2. * Cr[236];
+      Ci[236] =
+	Qr[132] * Ci[104] + Qi[132] * Cr[104]
+	+ Qr[68] * Ci[168] + Qi[68] * Cr[168]
+	+ Qr[36] * Ci[200] + Qi[36] * Cr[200]
+	+ Qr[12] * Ci[224] + Qi[12] * Cr[224]
+	- 2. * Ci[236];
+      Cr[236] =
+	Qr[4] * Cr[232] - Qi[4] * Ci[232]
+	- Cr[236];
+      Ci[236] =
+	Qr[4] * Ci[232] + Qi[4] * Cr[232]
+	- Ci[236];
+
+      Cr[238] =
+	Qr[238];
+      Ci[238] =
+	Qi[238];
+      Cr[238] =
+	Qr[234] * Cr[4] - Qi[234] * Ci[4]
+	+ Qr[230] * Cr[8] - Qi[230] * Ci[8]
+	+ Qr[206] * Cr[32] - Qi[206] * Ci[32]
+	+ Qr[174] * Cr[64] - Qi[174] * Ci[64]
+	+ Qr[110] * Cr[128] - Qi[110] * Ci[128]
+	- 5. * Cr[238];
+      Ci[238] =
+	Qr[234] * Ci[4] + Qi[234] * Cr[4]
+	+ Qr[230] * Ci[8] + Qi[230] * Cr[8]
+	+ Qr[206] * Ci[32] + Qi[206] * Cr[32]
+	+ Qr[174] * Ci[64] + Qi[174] * Cr[64]
+	+ Qr[110] * Ci[128] + Qi[110] * Cr[128]
+	- 5. * Ci[238];
+      Cr[238] =
+	Qr[226] * Cr[12] - Qi[226] * Ci[12]
+	+ Qr[202] * Cr[36] - Qi[202] * Ci[36]
+	+ Qr[198] * Cr[40] - Qi[198] * Ci[40]
+	+ Qr[170] * Cr[68] - Qi[170] * Ci[68]
+	+ Qr[166] * Cr[72] - Qi[166] * Ci[72]
+	+ Qr[142] * Cr[96] - Qi[142] * Ci[96]
+	+ Qr[106] * Cr[132] - Qi[106] * Ci[132]
+	+ Qr[102] * Cr[136] - Qi[102] * Ci[136]
+	+ Qr[78] * Cr[160] - Qi[78] * Ci[160]
+	+ Qr[46] * Cr[192] - Qi[46] * Ci[192]
+	- 4. * Cr[238];
+      Ci[238] =
+	Qr[226] * Ci[12] + Qi[226] * Cr[12]
+	+ Qr[202] * Ci[36] + Qi[202] * Cr[36]
+	+ Qr[198] * Ci[40] + Qi[198] * Cr[40]
+	+ Qr[170] * Ci[68] + Qi[170] * Cr[68]
+	+ Qr[166] * Ci[72] + Qi[166] * Cr[72]
+	+ Qr[142] * Ci[96] + Qi[142] * Cr[96]
+	+ Qr[106] * Ci[132] + Qi[106] * Cr[132]
+	+ Qr[102] * Ci[136] + Qi[102] * Cr[136]
+	+ Qr[78] * Ci[160] + Qi[78] * Cr[160]
+	+ Qr[46] * Ci[192] + Qi[46] * Cr[192]
+	- 4. * Ci[238];
+      Cr[238] =
+	Qr[194] * Cr[44] - Qi[194] * Ci[44]
+	+ Qr[162] * Cr[76] - Qi[162] * Ci[76]
+	+ Qr[138] * Cr[100] - Qi[138] * Ci[100]
+	+ Qr[134] * Cr[104] - Qi[134] * Ci[104]
+	+ Qr[98] * Cr[140] - Qi[98] * Ci[140]
+	+ Qr[74] * Cr[164] - Qi[74] * Ci[164]
+	+ Qr[70] * Cr[168] - Qi[70] * Ci[168]
+	+ Qr[42] * Cr[196] - Qi[42] * Ci[196]
+	+ Qr[38] * Cr[200] - Qi[38] * Ci[200]
+	+ Qr[14] * Cr[224] - Qi[14] * Ci[224]
+	- 3. * Cr[238];
+      Ci[238] =
+	Qr[194] * Ci[44] + Qi[194] * Cr[44]
+	+ Qr[162] * Ci[76] + Qi[162] * Cr[76]
+	+ Qr[138] * Ci[100] + Qi[138] * Cr[100]
+	+ Qr[134] * Ci[104] + Qi[134] * Cr[104]
+	+ Qr[98] * Ci[140] + Qi[98] * Cr[140]
+	+ Qr[74] * Ci[164] + Qi[74] * Cr[164]
+	+ Qr[70] * Ci[168] + Qi[70] * Cr[168]
+	+ Qr[42] * Ci[196] + Qi[42] * Cr[196]
+	+ Qr[38] * Ci[200] + Qi[38] * Cr[200]
+	+ Qr[14] * Ci[224] + Qi[14] * Cr[224]
+	- 3. * Ci[238];
+      Cr[238] =
+	Qr[130] * Cr[108] - Qi[130] * Ci[108]
+	+ Qr[66] * Cr[172] - Qi[66] * Ci[172]
+	+ Qr[34] * Cr[204] - Qi[34] * Ci[204]
+	+ Qr[10] * Cr[228] - Qi[10] * Ci[228]
+	+ Qr[6] * Cr[232] - Qi[6] * Ci[232]
+	- 2. * Cr[238];
+      Ci[238] =
+	Qr[130] * Ci[108] + Qi[130] * Cr[108]
+	+ Qr[66] * Ci[172] + Qi[66] * Cr[172]
+	+ Qr[34] * Ci[204] + Qi[34] * Cr[204]
+	+ Qr[10] * Ci[228] + Qi[10] * Cr[228]
+	+ Qr[6] * Ci[232] + Qi[6] * Cr[232]
+	- 2. * Ci[238];
+      Cr[238] =
+	Qr[2] * Cr[236] - Qi[2] * Ci[236]
+	- Cr[238];
+      Ci[238] =
+	Qr[2] * Ci[236] + Qi[2] * Cr[236]
+	- Ci[238];
+
+      Cr[240] =
+	Qr[240];
+      Ci[240] =
+	Qi[240];
+      Cr[240] =
+	Qr[208] * Cr[32] - Qi[208] * Ci[32]
+	+ Qr[176] * Cr[64] - Qi[176] * Ci[64]
+	+ Qr[112] * Cr[128] - Qi[112] * Ci[128]
+	- 3. * Cr[240];
+      Ci[240] =
+	Qr[208] * Ci[32] + Qi[208] * Cr[32]
+	+ Qr[176] * Ci[64] + Qi[176] * Cr[64]
+	+ Qr[112] * Ci[128] + Qi[112] * Cr[128]
+	- 3. * Ci[240];
+      Cr[240] =
+	Qr[144] * Cr[96] - Qi[144] * Ci[96]
+	+ Qr[80] * Cr[160] - Qi[80] * Ci[160]
+	+ Qr[48] * Cr[192] - Qi[48] * Ci[192]
+	- 2. * Cr[240];
+      Ci[240] =
+	Qr[144] * Ci[96] + Qi[144] * Cr[96]
+	+ Qr[80] * Ci[160] + Qi[80] * Cr[160]
+	+ Qr[48] * Ci[192] + Qi[48] * Cr[192]
+	- 2. * Ci[240];
+      Cr[240] =
+	Qr[16] * Cr[224] - Qi[16] * Ci[224]
+	- Cr[240];
+      Ci[240] =
+	Qr[16] * Ci[224] + Qi[16] * Cr[224]
+	- Ci[240];
+
+      Cr[242] =
+	Qr[242];
+      Ci[242] =
+	Qi[242];
+      Cr[242] =
+	Qr[226] * Cr[16] - Qi[226] * Ci[16]
+	+ Qr[210] * Cr[32] - Qi[210] * Ci[32]
+	+ Qr[178] * Cr[64] - Qi[178] * Ci[64]
+	+ Qr[114] * Cr[128] - Qi[114] * Ci[128]
+	- 4. * Cr[242];
+      Ci[242] =
+	Qr[226] * Ci[16] + Qi[226] * Cr[16]
+	+ Qr[210] * Ci[32] + Qi[210] * Cr[32]
+	+ Qr[178] * Ci[64] + Qi[178] * Cr[64]
+	+ Qr[114] * Ci[128] + Qi[114] * Cr[128]
+	- 4. * Ci[242];
+      Cr[242] =
+	Qr[194] * Cr[48] - Qi[194] * Ci[48]
+	+ Qr[162] * Cr[80] - Qi[162] * Ci[80]
+	+ Qr[146] * Cr[96] - Qi[146] * Ci[96]
+	+ Qr[98] * Cr[144] - Qi[98] * Ci[144]
+	+ Qr[82] * Cr[160] - Qi[82] * Ci[160]
+	+ Qr[50] * Cr[192] - Qi[50] * Ci[192]
+	- 3. * Cr[242];
+      Ci[242] =
+	Qr[194] * Ci[48] + Qi[194] * Cr[48]
+	+ Qr[162] * Ci[80] + Qi[162] * Cr[80]
+	+ Qr[146] * Ci[96] + Qi[146] * Cr[96]
+	+ Qr[98] * Ci[144] + Qi[98] * Cr[144]
+	+ Qr[82] * Ci[160] + Qi[82] * Cr[160]
+	+ Qr[50] * Ci[192] + Qi[50] * Cr[192]
+	- 3. * Ci[242];
+      Cr[242] =
+	Qr[130] * Cr[112] - Qi[130] * Ci[112]
+	+ Qr[66] * Cr[176] - Qi[66] * Ci[176]
+	+ Qr[34] * Cr[208] - Qi[34] * Ci[208]
+	+ Qr[18] * Cr[224] - Qi[18] * Ci[224]
+	- 2. * Cr[242];
+      Ci[242] =
+	Qr[130] * Ci[112] + Qi[130] * Cr[112]
+	+ Qr[66] * Ci[176] + Qi[66] * Cr[176]
+	+ Qr[34] * Ci[208] + Qi[34] * Cr[208]
+	+ Qr[18] * Ci[224] + Qi[18] * Cr[224]
+	- 2. * Ci[242];
+      Cr[242] =
+	Qr[2] * Cr[240] - Qi[2] * Ci[240]
+	- Cr[242];
+      Ci[242] =
+	Qr[2] * Ci[240] + Qi[2] * Cr[240]
+	- Ci[242];
+
+      Cr[244] =
+	Qr[244];
+      Ci[244] =
+	Qi[244];
+      Cr[244] =
+	Qr[228] * Cr[16] - Qi[228] * Ci[16]
+	+ Qr[212] * Cr[32] - Qi[212] * Ci[32]
+	+ Qr[180] * Cr[64] - Qi[180] * Ci[64]
+	+ Qr[116] * Cr[128] - Qi[116] * Ci[128]
+	- 4. * Cr[244];
+      Ci[244] =
+	Qr[228] * Ci[16] + Qi[228] * Cr[16]
+	+ Qr[212] * Ci[32] + Qi[212] * Cr[32]
+	+ Qr[180] * Ci[64] + Qi[180] * Cr[64]
+	+ Qr[116] * Ci[128] + Qi[116] * Cr[128]
+	- 4. * Ci[244];
+      Cr[244] =
+	Qr[196] * Cr[48] - Qi[196] * Ci[48]
+	+ Qr[164] * Cr[80] - Qi[164] * Ci[80]
+	+ Qr[148] * Cr[96] - Qi[148] * Ci[96]
+	+ Qr[100] * Cr[144] - Qi[100] * Ci[144]
+	+ Qr[84] * Cr[160] - Qi[84] * Ci[160]
+	+ Qr[52] * Cr[192] - Qi[52] * Ci[192]
+	- 3. * Cr[244];
+      Ci[244] =
+	Qr[196] * Ci[48] + Qi[196] * Cr[48]
+	+ Qr[164] * Ci[80] + Qi[164] * Cr[80]
+	+ Qr[148] * Ci[96] + Qi[148] * Cr[96]
+	+ Qr[100] * Ci[144] + Qi[100] * Cr[144]
+	+ Qr[84] * Ci[160] + Qi[84] * Cr[160]
+	+ Qr[52] * Ci[192] + Qi[52] * Cr[192]
+	- 3. * Ci[244];
+      Cr[244] =
+	Qr[132] * Cr[112] - Qi[132] * Ci[112]
+	+ Qr[68] * Cr[176] - Qi[68] * Ci[176]
+	+ Qr[36] * Cr[208] - Qi[36] * Ci[208]
+	+ Qr[20] * Cr[224] - Qi[20] * Ci[224]
+	- 2. * Cr[244];
+      Ci[244] =
+	Qr[132] * Ci[112] + Qi[132] * Cr[112]
+	+ Qr[68] * Ci[176] + Qi[68] * Cr[176]
+	+ Qr[36] * Ci[208] + Qi[36] * Cr[208]
+	+ Qr[20] * Ci[224] + Qi[20] * Cr[224]
+	- 2. * Ci[244];
+      Cr[244] =
+	Qr[4] * Cr[240] - Qi[4] * Ci[240]
+	- Cr[244];
+      Ci[244] =
+	Qr[4] * Ci[240] + Qi[4] * Cr[240]
+	- Ci[244];
+    }
+
+    /** Part 7 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part7(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[246] =
+	Qr[246];
+      Ci[246] =
+	Qi[246];
+      Cr[246] =
+	Qr[242] * Cr[4] - Qi[242] * Ci[4]
+	+ Qr[230] * Cr[16] - Qi[230] * Ci[16]
+	+ Qr[214] * Cr[32] - Qi[214] * Ci[32]
+	+ Qr[182] * Cr[64] - Qi[182] * Ci[64]
+	+ Qr[118] * Cr[128] - Qi[118] * Ci[128]
+	- 5. * Cr[246];
+      Ci[246] =
+	Qr[242] * Ci[4] + Qi[242] * Cr[4]
+	+ Qr[230] * Ci[16] + Qi[230] * Cr[16]
+	+ Qr[214] * Ci[32] + Qi[214] * Cr[32]
+	+ Qr[182] * Ci[64] + Qi[182] * Cr[64]
+	+ Qr[118] * Ci[128] + Qi[118] * Cr[128]
+	- 5. * Ci[246];
+      Cr[246] =
+	Qr[226] * Cr[20] - Qi[226] * Ci[20]
+	+ Qr[210] * Cr[36] - Qi[210] * Ci[36]
+	+ Qr[198] * Cr[48] - Qi[198] * Ci[48]
+	+ Qr[178] * Cr[68] - Qi[178] * Ci[68]
+	+ Qr[166] * Cr[80] - Qi[166] * Ci[80]
+	+ Qr[150] * Cr[96] - Qi[150] * Ci[96]
+	+ Qr[114] * Cr[132] - Qi[114] * Ci[132]
+	+ Qr[102] * Cr[144] - Qi[102] * Ci[144]
+	+ Qr[86] * Cr[160] - Qi[86] * Ci[160]
+	+ Qr[54] * Cr[192] - Qi[54] * Ci[192]
+	- 4. * Cr[246];
+      Ci[246] =
+	Qr[226] * Ci[20] + Qi[226] * Cr[20]
+	+ Qr[210] * Ci[36] + Qi[210] * Cr[36]
+	+ Qr[198] * Ci[48] + Qi[198] * Cr[48]
+	+ Qr[178] * Ci[68] + Qi[178] * Cr[68]
+	+ Qr[166] * Ci[80] + Qi[166] * Cr[80]
+	+ Qr[150] * Ci[96] + Qi[150] * Cr[96]
+	+ Qr[114] * Ci[132] + Qi[114] * Cr[132]
+	+ Qr[102] * Ci[144] + Qi[102] * Cr[144]
+	+ Qr[86] * Ci[160] + Qi[86] * Cr[160]
+	+ Qr[54] * Ci[192] + Qi[54] * Cr[192]
+	- 4. * Ci[246];
+      Cr[246] =
+	Qr[194] * Cr[52] - Qi[194] * Ci[52]
+	+ Qr[162] * Cr[84] - Qi[162] * Ci[84]
+	+ Qr[146] * Cr[100] - Qi[146] * Ci[100]
+	+ Qr[134] * Cr[112] - Qi[134] * Ci[112]
+	+ Qr[98] * Cr[148] - Qi[98] * Ci[148]
+	+ Qr[82] * Cr[164] - Qi[82] * Ci[164]
+	+ Qr[70] * Cr[176] - Qi[70] * Ci[176]
+	+ Qr[50] * Cr[196] - Qi[50] * Ci[196]
+	+ Qr[38] * Cr[208] - Qi[38] * Ci[208]
+	+ Qr[22] * Cr[224] - Qi[22] * Ci[224]
+	- 3. * Cr[246];
+      Ci[246] =
+	Qr[194] * Ci[52] + Qi[194] * Cr[52]
+	+ Qr[162] * Ci[84] + Qi[162] * Cr[84]
+	+ Qr[146] * Ci[100] + Qi[146] * Cr[100]
+	+ Qr[134] * Ci[112] + Qi[134] * Cr[112]
+	+ Qr[98] * Ci[148] + Qi[98] * Cr[148]
+	+ Qr[82] * Ci[164] + Qi[82] * Cr[164]
+	+ Qr[70] * Ci[176] + Qi[70] * Cr[176]
+	+ Qr[50] * Ci[196] + Qi[50] * Cr[196]
+	+ Qr[38] * Ci[208] + Qi[38] * Cr[208]
+	+ Qr[22] * Ci[224] + Qi[22] * Cr[224]
+	- 3. * Ci[246];
+      Cr[246] =
+	Qr[130] * Cr[116] - Qi[130] * Ci[116]
+	+ Qr[66] * Cr[180] - Qi[66] * Ci[180]
+	+ Qr[34] * Cr[212] - Qi[34] * Ci[212]
+	+ Qr[18] * Cr[228] - Qi[18] * Ci[228]
+	+ Qr[6] * Cr[240] - Qi[6] * Ci[240]
+	- 2. * Cr[246];
+      Ci[246] =
+	Qr[130] * Ci[116] + Qi[130] * Cr[116]
+	+ Qr[66] * Ci[180] + Qi[66] * Cr[180]
+	+ Qr[34] * Ci[212] + Qi[34] * Cr[212]
+	+ Qr[18] * Ci[228] + Qi[18] * Cr[228]
+	+ Qr[6] * Ci[240] + Qi[6] * Cr[240]
+	- 2. * Ci[246];
+      Cr[246] =
+	Qr[2] * Cr[244] - Qi[2] * Ci[244]
+	- Cr[246];
+      Ci[246] =
+	Qr[2] * Ci[244] + Qi[2] * Cr[244]
+	- Ci[246];
+
+      Cr[248] =
+	Qr[248];
+      Ci[248] =
+	Qi[248];
+      Cr[248] =
+	Qr[232] * Cr[16] - Qi[232] * Ci[16]
+	+ Qr[216] * Cr[32] - Qi[216] * Ci[32]
+	+ Qr[184] * Cr[64] - Qi[184] * Ci[64]
+	+ Qr[120] * Cr[128] - Qi[120] * Ci[128]
+	- 4. * Cr[248];
+      Ci[248] =
+	Qr[232] * Ci[16] + Qi[232] * Cr[16]
+	+ Qr[216] * Ci[32] + Qi[216] * Cr[32]
+	+ Qr[184] * Ci[64] + Qi[184] * Cr[64]
+	+ Qr[120] * Ci[128] + Qi[120] * Cr[128]
+	- 4. * Ci[248];
+      Cr[248] =
+	Qr[200] * Cr[48] - Qi[200] * Ci[48]
+	+ Qr[168] * Cr[80] - Qi[168] * Ci[80]
+	+ Qr[152] * Cr[96] - Qi[152] * Ci[96]
+	+ Qr[104] * Cr[144] - Qi[104] * Ci[144]
+	+ Qr[88] * Cr[160] - Qi[88] * Ci[160]
+	+ Qr[56] * Cr[192] - Qi[56] * Ci[192]
+	- 3. * Cr[248];
+      Ci[248] =
+	Qr[200] * Ci[48] + Qi[200] * Cr[48]
+	+ Qr[168] * Ci[80] + Qi[168] * Cr[80]
+	+ Qr[152] * Ci[96] + Qi[152] * Cr[96]
+	+ Qr[104] * Ci[144] + Qi[104] * Cr[144]
+	+ Qr[88] * Ci[160] + Qi[88] * Cr[160]
+	+ Qr[56] * Ci[192] + Qi[56] * Cr[192]
+	- 3. * Ci[248];
+      Cr[248] =
+	Qr[136] * Cr[112] - Qi[136] * Ci[112]
+	+ Qr[72] * Cr[176] - Qi[72] * Ci[176]
+	+ Qr[40] * Cr[208] - Qi[40] * Ci[208]
+	+ Qr[24] * Cr[224] - Qi[24] * Ci[224]
+	- 2. * Cr[248];
+      Ci[248] =
+	Qr[136] * Ci[112] + Qi[136] * Cr[112]
+	+ Qr[72] * Ci[176] + Qi[72] * Cr[176]
+	+ Qr[40] * Ci[208] + Qi[40] * Cr[208]
+	+ Qr[24] * Ci[224] + Qi[24] * Cr[224]
+	- 2. * Ci[248];
+      Cr[248] =
+	Qr[8] * Cr[240] - Qi[8] * Ci[240]
+	- Cr[248];
+      Ci[248] =
+	Qr[8] * Ci[240] + Qi[8] * Cr[240]
+	- Ci[248];
+
+      Cr[250] =
+	Qr[250];
+      Ci[250] =
+	Qi[250];
+      Cr[250] =
+	Qr[242] * Cr[8] - Qi[242] * Ci[8]
+	+ Qr[234] * Cr[16] - Qi[234] * Ci[16]
+	+ Qr[218] * Cr[32] - Qi[218] * Ci[32]
+	+ Qr[186] * Cr[64] - Qi[186] * Ci[64]
+	+ Qr[122] * Cr[128] - Qi[122] * Ci[128]
+	- 5. * Cr[250];
+      Ci[250] =
+	Qr[242] * Ci[8] + Qi[242] * Cr[8]
+	+ Qr[234] * Ci[16] + Qi[234] * Cr[16]
+	+ Qr[218] * Ci[32] + Qi[218] * Cr[32]
+	+ Qr[186] * Ci[64] + Qi[186] * Cr[64]
+	+ Qr[122] * Ci[128] + Qi[122] * Cr[128]
+	- 5. * Ci[250];
+      Cr[250] =
+	Qr[226] * Cr[24] - Qi[226] * Ci[24]
+	+ Qr[210] * Cr[40] - Qi[210] * Ci[40]
+	+ Qr[202] * Cr[48] - Qi[202] * Ci[48]
+	+ Qr[178] * Cr[72] - Qi[178] * Ci[72]
+	+ Qr[170] * Cr[80] - Qi[170] * Ci[80]
+	+ Qr[154] * Cr[96] - Qi[154] * Ci[96]
+	+ Qr[114] * Cr[136] - Qi[114] * Ci[136]
+	+ Qr[106] * Cr[144] - Qi[106] * Ci[144]
+	+ Qr[90] * Cr[160] - Qi[90] * Ci[160]
+	+ Qr[58] * Cr[192] - Qi[58] * Ci[192]
+	- 4. * Cr[250];
+      Ci[250] =
+	Qr[226] * Ci[24] + Qi[226] * Cr[24]
+	+ Qr[210] * Ci[40] + Qi[210] * Cr[40]
+	+ Qr[202] * Ci[48] + Qi[202] * Cr[48]
+	+ Qr[178] * Ci[72] + Qi[178] * Cr[72]
+	+ Qr[170] * Ci[80] + Qi[170] * Cr[80]
+	+ Qr[154] * Ci[96] + Qi[154] * Cr[96]
+	+ Qr[114] * Ci[136] + Qi[114] * Cr[136]
+	+ Qr[106] * Ci[144] + Qi[106] * Cr[144]
+	+ Qr[90] * Ci[160] + Qi[90] * Cr[160]
+	+ Qr[58] * Ci[192] + Qi[58] * Cr[192]
+	- 4. * Ci[250];
+      Cr[250] =
+	Qr[194] * Cr[56] - Qi[194] * Ci[56]
+	+ Qr[162] * Cr[88] - Qi[162] * Ci[88]
+	+ Qr[146] * Cr[104] - Qi[146] * Ci[104]
+	+ Qr[138] * Cr[112] - Qi[138] * Ci[112]
+	+ Qr[98] * Cr[152] - Qi[98] * Ci[152]
+	+ Qr[82] * Cr[168] - Qi[82] * Ci[168]
+	+ Qr[74] * Cr[176] - Qi[74] * Ci[176]
+	+ Qr[50] * Cr[200] - Qi[50] * Ci[200]
+	+ Qr[42] * Cr[208] - Qi[42] * Ci[208]
+	+ Qr[26] * Cr[224] - Qi[26] * Ci[224]
+	- 3. * Cr[250];
+      Ci[250] =
+	Qr[194] * Ci[56] + Qi[194] * Cr[56]
+	+ Qr[162] * Ci[88] + Qi[162] * Cr[88]
+	+ Qr[146] * Ci[104] + Qi[146] * Cr[104]
+	+ Qr[138] * Ci[112] + Qi[138] * Cr[112]
+	+ Qr[98] * Ci[152] + Qi[98] * Cr[152]
+	+ Qr[82] * Ci[168] + Qi[82] * Cr[168]
+	+ Qr[74] * Ci[176] + Qi[74] * Cr[176]
+	+ Qr[50] * Ci[200] + Qi[50] * Cr[200]
+	+ Qr[42] * Ci[208] + Qi[42] * Cr[208]
+	+ Qr[26] * Ci[224] + Qi[26] * Cr[224]
+	- 3. * Ci[250];
+      Cr[250] =
+	Qr[130] * Cr[120] - Qi[130] * Ci[120]
+	+ Qr[66] * Cr[184] - Qi[66] * Ci[184]
+	+ Qr[34] * Cr[216] - Qi[34] * Ci[216]
+	+ Qr[18] * Cr[232] - Qi[18] * Ci[232]
+	+ Qr[10] * Cr[240] - Qi[10] * Ci[240]
+	- 2. * Cr[250];
+      Ci[250] =
+	Qr[130] * Ci[120] + Qi[130] * Cr[120]
+	+ Qr[66] * Ci[184] + Qi[66] * Cr[184]
+	+ Qr[34] * Ci[216] + Qi[34] * Cr[216]
+	+ Qr[18] * Ci[232] + Qi[18] * Cr[232]
+	+ Qr[10] * Ci[240] + Qi[10] * Cr[240]
+	- 2. * Ci[250];
+      Cr[250] =
+	Qr[2] * Cr[248] - Qi[2] * Ci[248]
+	- Cr[250];
+      Ci[250] =
+	Qr[2] * Ci[248] + Qi[2] * Cr[248]
+	- Ci[250];
+
+      Cr[252] =
+	Qr[252];
+      Ci[252] =
+	Qi[252];
+      Cr[252] =
+	Qr[244] * Cr[8] - Qi[244] * Ci[8]
+	+ Qr[236] * Cr[16] - Qi[236] * Ci[16]
+	+ Qr[220] * Cr[32] - Qi[220] * Ci[32]
+	+ Qr[188] * Cr[64] - Qi[188] * Ci[64]
+	+ Qr[124] * Cr[128] - Qi[124] * Ci[128]
+	- 5. * Cr[252];
+      Ci[252] =
+	Qr[244] * Ci[8] + Qi[244] * Cr[8]
+	+ Qr[236] * Ci[16] + Qi[236] * Cr[16]
+	+ Qr[220] * Ci[32] + Qi[220] * Cr[32]
+	+ Qr[188] * Ci[64] + Qi[188] * Cr[64]
+	+ Qr[124] * Ci[128] + Qi[124] * Cr[128]
+	- 5. * Ci[252];
+      Cr[252] =
+	Qr[228] * Cr[24] - Qi[228] * Ci[24]
+	+ Qr[212] * Cr[40] - Qi[212] * Ci[40]
+	+ Qr[204] * Cr[48] - Qi[204] * Ci[48]
+	+ Qr[180] * Cr[72] - Qi[180] * Ci[72]
+	+ Qr[172] * Cr[80] - Qi[172] * Ci[80]
+	+ Qr[156] * Cr[96] - Qi[156] * Ci[96]
+	+ Qr[116] * Cr[136] - Qi[116] * Ci[136]
+	+ Qr[108] * Cr[144] - Qi[108] * Ci[144]
+	+ Qr[92] * Cr[160] - Qi[92] * Ci[160]
+	+ Qr[60] * Cr[192] - Qi[60] * Ci[192]
+	- 4. * Cr[252];
+      Ci[252] =
+	Qr[228] * Ci[24] + Qi[228] * Cr[24]
+	+ Qr[212] * Ci[40] + Qi[212] * Cr[40]
+	+ Qr[204] * Ci[48] + Qi[204] * Cr[48]
+	+ Qr[180] * Ci[72] + Qi[180] * Cr[72]
+	+ Qr[172] * Ci[80] + Qi[172] * Cr[80]
+	+ Qr[156] * Ci[96] + Qi[156] * Cr[96]
+	+ Qr[116] * Ci[136] + Qi[116] * Cr[136]
+	+ Qr[108] * Ci[144] + Qi[108] * Cr[144]
+	+ Qr[92] * Ci[160] + Qi[92] * Cr[160]
+	+ Qr[60] * Ci[192] + Qi[60] * Cr[192]
+	- 4. * Ci[252];
+      Cr[252] =
+	Qr[196] * Cr[56] - Qi[196] * Ci[56]
+	+ Qr[164] * Cr[88] - Qi[164] * Ci[88]
+	+ Qr[148] * Cr[104] - Qi[148] * Ci[104]
+	+ Qr[140] * Cr[112] - Qi[140] * Ci[112]
+	+ Qr[100] * Cr[152] - Qi[100] * Ci[152]
+	+ Qr[84] * Cr[168] - Qi[84] * Ci[168]
+	+ Qr[76] * Cr[176] - Qi[76] * Ci[176]
+	+ Qr[52] * Cr[200] - Qi[52] * Ci[200]
+	+ Qr[44] * Cr[208] - Qi[44] * Ci[208]
+	+ Qr[28] * Cr[224] - Qi[28] * Ci[224]
+	- 3. * Cr[252];
+      Ci[252] =
+	Qr[196] * Ci[56] + Qi[196] * Cr[56]
+	+ Qr[164] * Ci[88] + Qi[164] * Cr[88]
+	+ Qr[148] * Ci[104] + Qi[148] * Cr[104]
+	+ Qr[140] * Ci[112] + Qi[140] * Cr[112]
+	+ Qr[100] * Ci[152] + Qi[100] * Cr[152]
+	+ Qr[84] * Ci[168] + Qi[84] * Cr[168]
+	+ Qr[76] * Ci[176] + Qi[76] * Cr[176]
+	+ Qr[52] * Ci[200] + Qi[52] * Cr[200]
+	+ Qr[44] * Ci[208] + Qi[44] * Cr[208]
+	+ Qr[28] * Ci[224] + Qi[28] * Cr[224]
+	- 3. * Ci[252];
+      Cr[252] =
+	Qr[132] * Cr[120] - Qi[132] * Ci[120]
+	+ Qr[68] * Cr[184] - Qi[68] * Ci[184]
+	+ Qr[36] * Cr[216] - Qi[36] * Ci[216]
+	+ Qr[20] * Cr[232] - Qi[20] * Ci[232]
+	+ Qr[12] * Cr[240] - Qi[12] * Ci[240]
+	- 2. * Cr[252];
+      Ci[252] =
+	Qr[132] * Ci[120] + Qi[132] * Cr[120]
+	+ Qr[68] * Ci[184] + Qi[68] * Cr[184]
+	+ Qr[36] * Ci[216] + Qi[36] * Cr[216]
+	+ Qr[20] * Ci[232] + Qi[20] * Cr[232]
+	+ Qr[12] * Ci[240] + Qi[12] * Cr[240]
+	- 2. * Ci[252];
+      Cr[252] =
+	Qr[4] * Cr[248] - Qi[4] * Ci[248]
+	- Cr[252];
+      Ci[252] =
+	Qr[4] * Ci[248] + Qi[4] * Cr[248]
+	- Ci[252];
+
+      Cr[254] =
+	Qr[254];
+      Ci[254] =
+	Qi[254];
+      Cr[254] =
+	Qr[250] * Cr[4] - Qi[250] * Ci[4]
+	+ Qr[246] * Cr[8] - Qi[246] * Ci[8]
+	+ Qr[238] * Cr[16] - Qi[238] * Ci[16]
+	+ Qr[222] * Cr[32] - Qi[222] * Ci[32]
+	+ Qr[190] * Cr[64] - Qi[190] * Ci[64]
+	+ Qr[126] * Cr[128] - Qi[126] * Ci[128]
+	- 6. * Cr[254];
+      Ci[254] =
+	Qr[250] * Ci[4] + Qi[250] * Cr[4]
+	+ Qr[246] * Ci[8] + Qi[246] * Cr[8]
+	+ Qr[238] * Ci[16] + Qi[238] * Cr[16]
+	+ Qr[222] * Ci[32] + Qi[222] * Cr[32]
+	+ Qr[190] * Ci[64] + Qi[190] * Cr[64]
+	+ Qr[126] * Ci[128] + Qi[126] * Cr[128]
+	- 6. * Ci[254];
+      Cr[254] =
+	Qr[242] * Cr[12] - Qi[242] * Ci[12]
+	+ Qr[234] * Cr[20] - Qi[234] * Ci[20]
+	+ Qr[230] * Cr[24] - Qi[230] * Ci[24]
+	+ Qr[218] * Cr[36] - Qi[218] * Ci[36]
+	+ Qr[214] * Cr[40] - Qi[214] * Ci[40]
+	+ Qr[206] * Cr[48] - Qi[206] * Ci[48]
+	+ Qr[186] * Cr[68] - Qi[186] * Ci[68]
+	+ Qr[182] * Cr[72] - Qi[182] * Ci[72]
+	+ Qr[174] * Cr[80] - Qi[174] * Ci[80]
+	+ Qr[158] * Cr[96] - Qi[158] * Ci[96]
+	+ Qr[122] * Cr[132] - Qi[122] * Ci[132]
+	+ Qr[118] * Cr[136] - Qi[118] * Ci[136]
+	+ Qr[110] * Cr[144] - Qi[110] * Ci[144]
+	+ Qr[94] * Cr[160] - Qi[94] * Ci[160]
+	+ Qr[62] * Cr[192] - Qi[62] * Ci[192]
+	- 5. * Cr[254];
+      Ci[254] =
+	Qr[242] * Ci[12] + Qi[242] * Cr[12]
+	+ Qr[234] * Ci[20] + Qi[234] * Cr[20]
+	+ Qr[230] * Ci[24] + Qi[230] * Cr[24]
+	+ Qr[218] * Ci[36] + Qi[218] * Cr[36]
+	+ Qr[214] * Ci[40] + Qi[214] * Cr[40]
+	+ Qr[206] * Ci[48] + Qi[206] * Cr[48]
+	+ Qr[186] * Ci[68] + Qi[186] * Cr[68]
+	+ Qr[182] * Ci[72] + Qi[182] * Cr[72]
+	+ Qr[174] * Ci[80] + Qi[174] * Cr[80]
+	+ Qr[158] * Ci[96] + Qi[158] * Cr[96]
+	+ Qr[122] * Ci[132] + Qi[122] * Cr[132]
+	+ Qr[118] * Ci[136] + Qi[118] * Cr[136]
+	+ Qr[110] * Ci[144] + Qi[110] * Cr[144]
+	+ Qr[94] * Ci[160] + Qi[94] * Cr[160]
+	+ Qr[62] * Ci[192] + Qi[62] * Cr[192]
+	- 5. * Ci[254];
+      Cr[254] =
+	Qr[226] * Cr[28] - Qi[226] * Ci[28]
+	+ Qr[210] * Cr[44] - Qi[210] * Ci[44]
+	+ Qr[202] * Cr[52] - Qi[202] * Ci[52]
+	+ Qr[198] * Cr[56] - Qi[198] * Ci[56]
+	+ Qr[178] * Cr[76] - Qi[178] * Ci[76]
+	+ Qr[170] * Cr[84] - Qi[170] * Ci[84]
+	+ Qr[166] * Cr[88] - Qi[166] * Ci[88]
+	+ Qr[154] * Cr[100] - Qi[154] * Ci[100]
+	+ Qr[150] * Cr[104] - Qi[150] * Ci[104]
+	+ Qr[142] * Cr[112] - Qi[142] * Ci[112]
+	+ Qr[114] * Cr[140] - Qi[114] * Ci[140]
+	+ Qr[106] * Cr[148] - Qi[106] * Ci[148]
+	+ Qr[102] * Cr[152] - Qi[102] * Ci[152]
+	+ Qr[90] * Cr[164] - Qi[90] * Ci[164]
+	+ Qr[86] * Cr[168] - Qi[86] * Ci[168]
+	+ Qr[78] * Cr[176] - Qi[78] * Ci[176]
+	+ Qr[58] * Cr[196] - Qi[58] * Ci[196]
+	+ Qr[54] * Cr[200] - Qi[54] * Ci[200]
+	+ Qr[46] * Cr[208] - Qi[46] * Ci[208]
+	+ Qr[30] * Cr[224] - Qi[30] * Ci[224]
+	- 4. * Cr[254];
+      Ci[254] =
+	Qr[226] * Ci[28] + Qi[226] * Cr[28]
+	+ Qr[210] * Ci[44] + Qi[210] * Cr[44]
+	+ Qr[202] * Ci[52] + Qi[202] * Cr[52]
+	+ Qr[198] * Ci[56] + Qi[198] * Cr[56]
+	+ Qr[178] * Ci[76] + Qi[178] * Cr[76]
+	+ Qr[170] * Ci[84] + Qi[170] * Cr[84]
+	+ Qr[166] * Ci[88] + Qi[166] * Cr[88]
+	+ Qr[154] * Ci[100] + Qi[154] * Cr[100]
+	+ Qr[150] * Ci[104] + Qi[150] * Cr[104]
+	+ Qr[142] * Ci[112] + Qi[142] * Cr[112]
+	+ Qr[114] * Ci[140] + Qi[114] * Cr[140]
+	+ Qr[106] * Ci[148] + Qi[106] * Cr[148]
+	+ Qr[102] * Ci[152] + Qi[102] * Cr[152]
+	+ Qr[90] * Ci[164] + Qi[90] * Cr[164]
+	+ Qr[86] * Ci[168] + Qi[86] * Cr[168]
+	+ Qr[78] * Ci[176] + Qi[78] * Cr[176]
+	+ Qr[58] * Ci[196] + Qi[58] * Cr[196]
+	+ Qr[54] * Ci[200] + Qi[54] * Cr[200]
+	+ Qr[46] * Ci[208] + Qi[46] * Cr[208]
+	+ Qr[30] * Ci[224] + Qi[30] * Cr[224]
+	- 4. * Ci[254];
+      Cr[254] =
+	Qr[194] * Cr[60] - Qi[194] * Ci[60]
+	+ Qr[162] * Cr[92] - Qi[162] * Ci[92]
+	+ Qr[146] * Cr[108] - Qi[146] * Ci[108]
+	+ Qr[138] * Cr[116] - Qi[138] * Ci[116]
+	+ Qr[134] * Cr[120] - Qi[134] * Ci[120]
+	+ Qr[98] * Cr[156] - Qi[98] * Ci[156]
+	+ Qr[82] * Cr[172] - Qi[82] * Ci[172]
+	+ Qr[74] * Cr[180] - Qi[74] * Ci[180]
+	+ Qr[70] * Cr[184] - Qi[70] * Ci[184]
+	+ Qr[50] * Cr[204] - Qi[50] * Ci[204]
+	+ Qr[42] * Cr[212] - Qi[42] * Ci[212]
+	+ Qr[38] * Cr[216] - Qi[38] * Ci[216]
+	+ Qr[26] * Cr[228] - Qi[26] * Ci[228]
+	+ Qr[22] * Cr[232] - Qi[22] * Ci[232]
+	+ Qr[14] * Cr[240] - Qi[14] * Ci[240]
+	- 3. * Cr[254];
+      Ci[254] =
+	Qr[194] * Ci[60] + Qi[194] * Cr[60]
+	+ Qr[162] * Ci[92] + Qi[162] * Cr[92]
+	+ Qr[146] * Ci[108] + Qi[146] * Cr[108]
+	+ Qr[138] * Ci[116] + Qi[138] * Cr[116]
+	+ Qr[134] * Ci[120] + Qi[134] * Cr[120]
+	+ Qr[98] * Ci[156] + Qi[98] * Cr[156]
+	+ Qr[82] * Ci[172] + Qi[82] * Cr[172]
+	+ Qr[74] * Ci[180] + Qi[74] * Cr[180]
+	+ Qr[70] * Ci[184] + Qi[70] * Cr[184]
+	+ Qr[50] * Ci[204] + Qi[50] * Cr[204]
+	+ Qr[42] * Ci[212] + Qi[42] * Cr[212]
+	+ Qr[38] * Ci[216] + Qi[38] * Cr[216]
+	+ Qr[26] * Ci[228] + Qi[26] * Cr[228]
+	+ Qr[22] * Ci[232] + Qi[22] * Cr[232]
+	+ Qr[14] * Ci[240] + Qi[14] * Cr[240]
+	- 3. * Ci[254];
+      Cr[254] =
+	Qr[130] * Cr[124] - Qi[130] * Ci[124]
+	+ Qr[66] * Cr[188] - Qi[66] * Ci[188]
+	+ Qr[34] * Cr[220] - Qi[34] * Ci[220]
+	+ Qr[18] * Cr[236] - Qi[18] * Ci[236]
+	+ Qr[10] * Cr[244] - Qi[10] * Ci[244]
+	+ Qr[6] * Cr[248] - Qi[6] * Ci[248]
+	- 2. * Cr[254];
+      Ci[254] =
+	Qr[130] * Ci[124] + Qi[130] * Cr[124]
+	+ Qr[66] * Ci[188] + Qi[66] * Cr[188]
+	+ Qr[34] * Ci[220] + Qi[34] * Cr[220]
+	+ Qr[18] * Ci[236] + Qi[18] * Cr[236]
+	+ Qr[10] * Ci[244] + Qi[10] * Cr[244]
+	+ Qr[6] * Ci[248] + Qi[6] * Cr[248]
+	- 2. * Ci[254];
+      Cr[254] =
+	Qr[2] * Cr[252] - Qi[2] * Ci[252]
+	- Cr[254];
+      Ci[254] =
+	Qr[2] * Ci[252] + Qi[2] * Cr[252]
+	- Ci[254];
+    }
+
+    /** Part 8 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part8(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[256] =
+	Qr[256];
+      Ci[256] =
+	Qi[256];
+
+      Cr[258] =
+	Qr[258];
+      Ci[258] =
+	Qi[258];
+      Cr[258] =
+	Qr[2] * Cr[256] - Qi[2] * Ci[256]
+	- Cr[258];
+      Ci[258] =
+	Qr[2] * Ci[256] + Qi[2] * Cr[256]
+	- Ci[258];
+
+      Cr[260] =
+	Qr[260];
+      Ci[260] =
+	Qi[260];
+      Cr[260] =
+	Qr[4] * Cr[256] - Qi[4] * Ci[256]
+	- Cr[260];
+      Ci[260] =
+	Qr[4] * Ci[256] + Qi[4] * Cr[256]
+	- Ci[260];
+
+      Cr[262] =
+	Qr[262];
+      Ci[262] =
+	Qi[262];
+      Cr[262] =
+	Qr[258] * Cr[4] - Qi[258] * Ci[4]
+	+ Qr[6] * Cr[256] - Qi[6] * Ci[256]
+	- 2. * Cr[262];
+      Ci[262] =
+	Qr[258] * Ci[4] + Qi[258] * Cr[4]
+	+ Qr[6] * Ci[256] + Qi[6] * Cr[256]
+	- 2. * Ci[262];
+      Cr[262] =
+	Qr[2] * Cr[260] - Qi[2] * Ci[260]
+	- Cr[262];
+      Ci[262] =
+	Qr[2] * Ci[260] + Qi[2] * Cr[260]
+	- Ci[262];
+
+      Cr[264] =
+	Qr[264];
+      Ci[264] =
+	Qi[264];
+      Cr[264] =
+	Qr[8] * Cr[256] - Qi[8] * Ci[256]
+	- Cr[264];
+      Ci[264] =
+	Qr[8] * Ci[256] + Qi[8] * Cr[256]
+	- Ci[264];
+
+      Cr[266] =
+	Qr[266];
+      Ci[266] =
+	Qi[266];
+      Cr[266] =
+	Qr[258] * Cr[8] - Qi[258] * Ci[8]
+	+ Qr[10] * Cr[256] - Qi[10] * Ci[256]
+	- 2. * Cr[266];
+      Ci[266] =
+	Qr[258] * Ci[8] + Qi[258] * Cr[8]
+	+ Qr[10] * Ci[256] + Qi[10] * Cr[256]
+	- 2. * Ci[266];
+      Cr[266] =
+	Qr[2] * Cr[264] - Qi[2] * Ci[264]
+	- Cr[266];
+      Ci[266] =
+	Qr[2] * Ci[264] + Qi[2] * Cr[264]
+	- Ci[266];
+
+      Cr[268] =
+	Qr[268];
+      Ci[268] =
+	Qi[268];
+      Cr[268] =
+	Qr[260] * Cr[8] - Qi[260] * Ci[8]
+	+ Qr[12] * Cr[256] - Qi[12] * Ci[256]
+	- 2. * Cr[268];
+      Ci[268] =
+	Qr[260] * Ci[8] + Qi[260] * Cr[8]
+	+ Qr[12] * Ci[256] + Qi[12] * Cr[256]
+	- 2. * Ci[268];
+      Cr[268] =
+	Qr[4] * Cr[264] - Qi[4] * Ci[264]
+	- Cr[268];
+      Ci[268] =
+	Qr[4] * Ci[264] + Qi[4] * Cr[264]
+	- Ci[268];
+
+      Cr[270] =
+	Qr[270];
+      Ci[270] =
+	Qi[270];
+      Cr[270] =
+	Qr[266] * Cr[4] - Qi[266] * Ci[4]
+	+ Qr[262] * Cr[8] - Qi[262] * Ci[8]
+	+ Qr[14] * Cr[256] - Qi[14] * Ci[256]
+	- 3. * Cr[270];
+      Ci[270] =
+	Qr[266] * Ci[4] + Qi[266] * Cr[4]
+	+ Qr[262] * Ci[8] + Qi[262] * Cr[8]
+	+ Qr[14] * Ci[256] + Qi[14] * Cr[256]
+	- 3. * Ci[270];
+      Cr[270] =
+	Qr[258] * Cr[12] - Qi[258] * Ci[12]
+	+ Qr[10] * Cr[260] - Qi[10] * Ci[260]
+	+ Qr[6] * Cr[264] - Qi[6] * Ci[264]
+	- 2. * Cr[270];
+      Ci[270] =
+	Qr[258] * Ci[12] + Qi[258] * Cr[12]
+	+ Qr[10] * Ci[260] + Qi[10] * Cr[260]
+	+ Qr[6] * Ci[264] + Qi[6] * Cr[264]
+	- 2. * Ci[270];
+      Cr[270] =
+	Qr[2] * Cr[268] - Qi[2] * Ci[268]
+	- Cr[270];
+      Ci[270] =
+	Qr[2] * Ci[268] + Qi[2] * Cr[268]
+	- Ci[270];
+
+      Cr[272] =
+	Qr[272];
+      Ci[272] =
+	Qi[272];
+      Cr[272] =
+	Qr[16] * Cr[256] - Qi[16] * Ci[256]
+	- Cr[272];
+      Ci[272] =
+	Qr[16] * Ci[256] + Qi[16] * Cr[256]
+	- Ci[272];
+
+      Cr[274] =
+	Qr[274];
+      Ci[274] =
+	Qi[274];
+      Cr[274] =
+	Qr[258] * Cr[16] - Qi[258] * Ci[16]
+	+ Qr[18] * Cr[256] - Qi[18] * Ci[256]
+	- 2. * Cr[274];
+      Ci[274] =
+	Qr[258] * Ci[16] + Qi[258] * Cr[16]
+	+ Qr[18] * Ci[256] + Qi[18] * Cr[256]
+	- 2. * Ci[274];
+      Cr[274] =
+	Qr[2] * Cr[272] - Qi[2] * Ci[272]
+	- Cr[274];
+      Ci[274] =
+	Qr[2] * Ci[272] + Qi[2] * Cr[272]
+	- Ci[274];
+
+      Cr[276] =
+	Qr[276];
+      Ci[276] =
+	Qi[276];
+      Cr[276] =
+	Qr[260] * Cr[16] - Qi[260] * Ci[16]
+	+ Qr[20] * Cr[256] - Qi[20] * Ci[256]
+	- 2. * Cr[276];
+      Ci[276] =
+	Qr[260] * Ci[16] + Qi[260] * Cr[16]
+	+ Qr[20] * Ci[256] + Qi[20] * Cr[256]
+	- 2. * Ci[276];
+      Cr[276] =
+	Qr[4] * Cr[272] - Qi[4] * Ci[272]
+	- Cr[276];
+      Ci[276] =
+	Qr[4] * Ci[272] + Qi[4] * Cr[272]
+	- Ci[276];
+
+      Cr[278] =
+	Qr[278];
+      Ci[278] =
+	Qi[278];
+      Cr[278] =
+	Qr[274] * Cr[4] - Qi[274] * Ci[4]
+	+ Qr[262] * Cr[16] - Qi[262] * Ci[16]
+	+ Qr[22] * Cr[256] - Qi[22] * Ci[256]
+	- 3. * Cr[278];
+      Ci[278] =
+	Qr[274] * Ci[4] + Qi[274] * Cr[4]
+	+ Qr[262] * Ci[16] + Qi[262] * Cr[16]
+	+ Qr[22] * Ci[256] + Qi[22] * Cr[256]
+	- 3. * Ci[278];
+      Cr[278] =
+	Qr[258] * Cr[20] - Qi[258] * Ci[20]
+	+ Qr[18] * Cr[260] - Qi[18] * Ci[260]
+	+ Qr[6] * Cr[272] - Qi[6] * Ci[272]
+	- 2. * Cr[278];
+      Ci[278] =
+	Qr[258] * Ci[20] + Qi[258] * Cr[20]
+	+ Qr[18] * Ci[260] + Qi[18] * Cr[260]
+	+ Qr[6] * Ci[272] + Qi[6] * Cr[272]
+	- 2. * Ci[278];
+      Cr[278] =
+	Qr[2] * Cr[276] - Qi[2] * Ci[276]
+	- Cr[278];
+      Ci[278] =
+	Qr[2] * Ci[276] + Qi[2] * Cr[276]
+	- Ci[278];
+
+      Cr[280] =
+	Qr[280];
+      Ci[280] =
+	Qi[280];
+      Cr[280] =
+	Qr[264] * Cr[16] - Qi[264] * Ci[16]
+	+ Qr[24] * Cr[256] - Qi[24] * Ci[256]
+	- 2. * Cr[280];
+      Ci[280] =
+	Qr[264] * Ci[16] + Qi[264] * Cr[16]
+	+ Qr[24] * Ci[256] + Qi[24] * Cr[256]
+	- 2. * Ci[280];
+      Cr[280] =
+	Qr[8] * Cr[272] - Qi[8] * Ci[272]
+	- Cr[280];
+      Ci[280] =
+	Qr[8] * Ci[272] + Qi[8] * Cr[272]
+	- Ci[280];
+
+      Cr[282] =
+	Qr[282];
+      Ci[282] =
+	Qi[282];
+      Cr[282] =
+	Qr[274] * Cr[8] - Qi[274] * Ci[8]
+	+ Qr[266] * Cr[16] - Qi[266] * Ci[16]
+	+ Qr[26] * Cr[256] - Qi[26] * Ci[256]
+	- 3. * Cr[282];
+      Ci[282] =
+	Qr[274] * Ci[8] + Qi[274] * Cr[8]
+	+ Qr[266] * Ci[16] + Qi[266] * Cr[16]
+	+ Qr[26] * Ci[256] + Qi[26] * Cr[256]
+	- 3. * Ci[282];
+      Cr[282] =
+	Qr[258] * Cr[24] - Qi[258] * Ci[24]
+	+ Qr[18] * Cr[264] - Qi[18] * Ci[264]
+	+ Qr[10] * Cr[272] - Qi[10] * Ci[272]
+	- 2. * Cr[282];
+      Ci[282] =
+	Qr[258] * Ci[24] + Qi[258] * Cr[24]
+	+ Qr[18] * Ci[264] + Qi[18] * Cr[264]
+	+ Qr[10] * Ci[272] + Qi[10] * Cr[272]
+	- 2. * Ci[282];
+      Cr[282] =
+	Qr[2] * Cr[280] - Qi[2] * Ci[280]
+	- Cr[282];
+      Ci[282] =
+	Qr[2] * Ci[280] + Qi[2] * Cr[280]
+	- Ci[282];
+
+      Cr[284] =
+	Qr[284];
+      Ci[284] =
+	Qi[284];
+      Cr[284] =
+	Qr[276] * Cr[8] - Qi[276] * Ci[8]
+	+ Qr[268] * Cr[16] - Qi[268] * Ci[16]
+	+ Qr[28] * Cr[256] - Qi[28] * Ci[256]
+	- 3. * Cr[284];
+      Ci[284] =
+	Qr[276] * Ci[8] + Qi[276] * Cr[8]
+	+ Qr[268] * Ci[16] + Qi[268] * Cr[16]
+	+ Qr[28] * Ci[256] + Qi[28] * Cr[256]
+	- 3. * Ci[284];
+      Cr[284] =
+	Qr[260] * Cr[24] - Qi[260] * Ci[24]
+	+ Qr[20] * Cr[264] - Qi[20] * Ci[264]
+	+ Qr[12] * Cr[272] - Qi[12] * Ci[272]
+	- 2. * Cr[284];
+      Ci[284] =
+	Qr[260] * Ci[24] + Qi[260] * Cr[24]
+	+ Qr[20] * Ci[264] + Qi[20] * Cr[264]
+	+ Qr[12] * Ci[272] + Qi[12] * Cr[272]
+	- 2. * Ci[284];
+      Cr[284] =
+	Qr[4] * Cr[280] - Qi[4] * Ci[280]
+	- Cr[284];
+      Ci[284] =
+	Qr[4] * Ci[280] + Qi[4] * Cr[280]
+	- Ci[284];
+
+      Cr[286] =
+	Qr[286];
+      Ci[286] =
+	Qi[286];
+      Cr[286] =
+	Qr[282] * Cr[4] - Qi[282] * Ci[4]
+	+ Qr[278] * Cr[8] - Qi[278] * Ci[8]
+	+ Qr[270] * Cr[16] - Qi[270] * Ci[16]
+	+ Qr[30] * Cr[256] - Qi[30] * Ci[256]
+	- 4. * Cr[286];
+      Ci[286] =
+	Qr[282] * Ci[4] + Qi[282] * Cr[4]
+	+ Qr[278] * Ci[8] + Qi[278] * Cr[8]
+	+ Qr[270] * Ci[16] + Qi[270] * Cr[16]
+	+ Qr[30] * Ci[256] + Qi[30] * Cr[256]
+	- 4. * Ci[286];
+      Cr[286] =
+	Qr[274] * Cr[12] - Qi[274] * Ci[12]
+	+ Qr[266] * Cr[20] - Qi[266] * Ci[20]
+	+ Qr[262] * Cr[24] - Qi[262] * Ci[24]
+	+ Qr[26] * Cr[260] - Qi[26] * Ci[260]
+	+ Qr[22] * Cr[264] - Qi[22] * Ci[264]
+	+ Qr[14] * Cr[272] - Qi[14] * Ci[272]
+	- 3. * Cr[286];
+      Ci[286] =
+	Qr[274] * Ci[12] + Qi[274] * Cr[12]
+	+ Qr[266] * Ci[20] + Qi[266] * Cr[20]
+	+ Qr[262] * Ci[24] + Qi[262] * Cr[24]
+	+ Qr[26] * Ci[260] + Qi[26] * Cr[260]
+	+ Qr[22] * Ci[264] + Qi[22] * Cr[264]
+	+ Qr[14] * Ci[272] + Qi[14] * Cr[272]
+	- 3. * Ci[286];
+      Cr[286] =
+	Qr[258] * Cr[28] - Qi[258] * Ci[28]
+	+ Qr[18] * Cr[268] - Qi[18] * Ci[268]
+	+ Qr[10] * Cr[276] - Qi[10] * Ci[276]
+	+ Qr[6] * Cr[280] - Qi[6] * Ci[280]
+	- 2. * Cr[286];
+      Ci[286] =
+	Qr[258] * Ci[28] + Qi[258] * Cr[28]
+	+ Qr[18] * Ci[268] + Qi[18] * Cr[268]
+	+ Qr[10] * Ci[276] + Qi[10] * Cr[276]
+	+ Qr[6] * Ci[280] + Qi[6] * Cr[280]
+	- 2. * Ci[286];
+      Cr[286] =
+	Qr[2] * Cr[284] - Qi[2] * Ci[284]
+	- Cr[286];
+      Ci[286] =
+	Qr[2] * Ci[284] + Qi[2] * Cr[284]
+	- Ci[286];
+
+      Cr[288] =
+	Qr[288];
+      Ci[288] =
+	Qi[288];
+      Cr[288] =
+	Qr[32] * Cr[256] - Qi[32] * Ci[256]
+	- Cr[288];
+      Ci[288] =
+	Qr[32] * Ci[256] + Qi[32] * Cr[256]
+	- Ci[288];
+
+      Cr[290] =
+	Qr[290];
+      Ci[290] =
+	Qi[290];
+      Cr[290] =
+	Qr[258] * Cr[32] - Qi[258] * Ci[32]
+	+ Qr[34] * Cr[256] - Qi[34] * Ci[256]
+	- 2. * Cr[290];
+      Ci[290] =
+	Qr[258] * Ci[32] + Qi[258] * Cr[32]
+	+ Qr[34] * Ci[256] + Qi[34] * Cr[256]
+	- 2. * Ci[290];
+      Cr[290] =
+	Qr[2] * Cr[288] - Qi[2] * Ci[288]
+	- Cr[290];
+      Ci[290] =
+	Qr[2] * Ci[288] + Qi[2] * Cr[288]
+	- Ci[290];
+
+      Cr[292] =
+	Qr[292];
+      Ci[292] =
+	Qi[292];
+      Cr[292] =
+	Qr[260] * Cr[32] - Qi[260] * Ci[32]
+	+ Qr[36] * Cr[256] - Qi[36] * Ci[256]
+	- 2. * Cr[292];
+      Ci[292] =
+	Qr[260] * Ci[32] + Qi[260] * Cr[32]
+	+ Qr[36] * Ci[256] + Qi[36] * Cr[256]
+	- 2. * Ci[292];
+      Cr[292] =
+	Qr[4] * Cr[288] - Qi[4] * Ci[288]
+	- Cr[292];
+      Ci[292] =
+	Qr[4] * Ci[288] + Qi[4] * Cr[288]
+	- Ci[292];
+
+      Cr[294] =
+	Qr[294];
+      Ci[294] =
+	Qi[294];
+      Cr[294] =
+	Qr[290] * Cr[4] - Qi[290] * Ci[4]
+	+ Qr[262] * Cr[32] - Qi[262] * Ci[32]
+	+ Qr[38] * Cr[256] - Qi[38] * Ci[256]
+	- 3. * Cr[294];
+      Ci[294] =
+	Qr[290] * Ci[4] + Qi[290] * Cr[4]
+	+ Qr[262] * Ci[32] + Qi[262] * Cr[32]
+	+ Qr[38] * Ci[256] + Qi[38] * Cr[256]
+	- 3. * Ci[294];
+      Cr[294] =
+	Qr[258] * Cr[36] - Qi[258] * Ci[36]
+	+ Qr[34] * Cr[260] - Qi[34] * Ci[260]
+	+ Qr[6] * Cr[288] - Qi[6] * Ci[288]
+	- 2. * Cr[294];
+      Ci[294] =
+	Qr[258] * Ci[36] + Qi[258] * Cr[36]
+	+ Qr[34] * Ci[260] + Qi[34] * Cr[260]
+	+ Qr[6] * Ci[288] + Qi[6] * Cr[288]
+	- 2. * Ci[294];
+      Cr[294] =
+	Qr[2] * Cr[292] - Qi[2] * Ci[292]
+	- Cr[294];
+      Ci[294] =
+	Qr[2] * Ci[292] + Qi[2] * Cr[292]
+	- Ci[294];
+
+      Cr[296] =
+	Qr[296];
+      Ci[296] =
+	Qi[296];
+      Cr[296] =
+	Qr[264] * Cr[32] - Qi[264] * Ci[32]
+	+ Qr[40] * Cr[256] - Qi[40] * Ci[256]
+	- 2. * Cr[296];
+      Ci[296] =
+	Qr[264] * Ci[32] + Qi[264] * Cr[32]
+	+ Qr[40] * Ci[256] + Qi[40] * Cr[256]
+	- 2. * Ci[296];
+      Cr[296] =
+	Qr[8] * Cr[288] - Qi[8] * Ci[288]
+	- Cr[296];
+      Ci[296] =
+	Qr[8] * Ci[288] + Qi[8] * Cr[288]
+	- Ci[296];
+
+      Cr[298] =
+	Qr[298];
+      Ci[298] =
+	Qi[298];
+      Cr[298] =
+	Qr[290] * Cr[8] - Qi[290] * Ci[8]
+	+ Qr[266] * Cr[32] - Qi[266] * Ci[32]
+	+ Qr[42] * Cr[256] - Qi[42] * Ci[256]
+	- 3. * Cr[298];
+      Ci[298] =
+	Qr[290] * Ci[8] + Qi[290] * Cr[8]
+	+ Qr[266] * Ci[32] + Qi[266] * Cr[32]
+	+ Qr[42] * Ci[256] + Qi[42] * Cr[256]
+	- 3. * Ci[298];
+      Cr[298] =
+	Qr[258] * Cr[40] - Qi[258] * Ci[40]
+	+ Qr[34] * Cr[264] - Qi[34] * Ci[264]
+	+ Qr[10] * Cr[288] - Qi[10] * Ci[288]
+	- 2. * Cr[298];
+      Ci[298] =
+	Qr[258] * Ci[40] + Qi[258] * Cr[40]
+	+ Qr[34] * Ci[264] + Qi[34] * Cr[264]
+	+ Qr[10] * Ci[288] + Qi[10] * Cr[288]
+	- 2. * Ci[298];
+      Cr[298] =
+	Qr[2] * Cr[296] - Qi[2] * Ci[296]
+	- Cr[298];
+      Ci[298] =
+	Qr[2] * Ci[296] + Qi[2] * Cr[296]
+	- Ci[298];
+
+      Cr[300] =
+	Qr[300];
+      Ci[300] =
+	Qi[300];
+      Cr[300] =
+	Qr[292] * Cr[8] - Qi[292] * Ci[8]
+	+ Qr[268] * Cr[32] - Qi[268] * Ci[32]
+	+ Qr[44] * Cr[256] - Qi[44] * Ci[256]
+	- 3. * Cr[300];
+      Ci[300] =
+	Qr[292] * Ci[8] + Qi[292] * Cr[8]
+	+ Qr[268] * Ci[32] + Qi[268] * Cr[32]
+	+ Qr[44] * Ci[256] + Qi[44] * Cr[256]
+	- 3. * Ci[300];
+      Cr[300] =
+	Qr[260] * Cr[40] - Qi[260] * Ci[40]
+	+ Qr[36] * Cr[264] - Qi[36] * Ci[264]
+	+ Qr[12] * Cr[288] - Qi[12] * Ci[288]
+	- 2. * Cr[300];
+      Ci[300] =
+	Qr[260] * Ci[40] + Qi[260] * Cr[40]
+	+ Qr[36] * Ci[264] + Qi[36] * Cr[264]
+	+ Qr[12] * Ci[288] + Qi[12] * Cr[288]
+	- 2. * Ci[300];
+      Cr[300] =
+	Qr[4] * Cr[296] - Qi[4] * Ci[296]
+	- Cr[300];
+      Ci[300] =
+	Qr[4] * Ci[296] + Qi[4] * Cr[296]
+	- Ci[300];
+
+      Cr[302] =
+	Qr[302];
+      Ci[302] =
+	Qi[302];
+      Cr[302] =
+	Qr[298] * Cr[4] - Qi[298] * Ci[4]
+	+ Qr[294] * Cr[8] - Qi[294] * Ci[8]
+	+ Qr[270] * Cr[32] - Qi[270] * Ci[32]
+	+ Qr[46] * Cr[256] - Qi[46] * Ci[256]
+	- 4. * Cr[302];
+      Ci[302] =
+	Qr[298] * Ci[4] + Qi[298] * Cr[4]
+	+ Qr[294] * Ci[8] + Qi[294] * Cr[8]
+	+ Qr[270] * Ci[32] + Qi[270] * Cr[32]
+	+ Qr[46] * Ci[256] + Qi[46] * Cr[256]
+	- 4. * Ci[302];
+      Cr[302] =
+	Qr[290] * Cr[12] - Qi[290] * Ci[12]
+	+ Qr[266] * Cr[36] - Qi[266] * Ci[36]
+	+ Qr[262] * Cr[40] - Qi[262] * Ci[40]
+	+ Qr[42] * Cr[260] - Qi[42] * Ci[260]
+	+ Qr[38] * Cr[264] - Qi[38] * Ci[264]
+	+ Qr[14] * Cr[288] - Qi[14] * Ci[288]
+	- 3. * Cr[302];
+      Ci[302] =
+	Qr[290] * Ci[12] + Qi[290] * Cr[12]
+	+ Qr[266] * Ci[36] + Qi[266] * Cr[36]
+	+ Qr[262] * Ci[40] + Qi[262] * Cr[40]
+	+ Qr[42] * Ci[260] + Qi[42] * Cr[260]
+	+ Qr[38] * Ci[264] + Qi[38] * Cr[264]
+	+ Qr[14] * Ci[288] + Qi[14] * Cr[288]
+	- 3. * Ci[302];
+      Cr[302] =
+	Qr[258] * Cr[44] - Qi[258] * Ci[44]
+	+ Qr[34] * Cr[268] - Qi[34] * Ci[268]
+	+ Qr[10] * Cr[292] - Qi[10] * Ci[292]
+	+ Qr[6] * Cr[296] - Qi[6] * Ci[296]
+	- 2. * Cr[302];
+      Ci[302] =
+	Qr[258] * Ci[44] + Qi[258] * Cr[44]
+	+ Qr[34] * Ci[268] + Qi[34] * Cr[268]
+	+ Qr[10] * Ci[292] + Qi[10] * Cr[292]
+	+ Qr[6] * Ci[296] + Qi[6] * Cr[296]
+	- 2. * Ci[302];
+      Cr[302] =
+	Qr[2] * Cr[300] - Qi[2] * Ci[300]
+	- Cr[302];
+      Ci[302] =
+	Qr[2] * Ci[300] + Qi[2] * Cr[300]
+	- Ci[302];
+    }
+
+    /** Part 9 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part9(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[304] =
+	Qr[304];
+      Ci[304] =
+	Qi[304];
+      Cr[304] =
+	Qr[272] * Cr[32] - Qi[272] * Ci[32]
+	+ Qr[48] * Cr[256] - Qi[48] * Ci[256]
+	- 2. * Cr[304];
+      Ci[304] =
+	Qr[272] * Ci[32] + Qi[272] * Cr[32]
+	+ Qr[48] * Ci[256] + Qi[48] * Cr[256]
+	- 2. * Ci[304];
+      Cr[304] =
+	Qr[16] * Cr[288] - Qi[16] * Ci[288]
+	- Cr[304];
+      Ci[304] =
+	Qr[16] * Ci[288] + Qi[16] * Cr[288]
+	- Ci[304];
+
+      Cr[306] =
+	Qr[306];
+      Ci[306] =
+	Qi[306];
+      Cr[306] =
+	Qr[290] * Cr[16] - Qi[290] * Ci[16]
+	+ Qr[274] * Cr[32] - Qi[274] * Ci[32]
+	+ Qr[50] * Cr[256] - Qi[50] * Ci[256]
+	- 3. * Cr[306];
+      Ci[306] =
+	Qr[290] * Ci[16] + Qi[290] * Cr[16]
+	+ Qr[274] * Ci[32] + Qi[274] * Cr[32]
+	+ Qr[50] * Ci[256] + Qi[50] * Cr[256]
+	- 3. * Ci[306];
+      Cr[306] =
+	Qr[258] * Cr[48] - Qi[258] * Ci[48]
+	+ Qr[34] * Cr[272] - Qi[34] * Ci[272]
+	+ Qr[18] * Cr[288] - Qi[18] * Ci[288]
+	- 2. * Cr[306];
+      Ci[306] =
+	Qr[258] * Ci[48] + Qi[258] * Cr[48]
+	+ Qr[34] * Ci[272] + Qi[34] * Cr[272]
+	+ Qr[18] * Ci[288] + Qi[18] * Cr[288]
+	- 2. * Ci[306];
+      Cr[306] =
+	Qr[2] * Cr[304] - Qi[2] * Ci[304]
+	- Cr[306];
+      Ci[306] =
+	Qr[2] * Ci[304] + Qi[2] * Cr[304]
+	- Ci[306];
+
+      Cr[308] =
+	Qr[308];
+      Ci[308] =
+	Qi[308];
+      Cr[308] =
+	Qr[292] * Cr[16] - Qi[292] * Ci[16]
+	+ Qr[276] * Cr[32] - Qi[276] * Ci[32]
+	+ Qr[52] * Cr[256] - Qi[52] * Ci[256]
+	- 3. * Cr[308];
+      Ci[308] =
+	Qr[292] * Ci[16] + Qi[292] * Cr[16]
+	+ Qr[276] * Ci[32] + Qi[276] * Cr[32]
+	+ Qr[52] * Ci[256] + Qi[52] * Cr[256]
+	- 3. * Ci[308];
+      Cr[308] =
+	Qr[260] * Cr[48] - Qi[260] * Ci[48]
+	+ Qr[36] * Cr[272] - Qi[36] * Ci[272]
+	+ Qr[20] * Cr[288] - Qi[20] * Ci[288]
+	- 2. * Cr[308];
+      Ci[308] =
+	Qr[260] * Ci[48] + Qi[260] * Cr[48]
+	+ Qr[36] * Ci[272] + Qi[36] * Cr[272]
+	+ Qr[20] * Ci[288] + Qi[20] * Cr[288]
+	- 2. * Ci[308];
+      Cr[308] =
+	Qr[4] * Cr[304] - Qi[4] * Ci[304]
+	- Cr[308];
+      Ci[308] =
+	Qr[4] * Ci[304] + Qi[4] * Cr[304]
+	- Ci[308];
+
+      Cr[310] =
+	Qr[310];
+      Ci[310] =
+	Qi[310];
+      Cr[310] =
+	Qr[306] * Cr[4] - Qi[306] * Ci[4]
+	+ Qr[294] * Cr[16] - Qi[294] * Ci[16]
+	+ Qr[278] * Cr[32] - Qi[278] * Ci[32]
+	+ Qr[54] * Cr[256] - Qi[54] * Ci[256]
+	- 4. * Cr[310];
+      Ci[310] =
+	Qr[306] * Ci[4] + Qi[306] * Cr[4]
+	+ Qr[294] * Ci[16] + Qi[294] * Cr[16]
+	+ Qr[278] * Ci[32] + Qi[278] * Cr[32]
+	+ Qr[54] * Ci[256] + Qi[54] * Cr[256]
+	- 4. * Ci[310];
+      Cr[310] =
+	Qr[290] * Cr[20] - Qi[290] * Ci[20]
+	+ Qr[274] * Cr[36] - Qi[274] * Ci[36]
+	+ Qr[262] * Cr[48] - Qi[262] * Ci[48]
+	+ Qr[50] * Cr[260] - Qi[50] * Ci[260]
+	+ Qr[38] * Cr[272] - Qi[38] * Ci[272]
+	+ Qr[22] * Cr[288] - Qi[22] * Ci[288]
+	- 3. * Cr[310];
+      Ci[310] =
+	Qr[290] * Ci[20] + Qi[290] * Cr[20]
+	+ Qr[274] * Ci[36] + Qi[274] * Cr[36]
+	+ Qr[262] * Ci[48] + Qi[262] * Cr[48]
+	+ Qr[50] * Ci[260] + Qi[50] * Cr[260]
+	+ Qr[38] * Ci[272] + Qi[38] * Cr[272]
+	+ Qr[22] * Ci[288] + Qi[22] * Cr[288]
+	- 3. * Ci[310];
+      Cr[310] =
+	Qr[258] * Cr[52] - Qi[258] * Ci[52]
+	+ Qr[34] * Cr[276] - Qi[34] * Ci[276]
+	+ Qr[18] * Cr[292] - Qi[18] * Ci[292]
+	+ Qr[6] * Cr[304] - Qi[6] * Ci[304]
+	- 2. * Cr[310];
+      Ci[310] =
+	Qr[258] * Ci[52] + Qi[258] * Cr[52]
+	+ Qr[34] * Ci[276] + Qi[34] * Cr[276]
+	+ Qr[18] * Ci[292] + Qi[18] * Cr[292]
+	+ Qr[6] * Ci[304] + Qi[6] * Cr[304]
+	- 2. * Ci[310];
+      Cr[310] =
+	Qr[2] * Cr[308] - Qi[2] * Ci[308]
+	- Cr[310];
+      Ci[310] =
+	Qr[2] * Ci[308] + Qi[2] * Cr[308]
+	- Ci[310];
+
+      Cr[312] =
+	Qr[312];
+      Ci[312] =
+	Qi[312];
+      Cr[312] =
+	Qr[296] * Cr[16] - Qi[296] * Ci[16]
+	+ Qr[280] * Cr[32] - Qi[280] * Ci[32]
+	+ Qr[56] * Cr[256] - Qi[56] * Ci[256]
+	- 3. * Cr[312];
+      Ci[312] =
+	Qr[296] * Ci[16] + Qi[296] * Cr[16]
+	+ Qr[280] * Ci[32] + Qi[280] * Cr[32]
+	+ Qr[56] * Ci[256] + Qi[56] * Cr[256]
+	- 3. * Ci[312];
+      Cr[312] =
+	Qr[264] * Cr[48] - Qi[264] * Ci[48]
+	+ Qr[40] * Cr[272] - Qi[40] * Ci[272]
+	+ Qr[24] * Cr[288] - Qi[24] * Ci[288]
+	- 2. * Cr[312];
+      Ci[312] =
+	Qr[264] * Ci[48] + Qi[264] * Cr[48]
+	+ Qr[40] * Ci[272] + Qi[40] * Cr[272]
+	+ Qr[24] * Ci[288] + Qi[24] * Cr[288]
+	- 2. * Ci[312];
+      Cr[312] =
+	Qr[8] * Cr[304] - Qi[8] * Ci[304]
+	- Cr[312];
+      Ci[312] =
+	Qr[8] * Ci[304] + Qi[8] * Cr[304]
+	- Ci[312];
+
+      Cr[314] =
+	Qr[314];
+      Ci[314] =
+	Qi[314];
+      Cr[314] =
+	Qr[306] * Cr[8] - Qi[306] * Ci[8]
+	+ Qr[298] * Cr[16] - Qi[298] * Ci[16]
+	+ Qr[282] * Cr[32] - Qi[282] * Ci[32]
+	+ Qr[58] * Cr[256] - Qi[58] * Ci[256]
+	- 4. * Cr[314];
+      Ci[314] =
+	Qr[306] * Ci[8] + Qi[306] * Cr[8]
+	+ Qr[298] * Ci[16] + Qi[298] * Cr[16]
+	+ Qr[282] * Ci[32] + Qi[282] * Cr[32]
+	+ Qr[58] * Ci[256] + Qi[58] * Cr[256]
+	- 4. * Ci[314];
+      Cr[314] =
+	Qr[290] * Cr[24] - Qi[290] * Ci[24]
+	+ Qr[274] * Cr[40] - Qi[274] * Ci[40]
+	+ Qr[266] * Cr[48] - Qi[266] * Ci[48]
+	+ Qr[50] * Cr[264] - Qi[50] * Ci[264]
+	+ Qr[42] * Cr[272] - Qi[42] * Ci[272]
+	+ Qr[26] * Cr[288] - Qi[26] * Ci[288]
+	- 3. * Cr[314];
+      Ci[314] =
+	Qr[290] * Ci[24] + Qi[290] * Cr[24]
+	+ Qr[274] * Ci[40] + Qi[274] * Cr[40]
+	+ Qr[266] * Ci[48] + Qi[266] * Cr[48]
+	+ Qr[50] * Ci[264] + Qi[50] * Cr[264]
+	+ Qr[42] * Ci[272] + Qi[42] * Cr[272]
+	+ Qr[26] * Ci[288] + Qi[26] * Cr[288]
+	- 3. * Ci[314];
+      Cr[314] =
+	Qr[258] * Cr[56] - Qi[258] * Ci[56]
+	+ Qr[34] * Cr[280] - Qi[34] * Ci[280]
+	+ Qr[18] * Cr[296] - Qi[18] * Ci[296]
+	+ Qr[10] * Cr[304] - Qi[10] * Ci[304]
+	- 2. * Cr[314];
+      Ci[314] =
+	Qr[258] * Ci[56] + Qi[258] * Cr[56]
+	+ Qr[34] * Ci[280] + Qi[34] * Cr[280]
+	+ Qr[18] * Ci[296] + Qi[18] * Cr[296]
+	+ Qr[10] * Ci[304] + Qi[10] * Cr[304]
+	- 2. * Ci[314];
+      Cr[314] =
+	Qr[2] * Cr[312] - Qi[2] * Ci[312]
+	- Cr[314];
+      Ci[314] =
+	Qr[2] * Ci[312] + Qi[2] * Cr[312]
+	- Ci[314];
+
+      Cr[316] =
+	Qr[316];
+      Ci[316] =
+	Qi[316];
+      Cr[316] =
+	Qr[308] * Cr[8] - Qi[308] * Ci[8]
+	+ Qr[300] * Cr[16] - Qi[300] * Ci[16]
+	+ Qr[284] * Cr[32] - Qi[284] * Ci[32]
+	+ Qr[60] * Cr[256] - Qi[60] * Ci[256]
+	- 4. * Cr[316];
+      Ci[316] =
+	Qr[308] * Ci[8] + Qi[308] * Cr[8]
+	+ Qr[300] * Ci[16] + Qi[300] * Cr[16]
+	+ Qr[284] * Ci[32] + Qi[284] * Cr[32]
+	+ Qr[60] * Ci[256] + Qi[60] * Cr[256]
+	- 4. * Ci[316];
+      Cr[316] =
+	Qr[292] * Cr[24] - Qi[292] * Ci[24]
+	+ Qr[276] * Cr[40] - Qi[276] * Ci[40]
+	+ Qr[268] * Cr[48] - Qi[268] * Ci[48]
+	+ Qr[52] * Cr[264] - Qi[52] * Ci[264]
+	+ Qr[44] * Cr[272] - Qi[44] * Ci[272]
+	+ Qr[28] * Cr[288] - Qi[28] * Ci[288]
+	- 3. * Cr[316];
+      Ci[316] =
+	Qr[292] * Ci[24] + Qi[292] * Cr[24]
+	+ Qr[276] * Ci[40] + Qi[276] * Cr[40]
+	+ Qr[268] * Ci[48] + Qi[268] * Cr[48]
+	+ Qr[52] * Ci[264] + Qi[52] * Cr[264]
+	+ Qr[44] * Ci[272] + Qi[44] * Cr[272]
+	+ Qr[28] * Ci[288] + Qi[28] * Cr[288]
+	- 3. * Ci[316];
+      Cr[316] =
+	Qr[260] * Cr[56] - Qi[260] * Ci[56]
+	+ Qr[36] * Cr[280] - Qi[36] * Ci[280]
+	+ Qr[20] * Cr[296] - Qi[20] * Ci[296]
+	+ Qr[12] * Cr[304] - Qi[12] * Ci[304]
+	- 2. * Cr[316];
+      Ci[316] =
+	Qr[260] * Ci[56] + Qi[260] * Cr[56]
+	+ Qr[36] * Ci[280] + Qi[36] * Cr[280]
+	+ Qr[20] * Ci[296] + Qi[20] * Cr[296]
+	+ Qr[12] * Ci[304] + Qi[12] * Cr[304]
+	- 2. * Ci[316];
+      Cr[316] =
+	Qr[4] * Cr[312] - Qi[4] * Ci[312]
+	- Cr[316];
+      Ci[316] =
+	Qr[4] * Ci[312] + Qi[4] * Cr[312]
+	- Ci[316];
+
+      Cr[318] =
+	Qr[318];
+      Ci[318] =
+	Qi[318];
+      Cr[318] =
+	Qr[314] * Cr[4] - Qi[314] * Ci[4]
+	+ Qr[310] * Cr[8] - Qi[310] * Ci[8]
+	+ Qr[302] * Cr[16] - Qi[302] * Ci[16]
+	+ Qr[286] * Cr[32] - Qi[286] * Ci[32]
+	+ Qr[62] * Cr[256] - Qi[62] * Ci[256]
+	- 5. * Cr[318];
+      Ci[318] =
+	Qr[314] * Ci[4] + Qi[314] * Cr[4]
+	+ Qr[310] * Ci[8] + Qi[310] * Cr[8]
+	+ Qr[302] * Ci[16] + Qi[302] * Cr[16]
+	+ Qr[286] * Ci[32] + Qi[286] * Cr[32]
+	+ Qr[62] * Ci[256] + Qi[62] * Cr[256]
+	- 5. * Ci[318];
+      Cr[318] =
+	Qr[306] * Cr[12] - Qi[306] * Ci[12]
+	+ Qr[298] * Cr[20] - Qi[298] * Ci[20]
+	+ Qr[294] * Cr[24] - Qi[294] * Ci[24]
+	+ Qr[282] * Cr[36] - Qi[282] * Ci[36]
+	+ Qr[278] * Cr[40] - Qi[278] * Ci[40]
+	+ Qr[270] * Cr[48] - Qi[270] * Ci[48]
+	+ Qr[58] * Cr[260] - Qi[58] * Ci[260]
+	+ Qr[54] * Cr[264] - Qi[54] * Ci[264]
+	+ Qr[46] * Cr[272] - Qi[46] * Ci[272]
+	+ Qr[30] * Cr[288] - Qi[30] * Ci[288]
+	- 4. * Cr[318];
+      Ci[318] =
+	Qr[306] * Ci[12] + Qi[306] * Cr[12]
+	+ Qr[298] * Ci[20] + Qi[298] * Cr[20]
+	+ Qr[294] * Ci[24] + Qi[294] * Cr[24]
+	+ Qr[282] * Ci[36] + Qi[282] * Cr[36]
+	+ Qr[278] * Ci[40] + Qi[278] * Cr[40]
+	+ Qr[270] * Ci[48] + Qi[270] * Cr[48]
+	+ Qr[58] * Ci[260] + Qi[58] * Cr[260]
+	+ Qr[54] * Ci[264] + Qi[54] * Cr[264]
+	+ Qr[46] * Ci[272] + Qi[46] * Cr[272]
+	+ Qr[30] * Ci[288] + Qi[30] * Cr[288]
+	- 4. * Ci[318];
+      Cr[318] =
+	Qr[290] * Cr[28] - Qi[290] * Ci[28]
+	+ Qr[274] * Cr[44] - Qi[274] * Ci[44]
+	+ Qr[266] * Cr[52] - Qi[266] * Ci[52]
+	+ Qr[262] * Cr[56] - Qi[262] * Ci[56]
+	+ Qr[50] * Cr[268] - Qi[50] * Ci[268]
+	+ Qr[42] * Cr[276] - Qi[42] * Ci[276]
+	+ Qr[38] * Cr[280] - Qi[38] * Ci[280]
+	+ Qr[26] * Cr[292] - Qi[26] * Ci[292]
+	+ Qr[22] * Cr[296] - Qi[22] * Ci[296]
+	+ Qr[14] * Cr[304] - Qi[14] * Ci[304]
+	- 3. * Cr[318];
+      Ci[318] =
+	Qr[290] * Ci[28] + Qi[290] * Cr[28]
+	+ Qr[274] * Ci[44] + Qi[274] * Cr[44]
+	+ Qr[266] * Ci[52] + Qi[266] * Cr[52]
+	+ Qr[262] * Ci[56] + Qi[262] * Cr[56]
+	+ Qr[50] * Ci[268] + Qi[50] * Cr[268]
+	+ Qr[42] * Ci[276] + Qi[42] * Cr[276]
+	+ Qr[38] * Ci[280] + Qi[38] * Cr[280]
+	+ Qr[26] * Ci[292] + Qi[26] * Cr[292]
+	+ Qr[22] * Ci[296] + Qi[22] * Cr[296]
+	+ Qr[14] * Ci[304] + Qi[14] * Cr[304]
+	- 3. * Ci[318];
+      Cr[318] =
+	Qr[258] * Cr[60] - Qi[258] * Ci[60]
+	+ Qr[34] * Cr[284] - Qi[34] * Ci[284]
+	+ Qr[18] * Cr[300] - Qi[18] * Ci[300]
+	+ Qr[10] * Cr[308] - Qi[10] * Ci[308]
+	+ Qr[6] * Cr[312] - Qi[6] * Ci[312]
+	- 2. * Cr[318];
+      Ci[318] =
+	Qr[258] * Ci[60] + Qi[258] * Cr[60]
+	+ Qr[34] * Ci[284] + Qi[34] * Cr[284]
+	+ Qr[18] * Ci[300] + Qi[18] * Cr[300]
+	+ Qr[10] * Ci[308] + Qi[10] * Cr[308]
+	+ Qr[6] * Ci[312] + Qi[6] * Cr[312]
+	- 2. * Ci[318];
+      Cr[318] =
+	Qr[2] * Cr[316] - Qi[2] * Ci[316]
+	- Cr[318];
+      Ci[318] =
+	Qr[2] * Ci[316] + Qi[2] * Cr[316]
+	- Ci[318];
+
+      Cr[320] =
+	Qr[320];
+      Ci[320] =
+	Qi[320];
+      Cr[320] =
+	Qr[64] * Cr[256] - Qi[64] * Ci[256]
+	- Cr[320];
+      Ci[320] =
+	Qr[64] * Ci[256] + Qi[64] * Cr[256]
+	- Ci[320];
+
+      Cr[322] =
+	Qr[322];
+      Ci[322] =
+	Qi[322];
+      Cr[322] =
+	Qr[258] * Cr[64] - Qi[258] * Ci[64]
+	+ Qr[66] * Cr[256] - Qi[66] * Ci[256]
+	- 2. * Cr[322];
+      Ci[322] =
+	Qr[258] * Ci[64] + Qi[258] * Cr[64]
+	+ Qr[66] * Ci[256] + Qi[66] * Cr[256]
+	- 2. * Ci[322];
+      Cr[322] =
+	Qr[2] * Cr[320] - Qi[2] * Ci[320]
+	- Cr[322];
+      Ci[322] =
+	Qr[2] * Ci[320] + Qi[2] * Cr[320]
+	- Ci[322];
+
+      Cr[324] =
+	Qr[324];
+      Ci[324] =
+	Qi[324];
+      Cr[324] =
+	Qr[260] * Cr[64] - Qi[260] * Ci[64]
+	+ Qr[68] * Cr[256] - Qi[68] * Ci[256]
+	- 2. * Cr[324];
+      Ci[324] =
+	Qr[260] * Ci[64] + Qi[260] * Cr[64]
+	+ Qr[68] * Ci[256] + Qi[68] * Cr[256]
+	- 2. * Ci[324];
+      Cr[324] =
+	Qr[4] * Cr[320] - Qi[4] * Ci[320]
+	- Cr[324];
+      Ci[324] =
+	Qr[4] * Ci[320] + Qi[4] * Cr[320]
+	- Ci[324];
+
+      Cr[326] =
+	Qr[326];
+      Ci[326] =
+	Qi[326];
+      Cr[326] =
+	Qr[322] * Cr[4] - Qi[322] * Ci[4]
+	+ Qr[262] * Cr[64] - Qi[262] * Ci[64]
+	+ Qr[70] * Cr[256] - Qi[70] * Ci[256]
+	- 3. * Cr[326];
+      Ci[326] =
+	Qr[322] * Ci[4] + Qi[322] * Cr[4]
+	+ Qr[262] * Ci[64] + Qi[262] * Cr[64]
+	+ Qr[70] * Ci[256] + Qi[70] * Cr[256]
+	- 3. * Ci[326];
+      Cr[326] =
+	Qr[258] * Cr[68] - Qi[258] * Ci[68]
+	+ Qr[66] * Cr[260] - Qi[66] * Ci[260]
+	+ Qr[6] * Cr[320] - Qi[6] * Ci[320]
+	- 2. * Cr[326];
+      Ci[326] =
+	Qr[258] * Ci[68] + Qi[258] * Cr[68]
+	+ Qr[66] * Ci[260] + Qi[66] * Cr[260]
+	+ Qr[6] * Ci[320] + Qi[6] * Cr[320]
+	- 2. * Ci[326];
+      Cr[326] =
+	Qr[2] * Cr[324] - Qi[2] * Ci[324]
+	- Cr[326];
+      Ci[326] =
+	Qr[2] * Ci[324] + Qi[2] * Cr[324]
+	- Ci[326];
+
+      Cr[328] =
+	Qr[328];
+      Ci[328] =
+	Qi[328];
+      Cr[328] =
+	Qr[264] * Cr[64] - Qi[264] * Ci[64]
+	+ Qr[72] * Cr[256] - Qi[72] * Ci[256]
+	- 2. * Cr[328];
+      Ci[328] =
+	Qr[264] * Ci[64] + Qi[264] * Cr[64]
+	+ Qr[72] * Ci[256] + Qi[72] * Cr[256]
+	- 2. * Ci[328];
+      Cr[328] =
+	Qr[8] * Cr[320] - Qi[8] * Ci[320]
+	- Cr[328];
+      Ci[328] =
+	Qr[8] * Ci[320] + Qi[8] * Cr[320]
+	- Ci[328];
+    }
+
+    /** Part 10 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part10(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[330] =
+	Qr[330];
+      Ci[330] =
+	Qi[330];
+      Cr[330] =
+	Qr[322] * Cr[8] - Qi[322] * Ci[8]
+	+ Qr[266] * Cr[64] - Qi[266] * Ci[64]
+	+ Qr[74] * Cr[256] - Qi[74] * Ci[256]
+	- 3. * Cr[330];
+      Ci[330] =
+	Qr[322] * Ci[8] + Qi[322] * Cr[8]
+	+ Qr[266] * Ci[64] + Qi[266] * Cr[64]
+	+ Qr[74] * Ci[256] + Qi[74] * Cr[256]
+	- 3. * Ci[330];
+      Cr[330] =
+	Qr[258] * Cr[72] - Qi[258] * Ci[72]
+	+ Qr[66] * Cr[264] - Qi[66] * Ci[264]
+	+ Qr[10] * Cr[320] - Qi[10] * Ci[320]
+	- 2. * Cr[330];
+      Ci[330] =
+	Qr[258] * Ci[72] + Qi[258] * Cr[72]
+	+ Qr[66] * Ci[264] + Qi[66] * Cr[264]
+	+ Qr[10] * Ci[320] + Qi[10] * Cr[320]
+	- 2. * Ci[330];
+      Cr[330] =
+	Qr[2] * Cr[328] - Qi[2] * Ci[328]
+	- Cr[330];
+      Ci[330] =
+	Qr[2] * Ci[328] + Qi[2] * Cr[328]
+	- Ci[330];
+
+      Cr[332] =
+	Qr[332];
+      Ci[332] =
+	Qi[332];
+      Cr[332] =
+	Qr[324] * Cr[8] - Qi[324] * Ci[8]
+	+ Qr[268] * Cr[64] - Qi[268] * Ci[64]
+	+ Qr[76] * Cr[256] - Qi[76] * Ci[256]
+	- 3. * Cr[332];
+      Ci[332] =
+	Qr[324] * Ci[8] + Qi[324] * Cr[8]
+	+ Qr[268] * Ci[64] + Qi[268] * Cr[64]
+	+ Qr[76] * Ci[256] + Qi[76] * Cr[256]
+	- 3. * Ci[332];
+      Cr[332] =
+	Qr[260] * Cr[72] - Qi[260] * Ci[72]
+	+ Qr[68] * Cr[264] - Qi[68] * Ci[264]
+	+ Qr[12] * Cr[320] - Qi[12] * Ci[320]
+	- 2. * Cr[332];
+      Ci[332] =
+	Qr[260] * Ci[72] + Qi[260] * Cr[72]
+	+ Qr[68] * Ci[264] + Qi[68] * Cr[264]
+	+ Qr[12] * Ci[320] + Qi[12] * Cr[320]
+	- 2. * Ci[332];
+      Cr[332] =
+	Qr[4] * Cr[328] - Qi[4] * Ci[328]
+	- Cr[332];
+      Ci[332] =
+	Qr[4] * Ci[328] + Qi[4] * Cr[328]
+	- Ci[332];
+
+      Cr[334] =
+	Qr[334];
+      Ci[334] =
+	Qi[334];
+      Cr[334] =
+	Qr[330] * Cr[4] - Qi[330] * Ci[4]
+	+ Qr[326] * Cr[8] - Qi[326] * Ci[8]
+	+ Qr[270] * Cr[64] - Qi[270] * Ci[64]
+	+ Qr[78] * Cr[256] - Qi[78] * Ci[256]
+	- 4. * Cr[334];
+      Ci[334] =
+	Qr[330] * Ci[4] + Qi[330] * Cr[4]
+	+ Qr[326] * Ci[8] + Qi[326] * Cr[8]
+	+ Qr[270] * Ci[64] + Qi[270] * Cr[64]
+	+ Qr[78] * Ci[256] + Qi[78] * Cr[256]
+	- 4. * Ci[334];
+      Cr[334] =
+	Qr[322] * Cr[12] - Qi[322] * Ci[12]
+	+ Qr[266] * Cr[68] - Qi[266] * Ci[68]
+	+ Qr[262] * Cr[72] - Qi[262] * Ci[72]
+	+ Qr[74] * Cr[260] - Qi[74] * Ci[260]
+	+ Qr[70] * Cr[264] - Qi[70] * Ci[264]
+	+ Qr[14] * Cr[320] - Qi[14] * Ci[320]
+	- 3. * Cr[334];
+      Ci[334] =
+	Qr[322] * Ci[12] + Qi[322] * Cr[12]
+	+ Qr[266] * Ci[68] + Qi[266] * Cr[68]
+	+ Qr[262] * Ci[72] + Qi[262] * Cr[72]
+	+ Qr[74] * Ci[260] + Qi[74] * Cr[260]
+	+ Qr[70] * Ci[264] + Qi[70] * Cr[264]
+	+ Qr[14] * Ci[320] + Qi[14] * Cr[320]
+	- 3. * Ci[334];
+      Cr[334] =
+	Qr[258] * Cr[76] - Qi[258] * Ci[76]
+	+ Qr[66] * Cr[268] - Qi[66] * Ci[268]
+	+ Qr[10] * Cr[324] - Qi[10] * Ci[324]
+	+ Qr[6] * Cr[328] - Qi[6] * Ci[328]
+	- 2. * Cr[334];
+      Ci[334] =
+	Qr[258] * Ci[76] + Qi[258] * Cr[76]
+	+ Qr[66] * Ci[268] + Qi[66] * Cr[268]
+	+ Qr[10] * Ci[324] + Qi[10] * Cr[324]
+	+ Qr[6] * Ci[328] + Qi[6] * Cr[328]
+	- 2. * Ci[334];
+      Cr[334] =
+	Qr[2] * Cr[332] - Qi[2] * Ci[332]
+	- Cr[334];
+      Ci[334] =
+	Qr[2] * Ci[332] + Qi[2] * Cr[332]
+	- Ci[334];
+
+      Cr[336] =
+	Qr[336];
+      Ci[336] =
+	Qi[336];
+      Cr[336] =
+	Qr[272] * Cr[64] - Qi[272] * Ci[64]
+	+ Qr[80] * Cr[256] - Qi[80] * Ci[256]
+	- 2. * Cr[336];
+      Ci[336] =
+	Qr[272] * Ci[64] + Qi[272] * Cr[64]
+	+ Qr[80] * Ci[256] + Qi[80] * Cr[256]
+	- 2. * Ci[336];
+      Cr[336] =
+	Qr[16] * Cr[320] - Qi[16] * Ci[320]
+	- Cr[336];
+      Ci[336] =
+	Qr[16] * Ci[320] + Qi[16] * Cr[320]
+	- Ci[336];
+
+      Cr[338] =
+	Qr[338];
+      Ci[338] =
+	Qi[338];
+      Cr[338] =
+	Qr[322] * Cr[16] - Qi[322] * Ci[16]
+	+ Qr[274] * Cr[64] - Qi[274] * Ci[64]
+	+ Qr[82] * Cr[256] - Qi[82] * Ci[256]
+	- 3. * Cr[338];
+      Ci[338] =
+	Qr[322] * Ci[16] + Qi[322] * Cr[16]
+	+ Qr[274] * Ci[64] + Qi[274] * Cr[64]
+	+ Qr[82] * Ci[256] + Qi[82] * Cr[256]
+	- 3. * Ci[338];
+      Cr[338] =
+	Qr[258] * Cr[80] - Qi[258] * Ci[80]
+	+ Qr[66] * Cr[272] - Qi[66] * Ci[272]
+	+ Qr[18] * Cr[320] - Qi[18] * Ci[320]
+	- 2. * Cr[338];
+      Ci[338] =
+	Qr[258] * Ci[80] + Qi[258] * Cr[80]
+	+ Qr[66] * Ci[272] + Qi[66] * Cr[272]
+	+ Qr[18] * Ci[320] + Qi[18] * Cr[320]
+	- 2. * Ci[338];
+      Cr[338] =
+	Qr[2] * Cr[336] - Qi[2] * Ci[336]
+	- Cr[338];
+      Ci[338] =
+	Qr[2] * Ci[336] + Qi[2] * Cr[336]
+	- Ci[338];
+
+      Cr[340] =
+	Qr[340];
+      Ci[340] =
+	Qi[340];
+      Cr[340] =
+	Qr[324] * Cr[16] - Qi[324] * Ci[16]
+	+ Qr[276] * Cr[64] - Qi[276] * Ci[64]
+	+ Qr[84] * Cr[256] - Qi[84] * Ci[256]
+	- 3. * Cr[340];
+      Ci[340] =
+	Qr[324] * Ci[16] + Qi[324] * Cr[16]
+	+ Qr[276] * Ci[64] + Qi[276] * Cr[64]
+	+ Qr[84] * Ci[256] + Qi[84] * Cr[256]
+	- 3. * Ci[340];
+      Cr[340] =
+	Qr[260] * Cr[80] - Qi[260] * Ci[80]
+	+ Qr[68] * Cr[272] - Qi[68] * Ci[272]
+	+ Qr[20] * Cr[320] - Qi[20] * Ci[320]
+	- 2. * Cr[340];
+      Ci[340] =
+	Qr[260] * Ci[80] + Qi[260] * Cr[80]
+	+ Qr[68] * Ci[272] + Qi[68] * Cr[272]
+	+ Qr[20] * Ci[320] + Qi[20] * Cr[320]
+	- 2. * Ci[340];
+      Cr[340] =
+	Qr[4] * Cr[336] - Qi[4] * Ci[336]
+	- Cr[340];
+      Ci[340] =
+	Qr[4] * Ci[336] + Qi[4] * Cr[336]
+	- Ci[340];
+
+      Cr[342] =
+	Qr[342];
+      Ci[342] =
+	Qi[342];
+      Cr[342] =
+	Qr[338] * Cr[4] - Qi[338] * Ci[4]
+	+ Qr[326] * Cr[16] - Qi[326] * Ci[16]
+	+ Qr[278] * Cr[64] - Qi[278] * Ci[64]
+	+ Qr[86] * Cr[256] - Qi[86] * Ci[256]
+	- 4. * Cr[342];
+      Ci[342] =
+	Qr[338] * Ci[4] + Qi[338] * Cr[4]
+	+ Qr[326] * Ci[16] + Qi[326] * Cr[16]
+	+ Qr[278] * Ci[64] + Qi[278] * Cr[64]
+	+ Qr[86] * Ci[256] + Qi[86] * Cr[256]
+	- 4. * Ci[342];
+      Cr[342] =
+	Qr[322] * Cr[20] - Qi[322] * Ci[20]
+	+ Qr[274] * Cr[68] - Qi[274] * Ci[68]
+	+ Qr[262] * Cr[80] - Qi[262] * Ci[80]
+	+ Qr[82] * Cr[260] - Qi[82] * Ci[260]
+	+ Qr[70] * Cr[272] - Qi[70] * Ci[272]
+	+ Qr[22] * Cr[320] - Qi[22] * Ci[320]
+	- 3. * Cr[342];
+      Ci[342] =
+	Qr[322] * Ci[20] + Qi[322] * Cr[20]
+	+ Qr[274] * Ci[68] + Qi[274] * Cr[68]
+	+ Qr[262] * Ci[80] + Qi[262] * Cr[80]
+	+ Qr[82] * Ci[260] + Qi[82] * Cr[260]
+	+ Qr[70] * Ci[272] + Qi[70] * Cr[272]
+	+ Qr[22] * Ci[320] + Qi[22] * Cr[320]
+	- 3. * Ci[342];
+      Cr[342] =
+	Qr[258] * Cr[84] - Qi[258] * Ci[84]
+	+ Qr[66] * Cr[276] - Qi[66] * Ci[276]
+	+ Qr[18] * Cr[324] - Qi[18] * Ci[324]
+	+ Qr[6] * Cr[336] - Qi[6] * Ci[336]
+	- 2. * Cr[342];
+      Ci[342] =
+	Qr[258] * Ci[84] + Qi[258] * Cr[84]
+	+ Qr[66] * Ci[276] + Qi[66] * Cr[276]
+	+ Qr[18] * Ci[324] + Qi[18] * Cr[324]
+	+ Qr[6] * Ci[336] + Qi[6] * Cr[336]
+	- 2. * Ci[342];
+      Cr[342] =
+	Qr[2] * Cr[340] - Qi[2] * Ci[340]
+	- Cr[342];
+      Ci[342] =
+	Qr[2] * Ci[340] + Qi[2] * Cr[340]
+	- Ci[342];
+
+      Cr[344] =
+	Qr[344];
+      Ci[344] =
+	Qi[344];
+      Cr[344] =
+	Qr[328] * Cr[16] - Qi[328] * Ci[16]
+	+ Qr[280] * Cr[64] - Qi[280] * Ci[64]
+	+ Qr[88] * Cr[256] - Qi[88] * Ci[256]
+	- 3. * Cr[344];
+      Ci[344] =
+	Qr[328] * Ci[16] + Qi[328] * Cr[16]
+	+ Qr[280] * Ci[64] + Qi[280] * Cr[64]
+	+ Qr[88] * Ci[256] + Qi[88] * Cr[256]
+	- 3. * Ci[344];
+      Cr[344] =
+	Qr[264] * Cr[80] - Qi[264] * Ci[80]
+	+ Qr[72] * Cr[272] - Qi[72] * Ci[272]
+	+ Qr[24] * Cr[320] - Qi[24] * Ci[320]
+	- 2. * Cr[344];
+      Ci[344] =
+	Qr[264] * Ci[80] + Qi[264] * Cr[80]
+	+ Qr[72] * Ci[272] + Qi[72] * Cr[272]
+	+ Qr[24] * Ci[320] + Qi[24] * Cr[320]
+	- 2. * Ci[344];
+      Cr[344] =
+	Qr[8] * Cr[336] - Qi[8] * Ci[336]
+	- Cr[344];
+      Ci[344] =
+	Qr[8] * Ci[336] + Qi[8] * Cr[336]
+	- Ci[344];
+
+      Cr[346] =
+	Qr[346];
+      Ci[346] =
+	Qi[346];
+      Cr[346] =
+	Qr[338] * Cr[8] - Qi[338] * Ci[8]
+	+ Qr[330] * Cr[16] - Qi[330] * Ci[16]
+	+ Qr[282] * Cr[64] - Qi[282] * Ci[64]
+	+ Qr[90] * Cr[256] - Qi[90] * Ci[256]
+	- 4. * Cr[346];
+      Ci[346] =
+	Qr[338] * Ci[8] + Qi[338] * Cr[8]
+	+ Qr[330] * Ci[16] + Qi[330] * Cr[16]
+	+ Qr[282] * Ci[64] + Qi[282] * Cr[64]
+	+ Qr[90] * Ci[256] + Qi[90] * Cr[256]
+	- 4. * Ci[346];
+      Cr[346] =
+	Qr[322] * Cr[24] - Qi[322] * Ci[24]
+	+ Qr[274] * Cr[72] - Qi[274] * Ci[72]
+	+ Qr[266] * Cr[80] - Qi[266] * Ci[80]
+	+ Qr[82] * Cr[264] - Qi[82] * Ci[264]
+	+ Qr[74] * Cr[272] - Qi[74] * Ci[272]
+	+ Qr[26] * Cr[320] - Qi[26] * Ci[320]
+	- 3. * Cr[346];
+      Ci[346] =
+	Qr[322] * Ci[24] + Qi[322] * Cr[24]
+	+ Qr[274] * Ci[72] + Qi[274] * Cr[72]
+	+ Qr[266] * Ci[80] + Qi[266] * Cr[80]
+	+ Qr[82] * Ci[264] + Qi[82] * Cr[264]
+	+ Qr[74] * Ci[272] + Qi[74] * Cr[272]
+	+ Qr[26] * Ci[320] + Qi[26] * Cr[320]
+	- 3. * Ci[346];
+      Cr[346] =
+	Qr[258] * Cr[88] - Qi[258] * Ci[88]
+	+ Qr[66] * Cr[280] - Qi[66] * Ci[280]
+	+ Qr[18] * Cr[328] - Qi[18] * Ci[328]
+	+ Qr[10] * Cr[336] - Qi[10] * Ci[336]
+	- 2. * Cr[346];
+      Ci[346] =
+	Qr[258] * Ci[88] + Qi[258] * Cr[88]
+	+ Qr[66] * Ci[280] + Qi[66] * Cr[280]
+	+ Qr[18] * Ci[328] + Qi[18] * Cr[328]
+	+ Qr[10] * Ci[336] + Qi[10] * Cr[336]
+	- 2. * Ci[346];
+      Cr[346] =
+	Qr[2] * Cr[344] - Qi[2] * Ci[344]
+	- Cr[346];
+      Ci[346] =
+	Qr[2] * Ci[344] + Qi[2] * Cr[344]
+	- Ci[346];
+
+      Cr[348] =
+	Qr[348];
+      Ci[348] =
+	Qi[348];
+      Cr[348] =
+	Qr[340] * Cr[8] - Qi[340] * Ci[8]
+	+ Qr[332] * Cr[16] - Qi[332] * Ci[16]
+	+ Qr[284] * Cr[64] - Qi[284] * Ci[64]
+	+ Qr[92] * Cr[256] - Qi[92] * Ci[256]
+	- 4. * Cr[348];
+      Ci[348] =
+	Qr[340] * Ci[8] + Qi[340] * Cr[8]
+	+ Qr[332] * Ci[16] + Qi[332] * Cr[16]
+	+ Qr[284] * Ci[64] + Qi[284] * Cr[64]
+	+ Qr[92] * Ci[256] + Qi[92] * Cr[256]
+	- 4. * Ci[348];
+      Cr[348] =
+	Qr[324] * Cr[24] - Qi[324] * Ci[24]
+	+ Qr[276] * Cr[72] - Qi[276] * Ci[72]
+	+ Qr[268] * Cr[80] - Qi[268] * Ci[80]
+	+ Qr[84] * Cr[264] - Qi[84] * Ci[264]
+	+ Qr[76] * Cr[272] - Qi[76] * Ci[272]
+	+ Qr[28] * Cr[320] - Qi[28] * Ci[320]
+	- 3. * Cr[348];
+      Ci[348] =
+	Qr[324] * Ci[24] + Qi[324] * Cr[24]
+	+ Qr[276] * Ci[72] + Qi[276] * Cr[72]
+	+ Qr[268] * Ci[80] + Qi[268] * Cr[80]
+	+ Qr[84] * Ci[264] + Qi[84] * Cr[264]
+	+ Qr[76] * Ci[272] + Qi[76] * Cr[272]
+	+ Qr[28] * Ci[320] + Qi[28] * Cr[320]
+	- 3. * Ci[348];
+      Cr[348] =
+	Qr[260] * Cr[88] - Qi[260] * Ci[88]
+	+ Qr[68] * Cr[280] - Qi[68] * Ci[280]
+	+ Qr[20] * Cr[328] - Qi[20] * Ci[328]
+	+ Qr[12] * Cr[336] - Qi[12] * Ci[336]
+	- 2. * Cr[348];
+      Ci[348] =
+	Qr[260] * Ci[88] + Qi[260] * Cr[88]
+	+ Qr[68] * Ci[280] + Qi[68] * Cr[280]
+	+ Qr[20] * Ci[328] + Qi[20] * Cr[328]
+	+ Qr[12] * Ci[336] + Qi[12] * Cr[336]
+	- 2. * Ci[348];
+      Cr[348] =
+	Qr[4] * Cr[344] - Qi[4] * Ci[344]
+	- Cr[348];
+      Ci[348] =
+	Qr[4] * Ci[344] + Qi[4] * Cr[344]
+	- Ci[348];
+
+      Cr[350] =
+	Qr[350];
+      Ci[350] =
+	Qi[350];
+      Cr[350] =
+	Qr[346] * Cr[4] - Qi[346] * Ci[4]
+	+ Qr[342] * Cr[8] - Qi[342] * Ci[8]
+	+ Qr[334] * Cr[16] - Qi[334] * Ci[16]
+	+ Qr[286] * Cr[64] - Qi[286] * Ci[64]
+	+ Qr[94] * Cr[256] - Qi[94] * Ci[256]
+	- 5. * Cr[350];
+      Ci[350] =
+	Qr[346] * Ci[4] + Qi[346] * Cr[4]
+	+ Qr[342] * Ci[8] + Qi[342] * Cr[8]
+	+ Qr[334] * Ci[16] + Qi[334] * Cr[16]
+	+ Qr[286] * Ci[64] + Qi[286] * Cr[64]
+	+ Qr[94] * Ci[256] + Qi[94] * Cr[256]
+	- 5. * Ci[350];
+      Cr[350] =
+	Qr[338] * Cr[12] - Qi[338] * Ci[12]
+	+ Qr[330] * Cr[20] - Qi[330] * Ci[20]
+	+ Qr[326] * Cr[24] - Qi[326] * Ci[24]
+	+ Qr[282] * Cr[68] - Qi[282] * Ci[68]
+	+ Qr[278] * Cr[72] - Qi[278] * Ci[72]
+	+ Qr[270] * Cr[80] - Qi[270] * Ci[80]
+	+ Qr[90] * Cr[260] - Qi[90] * Ci[260]
+	+ Qr[86] * Cr[264] - Qi[86] * Ci[264]
+	+ Qr[78] * Cr[272] - Qi[78] * Ci[272]
+	+ Qr[30] * Cr[320] - Qi[30] * Ci[320]
+	- 4. * Cr[350];
+      Ci[350] =
+	Qr[338] * Ci[12] + Qi[338] * Cr[12]
+	+ Qr[330] * Ci[20] + Qi[330] * Cr[20]
+	+ Qr[326] * Ci[24] + Qi[326] * Cr[24]
+	+ Qr[282] * Ci[68] + Qi[282] * Cr[68]
+	+ Qr[278] * Ci[72] + Qi[278] * Cr[72]
+	+ Qr[270] * Ci[80] + Qi[270] * Cr[80]
+	+ Qr[90] * Ci[260] + Qi[90] * Cr[260]
+	+ Qr[86] * Ci[264] + Qi[86] * Cr[264]
+	+ Qr[78] * Ci[272] + Qi[78] * Cr[272]
+	+ Qr[30] * Ci[320] + Qi[30] * Cr[320]
+	- 4. * Ci[350];
+      Cr[350] =
+	Qr[322] * Cr[28] - Qi[322] * Ci[28]
+	+ Qr[274] * Cr[76] - Qi[274] * Ci[76]
+	+ Qr[266] * Cr[84] - Qi[266] * Ci[84]
+	+ Qr[262] * Cr[88] - Qi[262] * Ci[88]
+	+ Qr[82] * Cr[268] - Qi[82] * Ci[268]
+	+ Qr[74] * Cr[276] - Qi[74] * Ci[276]
+	+ Qr[70] * Cr[280] - Qi[70] * Ci[280]
+	+ Qr[26] * Cr[324] - Qi[26] * Ci[324]
+	+ Qr[22] * Cr[328] - Qi[22] * Ci[328]
+	+ Qr[14] * Cr[336] - Qi[14] * Ci[336]
+	- 3. * Cr[350];
+      Ci[350] =
+	Qr[322] * Ci[28] + Qi[322] * Cr[28]
+	+ Qr[274] * Ci[76] + Qi[274] * Cr[76]
+	+ Qr[266] * Ci[84] + Qi[266] * Cr[84]
+	+ Qr[262] * Ci[88] + Qi[262] * Cr[88]
+	+ Qr[82] * Ci[268] + Qi[82] * Cr[268]
+	+ Qr[74] * Ci[276] + Qi[74] * Cr[276]
+	+ Qr[70] * Ci[280] + Qi[70] * Cr[280]
+	+ Qr[26] * Ci[324] + Qi[26] * Cr[324]
+	+ Qr[22] * Ci[328] + Qi[22] * Cr[328]
+	+ Qr[14] * Ci[336] + Qi[14] * Cr[336]
+	- 3. * Ci[350];
+      Cr[350] =
+	Qr[258] * Cr[92] - Qi[258] * Ci[92]
+	+ Qr[66] * Cr[284] - Qi[66] * Ci[284]
+	+ Qr[18] * Cr[332] - Qi[18] * Ci[332]
+	+ Qr[10] * Cr[340] - Qi[10] * Ci[340]
+	+ Qr[6] * Cr[344] - Qi[6] * Ci[344]
+	- 2. * Cr[350];
+      Ci[350] =
+	Qr[258] * Ci[92] + Qi[258] * Cr[92]
+	+ Qr[66] * Ci[284] + Qi[66] * Cr[284]
+	+ Qr[18] * Ci[332] + Qi[18] * Cr[332]
+	+ Qr[10] * Ci[340] + Qi[10] * Cr[340]
+	+ Qr[6] * Ci[344] + Qi[6] * Cr[344]
+	- 2. * Ci[350];
+      Cr[350] =
+	Qr[2] * Cr[348] - Qi[2] * Ci[348]
+	- Cr[350];
+      Ci[350] =
+	Qr[2] * Ci[348] + Qi[2] * Cr[348]
+	- Ci[350];
+    }
+
+    /** Part 11 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part11(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[352] =
+	Qr[352];
+      Ci[352] =
+	Qi[352];
+      Cr[352] =
+	Qr[288] * Cr[64] - Qi[288] * Ci[64]
+	+ Qr[96] * Cr[256] - Qi[96] * Ci[256]
+	- 2. * Cr[352];
+      Ci[352] =
+	Qr[288] * Ci[64] + Qi[288] * Cr[64]
+	+ Qr[96] * Ci[256] + Qi[96] * Cr[256]
+	- 2. * Ci[352];
+      Cr[352] =
+	Qr[32] * Cr[320] - Qi[32] * Ci[320]
+	- Cr[352];
+      Ci[352] =
+	Qr[32] * Ci[320] + Qi[32] * Cr[320]
+	- Ci[352];
+
+      Cr[354] =
+	Qr[354];
+      Ci[354] =
+	Qi[354];
+      Cr[354] =
+	Qr[322] * Cr[32] - Qi[322] * Ci[32]
+	+ Qr[290] * Cr[64] - Qi[290] * Ci[64]
+	+ Qr[98] * Cr[256] - Qi[98] * Ci[256]
+	- 3. * Cr[354];
+      Ci[354] =
+	Qr[322] * Ci[32] + Qi[322] * Cr[32]
+	+ Qr[290] * Ci[64] + Qi[290] * Cr[64]
+	+ Qr[98] * Ci[256] + Qi[98] * Cr[256]
+	- 3. * Ci[354];
+      Cr[354] =
+	Qr[258] * Cr[96] - Qi[258] * Ci[96]
+	+ Qr[66] * Cr[288] - Qi[66] * Ci[288]
+	+ Qr[34] * Cr[320] - Qi[34] * Ci[320]
+	- 2. * Cr[354];
+      Ci[354] =
+	Qr[258] * Ci[96] + Qi[258] * Cr[96]
+	+ Qr[66] * Ci[288] + Qi[66] * Cr[288]
+	+ Qr[34] * Ci[320] + Qi[34] * Cr[320]
+	- 2. * Ci[354];
+      Cr[354] =
+	Qr[2] * Cr[352] - Qi[2] * Ci[352]
+	- Cr[354];
+      Ci[354] =
+	Qr[2] * Ci[352] + Qi[2] * Cr[352]
+	- Ci[354];
+
+      Cr[356] =
+	Qr[356];
+      Ci[356] =
+	Qi[356];
+      Cr[356] =
+	Qr[324] * Cr[32] - Qi[324] * Ci[32]
+	+ Qr[292] * Cr[64] - Qi[292] * Ci[64]
+	+ Qr[100] * Cr[256] - Qi[100] * Ci[256]
+	- 3. * Cr[356];
+      Ci[356] =
+	Qr[324] * Ci[32] + Qi[324] * Cr[32]
+	+ Qr[292] * Ci[64] + Qi[292] * Cr[64]
+	+ Qr[100] * Ci[256] + Qi[100] * Cr[256]
+	- 3. * Ci[356];
+      Cr[356] =
+	Qr[260] * Cr[96] - Qi[260] * Ci[96]
+	+ Qr[68] * Cr[288] - Qi[68] * Ci[288]
+	+ Qr[36] * Cr[320] - Qi[36] * Ci[320]
+	- 2. * Cr[356];
+      Ci[356] =
+	Qr[260] * Ci[96] + Qi[260] * Cr[96]
+	+ Qr[68] * Ci[288] + Qi[68] * Cr[288]
+	+ Qr[36] * Ci[320] + Qi[36] * Cr[320]
+	- 2. * Ci[356];
+      Cr[356] =
+	Qr[4] * Cr[352] - Qi[4] * Ci[352]
+	- Cr[356];
+      Ci[356] =
+	Qr[4] * Ci[352] + Qi[4] * Cr[352]
+	- Ci[356];
+
+      Cr[358] =
+	Qr[358];
+      Ci[358] =
+	Qi[358];
+      Cr[358] =
+	Qr[354] * Cr[4] - Qi[354] * Ci[4]
+	+ Qr[326] * Cr[32] - Qi[326] * Ci[32]
+	+ Qr[294] * Cr[64] - Qi[294] * Ci[64]
+	+ Qr[102] * Cr[256] - Qi[102] * Ci[256]
+	- 4. * Cr[358];
+      Ci[358] =
+	Qr[354] * Ci[4] + Qi[354] * Cr[4]
+	+ Qr[326] * Ci[32] + Qi[326] * Cr[32]
+	+ Qr[294] * Ci[64] + Qi[294] * Cr[64]
+	+ Qr[102] * Ci[256] + Qi[102] * Cr[256]
+	- 4. * Ci[358];
+      Cr[358] =
+	Qr[322] * Cr[36] - Qi[322] * Ci[36]
+	+ Qr[290] * Cr[68] - Qi[290] * Ci[68]
+	+ Qr[262] * Cr[96] - Qi[262] * Ci[96]
+	+ Qr[98] * Cr[260] - Qi[98] * Ci[260]
+	+ Qr[70] * Cr[288] - Qi[70] * Ci[288]
+	+ Qr[38] * Cr[320] - Qi[38] * Ci[320]
+	- 3. * Cr[358];
+      Ci[358] =
+	Qr[322] * Ci[36] + Qi[322] * Cr[36]
+	+ Qr[290] * Ci[68] + Qi[290] * Cr[68]
+	+ Qr[262] * Ci[96] + Qi[262] * Cr[96]
+	+ Qr[98] * Ci[260] + Qi[98] * Cr[260]
+	+ Qr[70] * Ci[288] + Qi[70] * Cr[288]
+	+ Qr[38] * Ci[320] + Qi[38] * Cr[320]
+	- 3. * Ci[358];
+      Cr[358] =
+	Qr[258] * Cr[100] - Qi[258] * Ci[100]
+	+ Qr[66] * Cr[292] - Qi[66] * Ci[292]
+	+ Qr[34] * Cr[324] - Qi[34] * Ci[324]
+	+ Qr[6] * Cr[352] - Qi[6] * Ci[352]
+	- 2. * Cr[358];
+      Ci[358] =
+	Qr[258] * Ci[100] + Qi[258] * Cr[100]
+	+ Qr[66] * Ci[292] + Qi[66] * Cr[292]
+	+ Qr[34] * Ci[324] + Qi[34] * Cr[324]
+	+ Qr[6] * Ci[352] + Qi[6] * Cr[352]
+	- 2. * Ci[358];
+      Cr[358] =
+	Qr[2] * Cr[356] - Qi[2] * Ci[356]
+	- Cr[358];
+      Ci[358] =
+	Qr[2] * Ci[356] + Qi[2] * Cr[356]
+	- Ci[358];
+
+      Cr[360] =
+	Qr[360];
+      Ci[360] =
+	Qi[360];
+      Cr[360] =
+	Qr[328] * Cr[32] - Qi[328] * Ci[32]
+	+ Qr[296] * Cr[64] - Qi[296] * Ci[64]
+	+ Qr[104] * Cr[256] - Qi[104] * Ci[256]
+	- 3. * Cr[360];
+      Ci[360] =
+	Qr[328] * Ci[32] + Qi[328] * Cr[32]
+	+ Qr[296] * Ci[64] + Qi[296] * Cr[64]
+	+ Qr[104] * Ci[256] + Qi[104] * Cr[256]
+	- 3. * Ci[360];
+      Cr[360] =
+	Qr[264] * Cr[96] - Qi[264] * Ci[96]
+	+ Qr[72] * Cr[288] - Qi[72] * Ci[288]
+	+ Qr[40] * Cr[320] - Qi[40] * Ci[320]
+	- 2. * Cr[360];
+      Ci[360] =
+	Qr[264] * Ci[96] + Qi[264] * Cr[96]
+	+ Qr[72] * Ci[288] + Qi[72] * Cr[288]
+	+ Qr[40] * Ci[320] + Qi[40] * Cr[320]
+	- 2. * Ci[360];
+      Cr[360] =
+	Qr[8] * Cr[352] - Qi[8] * Ci[352]
+	- Cr[360];
+      Ci[360] =
+	Qr[8] * Ci[352] + Qi[8] * Cr[352]
+	- Ci[360];
+
+      Cr[362] =
+	Qr[362];
+      Ci[362] =
+	Qi[362];
+      Cr[362] =
+	Qr[354] * Cr[8] - Qi[354] * Ci[8]
+	+ Qr[330] * Cr[32] - Qi[330] * Ci[32]
+	+ Qr[298] * Cr[64] - Qi[298] * Ci[64]
+	+ Qr[106] * Cr[256] - Qi[106] * Ci[256]
+	- 4. * Cr[362];
+      Ci[362] =
+	Qr[354] * Ci[8] + Qi[354] * Cr[8]
+	+ Qr[330] * Ci[32] + Qi[330] * Cr[32]
+	+ Qr[298] * Ci[64] + Qi[298] * Cr[64]
+	+ Qr[106] * Ci[256] + Qi[106] * Cr[256]
+	- 4. * Ci[362];
+      Cr[362] =
+	Qr[322] * Cr[40] - Qi[322] * Ci[40]
+	+ Qr[290] * Cr[72] - Qi[290] * Ci[72]
+	+ Qr[266] * Cr[96] - Qi[266] * Ci[96]
+	+ Qr[98] * Cr[264] - Qi[98] * Ci[264]
+	+ Qr[74] * Cr[288] - Qi[74] * Ci[288]
+	+ Qr[42] * Cr[320] - Qi[42] * Ci[320]
+	- 3. * Cr[362];
+      Ci[362] =
+	Qr[322] * Ci[40] + Qi[322] * Cr[40]
+	+ Qr[290] * Ci[72] + Qi[290] * Cr[72]
+	+ Qr[266] * Ci[96] + Qi[266] * Cr[96]
+	+ Qr[98] * Ci[264] + Qi[98] * Cr[264]
+	+ Qr[74] * Ci[288] + Qi[74] * Cr[288]
+	+ Qr[42] * Ci[320] + Qi[42] * Cr[320]
+	- 3. * Ci[362];
+      Cr[362] =
+	Qr[258] * Cr[104] - Qi[258] * Ci[104]
+	+ Qr[66] * Cr[296] - Qi[66] * Ci[296]
+	+ Qr[34] * Cr[328] - Qi[34] * Ci[328]
+	+ Qr[10] * Cr[352] - Qi[10] * Ci[352]
+	- 2. * Cr[362];
+      Ci[362] =
+	Qr[258] * Ci[104] + Qi[258] * Cr[104]
+	+ Qr[66] * Ci[296] + Qi[66] * Cr[296]
+	+ Qr[34] * Ci[328] + Qi[34] * Cr[328]
+	+ Qr[10] * Ci[352] + Qi[10] * Cr[352]
+	- 2. * Ci[362];
+      Cr[362] =
+	Qr[2] * Cr[360] - Qi[2] * Ci[360]
+	- Cr[362];
+      Ci[362] =
+	Qr[2] * Ci[360] + Qi[2] * Cr[360]
+	- Ci[362];
+
+      Cr[364] =
+	Qr[364];
+      Ci[364] =
+	Qi[364];
+      Cr[364] =
+	Qr[356] * Cr[8] - Qi[356] * Ci[8]
+	+ Qr[332] * Cr[32] - Qi[332] * Ci[32]
+	+ Qr[300] * Cr[64] - Qi[300] * Ci[64]
+	+ Qr[108] * Cr[256] - Qi[108] * Ci[256]
+	- 4. * Cr[364];
+      Ci[364] =
+	Qr[356] * Ci[8] + Qi[356] * Cr[8]
+	+ Qr[332] * Ci[32] + Qi[332] * Cr[32]
+	+ Qr[300] * Ci[64] + Qi[300] * Cr[64]
+	+ Qr[108] * Ci[256] + Qi[108] * Cr[256]
+	- 4. * Ci[364];
+      Cr[364] =
+	Qr[324] * Cr[40] - Qi[324] * Ci[40]
+	+ Qr[292] * Cr[72] - Qi[292] * Ci[72]
+	+ Qr[268] * Cr[96] - Qi[268] * Ci[96]
+	+ Qr[100] * Cr[264] - Qi[100] * Ci[264]
+	+ Qr[76] * Cr[288] - Qi[76] * Ci[288]
+	+ Qr[44] * Cr[320] - Qi[44] * Ci[320]
+	- 3. * Cr[364];
+      Ci[364] =
+	Qr[324] * Ci[40] + Qi[324] * Cr[40]
+	+ Qr[292] * Ci[72] + Qi[292] * Cr[72]
+	+ Qr[268] * Ci[96] + Qi[268] * Cr[96]
+	+ Qr[100] * Ci[264] + Qi[100] * Cr[264]
+	+ Qr[76] * Ci[288] + Qi[76] * Cr[288]
+	+ Qr[44] * Ci[320] + Qi[44] * Cr[320]
+	- 3. * Ci[364];
+      Cr[364] =
+	Qr[260] * Cr[104] - Qi[260] * Ci[104]
+	+ Qr[68] * Cr[296] - Qi[68] * Ci[296]
+	+ Qr[36] * Cr[328] - Qi[36] * Ci[328]
+	+ Qr[12] * Cr[352] - Qi[12] * Ci[352]
+	- 2. * Cr[364];
+      Ci[364] =
+	Qr[260] * Ci[104] + Qi[260] * Cr[104]
+	+ Qr[68] * Ci[296] + Qi[68] * Cr[296]
+	+ Qr[36] * Ci[328] + Qi[36] * Cr[328]
+	+ Qr[12] * Ci[352] + Qi[12] * Cr[352]
+	- 2. * Ci[364];
+      Cr[364] =
+	Qr[4] * Cr[360] - Qi[4] * Ci[360]
+	- Cr[364];
+      Ci[364] =
+	Qr[4] * Ci[360] + Qi[4] * Cr[360]
+	- Ci[364];
+
+      Cr[366] =
+	Qr[366];
+      Ci[366] =
+	Qi[366];
+      Cr[366] =
+	Qr[362] * Cr[4] - Qi[362] * Ci[4]
+	+ Qr[358] * Cr[8] - Qi[358] * Ci[8]
+	+ Qr[334] * Cr[32] - Qi[334] * Ci[32]
+	+ Qr[302] * Cr[64] - Qi[302] * Ci[64]
+	+ Qr[110] * Cr[256] - Qi[110] * Ci[256]
+	- 5. * Cr[366];
+      Ci[366] =
+	Qr[362] * Ci[4] + Qi[362] * Cr[4]
+	+ Qr[358] * Ci[8] + Qi[358] * Cr[8]
+	+ Qr[334] * Ci[32] + Qi[334] * Cr[32]
+	+ Qr[302] * Ci[64] + Qi[302] * Cr[64]
+	+ Qr[110] * Ci[256] + Qi[110] * Cr[256]
+	- 5. * Ci[366];
+      Cr[366] =
+	Qr[354] * Cr[12] - Qi[354] * Ci[12]
+	+ Qr[330] * Cr[36] - Qi[330] * Ci[36]
+	+ Qr[326] * Cr[40] - Qi[326] * Ci[40]
+	+ Qr[298] * Cr[68] - Qi[298] * Ci[68]
+	+ Qr[294] * Cr[72] - Qi[294] * Ci[72]
+	+ Qr[270] * Cr[96] - Qi[270] * Ci[96]
+	+ Qr[106] * Cr[260] - Qi[106] * Ci[260]
+	+ Qr[102] * Cr[264] - Qi[102] * Ci[264]
+	+ Qr[78] * Cr[288] - Qi[78] * Ci[288]
+	+ Qr[46] * Cr[320] - Qi[46] * Ci[320]
+	- 4. * Cr[366];
+      Ci[366] =
+	Qr[354] * Ci[12] + Qi[354] * Cr[12]
+	+ Qr[330] * Ci[36] + Qi[330] * Cr[36]
+	+ Qr[326] * Ci[40] + Qi[326] * Cr[40]
+	+ Qr[298] * Ci[68] + Qi[298] * Cr[68]
+	+ Qr[294] * Ci[72] + Qi[294] * Cr[72]
+	+ Qr[270] * Ci[96] + Qi[270] * Cr[96]
+	+ Qr[106] * Ci[260] + Qi[106] * Cr[260]
+	+ Qr[102] * Ci[264] + Qi[102] * Cr[264]
+	+ Qr[78] * Ci[288] + Qi[78] * Cr[288]
+	+ Qr[46] * Ci[320] + Qi[46] * Cr[320]
+	- 4. * Ci[366];
+      Cr[366] =
+	Qr[322] * Cr[44] - Qi[322] * Ci[44]
+	+ Qr[290] * Cr[76] - Qi[290] * Ci[76]
+	+ Qr[266] * Cr[100] - Qi[266] * Ci[100]
+	+ Qr[262] * Cr[104] - Qi[262] * Ci[104]
+	+ Qr[98] * Cr[268] - Qi[98] * Ci[268]
+	+ Qr[74] * Cr[292] - Qi[74] * Ci[292]
+	+ Qr[70] * Cr[296] - Qi[70] * Ci[296]
+	+ Qr[42] * Cr[324] - Qi[42] * Ci[324]
+	+ Qr[38] * Cr[328] - Qi[38] * Ci[328]
+	+ Qr[14] * Cr[352] - Qi[14] * Ci[352]
+	- 3. * Cr[366];
+      Ci[366] =
+	Qr[322] * Ci[44] + Qi[322] * Cr[44]
+	+ Qr[290] * Ci[76] + Qi[290] * Cr[76]
+	+ Qr[266] * Ci[100] + Qi[266] * Cr[100]
+	+ Qr[262] * Ci[104] + Qi[262] * Cr[104]
+	+ Qr[98] * Ci[268] + Qi[98] * Cr[268]
+	+ Qr[74] * Ci[292] + Qi[74] * Cr[292]
+	+ Qr[70] * Ci[296] + Qi[70] * Cr[296]
+	+ Qr[42] * Ci[324] + Qi[42] * Cr[324]
+	+ Qr[38] * Ci[328] + Qi[38] * Cr[328]
+	+ Qr[14] * Ci[352] + Qi[14] * Cr[352]
+	- 3. * Ci[366];
+      Cr[366] =
+	Qr[258] * Cr[108] - Qi[258] * Ci[108]
+	+ Qr[66] * Cr[300] - Qi[66] * Ci[300]
+	+ Qr[34] * Cr[332] - Qi[34] * Ci[332]
+	+ Qr[10] * Cr[356] - Qi[10] * Ci[356]
+	+ Qr[6] * Cr[360] - Qi[6] * Ci[360]
+	- 2. * Cr[366];
+      Ci[366] =
+	Qr[258] * Ci[108] + Qi[258] * Cr[108]
+	+ Qr[66] * Ci[300] + Qi[66] * Cr[300]
+	+ Qr[34] * Ci[332] + Qi[34] * Cr[332]
+	+ Qr[10] * Ci[356] + Qi[10] * Cr[356]
+	+ Qr[6] * Ci[360] + Qi[6] * Cr[360]
+	- 2. * Ci[366];
+      Cr[366] =
+	Qr[2] * Cr[364] - Qi[2] * Ci[364]
+	- Cr[366];
+      Ci[366] =
+	Qr[2] * Ci[364] + Qi[2] * Cr[364]
+	- Ci[366];
+
+      Cr[368] =
+	Qr[368];
+      Ci[368] =
+	Qi[368];
+      Cr[368] =
+	Qr[336] * Cr[32] - Qi[336] * Ci[32]
+	+ Qr[304] * Cr[64] - Qi[304] * Ci[64]
+	+ Qr[112] * Cr[256] - Qi[112] * Ci[256]
+	- 3. * Cr[368];
+      Ci[368] =
+	Qr[336] * Ci[32] + Qi[336] * Cr[32]
+	+ Qr[304] * Ci[64] + Qi[304] * Cr[64]
+	+ Qr[112] * Ci[256] + Qi[112] * Cr[256]
+	- 3. * Ci[368];
+      Cr[368] =
+	Qr[272] * Cr[96] - Qi[272] * Ci[96]
+	+ Qr[80] * Cr[288] - Qi[80] * Ci[288]
+	+ Qr[48] * Cr[320] - Qi[48] * Ci[320]
+	- 2. * Cr[368];
+      Ci[368] =
+	Qr[272] * Ci[96] + Qi[272] * Cr[96]
+	+ Qr[80] * Ci[288] + Qi[80] * Cr[288]
+	+ Qr[48] * Ci[320] + Qi[48] * Cr[320]
+	- 2. * Ci[368];
+      Cr[368] =
+	Qr[16] * Cr[352] - Qi[16] * Ci[352]
+	- Cr[368];
+      Ci[368] =
+	Qr[16] * Ci[352] + Qi[16] * Cr[352]
+	- Ci[368];
+
+      Cr[370] =
+	Qr[370];
+      Ci[370] =
+	Qi[370];
+      Cr[370] =
+	Qr[354] * Cr[16] - Qi[354] * Ci[16]
+	+ Qr[338] * Cr[32] - Qi[338] * Ci[32]
+	+ Qr[306] * Cr[64] - Qi[306] * Ci[64]
+	+ Qr[114] * Cr[256] - Qi[114] * Ci[256]
+	- 4. * Cr[370];
+      Ci[370] =
+	Qr[354] * Ci[16] + Qi[354] * Cr[16]
+	+ Qr[338] * Ci[32] + Qi[338] * Cr[32]
+	+ Qr[306] * Ci[64] + Qi[306] * Cr[64]
+	+ Qr[114] * Ci[256] + Qi[114] * Cr[256]
+	- 4. * Ci[370];
+      Cr[370] =
+	Qr[322] * Cr[48] - Qi[322] * Ci[48]
+	+ Qr[290] * Cr[80] - Qi[290] * Ci[80]
+	+ Qr[274] * Cr[96] - Qi[274] * Ci[96]
+	+ Qr[98] * Cr[272] - Qi[98] * Ci[272]
+	+ Qr[82] * Cr[288] - Qi[82] * Ci[288]
+	+ Qr[50] * Cr[320] - Qi[50] * Ci[320]
+	- 3. * Cr[370];
+      Ci[370] =
+	Qr[322] * Ci[48] + Qi[322] * Cr[48]
+	+ Qr[290] * Ci[80] + Qi[290] * Cr[80]
+	+ Qr[274] * Ci[96] + Qi[274] * Cr[96]
+	+ Qr[98] * Ci[272] + Qi[98] * Cr[272]
+	+ Qr[82] * Ci[288] + Qi[82] * Cr[288]
+	+ Qr[50] * Ci[320] + Qi[50] * Cr[320]
+	- 3. * Ci[370];
+      Cr[370] =
+	Qr[258] * Cr[112] - Qi[258] * Ci[112]
+	+ Qr[66] * Cr[304] - Qi[66] * Ci[304]
+	+ Qr[34] * Cr[336] - Qi[34] * Ci[336]
+	+ Qr[18] * Cr[352] - Qi[18] * Ci[352]
+	- 2. * Cr[370];
+      Ci[370] =
+	Qr[258] * Ci[112] + Qi[258] * Cr[112]
+	+ Qr[66] * Ci[304] + Qi[66] * Cr[304]
+	+ Qr[34] * Ci[336] + Qi[34] * Cr[336]
+	+ Qr[18] * Ci[352] + Qi[18] * Cr[352]
+	- 2. * Ci[370];
+      Cr[370] =
+	Qr[2] * Cr[368] - Qi[2] * Ci[368]
+	- Cr[370];
+      Ci[370] =
+	Qr[2] * Ci[368] + Qi[2] * Cr[368]
+	- Ci[370];
+    }
+
+    /** Part 12 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part12(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[372] =
+	Qr[372];
+      Ci[372] =
+	Qi[372];
+      Cr[372] =
+	Qr[356] * Cr[16] - Qi[356] * Ci[16]
+	+ Qr[340] * Cr[32] - Qi[340] * Ci[32]
+	+ Qr[308] * Cr[64] - Qi[308] * Ci[64]
+	+ Qr[116] * Cr[256] - Qi[116] * Ci[256]
+	- 4. * Cr[372];
+      Ci[372] =
+	Qr[356] * Ci[16] + Qi[356] * Cr[16]
+	+ Qr[340] * Ci[32] + Qi[340] * Cr[32]
+	+ Qr[308] * Ci[64] + Qi[308] * Cr[64]
+	+ Qr[116] * Ci[256] + Qi[116] * Cr[256]
+	- 4. * Ci[372];
+      Cr[372] =
+	Qr[324] * Cr[48] - Qi[324] * Ci[48]
+	+ Qr[292] * Cr[80] - Qi[292] * Ci[80]
+	+ Qr[276] * Cr[96] - Qi[276] * Ci[96]
+	+ Qr[100] * Cr[272] - Qi[100] * Ci[272]
+	+ Qr[84] * Cr[288] - Qi[84] * Ci[288]
+	+ Qr[52] * Cr[320] - Qi[52] * Ci[320]
+	- 3. * Cr[372];
+      Ci[372] =
+	Qr[324] * Ci[48] + Qi[324] * Cr[48]
+	+ Qr[292] * Ci[80] + Qi[292] * Cr[80]
+	+ Qr[276] * Ci[96] + Qi[276] * Cr[96]
+	+ Qr[100] * Ci[272] + Qi[100] * Cr[272]
+	+ Qr[84] * Ci[288] + Qi[84] * Cr[288]
+	+ Qr[52] * Ci[320] + Qi[52] * Cr[320]
+	- 3. * Ci[372];
+      Cr[372] =
+	Qr[260] * Cr[112] - Qi[260] * Ci[112]
+	+ Qr[68] * Cr[304] - Qi[68] * Ci[304]
+	+ Qr[36] * Cr[336] - Qi[36] * Ci[336]
+	+ Qr[20] * Cr[352] - Qi[20] * Ci[352]
+	- 2. * Cr[372];
+      Ci[372] =
+	Qr[260] * Ci[112] + Qi[260] * Cr[112]
+	+ Qr[68] * Ci[304] + Qi[68] * Cr[304]
+	+ Qr[36] * Ci[336] + Qi[36] * Cr[336]
+	+ Qr[20] * Ci[352] + Qi[20] * Cr[352]
+	- 2. * Ci[372];
+      Cr[372] =
+	Qr[4] * Cr[368] - Qi[4] * Ci[368]
+	- Cr[372];
+      Ci[372] =
+	Qr[4] * Ci[368] + Qi[4] * Cr[368]
+	- Ci[372];
+
+      Cr[374] =
+	Qr[374];
+      Ci[374] =
+	Qi[374];
+      Cr[374] =
+	Qr[370] * Cr[4] - Qi[370] * Ci[4]
+	+ Qr[358] * Cr[16] - Qi[358] * Ci[16]
+	+ Qr[342] * Cr[32] - Qi[342] * Ci[32]
+	+ Qr[310] * Cr[64] - Qi[310] * Ci[64]
+	+ Qr[118] * Cr[256] - Qi[118] * Ci[256]
+	- 5. * Cr[374];
+      Ci[374] =
+	Qr[370] * Ci[4] + Qi[370] * Cr[4]
+	+ Qr[358] * Ci[16] + Qi[358] * Cr[16]
+	+ Qr[342] * Ci[32] + Qi[342] * Cr[32]
+	+ Qr[310] * Ci[64] + Qi[310] * Cr[64]
+	+ Qr[118] * Ci[256] + Qi[118] * Cr[256]
+	- 5. * Ci[374];
+      Cr[374] =
+	Qr[354] * Cr[20] - Qi[354] * Ci[20]
+	+ Qr[338] * Cr[36] - Qi[338] * Ci[36]
+	+ Qr[326] * Cr[48] - Qi[326] * Ci[48]
+	+ Qr[306] * Cr[68] - Qi[306] * Ci[68]
+	+ Qr[294] * Cr[80] - Qi[294] * Ci[80]
+	+ Qr[278] * Cr[96] - Qi[278] * Ci[96]
+	+ Qr[114] * Cr[260] - Qi[114] * Ci[260]
+	+ Qr[102] * Cr[272] - Qi[102] * Ci[272]
+	+ Qr[86] * Cr[288] - Qi[86] * Ci[288]
+	+ Qr[54] * Cr[320] - Qi[54] * Ci[320]
+	- 4. * Cr[374];
+      Ci[374] =
+	Qr[354] * Ci[20] + Qi[354] * Cr[20]
+	+ Qr[338] * Ci[36] + Qi[338] * Cr[36]
+	+ Qr[326] * Ci[48] + Qi[326] * Cr[48]
+	+ Qr[306] * Ci[68] + Qi[306] * Cr[68]
+	+ Qr[294] * Ci[80] + Qi[294] * Cr[80]
+	+ Qr[278] * Ci[96] + Qi[278] * Cr[96]
+	+ Qr[114] * Ci[260] + Qi[114] * Cr[260]
+	+ Qr[102] * Ci[272] + Qi[102] * Cr[272]
+	+ Qr[86] * Ci[288] + Qi[86] * Cr[288]
+	+ Qr[54] * Ci[320] + Qi[54] * Cr[320]
+	- 4. * Ci[374];
+      Cr[374] =
+	Qr[322] * Cr[52] - Qi[322] * Ci[52]
+	+ Qr[290] * Cr[84] - Qi[290] * Ci[84]
+	+ Qr[274] * Cr[100] - Qi[274] * Ci[100]
+	+ Qr[262] * Cr[112] - Qi[262] * Ci[112]
+	+ Qr[98] * Cr[276] - Qi[98] * Ci[276]
+	+ Qr[82] * Cr[292] - Qi[82] * Ci[292]
+	+ Qr[70] * Cr[304] - Qi[70] * Ci[304]
+	+ Qr[50] * Cr[324] - Qi[50] * Ci[324]
+	+ Qr[38] * Cr[336] - Qi[38] * Ci[336]
+	+ Qr[22] * Cr[352] - Qi[22] * Ci[352]
+	- 3. * Cr[374];
+      Ci[374] =
+	Qr[322] * Ci[52] + Qi[322] * Cr[52]
+	+ Qr[290] * Ci[84] + Qi[290] * Cr[84]
+	+ Qr[274] * Ci[100] + Qi[274] * Cr[100]
+	+ Qr[262] * Ci[112] + Qi[262] * Cr[112]
+	+ Qr[98] * Ci[276] + Qi[98] * Cr[276]
+	+ Qr[82] * Ci[292] + Qi[82] * Cr[292]
+	+ Qr[70] * Ci[304] + Qi[70] * Cr[304]
+	+ Qr[50] * Ci[324] + Qi[50] * Cr[324]
+	+ Qr[38] * Ci[336] + Qi[38] * Cr[336]
+	+ Qr[22] * Ci[352] + Qi[22] * Cr[352]
+	- 3. * Ci[374];
+      Cr[374] =
+	Qr[258] * Cr[116] - Qi[258] * Ci[116]
+	+ Qr[66] * Cr[308] - Qi[66] * Ci[308]
+	+ Qr[34] * Cr[340] - Qi[34] * Ci[340]
+	+ Qr[18] * Cr[356] - Qi[18] * Ci[356]
+	+ Qr[6] * Cr[368] - Qi[6] * Ci[368]
+	- 2. * Cr[374];
+      Ci[374] =
+	Qr[258] * Ci[116] + Qi[258] * Cr[116]
+	+ Qr[66] * Ci[308] + Qi[66] * Cr[308]
+	+ Qr[34] * Ci[340] + Qi[34] * Cr[340]
+	+ Qr[18] * Ci[356] + Qi[18] * Cr[356]
+	+ Qr[6] * Ci[368] + Qi[6] * Cr[368]
+	- 2. * Ci[374];
+      Cr[374] =
+	Qr[2] * Cr[372] - Qi[2] * Ci[372]
+	- Cr[374];
+      Ci[374] =
+	Qr[2] * Ci[372] + Qi[2] * Cr[372]
+	- Ci[374];
+
+      Cr[376] =
+	Qr[376];
+      Ci[376] =
+	Qi[376];
+      Cr[376] =
+	Qr[360] * Cr[16] - Qi[360] * Ci[16]
+	+ Qr[344] * Cr[32] - Qi[344] * Ci[32]
+	+ Qr[312] * Cr[64] - Qi[312] * Ci[64]
+	+ Qr[120] * Cr[256] - Qi[120] * Ci[256]
+	- 4. * Cr[376];
+      Ci[376] =
+	Qr[360] * Ci[16] + Qi[360] * Cr[16]
+	+ Qr[344] * Ci[32] + Qi[344] * Cr[32]
+	+ Qr[312] * Ci[64] + Qi[312] * Cr[64]
+	+ Qr[120] * Ci[256] + Qi[120] * Cr[256]
+	- 4. * Ci[376];
+      Cr[376] =
+	Qr[328] * Cr[48] - Qi[328] * Ci[48]
+	+ Qr[296] * Cr[80] - Qi[296] * Ci[80]
+	+ Qr[280] * Cr[96] - Qi[280] * Ci[96]
+	+ Qr[104] * Cr[272] - Qi[104] * Ci[272]
+	+ Qr[88] * Cr[288] - Qi[88] * Ci[288]
+	+ Qr[56] * Cr[320] - Qi[56] * Ci[320]
+	- 3. * Cr[376];
+      Ci[376] =
+	Qr[328] * Ci[48] + Qi[328] * Cr[48]
+	+ Qr[296] * Ci[80] + Qi[296] * Cr[80]
+	+ Qr[280] * Ci[96] + Qi[280] * Cr[96]
+	+ Qr[104] * Ci[272] + Qi[104] * Cr[272]
+	+ Qr[88] * Ci[288] + Qi[88] * Cr[288]
+	+ Qr[56] * Ci[320] + Qi[56] * Cr[320]
+	- 3. * Ci[376];
+      Cr[376] =
+	Qr[264] * Cr[112] - Qi[264] * Ci[112]
+	+ Qr[72] * Cr[304] - Qi[72] * Ci[304]
+	+ Qr[40] * Cr[336] - Qi[40] * Ci[336]
+	+ Qr[24] * Cr[352] - Qi[24] * Ci[352]
+	- 2. * Cr[376];
+      Ci[376] =
+	Qr[264] * Ci[112] + Qi[264] * Cr[112]
+	+ Qr[72] * Ci[304] + Qi[72] * Cr[304]
+	+ Qr[40] * Ci[336] + Qi[40] * Cr[336]
+	+ Qr[24] * Ci[352] + Qi[24] * Cr[352]
+	- 2. * Ci[376];
+      Cr[376] =
+	Qr[8] * Cr[368] - Qi[8] * Ci[368]
+	- Cr[376];
+      Ci[376] =
+	Qr[8] * Ci[368] + Qi[8] * Cr[368]
+	- Ci[376];
+
+      Cr[378] =
+	Qr[378];
+      Ci[378] =
+	Qi[378];
+      Cr[378] =
+	Qr[370] * Cr[8] - Qi[370] * Ci[8]
+	+ Qr[362] * Cr[16] - Qi[362] * Ci[16]
+	+ Qr[346] * Cr[32] - Qi[346] * Ci[32]
+	+ Qr[314] * Cr[64] - Qi[314] * Ci[64]
+	+ Qr[122] * Cr[256] - Qi[122] * Ci[256]
+	- 5. * Cr[378];
+      Ci[378] =
+	Qr[370] * Ci[8] + Qi[370] * Cr[8]
+	+ Qr[362] * Ci[16] + Qi[362] * Cr[16]
+	+ Qr[346] * Ci[32] + Qi[346] * Cr[32]
+	+ Qr[314] * Ci[64] + Qi[314] * Cr[64]
+	+ Qr[122] * Ci[256] + Qi[122] * Cr[256]
+	- 5. * Ci[378];
+      Cr[378] =
+	Qr[354] * Cr[24] - Qi[354] * Ci[24]
+	+ Qr[338] * Cr[40] - Qi[338] * Ci[40]
+	+ Qr[330] * Cr[48] - Qi[330] * Ci[48]
+	+ Qr[306] * Cr[72] - Qi[306] * Ci[72]
+	+ Qr[298] * Cr[80] - Qi[298] * Ci[80]
+	+ Qr[282] * Cr[96] - Qi[282] * Ci[96]
+	+ Qr[114] * Cr[264] - Qi[114] * Ci[264]
+	+ Qr[106] * Cr[272] - Qi[106] * Ci[272]
+	+ Qr[90] * Cr[288] - Qi[90] * Ci[288]
+	+ Qr[58] * Cr[320] - Qi[58] * Ci[320]
+	- 4. * Cr[378];
+      Ci[378] =
+	Qr[354] * Ci[24] + Qi[354] * Cr[24]
+	+ Qr[338] * Ci[40] + Qi[338] * Cr[40]
+	+ Qr[330] * Ci[48] + Qi[330] * Cr[48]
+	+ Qr[306] * Ci[72] + Qi[306] * Cr[72]
+	+ Qr[298] * Ci[80] + Qi[298] * Cr[80]
+	+ Qr[282] * Ci[96] + Qi[282] * Cr[96]
+	+ Qr[114] * Ci[264] + Qi[114] * Cr[264]
+	+ Qr[106] * Ci[272] + Qi[106] * Cr[272]
+	+ Qr[90] * Ci[288] + Qi[90] * Cr[288]
+	+ Qr[58] * Ci[320] + Qi[58] * Cr[320]
+	- 4. * Ci[378];
+      Cr[378] =
+	Qr[322] * Cr[56] - Qi[322] * Ci[56]
+	+ Qr[290] * Cr[88] - Qi[290] * Ci[88]
+	+ Qr[274] * Cr[104] - Qi[274] * Ci[104]
+	+ Qr[266] * Cr[112] - Qi[266] * Ci[112]
+	+ Qr[98] * Cr[280] - Qi[98] * Ci[280]
+	+ Qr[82] * Cr[296] - Qi[82] * Ci[296]
+	+ Qr[74] * Cr[304] - Qi[74] * Ci[304]
+	+ Qr[50] * Cr[328] - Qi[50] * Ci[328]
+	+ Qr[42] * Cr[336] - Qi[42] * Ci[336]
+	+ Qr[26] * Cr[352] - Qi[26] * Ci[352]
+	- 3. * Cr[378];
+      Ci[378] =
+	Qr[322] * Ci[56] + Qi[322] * Cr[56]
+	+ Qr[290] * Ci[88] + Qi[290] * Cr[88]
+	+ Qr[274] * Ci[104] + Qi[274] * Cr[104]
+	+ Qr[266] * Ci[112] + Qi[266] * Cr[112]
+	+ Qr[98] * Ci[280] + Qi[98] * Cr[280]
+	+ Qr[82] * Ci[296] + Qi[82] * Cr[296]
+	+ Qr[74] * Ci[304] + Qi[74] * Cr[304]
+	+ Qr[50] * Ci[328] + Qi[50] * Cr[328]
+	+ Qr[42] * Ci[336] + Qi[42] * Cr[336]
+	+ Qr[26] * Ci[352] + Qi[26] * Cr[352]
+	- 3. * Ci[378];
+      Cr[378] =
+	Qr[258] * Cr[120] - Qi[258] * Ci[120]
+	+ Qr[66] * Cr[312] - Qi[66] * Ci[312]
+	+ Qr[34] * Cr[344] - Qi[34] * Ci[344]
+	+ Qr[18] * Cr[360] - Qi[18] * Ci[360]
+	+ Qr[10] * Cr[368] - Qi[10] * Ci[368]
+	- 2. * Cr[378];
+      Ci[378] =
+	Qr[258] * Ci[120] + Qi[258] * Cr[120]
+	+ Qr[66] * Ci[312] + Qi[66] * Cr[312]
+	+ Qr[34] * Ci[344] + Qi[34] * Cr[344]
+	+ Qr[18] * Ci[360] + Qi[18] * Cr[360]
+	+ Qr[10] * Ci[368] + Qi[10] * Cr[368]
+	- 2. * Ci[378];
+      Cr[378] =
+	Qr[2] * Cr[376] - Qi[2] * Ci[376]
+	- Cr[378];
+      Ci[378] =
+	Qr[2] * Ci[376] + Qi[2] * Cr[376]
+	- Ci[378];
+
+      Cr[380] =
+	Qr[380];
+      Ci[380] =
+	Qi[380];
+      Cr[380] =
+	Qr[372] * Cr[8] - Qi[372] * Ci[8]
+	+ Qr[364] * Cr[16] - Qi[364] * Ci[16]
+	+ Qr[348] * Cr[32] - Qi[348] * Ci[32]
+	+ Qr[316] * Cr[64] - Qi[316] * Ci[64]
+	+ Qr[124] * Cr[256] - Qi[124] * Ci[256]
+	- 5. * Cr[380];
+      Ci[380] =
+	Qr[372] * Ci[8] + Qi[372] * Cr[8]
+	+ Qr[364] * Ci[16] + Qi[364] * Cr[16]
+	+ Qr[348] * Ci[32] + Qi[348] * Cr[32]
+	+ Qr[316] * Ci[64] + Qi[316] * Cr[64]
+	+ Qr[124] * Ci[256] + Qi[124] * Cr[256]
+	- 5. * Ci[380];
+      Cr[380] =
+	Qr[356] * Cr[24] - Qi[356] * Ci[24]
+	+ Qr[340] * Cr[40] - Qi[340] * Ci[40]
+	+ Qr[332] * Cr[48] - Qi[332] * Ci[48]
+	+ Qr[308] * Cr[72] - Qi[308] * Ci[72]
+	+ Qr[300] * Cr[80] - Qi[300] * Ci[80]
+	+ Qr[284] * Cr[96] - Qi[284] * Ci[96]
+	+ Qr[116] * Cr[264] - Qi[116] * Ci[264]
+	+ Qr[108] * Cr[272] - Qi[108] * Ci[272]
+	+ Qr[92] * Cr[288] - Qi[92] * Ci[288]
+	+ Qr[60] * Cr[320] - Qi[60] * Ci[320]
+	- 4. * Cr[380];
+      Ci[380] =
+	Qr[356] * Ci[24] + Qi[356] * Cr[24]
+	+ Qr[340] * Ci[40] + Qi[340] * Cr[40]
+	+ Qr[332] * Ci[48] + Qi[332] * Cr[48]
+	+ Qr[308] * Ci[72] + Qi[308] * Cr[72]
+	+ Qr[300] * Ci[80] + Qi[300] * Cr[80]
+	+ Qr[284] * Ci[96] + Qi[284] * Cr[96]
+	+ Qr[116] * Ci[264] + Qi[116] * Cr[264]
+	+ Qr[108] * Ci[272] + Qi[108] * Cr[272]
+	+ Qr[92] * Ci[288] + Qi[92] * Cr[288]
+	+ Qr[60] * Ci[320] + Qi[60] * Cr[320]
+	- 4. * Ci[380];
+      Cr[380] =
+	Qr[324] * Cr[56] - Qi[324] * Ci[56]
+	+ Qr[292] * Cr[88] - Qi[292] * Ci[88]
+	+ Qr[276] * Cr[104] - Qi[276] * Ci[104]
+	+ Qr[268] * Cr[112] - Qi[268] * Ci[112]
+	+ Qr[100] * Cr[280] - Qi[100] * Ci[280]
+	+ Qr[84] * Cr[296] - Qi[84] * Ci[296]
+	+ Qr[76] * Cr[304] - Qi[76] * Ci[304]
+	+ Qr[52] * Cr[328] - Qi[52] * Ci[328]
+	+ Qr[44] * Cr[336] - Qi[44] * Ci[336]
+	+ Qr[28] * Cr[352] - Qi[28] * Ci[352]
+	- 3. * Cr[380];
+      Ci[380] =
+	Qr[324] * Ci[56] + Qi[324] * Cr[56]
+	+ Qr[292] * Ci[88] + Qi[292] * Cr[88]
+	+ Qr[276] * Ci[104] + Qi[276] * Cr[104]
+	+ Qr[268] * Ci[112] + Qi[268] * Cr[112]
+	+ Qr[100] * Ci[280] + Qi[100] * Cr[280]
+	+ Qr[84] * Ci[296] + Qi[84] * Cr[296]
+	+ Qr[76] * Ci[304] + Qi[76] * Cr[304]
+	+ Qr[52] * Ci[328] + Qi[52] * Cr[328]
+	+ Qr[44] * Ci[336] + Qi[44] * Cr[336]
+	+ Qr[28] * Ci[352] + Qi[28] * Cr[352]
+	- 3. * Ci[380];
+      Cr[380] =
+	Qr[260] * Cr[120] - Qi[260] * Ci[120]
+	+ Qr[68] * Cr[312] - Qi[68] * Ci[312]
+	+ Qr[36] * Cr[344] - Qi[36] * Ci[344]
+	+ Qr[20] * Cr[360] - Qi[20] * Ci[360]
+	+ Qr[12] * Cr[368] - Qi[12] * Ci[368]
+	- 2. * Cr[380];
+      Ci[380] =
+	Qr[260] * Ci[120] + Qi[260] * Cr[120]
+	+ Qr[68] * Ci[312] + Qi[68] * Cr[312]
+	+ Qr[36] * Ci[344] + Qi[36] * Cr[344]
+	+ Qr[20] * Ci[360] + Qi[20] * Cr[360]
+	+ Qr[12] * Ci[368] + Qi[12] * Cr[368]
+	- 2. * Ci[380];
+      Cr[380] =
+	Qr[4] * Cr[376] - Qi[4] * Ci[376]
+	- Cr[380];
+      Ci[380] =
+	Qr[4] * Ci[376] + Qi[4] * Cr[376]
+	- Ci[380];
+    }
+
+    /** Part 13 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part13(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[382] =
+	Qr[382];
+      Ci[382] =
+	Qi[382];
+      Cr[382] =
+	Qr[378] * Cr[4] - Qi[378] * Ci[4]
+	+ Qr[374] * Cr[8] - Qi[374] * Ci[8]
+	+ Qr[366] * Cr[16] - Qi[366] * Ci[16]
+	+ Qr[350] * Cr[32] - Qi[350] * Ci[32]
+	+ Qr[318] * Cr[64] - Qi[318] * Ci[64]
+	+ Qr[126] * Cr[256] - Qi[126] * Ci[256]
+	- 6. * Cr[382];
+      Ci[382] =
+	Qr[378] * Ci[4] + Qi[378] * Cr[4]
+	+ Qr[374] * Ci[8] + Qi[374] * Cr[8]
+	+ Qr[366] * Ci[16] + Qi[366] * Cr[16]
+	+ Qr[350] * Ci[32] + Qi[350] * Cr[32]
+	+ Qr[318] * Ci[64] + Qi[318] * Cr[64]
+	+ Qr[126] * Ci[256] + Qi[126] * Cr[256]
+	- 6. * Ci[382];
+      Cr[382] =
+	Qr[370] * Cr[12] - Qi[370] * Ci[12]
+	+ Qr[362] * Cr[20] - Qi[362] * Ci[20]
+	+ Qr[358] * Cr[24] - Qi[358] * Ci[24]
+	+ Qr[346] * Cr[36] - Qi[346] * Ci[36]
+	+ Qr[342] * Cr[40] - Qi[342] * Ci[40]
+	+ Qr[334] * Cr[48] - Qi[334] * Ci[48]
+	+ Qr[314] * Cr[68] - Qi[314] * Ci[68]
+	+ Qr[310] * Cr[72] - Qi[310] * Ci[72]
+	+ Qr[302] * Cr[80] - Qi[302] * Ci[80]
+	+ Qr[286] * Cr[96] - Qi[286] * Ci[96]
+	+ Qr[122] * Cr[260] - Qi[122] * Ci[260]
+	+ Qr[118] * Cr[264] - Qi[118] * Ci[264]
+	+ Qr[110] * Cr[272] - Qi[110] * Ci[272]
+	+ Qr[94] * Cr[288] - Qi[94] * Ci[288]
+	+ Qr[62] * Cr[320] - Qi[62] * Ci[320]
+	- 5. * Cr[382];
+      Ci[382] =
+	Qr[370] * Ci[12] + Qi[370] * Cr[12]
+	+ Qr[362] * Ci[20] + Qi[362] * Cr[20]
+	+ Qr[358] * Ci[24] + Qi[358] * Cr[24]
+	+ Qr[346] * Ci[36] + Qi[346] * Cr[36]
+	+ Qr[342] * Ci[40] + Qi[342] * Cr[40]
+	+ Qr[334] * Ci[48] + Qi[334] * Cr[48]
+	+ Qr[314] * Ci[68] + Qi[314] * Cr[68]
+	+ Qr[310] * Ci[72] + Qi[310] * Cr[72]
+	+ Qr[302] * Ci[80] + Qi[302] * Cr[80]
+	+ Qr[286] * Ci[96] + Qi[286] * Cr[96]
+	+ Qr[122] * Ci[260] + Qi[122] * Cr[260]
+	+ Qr[118] * Ci[264] + Qi[118] * Cr[264]
+	+ Qr[110] * Ci[272] + Qi[110] * Cr[272]
+	+ Qr[94] * Ci[288] + Qi[94] * Cr[288]
+	+ Qr[62] * Ci[320] + Qi[62] * Cr[320]
+	- 5. * Ci[382];
+      Cr[382] =
+	Qr[354] * Cr[28] - Qi[354] * Ci[28]
+	+ Qr[338] * Cr[44] - Qi[338] * Ci[44]
+	+ Qr[330] * Cr[52] - Qi[330] * Ci[52]
+	+ Qr[326] * Cr[56] - Qi[326] * Ci[56]
+	+ Qr[306] * Cr[76] - Qi[306] * Ci[76]
+	+ Qr[298] * Cr[84] - Qi[298] * Ci[84]
+	+ Qr[294] * Cr[88] - Qi[294] * Ci[88]
+	+ Qr[282] * Cr[100] - Qi[282] * Ci[100]
+	+ Qr[278] * Cr[104] - Qi[278] * Ci[104]
+	+ Qr[270] * Cr[112] - Qi[270] * Ci[112]
+	+ Qr[114] * Cr[268] - Qi[114] * Ci[268]
+	+ Qr[106] * Cr[276] - Qi[106] * Ci[276]
+	+ Qr[102] * Cr[280] - Qi[102] * Ci[280]
+	+ Qr[90] * Cr[292] - Qi[90] * Ci[292]
+	+ Qr[86] * Cr[296] - Qi[86] * Ci[296]
+	+ Qr[78] * Cr[304] - Qi[78] * Ci[304]
+	+ Qr[58] * Cr[324] - Qi[58] * Ci[324]
+	+ Qr[54] * Cr[328] - Qi[54] * Ci[328]
+	+ Qr[46] * Cr[336] - Qi[46] * Ci[336]
+	+ Qr[30] * Cr[352] - Qi[30] * Ci[352]
+	- 4. * Cr[382];
+      Ci[382] =
+	Qr[354] * Ci[28] + Qi[354] * Cr[28]
+	+ Qr[338] * Ci[44] + Qi[338] * Cr[44]
+	+ Qr[330] * Ci[52] + Qi[330] * Cr[52]
+	+ Qr[326] * Ci[56] + Qi[326] * Cr[56]
+	+ Qr[306] * Ci[76] + Qi[306] * Cr[76]
+	+ Qr[298] * Ci[84] + Qi[298] * Cr[84]
+	+ Qr[294] * Ci[88] + Qi[294] * Cr[88]
+	+ Qr[282] * Ci[100] + Qi[282] * Cr[100]
+	+ Qr[278] * Ci[104] + Qi[278] * Cr[104]
+	+ Qr[270] * Ci[112] + Qi[270] * Cr[112]
+	+ Qr[114] * Ci[268] + Qi[114] * Cr[268]
+	+ Qr[106] * Ci[276] + Qi[106] * Cr[276]
+	+ Qr[102] * Ci[280] + Qi[102] * Cr[280]
+	+ Qr[90] * Ci[292] + Qi[90] * Cr[292]
+	+ Qr[86] * Ci[296] + Qi[86] * Cr[296]
+	+ Qr[78] * Ci[304] + Qi[78] * Cr[304]
+	+ Qr[58] * Ci[324] + Qi[58] * Cr[324]
+	+ Qr[54] * Ci[328] + Qi[54] * Cr[328]
+	+ Qr[46] * Ci[336] + Qi[46] * Cr[336]
+	+ Qr[30] * Ci[352] + Qi[30] * Cr[352]
+	- 4. * Ci[382];
+      Cr[382] =
+	Qr[322] * Cr[60] - Qi[322] * Ci[60]
+	+ Qr[290] * Cr[92] - Qi[290] * Ci[92]
+	+ Qr[274] * Cr[108] - Qi[274] * Ci[108]
+	+ Qr[266] * Cr[116] - Qi[266] * Ci[116]
+	+ Qr[262] * Cr[120] - Qi[262] * Ci[120]
+	+ Qr[98] * Cr[284] - Qi[98] * Ci[284]
+	+ Qr[82] * Cr[300] - Qi[82] * Ci[300]
+	+ Qr[74] * Cr[308] - Qi[74] * Ci[308]
+	+ Qr[70] * Cr[312] - Qi[70] * Ci[312]
+	+ Qr[50] * Cr[332] - Qi[50] * Ci[332]
+	+ Qr[42] * Cr[340] - Qi[42] * Ci[340]
+	+ Qr[38] * Cr[344] - Qi[38] * Ci[344]
+	+ Qr[26] * Cr[356] - Qi[26] * Ci[356]
+	+ Qr[22] * Cr[360] - Qi[22] * Ci[360]
+	+ Qr[14] * Cr[368] - Qi[14] * Ci[368]
+	- 3. * Cr[382];
+      Ci[382] =
+	Qr[322] * Ci[60] + Qi[322] * Cr[60]
+	+ Qr[290] * Ci[92] + Qi[290] * Cr[92]
+	+ Qr[274] * Ci[108] + Qi[274] * Cr[108]
+	+ Qr[266] * Ci[116] + Qi[266] * Cr[116]
+	+ Qr[262] * Ci[120] + Qi[262] * Cr[120]
+	+ Qr[98] * Ci[284] + Qi[98] * Cr[284]
+	+ Qr[82] * Ci[300] + Qi[82] * Cr[300]
+	+ Qr[74] * Ci[308] + Qi[74] * Cr[308]
+	+ Qr[70] * Ci[312] + Qi[70] * Cr[312]
+	+ Qr[50] * Ci[332] + Qi[50] * Cr[332]
+	+ Qr[42] * Ci[340] + Qi[42] * Cr[340]
+	+ Qr[38] * Ci[344] + Qi[38] * Cr[344]
+	+ Qr[26] * Ci[356] + Qi[26] * Cr[356]
+	+ Qr[22] * Ci[360] + Qi[22] * Cr[360]
+	+ Qr[14] * Ci[368] + Qi[14] * Cr[368]
+	- 3. * Ci[382];
+      Cr[382] =
+	Qr[258] * Cr[124] - Qi[258] * Ci[124]
+	+ Qr[66] * Cr[316] - Qi[66] * Ci[316]
+	+ Qr[34] * Cr[348] - Qi[34] * Ci[348]
+	+ Qr[18] * Cr[364] - Qi[18] * Ci[364]
+	+ Qr[10] * Cr[372] - Qi[10] * Ci[372]
+	+ Qr[6] * Cr[376] - Qi[6] * Ci[376]
+	- 2. * Cr[382];
+      Ci[382] =
+	Qr[258] * Ci[124] + Qi[258] * Cr[124]
+	+ Qr[66] * Ci[316] + Qi[66] * Cr[316]
+	+ Qr[34] * Ci[348] + Qi[34] * Cr[348]
+	+ Qr[18] * Ci[364] + Qi[18] * Cr[364]
+	+ Qr[10] * Ci[372] + Qi[10] * Cr[372]
+	+ Qr[6] * Ci[376] + Qi[6] * Cr[376]
+	- 2. * Ci[382];
+      Cr[382] =
+	Qr[2] * Cr[380] - Qi[2] * Ci[380]
+	- Cr[382];
+      Ci[382] =
+	Qr[2] * Ci[380] + Qi[2] * Cr[380]
+	- Ci[382];
+
+      Cr[384] =
+	Qr[384];
+      Ci[384] =
+	Qi[384];
+      Cr[384] =
+	Qr[128] * Cr[256] - Qi[128] * Ci[256]
+	- Cr[384];
+      Ci[384] =
+	Qr[128] * Ci[256] + Qi[128] * Cr[256]
+	- Ci[384];
+
+      Cr[386] =
+	Qr[386];
+      Ci[386] =
+	Qi[386];
+      Cr[386] =
+	Qr[258] * Cr[128] - Qi[258] * Ci[128]
+	+ Qr[130] * Cr[256] - Qi[130] * Ci[256]
+	- 2. * Cr[386];
+      Ci[386] =
+	Qr[258] * Ci[128] + Qi[258] * Cr[128]
+	+ Qr[130] * Ci[256] + Qi[130] * Cr[256]
+	- 2. * Ci[386];
+      Cr[386] =
+	Qr[2] * Cr[384] - Qi[2] * Ci[384]
+	- Cr[386];
+      Ci[386] =
+	Qr[2] * Ci[384] + Qi[2] * Cr[384]
+	- Ci[386];
+
+      Cr[388] =
+	Qr[388];
+      Ci[388] =
+	Qi[388];
+      Cr[388] =
+	Qr[260] * Cr[128] - Qi[260] * Ci[128]
+	+ Qr[132] * Cr[256] - Qi[132] * Ci[256]
+	- 2. * Cr[388];
+      Ci[388] =
+	Qr[260] * Ci[128] + Qi[260] * Cr[128]
+	+ Qr[132] * Ci[256] + Qi[132] * Cr[256]
+	- 2. * Ci[388];
+      Cr[388] =
+	Qr[4] * Cr[384] - Qi[4] * Ci[384]
+	- Cr[388];
+      Ci[388] =
+	Qr[4] * Ci[384] + Qi[4] * Cr[384]
+	- Ci[388];
+
+      Cr[390] =
+	Qr[390];
+      Ci[390] =
+	Qi[390];
+      Cr[390] =
+	Qr[386] * Cr[4] - Qi[386] * Ci[4]
+	+ Qr[262] * Cr[128] - Qi[262] * Ci[128]
+	+ Qr[134] * Cr[256] - Qi[134] * Ci[256]
+	- 3. * Cr[390];
+      Ci[390] =
+	Qr[386] * Ci[4] + Qi[386] * Cr[4]
+	+ Qr[262] * Ci[128] + Qi[262] * Cr[128]
+	+ Qr[134] * Ci[256] + Qi[134] * Cr[256]
+	- 3. * Ci[390];
+      Cr[390] =
+	Qr[258] * Cr[132] - Qi[258] * Ci[132]
+	+ Qr[130] * Cr[260] - Qi[130] * Ci[260]
+	+ Qr[6] * Cr[384] - Qi[6] * Ci[384]
+	- 2. * Cr[390];
+      Ci[390] =
+	Qr[258] * Ci[132] + Qi[258] * Cr[132]
+	+ Qr[130] * Ci[260] + Qi[130] * Cr[260]
+	+ Qr[6] * Ci[384] + Qi[6] * Cr[384]
+	- 2. * Ci[390];
+      Cr[390] =
+	Qr[2] * Cr[388] - Qi[2] * Ci[388]
+	- Cr[390];
+      Ci[390] =
+	Qr[2] * Ci[388] + Qi[2] * Cr[388]
+	- Ci[390];
+
+      Cr[392] =
+	Qr[392];
+      Ci[392] =
+	Qi[392];
+      Cr[392] =
+	Qr[264] * Cr[128] - Qi[264] * Ci[128]
+	+ Qr[136] * Cr[256] - Qi[136] * Ci[256]
+	- 2. * Cr[392];
+      Ci[392] =
+	Qr[264] * Ci[128] + Qi[264] * Cr[128]
+	+ Qr[136] * Ci[256] + Qi[136] * Cr[256]
+	- 2. * Ci[392];
+      Cr[392] =
+	Qr[8] * Cr[384] - Qi[8] * Ci[384]
+	- Cr[392];
+      Ci[392] =
+	Qr[8] * Ci[384] + Qi[8] * Cr[384]
+	- Ci[392];
+
+      Cr[394] =
+	Qr[394];
+      Ci[394] =
+	Qi[394];
+      Cr[394] =
+	Qr[386] * Cr[8] - Qi[386] * Ci[8]
+	+ Qr[266] * Cr[128] - Qi[266] * Ci[128]
+	+ Qr[138] * Cr[256] - Qi[138] * Ci[256]
+	- 3. * Cr[394];
+      Ci[394] =
+	Qr[386] * Ci[8] + Qi[386] * Cr[8]
+	+ Qr[266] * Ci[128] + Qi[266] * Cr[128]
+	+ Qr[138] * Ci[256] + Qi[138] * Cr[256]
+	- 3. * Ci[394];
+      Cr[394] =
+	Qr[258] * Cr[136] - Qi[258] * Ci[136]
+	+ Qr[130] * Cr[264] - Qi[130] * Ci[264]
+	+ Qr[10] * Cr[384] - Qi[10] * Ci[384]
+	- 2. * Cr[394];
+      Ci[394] =
+	Qr[258] * Ci[136] + Qi[258] * Cr[136]
+	+ Qr[130] * Ci[264] + Qi[130] * Cr[264]
+	+ Qr[10] * Ci[384] + Qi[10] * Cr[384]
+	- 2. * Ci[394];
+      Cr[394] =
+	Qr[2] * Cr[392] - Qi[2] * Ci[392]
+	- Cr[394];
+      Ci[394] =
+	Qr[2] * Ci[392] + Qi[2] * Cr[392]
+	- Ci[394];
+
+      Cr[396] =
+	Qr[396];
+      Ci[396] =
+	Qi[396];
+      Cr[396] =
+	Qr[388] * Cr[8] - Qi[388] * Ci[8]
+	+ Qr[268] * Cr[128] - Qi[268] * Ci[128]
+	+ Qr[140] * Cr[256] - Qi[140] * Ci[256]
+	- 3. * Cr[396];
+      Ci[396] =
+	Qr[388] * Ci[8] + Qi[388] * Cr[8]
+	+ Qr[268] * Ci[128] + Qi[268] * Cr[128]
+	+ Qr[140] * Ci[256] + Qi[140] * Cr[256]
+	- 3. * Ci[396];
+      Cr[396] =
+	Qr[260] * Cr[136] - Qi[260] * Ci[136]
+	+ Qr[132] * Cr[264] - Qi[132] * Ci[264]
+	+ Qr[12] * Cr[384] - Qi[12] * Ci[384]
+	- 2. * Cr[396];
+      Ci[396] =
+	Qr[260] * Ci[136] + Qi[260] * Cr[136]
+	+ Qr[132] * Ci[264] + Qi[132] * Cr[264]
+	+ Qr[12] * Ci[384] + Qi[12] * Cr[384]
+	- 2. * Ci[396];
+      Cr[396] =
+	Qr[4] * Cr[392] - Qi[4] * Ci[392]
+	- Cr[396];
+      Ci[396] =
+	Qr[4] * Ci[392] + Qi[4] * Cr[392]
+	- Ci[396];
+
+      Cr[398] =
+	Qr[398];
+      Ci[398] =
+	Qi[398];
+      Cr[398] =
+	Qr[394] * Cr[4] - Qi[394] * Ci[4]
+	+ Qr[390] * Cr[8] - Qi[390] * Ci[8]
+	+ Qr[270] * Cr[128] - Qi[270] * Ci[128]
+	+ Qr[142] * Cr[256] - Qi[142] * Ci[256]
+	- 4. * Cr[398];
+      Ci[398] =
+	Qr[394] * Ci[4] + Qi[394] * Cr[4]
+	+ Qr[390] * Ci[8] + Qi[390] * Cr[8]
+	+ Qr[270] * Ci[128] + Qi[270] * Cr[128]
+	+ Qr[142] * Ci[256] + Qi[142] * Cr[256]
+	- 4. * Ci[398];
+      Cr[398] =
+	Qr[386] * Cr[12] - Qi[386] * Ci[12]
+	+ Qr[266] * Cr[132] - Qi[266] * Ci[132]
+	+ Qr[262] * Cr[136] - Qi[262] * Ci[136]
+	+ Qr[138] * Cr[260] - Qi[138] * Ci[260]
+	+ Qr[134] * Cr[264] - Qi[134] * Ci[264]
+	+ Qr[14] * Cr[384] - Qi[14] * Ci[384]
+	- 3. * Cr[398];
+      Ci[398] =
+	Qr[386] * Ci[12] + Qi[386] * Cr[12]
+	+ Qr[266] * Ci[132] + Qi[266] * Cr[132]
+	+ Qr[262] * Ci[136] + Qi[262] * Cr[136]
+	+ Qr[138] * Ci[260] + Qi[138] * Cr[260]
+	+ Qr[134] * Ci[264] + Qi[134] * Cr[264]
+	+ Qr[14] * Ci[384] + Qi[14] * Cr[384]
+	- 3. * Ci[398];
+      Cr[398] =
+	Qr[258] * Cr[140] - Qi[258] * Ci[140]
+	+ Qr[130] * Cr[268] - Qi[130] * Ci[268]
+	+ Qr[10] * Cr[388] - Qi[10] * Ci[388]
+	+ Qr[6] * Cr[392] - Qi[6] * Ci[392]
+	- 2. * Cr[398];
+      Ci[398] =
+	Qr[258] * Ci[140] + Qi[258] * Cr[140]
+	+ Qr[130] * Ci[268] + Qi[130] * Cr[268]
+	+ Qr[10] * Ci[388] + Qi[10] * Cr[388]
+	+ Qr[6] * Ci[392] + Qi[6] * Cr[392]
+	- 2. * Ci[398];
+      Cr[398] =
+	Qr[2] * Cr[396] - Qi[2] * Ci[396]
+	- Cr[398];
+      Ci[398] =
+	Qr[2] * Ci[396] + Qi[2] * Cr[396]
+	- Ci[398];
+
+      Cr[400] =
+	Qr[400];
+      Ci[400] =
+	Qi[400];
+      Cr[400] =
+	Qr[272] * Cr[128] - Qi[272] * Ci[128]
+	+ Qr[144] * Cr[256] - Qi[144] * Ci[256]
+	- 2. * Cr[400];
+      Ci[400] =
+	Qr[272] * Ci[128] + Qi[272] * Cr[128]
+	+ Qr[144] * Ci[256] + Qi[144] * Cr[256]
+	- 2. * Ci[400];
+      Cr[400] =
+	Qr[16] * Cr[384] - Qi[16] * Ci[384]
+	- Cr[400];
+      Ci[400] =
+	Qr[16] * Ci[384] + Qi[16] * Cr[384]
+	- Ci[400];
+
+      Cr[402] =
+	Qr[402];
+      Ci[402] =
+	Qi[402];
+      Cr[402] =
+	Qr[386] * Cr[16] - Qi[386] * Ci[16]
+	+ Qr[274] * Cr[128] - Qi[274] * Ci[128]
+	+ Qr[146] * Cr[256] - Qi[146] * Ci[256]
+	- 3. * Cr[402];
+      Ci[402] =
+	Qr[386] * Ci[16] + Qi[386] * Cr[16]
+	+ Qr[274] * Ci[128] + Qi[274] * Cr[128]
+	+ Qr[146] * Ci[256] + Qi[146] * Cr[256]
+	- 3. * Ci[402];
+      Cr[402] =
+	Qr[258] * Cr[144] - Qi[258] * Ci[144]
+	+ Qr[130] * Cr[272] - Qi[130] * Ci[272]
+	+ Qr[18] * Cr[384] - Qi[18] * Ci[384]
+	- 2. * Cr[402];
+      Ci[402] =
+	Qr[258] * Ci[144] + Qi[258] * Cr[144]
+	+ Qr[130] * Ci[272] + Qi[130] * Cr[272]
+	+ Qr[18] * Ci[384] + Qi[18] * Cr[384]
+	- 2. * Ci[402];
+      Cr[402] =
+	Qr[2] * Cr[400] - Qi[2] * Ci[400]
+	- Cr[402];
+      Ci[402] =
+	Qr[2] * Ci[400] + Qi[2] * Cr[400]
+	- Ci[402];
+    }
+
+    /** Part 14 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part14(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[404] =
+	Qr[404];
+      Ci[404] =
+	Qi[404];
+      Cr[404] =
+	Qr[388] * Cr[16] - Qi[388] * Ci[16]
+	+ Qr[276] * Cr[128] - Qi[276] * Ci[128]
+	+ Qr[148] * Cr[256] - Qi[148] * Ci[256]
+	- 3. * Cr[404];
+      Ci[404] =
+	Qr[388] * Ci[16] + Qi[388] * Cr[16]
+	+ Qr[276] * Ci[128] + Qi[276] * Cr[128]
+	+ Qr[148] * Ci[256] + Qi[148] * Cr[256]
+	- 3. * Ci[404];
+      Cr[404] =
+	Qr[260] * Cr[144] - Qi[260] * Ci[144]
+	+ Qr[132] * Cr[272] - Qi[132] * Ci[272]
+	+ Qr[20] * Cr[384] - Qi[20] * Ci[384]
+	- 2. * Cr[404];
+      Ci[404] =
+	Qr[260] * Ci[144] + Qi[260] * Cr[144]
+	+ Qr[132] * Ci[272] + Qi[132] * Cr[272]
+	+ Qr[20] * Ci[384] + Qi[20] * Cr[384]
+	- 2. * Ci[404];
+      Cr[404] =
+	Qr[4] * Cr[400] - Qi[4] * Ci[400]
+	- Cr[404];
+      Ci[404] =
+	Qr[4] * Ci[400] + Qi[4] * Cr[400]
+	- Ci[404];
+
+      Cr[406] =
+	Qr[406];
+      Ci[406] =
+	Qi[406];
+      Cr[406] =
+	Qr[402] * Cr[4] - Qi[402] * Ci[4]
+	+ Qr[390] * Cr[16] - Qi[390] * Ci[16]
+	+ Qr[278] * Cr[128] - Qi[278] * Ci[128]
+	+ Qr[150] * Cr[256] - Qi[150] * Ci[256]
+	- 4. * Cr[406];
+      Ci[406] =
+	Qr[402] * Ci[4] + Qi[402] * Cr[4]
+	+ Qr[390] * Ci[16] + Qi[390] * Cr[16]
+	+ Qr[278] * Ci[128] + Qi[278] * Cr[128]
+	+ Qr[150] * Ci[256] + Qi[150] * Cr[256]
+	- 4. * Ci[406];
+      Cr[406] =
+	Qr[386] * Cr[20] - Qi[386] * Ci[20]
+	+ Qr[274] * Cr[132] - Qi[274] * Ci[132]
+	+ Qr[262] * Cr[144] - Qi[262] * Ci[144]
+	+ Qr[146] * Cr[260] - Qi[146] * Ci[260]
+	+ Qr[134] * Cr[272] - Qi[134] * Ci[272]
+	+ Qr[22] * Cr[384] - Qi[22] * Ci[384]
+	- 3. * Cr[406];
+      Ci[406] =
+	Qr[386] * Ci[20] + Qi[386] * Cr[20]
+	+ Qr[274] * Ci[132] + Qi[274] * Cr[132]
+	+ Qr[262] * Ci[144] + Qi[262] * Cr[144]
+	+ Qr[146] * Ci[260] + Qi[146] * Cr[260]
+	+ Qr[134] * Ci[272] + Qi[134] * Cr[272]
+	+ Qr[22] * Ci[384] + Qi[22] * Cr[384]
+	- 3. * Ci[406];
+      Cr[406] =
+	Qr[258] * Cr[148] - Qi[258] * Ci[148]
+	+ Qr[130] * Cr[276] - Qi[130] * Ci[276]
+	+ Qr[18] * Cr[388] - Qi[18] * Ci[388]
+	+ Qr[6] * Cr[400] - Qi[6] * Ci[400]
+	- 2. * Cr[406];
+      Ci[406] =
+	Qr[258] * Ci[148] + Qi[258] * Cr[148]
+	+ Qr[130] * Ci[276] + Qi[130] * Cr[276]
+	+ Qr[18] * Ci[388] + Qi[18] * Cr[388]
+	+ Qr[6] * Ci[400] + Qi[6] * Cr[400]
+	- 2. * Ci[406];
+      Cr[406] =
+	Qr[2] * Cr[404] - Qi[2] * Ci[404]
+	- Cr[406];
+      Ci[406] =
+	Qr[2] * Ci[404] + Qi[2] * Cr[404]
+	- Ci[406];
+
+      Cr[408] =
+	Qr[408];
+      Ci[408] =
+	Qi[408];
+      Cr[408] =
+	Qr[392] * Cr[16] - Qi[392] * Ci[16]
+	+ Qr[280] * Cr[128] - Qi[280] * Ci[128]
+	+ Qr[152] * Cr[256] - Qi[152] * Ci[256]
+	- 3. * Cr[408];
+      Ci[408] =
+	Qr[392] * Ci[16] + Qi[392] * Cr[16]
+	+ Qr[280] * Ci[128] + Qi[280] * Cr[128]
+	+ Qr[152] * Ci[256] + Qi[152] * Cr[256]
+	- 3. * Ci[408];
+      Cr[408] =
+	Qr[264] * Cr[144] - Qi[264] * Ci[144]
+	+ Qr[136] * Cr[272] - Qi[136] * Ci[272]
+	+ Qr[24] * Cr[384] - Qi[24] * Ci[384]
+	- 2. * Cr[408];
+      Ci[408] =
+	Qr[264] * Ci[144] + Qi[264] * Cr[144]
+	+ Qr[136] * Ci[272] + Qi[136] * Cr[272]
+	+ Qr[24] * Ci[384] + Qi[24] * Cr[384]
+	- 2. * Ci[408];
+      Cr[408] =
+	Qr[8] * Cr[400] - Qi[8] * Ci[400]
+	- Cr[408];
+      Ci[408] =
+	Qr[8] * Ci[400] + Qi[8] * Cr[400]
+	- Ci[408];
+
+      Cr[410] =
+	Qr[410];
+      Ci[410] =
+	Qi[410];
+      Cr[410] =
+	Qr[402] * Cr[8] - Qi[402] * Ci[8]
+	+ Qr[394] * Cr[16] - Qi[394] * Ci[16]
+	+ Qr[282] * Cr[128] - Qi[282] * Ci[128]
+	+ Qr[154] * Cr[256] - Qi[154] * Ci[256]
+	- 4. * Cr[410];
+      Ci[410] =
+	Qr[402] * Ci[8] + Qi[402] * Cr[8]
+	+ Qr[394] * Ci[16] + Qi[394] * Cr[16]
+	+ Qr[282] * Ci[128] + Qi[282] * Cr[128]
+	+ Qr[154] * Ci[256] + Qi[154] * Cr[256]
+	- 4. * Ci[410];
+      Cr[410] =
+	Qr[386] * Cr[24] - Qi[386] * Ci[24]
+	+ Qr[274] * Cr[136] - Qi[274] * Ci[136]
+	+ Qr[266] * Cr[144] - Qi[266] * Ci[144]
+	+ Qr[146] * Cr[264] - Qi[146] * Ci[264]
+	+ Qr[138] * Cr[272] - Qi[138] * Ci[272]
+	+ Qr[26] * Cr[384] - Qi[26] * Ci[384]
+	- 3. * Cr[410];
+      Ci[410] =
+	Qr[386] * Ci[24] + Qi[386] * Cr[24]
+	+ Qr[274] * Ci[136] + Qi[274] * Cr[136]
+	+ Qr[266] * Ci[144] + Qi[266] * Cr[144]
+	+ Qr[146] * Ci[264] + Qi[146] * Cr[264]
+	+ Qr[138] * Ci[272] + Qi[138] * Cr[272]
+	+ Qr[26] * Ci[384] + Qi[26] * Cr[384]
+	- 3. * Ci[410];
+      Cr[410] =
+	Qr[258] * Cr[152] - Qi[258] * Ci[152]
+	+ Qr[130] * Cr[280] - Qi[130] * Ci[280]
+	+ Qr[18] * Cr[392] - Qi[18] * Ci[392]
+	+ Qr[10] * Cr[400] - Qi[10] * Ci[400]
+	- 2. * Cr[410];
+      Ci[410] =
+	Qr[258] * Ci[152] + Qi[258] * Cr[152]
+	+ Qr[130] * Ci[280] + Qi[130] * Cr[280]
+	+ Qr[18] * Ci[392] + Qi[18] * Cr[392]
+	+ Qr[10] * Ci[400] + Qi[10] * Cr[400]
+	- 2. * Ci[410];
+      Cr[410] =
+	Qr[2] * Cr[408] - Qi[2] * Ci[408]
+	- Cr[410];
+      Ci[410] =
+	Qr[2] * Ci[408] + Qi[2] * Cr[408]
+	- Ci[410];
+
+      Cr[412] =
+	Qr[412];
+      Ci[412] =
+	Qi[412];
+      Cr[412] =
+	Qr[404] * Cr[8] - Qi[404] * Ci[8]
+	+ Qr[396] * Cr[16] - Qi[396] * Ci[16]
+	+ Qr[284] * Cr[128] - Qi[284] * Ci[128]
+	+ Qr[156] * Cr[256] - Qi[156] * Ci[256]
+	- 4. * Cr[412];
+      Ci[412] =
+	Qr[404] * Ci[8] + Qi[404] * Cr[8]
+	+ Qr[396] * Ci[16] + Qi[396] * Cr[16]
+	+ Qr[284] * Ci[128] + Qi[284] * Cr[128]
+	+ Qr[156] * Ci[256] + Qi[156] * Cr[256]
+	- 4. * Ci[412];
+      Cr[412] =
+	Qr[388] * Cr[24] - Qi[388] * Ci[24]
+	+ Qr[276] * Cr[136] - Qi[276] * Ci[136]
+	+ Qr[268] * Cr[144] - Qi[268] * Ci[144]
+	+ Qr[148] * Cr[264] - Qi[148] * Ci[264]
+	+ Qr[140] * Cr[272] - Qi[140] * Ci[272]
+	+ Qr[28] * Cr[384] - Qi[28] * Ci[384]
+	- 3. * Cr[412];
+      Ci[412] =
+	Qr[388] * Ci[24] + Qi[388] * Cr[24]
+	+ Qr[276] * Ci[136] + Qi[276] * Cr[136]
+	+ Qr[268] * Ci[144] + Qi[268] * Cr[144]
+	+ Qr[148] * Ci[264] + Qi[148] * Cr[264]
+	+ Qr[140] * Ci[272] + Qi[140] * Cr[272]
+	+ Qr[28] * Ci[384] + Qi[28] * Cr[384]
+	- 3. * Ci[412];
+      Cr[412] =
+	Qr[260] * Cr[152] - Qi[260] * Ci[152]
+	+ Qr[132] * Cr[280] - Qi[132] * Ci[280]
+	+ Qr[20] * Cr[392] - Qi[20] * Ci[392]
+	+ Qr[12] * Cr[400] - Qi[12] * Ci[400]
+	- 2. * Cr[412];
+      Ci[412] =
+	Qr[260] * Ci[152] + Qi[260] * Cr[152]
+	+ Qr[132] * Ci[280] + Qi[132] * Cr[280]
+	+ Qr[20] * Ci[392] + Qi[20] * Cr[392]
+	+ Qr[12] * Ci[400] + Qi[12] * Cr[400]
+	- 2. * Ci[412];
+      Cr[412] =
+	Qr[4] * Cr[408] - Qi[4] * Ci[408]
+	- Cr[412];
+      Ci[412] =
+	Qr[4] * Ci[408] + Qi[4] * Cr[408]
+	- Ci[412];
+
+      Cr[414] =
+	Qr[414];
+      Ci[414] =
+	Qi[414];
+      Cr[414] =
+	Qr[410] * Cr[4] - Qi[410] * Ci[4]
+	+ Qr[406] * Cr[8] - Qi[406] * Ci[8]
+	+ Qr[398] * Cr[16] - Qi[398] * Ci[16]
+	+ Qr[286] * Cr[128] - Qi[286] * Ci[128]
+	+ Qr[158] * Cr[256] - Qi[158] * Ci[256]
+	- 5. * Cr[414];
+      Ci[414] =
+	Qr[410] * Ci[4] + Qi[410] * Cr[4]
+	+ Qr[406] * Ci[8] + Qi[406] * Cr[8]
+	+ Qr[398] * Ci[16] + Qi[398] * Cr[16]
+	+ Qr[286] * Ci[128] + Qi[286] * Cr[128]
+	+ Qr[158] * Ci[256] + Qi[158] * Cr[256]
+	- 5. * Ci[414];
+      Cr[414] =
+	Qr[402] * Cr[12] - Qi[402] * Ci[12]
+	+ Qr[394] * Cr[20] - Qi[394] * Ci[20]
+	+ Qr[390] * Cr[24] - Qi[390] * Ci[24]
+	+ Qr[282] * Cr[132] - Qi[282] * Ci[132]
+	+ Qr[278] * Cr[136] - Qi[278] * Ci[136]
+	+ Qr[270] * Cr[144] - Qi[270] * Ci[144]
+	+ Qr[154] * Cr[260] - Qi[154] * Ci[260]
+	+ Qr[150] * Cr[264] - Qi[150] * Ci[264]
+	+ Qr[142] * Cr[272] - Qi[142] * Ci[272]
+	+ Qr[30] * Cr[384] - Qi[30] * Ci[384]
+	- 4. * Cr[414];
+      Ci[414] =
+	Qr[402] * Ci[12] + Qi[402] * Cr[12]
+	+ Qr[394] * Ci[20] + Qi[394] * Cr[20]
+	+ Qr[390] * Ci[24] + Qi[390] * Cr[24]
+	+ Qr[282] * Ci[132] + Qi[282] * Cr[132]
+	+ Qr[278] * Ci[136] + Qi[278] * Cr[136]
+	+ Qr[270] * Ci[144] + Qi[270] * Cr[144]
+	+ Qr[154] * Ci[260] + Qi[154] * Cr[260]
+	+ Qr[150] * Ci[264] + Qi[150] * Cr[264]
+	+ Qr[142] * Ci[272] + Qi[142] * Cr[272]
+	+ Qr[30] * Ci[384] + Qi[30] * Cr[384]
+	- 4. * Ci[414];
+      Cr[414] =
+	Qr[386] * Cr[28] - Qi[386] * Ci[28]
+	+ Qr[274] * Cr[140] - Qi[274] * Ci[140]
+	+ Qr[266] * Cr[148] - Qi[266] * Ci[148]
+	+ Qr[262] * Cr[152] - Qi[262] * Ci[152]
+	+ Qr[146] * Cr[268] - Qi[146] * Ci[268]
+	+ Qr[138] * Cr[276] - Qi[138] * Ci[276]
+	+ Qr[134] * Cr[280] - Qi[134] * Ci[280]
+	+ Qr[26] * Cr[388] - Qi[26] * Ci[388]
+	+ Qr[22] * Cr[392] - Qi[22] * Ci[392]
+	+ Qr[14] * Cr[400] - Qi[14] * Ci[400]
+	- 3. * Cr[414];
+      Ci[414] =
+	Qr[386] * Ci[28] + Qi[386] * Cr[28]
+	+ Qr[274] * Ci[140] + Qi[274] * Cr[140]
+	+ Qr[266] * Ci[148] + Qi[266] * Cr[148]
+	+ Qr[262] * Ci[152] + Qi[262] * Cr[152]
+	+ Qr[146] * Ci[268] + Qi[146] * Cr[268]
+	+ Qr[138] * Ci[276] + Qi[138] * Cr[276]
+	+ Qr[134] * Ci[280] + Qi[134] * Cr[280]
+	+ Qr[26] * Ci[388] + Qi[26] * Cr[388]
+	+ Qr[22] * Ci[392] + Qi[22] * Cr[392]
+	+ Qr[14] * Ci[400] + Qi[14] * Cr[400]
+	- 3. * Ci[414];
+      Cr[414] =
+	Qr[258] * Cr[156] - Qi[258] * Ci[156]
+	+ Qr[130] * Cr[284] - Qi[130] * Ci[284]
+	+ Qr[18] * Cr[396] - Qi[18] * Ci[396]
+	+ Qr[10] * Cr[404] - Qi[10] * Ci[404]
+	+ Qr[6] * Cr[408] - Qi[6] * Ci[408]
+	- 2. * Cr[414];
+      Ci[414] =
+	Qr[258] * Ci[156] + Qi[258] * Cr[156]
+	+ Qr[130] * Ci[284] + Qi[130] * Cr[284]
+	+ Qr[18] * Ci[396] + Qi[18] * Cr[396]
+	+ Qr[10] * Ci[404] + Qi[10] * Cr[404]
+	+ Qr[6] * Ci[408] + Qi[6] * Cr[408]
+	- 2. * Ci[414];
+      Cr[414] =
+	Qr[2] * Cr[412] - Qi[2] * Ci[412]
+	- Cr[414];
+      Ci[414] =
+	Qr[2] * Ci[412] + Qi[2] * Cr[412]
+	- Ci[414];
+
+      Cr[416] =
+	Qr[416];
+      Ci[416] =
+	Qi[416];
+      Cr[416] =
+	Qr[288] * Cr[128] - Qi[288] * Ci[128]
+	+ Qr[160] * Cr[256] - Qi[160] * Ci[256]
+	- 2. * Cr[416];
+      Ci[416] =
+	Qr[288] * Ci[128] + Qi[288] * Cr[128]
+	+ Qr[160] * Ci[256] + Qi[160] * Cr[256]
+	- 2. * Ci[416];
+      Cr[416] =
+	Qr[32] * Cr[384] - Qi[32] * Ci[384]
+	- Cr[416];
+      Ci[416] =
+	Qr[32] * Ci[384] + Qi[32] * Cr[384]
+	- Ci[416];
+
+      Cr[418] =
+	Qr[418];
+      Ci[418] =
+	Qi[418];
+      Cr[418] =
+	Qr[386] * Cr[32] - Qi[386] * Ci[32]
+	+ Qr[290] * Cr[128] - Qi[290] * Ci[128]
+	+ Qr[162] * Cr[256] - Qi[162] * Ci[256]
+	- 3. * Cr[418];
+      Ci[418] =
+	Qr[386] * Ci[32] + Qi[386] * Cr[32]
+	+ Qr[290] * Ci[128] + Qi[290] * Cr[128]
+	+ Qr[162] * Ci[256] + Qi[162] * Cr[256]
+	- 3. * Ci[418];
+      Cr[418] =
+	Qr[258] * Cr[160] - Qi[258] * Ci[160]
+	+ Qr[130] * Cr[288] - Qi[130] * Ci[288]
+	+ Qr[34] * Cr[384] - Qi[34] * Ci[384]
+	- 2. * Cr[418];
+      Ci[418] =
+	Qr[258] * Ci[160] + Qi[258] * Cr[160]
+	+ Qr[130] * Ci[288] + Qi[130] * Cr[288]
+	+ Qr[34] * Ci[384] + Qi[34] * Cr[384]
+	- 2. * Ci[418];
+      Cr[418] =
+	Qr[2] * Cr[416] - Qi[2] * Ci[416]
+	- Cr[418];
+      Ci[418] =
+	Qr[2] * Ci[416] + Qi[2] * Cr[416]
+	- Ci[418];
+
+      Cr[420] =
+	Qr[420];
+      Ci[420] =
+	Qi[420];
+      Cr[420] =
+	Qr[388] * Cr[32] - Qi[388] * Ci[32]
+	+ Qr[292] * Cr[128] - Qi[292] * Ci[128]
+	+ Qr[164] * Cr[256] - Qi[164] * Ci[256]
+	- 3. * Cr[420];
+      Ci[420] =
+	Qr[388] * Ci[32] + Qi[388] * Cr[32]
+	+ Qr[292] * Ci[128] + Qi[292] * Cr[128]
+	+ Qr[164] * Ci[256] + Qi[164] * Cr[256]
+	- 3. * Ci[420];
+      Cr[420] =
+	Qr[260] * Cr[160] - Qi[260] * Ci[160]
+	+ Qr[132] * Cr[288] - Qi[132] * Ci[288]
+	+ Qr[36] * Cr[384] - Qi[36] * Ci[384]
+	- 2. * Cr[420];
+      Ci[420] =
+	Qr[260] * Ci[160] + Qi[260] * Cr[160]
+	+ Qr[132] * Ci[288] + Qi[132] * Cr[288]
+	+ Qr[36] * Ci[384] + Qi[36] * Cr[384]
+	- 2. * Ci[420];
+      Cr[420] =
+	Qr[4] * Cr[416] - Qi[4] * Ci[416]
+	- Cr[420];
+      Ci[420] =
+	Qr[4] * Ci[416] + Qi[4] * Cr[416]
+	- Ci[420];
+
+      Cr[422] =
+	Qr[422];
+      Ci[422] =
+	Qi[422];
+      Cr[422] =
+	Qr[418] * Cr[4] - Qi[418] * Ci[4]
+	+ Qr[390] * Cr[32] - Qi[390] * Ci[32]
+	+ Qr[294] * Cr[128] - Qi[294] * Ci[128]
+	+ Qr[166] * Cr[256] - Qi[166] * Ci[256]
+	- 4. * Cr[422];
+      Ci[422] =
+	Qr[418] * Ci[4] + Qi[418] * Cr[4]
+	+ Qr[390] * Ci[32] + Qi[390] * Cr[32]
+	+ Qr[294] * Ci[128] + Qi[294] * Cr[128]
+	+ Qr[166] * Ci[256] + Qi[166] * Cr[256]
+	- 4. * Ci[422];
+      Cr[422] =
+	Qr[386] * Cr[36] - Qi[386] * Ci[36]
+	+ Qr[290] * Cr[132] - Qi[290] * Ci[132]
+	+ Qr[262] * Cr[160] - Qi[262] * Ci[160]
+	+ Qr[162] * Cr[260] - Qi[162] * Ci[260]
+	+ Qr[134] * Cr[288] - Qi[134] * Ci[288]
+	+ Qr[38] * Cr[384] - Qi[38] * Ci[384]
+	- 3. * Cr[422];
+      Ci[422] =
+	Qr[386] * Ci[36] + Qi[386] * Cr[36]
+	+ Qr[290] * Ci[132] + Qi[290] * Cr[132]
+	+ Qr[262] * Ci[160] + Qi[262] * Cr[160]
+	+ Qr[162] * Ci[260] + Qi[162] * Cr[260]
+	+ Qr[134] * Ci[288] + Qi[134] * Cr[288]
+	+ Qr[38] * Ci[384] + Qi[38] * Cr[384]
+	- 3. * Ci[422];
+      Cr[422] =
+	Qr[258] * Cr[164] - Qi[258] * Ci[164]
+	+ Qr[130] * Cr[292] - Qi[130] * Ci[292]
+	+ Qr[34] * Cr[388] - Qi[34] * Ci[388]
+	+ Qr[6] * Cr[416] - Qi[6] * Ci[416]
+	- 2. * Cr[422];
+      Ci[422] =
+	Qr[258] * Ci[164] + Qi[258] * Cr[164]
+	+ Qr[130] * Ci[292] + Qi[130] * Cr[292]
+	+ Qr[34] * Ci[388] + Qi[34] * Cr[388]
+	+ Qr[6] * Ci[416] + Qi[6] * Cr[416]
+	- 2. * Ci[422];
+      Cr[422] =
+	Qr[2] * Cr[420] - Qi[2] * Ci[420]
+	- Cr[422];
+      Ci[422] =
+	Qr[2] * Ci[420] + Qi[2] * Cr[420]
+	- Ci[422];
+    }
+
+    /** Part 15 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part15(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[424] =
+	Qr[424];
+      Ci[424] =
+	Qi[424];
+      Cr[424] =
+	Qr[392] * Cr[32] - Qi[392] * Ci[32]
+	+ Qr[296] * Cr[128] - Qi[296] * Ci[128]
+	+ Qr[168] * Cr[256] - Qi[168] * Ci[256]
+	- 3. * Cr[424];
+      Ci[424] =
+	Qr[392] * Ci[32] + Qi[392] * Cr[32]
+	+ Qr[296] * Ci[128] + Qi[296] * Cr[128]
+	+ Qr[168] * Ci[256] + Qi[168] * Cr[256]
+	- 3. * Ci[424];
+      Cr[424] =
+	Qr[264] * Cr[160] - Qi[264] * Ci[160]
+	+ Qr[136] * Cr[288] - Qi[136] * Ci[288]
+	+ Qr[40] * Cr[384] - Qi[40] * Ci[384]
+	- 2. * Cr[424];
+      Ci[424] =
+	Qr[264] * Ci[160] + Qi[264] * Cr[160]
+	+ Qr[136] * Ci[288] + Qi[136] * Cr[288]
+	+ Qr[40] * Ci[384] + Qi[40] * Cr[384]
+	- 2. * Ci[424];
+      Cr[424] =
+	Qr[8] * Cr[416] - Qi[8] * Ci[416]
+	- Cr[424];
+      Ci[424] =
+	Qr[8] * Ci[416] + Qi[8] * Cr[416]
+	- Ci[424];
+
+      Cr[426] =
+	Qr[426];
+      Ci[426] =
+	Qi[426];
+      Cr[426] =
+	Qr[418] * Cr[8] - Qi[418] * Ci[8]
+	+ Qr[394] * Cr[32] - Qi[394] * Ci[32]
+	+ Qr[298] * Cr[128] - Qi[298] * Ci[128]
+	+ Qr[170] * Cr[256] - Qi[170] * Ci[256]
+	- 4. * Cr[426];
+      Ci[426] =
+	Qr[418] * Ci[8] + Qi[418] * Cr[8]
+	+ Qr[394] * Ci[32] + Qi[394] * Cr[32]
+	+ Qr[298] * Ci[128] + Qi[298] * Cr[128]
+	+ Qr[170] * Ci[256] + Qi[170] * Cr[256]
+	- 4. * Ci[426];
+      Cr[426] =
+	Qr[386] * Cr[40] - Qi[386] * Ci[40]
+	+ Qr[290] * Cr[136] - Qi[290] * Ci[136]
+	+ Qr[266] * Cr[160] - Qi[266] * Ci[160]
+	+ Qr[162] * Cr[264] - Qi[162] * Ci[264]
+	+ Qr[138] * Cr[288] - Qi[138] * Ci[288]
+	+ Qr[42] * Cr[384] - Qi[42] * Ci[384]
+	- 3. * Cr[426];
+      Ci[426] =
+	Qr[386] * Ci[40] + Qi[386] * Cr[40]
+	+ Qr[290] * Ci[136] + Qi[290] * Cr[136]
+	+ Qr[266] * Ci[160] + Qi[266] * Cr[160]
+	+ Qr[162] * Ci[264] + Qi[162] * Cr[264]
+	+ Qr[138] * Ci[288] + Qi[138] * Cr[288]
+	+ Qr[42] * Ci[384] + Qi[42] * Cr[384]
+	- 3. * Ci[426];
+      Cr[426] =
+	Qr[258] * Cr[168] - Qi[258] * Ci[168]
+	+ Qr[130] * Cr[296] - Qi[130] * Ci[296]
+	+ Qr[34] * Cr[392] - Qi[34] * Ci[392]
+	+ Qr[10] * Cr[416] - Qi[10] * Ci[416]
+	- 2. * Cr[426];
+      Ci[426] =
+	Qr[258] * Ci[168] + Qi[258] * Cr[168]
+	+ Qr[130] * Ci[296] + Qi[130] * Cr[296]
+	+ Qr[34] * Ci[392] + Qi[34] * Cr[392]
+	+ Qr[10] * Ci[416] + Qi[10] * Cr[416]
+	- 2. * Ci[426];
+      Cr[426] =
+	Qr[2] * Cr[424] - Qi[2] * Ci[424]
+	- Cr[426];
+      Ci[426] =
+	Qr[2] * Ci[424] + Qi[2] * Cr[424]
+	- Ci[426];
+
+      Cr[428] =
+	Qr[428];
+      Ci[428] =
+	Qi[428];
+      Cr[428] =
+	Qr[420] * Cr[8] - Qi[420] * Ci[8]
+	+ Qr[396] * Cr[32] - Qi[396] * Ci[32]
+	+ Qr[300] * Cr[128] - Qi[300] * Ci[128]
+	+ Qr[172] * Cr[256] - Qi[172] * Ci[256]
+	- 4. * Cr[428];
+      Ci[428] =
+	Qr[420] * Ci[8] + Qi[420] * Cr[8]
+	+ Qr[396] * Ci[32] + Qi[396] * Cr[32]
+	+ Qr[300] * Ci[128] + Qi[300] * Cr[128]
+	+ Qr[172] * Ci[256] + Qi[172] * Cr[256]
+	- 4. * Ci[428];
+      Cr[428] =
+	Qr[388] * Cr[40] - Qi[388] * Ci[40]
+	+ Qr[292] * Cr[136] - Qi[292] * Ci[136]
+	+ Qr[268] * Cr[160] - Qi[268] * Ci[160]
+	+ Qr[164] * Cr[264] - Qi[164] * Ci[264]
+	+ Qr[140] * Cr[288] - Qi[140] * Ci[288]
+	+ Qr[44] * Cr[384] - Qi[44] * Ci[384]
+	- 3. * Cr[428];
+      Ci[428] =
+	Qr[388] * Ci[40] + Qi[388] * Cr[40]
+	+ Qr[292] * Ci[136] + Qi[292] * Cr[136]
+	+ Qr[268] * Ci[160] + Qi[268] * Cr[160]
+	+ Qr[164] * Ci[264] + Qi[164] * Cr[264]
+	+ Qr[140] * Ci[288] + Qi[140] * Cr[288]
+	+ Qr[44] * Ci[384] + Qi[44] * Cr[384]
+	- 3. * Ci[428];
+      Cr[428] =
+	Qr[260] * Cr[168] - Qi[260] * Ci[168]
+	+ Qr[132] * Cr[296] - Qi[132] * Ci[296]
+	+ Qr[36] * Cr[392] - Qi[36] * Ci[392]
+	+ Qr[12] * Cr[416] - Qi[12] * Ci[416]
+	- 2. * Cr[428];
+      Ci[428] =
+	Qr[260] * Ci[168] + Qi[260] * Cr[168]
+	+ Qr[132] * Ci[296] + Qi[132] * Cr[296]
+	+ Qr[36] * Ci[392] + Qi[36] * Cr[392]
+	+ Qr[12] * Ci[416] + Qi[12] * Cr[416]
+	- 2. * Ci[428];
+      Cr[428] =
+	Qr[4] * Cr[424] - Qi[4] * Ci[424]
+	- Cr[428];
+      Ci[428] =
+	Qr[4] * Ci[424] + Qi[4] * Cr[424]
+	- Ci[428];
+
+      Cr[430] =
+	Qr[430];
+      Ci[430] =
+	Qi[430];
+      Cr[430] =
+	Qr[426] * Cr[4] - Qi[426] * Ci[4]
+	+ Qr[422] * Cr[8] - Qi[422] * Ci[8]
+	+ Qr[398] * Cr[32] - Qi[398] * Ci[32]
+	+ Qr[302] * Cr[128] - Qi[302] * Ci[128]
+	+ Qr[174] * Cr[256] - Qi[174] * Ci[256]
+	- 5. * Cr[430];
+      Ci[430] =
+	Qr[426] * Ci[4] + Qi[426] * Cr[4]
+	+ Qr[422] * Ci[8] + Qi[422] * Cr[8]
+	+ Qr[398] * Ci[32] + Qi[398] * Cr[32]
+	+ Qr[302] * Ci[128] + Qi[302] * Cr[128]
+	+ Qr[174] * Ci[256] + Qi[174] * Cr[256]
+	- 5. * Ci[430];
+      Cr[430] =
+	Qr[418] * Cr[12] - Qi[418] * Ci[12]
+	+ Qr[394] * Cr[36] - Qi[394] * Ci[36]
+	+ Qr[390] * Cr[40] - Qi[390] * Ci[40]
+	+ Qr[298] * Cr[132] - Qi[298] * Ci[132]
+	+ Qr[294] * Cr[136] - Qi[294] * Ci[136]
+	+ Qr[270] * Cr[160] - Qi[270] * Ci[160]
+	+ Qr[170] * Cr[260] - Qi[170] * Ci[260]
+	+ Qr[166] * Cr[264] - Qi[166] * Ci[264]
+	+ Qr[142] * Cr[288] - Qi[142] * Ci[288]
+	+ Qr[46] * Cr[384] - Qi[46] * Ci[384]
+	- 4. * Cr[430];
+      Ci[430] =
+	Qr[418] * Ci[12] + Qi[418] * Cr[12]
+	+ Qr[394] * Ci[36] + Qi[394] * Cr[36]
+	+ Qr[390] * Ci[40] + Qi[390] * Cr[40]
+	+ Qr[298] * Ci[132] + Qi[298] * Cr[132]
+	+ Qr[294] * Ci[136] + Qi[294] * Cr[136]
+	+ Qr[270] * Ci[160] + Qi[270] * Cr[160]
+	+ Qr[170] * Ci[260] + Qi[170] * Cr[260]
+	+ Qr[166] * Ci[264] + Qi[166] * Cr[264]
+	+ Qr[142] * Ci[288] + Qi[142] * Cr[288]
+	+ Qr[46] * Ci[384] + Qi[46] * Cr[384]
+	- 4. * Ci[430];
+      Cr[430] =
+	Qr[386] * Cr[44] - Qi[386] * Ci[44]
+	+ Qr[290] * Cr[140] - Qi[290] * Ci[140]
+	+ Qr[266] * Cr[164] - Qi[266] * Ci[164]
+	+ Qr[262] * Cr[168] - Qi[262] * Ci[168]
+	+ Qr[162] * Cr[268] - Qi[162] * Ci[268]
+	+ Qr[138] * Cr[292] - Qi[138] * Ci[292]
+	+ Qr[134] * Cr[296] - Qi[134] * Ci[296]
+	+ Qr[42] * Cr[388] - Qi[42] * Ci[388]
+	+ Qr[38] * Cr[392] - Qi[38] * Ci[392]
+	+ Qr[14] * Cr[416] - Qi[14] * Ci[416]
+	- 3. * Cr[430];
+      Ci[430] =
+	Qr[386] * Ci[44] + Qi[386] * Cr[44]
+	+ Qr[290] * Ci[140] + Qi[290] * Cr[140]
+	+ Qr[266] * Ci[164] + Qi[266] * Cr[164]
+	+ Qr[262] * Ci[168] + Qi[262] * Cr[168]
+	+ Qr[162] * Ci[268] + Qi[162] * Cr[268]
+	+ Qr[138] * Ci[292] + Qi[138] * Cr[292]
+	+ Qr[134] * Ci[296] + Qi[134] * Cr[296]
+	+ Qr[42] * Ci[388] + Qi[42] * Cr[388]
+	+ Qr[38] * Ci[392] + Qi[38] * Cr[392]
+	+ Qr[14] * Ci[416] + Qi[14] * Cr[416]
+	- 3. * Ci[430];
+      Cr[430] =
+	Qr[258] * Cr[172] - Qi[258] * Ci[172]
+	+ Qr[130] * Cr[300] - Qi[130] * Ci[300]
+	+ Qr[34] * Cr[396] - Qi[34] * Ci[396]
+	+ Qr[10] * Cr[420] - Qi[10] * Ci[420]
+	+ Qr[6] * Cr[424] - Qi[6] * Ci[424]
+	- 2. * Cr[430];
+      Ci[430] =
+	Qr[258] * Ci[172] + Qi[258] * Cr[172]
+	+ Qr[130] * Ci[300] + Qi[130] * Cr[300]
+	+ Qr[34] * Ci[396] + Qi[34] * Cr[396]
+	+ Qr[10] * Ci[420] + Qi[10] * Cr[420]
+	+ Qr[6] * Ci[424] + Qi[6] * Cr[424]
+	- 2. * Ci[430];
+      Cr[430] =
+	Qr[2] * Cr[428] - Qi[2] * Ci[428]
+	- Cr[430];
+      Ci[430] =
+	Qr[2] * Ci[428] + Qi[2] * Cr[428]
+	- Ci[430];
+
+      Cr[432] =
+	Qr[432];
+      Ci[432] =
+	Qi[432];
+      Cr[432] =
+	Qr[400] * Cr[32] - Qi[400] * Ci[32]
+	+ Qr[304] * Cr[128] - Qi[304] * Ci[128]
+	+ Qr[176] * Cr[256] - Qi[176] * Ci[256]
+	- 3. * Cr[432];
+      Ci[432] =
+	Qr[400] * Ci[32] + Qi[400] * Cr[32]
+	+ Qr[304] * Ci[128] + Qi[304] * Cr[128]
+	+ Qr[176] * Ci[256] + Qi[176] * Cr[256]
+	- 3. * Ci[432];
+      Cr[432] =
+	Qr[272] * Cr[160] - Qi[272] * Ci[160]
+	+ Qr[144] * Cr[288] - Qi[144] * Ci[288]
+	+ Qr[48] * Cr[384] - Qi[48] * Ci[384]
+	- 2. * Cr[432];
+      Ci[432] =
+	Qr[272] * Ci[160] + Qi[272] * Cr[160]
+	+ Qr[144] * Ci[288] + Qi[144] * Cr[288]
+	+ Qr[48] * Ci[384] + Qi[48] * Cr[384]
+	- 2. * Ci[432];
+      Cr[432] =
+	Qr[16] * Cr[416] - Qi[16] * Ci[416]
+	- Cr[432];
+      Ci[432] =
+	Qr[16] * Ci[416] + Qi[16] * Cr[416]
+	- Ci[432];
+
+      Cr[434] =
+	Qr[434];
+      Ci[434] =
+	Qi[434];
+      Cr[434] =
+	Qr[418] * Cr[16] - Qi[418] * Ci[16]
+	+ Qr[402] * Cr[32] - Qi[402] * Ci[32]
+	+ Qr[306] * Cr[128] - Qi[306] * Ci[128]
+	+ Qr[178] * Cr[256] - Qi[178] * Ci[256]
+	- 4. * Cr[434];
+      Ci[434] =
+	Qr[418] * Ci[16] + Qi[418] * Cr[16]
+	+ Qr[402] * Ci[32] + Qi[402] * Cr[32]
+	+ Qr[306] * Ci[128] + Qi[306] * Cr[128]
+	+ Qr[178] * Ci[256] + Qi[178] * Cr[256]
+	- 4. * Ci[434];
+      Cr[434] =
+	Qr[386] * Cr[48] - Qi[386] * Ci[48]
+	+ Qr[290] * Cr[144] - Qi[290] * Ci[144]
+	+ Qr[274] * Cr[160] - Qi[274] * Ci[160]
+	+ Qr[162] * Cr[272] - Qi[162] * Ci[272]
+	+ Qr[146] * Cr[288] - Qi[146] * Ci[288]
+	+ Qr[50] * Cr[384] - Qi[50] * Ci[384]
+	- 3. * Cr[434];
+      Ci[434] =
+	Qr[386] * Ci[48] + Qi[386] * Cr[48]
+	+ Qr[290] * Ci[144] + Qi[290] * Cr[144]
+	+ Qr[274] * Ci[160] + Qi[274] * Cr[160]
+	+ Qr[162] * Ci[272] + Qi[162] * Cr[272]
+	+ Qr[146] * Ci[288] + Qi[146] * Cr[288]
+	+ Qr[50] * Ci[384] + Qi[50] * Cr[384]
+	- 3. * Ci[434];
+      Cr[434] =
+	Qr[258] * Cr[176] - Qi[258] * Ci[176]
+	+ Qr[130] * Cr[304] - Qi[130] * Ci[304]
+	+ Qr[34] * Cr[400] - Qi[34] * Ci[400]
+	+ Qr[18] * Cr[416] - Qi[18] * Ci[416]
+	- 2. * Cr[434];
+      Ci[434] =
+	Qr[258] * Ci[176] + Qi[258] * Cr[176]
+	+ Qr[130] * Ci[304] + Qi[130] * Cr[304]
+	+ Qr[34] * Ci[400] + Qi[34] * Cr[400]
+	+ Qr[18] * Ci[416] + Qi[18] * Cr[416]
+	- 2. * Ci[434];
+      Cr[434] =
+	Qr[2] * Cr[432] - Qi[2] * Ci[432]
+	- Cr[434];
+      Ci[434] =
+	Qr[2] * Ci[432] + Qi[2] * Cr[432]
+	- Ci[434];
+
+      Cr[436] =
+	Qr[436];
+      Ci[436] =
+	Qi[436];
+      Cr[436] =
+	Qr[420] * Cr[16] - Qi[420] * Ci[16]
+	+ Qr[404] * Cr[32] - Qi[404] * Ci[32]
+	+ Qr[308] * Cr[128] - Qi[308] * Ci[128]
+	+ Qr[180] * Cr[256] - Qi[180] * Ci[256]
+	- 4. * Cr[436];
+      Ci[436] =
+	Qr[420] * Ci[16] + Qi[420] * Cr[16]
+	+ Qr[404] * Ci[32] + Qi[404] * Cr[32]
+	+ Qr[308] * Ci[128] + Qi[308] * Cr[128]
+	+ Qr[180] * Ci[256] + Qi[180] * Cr[256]
+	- 4. * Ci[436];
+      Cr[436] =
+	Qr[388] * Cr[48] - Qi[388] * Ci[48]
+	+ Qr[292] * Cr[144] - Qi[292] * Ci[144]
+	+ Qr[276] * Cr[160] - Qi[276] * Ci[160]
+	+ Qr[164] * Cr[272] - Qi[164] * Ci[272]
+	+ Qr[148] * Cr[288] - Qi[148] * Ci[288]
+	+ Qr[52] * Cr[384] - Qi[52] * Ci[384]
+	- 3. * Cr[436];
+      Ci[436] =
+	Qr[388] * Ci[48] + Qi[388] * Cr[48]
+	+ Qr[292] * Ci[144] + Qi[292] * Cr[144]
+	+ Qr[276] * Ci[160] + Qi[276] * Cr[160]
+	+ Qr[164] * Ci[272] + Qi[164] * Cr[272]
+	+ Qr[148] * Ci[288] + Qi[148] * Cr[288]
+	+ Qr[52] * Ci[384] + Qi[52] * Cr[384]
+	- 3. * Ci[436];
+      Cr[436] =
+	Qr[260] * Cr[176] - Qi[260] * Ci[176]
+	+ Qr[132] * Cr[304] - Qi[132] * Ci[304]
+	+ Qr[36] * Cr[400] - Qi[36] * Ci[400]
+	+ Qr[20] * Cr[416] - Qi[20] * Ci[416]
+	- 2. * Cr[436];
+      Ci[436] =
+	Qr[260] * Ci[176] + Qi[260] * Cr[176]
+	+ Qr[132] * Ci[304] + Qi[132] * Cr[304]
+	+ Qr[36] * Ci[400] + Qi[36] * Cr[400]
+	+ Qr[20] * Ci[416] + Qi[20] * Cr[416]
+	- 2. * Ci[436];
+      Cr[436] =
+	Qr[4] * Cr[432] - Qi[4] * Ci[432]
+	- Cr[436];
+      Ci[436] =
+	Qr[4] * Ci[432] + Qi[4] * Cr[432]
+	- Ci[436];
+
+      Cr[438] =
+	Qr[438];
+      Ci[438] =
+	Qi[438];
+      Cr[438] =
+	Qr[434] * Cr[4] - Qi[434] * Ci[4]
+	+ Qr[422] * Cr[16] - Qi[422] * Ci[16]
+	+ Qr[406] * Cr[32] - Qi[406] * Ci[32]
+	+ Qr[310] * Cr[128] - Qi[310] * Ci[128]
+	+ Qr[182] * Cr[256] - Qi[182] * Ci[256]
+	- 5. * Cr[438];
+      Ci[438] =
+	Qr[434] * Ci[4] + Qi[434] * Cr[4]
+	+ Qr[422] * Ci[16] + Qi[422] * Cr[16]
+	+ Qr[406] * Ci[32] + Qi[406] * Cr[32]
+	+ Qr[310] * Ci[128] + Qi[310] * Cr[128]
+	+ Qr[182] * Ci[256] + Qi[182] * Cr[256]
+	- 5. * Ci[438];
+      Cr[438] =
+	Qr[418] * Cr[20] - Qi[418] * Ci[20]
+	+ Qr[402] * Cr[36] - Qi[402] * Ci[36]
+	+ Qr[390] * Cr[48] - Qi[390] * Ci[48]
+	+ Qr[306] * Cr[132] - Qi[306] * Ci[132]
+	+ Qr[294] * Cr[144] - Qi[294] * Ci[144]
+	+ Qr[278] * Cr[160] - Qi[278] * Ci[160]
+	+ Qr[178] * Cr[260] - Qi[178] * Ci[260]
+	+ Qr[166] * Cr[272] - Qi[166] * Ci[272]
+	+ Qr[150] * Cr[288] - Qi[150] * Ci[288]
+	+ Qr[54] * Cr[384] - Qi[54] * Ci[384]
+	- 4. * Cr[438];
+      Ci[438] =
+	Qr[418] * Ci[20] + Qi[418] * Cr[20]
+	+ Qr[402] * Ci[36] + Qi[402] * Cr[36]
+	+ Qr[390] * Ci[48] + Qi[390] * Cr[48]
+	+ Qr[306] * Ci[132] + Qi[306] * Cr[132]
+	+ Qr[294] * Ci[144] + Qi[294] * Cr[144]
+	+ Qr[278] * Ci[160] + Qi[278] * Cr[160]
+	+ Qr[178] * Ci[260] + Qi[178] * Cr[260]
+	+ Qr[166] * Ci[272] + Qi[166] * Cr[272]
+	+ Qr[150] * Ci[288] + Qi[150] * Cr[288]
+	+ Qr[54] * Ci[384] + Qi[54] * Cr[384]
+	- 4. * Ci[438];
+      Cr[438] =
+	Qr[386] * Cr[52] - Qi[386] * Ci[52]
+	+ Qr[290] * Cr[148] - Qi[290] * Ci[148]
+	+ Qr[274] * Cr[164] - Qi[274] * Ci[164]
+	+ Qr[262] * Cr[176] - Qi[262] * Ci[176]
+	+ Qr[162] * Cr[276] - Qi[162] * Ci[276]
+	+ Qr[146] * Cr[292] - Qi[146] * Ci[292]
+	+ Qr[134] * Cr[304] - Qi[134] * Ci[304]
+	+ Qr[50] * Cr[388] - Qi[50] * Ci[388]
+	+ Qr[38] * Cr[400] - Qi[38] * Ci[400]
+	+ Qr[22] * Cr[416] - Qi[22] * Ci[416]
+	- 3. * Cr[438];
+      Ci[438] =
+	Qr[386] * Ci[52] + Qi[386] * Cr[52]
+	+ Qr[290] * Ci[148] + Qi[290] * Cr[148]
+	+ Qr[274] * Ci[164] + Qi[274] * Cr[164]
+	+ Qr[262] * Ci[176] + Qi[262] * Cr[176]
+	+ Qr[162] * Ci[276] + Qi[162] * Cr[276]
+	+ Qr[146] * Ci[292] + Qi[146] * Cr[292]
+	+ Qr[134] * Ci[304] + Qi[134] * Cr[304]
+	+ Qr[50] * Ci[388] + Qi[50] * Cr[388]
+	+ Qr[38] * Ci[400] + Qi[38] * Cr[400]
+	+ Qr[22] * Ci[416] + Qi[22] * Cr[416]
+	- 3. * Ci[438];
+      Cr[438] =
+	Qr[258] * Cr[180] - Qi[258] * Ci[180]
+	+ Qr[130] * Cr[308] - Qi[130] * Ci[308]
+	+ Qr[34] * Cr[404] - Qi[34] * Ci[404]
+	+ Qr[18] * Cr[420] - Qi[18] * Ci[420]
+	+ Qr[6] * Cr[432] - Qi[6] * Ci[432]
+	- 2. * Cr[438];
+      Ci[438] =
+	Qr[258] * Ci[180] + Qi[258] * Cr[180]
+	+ Qr[130] * Ci[308] + Qi[130] * Cr[308]
+	+ Qr[34] * Ci[404] + Qi[34] * Cr[404]
+	+ Qr[18] * Ci[420] + Qi[18] * Cr[420]
+	+ Qr[6] * Ci[432] + Qi[6] * Cr[432]
+	- 2. * Ci[438];
+      Cr[438] =
+	Qr[2] * Cr[436] - Qi[2] * Ci[436]
+	- Cr[438];
+      Ci[438] =
+	Qr[2] * Ci[436] + Qi[2] * Cr[436]
+	- Ci[438];
+    }
+
+    /** Part 16 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part16(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[440] =
+	Qr[440];
+      Ci[440] =
+	Qi[440];
+      Cr[440] =
+	Qr[424] * Cr[16] - Qi[424] * Ci[16]
+	+ Qr[408] * Cr[32] - Qi[408] * Ci[32]
+	+ Qr[312] * Cr[128] - Qi[312] * Ci[128]
+	+ Qr[184] * Cr[256] - Qi[184] * Ci[256]
+	- 4. * Cr[440];
+      Ci[440] =
+	Qr[424] * Ci[16] + Qi[424] * Cr[16]
+	+ Qr[408] * Ci[32] + Qi[408] * Cr[32]
+	+ Qr[312] * Ci[128] + Qi[312] * Cr[128]
+	+ Qr[184] * Ci[256] + Qi[184] * Cr[256]
+	- 4. * Ci[440];
+      Cr[440] =
+	Qr[392] * Cr[48] - Qi[392] * Ci[48]
+	+ Qr[296] * Cr[144] - Qi[296] * Ci[144]
+	+ Qr[280] * Cr[160] - Qi[280] * Ci[160]
+	+ Qr[168] * Cr[272] - Qi[168] * Ci[272]
+	+ Qr[152] * Cr[288] - Qi[152] * Ci[288]
+	+ Qr[56] * Cr[384] - Qi[56] * Ci[384]
+	- 3. * Cr[440];
+      Ci[440] =
+	Qr[392] * Ci[48] + Qi[392] * Cr[48]
+	+ Qr[296] * Ci[144] + Qi[296] * Cr[144]
+	+ Qr[280] * Ci[160] + Qi[280] * Cr[160]
+	+ Qr[168] * Ci[272] + Qi[168] * Cr[272]
+	+ Qr[152] * Ci[288] + Qi[152] * Cr[288]
+	+ Qr[56] * Ci[384] + Qi[56] * Cr[384]
+	- 3. * Ci[440];
+      Cr[440] =
+	Qr[264] * Cr[176] - Qi[264] * Ci[176]
+	+ Qr[136] * Cr[304] - Qi[136] * Ci[304]
+	+ Qr[40] * Cr[400] - Qi[40] * Ci[400]
+	+ Qr[24] * Cr[416] - Qi[24] * Ci[416]
+	- 2. * Cr[440];
+      Ci[440] =
+	Qr[264] * Ci[176] + Qi[264] * Cr[176]
+	+ Qr[136] * Ci[304] + Qi[136] * Cr[304]
+	+ Qr[40] * Ci[400] + Qi[40] * Cr[400]
+	+ Qr[24] * Ci[416] + Qi[24] * Cr[416]
+	- 2. * Ci[440];
+      Cr[440] =
+	Qr[8] * Cr[432] - Qi[8] * Ci[432]
+	- Cr[440];
+      Ci[440] =
+	Qr[8] * Ci[432] + Qi[8] * Cr[432]
+	- Ci[440];
+
+      Cr[442] =
+	Qr[442];
+      Ci[442] =
+	Qi[442];
+      Cr[442] =
+	Qr[434] * Cr[8] - Qi[434] * Ci[8]
+	+ Qr[426] * Cr[16] - Qi[426] * Ci[16]
+	+ Qr[410] * Cr[32] - Qi[410] * Ci[32]
+	+ Qr[314] * Cr[128] - Qi[314] * Ci[128]
+	+ Qr[186] * Cr[256] - Qi[186] * Ci[256]
+	- 5. * Cr[442];
+      Ci[442] =
+	Qr[434] * Ci[8] + Qi[434] * Cr[8]
+	+ Qr[426] * Ci[16] + Qi[426] * Cr[16]
+	+ Qr[410] * Ci[32] + Qi[410] * Cr[32]
+	+ Qr[314] * Ci[128] + Qi[314] * Cr[128]
+	+ Qr[186] * Ci[256] + Qi[186] * Cr[256]
+	- 5. * Ci[442];
+      Cr[442] =
+	Qr[418] * Cr[24] - Qi[418] * Ci[24]
+	+ Qr[402] * Cr[40] - Qi[402] * Ci[40]
+	+ Qr[394] * Cr[48] - Qi[394] * Ci[48]
+	+ Qr[306] * Cr[136] - Qi[306] * Ci[136]
+	+ Qr[298] * Cr[144] - Qi[298] * Ci[144]
+	+ Qr[282] * Cr[160] - Qi[282] * Ci[160]
+	+ Qr[178] * Cr[264] - Qi[178] * Ci[264]
+	+ Qr[170] * Cr[272] - Qi[170] * Ci[272]
+	+ Qr[154] * Cr[288] - Qi[154] * Ci[288]
+	+ Qr[58] * Cr[384] - Qi[58] * Ci[384]
+	- 4. * Cr[442];
+      Ci[442] =
+	Qr[418] * Ci[24] + Qi[418] * Cr[24]
+	+ Qr[402] * Ci[40] + Qi[402] * Cr[40]
+	+ Qr[394] * Ci[48] + Qi[394] * Cr[48]
+	+ Qr[306] * Ci[136] + Qi[306] * Cr[136]
+	+ Qr[298] * Ci[144] + Qi[298] * Cr[144]
+	+ Qr[282] * Ci[160] + Qi[282] * Cr[160]
+	+ Qr[178] * Ci[264] + Qi[178] * Cr[264]
+	+ Qr[170] * Ci[272] + Qi[170] * Cr[272]
+	+ Qr[154] * Ci[288] + Qi[154] * Cr[288]
+	+ Qr[58] * Ci[384] + Qi[58] * Cr[384]
+	- 4. * Ci[442];
+      Cr[442] =
+	Qr[386] * Cr[56] - Qi[386] * Ci[56]
+	+ Qr[290] * Cr[152] - Qi[290] * Ci[152]
+	+ Qr[274] * Cr[168] - Qi[274] * Ci[168]
+	+ Qr[266] * Cr[176] - Qi[266] * Ci[176]
+	+ Qr[162] * Cr[280] - Qi[162] * Ci[280]
+	+ Qr[146] * Cr[296] - Qi[146] * Ci[296]
+	+ Qr[138] * Cr[304] - Qi[138] * Ci[304]
+	+ Qr[50] * Cr[392] - Qi[50] * Ci[392]
+	+ Qr[42] * Cr[400] - Qi[42] * Ci[400]
+	+ Qr[26] * Cr[416] - Qi[26] * Ci[416]
+	- 3. * Cr[442];
+      Ci[442] =
+	Qr[386] * Ci[56] + Qi[386] * Cr[56]
+	+ Qr[290] * Ci[152] + Qi[290] * Cr[152]
+	+ Qr[274] * Ci[168] + Qi[274] * Cr[168]
+	+ Qr[266] * Ci[176] + Qi[266] * Cr[176]
+	+ Qr[162] * Ci[280] + Qi[162] * Cr[280]
+	+ Qr[146] * Ci[296] + Qi[146] * Cr[296]
+	+ Qr[138] * Ci[304] + Qi[138] * Cr[304]
+	+ Qr[50] * Ci[392] + Qi[50] * Cr[392]
+	+ Qr[42] * Ci[400] + Qi[42] * Cr[400]
+	+ Qr[26] * Ci[416] + Qi[26] * Cr[416]
+	- 3. * Ci[442];
+      Cr[442] =
+	Qr[258] * Cr[184] - Qi[258] * Ci[184]
+	+ Qr[130] * Cr[312] - Qi[130] * Ci[312]
+	+ Qr[34] * Cr[408] - Qi[34] * Ci[408]
+	+ Qr[18] * Cr[424] - Qi[18] * Ci[424]
+	+ Qr[10] * Cr[432] - Qi[10] * Ci[432]
+	- 2. * Cr[442];
+      Ci[442] =
+	Qr[258] * Ci[184] + Qi[258] * Cr[184]
+	+ Qr[130] * Ci[312] + Qi[130] * Cr[312]
+	+ Qr[34] * Ci[408] + Qi[34] * Cr[408]
+	+ Qr[18] * Ci[424] + Qi[18] * Cr[424]
+	+ Qr[10] * Ci[432] + Qi[10] * Cr[432]
+	- 2. * Ci[442];
+      Cr[442] =
+	Qr[2] * Cr[440] - Qi[2] * Ci[440]
+	- Cr[442];
+      Ci[442] =
+	Qr[2] * Ci[440] + Qi[2] * Cr[440]
+	- Ci[442];
+
+      Cr[444] =
+	Qr[444];
+      Ci[444] =
+	Qi[444];
+      Cr[444] =
+	Qr[436] * Cr[8] - Qi[436] * Ci[8]
+	+ Qr[428] * Cr[16] - Qi[428] * Ci[16]
+	+ Qr[412] * Cr[32] - Qi[412] * Ci[32]
+	+ Qr[316] * Cr[128] - Qi[316] * Ci[128]
+	+ Qr[188] * Cr[256] - Qi[188] * Ci[256]
+	- 5. * Cr[444];
+      Ci[444] =
+	Qr[436] * Ci[8] + Qi[436] * Cr[8]
+	+ Qr[428] * Ci[16] + Qi[428] * Cr[16]
+	+ Qr[412] * Ci[32] + Qi[412] * Cr[32]
+	+ Qr[316] * Ci[128] + Qi[316] * Cr[128]
+	+ Qr[188] * Ci[256] + Qi[188] * Cr[256]
+	- 5. * Ci[444];
+      Cr[444] =
+	Qr[420] * Cr[24] - Qi[420] * Ci[24]
+	+ Qr[404] * Cr[40] - Qi[404] * Ci[40]
+	+ Qr[396] * Cr[48] - Qi[396] * Ci[48]
+	+ Qr[308] * Cr[136] - Qi[308] * Ci[136]
+	+ Qr[300] * Cr[144] - Qi[300] * Ci[144]
+	+ Qr[284] * Cr[160] - Qi[284] * Ci[160]
+	+ Qr[180] * Cr[264] - Qi[180] * Ci[264]
+	+ Qr[172] * Cr[272] - Qi[172] * Ci[272]
+	+ Qr[156] * Cr[288] - Qi[156] * Ci[288]
+	+ Qr[60] * Cr[384] - Qi[60] * Ci[384]
+	- 4. * Cr[444];
+      Ci[444] =
+	Qr[420] * Ci[24] + Qi[420] * Cr[24]
+	+ Qr[404] * Ci[40] + Qi[404] * Cr[40]
+	+ Qr[396] * Ci[48] + Qi[396] * Cr[48]
+	+ Qr[308] * Ci[136] + Qi[308] * Cr[136]
+	+ Qr[300] * Ci[144] + Qi[300] * Cr[144]
+	+ Qr[284] * Ci[160] + Qi[284] * Cr[160]
+	+ Qr[180] * Ci[264] + Qi[180] * Cr[264]
+	+ Qr[172] * Ci[272] + Qi[172] * Cr[272]
+	+ Qr[156] * Ci[288] + Qi[156] * Cr[288]
+	+ Qr[60] * Ci[384] + Qi[60] * Cr[384]
+	- 4. * Ci[444];
+      Cr[444] =
+	Qr[388] * Cr[56] - Qi[388] * Ci[56]
+	+ Qr[292] * Cr[152] - Qi[292] * Ci[152]
+	+ Qr[276] * Cr[168] - Qi[276] * Ci[168]
+	+ Qr[268] * Cr[176] - Qi[268] * Ci[176]
+	+ Qr[164] * Cr[280] - Qi[164] * Ci[280]
+	+ Qr[148] * Cr[296] - Qi[148] * Ci[296]
+	+ Qr[140] * Cr[304] - Qi[140] * Ci[304]
+	+ Qr[52] * Cr[392] - Qi[52] * Ci[392]
+	+ Qr[44] * Cr[400] - Qi[44] * Ci[400]
+	+ Qr[28] * Cr[416] - Qi[28] * Ci[416]
+	- 3. * Cr[444];
+      Ci[444] =
+	Qr[388] * Ci[56] + Qi[388] * Cr[56]
+	+ Qr[292] * Ci[152] + Qi[292] * Cr[152]
+	+ Qr[276] * Ci[168] + Qi[276] * Cr[168]
+	+ Qr[268] * Ci[176] + Qi[268] * Cr[176]
+	+ Qr[164] * Ci[280] + Qi[164] * Cr[280]
+	+ Qr[148] * Ci[296] + Qi[148] * Cr[296]
+	+ Qr[140] * Ci[304] + Qi[140] * Cr[304]
+	+ Qr[52] * Ci[392] + Qi[52] * Cr[392]
+	+ Qr[44] * Ci[400] + Qi[44] * Cr[400]
+	+ Qr[28] * Ci[416] + Qi[28] * Cr[416]
+	- 3. * Ci[444];
+      Cr[444] =
+	Qr[260] * Cr[184] - Qi[260] * Ci[184]
+	+ Qr[132] * Cr[312] - Qi[132] * Ci[312]
+	+ Qr[36] * Cr[408] - Qi[36] * Ci[408]
+	+ Qr[20] * Cr[424] - Qi[20] * Ci[424]
+	+ Qr[12] * Cr[432] - Qi[12] * Ci[432]
+	- 2. * Cr[444];
+      Ci[444] =
+	Qr[260] * Ci[184] + Qi[260] * Cr[184]
+	+ Qr[132] * Ci[312] + Qi[132] * Cr[312]
+	+ Qr[36] * Ci[408] + Qi[36] * Cr[408]
+	+ Qr[20] * Ci[424] + Qi[20] * Cr[424]
+	+ Qr[12] * Ci[432] + Qi[12] * Cr[432]
+	- 2. * Ci[444];
+      Cr[444] =
+	Qr[4] * Cr[440] - Qi[4] * Ci[440]
+	- Cr[444];
+      Ci[444] =
+	Qr[4] * Ci[440] + Qi[4] * Cr[440]
+	- Ci[444];
+
+      Cr[446] =
+	Qr[446];
+      Ci[446] =
+	Qi[446];
+      Cr[446] =
+	Qr[442] * Cr[4] - Qi[442] * Ci[4]
+	+ Qr[438] * Cr[8] - Qi[438] * Ci[8]
+	+ Qr[430] * Cr[16] - Qi[430] * Ci[16]
+	+ Qr[414] * Cr[32] - Qi[414] * Ci[32]
+	+ Qr[318] * Cr[128] - Qi[318] * Ci[128]
+	+ Qr[190] * Cr[256] - Qi[190] * Ci[256]
+	- 6. * Cr[446];
+      Ci[446] =
+	Qr[442] * Ci[4] + Qi[442] * Cr[4]
+	+ Qr[438] * Ci[8] + Qi[438] * Cr[8]
+	+ Qr[430] * Ci[16] + Qi[430] * Cr[16]
+	+ Qr[414] * Ci[32] + Qi[414] * Cr[32]
+	+ Qr[318] * Ci[128] + Qi[318] * Cr[128]
+	+ Qr[190] * Ci[256] + Qi[190] * Cr[256]
+	- 6. * Ci[446];
+      Cr[446] =
+	Qr[434] * Cr[12] - Qi[434] * Ci[12]
+	+ Qr[426] * Cr[20] - Qi[426] * Ci[20]
+	+ Qr[422] * Cr[24] - Qi[422] * Ci[24]
+	+ Qr[410] * Cr[36] - Qi[410] * Ci[36]
+	+ Qr[406] * Cr[40] - Qi[406] * Ci[40]
+	+ Qr[398] * Cr[48] - Qi[398] * Ci[48]
+	+ Qr[314] * Cr[132] - Qi[314] * Ci[132]
+	+ Qr[310] * Cr[136] - Qi[310] * Ci[136]
+	+ Qr[302] * Cr[144] - Qi[302] * Ci[144]
+	+ Qr[286] * Cr[160] - Qi[286] * Ci[160]
+	+ Qr[186] * Cr[260] - Qi[186] * Ci[260]
+	+ Qr[182] * Cr[264] - Qi[182] * Ci[264]
+	+ Qr[174] * Cr[272] - Qi[174] * Ci[272]
+	+ Qr[158] * Cr[288] - Qi[158] * Ci[288]
+	+ Qr[62] * Cr[384] - Qi[62] * Ci[384]
+	- 5. * Cr[446];
+      Ci[446] =
+	Qr[434] * Ci[12] + Qi[434] * Cr[12]
+	+ Qr[426] * Ci[20] + Qi[426] * Cr[20]
+	+ Qr[422] * Ci[24] + Qi[422] * Cr[24]
+	+ Qr[410] * Ci[36] + Qi[410] * Cr[36]
+	+ Qr[406] * Ci[40] + Qi[406] * Cr[40]
+	+ Qr[398] * Ci[48] + Qi[398] * Cr[48]
+	+ Qr[314] * Ci[132] + Qi[314] * Cr[132]
+	+ Qr[310] * Ci[136] + Qi[310] * Cr[136]
+	+ Qr[302] * Ci[144] + Qi[302] * Cr[144]
+	+ Qr[286] * Ci[160] + Qi[286] * Cr[160]
+	+ Qr[186] * Ci[260] + Qi[186] * Cr[260]
+	+ Qr[182] * Ci[264] + Qi[182] * Cr[264]
+	+ Qr[174] * Ci[272] + Qi[174] * Cr[272]
+	+ Qr[158] * Ci[288] + Qi[158] * Cr[288]
+	+ Qr[62] * Ci[384] + Qi[62] * Cr[384]
+	- 5. * Ci[446];
+      Cr[446] =
+	Qr[418] * Cr[28] - Qi[418] * Ci[28]
+	+ Qr[402] * Cr[44] - Qi[402] * Ci[44]
+	+ Qr[394] * Cr[52] - Qi[394] * Ci[52]
+	+ Qr[390] * Cr[56] - Qi[390] * Ci[56]
+	+ Qr[306] * Cr[140] - Qi[306] * Ci[140]
+	+ Qr[298] * Cr[148] - Qi[298] * Ci[148]
+	+ Qr[294] * Cr[152] - Qi[294] * Ci[152]
+	+ Qr[282] * Cr[164] - Qi[282] * Ci[164]
+	+ Qr[278] * Cr[168] - Qi[278] * Ci[168]
+	+ Qr[270] * Cr[176] - Qi[270] * Ci[176]
+	+ Qr[178] * Cr[268] - Qi[178] * Ci[268]
+	+ Qr[170] * Cr[276] - Qi[170] * Ci[276]
+	+ Qr[166] * Cr[280] - Qi[166] * Ci[280]
+	+ Qr[154] * Cr[292] - Qi[154] * Ci[292]
+	+ Qr[150] * Cr[296] - Qi[150] * Ci[296]
+	+ Qr[142] * Cr[304] - Qi[142] * Ci[304]
+	+ Qr[58] * Cr[388] - Qi[58] * Ci[388]
+	+ Qr[54] * Cr[392] - Qi[54] * Ci[392]
+	+ Qr[46] * Cr[400] - Qi[46] * Ci[400]
+	+ Qr[30] * Cr[416] - Qi[30] * Ci[416]
+	- 4. * Cr[446];
+      Ci[446] =
+	Qr[418] * Ci[28] + Qi[418] * Cr[28]
+	+ Qr[402] * Ci[44] + Qi[402] * Cr[44]
+	+ Qr[394] * Ci[52] + Qi[394] * Cr[52]
+	+ Qr[390] * Ci[56] + Qi[390] * Cr[56]
+	+ Qr[306] * Ci[140] + Qi[306] * Cr[140]
+	+ Qr[298] * Ci[148] + Qi[298] * Cr[148]
+	+ Qr[294] * Ci[152] + Qi[294] * Cr[152]
+	+ Qr[282] * Ci[164] + Qi[282] * Cr[164]
+	+ Qr[278] * Ci[168] + Qi[278] * Cr[168]
+	+ Qr[270] * Ci[176] + Qi[270] * Cr[176]
+	+ Qr[178] * Ci[268] + Qi[178] * Cr[268]
+	+ Qr[170] * Ci[276] + Qi[170] * Cr[276]
+	+ Qr[166] * Ci[280] + Qi[166] * Cr[280]
+	+ Qr[154] * Ci[292] + Qi[154] * Cr[292]
+	+ Qr[150] * Ci[296] + Qi[150] * Cr[296]
+	+ Qr[142] * Ci[304] + Qi[142] * Cr[304]
+	+ Qr[58] * Ci[388] + Qi[58] * Cr[388]
+	+ Qr[54] * Ci[392] + Qi[54] * Cr[392]
+	+ Qr[46] * Ci[400] + Qi[46] * Cr[400]
+	+ Qr[30] * Ci[416] + Qi[30] * Cr[416]
+	- 4. * Ci[446];
+      Cr[446] =
+	Qr[386] * Cr[60] - Qi[386] * Ci[60]
+	+ Qr[290] * Cr[156] - Qi[290] * Ci[156]
+	+ Qr[274] * Cr[172] - Qi[274] * Ci[172]
+	+ Qr[266] * Cr[180] - Qi[266] * Ci[180]
+	+ Qr[262] * Cr[184] - Qi[262] * Ci[184]
+	+ Qr[162] * Cr[284] - Qi[162] * Ci[284]
+	+ Qr[146] * Cr[300] - Qi[146] * Ci[300]
+	+ Qr[138] * Cr[308] - Qi[138] * Ci[308]
+	+ Qr[134] * Cr[312] - Qi[134] * Ci[312]
+	+ Qr[50] * Cr[396] - Qi[50] * Ci[396]
+	+ Qr[42] * Cr[404] - Qi[42] * Ci[404]
+	+ Qr[38] * Cr[408] - Qi[38] * Ci[408]
+	+ Qr[26] * Cr[420] - Qi[26] * Ci[420]
+	+ Qr[22] * Cr[424] - Qi[22] * Ci[424]
+	+ Qr[14] * Cr[432] - Qi[14] * Ci[432]
+	- 3. * Cr[446];
+      Ci[446] =
+	Qr[386] * Ci[60] + Qi[386] * Cr[60]
+	+ Qr[290] * Ci[156] + Qi[290] * Cr[156]
+	+ Qr[274] * Ci[172] + Qi[274] * Cr[172]
+	+ Qr[266] * Ci[180] + Qi[266] * Cr[180]
+	+ Qr[262] * Ci[184] + Qi[262] * Cr[184]
+	+ Qr[162] * Ci[284] + Qi[162] * Cr[284]
+	+ Qr[146] * Ci[300] + Qi[146] * Cr[300]
+	+ Qr[138] * Ci[308] + Qi[138] * Cr[308]
+	+ Qr[134] * Ci[312] + Qi[134] * Cr[312]
+	+ Qr[50] * Ci[396] + Qi[50] * Cr[396]
+	+ Qr[42] * Ci[404] + Qi[42] * Cr[404]
+	+ Qr[38] * Ci[408] + Qi[38] * Cr[408]
+	+ Qr[26] * Ci[420] + Qi[26] * Cr[420]
+	+ Qr[22] * Ci[424] + Qi[22] * Cr[424]
+	+ Qr[14] * Ci[432] + Qi[14] * Cr[432]
+	- 3. * Ci[446];
+      Cr[446] =
+	Qr[258] * Cr[188] - Qi[258] * Ci[188]
+	+ Qr[130] * Cr[316] - Qi[130] * Ci[316]
+	+ Qr[34] * Cr[412] - Qi[34] * Ci[412]
+	+ Qr[18] * Cr[428] - Qi[18] * Ci[428]
+	+ Qr[10] * Cr[436] - Qi[10] * Ci[436]
+	+ Qr[6] * Cr[440] - Qi[6] * Ci[440]
+	- 2. * Cr[446];
+      Ci[446] =
+	Qr[258] * Ci[188] + Qi[258] * Cr[188]
+	+ Qr[130] * Ci[316] + Qi[130] * Cr[316]
+	+ Qr[34] * Ci[412] + Qi[34] * Cr[412]
+	+ Qr[18] * Ci[428] + Qi[18] * Cr[428]
+	+ Qr[10] * Ci[436] + Qi[10] * Cr[436]
+	+ Qr[6] * Ci[440] + Qi[6] * Cr[440]
+	- 2. * Ci[446];
+      Cr[446] =
+	Qr[2] * Cr[444] - Qi[2] * Ci[444]
+	- Cr[446];
+      Ci[446] =
+	Qr[2] * Ci[444] + Qi[2] * Cr[444]
+	- Ci[446];
+    }
+
+    /** Part 17 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part17(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[448] =
+	Qr[448];
+      Ci[448] =
+	Qi[448];
+      Cr[448] =
+	Qr[320] * Cr[128] - Qi[320] * Ci[128]
+	+ Qr[192] * Cr[256] - Qi[192] * Ci[256]
+	- 2. * Cr[448];
+      Ci[448] =
+	Qr[320] * Ci[128] + Qi[320] * Cr[128]
+	+ Qr[192] * Ci[256] + Qi[192] * Cr[256]
+	- 2. * Ci[448];
+      Cr[448] =
+	Qr[64] * Cr[384] - Qi[64] * Ci[384]
+	- Cr[448];
+      Ci[448] =
+	Qr[64] * Ci[384] + Qi[64] * Cr[384]
+	- Ci[448];
+
+      Cr[450] =
+	Qr[450];
+      Ci[450] =
+	Qi[450];
+      Cr[450] =
+	Qr[386] * Cr[64] - Qi[386] * Ci[64]
+	+ Qr[322] * Cr[128] - Qi[322] * Ci[128]
+	+ Qr[194] * Cr[256] - Qi[194] * Ci[256]
+	- 3. * Cr[450];
+      Ci[450] =
+	Qr[386] * Ci[64] + Qi[386] * Cr[64]
+	+ Qr[322] * Ci[128] + Qi[322] * Cr[128]
+	+ Qr[194] * Ci[256] + Qi[194] * Cr[256]
+	- 3. * Ci[450];
+      Cr[450] =
+	Qr[258] * Cr[192] - Qi[258] * Ci[192]
+	+ Qr[130] * Cr[320] - Qi[130] * Ci[320]
+	+ Qr[66] * Cr[384] - Qi[66] * Ci[384]
+	- 2. * Cr[450];
+      Ci[450] =
+	Qr[258] * Ci[192] + Qi[258] * Cr[192]
+	+ Qr[130] * Ci[320] + Qi[130] * Cr[320]
+	+ Qr[66] * Ci[384] + Qi[66] * Cr[384]
+	- 2. * Ci[450];
+      Cr[450] =
+	Qr[2] * Cr[448] - Qi[2] * Ci[448]
+	- Cr[450];
+      Ci[450] =
+	Qr[2] * Ci[448] + Qi[2] * Cr[448]
+	- Ci[450];
+
+      Cr[452] =
+	Qr[452];
+      Ci[452] =
+	Qi[452];
+      Cr[452] =
+	Qr[388] * Cr[64] - Qi[388] * Ci[64]
+	+ Qr[324] * Cr[128] - Qi[324] * Ci[128]
+	+ Qr[196] * Cr[256] - Qi[196] * Ci[256]
+	- 3. * Cr[452];
+      Ci[452] =
+	Qr[388] * Ci[64] + Qi[388] * Cr[64]
+	+ Qr[324] * Ci[128] + Qi[324] * Cr[128]
+	+ Qr[196] * Ci[256] + Qi[196] * Cr[256]
+	- 3. * Ci[452];
+      Cr[452] =
+	Qr[260] * Cr[192] - Qi[260] * Ci[192]
+	+ Qr[132] * Cr[320] - Qi[132] * Ci[320]
+	+ Qr[68] * Cr[384] - Qi[68] * Ci[384]
+	- 2. * Cr[452];
+      Ci[452] =
+	Qr[260] * Ci[192] + Qi[260] * Cr[192]
+	+ Qr[132] * Ci[320] + Qi[132] * Cr[320]
+	+ Qr[68] * Ci[384] + Qi[68] * Cr[384]
+	- 2. * Ci[452];
+      Cr[452] =
+	Qr[4] * Cr[448] - Qi[4] * Ci[448]
+	- Cr[452];
+      Ci[452] =
+	Qr[4] * Ci[448] + Qi[4] * Cr[448]
+	- Ci[452];
+
+      Cr[454] =
+	Qr[454];
+      Ci[454] =
+	Qi[454];
+      Cr[454] =
+	Qr[450] * Cr[4] - Qi[450] * Ci[4]
+	+ Qr[390] * Cr[64] - Qi[390] * Ci[64]
+	+ Qr[326] * Cr[128] - Qi[326] * Ci[128]
+	+ Qr[198] * Cr[256] - Qi[198] * Ci[256]
+	- 4. * Cr[454];
+      Ci[454] =
+	Qr[450] * Ci[4] + Qi[450] * Cr[4]
+	+ Qr[390] * Ci[64] + Qi[390] * Cr[64]
+	+ Qr[326] * Ci[128] + Qi[326] * Cr[128]
+	+ Qr[198] * Ci[256] + Qi[198] * Cr[256]
+	- 4. * Ci[454];
+      Cr[454] =
+	Qr[386] * Cr[68] - Qi[386] * Ci[68]
+	+ Qr[322] * Cr[132] - Qi[322] * Ci[132]
+	+ Qr[262] * Cr[192] - Qi[262] * Ci[192]
+	+ Qr[194] * Cr[260] - Qi[194] * Ci[260]
+	+ Qr[134] * Cr[320] - Qi[134] * Ci[320]
+	+ Qr[70] * Cr[384] - Qi[70] * Ci[384]
+	- 3. * Cr[454];
+      Ci[454] =
+	Qr[386] * Ci[68] + Qi[386] * Cr[68]
+	+ Qr[322] * Ci[132] + Qi[322] * Cr[132]
+	+ Qr[262] * Ci[192] + Qi[262] * Cr[192]
+	+ Qr[194] * Ci[260] + Qi[194] * Cr[260]
+	+ Qr[134] * Ci[320] + Qi[134] * Cr[320]
+	+ Qr[70] * Ci[384] + Qi[70] * Cr[384]
+	- 3. * Ci[454];
+      Cr[454] =
+	Qr[258] * Cr[196] - Qi[258] * Ci[196]
+	+ Qr[130] * Cr[324] - Qi[130] * Ci[324]
+	+ Qr[66] * Cr[388] - Qi[66] * Ci[388]
+	+ Qr[6] * Cr[448] - Qi[6] * Ci[448]
+	- 2. * Cr[454];
+      Ci[454] =
+	Qr[258] * Ci[196] + Qi[258] * Cr[196]
+	+ Qr[130] * Ci[324] + Qi[130] * Cr[324]
+	+ Qr[66] * Ci[388] + Qi[66] * Cr[388]
+	+ Qr[6] * Ci[448] + Qi[6] * Cr[448]
+	- 2. * Ci[454];
+      Cr[454] =
+	Qr[2] * Cr[452] - Qi[2] * Ci[452]
+	- Cr[454];
+      Ci[454] =
+	Qr[2] * Ci[452] + Qi[2] * Cr[452]
+	- Ci[454];
+
+      Cr[456] =
+	Qr[456];
+      Ci[456] =
+	Qi[456];
+      Cr[456] =
+	Qr[392] * Cr[64] - Qi[392] * Ci[64]
+	+ Qr[328] * Cr[128] - Qi[328] * Ci[128]
+	+ Qr[200] * Cr[256] - Qi[200] * Ci[256]
+	- 3. * Cr[456];
+      Ci[456] =
+	Qr[392] * Ci[64] + Qi[392] * Cr[64]
+	+ Qr[328] * Ci[128] + Qi[328] * Cr[128]
+	+ Qr[200] * Ci[256] + Qi[200] * Cr[256]
+	- 3. * Ci[456];
+      Cr[456] =
+	Qr[264] * Cr[192] - Qi[264] * Ci[192]
+	+ Qr[136] * Cr[320] - Qi[136] * Ci[320]
+	+ Qr[72] * Cr[384] - Qi[72] * Ci[384]
+	- 2. * Cr[456];
+      Ci[456] =
+	Qr[264] * Ci[192] + Qi[264] * Cr[192]
+	+ Qr[136] * Ci[320] + Qi[136] * Cr[320]
+	+ Qr[72] * Ci[384] + Qi[72] * Cr[384]
+	- 2. * Ci[456];
+      Cr[456] =
+	Qr[8] * Cr[448] - Qi[8] * Ci[448]
+	- Cr[456];
+      Ci[456] =
+	Qr[8] * Ci[448] + Qi[8] * Cr[448]
+	- Ci[456];
+
+      Cr[458] =
+	Qr[458];
+      Ci[458] =
+	Qi[458];
+      Cr[458] =
+	Qr[450] * Cr[8] - Qi[450] * Ci[8]
+	+ Qr[394] * Cr[64] - Qi[394] * Ci[64]
+	+ Qr[330] * Cr[128] - Qi[330] * Ci[128]
+	+ Qr[202] * Cr[256] - Qi[202] * Ci[256]
+	- 4. * Cr[458];
+      Ci[458] =
+	Qr[450] * Ci[8] + Qi[450] * Cr[8]
+	+ Qr[394] * Ci[64] + Qi[394] * Cr[64]
+	+ Qr[330] * Ci[128] + Qi[330] * Cr[128]
+	+ Qr[202] * Ci[256] + Qi[202] * Cr[256]
+	- 4. * Ci[458];
+      Cr[458] =
+	Qr[386] * Cr[72] - Qi[386] * Ci[72]
+	+ Qr[322] * Cr[136] - Qi[322] * Ci[136]
+	+ Qr[266] * Cr[192] - Qi[266] * Ci[192]
+	+ Qr[194] * Cr[264] - Qi[194] * Ci[264]
+	+ Qr[138] * Cr[320] - Qi[138] * Ci[320]
+	+ Qr[74] * Cr[384] - Qi[74] * Ci[384]
+	- 3. * Cr[458];
+      Ci[458] =
+	Qr[386] * Ci[72] + Qi[386] * Cr[72]
+	+ Qr[322] * Ci[136] + Qi[322] * Cr[136]
+	+ Qr[266] * Ci[192] + Qi[266] * Cr[192]
+	+ Qr[194] * Ci[264] + Qi[194] * Cr[264]
+	+ Qr[138] * Ci[320] + Qi[138] * Cr[320]
+	+ Qr[74] * Ci[384] + Qi[74] * Cr[384]
+	- 3. * Ci[458];
+      Cr[458] =
+	Qr[258] * Cr[200] - Qi[258] * Ci[200]
+	+ Qr[130] * Cr[328] - Qi[130] * Ci[328]
+	+ Qr[66] * Cr[392] - Qi[66] * Ci[392]
+	+ Qr[10] * Cr[448] - Qi[10] * Ci[448]
+	- 2. * Cr[458];
+      Ci[458] =
+	Qr[258] * Ci[200] + Qi[258] * Cr[200]
+	+ Qr[130] * Ci[328] + Qi[130] * Cr[328]
+	+ Qr[66] * Ci[392] + Qi[66] * Cr[392]
+	+ Qr[10] * Ci[448] + Qi[10] * Cr[448]
+	- 2. * Ci[458];
+      Cr[458] =
+	Qr[2] * Cr[456] - Qi[2] * Ci[456]
+	- Cr[458];
+      Ci[458] =
+	Qr[2] * Ci[456] + Qi[2] * Cr[456]
+	- Ci[458];
+
+      Cr[460] =
+	Qr[460];
+      Ci[460] =
+	Qi[460];
+      Cr[460] =
+	Qr[452] * Cr[8] - Qi[452] * Ci[8]
+	+ Qr[396] * Cr[64] - Qi[396] * Ci[64]
+	+ Qr[332] * Cr[128] - Qi[332] * Ci[128]
+	+ Qr[204] * Cr[256] - Qi[204] * Ci[256]
+	- 4. * Cr[460];
+      Ci[460] =
+	Qr[452] * Ci[8] + Qi[452] * Cr[8]
+	+ Qr[396] * Ci[64] + Qi[396] * Cr[64]
+	+ Qr[332] * Ci[128] + Qi[332] * Cr[128]
+	+ Qr[204] * Ci[256] + Qi[204] * Cr[256]
+	- 4. * Ci[460];
+      Cr[460] =
+	Qr[388] * Cr[72] - Qi[388] * Ci[72]
+	+ Qr[324] * Cr[136] - Qi[324] * Ci[136]
+	+ Qr[268] * Cr[192] - Qi[268] * Ci[192]
+	+ Qr[196] * Cr[264] - Qi[196] * Ci[264]
+	+ Qr[140] * Cr[320] - Qi[140] * Ci[320]
+	+ Qr[76] * Cr[384] - Qi[76] * Ci[384]
+	- 3. * Cr[460];
+      Ci[460] =
+	Qr[388] * Ci[72] + Qi[388] * Cr[72]
+	+ Qr[324] * Ci[136] + Qi[324] * Cr[136]
+	+ Qr[268] * Ci[192] + Qi[268] * Cr[192]
+	+ Qr[196] * Ci[264] + Qi[196] * Cr[264]
+	+ Qr[140] * Ci[320] + Qi[140] * Cr[320]
+	+ Qr[76] * Ci[384] + Qi[76] * Cr[384]
+	- 3. * Ci[460];
+      Cr[460] =
+	Qr[260] * Cr[200] - Qi[260] * Ci[200]
+	+ Qr[132] * Cr[328] - Qi[132] * Ci[328]
+	+ Qr[68] * Cr[392] - Qi[68] * Ci[392]
+	+ Qr[12] * Cr[448] - Qi[12] * Ci[448]
+	- 2. * Cr[460];
+      Ci[460] =
+	Qr[260] * Ci[200] + Qi[260] * Cr[200]
+	+ Qr[132] * Ci[328] + Qi[132] * Cr[328]
+	+ Qr[68] * Ci[392] + Qi[68] * Cr[392]
+	+ Qr[12] * Ci[448] + Qi[12] * Cr[448]
+	- 2. * Ci[460];
+      Cr[460] =
+	Qr[4] * Cr[456] - Qi[4] * Ci[456]
+	- Cr[460];
+      Ci[460] =
+	Qr[4] * Ci[456] + Qi[4] * Cr[456]
+	- Ci[460];
+
+      Cr[462] =
+	Qr[462];
+      Ci[462] =
+	Qi[462];
+      Cr[462] =
+	Qr[458] * Cr[4] - Qi[458] * Ci[4]
+	+ Qr[454] * Cr[8] - Qi[454] * Ci[8]
+	+ Qr[398] * Cr[64] - Qi[398] * Ci[64]
+	+ Qr[334] * Cr[128] - Qi[334] * Ci[128]
+	+ Qr[206] * Cr[256] - Qi[206] * Ci[256]
+	- 5. * Cr[462];
+      Ci[462] =
+	Qr[458] * Ci[4] + Qi[458] * Cr[4]
+	+ Qr[454] * Ci[8] + Qi[454] * Cr[8]
+	+ Qr[398] * Ci[64] + Qi[398] * Cr[64]
+	+ Qr[334] * Ci[128] + Qi[334] * Cr[128]
+	+ Qr[206] * Ci[256] + Qi[206] * Cr[256]
+	- 5. * Ci[462];
+      Cr[462] =
+	Qr[450] * Cr[12] - Qi[450] * Ci[12]
+	+ Qr[394] * Cr[68] - Qi[394] * Ci[68]
+	+ Qr[390] * Cr[72] - Qi[390] * Ci[72]
+	+ Qr[330] * Cr[132] - Qi[330] * Ci[132]
+	+ Qr[326] * Cr[136] - Qi[326] * Ci[136]
+	+ Qr[270] * Cr[192] - Qi[270] * Ci[192]
+	+ Qr[202] * Cr[260] - Qi[202] * Ci[260]
+	+ Qr[198] * Cr[264] - Qi[198] * Ci[264]
+	+ Qr[142] * Cr[320] - Qi[142] * Ci[320]
+	+ Qr[78] * Cr[384] - Qi[78] * Ci[384]
+	- 4. * Cr[462];
+      Ci[462] =
+	Qr[450] * Ci[12] + Qi[450] * Cr[12]
+	+ Qr[394] * Ci[68] + Qi[394] * Cr[68]
+	+ Qr[390] * Ci[72] + Qi[390] * Cr[72]
+	+ Qr[330] * Ci[132] + Qi[330] * Cr[132]
+	+ Qr[326] * Ci[136] + Qi[326] * Cr[136]
+	+ Qr[270] * Ci[192] + Qi[270] * Cr[192]
+	+ Qr[202] * Ci[260] + Qi[202] * Cr[260]
+	+ Qr[198] * Ci[264] + Qi[198] * Cr[264]
+	+ Qr[142] * Ci[320] + Qi[142] * Cr[320]
+	+ Qr[78] * Ci[384] + Qi[78] * Cr[384]
+	- 4. * Ci[462];
+      Cr[462] =
+	Qr[386] * Cr[76] - Qi[386] * Ci[76]
+	+ Qr[322] * Cr[140] - Qi[322] * Ci[140]
+	+ Qr[266] * Cr[196] - Qi[266] * Ci[196]
+	+ Qr[262] * Cr[200] - Qi[262] * Ci[200]
+	+ Qr[194] * Cr[268] - Qi[194] * Ci[268]
+	+ Qr[138] * Cr[324] - Qi[138] * Ci[324]
+	+ Qr[134] * Cr[328] - Qi[134] * Ci[328]
+	+ Qr[74] * Cr[388] - Qi[74] * Ci[388]
+	+ Qr[70] * Cr[392] - Qi[70] * Ci[392]
+	+ Qr[14] * Cr[448] - Qi[14] * Ci[448]
+	- 3. * Cr[462];
+      Ci[462] =
+	Qr[386] * Ci[76] + Qi[386] * Cr[76]
+	+ Qr[322] * Ci[140] + Qi[322] * Cr[140]
+	+ Qr[266] * Ci[196] + Qi[266] * Cr[196]
+	+ Qr[262] * Ci[200] + Qi[262] * Cr[200]
+	+ Qr[194] * Ci[268] + Qi[194] * Cr[268]
+	+ Qr[138] * Ci[324] + Qi[138] * Cr[324]
+	+ Qr[134] * Ci[328] + Qi[134] * Cr[328]
+	+ Qr[74] * Ci[388] + Qi[74] * Cr[388]
+	+ Qr[70] * Ci[392] + Qi[70] * Cr[392]
+	+ Qr[14] * Ci[448] + Qi[14] * Cr[448]
+	- 3. * Ci[462];
+      Cr[462] =
+	Qr[258] * Cr[204] - Qi[258] * Ci[204]
+	+ Qr[130] * Cr[332] - Qi[130] * Ci[332]
+	+ Qr[66] * Cr[396] - Qi[66] * Ci[396]
+	+ Qr[10] * Cr[452] - Qi[10] * Ci[452]
+	+ Qr[6] * Cr[456] - Qi[6] * Ci[456]
+	- 2. * Cr[462];
+      Ci[462] =
+	Qr[258] * Ci[204] + Qi[258] * Cr[204]
+	+ Qr[130] * Ci[332] + Qi[130] * Cr[332]
+	+ Qr[66] * Ci[396] + Qi[66] * Cr[396]
+	+ Qr[10] * Ci[452] + Qi[10] * Cr[452]
+	+ Qr[6] * Ci[456] + Qi[6] * Cr[456]
+	- 2. * Ci[462];
+      Cr[462] =
+	Qr[2] * Cr[460] - Qi[2] * Ci[460]
+	- Cr[462];
+      Ci[462] =
+	Qr[2] * Ci[460] + Qi[2] * Cr[460]
+	- Ci[462];
+
+      Cr[464] =
+	Qr[464];
+      Ci[464] =
+	Qi[464];
+      Cr[464] =
+	Qr[400] * Cr[64] - Qi[400] * Ci[64]
+	+ Qr[336] * Cr[128] - Qi[336] * Ci[128]
+	+ Qr[208] * Cr[256] - Qi[208] * Ci[256]
+	- 3. * Cr[464];
+      Ci[464] =
+	Qr[400] * Ci[64] + Qi[400] * Cr[64]
+	+ Qr[336] * Ci[128] + Qi[336] * Cr[128]
+	+ Qr[208] * Ci[256] + Qi[208] * Cr[256]
+	- 3. * Ci[464];
+      Cr[464] =
+	Qr[272] * Cr[192] - Qi[272] * Ci[192]
+	+ Qr[144] * Cr[320] - Qi[144] * Ci[320]
+	+ Qr[80] * Cr[384] - Qi[80] * Ci[384]
+	- 2. * Cr[464];
+      Ci[464] =
+	Qr[272] * Ci[192] + Qi[272] * Cr[192]
+	+ Qr[144] * Ci[320] + Qi[144] * Cr[320]
+	+ Qr[80] * Ci[384] + Qi[80] * Cr[384]
+	- 2. * Ci[464];
+      Cr[464] =
+	Qr[16] * Cr[448] - Qi[16] * Ci[448]
+	- Cr[464];
+      Ci[464] =
+	Qr[16] * Ci[448] + Qi[16] * Cr[448]
+	- Ci[464];
+
+      Cr[466] =
+	Qr[466];
+      Ci[466] =
+	Qi[466];
+      Cr[466] =
+	Qr[450] * Cr[16] - Qi[450] * Ci[16]
+	+ Qr[402] * Cr[64] - Qi[402] * Ci[64]
+	+ Qr[338] * Cr[128] - Qi[338] * Ci[128]
+	+ Qr[210] * Cr[256] - Qi[210] * Ci[256]
+	- 4. * Cr[466];
+      Ci[466] =
+	Qr[450] * Ci[16] + Qi[450] * Cr[16]
+	+ Qr[402] * Ci[64] + Qi[402] * Cr[64]
+	+ Qr[338] * Ci[128] + Qi[338] * Cr[128]
+	+ Qr[210] * Ci[256] + Qi[210] * Cr[256]
+	- 4. * Ci[466];
+      Cr[466] =
+	Qr[386] * Cr[80] - Qi[386] * Ci[80]
+	+ Qr[322] * Cr[144] - Qi[322] * Ci[144]
+	+ Qr[274] * Cr[192] - Qi[274] * Ci[192]
+	+ Qr[194] * Cr[272] - Qi[194] * Ci[272]
+	+ Qr[146] * Cr[320] - Qi[146] * Ci[320]
+	+ Qr[82] * Cr[384] - Qi[82] * Ci[384]
+	- 3. * Cr[466];
+      Ci[466] =
+	Qr[386] * Ci[80] + Qi[386] * Cr[80]
+	+ Qr[322] * Ci[144] + Qi[322] * Cr[144]
+	+ Qr[274] * Ci[192] + Qi[274] * Cr[192]
+	+ Qr[194] * Ci[272] + Qi[194] * Cr[272]
+	+ Qr[146] * Ci[320] + Qi[146] * Cr[320]
+	+ Qr[82] * Ci[384] + Qi[82] * Cr[384]
+	- 3. * Ci[466];
+      Cr[466] =
+	Qr[258] * Cr[208] - Qi[258] * Ci[208]
+	+ Qr[130] * Cr[336] - Qi[130] * Ci[336]
+	+ Qr[66] * Cr[400] - Qi[66] * Ci[400]
+	+ Qr[18] * Cr[448] - Qi[18] * Ci[448]
+	- 2. * Cr[466];
+      Ci[466] =
+	Qr[258] * Ci[208] + Qi[258] * Cr[208]
+	+ Qr[130] * Ci[336] + Qi[130] * Cr[336]
+	+ Qr[66] * Ci[400] + Qi[66] * Cr[400]
+	+ Qr[18] * Ci[448] + Qi[18] * Cr[448]
+	- 2. * Ci[466];
+      Cr[466] =
+	Qr[2] * Cr[464] - Qi[2] * Ci[464]
+	- Cr[466];
+      Ci[466] =
+	Qr[2] * Ci[464] + Qi[2] * Cr[464]
+	- Ci[466];
+    }
+
+    /** Part 18 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part18(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[468] =
+	Qr[468];
+      Ci[468] =
+	Qi[468];
+      Cr[468] =
+	Qr[452] * Cr[16] - Qi[452] * Ci[16]
+	+ Qr[404] * Cr[64] - Qi[404] * Ci[64]
+	+ Qr[340] * Cr[128] - Qi[340] * Ci[128]
+	+ Qr[212] * Cr[256] - Qi[212] * Ci[256]
+	- 4. * Cr[468];
+      Ci[468] =
+	Qr[452] * Ci[16] + Qi[452] * Cr[16]
+	+ Qr[404] * Ci[64] + Qi[404] * Cr[64]
+	+ Qr[340] * Ci[128] + Qi[340] * Cr[128]
+	+ Qr[212] * Ci[256] + Qi[212] * Cr[256]
+	- 4. * Ci[468];
+      Cr[468] =
+	Qr[388] * Cr[80] - Qi[388] * Ci[80]
+	+ Qr[324] * Cr[144] - Qi[324] * Ci[144]
+	+ Qr[276] * Cr[192] - Qi[276] * Ci[192]
+	+ Qr[196] * Cr[272] - Qi[196] * Ci[272]
+	+ Qr[148] * Cr[320] - Qi[148] * Ci[320]
+	+ Qr[84] * Cr[384] - Qi[84] * Ci[384]
+	- 3. * Cr[468];
+      Ci[468] =
+	Qr[388] * Ci[80] + Qi[388] * Cr[80]
+	+ Qr[324] * Ci[144] + Qi[324] * Cr[144]
+	+ Qr[276] * Ci[192] + Qi[276] * Cr[192]
+	+ Qr[196] * Ci[272] + Qi[196] * Cr[272]
+	+ Qr[148] * Ci[320] + Qi[148] * Cr[320]
+	+ Qr[84] * Ci[384] + Qi[84] * Cr[384]
+	- 3. * Ci[468];
+      Cr[468] =
+	Qr[260] * Cr[208] - Qi[260] * Ci[208]
+	+ Qr[132] * Cr[336] - Qi[132] * Ci[336]
+	+ Qr[68] * Cr[400] - Qi[68] * Ci[400]
+	+ Qr[20] * Cr[448] - Qi[20] * Ci[448]
+	- 2. * Cr[468];
+      Ci[468] =
+	Qr[260] * Ci[208] + Qi[260] * Cr[208]
+	+ Qr[132] * Ci[336] + Qi[132] * Cr[336]
+	+ Qr[68] * Ci[400] + Qi[68] * Cr[400]
+	+ Qr[20] * Ci[448] + Qi[20] * Cr[448]
+	- 2. * Ci[468];
+      Cr[468] =
+	Qr[4] * Cr[464] - Qi[4] * Ci[464]
+	- Cr[468];
+      Ci[468] =
+	Qr[4] * Ci[464] + Qi[4] * Cr[464]
+	- Ci[468];
+
+      Cr[470] =
+	Qr[470];
+      Ci[470] =
+	Qi[470];
+      Cr[470] =
+	Qr[466] * Cr[4] - Qi[466] * Ci[4]
+	+ Qr[454] * Cr[16] - Qi[454] * Ci[16]
+	+ Qr[406] * Cr[64] - Qi[406] * Ci[64]
+	+ Qr[342] * Cr[128] - Qi[342] * Ci[128]
+	+ Qr[214] * Cr[256] - Qi[214] * Ci[256]
+	- 5. * Cr[470];
+      Ci[470] =
+	Qr[466] * Ci[4] + Qi[466] * Cr[4]
+	+ Qr[454] * Ci[16] + Qi[454] * Cr[16]
+	+ Qr[406] * Ci[64] + Qi[406] * Cr[64]
+	+ Qr[342] * Ci[128] + Qi[342] * Cr[128]
+	+ Qr[214] * Ci[256] + Qi[214] * Cr[256]
+	- 5. * Ci[470];
+      Cr[470] =
+	Qr[450] * Cr[20] - Qi[450] * Ci[20]
+	+ Qr[402] * Cr[68] - Qi[402] * Ci[68]
+	+ Qr[390] * Cr[80] - Qi[390] * Ci[80]
+	+ Qr[338] * Cr[132] - Qi[338] * Ci[132]
+	+ Qr[326] * Cr[144] - Qi[326] * Ci[144]
+	+ Qr[278] * Cr[192] - Qi[278] * Ci[192]
+	+ Qr[210] * Cr[260] - Qi[210] * Ci[260]
+	+ Qr[198] * Cr[272] - Qi[198] * Ci[272]
+	+ Qr[150] * Cr[320] - Qi[150] * Ci[320]
+	+ Qr[86] * Cr[384] - Qi[86] * Ci[384]
+	- 4. * Cr[470];
+      Ci[470] =
+	Qr[450] * Ci[20] + Qi[450] * Cr[20]
+	+ Qr[402] * Ci[68] + Qi[402] * Cr[68]
+	+ Qr[390] * Ci[80] + Qi[390] * Cr[80]
+	+ Qr[338] * Ci[132] + Qi[338] * Cr[132]
+	+ Qr[326] * Ci[144] + Qi[326] * Cr[144]
+	+ Qr[278] * Ci[192] + Qi[278] * Cr[192]
+	+ Qr[210] * Ci[260] + Qi[210] * Cr[260]
+	+ Qr[198] * Ci[272] + Qi[198] * Cr[272]
+	+ Qr[150] * Ci[320] + Qi[150] * Cr[320]
+	+ Qr[86] * Ci[384] + Qi[86] * Cr[384]
+	- 4. * Ci[470];
+      Cr[470] =
+	Qr[386] * Cr[84] - Qi[386] * Ci[84]
+	+ Qr[322] * Cr[148] - Qi[322] * Ci[148]
+	+ Qr[274] * Cr[196] - Qi[274] * Ci[196]
+	+ Qr[262] * Cr[208] - Qi[262] * Ci[208]
+	+ Qr[194] * Cr[276] - Qi[194] * Ci[276]
+	+ Qr[146] * Cr[324] - Qi[146] * Ci[324]
+	+ Qr[134] * Cr[336] - Qi[134] * Ci[336]
+	+ Qr[82] * Cr[388] - Qi[82] * Ci[388]
+	+ Qr[70] * Cr[400] - Qi[70] * Ci[400]
+	+ Qr[22] * Cr[448] - Qi[22] * Ci[448]
+	- 3. * Cr[470];
+      Ci[470] =
+	Qr[386] * Ci[84] + Qi[386] * Cr[84]
+	+ Qr[322] * Ci[148] + Qi[322] * Cr[148]
+	+ Qr[274] * Ci[196] + Qi[274] * Cr[196]
+	+ Qr[262] * Ci[208] + Qi[262] * Cr[208]
+	+ Qr[194] * Ci[276] + Qi[194] * Cr[276]
+	+ Qr[146] * Ci[324] + Qi[146] * Cr[324]
+	+ Qr[134] * Ci[336] + Qi[134] * Cr[336]
+	+ Qr[82] * Ci[388] + Qi[82] * Cr[388]
+	+ Qr[70] * Ci[400] + Qi[70] * Cr[400]
+	+ Qr[22] * Ci[448] + Qi[22] * Cr[448]
+	- 3. * Ci[470];
+      Cr[470] =
+	Qr[258] * Cr[212] - Qi[258] * Ci[212]
+	+ Qr[130] * Cr[340] - Qi[130] * Ci[340]
+	+ Qr[66] * Cr[404] - Qi[66] * Ci[404]
+	+ Qr[18] * Cr[452] - Qi[18] * Ci[452]
+	+ Qr[6] * Cr[464] - Qi[6] * Ci[464]
+	- 2. * Cr[470];
+      Ci[470] =
+	Qr[258] * Ci[212] + Qi[258] * Cr[212]
+	+ Qr[130] * Ci[340] + Qi[130] * Cr[340]
+	+ Qr[66] * Ci[404] + Qi[66] * Cr[404]
+	+ Qr[18] * Ci[452] + Qi[18] * Cr[452]
+	+ Qr[6] * Ci[464] + Qi[6] * Cr[464]
+	- 2. * Ci[470];
+      Cr[470] =
+	Qr[2] * Cr[468] - Qi[2] * Ci[468]
+	- Cr[470];
+      Ci[470] =
+	Qr[2] * Ci[468] + Qi[2] * Cr[468]
+	- Ci[470];
+
+      Cr[472] =
+	Qr[472];
+      Ci[472] =
+	Qi[472];
+      Cr[472] =
+	Qr[456] * Cr[16] - Qi[456] * Ci[16]
+	+ Qr[408] * Cr[64] - Qi[408] * Ci[64]
+	+ Qr[344] * Cr[128] - Qi[344] * Ci[128]
+	+ Qr[216] * Cr[256] - Qi[216] * Ci[256]
+	- 4. * Cr[472];
+      Ci[472] =
+	Qr[456] * Ci[16] + Qi[456] * Cr[16]
+	+ Qr[408] * Ci[64] + Qi[408] * Cr[64]
+	+ Qr[344] * Ci[128] + Qi[344] * Cr[128]
+	+ Qr[216] * Ci[256] + Qi[216] * Cr[256]
+	- 4. * Ci[472];
+      Cr[472] =
+	Qr[392] * Cr[80] - Qi[392] * Ci[80]
+	+ Qr[328] * Cr[144] - Qi[328] * Ci[144]
+	+ Qr[280] * Cr[192] - Qi[280] * Ci[192]
+	+ Qr[200] * Cr[272] - Qi[200] * Ci[272]
+	+ Qr[152] * Cr[320] - Qi[152] * Ci[320]
+	+ Qr[88] * Cr[384] - Qi[88] * Ci[384]
+	- 3. * Cr[472];
+      Ci[472] =
+	Qr[392] * Ci[80] + Qi[392] * Cr[80]
+	+ Qr[328] * Ci[144] + Qi[328] * Cr[144]
+	+ Qr[280] * Ci[192] + Qi[280] * Cr[192]
+	+ Qr[200] * Ci[272] + Qi[200] * Cr[272]
+	+ Qr[152] * Ci[320] + Qi[152] * Cr[320]
+	+ Qr[88] * Ci[384] + Qi[88] * Cr[384]
+	- 3. * Ci[472];
+      Cr[472] =
+	Qr[264] * Cr[208] - Qi[264] * Ci[208]
+	+ Qr[136] * Cr[336] - Qi[136] * Ci[336]
+	+ Qr[72] * Cr[400] - Qi[72] * Ci[400]
+	+ Qr[24] * Cr[448] - Qi[24] * Ci[448]
+	- 2. * Cr[472];
+      Ci[472] =
+	Qr[264] * Ci[208] + Qi[264] * Cr[208]
+	+ Qr[136] * Ci[336] + Qi[136] * Cr[336]
+	+ Qr[72] * Ci[400] + Qi[72] * Cr[400]
+	+ Qr[24] * Ci[448] + Qi[24] * Cr[448]
+	- 2. * Ci[472];
+      Cr[472] =
+	Qr[8] * Cr[464] - Qi[8] * Ci[464]
+	- Cr[472];
+      Ci[472] =
+	Qr[8] * Ci[464] + Qi[8] * Cr[464]
+	- Ci[472];
+
+      Cr[474] =
+	Qr[474];
+      Ci[474] =
+	Qi[474];
+      Cr[474] =
+	Qr[466] * Cr[8] - Qi[466] * Ci[8]
+	+ Qr[458] * Cr[16] - Qi[458] * Ci[16]
+	+ Qr[410] * Cr[64] - Qi[410] * Ci[64]
+	+ Qr[346] * Cr[128] - Qi[346] * Ci[128]
+	+ Qr[218] * Cr[256] - Qi[218] * Ci[256]
+	- 5. * Cr[474];
+      Ci[474] =
+	Qr[466] * Ci[8] + Qi[466] * Cr[8]
+	+ Qr[458] * Ci[16] + Qi[458] * Cr[16]
+	+ Qr[410] * Ci[64] + Qi[410] * Cr[64]
+	+ Qr[346] * Ci[128] + Qi[346] * Cr[128]
+	+ Qr[218] * Ci[256] + Qi[218] * Cr[256]
+	- 5. * Ci[474];
+      Cr[474] =
+	Qr[450] * Cr[24] - Qi[450] * Ci[24]
+	+ Qr[402] * Cr[72] - Qi[402] * Ci[72]
+	+ Qr[394] * Cr[80] - Qi[394] * Ci[80]
+	+ Qr[338] * Cr[136] - Qi[338] * Ci[136]
+	+ Qr[330] * Cr[144] - Qi[330] * Ci[144]
+	+ Qr[282] * Cr[192] - Qi[282] * Ci[192]
+	+ Qr[210] * Cr[264] - Qi[210] * Ci[264]
+	+ Qr[202] * Cr[272] - Qi[202] * Ci[272]
+	+ Qr[154] * Cr[320] - Qi[154] * Ci[320]
+	+ Qr[90] * Cr[384] - Qi[90] * Ci[384]
+	- 4. * Cr[474];
+      Ci[474] =
+	Qr[450] * Ci[24] + Qi[450] * Cr[24]
+	+ Qr[402] * Ci[72] + Qi[402] * Cr[72]
+	+ Qr[394] * Ci[80] + Qi[394] * Cr[80]
+	+ Qr[338] * Ci[136] + Qi[338] * Cr[136]
+	+ Qr[330] * Ci[144] + Qi[330] * Cr[144]
+	+ Qr[282] * Ci[192] + Qi[282] * Cr[192]
+	+ Qr[210] * Ci[264] + Qi[210] * Cr[264]
+	+ Qr[202] * Ci[272] + Qi[202] * Cr[272]
+	+ Qr[154] * Ci[320] + Qi[154] * Cr[320]
+	+ Qr[90] * Ci[384] + Qi[90] * Cr[384]
+	- 4. * Ci[474];
+      Cr[474] =
+	Qr[386] * Cr[88] - Qi[386] * Ci[88]
+	+ Qr[322] * Cr[152] - Qi[322] * Ci[152]
+	+ Qr[274] * Cr[200] - Qi[274] * Ci[200]
+	+ Qr[266] * Cr[208] - Qi[266] * Ci[208]
+	+ Qr[194] * Cr[280] - Qi[194] * Ci[280]
+	+ Qr[146] * Cr[328] - Qi[146] * Ci[328]
+	+ Qr[138] * Cr[336] - Qi[138] * Ci[336]
+	+ Qr[82] * Cr[392] - Qi[82] * Ci[392]
+	+ Qr[74] * Cr[400] - Qi[74] * Ci[400]
+	+ Qr[26] * Cr[448] - Qi[26] * Ci[448]
+	- 3. * Cr[474];
+      Ci[474] =
+	Qr[386] * Ci[88] + Qi[386] * Cr[88]
+	+ Qr[322] * Ci[152] + Qi[322] * Cr[152]
+	+ Qr[274] * Ci[200] + Qi[274] * Cr[200]
+	+ Qr[266] * Ci[208] + Qi[266] * Cr[208]
+	+ Qr[194] * Ci[280] + Qi[194] * Cr[280]
+	+ Qr[146] * Ci[328] + Qi[146] * Cr[328]
+	+ Qr[138] * Ci[336] + Qi[138] * Cr[336]
+	+ Qr[82] * Ci[392] + Qi[82] * Cr[392]
+	+ Qr[74] * Ci[400] + Qi[74] * Cr[400]
+	+ Qr[26] * Ci[448] + Qi[26] * Cr[448]
+	- 3. * Ci[474];
+      Cr[474] =
+	Qr[258] * Cr[216] - Qi[258] * Ci[216]
+	+ Qr[130] * Cr[344] - Qi[130] * Ci[344]
+	+ Qr[66] * Cr[408] - Qi[66] * Ci[408]
+	+ Qr[18] * Cr[456] - Qi[18] * Ci[456]
+	+ Qr[10] * Cr[464] - Qi[10] * Ci[464]
+	- 2. * Cr[474];
+      Ci[474] =
+	Qr[258] * Ci[216] + Qi[258] * Cr[216]
+	+ Qr[130] * Ci[344] + Qi[130] * Cr[344]
+	+ Qr[66] * Ci[408] + Qi[66] * Cr[408]
+	+ Qr[18] * Ci[456] + Qi[18] * Cr[456]
+	+ Qr[10] * Ci[464] + Qi[10] * Cr[464]
+	- 2. * Ci[474];
+      Cr[474] =
+	Qr[2] * Cr[472] - Qi[2] * Ci[472]
+	- Cr[474];
+      Ci[474] =
+	Qr[2] * Ci[472] + Qi[2] * Cr[472]
+	- Ci[474];
+
+      Cr[476] =
+	Qr[476];
+      Ci[476] =
+	Qi[476];
+      Cr[476] =
+	Qr[468] * Cr[8] - Qi[468] * Ci[8]
+	+ Qr[460] * Cr[16] - Qi[460] * Ci[16]
+	+ Qr[412] * Cr[64] - Qi[412] * Ci[64]
+	+ Qr[348] * Cr[128] - Qi[348] * Ci[128]
+	+ Qr[220] * Cr[256] - Qi[220] * Ci[256]
+	- 5. * Cr[476];
+      Ci[476] =
+	Qr[468] * Ci[8] + Qi[468] * Cr[8]
+	+ Qr[460] * Ci[16] + Qi[460] * Cr[16]
+	+ Qr[412] * Ci[64] + Qi[412] * Cr[64]
+	+ Qr[348] * Ci[128] + Qi[348] * Cr[128]
+	+ Qr[220] * Ci[256] + Qi[220] * Cr[256]
+	- 5. * Ci[476];
+      Cr[476] =
+	Qr[452] * Cr[24] - Qi[452] * Ci[24]
+	+ Qr[404] * Cr[72] - Qi[404] * Ci[72]
+	+ Qr[396] * Cr[80] - Qi[396] * Ci[80]
+	+ Qr[340] * Cr[136] - Qi[340] * Ci[136]
+	+ Qr[332] * Cr[144] - Qi[332] * Ci[144]
+	+ Qr[284] * Cr[192] - Qi[284] * Ci[192]
+	+ Qr[212] * Cr[264] - Qi[212] * Ci[264]
+	+ Qr[204] * Cr[272] - Qi[204] * Ci[272]
+	+ Qr[156] * Cr[320] - Qi[156] * Ci[320]
+	+ Qr[92] * Cr[384] - Qi[92] * Ci[384]
+	- 4. * Cr[476];
+      Ci[476] =
+	Qr[452] * Ci[24] + Qi[452] * Cr[24]
+	+ Qr[404] * Ci[72] + Qi[404] * Cr[72]
+	+ Qr[396] * Ci[80] + Qi[396] * Cr[80]
+	+ Qr[340] * Ci[136] + Qi[340] * Cr[136]
+	+ Qr[332] * Ci[144] + Qi[332] * Cr[144]
+	+ Qr[284] * Ci[192] + Qi[284] * Cr[192]
+	+ Qr[212] * Ci[264] + Qi[212] * Cr[264]
+	+ Qr[204] * Ci[272] + Qi[204] * Cr[272]
+	+ Qr[156] * Ci[320] + Qi[156] * Cr[320]
+	+ Qr[92] * Ci[384] + Qi[92] * Cr[384]
+	- 4. * Ci[476];
+      Cr[476] =
+	Qr[388] * Cr[88] - Qi[388] * Ci[88]
+	+ Qr[324] * Cr[152] - Qi[324] * Ci[152]
+	+ Qr[276] * Cr[200] - Qi[276] * Ci[200]
+	+ Qr[268] * Cr[208] - Qi[268] * Ci[208]
+	+ Qr[196] * Cr[280] - Qi[196] * Ci[280]
+	+ Qr[148] * Cr[328] - Qi[148] * Ci[328]
+	+ Qr[140] * Cr[336] - Qi[140] * Ci[336]
+	+ Qr[84] * Cr[392] - Qi[84] * Ci[392]
+	+ Qr[76] * Cr[400] - Qi[76] * Ci[400]
+	+ Qr[28] * Cr[448] - Qi[28] * Ci[448]
+	- 3. * Cr[476];
+      Ci[476] =
+	Qr[388] * Ci[88] + Qi[388] * Cr[88]
+	+ Qr[324] * Ci[152] + Qi[324] * Cr[152]
+	+ Qr[276] * Ci[200] + Qi[276] * Cr[200]
+	+ Qr[268] * Ci[208] + Qi[268] * Cr[208]
+	+ Qr[196] * Ci[280] + Qi[196] * Cr[280]
+	+ Qr[148] * Ci[328] + Qi[148] * Cr[328]
+	+ Qr[140] * Ci[336] + Qi[140] * Cr[336]
+	+ Qr[84] * Ci[392] + Qi[84] * Cr[392]
+	+ Qr[76] * Ci[400] + Qi[76] * Cr[400]
+	+ Qr[28] * Ci[448] + Qi[28] * Cr[448]
+	- 3. * Ci[476];
+      Cr[476] =
+	Qr[260] * Cr[216] - Qi[260] * Ci[216]
+	+ Qr[132] * Cr[344] - Qi[132] * Ci[344]
+	+ Qr[68] * Cr[408] - Qi[68] * Ci[408]
+	+ Qr[20] * Cr[456] - Qi[20] * Ci[456]
+	+ Qr[12] * Cr[464] - Qi[12] * Ci[464]
+	- 2. * Cr[476];
+      Ci[476] =
+	Qr[260] * Ci[216] + Qi[260] * Cr[216]
+	+ Qr[132] * Ci[344] + Qi[132] * Cr[344]
+	+ Qr[68] * Ci[408] + Qi[68] * Cr[408]
+	+ Qr[20] * Ci[456] + Qi[20] * Cr[456]
+	+ Qr[12] * Ci[464] + Qi[12] * Cr[464]
+	- 2. * Ci[476];
+      Cr[476] =
+	Qr[4] * Cr[472] - Qi[4] * Ci[472]
+	- Cr[476];
+      Ci[476] =
+	Qr[4] * Ci[472] + Qi[4] * Cr[472]
+	- Ci[476];
+    }
+
+    /** Part 19 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part19(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[478] =
+	Qr[478];
+      Ci[478] =
+	Qi[478];
+      Cr[478] =
+	Qr[474] * Cr[4] - Qi[474] * Ci[4]
+	+ Qr[470] * Cr[8] - Qi[470] * Ci[8]
+	+ Qr[462] * Cr[16] - Qi[462] * Ci[16]
+	+ Qr[414] * Cr[64] - Qi[414] * Ci[64]
+	+ Qr[350] * Cr[128] - Qi[350] * Ci[128]
+	+ Qr[222] * Cr[256] - Qi[222] * Ci[256]
+	- 6. * Cr[478];
+      Ci[478] =
+	Qr[474] * Ci[4] + Qi[474] * Cr[4]
+	+ Qr[470] * Ci[8] + Qi[470] * Cr[8]
+	+ Qr[462] * Ci[16] + Qi[462] * Cr[16]
+	+ Qr[414] * Ci[64] + Qi[414] * Cr[64]
+	+ Qr[350] * Ci[128] + Qi[350] * Cr[128]
+	+ Qr[222] * Ci[256] + Qi[222] * Cr[256]
+	- 6. * Ci[478];
+      Cr[478] =
+	Qr[466] * Cr[12] - Qi[466] * Ci[12]
+	+ Qr[458] * Cr[20] - Qi[458] * Ci[20]
+	+ Qr[454] * Cr[24] - Qi[454] * Ci[24]
+	+ Qr[410] * Cr[68] - Qi[410] * Ci[68]
+	+ Qr[406] * Cr[72] - Qi[406] * Ci[72]
+	+ Qr[398] * Cr[80] - Qi[398] * Ci[80]
+	+ Qr[346] * Cr[132] - Qi[346] * Ci[132]
+	+ Qr[342] * Cr[136] - Qi[342] * Ci[136]
+	+ Qr[334] * Cr[144] - Qi[334] * Ci[144]
+	+ Qr[286] * Cr[192] - Qi[286] * Ci[192]
+	+ Qr[218] * Cr[260] - Qi[218] * Ci[260]
+	+ Qr[214] * Cr[264] - Qi[214] * Ci[264]
+	+ Qr[206] * Cr[272] - Qi[206] * Ci[272]
+	+ Qr[158] * Cr[320] - Qi[158] * Ci[320]
+	+ Qr[94] * Cr[384] - Qi[94] * Ci[384]
+	- 5. * Cr[478];
+      Ci[478] =
+	Qr[466] * Ci[12] + Qi[466] * Cr[12]
+	+ Qr[458] * Ci[20] + Qi[458] * Cr[20]
+	+ Qr[454] * Ci[24] + Qi[454] * Cr[24]
+	+ Qr[410] * Ci[68] + Qi[410] * Cr[68]
+	+ Qr[406] * Ci[72] + Qi[406] * Cr[72]
+	+ Qr[398] * Ci[80] + Qi[398] * Cr[80]
+	+ Qr[346] * Ci[132] + Qi[346] * Cr[132]
+	+ Qr[342] * Ci[136] + Qi[342] * Cr[136]
+	+ Qr[334] * Ci[144] + Qi[334] * Cr[144]
+	+ Qr[286] * Ci[192] + Qi[286] * Cr[192]
+	+ Qr[218] * Ci[260] + Qi[218] * Cr[260]
+	+ Qr[214] * Ci[264] + Qi[214] * Cr[264]
+	+ Qr[206] * Ci[272] + Qi[206] * Cr[272]
+	+ Qr[158] * Ci[320] + Qi[158] * Cr[320]
+	+ Qr[94] * Ci[384] + Qi[94] * Cr[384]
+	- 5. * Ci[478];
+      Cr[478] =
+	Qr[450] * Cr[28] - Qi[450] * Ci[28]
+	+ Qr[402] * Cr[76] - Qi[402] * Ci[76]
+	+ Qr[394] * Cr[84] - Qi[394] * Ci[84]
+	+ Qr[390] * Cr[88] - Qi[390] * Ci[88]
+	+ Qr[338] * Cr[140] - Qi[338] * Ci[140]
+	+ Qr[330] * Cr[148] - Qi[330] * Ci[148]
+	+ Qr[326] * Cr[152] - Qi[326] * Ci[152]
+	+ Qr[282] * Cr[196] - Qi[282] * Ci[196]
+	+ Qr[278] * Cr[200] - Qi[278] * Ci[200]
+	+ Qr[270] * Cr[208] - Qi[270] * Ci[208]
+	+ Qr[210] * Cr[268] - Qi[210] * Ci[268]
+	+ Qr[202] * Cr[276] - Qi[202] * Ci[276]
+	+ Qr[198] * Cr[280] - Qi[198] * Ci[280]
+	+ Qr[154] * Cr[324] - Qi[154] * Ci[324]
+	+ Qr[150] * Cr[328] - Qi[150] * Ci[328]
+	+ Qr[142] * Cr[336] - Qi[142] * Ci[336]
+	+ Qr[90] * Cr[388] - Qi[90] * Ci[388]
+	+ Qr[86] * Cr[392] - Qi[86] * Ci[392]
+	+ Qr[78] * Cr[400] - Qi[78] * Ci[400]
+	+ Qr[30] * Cr[448] - Qi[30] * Ci[448]
+	- 4. * Cr[478];
+      Ci[478] =
+	Qr[450] * Ci[28] + Qi[450] * Cr[28]
+	+ Qr[402] * Ci[76] + Qi[402] * Cr[76]
+	+ Qr[394] * Ci[84] + Qi[394] * Cr[84]
+	+ Qr[390] * Ci[88] + Qi[390] * Cr[88]
+	+ Qr[338] * Ci[140] + Qi[338] * Cr[140]
+	+ Qr[330] * Ci[148] + Qi[330] * Cr[148]
+	+ Qr[326] * Ci[152] + Qi[326] * Cr[152]
+	+ Qr[282] * Ci[196] + Qi[282] * Cr[196]
+	+ Qr[278] * Ci[200] + Qi[278] * Cr[200]
+	+ Qr[270] * Ci[208] + Qi[270] * Cr[208]
+	+ Qr[210] * Ci[268] + Qi[210] * Cr[268]
+	+ Qr[202] * Ci[276] + Qi[202] * Cr[276]
+	+ Qr[198] * Ci[280] + Qi[198] * Cr[280]
+	+ Qr[154] * Ci[324] + Qi[154] * Cr[324]
+	+ Qr[150] * Ci[328] + Qi[150] * Cr[328]
+	+ Qr[142] * Ci[336] + Qi[142] * Cr[336]
+	+ Qr[90] * Ci[388] + Qi[90] * Cr[388]
+	+ Qr[86] * Ci[392] + Qi[86] * Cr[392]
+	+ Qr[78] * Ci[400] + Qi[78] * Cr[400]
+	+ Qr[30] * Ci[448] + Qi[30] * Cr[448]
+	- 4. * Ci[478];
+      Cr[478] =
+	Qr[386] * Cr[92] - Qi[386] * Ci[92]
+	+ Qr[322] * Cr[156] - Qi[322] * Ci[156]
+	+ Qr[274] * Cr[204] - Qi[274] * Ci[204]
+	+ Qr[266] * Cr[212] - Qi[266] * Ci[212]
+	+ Qr[262] * Cr[216] - Qi[262] * Ci[216]
+	+ Qr[194] * Cr[284] - Qi[194] * Ci[284]
+	+ Qr[146] * Cr[332] - Qi[146] * Ci[332]
+	+ Qr[138] * Cr[340] - Qi[138] * Ci[340]
+	+ Qr[134] * Cr[344] - Qi[134] * Ci[344]
+	+ Qr[82] * Cr[396] - Qi[82] * Ci[396]
+	+ Qr[74] * Cr[404] - Qi[74] * Ci[404]
+	+ Qr[70] * Cr[408] - Qi[70] * Ci[408]
+	+ Qr[26] * Cr[452] - Qi[26] * Ci[452]
+	+ Qr[22] * Cr[456] - Qi[22] * Ci[456]
+	+ Qr[14] * Cr[464] - Qi[14] * Ci[464]
+	- 3. * Cr[478];
+      Ci[478] =
+	Qr[386] * Ci[92] + Qi[386] * Cr[92]
+	+ Qr[322] * Ci[156] + Qi[322] * Cr[156]
+	+ Qr[274] * Ci[204] + Qi[274] * Cr[204]
+	+ Qr[266] * Ci[212] + Qi[266] * Cr[212]
+	+ Qr[262] * Ci[216] + Qi[262] * Cr[216]
+	+ Qr[194] * Ci[284] + Qi[194] * Cr[284]
+	+ Qr[146] * Ci[332] + Qi[146] * Cr[332]
+	+ Qr[138] * Ci[340] + Qi[138] * Cr[340]
+	+ Qr[134] * Ci[344] + Qi[134] * Cr[344]
+	+ Qr[82] * Ci[396] + Qi[82] * Cr[396]
+	+ Qr[74] * Ci[404] + Qi[74] * Cr[404]
+	+ Qr[70] * Ci[408] + Qi[70] * Cr[408]
+	+ Qr[26] * Ci[452] + Qi[26] * Cr[452]
+	+ Qr[22] * Ci[456] + Qi[22] * Cr[456]
+	+ Qr[14] * Ci[464] + Qi[14] * Cr[464]
+	- 3. * Ci[478];
+      Cr[478] =
+	Qr[258] * Cr[220] - Qi[258] * Ci[220]
+	+ Qr[130] * Cr[348] - Qi[130] * Ci[348]
+	+ Qr[66] * Cr[412] - Qi[66] * Ci[412]
+	+ Qr[18] * Cr[460] - Qi[18] * Ci[460]
+	+ Qr[10] * Cr[468] - Qi[10] * Ci[468]
+	+ Qr[6] * Cr[472] - Qi[6] * Ci[472]
+	- 2. * Cr[478];
+      Ci[478] =
+	Qr[258] * Ci[220] + Qi[258] * Cr[220]
+	+ Qr[130] * Ci[348] + Qi[130] * Cr[348]
+	+ Qr[66] * Ci[412] + Qi[66] * Cr[412]
+	+ Qr[18] * Ci[460] + Qi[18] * Cr[460]
+	+ Qr[10] * Ci[468] + Qi[10] * Cr[468]
+	+ Qr[6] * Ci[472] + Qi[6] * Cr[472]
+	- 2. * Ci[478];
+      Cr[478] =
+	Qr[2] * Cr[476] - Qi[2] * Ci[476]
+	- Cr[478];
+      Ci[478] =
+	Qr[2] * Ci[476] + Qi[2] * Cr[476]
+	- Ci[478];
+
+      Cr[480] =
+	Qr[480];
+      Ci[480] =
+	Qi[480];
+      Cr[480] =
+	Qr[416] * Cr[64] - Qi[416] * Ci[64]
+	+ Qr[352] * Cr[128] - Qi[352] * Ci[128]
+	+ Qr[224] * Cr[256] - Qi[224] * Ci[256]
+	- 3. * Cr[480];
+      Ci[480] =
+	Qr[416] * Ci[64] + Qi[416] * Cr[64]
+	+ Qr[352] * Ci[128] + Qi[352] * Cr[128]
+	+ Qr[224] * Ci[256] + Qi[224] * Cr[256]
+	- 3. * Ci[480];
+      Cr[480] =
+	Qr[288] * Cr[192] - Qi[288] * Ci[192]
+	+ Qr[160] * Cr[320] - Qi[160] * Ci[320]
+	+ Qr[96] * Cr[384] - Qi[96] * Ci[384]
+	- 2. * Cr[480];
+      Ci[480] =
+	Qr[288] * Ci[192] + Qi[288] * Cr[192]
+	+ Qr[160] * Ci[320] + Qi[160] * Cr[320]
+	+ Qr[96] * Ci[384] + Qi[96] * Cr[384]
+	- 2. * Ci[480];
+      Cr[480] =
+	Qr[32] * Cr[448] - Qi[32] * Ci[448]
+	- Cr[480];
+      Ci[480] =
+	Qr[32] * Ci[448] + Qi[32] * Cr[448]
+	- Ci[480];
+
+      Cr[482] =
+	Qr[482];
+      Ci[482] =
+	Qi[482];
+      Cr[482] =
+	Qr[450] * Cr[32] - Qi[450] * Ci[32]
+	+ Qr[418] * Cr[64] - Qi[418] * Ci[64]
+	+ Qr[354] * Cr[128] - Qi[354] * Ci[128]
+	+ Qr[226] * Cr[256] - Qi[226] * Ci[256]
+	- 4. * Cr[482];
+      Ci[482] =
+	Qr[450] * Ci[32] + Qi[450] * Cr[32]
+	+ Qr[418] * Ci[64] + Qi[418] * Cr[64]
+	+ Qr[354] * Ci[128] + Qi[354] * Cr[128]
+	+ Qr[226] * Ci[256] + Qi[226] * Cr[256]
+	- 4. * Ci[482];
+      Cr[482] =
+	Qr[386] * Cr[96] - Qi[386] * Ci[96]
+	+ Qr[322] * Cr[160] - Qi[322] * Ci[160]
+	+ Qr[290] * Cr[192] - Qi[290] * Ci[192]
+	+ Qr[194] * Cr[288] - Qi[194] * Ci[288]
+	+ Qr[162] * Cr[320] - Qi[162] * Ci[320]
+	+ Qr[98] * Cr[384] - Qi[98] * Ci[384]
+	- 3. * Cr[482];
+      Ci[482] =
+	Qr[386] * Ci[96] + Qi[386] * Cr[96]
+	+ Qr[322] * Ci[160] + Qi[322] * Cr[160]
+	+ Qr[290] * Ci[192] + Qi[290] * Cr[192]
+	+ Qr[194] * Ci[288] + Qi[194] * Cr[288]
+	+ Qr[162] * Ci[320] + Qi[162] * Cr[320]
+	+ Qr[98] * Ci[384] + Qi[98] * Cr[384]
+	- 3. * Ci[482];
+      Cr[482] =
+	Qr[258] * Cr[224] - Qi[258] * Ci[224]
+	+ Qr[130] * Cr[352] - Qi[130] * Ci[352]
+	+ Qr[66] * Cr[416] - Qi[66] * Ci[416]
+	+ Qr[34] * Cr[448] - Qi[34] * Ci[448]
+	- 2. * Cr[482];
+      Ci[482] =
+	Qr[258] * Ci[224] + Qi[258] * Cr[224]
+	+ Qr[130] * Ci[352] + Qi[130] * Cr[352]
+	+ Qr[66] * Ci[416] + Qi[66] * Cr[416]
+	+ Qr[34] * Ci[448] + Qi[34] * Cr[448]
+	- 2. * Ci[482];
+      Cr[482] =
+	Qr[2] * Cr[480] - Qi[2] * Ci[480]
+	- Cr[482];
+      Ci[482] =
+	Qr[2] * Ci[480] + Qi[2] * Cr[480]
+	- Ci[482];
+
+      Cr[484] =
+	Qr[484];
+      Ci[484] =
+	Qi[484];
+      Cr[484] =
+	Qr[452] * Cr[32] - Qi[452] * Ci[32]
+	+ Qr[420] * Cr[64] - Qi[420] * Ci[64]
+	+ Qr[356] * Cr[128] - Qi[356] * Ci[128]
+	+ Qr[228] * Cr[256] - Qi[228] * Ci[256]
+	- 4. * Cr[484];
+      Ci[484] =
+	Qr[452] * Ci[32] + Qi[452] * Cr[32]
+	+ Qr[420] * Ci[64] + Qi[420] * Cr[64]
+	+ Qr[356] * Ci[128] + Qi[356] * Cr[128]
+	+ Qr[228] * Ci[256] + Qi[228] * Cr[256]
+	- 4. * Ci[484];
+      Cr[484] =
+	Qr[388] * Cr[96] - Qi[388] * Ci[96]
+	+ Qr[324] * Cr[160] - Qi[324] * Ci[160]
+	+ Qr[292] * Cr[192] - Qi[292] * Ci[192]
+	+ Qr[196] * Cr[288] - Qi[196] * Ci[288]
+	+ Qr[164] * Cr[320] - Qi[164] * Ci[320]
+	+ Qr[100] * Cr[384] - Qi[100] * Ci[384]
+	- 3. * Cr[484];
+      Ci[484] =
+	Qr[388] * Ci[96] + Qi[388] * Cr[96]
+	+ Qr[324] * Ci[160] + Qi[324] * Cr[160]
+	+ Qr[292] * Ci[192] + Qi[292] * Cr[192]
+	+ Qr[196] * Ci[288] + Qi[196] * Cr[288]
+	+ Qr[164] * Ci[320] + Qi[164] * Cr[320]
+	+ Qr[100] * Ci[384] + Qi[100] * Cr[384]
+	- 3. * Ci[484];
+      Cr[484] =
+	Qr[260] * Cr[224] - Qi[260] * Ci[224]
+	+ Qr[132] * Cr[352] - Qi[132] * Ci[352]
+	+ Qr[68] * Cr[416] - Qi[68] * Ci[416]
+	+ Qr[36] * Cr[448] - Qi[36] * Ci[448]
+	- 2. * Cr[484];
+      Ci[484] =
+	Qr[260] * Ci[224] + Qi[260] * Cr[224]
+	+ Qr[132] * Ci[352] + Qi[132] * Cr[352]
+	+ Qr[68] * Ci[416] + Qi[68] * Cr[416]
+	+ Qr[36] * Ci[448] + Qi[36] * Cr[448]
+	- 2. * Ci[484];
+      Cr[484] =
+	Qr[4] * Cr[480] - Qi[4] * Ci[480]
+	- Cr[484];
+      Ci[484] =
+	Qr[4] * Ci[480] + Qi[4] * Cr[480]
+	- Ci[484];
+
+      Cr[486] =
+	Qr[486];
+      Ci[486] =
+	Qi[486];
+      Cr[486] =
+	Qr[482] * Cr[4] - Qi[482] * Ci[4]
+	+ Qr[454] * Cr[32] - Qi[454] * Ci[32]
+	+ Qr[422] * Cr[64] - Qi[422] * Ci[64]
+	+ Qr[358] * Cr[128] - Qi[358] * Ci[128]
+	+ Qr[230] * Cr[256] - Qi[230] * Ci[256]
+	- 5. * Cr[486];
+      Ci[486] =
+	Qr[482] * Ci[4] + Qi[482] * Cr[4]
+	+ Qr[454] * Ci[32] + Qi[454] * Cr[32]
+	+ Qr[422] * Ci[64] + Qi[422] * Cr[64]
+	+ Qr[358] * Ci[128] + Qi[358] * Cr[128]
+	+ Qr[230] * Ci[256] + Qi[230] * Cr[256]
+	- 5. * Ci[486];
+      Cr[486] =
+	Qr[450] * Cr[36] - Qi[450] * Ci[36]
+	+ Qr[418] * Cr[68] - Qi[418] * Ci[68]
+	+ Qr[390] * Cr[96] - Qi[390] * Ci[96]
+	+ Qr[354] * Cr[132] - Qi[354] * Ci[132]
+	+ Qr[326] * Cr[160] - Qi[326] * Ci[160]
+	+ Qr[294] * Cr[192] - Qi[294] * Ci[192]
+	+ Qr[226] * Cr[260] - Qi[226] * Ci[260]
+	+ Qr[198] * Cr[288] - Qi[198] * Ci[288]
+	+ Qr[166] * Cr[320] - Qi[166] * Ci[320]
+	+ Qr[102] * Cr[384] - Qi[102] * Ci[384]
+	- 4. * Cr[486];
+      Ci[486] =
+	Qr[450] * Ci[36] + Qi[450] * Cr[36]
+	+ Qr[418] * Ci[68] + Qi[418] * Cr[68]
+	+ Qr[390] * Ci[96] + Qi[390] * Cr[96]
+	+ Qr[354] * Ci[132] + Qi[354] * Cr[132]
+	+ Qr[326] * Ci[160] + Qi[326] * Cr[160]
+	+ Qr[294] * Ci[192] + Qi[294] * Cr[192]
+	+ Qr[226] * Ci[260] + Qi[226] * Cr[260]
+	+ Qr[198] * Ci[288] + Qi[198] * Cr[288]
+	+ Qr[166] * Ci[320] + Qi[166] * Cr[320]
+	+ Qr[102] * Ci[384] + Qi[102] * Cr[384]
+	- 4. * Ci[486];
+      Cr[486] =
+	Qr[386] * Cr[100] - Qi[386] * Ci[100]
+	+ Qr[322] * Cr[164] - Qi[322] * Ci[164]
+	+ Qr[290] * Cr[196] - Qi[290] * Ci[196]
+	+ Qr[262] * Cr[224] - Qi[262] * Ci[224]
+	+ Qr[194] * Cr[292] - Qi[194] * Ci[292]
+	+ Qr[162] * Cr[324] - Qi[162] * Ci[324]
+	+ Qr[134] * Cr[352] - Qi[134] * Ci[352]
+	+ Qr[98] * Cr[388] - Qi[98] * Ci[388]
+	+ Qr[70] * Cr[416] - Qi[70] * Ci[416]
+	+ Qr[38] * Cr[448] - Qi[38] * Ci[448]
+	- 3. * Cr[486];
+      Ci[486] =
+	Qr[386] * Ci[100] + Qi[386] * Cr[100]
+	+ Qr[322] * Ci[164] + Qi[322] * Cr[164]
+	+ Qr[290] * Ci[196] + Qi[290] * Cr[196]
+	+ Qr[262] * Ci[224] + Qi[262] * Cr[224]
+	+ Qr[194] * Ci[292] + Qi[194] * Cr[292]
+	+ Qr[162] * Ci[324] + Qi[162] * Cr[324]
+	+ Qr[134] * Ci[352] + Qi[134] * Cr[352]
+	+ Qr[98] * Ci[388] + Qi[98] * Cr[388]
+	+ Qr[70] * Ci[416] + Qi[70] * Cr[416]
+	+ Qr[38] * Ci[448] + Qi[38] * Cr[448]
+	- 3. * Ci[486];
+      Cr[486] =
+	Qr[258] * Cr[228] - Qi[258] * Ci[228]
+	+ Qr[130] * Cr[356] - Qi[130] * Ci[356]
+	+ Qr[66] * Cr[420] - Qi[66] * Ci[420]
+	+ Qr[34] * Cr[452] - Qi[34] * Ci[452]
+	+ Qr[6] * Cr[480] - Qi[6] * Ci[480]
+	- 2. * Cr[486];
+      Ci[486] =
+	Qr[258] * Ci[228] + Qi[258] * Cr[228]
+	+ Qr[130] * Ci[356] + Qi[130] * Cr[356]
+	+ Qr[66] * Ci[420] + Qi[66] * Cr[420]
+	+ Qr[34] * Ci[452] + Qi[34] * Cr[452]
+	+ Qr[6] * Ci[480] + Qi[6] * Cr[480]
+	- 2. * Ci[486];
+      Cr[486] =
+	Qr[2] * Cr[484] - Qi[2] * Ci[484]
+	- Cr[486];
+      Ci[486] =
+	Qr[2] * Ci[484] + Qi[2] * Cr[484]
+	- Ci[486];
+    }
+
+    /** Part 20 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part20(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[488] =
+	Qr[488];
+      Ci[488] =
+	Qi[488];
+      Cr[488] =
+	Qr[456] * Cr[32] - Qi[456] * Ci[32]
+	+ Qr[424] * Cr[64] - Qi[424] * Ci[64]
+	+ Qr[360] * Cr[128] - Qi[360] * Ci[128]
+	+ Qr[232] * Cr[256] - Qi[232] * Ci[256]
+	- 4. * Cr[488];
+      Ci[488] =
+	Qr[456] * Ci[32] + Qi[456] * Cr[32]
+	+ Qr[424] * Ci[64] + Qi[424] * Cr[64]
+	+ Qr[360] * Ci[128] + Qi[360] * Cr[128]
+	+ Qr[232] * Ci[256] + Qi[232] * Cr[256]
+	- 4. * Ci[488];
+      Cr[488] =
+	Qr[392] * Cr[96] - Qi[392] * Ci[96]
+	+ Qr[328] * Cr[160] - Qi[328] * Ci[160]
+	+ Qr[296] * Cr[192] - Qi[296] * Ci[192]
+	+ Qr[200] * Cr[288] - Qi[200] * Ci[288]
+	+ Qr[168] * Cr[320] - Qi[168] * Ci[320]
+	+ Qr[104] * Cr[384] - Qi[104] * Ci[384]
+	- 3. * Cr[488];
+      Ci[488] =
+	Qr[392] * Ci[96] + Qi[392] * Cr[96]
+	+ Qr[328] * Ci[160] + Qi[328] * Cr[160]
+	+ Qr[296] * Ci[192] + Qi[296] * Cr[192]
+	+ Qr[200] * Ci[288] + Qi[200] * Cr[288]
+	+ Qr[168] * Ci[320] + Qi[168] * Cr[320]
+	+ Qr[104] * Ci[384] + Qi[104] * Cr[384]
+	- 3. * Ci[488];
+      Cr[488] =
+	Qr[264] * Cr[224] - Qi[264] * Ci[224]
+	+ Qr[136] * Cr[352] - Qi[136] * Ci[352]
+	+ Qr[72] * Cr[416] - Qi[72] * Ci[416]
+	+ Qr[40] * Cr[448] - Qi[40] * Ci[448]
+	- 2. * Cr[488];
+      Ci[488] =
+	Qr[264] * Ci[224] + Qi[264] * Cr[224]
+	+ Qr[136] * Ci[352] + Qi[136] * Cr[352]
+	+ Qr[72] * Ci[416] + Qi[72] * Cr[416]
+	+ Qr[40] * Ci[448] + Qi[40] * Cr[448]
+	- 2. * Ci[488];
+      Cr[488] =
+	Qr[8] * Cr[480] - Qi[8] * Ci[480]
+	- Cr[488];
+      Ci[488] =
+	Qr[8] * Ci[480] + Qi[8] * Cr[480]
+	- Ci[488];
+
+      Cr[490] =
+	Qr[490];
+      Ci[490] =
+	Qi[490];
+      Cr[490] =
+	Qr[482] * Cr[8] - Qi[482] * Ci[8]
+	+ Qr[458] * Cr[32] - Qi[458] * Ci[32]
+	+ Qr[426] * Cr[64] - Qi[426] * Ci[64]
+	+ Qr[362] * Cr[128] - Qi[362] * Ci[128]
+	+ Qr[234] * Cr[256] - Qi[234] * Ci[256]
+	- 5. * Cr[490];
+      Ci[490] =
+	Qr[482] * Ci[8] + Qi[482] * Cr[8]
+	+ Qr[458] * Ci[32] + Qi[458] * Cr[32]
+	+ Qr[426] * Ci[64] + Qi[426] * Cr[64]
+	+ Qr[362] * Ci[128] + Qi[362] * Cr[128]
+	+ Qr[234] * Ci[256] + Qi[234] * Cr[256]
+	- 5. * Ci[490];
+      Cr[490] =
+	Qr[450] * Cr[40] - Qi[450] * Ci[40]
+	+ Qr[418] * Cr[72] - Qi[418] * Ci[72]
+	+ Qr[394] * Cr[96] - Qi[394] * Ci[96]
+	+ Qr[354] * Cr[136] - Qi[354] * Ci[136]
+	+ Qr[330] * Cr[160] - Qi[330] * Ci[160]
+	+ Qr[298] * Cr[192] - Qi[298] * Ci[192]
+	+ Qr[226] * Cr[264] - Qi[226] * Ci[264]
+	+ Qr[202] * Cr[288] - Qi[202] * Ci[288]
+	+ Qr[170] * Cr[320] - Qi[170] * Ci[320]
+	+ Qr[106] * Cr[384] - Qi[106] * Ci[384]
+	- 4. * Cr[490];
+      Ci[490] =
+	Qr[450] * Ci[40] + Qi[450] * Cr[40]
+	+ Qr[418] * Ci[72] + Qi[418] * Cr[72]
+	+ Qr[394] * Ci[96] + Qi[394] * Cr[96]
+	+ Qr[354] * Ci[136] + Qi[354] * Cr[136]
+	+ Qr[330] * Ci[160] + Qi[330] * Cr[160]
+	+ Qr[298] * Ci[192] + Qi[298] * Cr[192]
+	+ Qr[226] * Ci[264] + Qi[226] * Cr[264]
+	+ Qr[202] * Ci[288] + Qi[202] * Cr[288]
+	+ Qr[170] * Ci[320] + Qi[170] * Cr[320]
+	+ Qr[106] * Ci[384] + Qi[106] * Cr[384]
+	- 4. * Ci[490];
+      Cr[490] =
+	Qr[386] * Cr[104] - Qi[386] * Ci[104]
+	+ Qr[322] * Cr[168] - Qi[322] * Ci[168]
+	+ Qr[290] * Cr[200] - Qi[290] * Ci[200]
+	+ Qr[266] * Cr[224] - Qi[266] * Ci[224]
+	+ Qr[194] * Cr[296] - Qi[194] * Ci[296]
+	+ Qr[162] * Cr[328] - Qi[162] * Ci[328]
+	+ Qr[138] * Cr[352] - Qi[138] * Ci[352]
+	+ Qr[98] * Cr[392] - Qi[98] * Ci[392]
+	+ Qr[74] * Cr[416] - Qi[74] * Ci[416]
+	+ Qr[42] * Cr[448] - Qi[42] * Ci[448]
+	- 3. * Cr[490];
+      Ci[490] =
+	Qr[386] * Ci[104] + Qi[386] * Cr[104]
+	+ Qr[322] * Ci[168] + Qi[322] * Cr[168]
+	+ Qr[290] * Ci[200] + Qi[290] * Cr[200]
+	+ Qr[266] * Ci[224] + Qi[266] * Cr[224]
+	+ Qr[194] * Ci[296] + Qi[194] * Cr[296]
+	+ Qr[162] * Ci[328] + Qi[162] * Cr[328]
+	+ Qr[138] * Ci[352] + Qi[138] * Cr[352]
+	+ Qr[98] * Ci[392] + Qi[98] * Cr[392]
+	+ Qr[74] * Ci[416] + Qi[74] * Cr[416]
+	+ Qr[42] * Ci[448] + Qi[42] * Cr[448]
+	- 3. * Ci[490];
+      Cr[490] =
+	Qr[258] * Cr[232] - Qi[258] * Ci[232]
+	+ Qr[130] * Cr[360] - Qi[130] * Ci[360]
+	+ Qr[66] * Cr[424] - Qi[66] * Ci[424]
+	+ Qr[34] * Cr[456] - Qi[34] * Ci[456]
+	+ Qr[10] * Cr[480] - Qi[10] * Ci[480]
+	- 2. * Cr[490];
+      Ci[490] =
+	Qr[258] * Ci[232] + Qi[258] * Cr[232]
+	+ Qr[130] * Ci[360] + Qi[130] * Cr[360]
+	+ Qr[66] * Ci[424] + Qi[66] * Cr[424]
+	+ Qr[34] * Ci[456] + Qi[34] * Cr[456]
+	+ Qr[10] * Ci[480] + Qi[10] * Cr[480]
+	- 2. * Ci[490];
+      Cr[490] =
+	Qr[2] * Cr[488] - Qi[2] * Ci[488]
+	- Cr[490];
+      Ci[490] =
+	Qr[2] * Ci[488] + Qi[2] * Cr[488]
+	- Ci[490];
+
+      Cr[492] =
+	Qr[492];
+      Ci[492] =
+	Qi[492];
+      Cr[492] =
+	Qr[484] * Cr[8] - Qi[484] * Ci[8]
+	+ Qr[460] * Cr[32] - Qi[460] * Ci[32]
+	+ Qr[428] * Cr[64] - Qi[428] * Ci[64]
+	+ Qr[364] * Cr[128] - Qi[364] * Ci[128]
+	+ Qr[236] * Cr[256] - Qi[236] * Ci[256]
+	- 5. * Cr[492];
+      Ci[492] =
+	Qr[484] * Ci[8] + Qi[484] * Cr[8]
+	+ Qr[460] * Ci[32] + Qi[460] * Cr[32]
+	+ Qr[428] * Ci[64] + Qi[428] * Cr[64]
+	+ Qr[364] * Ci[128] + Qi[364] * Cr[128]
+	+ Qr[236] * Ci[256] + Qi[236] * Cr[256]
+	- 5. * Ci[492];
+      Cr[492] =
+	Qr[452] * Cr[40] - Qi[452] * Ci[40]
+	+ Qr[420] * Cr[72] - Qi[420] * Ci[72]
+	+ Qr[396] * Cr[96] - Qi[396] * Ci[96]
+	+ Qr[356] * Cr[136] - Qi[356] * Ci[136]
+	+ Qr[332] * Cr[160] - Qi[332] * Ci[160]
+	+ Qr[300] * Cr[192] - Qi[300] * Ci[192]
+	+ Qr[228] * Cr[264] - Qi[228] * Ci[264]
+	+ Qr[204] * Cr[288] - Qi[204] * Ci[288]
+	+ Qr[172] * Cr[320] - Qi[172] * Ci[320]
+	+ Qr[108] * Cr[384] - Qi[108] * Ci[384]
+	- 4. * Cr[492];
+      Ci[492] =
+	Qr[452] * Ci[40] + Qi[452] * Cr[40]
+	+ Qr[420] * Ci[72] + Qi[420] * Cr[72]
+	+ Qr[396] * Ci[96] + Qi[396] * Cr[96]
+	+ Qr[356] * Ci[136] + Qi[356] * Cr[136]
+	+ Qr[332] * Ci[160] + Qi[332] * Cr[160]
+	+ Qr[300] * Ci[192] + Qi[300] * Cr[192]
+	+ Qr[228] * Ci[264] + Qi[228] * Cr[264]
+	+ Qr[204] * Ci[288] + Qi[204] * Cr[288]
+	+ Qr[172] * Ci[320] + Qi[172] * Cr[320]
+	+ Qr[108] * Ci[384] + Qi[108] * Cr[384]
+	- 4. * Ci[492];
+      Cr[492] =
+	Qr[388] * Cr[104] - Qi[388] * Ci[104]
+	+ Qr[324] * Cr[168] - Qi[324] * Ci[168]
+	+ Qr[292] * Cr[200] - Qi[292] * Ci[200]
+	+ Qr[268] * Cr[224] - Qi[268] * Ci[224]
+	+ Qr[196] * Cr[296] - Qi[196] * Ci[296]
+	+ Qr[164] * Cr[328] - Qi[164] * Ci[328]
+	+ Qr[140] * Cr[352] - Qi[140] * Ci[352]
+	+ Qr[100] * Cr[392] - Qi[100] * Ci[392]
+	+ Qr[76] * Cr[416] - Qi[76] * Ci[416]
+	+ Qr[44] * Cr[448] - Qi[44] * Ci[448]
+	- 3. * Cr[492];
+      Ci[492] =
+	Qr[388] * Ci[104] + Qi[388] * Cr[104]
+	+ Qr[324] * Ci[168] + Qi[324] * Cr[168]
+	+ Qr[292] * Ci[200] + Qi[292] * Cr[200]
+	+ Qr[268] * Ci[224] + Qi[268] * Cr[224]
+	+ Qr[196] * Ci[296] + Qi[196] * Cr[296]
+	+ Qr[164] * Ci[328] + Qi[164] * Cr[328]
+	+ Qr[140] * Ci[352] + Qi[140] * Cr[352]
+	+ Qr[100] * Ci[392] + Qi[100] * Cr[392]
+	+ Qr[76] * Ci[416] + Qi[76] * Cr[416]
+	+ Qr[44] * Ci[448] + Qi[44] * Cr[448]
+	- 3. * Ci[492];
+      Cr[492] =
+	Qr[260] * Cr[232] - Qi[260] * Ci[232]
+	+ Qr[132] * Cr[360] - Qi[132] * Ci[360]
+	+ Qr[68] * Cr[424] - Qi[68] * Ci[424]
+	+ Qr[36] * Cr[456] - Qi[36] * Ci[456]
+	+ Qr[12] * Cr[480] - Qi[12] * Ci[480]
+	- 2. * Cr[492];
+      Ci[492] =
+	Qr[260] * Ci[232] + Qi[260] * Cr[232]
+	+ Qr[132] * Ci[360] + Qi[132] * Cr[360]
+	+ Qr[68] * Ci[424] + Qi[68] * Cr[424]
+	+ Qr[36] * Ci[456] + Qi[36] * Cr[456]
+	+ Qr[12] * Ci[480] + Qi[12] * Cr[480]
+	- 2. * Ci[492];
+      Cr[492] =
+	Qr[4] * Cr[488] - Qi[4] * Ci[488]
+	- Cr[492];
+      Ci[492] =
+	Qr[4] * Ci[488] + Qi[4] * Cr[488]
+	- Ci[492];
+
+      Cr[494] =
+	Qr[494];
+      Ci[494] =
+	Qi[494];
+      Cr[494] =
+	Qr[490] * Cr[4] - Qi[490] * Ci[4]
+	+ Qr[486] * Cr[8] - Qi[486] * Ci[8]
+	+ Qr[462] * Cr[32] - Qi[462] * Ci[32]
+	+ Qr[430] * Cr[64] - Qi[430] * Ci[64]
+	+ Qr[366] * Cr[128] - Qi[366] * Ci[128]
+	+ Qr[238] * Cr[256] - Qi[238] * Ci[256]
+	- 6. * Cr[494];
+      Ci[494] =
+	Qr[490] * Ci[4] + Qi[490] * Cr[4]
+	+ Qr[486] * Ci[8] + Qi[486] * Cr[8]
+	+ Qr[462] * Ci[32] + Qi[462] * Cr[32]
+	+ Qr[430] * Ci[64] + Qi[430] * Cr[64]
+	+ Qr[366] * Ci[128] + Qi[366] * Cr[128]
+	+ Qr[238] * Ci[256] + Qi[238] * Cr[256]
+	- 6. * Ci[494];
+      Cr[494] =
+	Qr[482] * Cr[12] - Qi[482] * Ci[12]
+	+ Qr[458] * Cr[36] - Qi[458] * Ci[36]
+	+ Qr[454] * Cr[40] - Qi[454] * Ci[40]
+	+ Qr[426] * Cr[68] - Qi[426] * Ci[68]
+	+ Qr[422] * Cr[72] - Qi[422] * Ci[72]
+	+ Qr[398] * Cr[96] - Qi[398] * Ci[96]
+	+ Qr[362] * Cr[132] - Qi[362] * Ci[132]
+	+ Qr[358] * Cr[136] - Qi[358] * Ci[136]
+	+ Qr[334] * Cr[160] - Qi[334] * Ci[160]
+	+ Qr[302] * Cr[192] - Qi[302] * Ci[192]
+	+ Qr[234] * Cr[260] - Qi[234] * Ci[260]
+	+ Qr[230] * Cr[264] - Qi[230] * Ci[264]
+	+ Qr[206] * Cr[288] - Qi[206] * Ci[288]
+	+ Qr[174] * Cr[320] - Qi[174] * Ci[320]
+	+ Qr[110] * Cr[384] - Qi[110] * Ci[384]
+	- 5. * Cr[494];
+      Ci[494] =
+	Qr[482] * Ci[12] + Qi[482] * Cr[12]
+	+ Qr[458] * Ci[36] + Qi[458] * Cr[36]
+	+ Qr[454] * Ci[40] + Qi[454] * Cr[40]
+	+ Qr[426] * Ci[68] + Qi[426] * Cr[68]
+	+ Qr[422] * Ci[72] + Qi[422] * Cr[72]
+	+ Qr[398] * Ci[96] + Qi[398] * Cr[96]
+	+ Qr[362] * Ci[132] + Qi[362] * Cr[132]
+	+ Qr[358] * Ci[136] + Qi[358] * Cr[136]
+	+ Qr[334] * Ci[160] + Qi[334] * Cr[160]
+	+ Qr[302] * Ci[192] + Qi[302] * Cr[192]
+	+ Qr[234] * Ci[260] + Qi[234] * Cr[260]
+	+ Qr[230] * Ci[264] + Qi[230] * Cr[264]
+	+ Qr[206] * Ci[288] + Qi[206] * Cr[288]
+	+ Qr[174] * Ci[320] + Qi[174] * Cr[320]
+	+ Qr[110] * Ci[384] + Qi[110] * Cr[384]
+	- 5. * Ci[494];
+      Cr[494] =
+	Qr[450] * Cr[44] - Qi[450] * Ci[44]
+	+ Qr[418] * Cr[76] - Qi[418] * Ci[76]
+	+ Qr[394] * Cr[100] - Qi[394] * Ci[100]
+	+ Qr[390] * Cr[104] - Qi[390] * Ci[104]
+	+ Qr[354] * Cr[140] - Qi[354] * Ci[140]
+	+ Qr[330] * Cr[164] - Qi[330] * Ci[164]
+	+ Qr[326] * Cr[168] - Qi[326] * Ci[168]
+	+ Qr[298] * Cr[196] - Qi[298] * Ci[196]
+	+ Qr[294] * Cr[200] - Qi[294] * Ci[200]
+	+ Qr[270] * Cr[224] - Qi[270] * Ci[224]
+	+ Qr[226] * Cr[268] - Qi[226] * Ci[268]
+	+ Qr[202] * Cr[292] - Qi[202] * Ci[292]
+	+ Qr[198] * Cr[296] - Qi[198] * Ci[296]
+	+ Qr[170] * Cr[324] - Qi[170] * Ci[324]
+	+ Qr[166] * Cr[328] - Qi[166] * Ci[328]
+	+ Qr[142] * Cr[352] - Qi[142] * Ci[352]
+	+ Qr[106] * Cr[388] - Qi[106] * Ci[388]
+	+ Qr[102] * Cr[392] - Qi[102] * Ci[392]
+	+ Qr[78] * Cr[416] - Qi[78] * Ci[416]
+	+ Qr[46] * Cr[448] - Qi[46] * Ci[448]
+	- 4. * Cr[494];
+      Ci[494] =
+	Qr[450] * Ci[44] + Qi[450] * Cr[44]
+	+ Qr[418] * Ci[76] + Qi[418] * Cr[76]
+	+ Qr[394] * Ci[100] + Qi[394] * Cr[100]
+	+ Qr[390] * Ci[104] + Qi[390] * Cr[104]
+	+ Qr[354] * Ci[140] + Qi[354] * Cr[140]
+	+ Qr[330] * Ci[164] + Qi[330] * Cr[164]
+	+ Qr[326] * Ci[168] + Qi[326] * Cr[168]
+	+ Qr[298] * Ci[196] + Qi[298] * Cr[196]
+	+ Qr[294] * Ci[200] + Qi[294] * Cr[200]
+	+ Qr[270] * Ci[224] + Qi[270] * Cr[224]
+	+ Qr[226] * Ci[268] + Qi[226] * Cr[268]
+	+ Qr[202] * Ci[292] + Qi[202] * Cr[292]
+	+ Qr[198] * Ci[296] + Qi[198] * Cr[296]
+	+ Qr[170] * Ci[324] + Qi[170] * Cr[324]
+	+ Qr[166] * Ci[328] + Qi[166] * Cr[328]
+	+ Qr[142] * Ci[352] + Qi[142] * Cr[352]
+	+ Qr[106] * Ci[388] + Qi[106] * Cr[388]
+	+ Qr[102] * Ci[392] + Qi[102] * Cr[392]
+	+ Qr[78] * Ci[416] + Qi[78] * Cr[416]
+	+ Qr[46] * Ci[448] + Qi[46] * Cr[448]
+	- 4. * Ci[494];
+      Cr[494] =
+	Qr[386] * Cr[108] - Qi[386] * Ci[108]
+	+ Qr[322] * Cr[172] - Qi[322] * Ci[172]
+	+ Qr[290] * Cr[204] - Qi[290] * Ci[204]
+	+ Qr[266] * Cr[228] - Qi[266] * Ci[228]
+	+ Qr[262] * Cr[232] - Qi[262] * Ci[232]
+	+ Qr[194] * Cr[300] - Qi[194] * Ci[300]
+	+ Qr[162] * Cr[332] - Qi[162] * Ci[332]
+	+ Qr[138] * Cr[356] - Qi[138] * Ci[356]
+	+ Qr[134] * Cr[360] - Qi[134] * Ci[360]
+	+ Qr[98] * Cr[396] - Qi[98] * Ci[396]
+	+ Qr[74] * Cr[420] - Qi[74] * Ci[420]
+	+ Qr[70] * Cr[424] - Qi[70] * Ci[424]
+	+ Qr[42] * Cr[452] - Qi[42] * Ci[452]
+	+ Qr[38] * Cr[456] - Qi[38] * Ci[456]
+	+ Qr[14] * Cr[480] - Qi[14] * Ci[480]
+	- 3. * Cr[494];
+      Ci[494] =
+	Qr[386] * Ci[108] + Qi[386] * Cr[108]
+	+ Qr[322] * Ci[172] + Qi[322] * Cr[172]
+	+ Qr[290] * Ci[204] + Qi[290] * Cr[204]
+	+ Qr[266] * Ci[228] + Qi[266] * Cr[228]
+	+ Qr[262] * Ci[232] + Qi[262] * Cr[232]
+	+ Qr[194] * Ci[300] + Qi[194] * Cr[300]
+	+ Qr[162] * Ci[332] + Qi[162] * Cr[332]
+	+ Qr[138] * Ci[356] + Qi[138] * Cr[356]
+	+ Qr[134] * Ci[360] + Qi[134] * Cr[360]
+	+ Qr[98] * Ci[396] + Qi[98] * Cr[396]
+	+ Qr[74] * Ci[420] + Qi[74] * Cr[420]
+	+ Qr[70] * Ci[424] + Qi[70] * Cr[424]
+	+ Qr[42] * Ci[452] + Qi[42] * Cr[452]
+	+ Qr[38] * Ci[456] + Qi[38] * Cr[456]
+	+ Qr[14] * Ci[480] + Qi[14] * Cr[480]
+	- 3. * Ci[494];
+      Cr[494] =
+	Qr[258] * Cr[236] - Qi[258] * Ci[236]
+	+ Qr[130] * Cr[364] - Qi[130] * Ci[364]
+	+ Qr[66] * Cr[428] - Qi[66] * Ci[428]
+	+ Qr[34] * Cr[460] - Qi[34] * Ci[460]
+	+ Qr[10] * Cr[484] - Qi[10] * Ci[484]
+	+ Qr[6] * Cr[488] - Qi[6] * Ci[488]
+	- 2. * Cr[494];
+      Ci[494] =
+	Qr[258] * Ci[236] + Qi[258] * Cr[236]
+	+ Qr[130] * Ci[364] + Qi[130] * Cr[364]
+	+ Qr[66] * Ci[428] + Qi[66] * Cr[428]
+	+ Qr[34] * Ci[460] + Qi[34] * Cr[460]
+	+ Qr[10] * Ci[484] + Qi[10] * Cr[484]
+	+ Qr[6] * Ci[488] + Qi[6] * Cr[488]
+	- 2. * Ci[494];
+      Cr[494] =
+	Qr[2] * Cr[492] - Qi[2] * Ci[492]
+	- Cr[494];
+      Ci[494] =
+	Qr[2] * Ci[492] + Qi[2] * Cr[492]
+	- Ci[494];
+    }
+
+    /** Part 21 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part21(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[496] =
+	Qr[496];
+      Ci[496] =
+	Qi[496];
+      Cr[496] =
+	Qr[464] * Cr[32] - Qi[464] * Ci[32]
+	+ Qr[432] * Cr[64] - Qi[432] * Ci[64]
+	+ Qr[368] * Cr[128] - Qi[368] * Ci[128]
+	+ Qr[240] * Cr[256] - Qi[240] * Ci[256]
+	- 4. * Cr[496];
+      Ci[496] =
+	Qr[464] * Ci[32] + Qi[464] * Cr[32]
+	+ Qr[432] * Ci[64] + Qi[432] * Cr[64]
+	+ Qr[368] * Ci[128] + Qi[368] * Cr[128]
+	+ Qr[240] * Ci[256] + Qi[240] * Cr[256]
+	- 4. * Ci[496];
+      Cr[496] =
+	Qr[400] * Cr[96] - Qi[400] * Ci[96]
+	+ Qr[336] * Cr[160] - Qi[336] * Ci[160]
+	+ Qr[304] * Cr[192] - Qi[304] * Ci[192]
+	+ Qr[208] * Cr[288] - Qi[208] * Ci[288]
+	+ Qr[176] * Cr[320] - Qi[176] * Ci[320]
+	+ Qr[112] * Cr[384] - Qi[112] * Ci[384]
+	- 3. * Cr[496];
+      Ci[496] =
+	Qr[400] * Ci[96] + Qi[400] * Cr[96]
+	+ Qr[336] * Ci[160] + Qi[336] * Cr[160]
+	+ Qr[304] * Ci[192] + Qi[304] * Cr[192]
+	+ Qr[208] * Ci[288] + Qi[208] * Cr[288]
+	+ Qr[176] * Ci[320] + Qi[176] * Cr[320]
+	+ Qr[112] * Ci[384] + Qi[112] * Cr[384]
+	- 3. * Ci[496];
+      Cr[496] =
+	Qr[272] * Cr[224] - Qi[272] * Ci[224]
+	+ Qr[144] * Cr[352] - Qi[144] * Ci[352]
+	+ Qr[80] * Cr[416] - Qi[80] * Ci[416]
+	+ Qr[48] * Cr[448] - Qi[48] * Ci[448]
+	- 2. * Cr[496];
+      Ci[496] =
+	Qr[272] * Ci[224] + Qi[272] * Cr[224]
+	+ Qr[144] * Ci[352] + Qi[144] * Cr[352]
+	+ Qr[80] * Ci[416] + Qi[80] * Cr[416]
+	+ Qr[48] * Ci[448] + Qi[48] * Cr[448]
+	- 2. * Ci[496];
+      Cr[496] =
+	Qr[16] * Cr[480] - Qi[16] * Ci[480]
+	- Cr[496];
+      Ci[496] =
+	Qr[16] * Ci[480] + Qi[16] * Cr[480]
+	- Ci[496];
+
+      Cr[498] =
+	Qr[498];
+      Ci[498] =
+	Qi[498];
+      Cr[498] =
+	Qr[482] * Cr[16] - Qi[482] * Ci[16]
+	+ Qr[466] * Cr[32] - Qi[466] * Ci[32]
+	+ Qr[434] * Cr[64] - Qi[434] * Ci[64]
+	+ Qr[370] * Cr[128] - Qi[370] * Ci[128]
+	+ Qr[242] * Cr[256] - Qi[242] * Ci[256]
+	- 5. * Cr[498];
+      Ci[498] =
+	Qr[482] * Ci[16] + Qi[482] * Cr[16]
+	+ Qr[466] * Ci[32] + Qi[466] * Cr[32]
+	+ Qr[434] * Ci[64] + Qi[434] * Cr[64]
+	+ Qr[370] * Ci[128] + Qi[370] * Cr[128]
+	+ Qr[242] * Ci[256] + Qi[242] * Cr[256]
+	- 5. * Ci[498];
+      Cr[498] =
+	Qr[450] * Cr[48] - Qi[450] * Ci[48]
+	+ Qr[418] * Cr[80] - Qi[418] * Ci[80]
+	+ Qr[402] * Cr[96] - Qi[402] * Ci[96]
+	+ Qr[354] * Cr[144] - Qi[354] * Ci[144]
+	+ Qr[338] * Cr[160] - Qi[338] * Ci[160]
+	+ Qr[306] * Cr[192] - Qi[306] * Ci[192]
+	+ Qr[226] * Cr[272] - Qi[226] * Ci[272]
+	+ Qr[210] * Cr[288] - Qi[210] * Ci[288]
+	+ Qr[178] * Cr[320] - Qi[178] * Ci[320]
+	+ Qr[114] * Cr[384] - Qi[114] * Ci[384]
+	- 4. * Cr[498];
+      Ci[498] =
+	Qr[450] * Ci[48] + Qi[450] * Cr[48]
+	+ Qr[418] * Ci[80] + Qi[418] * Cr[80]
+	+ Qr[402] * Ci[96] + Qi[402] * Cr[96]
+	+ Qr[354] * Ci[144] + Qi[354] * Cr[144]
+	+ Qr[338] * Ci[160] + Qi[338] * Cr[160]
+	+ Qr[306] * Ci[192] + Qi[306] * Cr[192]
+	+ Qr[226] * Ci[272] + Qi[226] * Cr[272]
+	+ Qr[210] * Ci[288] + Qi[210] * Cr[288]
+	+ Qr[178] * Ci[320] + Qi[178] * Cr[320]
+	+ Qr[114] * Ci[384] + Qi[114] * Cr[384]
+	- 4. * Ci[498];
+      Cr[498] =
+	Qr[386] * Cr[112] - Qi[386] * Ci[112]
+	+ Qr[322] * Cr[176] - Qi[322] * Ci[176]
+	+ Qr[290] * Cr[208] - Qi[290] * Ci[208]
+	+ Qr[274] * Cr[224] - Qi[274] * Ci[224]
+	+ Qr[194] * Cr[304] - Qi[194] * Ci[304]
+	+ Qr[162] * Cr[336] - Qi[162] * Ci[336]
+	+ Qr[146] * Cr[352] - Qi[146] * Ci[352]
+	+ Qr[98] * Cr[400] - Qi[98] * Ci[400]
+	+ Qr[82] * Cr[416] - Qi[82] * Ci[416]
+	+ Qr[50] * Cr[448] - Qi[50] * Ci[448]
+	- 3. * Cr[498];
+      Ci[498] =
+	Qr[386] * Ci[112] + Qi[386] * Cr[112]
+	+ Qr[322] * Ci[176] + Qi[322] * Cr[176]
+	+ Qr[290] * Ci[208] + Qi[290] * Cr[208]
+	+ Qr[274] * Ci[224] + Qi[274] * Cr[224]
+	+ Qr[194] * Ci[304] + Qi[194] * Cr[304]
+	+ Qr[162] * Ci[336] + Qi[162] * Cr[336]
+	+ Qr[146] * Ci[352] + Qi[146] * Cr[352]
+	+ Qr[98] * Ci[400] + Qi[98] * Cr[400]
+	+ Qr[82] * Ci[416] + Qi[82] * Cr[416]
+	+ Qr[50] * Ci[448] + Qi[50] * Cr[448]
+	- 3. * Ci[498];
+      Cr[498] =
+	Qr[258] * Cr[240] - Qi[258] * Ci[240]
+	+ Qr[130] * Cr[368] - Qi[130] * Ci[368]
+	+ Qr[66] * Cr[432] - Qi[66] * Ci[432]
+	+ Qr[34] * Cr[464] - Qi[34] * Ci[464]
+	+ Qr[18] * Cr[480] - Qi[18] * Ci[480]
+	- 2. * Cr[498];
+      Ci[498] =
+	Qr[258] * Ci[240] + Qi[258] * Cr[240]
+	+ Qr[130] * Ci[368] + Qi[130] * Cr[368]
+	+ Qr[66] * Ci[432] + Qi[66] * Cr[432]
+	+ Qr[34] * Ci[464] + Qi[34] * Cr[464]
+	+ Qr[18] * Ci[480] + Qi[18] * Cr[480]
+	- 2. * Ci[498];
+      Cr[498] =
+	Qr[2] * Cr[496] - Qi[2] * Ci[496]
+	- Cr[498];
+      Ci[498] =
+	Qr[2] * Ci[496] + Qi[2] * Cr[496]
+	- Ci[498];
+
+      Cr[500] =
+	Qr[500];
+      Ci[500] =
+	Qi[500];
+      Cr[500] =
+	Qr[484] * Cr[16] - Qi[484] * Ci[16]
+	+ Qr[468] * Cr[32] - Qi[468] * Ci[32]
+	+ Qr[436] * Cr[64] - Qi[436] * Ci[64]
+	+ Qr[372] * Cr[128] - Qi[372] * Ci[128]
+	+ Qr[244] * Cr[256] - Qi[244] * Ci[256]
+	- 5. * Cr[500];
+      Ci[500] =
+	Qr[484] * Ci[16] + Qi[484] * Cr[16]
+	+ Qr[468] * Ci[32] + Qi[468] * Cr[32]
+	+ Qr[436] * Ci[64] + Qi[436] * Cr[64]
+	+ Qr[372] * Ci[128] + Qi[372] * Cr[128]
+	+ Qr[244] * Ci[256] + Qi[244] * Cr[256]
+	- 5. * Ci[500];
+      Cr[500] =
+	Qr[452] * Cr[48] - Qi[452] * Ci[48]
+	+ Qr[420] * Cr[80] - Qi[420] * Ci[80]
+	+ Qr[404] * Cr[96] - Qi[404] * Ci[96]
+	+ Qr[356] * Cr[144] - Qi[356] * Ci[144]
+	+ Qr[340] * Cr[160] - Qi[340] * Ci[160]
+	+ Qr[308] * Cr[192] - Qi[308] * Ci[192]
+	+ Qr[228] * Cr[272] - Qi[228] * Ci[272]
+	+ Qr[212] * Cr[288] - Qi[212] * Ci[288]
+	+ Qr[180] * Cr[320] - Qi[180] * Ci[320]
+	+ Qr[116] * Cr[384] - Qi[116] * Ci[384]
+	- 4. * Cr[500];
+      Ci[500] =
+	Qr[452] * Ci[48] + Qi[452] * Cr[48]
+	+ Qr[420] * Ci[80] + Qi[420] * Cr[80]
+	+ Qr[404] * Ci[96] + Qi[404] * Cr[96]
+	+ Qr[356] * Ci[144] + Qi[356] * Cr[144]
+	+ Qr[340] * Ci[160] + Qi[340] * Cr[160]
+	+ Qr[308] * Ci[192] + Qi[308] * Cr[192]
+	+ Qr[228] * Ci[272] + Qi[228] * Cr[272]
+	+ Qr[212] * Ci[288] + Qi[212] * Cr[288]
+	+ Qr[180] * Ci[320] + Qi[180] * Cr[320]
+	+ Qr[116] * Ci[384] + Qi[116] * Cr[384]
+	- 4. * Ci[500];
+      Cr[500] =
+	Qr[388] * Cr[112] - Qi[388] * Ci[112]
+	+ Qr[324] * Cr[176] - Qi[324] * Ci[176]
+	+ Qr[292] * Cr[208] - Qi[292] * Ci[208]
+	+ Qr[276] * Cr[224] - Qi[276] * Ci[224]
+	+ Qr[196] * Cr[304] - Qi[196] * Ci[304]
+	+ Qr[164] * Cr[336] - Qi[164] * Ci[336]
+	+ Qr[148] * Cr[352] - Qi[148] * Ci[352]
+	+ Qr[100] * Cr[400] - Qi[100] * Ci[400]
+	+ Qr[84] * Cr[416] - Qi[84] * Ci[416]
+	+ Qr[52] * Cr[448] - Qi[52] * Ci[448]
+	- 3. * Cr[500];
+      Ci[500] =
+	Qr[388] * Ci[112] + Qi[388] * Cr[112]
+	+ Qr[324] * Ci[176] + Qi[324] * Cr[176]
+	+ Qr[292] * Ci[208] + Qi[292] * Cr[208]
+	+ Qr[276] * Ci[224] + Qi[276] * Cr[224]
+	+ Qr[196] * Ci[304] + Qi[196] * Cr[304]
+	+ Qr[164] * Ci[336] + Qi[164] * Cr[336]
+	+ Qr[148] * Ci[352] + Qi[148] * Cr[352]
+	+ Qr[100] * Ci[400] + Qi[100] * Cr[400]
+	+ Qr[84] * Ci[416] + Qi[84] * Cr[416]
+	+ Qr[52] * Ci[448] + Qi[52] * Cr[448]
+	- 3. * Ci[500];
+      Cr[500] =
+	Qr[260] * Cr[240] - Qi[260] * Ci[240]
+	+ Qr[132] * Cr[368] - Qi[132] * Ci[368]
+	+ Qr[68] * Cr[432] - Qi[68] * Ci[432]
+	+ Qr[36] * Cr[464] - Qi[36] * Ci[464]
+	+ Qr[20] * Cr[480] - Qi[20] * Ci[480]
+	- 2. * Cr[500];
+      Ci[500] =
+	Qr[260] * Ci[240] + Qi[260] * Cr[240]
+	+ Qr[132] * Ci[368] + Qi[132] * Cr[368]
+	+ Qr[68] * Ci[432] + Qi[68] * Cr[432]
+	+ Qr[36] * Ci[464] + Qi[36] * Cr[464]
+	+ Qr[20] * Ci[480] + Qi[20] * Cr[480]
+	- 2. * Ci[500];
+      Cr[500] =
+	Qr[4] * Cr[496] - Qi[4] * Ci[496]
+	- Cr[500];
+      Ci[500] =
+	Qr[4] * Ci[496] + Qi[4] * Cr[496]
+	- Ci[500];
+
+      Cr[502] =
+	Qr[502];
+      Ci[502] =
+	Qi[502];
+      Cr[502] =
+	Qr[498] * Cr[4] - Qi[498] * Ci[4]
+	+ Qr[486] * Cr[16] - Qi[486] * Ci[16]
+	+ Qr[470] * Cr[32] - Qi[470] * Ci[32]
+	+ Qr[438] * Cr[64] - Qi[438] * Ci[64]
+	+ Qr[374] * Cr[128] - Qi[374] * Ci[128]
+	+ Qr[246] * Cr[256] - Qi[246] * Ci[256]
+	- 6. * Cr[502];
+      Ci[502] =
+	Qr[498] * Ci[4] + Qi[498] * Cr[4]
+	+ Qr[486] * Ci[16] + Qi[486] * Cr[16]
+	+ Qr[470] * Ci[32] + Qi[470] * Cr[32]
+	+ Qr[438] * Ci[64] + Qi[438] * Cr[64]
+	+ Qr[374] * Ci[128] + Qi[374] * Cr[128]
+	+ Qr[246] * Ci[256] + Qi[246] * Cr[256]
+	- 6. * Ci[502];
+      Cr[502] =
+	Qr[482] * Cr[20] - Qi[482] * Ci[20]
+	+ Qr[466] * Cr[36] - Qi[466] * Ci[36]
+	+ Qr[454] * Cr[48] - Qi[454] * Ci[48]
+	+ Qr[434] * Cr[68] - Qi[434] * Ci[68]
+	+ Qr[422] * Cr[80] - Qi[422] * Ci[80]
+	+ Qr[406] * Cr[96] - Qi[406] * Ci[96]
+	+ Qr[370] * Cr[132] - Qi[370] * Ci[132]
+	+ Qr[358] * Cr[144] - Qi[358] * Ci[144]
+	+ Qr[342] * Cr[160] - Qi[342] * Ci[160]
+	+ Qr[310] * Cr[192] - Qi[310] * Ci[192]
+	+ Qr[242] * Cr[260] - Qi[242] * Ci[260]
+	+ Qr[230] * Cr[272] - Qi[230] * Ci[272]
+	+ Qr[214] * Cr[288] - Qi[214] * Ci[288]
+	+ Qr[182] * Cr[320] - Qi[182] * Ci[320]
+	+ Qr[118] * Cr[384] - Qi[118] * Ci[384]
+	- 5. * Cr[502];
+      Ci[502] =
+	Qr[482] * Ci[20] + Qi[482] * Cr[20]
+	+ Qr[466] * Ci[36] + Qi[466] * Cr[36]
+	+ Qr[454] * Ci[48] + Qi[454] * Cr[48]
+	+ Qr[434] * Ci[68] + Qi[434] * Cr[68]
+	+ Qr[422] * Ci[80] + Qi[422] * Cr[80]
+	+ Qr[406] * Ci[96] + Qi[406] * Cr[96]
+	+ Qr[370] * Ci[132] + Qi[370] * Cr[132]
+	+ Qr[358] * Ci[144] + Qi[358] * Cr[144]
+	+ Qr[342] * Ci[160] + Qi[342] * Cr[160]
+	+ Qr[310] * Ci[192] + Qi[310] * Cr[192]
+	+ Qr[242] * Ci[260] + Qi[242] * Cr[260]
+	+ Qr[230] * Ci[272] + Qi[230] * Cr[272]
+	+ Qr[214] * Ci[288] + Qi[214] * Cr[288]
+	+ Qr[182] * Ci[320] + Qi[182] * Cr[320]
+	+ Qr[118] * Ci[384] + Qi[118] * Cr[384]
+	- 5. * Ci[502];
+      Cr[502] =
+	Qr[450] * Cr[52] - Qi[450] * Ci[52]
+	+ Qr[418] * Cr[84] - Qi[418] * Ci[84]
+	+ Qr[402] * Cr[100] - Qi[402] * Ci[100]
+	+ Qr[390] * Cr[112] - Qi[390] * Ci[112]
+	+ Qr[354] * Cr[148] - Qi[354] * Ci[148]
+	+ Qr[338] * Cr[164] - Qi[338] * Ci[164]
+	+ Qr[326] * Cr[176] - Qi[326] * Ci[176]
+	+ Qr[306] * Cr[196] - Qi[306] * Ci[196]
+	+ Qr[294] * Cr[208] - Qi[294] * Ci[208]
+	+ Qr[278] * Cr[224] - Qi[278] * Ci[224]
+	+ Qr[226] * Cr[276] - Qi[226] * Ci[276]
+	+ Qr[210] * Cr[292] - Qi[210] * Ci[292]
+	+ Qr[198] * Cr[304] - Qi[198] * Ci[304]
+	+ Qr[178] * Cr[324] - Qi[178] * Ci[324]
+	+ Qr[166] * Cr[336] - Qi[166] * Ci[336]
+	+ Qr[150] * Cr[352] - Qi[150] * Ci[352]
+	+ Qr[114] * Cr[388] - Qi[114] * Ci[388]
+	+ Qr[102] * Cr[400] - Qi[102] * Ci[400]
+	+ Qr[86] * Cr[416] - Qi[86] * Ci[416]
+	+ Qr[54] * Cr[448] - Qi[54] * Ci[448]
+	- 4. * Cr[502];
+      Ci[502] =
+	Qr[450] * Ci[52] + Qi[450] * Cr[52]
+	+ Qr[418] * Ci[84] + Qi[418] * Cr[84]
+	+ Qr[402] * Ci[100] + Qi[402] * Cr[100]
+	+ Qr[390] * Ci[112] + Qi[390] * Cr[112]
+	+ Qr[354] * Ci[148] + Qi[354] * Cr[148]
+	+ Qr[338] * Ci[164] + Qi[338] * Cr[164]
+	+ Qr[326] * Ci[176] + Qi[326] * Cr[176]
+	+ Qr[306] * Ci[196] + Qi[306] * Cr[196]
+	+ Qr[294] * Ci[208] + Qi[294] * Cr[208]
+	+ Qr[278] * Ci[224] + Qi[278] * Cr[224]
+	+ Qr[226] * Ci[276] + Qi[226] * Cr[276]
+	+ Qr[210] * Ci[292] + Qi[210] * Cr[292]
+	+ Qr[198] * Ci[304] + Qi[198] * Cr[304]
+	+ Qr[178] * Ci[324] + Qi[178] * Cr[324]
+	+ Qr[166] * Ci[336] + Qi[166] * Cr[336]
+	+ Qr[150] * Ci[352] + Qi[150] * Cr[352]
+	+ Qr[114] * Ci[388] + Qi[114] * Cr[388]
+	+ Qr[102] * Ci[400] + Qi[102] * Cr[400]
+	+ Qr[86] * Ci[416] + Qi[86] * Cr[416]
+	+ Qr[54] * Ci[448] + Qi[54] * Cr[448]
+	- 4. * Ci[502];
+      Cr[502] =
+	Qr[386] * Cr[116] - Qi[386] * Ci[116]
+	+ Qr[322] * Cr[180] - Qi[322] * Ci[180]
+	+ Qr[290] * Cr[212] - Qi[290] * Ci[212]
+	+ Qr[274] * Cr[228] - Qi[274] * Ci[228]
+	+ Qr[262] * Cr[240] - Qi[262] * Ci[240]
+	+ Qr[194] * Cr[308] - Qi[194] * Ci[308]
+	+ Qr[162] * Cr[340] - Qi[162] * Ci[340]
+	+ Qr[146] * Cr[356] - Qi[146] * Ci[356]
+	+ Qr[134] * Cr[368] - Qi[134] * Ci[368]
+	+ Qr[98] * Cr[404] - Qi[98] * Ci[404]
+	+ Qr[82] * Cr[420] - Qi[82] * Ci[420]
+	+ Qr[70] * Cr[432] - Qi[70] * Ci[432]
+	+ Qr[50] * Cr[452] - Qi[50] * Ci[452]
+	+ Qr[38] * Cr[464] - Qi[38] * Ci[464]
+	+ Qr[22] * Cr[480] - Qi[22] * Ci[480]
+	- 3. * Cr[502];
+      Ci[502] =
+	Qr[386] * Ci[116] + Qi[386] * Cr[116]
+	+ Qr[322] * Ci[180] + Qi[322] * Cr[180]
+	+ Qr[290] * Ci[212] + Qi[290] * Cr[212]
+	+ Qr[274] * Ci[228] + Qi[274] * Cr[228]
+	+ Qr[262] * Ci[240] + Qi[262] * Cr[240]
+	+ Qr[194] * Ci[308] + Qi[194] * Cr[308]
+	+ Qr[162] * Ci[340] + Qi[162] * Cr[340]
+	+ Qr[146] * Ci[356] + Qi[146] * Cr[356]
+	+ Qr[134] * Ci[368] + Qi[134] * Cr[368]
+	+ Qr[98] * Ci[404] + Qi[98] * Cr[404]
+	+ Qr[82] * Ci[420] + Qi[82] * Cr[420]
+	+ Qr[70] * Ci[432] + Qi[70] * Cr[432]
+	+ Qr[50] * Ci[452] + Qi[50] * Cr[452]
+	+ Qr[38] * Ci[464] + Qi[38] * Cr[464]
+	+ Qr[22] * Ci[480] + Qi[22] * Cr[480]
+	- 3. * Ci[502];
+      Cr[502] =
+	Qr[258] * Cr[244] - Qi[258] * Ci[244]
+	+ Qr[130] * Cr[372] - Qi[130] * Ci[372]
+	+ Qr[66] * Cr[436] - Qi[66] * Ci[436]
+	+ Qr[34] * Cr[468] - Qi[34] * Ci[468]
+	+ Qr[18] * Cr[484] - Qi[18] * Ci[484]
+	+ Qr[6] * Cr[496] - Qi[6] * Ci[496]
+	- 2. * Cr[502];
+      Ci[502] =
+	Qr[258] * Ci[244] + Qi[258] * Cr[244]
+	+ Qr[130] * Ci[372] + Qi[130] * Cr[372]
+	+ Qr[66] * Ci[436] + Qi[66] * Cr[436]
+	+ Qr[34] * Ci[468] + Qi[34] * Cr[468]
+	+ Qr[18] * Ci[484] + Qi[18] * Cr[484]
+	+ Qr[6] * Ci[496] + Qi[6] * Cr[496]
+	- 2. * Ci[502];
+      Cr[502] =
+	Qr[2] * Cr[500] - Qi[2] * Ci[500]
+	- Cr[502];
+      Ci[502] =
+	Qr[2] * Ci[500] + Qi[2] * Cr[500]
+	- Ci[502];
+    }
+
+    /** Part 22 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part22(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[504] =
+	Qr[504];
+      Ci[504] =
+	Qi[504];
+      Cr[504] =
+	Qr[488] * Cr[16] - Qi[488] * Ci[16]
+	+ Qr[472] * Cr[32] - Qi[472] * Ci[32]
+	+ Qr[440] * Cr[64] - Qi[440] * Ci[64]
+	+ Qr[376] * Cr[128] - Qi[376] * Ci[128]
+	+ Qr[248] * Cr[256] - Qi[248] * Ci[256]
+	- 5. * Cr[504];
+      Ci[504] =
+	Qr[488] * Ci[16] + Qi[488] * Cr[16]
+	+ Qr[472] * Ci[32] + Qi[472] * Cr[32]
+	+ Qr[440] * Ci[64] + Qi[440] * Cr[64]
+	+ Qr[376] * Ci[128] + Qi[376] * Cr[128]
+	+ Qr[248] * Ci[256] + Qi[248] * Cr[256]
+	- 5. * Ci[504];
+      Cr[504] =
+	Qr[456] * Cr[48] - Qi[456] * Ci[48]
+	+ Qr[424] * Cr[80] - Qi[424] * Ci[80]
+	+ Qr[408] * Cr[96] - Qi[408] * Ci[96]
+	+ Qr[360] * Cr[144] - Qi[360] * Ci[144]
+	+ Qr[344] * Cr[160] - Qi[344] * Ci[160]
+	+ Qr[312] * Cr[192] - Qi[312] * Ci[192]
+	+ Qr[232] * Cr[272] - Qi[232] * Ci[272]
+	+ Qr[216] * Cr[288] - Qi[216] * Ci[288]
+	+ Qr[184] * Cr[320] - Qi[184] * Ci[320]
+	+ Qr[120] * Cr[384] - Qi[120] * Ci[384]
+	- 4. * Cr[504];
+      Ci[504] =
+	Qr[456] * Ci[48] + Qi[456] * Cr[48]
+	+ Qr[424] * Ci[80] + Qi[424] * Cr[80]
+	+ Qr[408] * Ci[96] + Qi[408] * Cr[96]
+	+ Qr[360] * Ci[144] + Qi[360] * Cr[144]
+	+ Qr[344] * Ci[160] + Qi[344] * Cr[160]
+	+ Qr[312] * Ci[192] + Qi[312] * Cr[192]
+	+ Qr[232] * Ci[272] + Qi[232] * Cr[272]
+	+ Qr[216] * Ci[288] + Qi[216] * Cr[288]
+	+ Qr[184] * Ci[320] + Qi[184] * Cr[320]
+	+ Qr[120] * Ci[384] + Qi[120] * Cr[384]
+	- 4. * Ci[504];
+      Cr[504] =
+	Qr[392] * Cr[112] - Qi[392] * Ci[112]
+	+ Qr[328] * Cr[176] - Qi[328] * Ci[176]
+	+ Qr[296] * Cr[208] - Qi[296] * Ci[208]
+	+ Qr[280] * Cr[224] - Qi[280] * Ci[224]
+	+ Qr[200] * Cr[304] - Qi[200] * Ci[304]
+	+ Qr[168] * Cr[336] - Qi[168] * Ci[336]
+	+ Qr[152] * Cr[352] - Qi[152] * Ci[352]
+	+ Qr[104] * Cr[400] - Qi[104] * Ci[400]
+	+ Qr[88] * Cr[416] - Qi[88] * Ci[416]
+	+ Qr[56] * Cr[448] - Qi[56] * Ci[448]
+	- 3. * Cr[504];
+      Ci[504] =
+	Qr[392] * Ci[112] + Qi[392] * Cr[112]
+	+ Qr[328] * Ci[176] + Qi[328] * Cr[176]
+	+ Qr[296] * Ci[208] + Qi[296] * Cr[208]
+	+ Qr[280] * Ci[224] + Qi[280] * Cr[224]
+	+ Qr[200] * Ci[304] + Qi[200] * Cr[304]
+	+ Qr[168] * Ci[336] + Qi[168] * Cr[336]
+	+ Qr[152] * Ci[352] + Qi[152] * Cr[352]
+	+ Qr[104] * Ci[400] + Qi[104] * Cr[400]
+	+ Qr[88] * Ci[416] + Qi[88] * Cr[416]
+	+ Qr[56] * Ci[448] + Qi[56] * Cr[448]
+	- 3. * Ci[504];
+      Cr[504] =
+	Qr[264] * Cr[240] - Qi[264] * Ci[240]
+	+ Qr[136] * Cr[368] - Qi[136] * Ci[368]
+	+ Qr[72] * Cr[432] - Qi[72] * Ci[432]
+	+ Qr[40] * Cr[464] - Qi[40] * Ci[464]
+	+ Qr[24] * Cr[480] - Qi[24] * Ci[480]
+	- 2. * Cr[504];
+      Ci[504] =
+	Qr[264] * Ci[240] + Qi[264] * Cr[240]
+	+ Qr[136] * Ci[368] + Qi[136] * Cr[368]
+	+ Qr[72] * Ci[432] + Qi[72] * Cr[432]
+	+ Qr[40] * Ci[464] + Qi[40] * Cr[464]
+	+ Qr[24] * Ci[480] + Qi[24] * Cr[480]
+	- 2. * Ci[504];
+      Cr[504] =
+	Qr[8] * Cr[496] - Qi[8] * Ci[496]
+	- Cr[504];
+      Ci[504] =
+	Qr[8] * Ci[496] + Qi[8] * Cr[496]
+	- Ci[504];
+
+      Cr[506] =
+	Qr[506];
+      Ci[506] =
+	Qi[506];
+      Cr[506] =
+	Qr[498] * Cr[8] - Qi[498] * Ci[8]
+	+ Qr[490] * Cr[16] - Qi[490] * Ci[16]
+	+ Qr[474] * Cr[32] - Qi[474] * Ci[32]
+	+ Qr[442] * Cr[64] - Qi[442] * Ci[64]
+	+ Qr[378] * Cr[128] - Qi[378] * Ci[128]
+	+ Qr[250] * Cr[256] - Qi[250] * Ci[256]
+	- 6. * Cr[506];
+      Ci[506] =
+	Qr[498] * Ci[8] + Qi[498] * Cr[8]
+	+ Qr[490] * Ci[16] + Qi[490] * Cr[16]
+	+ Qr[474] * Ci[32] + Qi[474] * Cr[32]
+	+ Qr[442] * Ci[64] + Qi[442] * Cr[64]
+	+ Qr[378] * Ci[128] + Qi[378] * Cr[128]
+	+ Qr[250] * Ci[256] + Qi[250] * Cr[256]
+	- 6. * Ci[506];
+      Cr[506] =
+	Qr[482] * Cr[24] - Qi[482] * Ci[24]
+	+ Qr[466] * Cr[40] - Qi[466] * Ci[40]
+	+ Qr[458] * Cr[48] - Qi[458] * Ci[48]
+	+ Qr[434] * Cr[72] - Qi[434] * Ci[72]
+	+ Qr[426] * Cr[80] - Qi[426] * Ci[80]
+	+ Qr[410] * Cr[96] - Qi[410] * Ci[96]
+	+ Qr[370] * Cr[136] - Qi[370] * Ci[136]
+	+ Qr[362] * Cr[144] - Qi[362] * Ci[144]
+	+ Qr[346] * Cr[160] - Qi[346] * Ci[160]
+	+ Qr[314] * Cr[192] - Qi[314] * Ci[192]
+	+ Qr[242] * Cr[264] - Qi[242] * Ci[264]
+	+ Qr[234] * Cr[272] - Qi[234] * Ci[272]
+	+ Qr[218] * Cr[288] - Qi[218] * Ci[288]
+	+ Qr[186] * Cr[320] - Qi[186] * Ci[320]
+	+ Qr[122] * Cr[384] - Qi[122] * Ci[384]
+	- 5. * Cr[506];
+      Ci[506] =
+	Qr[482] * Ci[24] + Qi[482] * Cr[24]
+	+ Qr[466] * Ci[40] + Qi[466] * Cr[40]
+	+ Qr[458] * Ci[48] + Qi[458] * Cr[48]
+	+ Qr[434] * Ci[72] + Qi[434] * Cr[72]
+	+ Qr[426] * Ci[80] + Qi[426] * Cr[80]
+	+ Qr[410] * Ci[96] + Qi[410] * Cr[96]
+	+ Qr[370] * Ci[136] + Qi[370] * Cr[136]
+	+ Qr[362] * Ci[144] + Qi[362] * Cr[144]
+	+ Qr[346] * Ci[160] + Qi[346] * Cr[160]
+	+ Qr[314] * Ci[192] + Qi[314] * Cr[192]
+	+ Qr[242] * Ci[264] + Qi[242] * Cr[264]
+	+ Qr[234] * Ci[272] + Qi[234] * Cr[272]
+	+ Qr[218] * Ci[288] + Qi[218] * Cr[288]
+	+ Qr[186] * Ci[320] + Qi[186] * Cr[320]
+	+ Qr[122] * Ci[384] + Qi[122] * Cr[384]
+	- 5. * Ci[506];
+      Cr[506] =
+	Qr[450] * Cr[56] - Qi[450] * Ci[56]
+	+ Qr[418] * Cr[88] - Qi[418] * Ci[88]
+	+ Qr[402] * Cr[104] - Qi[402] * Ci[104]
+	+ Qr[394] * Cr[112] - Qi[394] * Ci[112]
+	+ Qr[354] * Cr[152] - Qi[354] * Ci[152]
+	+ Qr[338] * Cr[168] - Qi[338] * Ci[168]
+	+ Qr[330] * Cr[176] - Qi[330] * Ci[176]
+	+ Qr[306] * Cr[200] - Qi[306] * Ci[200]
+	+ Qr[298] * Cr[208] - Qi[298] * Ci[208]
+	+ Qr[282] * Cr[224] - Qi[282] * Ci[224]
+	+ Qr[226] * Cr[280] - Qi[226] * Ci[280]
+	+ Qr[210] * Cr[296] - Qi[210] * Ci[296]
+	+ Qr[202] * Cr[304] - Qi[202] * Ci[304]
+	+ Qr[178] * Cr[328] - Qi[178] * Ci[328]
+	+ Qr[170] * Cr[336] - Qi[170] * Ci[336]
+	+ Qr[154] * Cr[352] - Qi[154] * Ci[352]
+	+ Qr[114] * Cr[392] - Qi[114] * Ci[392]
+	+ Qr[106] * Cr[400] - Qi[106] * Ci[400]
+	+ Qr[90] * Cr[416] - Qi[90] * Ci[416]
+	+ Qr[58] * Cr[448] - Qi[58] * Ci[448]
+	- 4. * Cr[506];
+      Ci[506] =
+	Qr[450] * Ci[56] + Qi[450] * Cr[56]
+	+ Qr[418] * Ci[88] + Qi[418] * Cr[88]
+	+ Qr[402] * Ci[104] + Qi[402] * Cr[104]
+	+ Qr[394] * Ci[112] + Qi[394] * Cr[112]
+	+ Qr[354] * Ci[152] + Qi[354] * Cr[152]
+	+ Qr[338] * Ci[168] + Qi[338] * Cr[168]
+	+ Qr[330] * Ci[176] + Qi[330] * Cr[176]
+	+ Qr[306] * Ci[200] + Qi[306] * Cr[200]
+	+ Qr[298] * Ci[208] + Qi[298] * Cr[208]
+	+ Qr[282] * Ci[224] + Qi[282] * Cr[224]
+	+ Qr[226] * Ci[280] + Qi[226] * Cr[280]
+	+ Qr[210] * Ci[296] + Qi[210] * Cr[296]
+	+ Qr[202] * Ci[304] + Qi[202] * Cr[304]
+	+ Qr[178] * Ci[328] + Qi[178] * Cr[328]
+	+ Qr[170] * Ci[336] + Qi[170] * Cr[336]
+	+ Qr[154] * Ci[352] + Qi[154] * Cr[352]
+	+ Qr[114] * Ci[392] + Qi[114] * Cr[392]
+	+ Qr[106] * Ci[400] + Qi[106] * Cr[400]
+	+ Qr[90] * Ci[416] + Qi[90] * Cr[416]
+	+ Qr[58] * Ci[448] + Qi[58] * Cr[448]
+	- 4. * Ci[506];
+      Cr[506] =
+	Qr[386] * Cr[120] - Qi[386] * Ci[120]
+	+ Qr[322] * Cr[184] - Qi[322] * Ci[184]
+	+ Qr[290] * Cr[216] - Qi[290] * Ci[216]
+	+ Qr[274] * Cr[232] - Qi[274] * Ci[232]
+	+ Qr[266] * Cr[240] - Qi[266] * Ci[240]
+	+ Qr[194] * Cr[312] - Qi[194] * Ci[312]
+	+ Qr[162] * Cr[344] - Qi[162] * Ci[344]
+	+ Qr[146] * Cr[360] - Qi[146] * Ci[360]
+	+ Qr[138] * Cr[368] - Qi[138] * Ci[368]
+	+ Qr[98] * Cr[408] - Qi[98] * Ci[408]
+	+ Qr[82] * Cr[424] - Qi[82] * Ci[424]
+	+ Qr[74] * Cr[432] - Qi[74] * Ci[432]
+	+ Qr[50] * Cr[456] - Qi[50] * Ci[456]
+	+ Qr[42] * Cr[464] - Qi[42] * Ci[464]
+	+ Qr[26] * Cr[480] - Qi[26] * Ci[480]
+	- 3. * Cr[506];
+      Ci[506] =
+	Qr[386] * Ci[120] + Qi[386] * Cr[120]
+	+ Qr[322] * Ci[184] + Qi[322] * Cr[184]
+	+ Qr[290] * Ci[216] + Qi[290] * Cr[216]
+	+ Qr[274] * Ci[232] + Qi[274] * Cr[232]
+	+ Qr[266] * Ci[240] + Qi[266] * Cr[240]
+	+ Qr[194] * Ci[312] + Qi[194] * Cr[312]
+	+ Qr[162] * Ci[344] + Qi[162] * Cr[344]
+	+ Qr[146] * Ci[360] + Qi[146] * Cr[360]
+	+ Qr[138] * Ci[368] + Qi[138] * Cr[368]
+	+ Qr[98] * Ci[408] + Qi[98] * Cr[408]
+	+ Qr[82] * Ci[424] + Qi[82] * Cr[424]
+	+ Qr[74] * Ci[432] + Qi[74] * Cr[432]
+	+ Qr[50] * Ci[456] + Qi[50] * Cr[456]
+	+ Qr[42] * Ci[464] + Qi[42] * Cr[464]
+	+ Qr[26] * Ci[480] + Qi[26] * Cr[480]
+	- 3. * Ci[506];
+      Cr[506] =
+	Qr[258] * Cr[248] - Qi[258] * Ci[248]
+	+ Qr[130] * Cr[376] - Qi[130] * Ci[376]
+	+ Qr[66] * Cr[440] - Qi[66] * Ci[440]
+	+ Qr[34] * Cr[472] - Qi[34] * Ci[472]
+	+ Qr[18] * Cr[488] - Qi[18] * Ci[488]
+	+ Qr[10] * Cr[496] - Qi[10] * Ci[496]
+	- 2. * Cr[506];
+      Ci[506] =
+	Qr[258] * Ci[248] + Qi[258] * Cr[248]
+	+ Qr[130] * Ci[376] + Qi[130] * Cr[376]
+	+ Qr[66] * Ci[440] + Qi[66] * Cr[440]
+	+ Qr[34] * Ci[472] + Qi[34] * Cr[472]
+	+ Qr[18] * Ci[488] + Qi[18] * Cr[488]
+	+ Qr[10] * Ci[496] + Qi[10] * Cr[496]
+	- 2. * Ci[506];
+      Cr[506] =
+	Qr[2] * Cr[504] - Qi[2] * Ci[504]
+	- Cr[506];
+      Ci[506] =
+	Qr[2] * Ci[504] + Qi[2] * Cr[504]
+	- Ci[506];
+
+      Cr[508] =
+	Qr[508];
+      Ci[508] =
+	Qi[508];
+      Cr[508] =
+	Qr[500] * Cr[8] - Qi[500] * Ci[8]
+	+ Qr[492] * Cr[16] - Qi[492] * Ci[16]
+	+ Qr[476] * Cr[32] - Qi[476] * Ci[32]
+	+ Qr[444] * Cr[64] - Qi[444] * Ci[64]
+	+ Qr[380] * Cr[128] - Qi[380] * Ci[128]
+	+ Qr[252] * Cr[256] - Qi[252] * Ci[256]
+	- 6. * Cr[508];
+      Ci[508] =
+	Qr[500] * Ci[8] + Qi[500] * Cr[8]
+	+ Qr[492] * Ci[16] + Qi[492] * Cr[16]
+	+ Qr[476] * Ci[32] + Qi[476] * Cr[32]
+	+ Qr[444] * Ci[64] + Qi[444] * Cr[64]
+	+ Qr[380] * Ci[128] + Qi[380] * Cr[128]
+	+ Qr[252] * Ci[256] + Qi[252] * Cr[256]
+	- 6. * Ci[508];
+      Cr[508] =
+	Qr[484] * Cr[24] - Qi[484] * Ci[24]
+	+ Qr[468] * Cr[40] - Qi[468] * Ci[40]
+	+ Qr[460] * Cr[48] - Qi[460] * Ci[48]
+	+ Qr[436] * Cr[72] - Qi[436] * Ci[72]
+	+ Qr[428] * Cr[80] - Qi[428] * Ci[80]
+	+ Qr[412] * Cr[96] - Qi[412] * Ci[96]
+	+ Qr[372] * Cr[136] - Qi[372] * Ci[136]
+	+ Qr[364] * Cr[144] - Qi[364] * Ci[144]
+	+ Qr[348] * Cr[160] - Qi[348] * Ci[160]
+	+ Qr[316] * Cr[192] - Qi[316] * Ci[192]
+	+ Qr[244] * Cr[264] - Qi[244] * Ci[264]
+	+ Qr[236] * Cr[272] - Qi[236] * Ci[272]
+	+ Qr[220] * Cr[288] - Qi[220] * Ci[288]
+	+ Qr[188] * Cr[320] - Qi[188] * Ci[320]
+	+ Qr[124] * Cr[384] - Qi[124] * Ci[384]
+	- 5. * Cr[508];
+      Ci[508] =
+	Qr[484] * Ci[24] + Qi[484] * Cr[24]
+	+ Qr[468] * Ci[40] + Qi[468] * Cr[40]
+	+ Qr[460] * Ci[48] + Qi[460] * Cr[48]
+	+ Qr[436] * Ci[72] + Qi[436] * Cr[72]
+	+ Qr[428] * Ci[80] + Qi[428] * Cr[80]
+	+ Qr[412] * Ci[96] + Qi[412] * Cr[96]
+	+ Qr[372] * Ci[136] + Qi[372] * Cr[136]
+	+ Qr[364] * Ci[144] + Qi[364] * Cr[144]
+	+ Qr[348] * Ci[160] + Qi[348] * Cr[160]
+	+ Qr[316] * Ci[192] + Qi[316] * Cr[192]
+	+ Qr[244] * Ci[264] + Qi[244] * Cr[264]
+	+ Qr[236] * Ci[272] + Qi[236] * Cr[272]
+	+ Qr[220] * Ci[288] + Qi[220] * Cr[288]
+	+ Qr[188] * Ci[320] + Qi[188] * Cr[320]
+	+ Qr[124] * Ci[384] + Qi[124] * Cr[384]
+	- 5. * Ci[508];
+      Cr[508] =
+	Qr[452] * Cr[56] - Qi[452] * Ci[56]
+	+ Qr[420] * Cr[88] - Qi[420] * Ci[88]
+	+ Qr[404] * Cr[104] - Qi[404] * Ci[104]
+	+ Qr[396] * Cr[112] - Qi[396] * Ci[112]
+	+ Qr[356] * Cr[152] - Qi[356] * Ci[152]
+	+ Qr[340] * Cr[168] - Qi[340] * Ci[168]
+	+ Qr[332] * Cr[176] - Qi[332] * Ci[176]
+	+ Qr[308] * Cr[200] - Qi[308] * Ci[200]
+	+ Qr[300] * Cr[208] - Qi[300] * Ci[208]
+	+ Qr[284] * Cr[224] - Qi[284] * Ci[224]
+	+ Qr[228] * Cr[280] - Qi[228] * Ci[280]
+	+ Qr[212] * Cr[296] - Qi[212] * Ci[296]
+	+ Qr[204] * Cr[304] - Qi[204] * Ci[304]
+	+ Qr[180] * Cr[328] - Qi[180] * Ci[328]
+	+ Qr[172] * Cr[336] - Qi[172] * Ci[336]
+	+ Qr[156] * Cr[352] - Qi[156] * Ci[352]
+	+ Qr[116] * Cr[392] - Qi[116] * Ci[392]
+	+ Qr[108] * Cr[400] - Qi[108] * Ci[400]
+	+ Qr[92] * Cr[416] - Qi[92] * Ci[416]
+	+ Qr[60] * Cr[448] - Qi[60] * Ci[448]
+	- 4. * Cr[508];
+      Ci[508] =
+	Qr[452] * Ci[56] + Qi[452] * Cr[56]
+	+ Qr[420] * Ci[88] + Qi[420] * Cr[88]
+	+ Qr[404] * Ci[104] + Qi[404] * Cr[104]
+	+ Qr[396] * Ci[112] + Qi[396] * Cr[112]
+	+ Qr[356] * Ci[152] + Qi[356] * Cr[152]
+	+ Qr[340] * Ci[168] + Qi[340] * Cr[168]
+	+ Qr[332] * Ci[176] + Qi[332] * Cr[176]
+	+ Qr[308] * Ci[200] + Qi[308] * Cr[200]
+	+ Qr[300] * Ci[208] + Qi[300] * Cr[208]
+	+ Qr[284] * Ci[224] + Qi[284] * Cr[224]
+	+ Qr[228] * Ci[280] + Qi[228] * Cr[280]
+	+ Qr[212] * Ci[296] + Qi[212] * Cr[296]
+	+ Qr[204] * Ci[304] + Qi[204] * Cr[304]
+	+ Qr[180] * Ci[328] + Qi[180] * Cr[328]
+	+ Qr[172] * Ci[336] + Qi[172] * Cr[336]
+	+ Qr[156] * Ci[352] + Qi[156] * Cr[352]
+	+ Qr[116] * Ci[392] + Qi[116] * Cr[392]
+	+ Qr[108] * Ci[400] + Qi[108] * Cr[400]
+	+ Qr[92] * Ci[416] + Qi[92] * Cr[416]
+	+ Qr[60] * Ci[448] + Qi[60] * Cr[448]
+	- 4. * Ci[508];
+      Cr[508] =
+	Qr[388] * Cr[120] - Qi[388] * Ci[120]
+	+ Qr[324] * Cr[184] - Qi[324] * Ci[184]
+	+ Qr[292] * Cr[216] - Qi[292] * Ci[216]
+	+ Qr[276] * Cr[232] - Qi[276] * Ci[232]
+	+ Qr[268] * Cr[240] - Qi[268] * Ci[240]
+	+ Qr[196] * Cr[312] - Qi[196] * Ci[312]
+	+ Qr[164] * Cr[344] - Qi[164] * Ci[344]
+	+ Qr[148] * Cr[360] - Qi[148] * Ci[360]
+	+ Qr[140] * Cr[368] - Qi[140] * Ci[368]
+	+ Qr[100] * Cr[408] - Qi[100] * Ci[408]
+	+ Qr[84] * Cr[424] - Qi[84] * Ci[424]
+	+ Qr[76] * Cr[432] - Qi[76] * Ci[432]
+	+ Qr[52] * Cr[456] - Qi[52] * Ci[456]
+	+ Qr[44] * Cr[464] - Qi[44] * Ci[464]
+	+ Qr[28] * Cr[480] - Qi[28] * Ci[480]
+	- 3. * Cr[508];
+      Ci[508] =
+	Qr[388] * Ci[120] + Qi[388] * Cr[120]
+	+ Qr[324] * Ci[184] + Qi[324] * Cr[184]
+	+ Qr[292] * Ci[216] + Qi[292] * Cr[216]
+	+ Qr[276] * Ci[232] + Qi[276] * Cr[232]
+	+ Qr[268] * Ci[240] + Qi[268] * Cr[240]
+	+ Qr[196] * Ci[312] + Qi[196] * Cr[312]
+	+ Qr[164] * Ci[344] + Qi[164] * Cr[344]
+	+ Qr[148] * Ci[360] + Qi[148] * Cr[360]
+	+ Qr[140] * Ci[368] + Qi[140] * Cr[368]
+	+ Qr[100] * Ci[408] + Qi[100] * Cr[408]
+	+ Qr[84] * Ci[424] + Qi[84] * Cr[424]
+	+ Qr[76] * Ci[432] + Qi[76] * Cr[432]
+	+ Qr[52] * Ci[456] + Qi[52] * Cr[456]
+	+ Qr[44] * Ci[464] + Qi[44] * Cr[464]
+	+ Qr[28] * Ci[480] + Qi[28] * Cr[480]
+	- 3. * Ci[508];
+      Cr[508] =
+	Qr[260] * Cr[248] - Qi[260] * Ci[248]
+	+ Qr[132] * Cr[376] - Qi[132] * Ci[376]
+	+ Qr[68] * Cr[440] - Qi[68] * Ci[440]
+	+ Qr[36] * Cr[472] - Qi[36] * Ci[472]
+	+ Qr[20] * Cr[488] - Qi[20] * Ci[488]
+	+ Qr[12] * Cr[496] - Qi[12] * Ci[496]
+	- 2. * Cr[508];
+      Ci[508] =
+	Qr[260] * Ci[248] + Qi[260] * Cr[248]
+	+ Qr[132] * Ci[376] + Qi[132] * Cr[376]
+	+ Qr[68] * Ci[440] + Qi[68] * Cr[440]
+	+ Qr[36] * Ci[472] + Qi[36] * Cr[472]
+	+ Qr[20] * Ci[488] + Qi[20] * Cr[488]
+	+ Qr[12] * Ci[496] + Qi[12] * Cr[496]
+	- 2. * Ci[508];
+      Cr[508] =
+	Qr[4] * Cr[504] - Qi[4] * Ci[504]
+	- Cr[508];
+      Ci[508] =
+	Qr[4] * Ci[504] + Qi[4] * Cr[504]
+	- Ci[508];
+    }
+
+    /** Part 23 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part23(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[510] =
+	Qr[510];
+      Ci[510] =
+	Qi[510];
+      Cr[510] =
+	Qr[506] * Cr[4] - Qi[506] * Ci[4]
+	+ Qr[502] * Cr[8] - Qi[502] * Ci[8]
+	+ Qr[494] * Cr[16] - Qi[494] * Ci[16]
+	+ Qr[478] * Cr[32] - Qi[478] * Ci[32]
+	+ Qr[446] * Cr[64] - Qi[446] * Ci[64]
+	+ Qr[382] * Cr[128] - Qi[382] * Ci[128]
+	+ Qr[254] * Cr[256] - Qi[254] * Ci[256]
+	- 7. * Cr[510];
+      Ci[510] =
+	Qr[506] * Ci[4] + Qi[506] * Cr[4]
+	+ Qr[502] * Ci[8] + Qi[502] * Cr[8]
+	+ Qr[494] * Ci[16] + Qi[494] * Cr[16]
+	+ Qr[478] * Ci[32] + Qi[478] * Cr[32]
+	+ Qr[446] * Ci[64] + Qi[446] * Cr[64]
+	+ Qr[382] * Ci[128] + Qi[382] * Cr[128]
+	+ Qr[254] * Ci[256] + Qi[254] * Cr[256]
+	- 7. * Ci[510];
+      Cr[510] =
+	Qr[498] * Cr[12] - Qi[498] * Ci[12]
+	+ Qr[490] * Cr[20] - Qi[490] * Ci[20]
+	+ Qr[486] * Cr[24] - Qi[486] * Ci[24]
+	+ Qr[474] * Cr[36] - Qi[474] * Ci[36]
+	+ Qr[470] * Cr[40] - Qi[470] * Ci[40]
+	+ Qr[462] * Cr[48] - Qi[462] * Ci[48]
+	+ Qr[442] * Cr[68] - Qi[442] * Ci[68]
+	+ Qr[438] * Cr[72] - Qi[438] * Ci[72]
+	+ Qr[430] * Cr[80] - Qi[430] * Ci[80]
+	+ Qr[414] * Cr[96] - Qi[414] * Ci[96]
+	+ Qr[378] * Cr[132] - Qi[378] * Ci[132]
+	+ Qr[374] * Cr[136] - Qi[374] * Ci[136]
+	+ Qr[366] * Cr[144] - Qi[366] * Ci[144]
+	+ Qr[350] * Cr[160] - Qi[350] * Ci[160]
+	+ Qr[318] * Cr[192] - Qi[318] * Ci[192]
+	+ Qr[250] * Cr[260] - Qi[250] * Ci[260]
+	+ Qr[246] * Cr[264] - Qi[246] * Ci[264]
+	+ Qr[238] * Cr[272] - Qi[238] * Ci[272]
+	+ Qr[222] * Cr[288] - Qi[222] * Ci[288]
+	+ Qr[190] * Cr[320] - Qi[190] * Ci[320]
+	+ Qr[126] * Cr[384] - Qi[126] * Ci[384]
+	- 6. * Cr[510];
+      Ci[510] =
+	Qr[498] * Ci[12] + Qi[498] * Cr[12]
+	+ Qr[490] * Ci[20] + Qi[490] * Cr[20]
+	+ Qr[486] * Ci[24] + Qi[486] * Cr[24]
+	+ Qr[474] * Ci[36] + Qi[474] * Cr[36]
+	+ Qr[470] * Ci[40] + Qi[470] * Cr[40]
+	+ Qr[462] * Ci[48] + Qi[462] * Cr[48]
+	+ Qr[442] * Ci[68] + Qi[442] * Cr[68]
+	+ Qr[438] * Ci[72] + Qi[438] * Cr[72]
+	+ Qr[430] * Ci[80] + Qi[430] * Cr[80]
+	+ Qr[414] * Ci[96] + Qi[414] * Cr[96]
+	+ Qr[378] * Ci[132] + Qi[378] * Cr[132]
+	+ Qr[374] * Ci[136] + Qi[374] * Cr[136]
+	+ Qr[366] * Ci[144] + Qi[366] * Cr[144]
+	+ Qr[350] * Ci[160] + Qi[350] * Cr[160]
+	+ Qr[318] * Ci[192] + Qi[318] * Cr[192]
+	+ Qr[250] * Ci[260] + Qi[250] * Cr[260]
+	+ Qr[246] * Ci[264] + Qi[246] * Cr[264]
+	+ Qr[238] * Ci[272] + Qi[238] * Cr[272]
+	+ Qr[222] * Ci[288] + Qi[222] * Cr[288]
+	+ Qr[190] * Ci[320] + Qi[190] * Cr[320]
+	+ Qr[126] * Ci[384] + Qi[126] * Cr[384]
+	- 6. * Ci[510];
+      Cr[510] =
+	Qr[482] * Cr[28] - Qi[482] * Ci[28]
+	+ Qr[466] * Cr[44] - Qi[466] * Ci[44]
+	+ Qr[458] * Cr[52] - Qi[458] * Ci[52]
+	+ Qr[454] * Cr[56] - Qi[454] * Ci[56]
+	+ Qr[434] * Cr[76] - Qi[434] * Ci[76]
+	+ Qr[426] * Cr[84] - Qi[426] * Ci[84]
+	+ Qr[422] * Cr[88] - Qi[422] * Ci[88]
+	+ Qr[410] * Cr[100] - Qi[410] * Ci[100]
+	+ Qr[406] * Cr[104] - Qi[406] * Ci[104]
+	+ Qr[398] * Cr[112] - Qi[398] * Ci[112]
+	+ Qr[370] * Cr[140] - Qi[370] * Ci[140]
+	+ Qr[362] * Cr[148] - Qi[362] * Ci[148]
+	+ Qr[358] * Cr[152] - Qi[358] * Ci[152]
+	+ Qr[346] * Cr[164] - Qi[346] * Ci[164]
+	+ Qr[342] * Cr[168] - Qi[342] * Ci[168]
+	+ Qr[334] * Cr[176] - Qi[334] * Ci[176]
+	+ Qr[314] * Cr[196] - Qi[314] * Ci[196]
+	+ Qr[310] * Cr[200] - Qi[310] * Ci[200]
+	+ Qr[302] * Cr[208] - Qi[302] * Ci[208]
+	+ Qr[286] * Cr[224] - Qi[286] * Ci[224]
+	+ Qr[242] * Cr[268] - Qi[242] * Ci[268]
+	+ Qr[234] * Cr[276] - Qi[234] * Ci[276]
+	+ Qr[230] * Cr[280] - Qi[230] * Ci[280]
+	+ Qr[218] * Cr[292] - Qi[218] * Ci[292]
+	+ Qr[214] * Cr[296] - Qi[214] * Ci[296]
+	+ Qr[206] * Cr[304] - Qi[206] * Ci[304]
+	+ Qr[186] * Cr[324] - Qi[186] * Ci[324]
+	+ Qr[182] * Cr[328] - Qi[182] * Ci[328]
+	+ Qr[174] * Cr[336] - Qi[174] * Ci[336]
+	+ Qr[158] * Cr[352] - Qi[158] * Ci[352]
+	+ Qr[122] * Cr[388] - Qi[122] * Ci[388]
+	+ Qr[118] * Cr[392] - Qi[118] * Ci[392]
+	+ Qr[110] * Cr[400] - Qi[110] * Ci[400]
+	+ Qr[94] * Cr[416] - Qi[94] * Ci[416]
+	+ Qr[62] * Cr[448] - Qi[62] * Ci[448]
+	- 5. * Cr[510];
+      Ci[510] =
+	Qr[482] * Ci[28] + Qi[482] * Cr[28]
+	+ Qr[466] * Ci[44] + Qi[466] * Cr[44]
+	+ Qr[458] * Ci[52] + Qi[458] * Cr[52]
+	+ Qr[454] * Ci[56] + Qi[454] * Cr[56]
+	+ Qr[434] * Ci[76] + Qi[434] * Cr[76]
+	+ Qr[426] * Ci[84] + Qi[426] * Cr[84]
+	+ Qr[422] * Ci[88] + Qi[422] * Cr[88]
+	+ Qr[410] * Ci[100] + Qi[410] * Cr[100]
+	+ Qr[406] * Ci[104] + Qi[406] * Cr[104]
+	+ Qr[398] * Ci[112] + Qi[398] * Cr[112]
+	+ Qr[370] * Ci[140] + Qi[370] * Cr[140]
+	+ Qr[362] * Ci[148] + Qi[362] * Cr[148]
+	+ Qr[358] * Ci[152] + Qi[358] * Cr[152]
+	+ Qr[346] * Ci[164] + Qi[346] * Cr[164]
+	+ Qr[342] * Ci[168] + Qi[342] * Cr[168]
+	+ Qr[334] * Ci[176] + Qi[334] * Cr[176]
+	+ Qr[314] * Ci[196] + Qi[314] * Cr[196]
+	+ Qr[310] * Ci[200] + Qi[310] * Cr[200]
+	+ Qr[302] * Ci[208] + Qi[302] * Cr[208]
+	+ Qr[286] * Ci[224] + Qi[286] * Cr[224]
+	+ Qr[242] * Ci[268] + Qi[242] * Cr[268]
+	+ Qr[234] * Ci[276] + Qi[234] * Cr[276]
+	+ Qr[230] * Ci[280] + Qi[230] * Cr[280]
+	+ Qr[218] * Ci[292] + Qi[218] * Cr[292]
+	+ Qr[214] * Ci[296] + Qi[214] * Cr[296]
+	+ Qr[206] * Ci[304] + Qi[206] * Cr[304]
+	+ Qr[186] * Ci[324] + Qi[186] * Cr[324]
+	+ Qr[182] * Ci[328] + Qi[182] * Cr[328]
+	+ Qr[174] * Ci[336] + Qi[174] * Cr[336]
+	+ Qr[158] * Ci[352] + Qi[158] * Cr[352]
+	+ Qr[122] * Ci[388] + Qi[122] * Cr[388]
+	+ Qr[118] * Ci[392] + Qi[118] * Cr[392]
+	+ Qr[110] * Ci[400] + Qi[110] * Cr[400]
+	+ Qr[94] * Ci[416] + Qi[94] * Cr[416]
+	+ Qr[62] * Ci[448] + Qi[62] * Cr[448]
+	- 5. * Ci[510];
+      Cr[510] =
+	Qr[450] * Cr[60] - Qi[450] * Ci[60]
+	+ Qr[418] * Cr[92] - Qi[418] * Ci[92]
+	+ Qr[402] * Cr[108] - Qi[402] * Ci[108]
+	+ Qr[394] * Cr[116] - Qi[394] * Ci[116]
+	+ Qr[390] * Cr[120] - Qi[390] * Ci[120]
+	+ Qr[354] * Cr[156] - Qi[354] * Ci[156]
+	+ Qr[338] * Cr[172] - Qi[338] * Ci[172]
+	+ Qr[330] * Cr[180] - Qi[330] * Ci[180]
+	+ Qr[326] * Cr[184] - Qi[326] * Ci[184]
+	+ Qr[306] * Cr[204] - Qi[306] * Ci[204]
+	+ Qr[298] * Cr[212] - Qi[298] * Ci[212]
+	+ Qr[294] * Cr[216] - Qi[294] * Ci[216]
+	+ Qr[282] * Cr[228] - Qi[282] * Ci[228]
+	+ Qr[278] * Cr[232] - Qi[278] * Ci[232]
+	+ Qr[270] * Cr[240] - Qi[270] * Ci[240]
+	+ Qr[226] * Cr[284] - Qi[226] * Ci[284]
+	+ Qr[210] * Cr[300] - Qi[210] * Ci[300]
+	+ Qr[202] * Cr[308] - Qi[202] * Ci[308]
+	+ Qr[198] * Cr[312] - Qi[198] * Ci[312]
+	+ Qr[178] * Cr[332] - Qi[178] * Ci[332]
+	+ Qr[170] * Cr[340] - Qi[170] * Ci[340]
+	+ Qr[166] * Cr[344] - Qi[166] * Ci[344]
+	+ Qr[154] * Cr[356] - Qi[154] * Ci[356]
+	+ Qr[150] * Cr[360] - Qi[150] * Ci[360]
+	+ Qr[142] * Cr[368] - Qi[142] * Ci[368]
+	+ Qr[114] * Cr[396] - Qi[114] * Ci[396]
+	+ Qr[106] * Cr[404] - Qi[106] * Ci[404]
+	+ Qr[102] * Cr[408] - Qi[102] * Ci[408]
+	+ Qr[90] * Cr[420] - Qi[90] * Ci[420]
+	+ Qr[86] * Cr[424] - Qi[86] * Ci[424]
+	+ Qr[78] * Cr[432] - Qi[78] * Ci[432]
+	+ Qr[58] * Cr[452] - Qi[58] * Ci[452]
+	+ Qr[54] * Cr[456] - Qi[54] * Ci[456]
+	+ Qr[46] * Cr[464] - Qi[46] * Ci[464]
+	+ Qr[30] * Cr[480] - Qi[30] * Ci[480]
+	- 4. * Cr[510];
+      Ci[510] =
+	Qr[450] * Ci[60] + Qi[450] * Cr[60]
+	+ Qr[418] * Ci[92] + Qi[418] * Cr[92]
+	+ Qr[402] * Ci[108] + Qi[402] * Cr[108]
+	+ Qr[394] * Ci[116] + Qi[394] * Cr[116]
+	+ Qr[390] * Ci[120] + Qi[390] * Cr[120]
+	+ Qr[354] * Ci[156] + Qi[354] * Cr[156]
+	+ Qr[338] * Ci[172] + Qi[338] * Cr[172]
+	+ Qr[330] * Ci[180] + Qi[330] * Cr[180]
+	+ Qr[326] * Ci[184] + Qi[326] * Cr[184]
+	+ Qr[306] * Ci[204] + Qi[306] * Cr[204]
+	+ Qr[298] * Ci[212] + Qi[298] * Cr[212]
+	+ Qr[294] * Ci[216] + Qi[294] * Cr[216]
+	+ Qr[282] * Ci[228] + Qi[282] * Cr[228]
+	+ Qr[278] * Ci[232] + Qi[278] * Cr[232]
+	+ Qr[270] * Ci[240] + Qi[270] * Cr[240]
+	+ Qr[226] * Ci[284] + Qi[226] * Cr[284]
+	+ Qr[210] * Ci[300] + Qi[210] * Cr[300]
+	+ Qr[202] * Ci[308] + Qi[202] * Cr[308]
+	+ Qr[198] * Ci[312] + Qi[198] * Cr[312]
+	+ Qr[178] * Ci[332] + Qi[178] * Cr[332]
+	+ Qr[170] * Ci[340] + Qi[170] * Cr[340]
+	+ Qr[166] * Ci[344] + Qi[166] * Cr[344]
+	+ Qr[154] * Ci[356] + Qi[154] * Cr[356]
+	+ Qr[150] * Ci[360] + Qi[150] * Cr[360]
+	+ Qr[142] * Ci[368] + Qi[142] * Cr[368]
+	+ Qr[114] * Ci[396] + Qi[114] * Cr[396]
+	+ Qr[106] * Ci[404] + Qi[106] * Cr[404]
+	+ Qr[102] * Ci[408] + Qi[102] * Cr[408]
+	+ Qr[90] * Ci[420] + Qi[90] * Cr[420]
+	+ Qr[86] * Ci[424] + Qi[86] * Cr[424]
+	+ Qr[78] * Ci[432] + Qi[78] * Cr[432]
+	+ Qr[58] * Ci[452] + Qi[58] * Cr[452]
+	+ Qr[54] * Ci[456] + Qi[54] * Cr[456]
+	+ Qr[46] * Ci[464] + Qi[46] * Cr[464]
+	+ Qr[30] * Ci[480] + Qi[30] * Cr[480]
+	- 4. * Ci[510];
+      Cr[510] =
+	Qr[386] * Cr[124] - Qi[386] * Ci[124]
+	+ Qr[322] * Cr[188] - Qi[322] * Ci[188]
+	+ Qr[290] * Cr[220] - Qi[290] * Ci[220]
+	+ Qr[274] * Cr[236] - Qi[274] * Ci[236]
+	+ Qr[266] * Cr[244] - Qi[266] * Ci[244]
+	+ Qr[262] * Cr[248] - Qi[262] * Ci[248]
+	+ Qr[194] * Cr[316] - Qi[194] * Ci[316]
+	+ Qr[162] * Cr[348] - Qi[162] * Ci[348]
+	+ Qr[146] * Cr[364] - Qi[146] * Ci[364]
+	+ Qr[138] * Cr[372] - Qi[138] * Ci[372]
+	+ Qr[134] * Cr[376] - Qi[134] * Ci[376]
+	+ Qr[98] * Cr[412] - Qi[98] * Ci[412]
+	+ Qr[82] * Cr[428] - Qi[82] * Ci[428]
+	+ Qr[74] * Cr[436] - Qi[74] * Ci[436]
+	+ Qr[70] * Cr[440] - Qi[70] * Ci[440]
+	+ Qr[50] * Cr[460] - Qi[50] * Ci[460]
+	+ Qr[42] * Cr[468] - Qi[42] * Ci[468]
+	+ Qr[38] * Cr[472] - Qi[38] * Ci[472]
+	+ Qr[26] * Cr[484] - Qi[26] * Ci[484]
+	+ Qr[22] * Cr[488] - Qi[22] * Ci[488]
+	+ Qr[14] * Cr[496] - Qi[14] * Ci[496]
+	- 3. * Cr[510];
+      Ci[510] =
+	Qr[386] * Ci[124] + Qi[386] * Cr[124]
+	+ Qr[322] * Ci[188] + Qi[322] * Cr[188]
+	+ Qr[290] * Ci[220] + Qi[290] * Cr[220]
+	+ Qr[274] * Ci[236] + Qi[274] * Cr[236]
+	+ Qr[266] * Ci[244] + Qi[266] * Cr[244]
+	+ Qr[262] * Ci[248] + Qi[262] * Cr[248]
+	+ Qr[194] * Ci[316] + Qi[194] * Cr[316]
+	+ Qr[162] * Ci[348] + Qi[162] * Cr[348]
+	+ Qr[146] * Ci[364] + Qi[146] * Cr[364]
+	+ Qr[138] * Ci[372] + Qi[138] * Cr[372]
+	+ Qr[134] * Ci[376] + Qi[134] * Cr[376]
+	+ Qr[98] * Ci[412] + Qi[98] * Cr[412]
+	+ Qr[82] * Ci[428] + Qi[82] * Cr[428]
+	+ Qr[74] * Ci[436] + Qi[74] * Cr[436]
+	+ Qr[70] * Ci[440] + Qi[70] * Cr[440]
+	+ Qr[50] * Ci[460] + Qi[50] * Cr[460]
+	+ Qr[42] * Ci[468] + Qi[42] * Cr[468]
+	+ Qr[38] * Ci[472] + Qi[38] * Cr[472]
+	+ Qr[26] * Ci[484] + Qi[26] * Cr[484]
+	+ Qr[22] * Ci[488] + Qi[22] * Cr[488]
+	+ Qr[14] * Ci[496] + Qi[14] * Cr[496]
+	- 3. * Ci[510];
+      Cr[510] =
+	Qr[258] * Cr[252] - Qi[258] * Ci[252]
+	+ Qr[130] * Cr[380] - Qi[130] * Ci[380]
+	+ Qr[66] * Cr[444] - Qi[66] * Ci[444]
+	+ Qr[34] * Cr[476] - Qi[34] * Ci[476]
+	+ Qr[18] * Cr[492] - Qi[18] * Ci[492]
+	+ Qr[10] * Cr[500] - Qi[10] * Ci[500]
+	+ Qr[6] * Cr[504] - Qi[6] * Ci[504]
+	- 2. * Cr[510];
+      Ci[510] =
+	Qr[258] * Ci[252] + Qi[258] * Cr[252]
+	+ Qr[130] * Ci[380] + Qi[130] * Cr[380]
+	+ Qr[66] * Ci[444] + Qi[66] * Cr[444]
+	+ Qr[34] * Ci[476] + Qi[34] * Cr[476]
+	+ Qr[18] * Ci[492] + Qi[18] * Cr[492]
+	+ Qr[10] * Ci[500] + Qi[10] * Cr[500]
+	+ Qr[6] * Ci[504] + Qi[6] * Cr[504]
+	- 2. * Ci[510];
+      Cr[510] =
+	Qr[2] * Cr[508] - Qi[2] * Ci[508]
+	- Cr[510];
+      Ci[510] =
+	Qr[2] * Ci[508] + Qi[2] * Cr[508]
+	- Ci[510];
+    }
+
+    /** Part 24 of expand9 */
+    inline CORRELATIONS_NOINLINE void
+    expand9Part24(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)
+    {
+      Cr[511] =
+	Qr[511];
+      Ci[511] =
+	Qi[511];
+      Cr[511] =
+	Qr[509] * Cr[2] - Qi[509] * Ci[2]
+	+ Qr[507] * Cr[4] - Qi[507] * Ci[4]
+	+ Qr[503] * Cr[8] - Qi[503] * Ci[8]
+	+ Qr[495] * Cr[16] - Qi[495] * Ci[16]
+	+ Qr[479] * Cr[32] - Qi[479] * Ci[32]
+	+ Qr[447] * Cr[64] - Qi[447] * Ci[64]
+	+ Qr[383] * Cr[128] - Qi[383] * Ci[128]
+	+ Qr[255] * Cr[256] - Qi[255] * Ci[256]
+	- 8. * Cr[511];
+      Ci[511] =
+	Qr[509] * Ci[2] + Qi[509] * Cr[2]
+	+ Qr[507] * Ci[4] + Qi[507] * Cr[4]
+	+ Qr[503] * Ci[8] + Qi[503] * Cr[8]
+	+ Qr[495] * Ci[16] + Qi[495] * Cr[16]
+	+ Qr[479] * Ci[32] + Qi[479] * Cr[32]
+	+ Qr[447] * Ci[64] + Qi[447] * Cr[64]
+	+ Qr[383] * Ci[128] + Qi[383] * Cr[128]
+	+ Qr[255] * Ci[256] + Qi[255] * Cr[256]
+	- 8. * Ci[511];
+      Cr[511] =
+	Qr[505] * Cr[6] - Qi[505] * Ci[6]
+	+ Qr[501] * Cr[10] - Qi[501] * Ci[10]
+	+ Qr[499] * Cr[12] - Qi[499] * Ci[12]
+	+ Qr[493] * Cr[18] - Qi[493] * Ci[18]
+	+ Qr[491] * Cr[20] - Qi[491] * Ci[20]
+	+ Qr[487] * Cr[24] - Qi[487] * Ci[24]
+	+ Qr[477] * Cr[34] - Qi[477] * Ci[34]
+	+ Qr[475] * Cr[36] - Qi[475] * Ci[36]
+	+ Qr[471] * Cr[40] - Qi[471] * Ci[40]
+	+ Qr[463] * Cr[48] - Qi[463] * Ci[48]
+	+ Qr[445] * Cr[66] - Qi[445] * Ci[66]
+	+ Qr[443] * Cr[68] - Qi[443] * Ci[68]
+	+ Qr[439] * Cr[72] - Qi[439] * Ci[72]
+	+ Qr[431] * Cr[80] - Qi[431] * Ci[80]
+	+ Qr[415] * Cr[96] - Qi[415] * Ci[96]
+	+ Qr[381] * Cr[130] - Qi[381] * Ci[130]
+	+ Qr[379] * Cr[132] - Qi[379] * Ci[132]
+	+ Qr[375] * Cr[136] - Qi[375] * Ci[136]
+	+ Qr[367] * Cr[144] - Qi[367] * Ci[144]
+	+ Qr[351] * Cr[160] - Qi[351] * Ci[160]
+	+ Qr[319] * Cr[192] - Qi[319] * Ci[192]
+	+ Qr[253] * Cr[258] - Qi[253] * Ci[258]
+	+ Qr[251] * Cr[260] - Qi[251] * Ci[260]
+	+ Qr[247] * Cr[264] - Qi[247] * Ci[264]
+	+ Qr[239] * Cr[272] - Qi[239] * Ci[272]
+	+ Qr[223] * Cr[288] - Qi[223] * Ci[288]
+	+ Qr[191] * Cr[320] - Qi[191] * Ci[320]
+	+ Qr[127] * Cr[384] - Qi[127] * Ci[384]
+	- 7. * Cr[511];
+      Ci[511] =
+	Qr[505] * Ci[6] + Qi[505] * Cr[6]
+	+ Qr[501] * Ci[10] + Qi[501] * Cr[10]
+	+ Qr[499] * Ci[12] + Qi[499] * Cr[12]
+	+ Qr[493] * Ci[18] + Qi[493] * Cr[18]
+	+ Qr[491] * Ci[20] + Qi[491] * Cr[20]
+	+ Qr[487] * Ci[24] + Qi[487] * Cr[24]
+	+ Qr[477] * Ci[34] + Qi[477] * Cr[34]
+	+ Qr[475] * Ci[36] + Qi[475] * Cr[36]
+	+ Qr[471] * Ci[40] + Qi[471] * Cr[40]
+	+ Qr[463] * Ci[48] + Qi[463] * Cr[48]
+	+ Qr[445] * Ci[66] + Qi[445] * Cr[66]
+	+ Qr[443] * Ci[68] + Qi[443] * Cr[68]
+	+ Qr[439] * Ci[72] + Qi[439] * Cr[72]
+	+ Qr[431] * Ci[80] + Qi[431] * Cr[80]
+	+ Qr[415] * Ci[96] + Qi[415] * Cr[96]
+	+ Qr[381] * Ci[130] + Qi[381] * Cr[130]
+	+ Qr[379] * Ci[132] + Qi[379] * Cr[132]
+	+ Qr[375] * Ci[136] + Qi[375] * Cr[136]
+	+ Qr[367] * Ci[144] + Qi[367] * Cr[144]
+	+ Qr[351] * Ci[160] + Qi[351] * Cr[160]
+	+ Qr[319] * Ci[192] + Qi[319] * Cr[192]
+	+ Qr[253] * Ci[258] + Qi[253] * Cr[258]
+	+ Qr[251] * Ci[260] + Qi[251] * Cr[260]
+	+ Qr[247] * Ci[264] + Qi[247] * Cr[264]
+	+ Qr[239] * Ci[272] + Qi[239] * Cr[272]
+	+ Qr[223] * Ci[288] + Qi[223] * Cr[288]
+	+ Qr[191] * Ci[320] + Qi[191] * Cr[320]
+	+ Qr[127] * Ci[384] + Qi[127] * Cr[384]
+	- 7. * Ci[511];
+      Cr[511] =
+	Qr[497] * Cr[14] - Qi[497] * Ci[14]
+	+ Qr[489] * Cr[22] - Qi[489] * Ci[22]
+	+ Qr[485] * Cr[26] - Qi[485] * Ci[26]
+	+ Qr[483] * Cr[28] - Qi[483] * Ci[28]
+	+ Qr[473] * Cr[38] - Qi[473] * Ci[38]
+	+ Qr[469] * Cr[42] - Qi[469] * Ci[42]
+	+ Qr[467] * Cr[44] - Qi[467] * Ci[44]
+	+ Qr[461] * Cr[50] - Qi[461] * Ci[50]
+	+ Qr[459] * Cr[52] - Qi[459] * Ci[52]
+	+ Qr[455] * Cr[56] - Qi[455] * Ci[56]
+	+ Qr[441] * Cr[70] - Qi[441] * Ci[70]
+	+ Qr[437] * Cr[74] - Qi[437] * Ci[74]
+	+ Qr[435] * Cr[76] - Qi[435] * Ci[76]
+	+ Qr[429] * Cr[82] - Qi[429] * Ci[82]
+	+ Qr[427] * Cr[84] - Qi[427] * Ci[84]
+	+ Qr[423] * Cr[88] - Qi[423] * Ci[88]
+	+ Qr[413] * Cr[98] - Qi[413] * Ci[98]
+	+ Qr[411] * Cr[100] - Qi[411] * Ci[100]
+	+ Qr[407] * Cr[104] - Qi[407] * Ci[104]
+	+ Qr[399] * Cr[112] - Qi[399] * Ci[112]
+	+ Qr[377] * Cr[134] - Qi[377] * Ci[134]
+	+ Qr[373] * Cr[138] - Qi[373] * Ci[138]
+	+ Qr[371] * Cr[140] - Qi[371] * Ci[140]
+	+ Qr[365] * Cr[146] - Qi[365] * Ci[146]
+	+ Qr[363] * Cr[148] - Qi[363] * Ci[148]
+	+ Qr[359] * Cr[152] - Qi[359] * Ci[152]
+	+ Qr[349] * Cr[162] - Qi[349] * Ci[162]
+	+ Qr[347] * Cr[164] - Qi[347] * Ci[164]
+	+ Qr[343] * Cr[168] - Qi[343] * Ci[168]
+	+ Qr[335] * Cr[176] - Qi[335] * Ci[176]
+	+ Qr[317] * Cr[194] - Qi[317] * Ci[194]
+	+ Qr[315] * Cr[196] - Qi[315] * Ci[196]
+	+ Qr[311] * Cr[200] - Qi[311] * Ci[200]
+	+ Qr[303] * Cr[208] - Qi[303] * Ci[208]
+	+ Qr[287] * Cr[224] - Qi[287] * Ci[224]
+	+ Qr[249] * Cr[262] - Qi[249] * Ci[262]
+	+ Qr[245] * Cr[266] - Qi[245] * Ci[266]
+	+ Qr[243] * Cr[268] - Qi[243] * Ci[268]
+	+ Qr[237] * Cr[274] - Qi[237] * Ci[274]
+	+ Qr[235] * Cr[276] - Qi[235] * Ci[276]
+	+ Qr[231] * Cr[280] - Qi[231] * Ci[280]
+	+ Qr[221] * Cr[290] - Qi[221] * Ci[290]
+	+ Qr[219] * Cr[292] - Qi[219] * Ci[292]
+	+ Qr[215] * Cr[296] - Qi[215] * Ci[296]
+	+ Qr[207] * Cr[304] - Qi[207] * Ci[304]
+	+ Qr[189] * Cr[322] - Qi[189] * Ci[322]
+	+ Qr[187] * Cr[324] - Qi[187] * Ci[324]
+	+ Qr[183] * Cr[328] - Qi[183] * Ci[328]
+	+ Qr[175] * Cr[336] - Qi[175] * Ci[336]
+	+ Qr[159] * Cr[352] - Qi[159] * Ci[352]
+	+ Qr[125] * Cr[386] - Qi[125] * Ci[386]
+	+ Qr[123] * Cr[388] - Qi[123] * Ci[388]
+	+ Qr[119] * Cr[392] - Qi[119] * Ci[392]
+	+ Qr[111] * Cr[400] - Qi[111] * Ci[400]
+	+ Qr[95] * Cr[416] - Qi[95] * Ci[416]
+	+ Qr[63] * Cr[448] - Qi[63] * Ci[448]
+	- 6. * Cr[511];
+      Ci[511] =
+	Qr[497] * Ci[14] + Qi[497] * Cr[14]
+	+ Qr[489] * Ci[22] + Qi[489] * Cr[22]
+	+ Qr[485] * Ci[26] + Qi[485] * Cr[26]
+	+ Qr[483] * Ci[28] + Qi[483] * Cr[28]
+	+ Qr[473] * Ci[38] + Qi[473] * Cr[38]
+	+ Qr[469] * Ci[42] + Qi[469] * Cr[42]
+	+ Qr[467] * Ci[44] + Qi[467] * Cr[44]
+	+ Qr[461] * Ci[50] + Qi[461] * Cr[50]
+	+ Qr[459] * Ci[52] + Qi[459] * Cr[52]
+	+ Qr[455] * Ci[56] + Qi[455] * Cr[56]
+	+ Qr[441] * Ci[70] + Qi[441] * Cr[70]
+	+ Qr[437] * Ci[74] + Qi[437] * Cr[74]
+	+ Qr[435] * Ci[76] + Qi[435] * Cr[76]
+	+ Qr[429] * Ci[82] + Qi[429] * Cr[82]
+	+ Qr[427] * Ci[84] + Qi[427] * Cr[84]
+	+ Qr[423] * Ci[88] + Qi[423] * Cr[88]
+	+ Qr[413] * Ci[98] + Qi[413] * Cr[98]
+	+ Qr[411] * Ci[100] + Qi[411] * Cr[100]
+	+ Qr[407] * Ci[104] + Qi[407] * Cr[104]
+	+ Qr[399] * Ci[112] + Qi[399] * Cr[112]
+	+ Qr[377] * Ci[134] + Qi[377] * Cr[134]
+	+ Qr[373] * Ci[138] + Qi[373] * Cr[138]
+	+ Qr[371] * Ci[140] + Qi[371] * Cr[140]
+	+ Qr[365] * Ci[146] + Qi[365] * Cr[146]
+	+ Qr[363] * Ci[148] + Qi[363] * Cr[148]
+	+ Qr[359] * Ci[152] + Qi[359] * Cr[152]
+	+ Qr[349] * Ci[162] + Qi[349] * Cr[162]
+	+ Qr[347] * Ci[164] + Qi[347] * Cr[164]
+	+ Qr[343] * Ci[168] + Qi[343] * Cr[168]
+	+ Qr[335] * Ci[176] + Qi[335] * Cr[176]
+	+ Qr[317] * Ci[194] + Qi[317] * Cr[194]
+	+ Qr[315] * Ci[196] + Qi[315] * Cr[196]
+	+ Qr[311] * Ci[200] + Qi[311] * Cr[200]
+	+ Qr[303] * Ci[208] + Qi[303] * Cr[208]
+	+ Qr[287] * Ci[224] + Qi[287] * Cr[224]
+	+ Qr[249] * Ci[262] + Qi[249] * Cr[262]
+	+ Qr[245] * Ci[266] + Qi[245] * Cr[266]
+	+ Qr[243] * Ci[268] + Qi[243] * Cr[268]
+	+ Qr[237] * Ci[274] + Qi[237] * Cr[274]
+	+ Qr[235] * Ci[276] + Qi[235] * Cr[276]
+	+ Qr[231] * Ci[280] + Qi[231] * Cr[280]
+	+ Qr[221] * Ci[290] + Qi[221] * Cr[290]
+	+ Qr[219] * Ci[292] + Qi[219] * Cr[292]
+	+ Qr[215] * Ci[296] + Qi[215] * Cr[296]
+	+ Qr[207] * Ci[304] + Qi[207] * Cr[304]
+	+ Qr[189] * Ci[322] + Qi[189] * Cr[322]
+	+ Qr[187] * Ci[324] + Qi[187] * Cr[324]
+	+ Qr[183] * Ci[328] + Qi[183] * Cr[328]
+	+ Qr[175] * Ci[336] + Qi[175] * Cr[336]
+	+ Qr[159] * Ci[352] + Qi[159] * Cr[352]
+	+ Qr[125] * Ci[386] + Qi[125] * Cr[386]
+	+ Qr[123] * Ci[388] + Qi[123] * Cr[388]
+	+ Qr[119] * Ci[392] + Qi[119] * Cr[392]
+	+ Qr[111] * Ci[400] + Qi[111] * Cr[400]
+	+ Qr[95] * Ci[416] + Qi[95] * Cr[416]
+	+ Qr[63] * Ci[448] + Qi[63] * Cr[448]
+	- 6. * Ci[511];
+      Cr[511] =
+	Qr[481] * Cr[30] - Qi[481] * Ci[30]
+	+ Qr[465] * Cr[46] - Qi[465] * Ci[46]
+	+ Qr[457] * Cr[54] - Qi[457] * Ci[54]
+	+ Qr[453] * Cr[58] - Qi[453] * Ci[58]
+	+ Qr[451] * Cr[60] - Qi[451] * Ci[60]
+	+ Qr[433] * Cr[78] - Qi[433] * Ci[78]
+	+ Qr[425] * Cr[86] - Qi[425] * Ci[86]
+	+ Qr[421] * Cr[90] - Qi[421] * Ci[90]
+	+ Qr[419] * Cr[92] - Qi[419] * Ci[92]
+	+ Qr[409] * Cr[102] - Qi[409] * Ci[102]
+	+ Qr[405] * Cr[106] - Qi[405] * Ci[106]
+	+ Qr[403] * Cr[108] - Qi[403] * Ci[108]
+	+ Qr[397] * Cr[114] - Qi[397] * Ci[114]
+	+ Qr[395] * Cr[116] - Qi[395] * Ci[116]
+	+ Qr[391] * Cr[120] - Qi[391] * Ci[120]
+	+ Qr[369] * Cr[142] - Qi[369] * Ci[142]
+	+ Qr[361] * Cr[150] - Qi[361] * Ci[150]
+	+ Qr[357] * Cr[154] - Qi[357] * Ci[154]
+	+ Qr[355] * Cr[156] - Qi[355] * Ci[156]
+	+ Qr[345] * Cr[166] - Qi[345] * Ci[166]
+	+ Qr[341] * Cr[170] - Qi[341] * Ci[170]
+	+ Qr[339] * Cr[172] - Qi[339] * Ci[172]
+	+ Qr[333] * Cr[178] - Qi[333] * Ci[178]
+	+ Qr[331] * Cr[180] - Qi[331] * Ci[180]
+	+ Qr[327] * Cr[184] - Qi[327] * Ci[184]
+	+ Qr[313] * Cr[198] - Qi[313] * Ci[198]
+	+ Qr[309] * Cr[202] - Qi[309] * Ci[202]
+	+ Qr[307] * Cr[204] - Qi[307] * Ci[204]
+	+ Qr[301] * Cr[210] - Qi[301] * Ci[210]
+	+ Qr[299] * Cr[212] - Qi[299] * Ci[212]
+	+ Qr[295] * Cr[216] - Qi[295] * Ci[216]
+	+ Qr[285] * Cr[226] - Qi[285] * Ci[226]
+	+ Qr[283] * Cr[228] - Qi[283] * Ci[228]
+	+ Qr[279] * Cr[232] - Qi[279] * Ci[232]
+	+ Qr[271] * Cr[240] - Qi[271] * Ci[240]
+	+ Qr[241] * Cr[270] - Qi[241] * Ci[270]
+	+ Qr[233] * Cr[278] - Qi[233] * Ci[278]
+	+ Qr[229] * Cr[282] - Qi[229] * Ci[282]
+	+ Qr[227] * Cr[284] - Qi[227] * Ci[284]
+	+ Qr[217] * Cr[294] - Qi[217] * Ci[294]
+	+ Qr[213] * Cr[298] - Qi[213] * Ci[298]
+	+ Qr[211] * Cr[300] - Qi[211] * Ci[300]
+	+ Qr[205] * Cr[306] - Qi[205] * Ci[306]
+	+ Qr[203] * Cr[308] - Qi[203] * Ci[308]
+	+ Qr[199] * Cr[312] - Qi[199] * Ci[312]
+	+ Qr[185] * Cr[326] - Qi[185] * Ci[326]
+	+ Qr[181] * Cr[330] - Qi[181] * Ci[330]
+	+ Qr[179] * Cr[332] - Qi[179] * Ci[332]
+	+ Qr[173] * Cr[338] - Qi[173] * Ci[338]
+	+ Qr[171] * Cr[340] - Qi[171] * Ci[340]
+	+ Qr[167] * Cr[344] - Qi[167] * Ci[344]
+	+ Qr[157] * Cr[354] - Qi[157] * Ci[354]
+	+ Qr[155] * Cr[356] - Qi[155] * Ci[356]
+	+ Qr[151] * Cr[360] - Qi[151] * Ci[360]
+	+ Qr[143] * Cr[368] - Qi[143] * Ci[368]
+	+ Qr[121] * Cr[390] - Qi[121] * Ci[390]
+	+ Qr[117] * Cr[394] - Qi[117] * Ci[394]
+	+ Qr[115] * Cr[396] - Qi[115] * Ci[396]
+	+ Qr[109] * Cr[402] - Qi[109] * Ci[402]
+	+ Qr[107] * Cr[404] - Qi[107] * Ci[404]
+	+ Qr[103] * Cr[408] - Qi[103] * Ci[408]
+	+ Qr[93] * Cr[418] - Qi[93] * Ci[418]
+	+ Qr[91] * Cr[420] - Qi[91] * Ci[420]
+	+ Qr[87] * Cr[424] - Qi[87] * Ci[424]
+	+ Qr[79] * Cr[432] - Qi[79] * Ci[432]
+	+ Qr[61] * Cr[450] - Qi[61] * Ci[450]
+	+ Qr[59] * Cr[452] - Qi[59] * Ci[452]
+	+ Qr[55] * Cr[456] - Qi[55] * Ci[456]
+	+ Qr[47] * Cr[464] - Qi[47] * Ci[464]
+	+ Qr[31] * Cr[480] - Qi[31] * Ci[480]
+	- 5. * Cr[511];
+      Ci[511] =
+	Qr[481] * Ci[30] + Qi[481] * Cr[30]
+	+ Qr[465] * Ci[46] + Qi[465] * Cr[46]
+	+ Qr[457] * Ci[54] + Qi[457] * Cr[54]
+	+ Qr[453] * Ci[58] + Qi[453] * Cr[58]
+	+ Qr[451] * Ci[60] + Qi[451] * Cr[60]
+	+ Qr[433] * Ci[78] + Qi[433] * Cr[78]
+	+ Qr[425] * Ci[86] + Qi[425] * Cr[86]
+	+ Qr[421] * Ci[90] + Qi[421] * Cr[90]
+	+ Qr[419] * Ci[92] + Qi[419] * Cr[92]
+	+ Qr[409] * Ci[102] + Qi[409] * Cr[102]
+	+ Qr[405] * Ci[106] + Qi[405] * Cr[106]
+	+ Qr[403] * Ci[108] + Qi[403] * Cr[108]
+	+ Qr[397] * Ci[114] + Qi[397] * Cr[114]
+	+ Qr[395] * Ci[116] + Qi[395] * Cr[116]
+	+ Qr[391] * Ci[120] + Qi[391] * Cr[120]
+	+ Qr[369] * Ci[142] + Qi[369] * Cr[142]
+	+ Qr[361] * Ci[150] + Qi[361] * Cr[150]
+	+ Qr[357] * Ci[154] + Qi[357] * Cr[154]
+	+ Qr[355] * Ci[156] + Qi[355] * Cr[156]
+	+ Qr[345] * Ci[166] + Qi[345] * Cr[166]
+	+ Qr[341] * Ci[170] + Qi[341] * Cr[170]
+	+ Qr[339] * Ci[172] + Qi[339] * Cr[172]
+	+ Qr[333] * Ci[178] + Qi[333] * Cr[178]
+	+ Qr[331] * Ci[180] + Qi[331] * Cr[180]
+	+ Qr[327] * Ci[184] + Qi[327] * Cr[184]
+	+ Qr[313] * Ci[198] + Qi[313] * Cr[198]
+	+ Qr[309] * Ci[202] + Qi[309] * Cr[202]
+	+ Qr[307] * Ci[204] + Qi[307] * Cr[204]
+	+ Qr[301] * Ci[210] + Qi[301] * Cr[210]
+	+ Qr[299] * Ci[212] + Qi[299] * Cr[212]
+	+ Qr[295] * Ci[216] + Qi[295] * Cr[216]
+	+ Qr[285] * Ci[226] + Qi[285] * Cr[226]
+	+ Qr[283] * Ci[228] + Qi[283] * Cr[228]
+	+ Qr[279] * Ci[232] + Qi[279] * Cr[232]
+	+ Qr[271] * Ci[240] + Qi[271] * Cr[240]
+	+ Qr[241] * Ci[270] + Qi[241] * Cr[270]
+	+ Qr[233] * Ci[278] + Qi[233] * Cr[278]
+	+ Qr[229] * Ci[282] + Qi[229] * Cr[282]
+	+ Qr[227] * Ci[284] + Qi[227] * Cr[284]
+	+ Qr[217] * Ci[294] + Qi[217] * Cr[294]
+	+ Qr[213] * Ci[298] + Qi[213] * Cr[298]
+	+ Qr[211] * Ci[300] + Qi[211] * Cr[300]
+	+ Qr[205] * Ci[306] + Qi[205] * Cr[306]
+	+ Qr[203] * Ci[308] + Qi[203] * Cr[308]
+	+ Qr[199] * Ci[312] + Qi[199] * Cr[312]
+	+ Qr[185] * Ci[326] + Qi[185] * Cr[326]
+	+ Qr[181] * Ci[330] + Qi[181] * Cr[330]
+	+ Qr[179] * Ci[332] + Qi[179] * Cr[332]
+	+ Qr[173] * Ci[338] + Qi[173] * Cr[338]
+	+ Qr[171] * Ci[340] + Qi[171] * Cr[340]
+	+ Qr[167] * Ci[344] + Qi[167] * Cr[344]
+	+ Qr[157] * Ci[354] + Qi[157] * Cr[354]
+	+ Qr[155] * Ci[356] + Qi[155] * Cr[356]
+	+ Qr[151] * Ci[360] + Qi[151] * Cr[360]
+	+ Qr[143] * Ci[368] + Qi[143] * Cr[368]
+	+ Qr[121] * Ci[390] + Qi[121] * Cr[390]
+	+ Qr[117] * Ci[394] + Qi[117] * Cr[394]
+	+ Qr[115] * Ci[396] + Qi[115] * Cr[396]
+	+ Qr[109] * Ci[402] + Qi[109] * Cr[402]
+	+ Qr[107] * Ci[404] + Qi[107] * Cr[404]
+	+ Qr[103] * Ci[408] + Qi[103] * Cr[408]
+	+ Qr[93] * Ci[418] + Qi[93] * Cr[418]
+	+ Qr[91] * Ci[420] + Qi[91] * Cr[420]
+	+ Qr[87] * Ci[424] + Qi[87] * Cr[424]
+	+ Qr[79] * Ci[432] + Qi[79] * Cr[432]
+	+ Qr[61] * Ci[450] + Qi[61] * Cr[450]
+	+ Qr[59] * Ci[452] + Qi[59] * Cr[452]
+	+ Qr[55] * Ci[456] + Qi[55] * Cr[456]
+	+ Qr[47] * Ci[464] + Qi[47] * Cr[464]
+	+ Qr[31] * Ci[480] + Qi[31] * Cr[480]
+	- 5. * Ci[511];
+      Cr[511] =
+	Qr[449] * Cr[62] - Qi[449] * Ci[62]
+	+ Qr[417] * Cr[94] - Qi[417] * Ci[94]
+	+ Qr[401] * Cr[110] - Qi[401] * Ci[110]
+	+ Qr[393] * Cr[118] - Qi[393] * Ci[118]
+	+ Qr[389] * Cr[122] - Qi[389] * Ci[122]
+	+ Qr[387] * Cr[124] - Qi[387] * Ci[124]
+	+ Qr[353] * Cr[158] - Qi[353] * Ci[158]
+	+ Qr[337] * Cr[174] - Qi[337] * Ci[174]
+	+ Qr[329] * Cr[182] - Qi[329] * Ci[182]
+	+ Qr[325] * Cr[186] - Qi[325] * Ci[186]
+	+ Qr[323] * Cr[188] - Qi[323] * Ci[188]
+	+ Qr[305] * Cr[206] - Qi[305] * Ci[206]
+	+ Qr[297] * Cr[214] - Qi[297] * Ci[214]
+	+ Qr[293] * Cr[218] - Qi[293] * Ci[218]
+	+ Qr[291] * Cr[220] - Qi[291] * Ci[220]
+	+ Qr[281] * Cr[230] - Qi[281] * Ci[230]
+	+ Qr[277] * Cr[234] - Qi[277] * Ci[234]
+	+ Qr[275] * Cr[236] - Qi[275] * Ci[236]
+	+ Qr[269] * Cr[242] - Qi[269] * Ci[242]
+	+ Qr[267] * Cr[244] - Qi[267] * Ci[244]
+	+ Qr[263] * Cr[248] - Qi[263] * Ci[248]
+	+ Qr[225] * Cr[286] - Qi[225] * Ci[286]
+	+ Qr[209] * Cr[302] - Qi[209] * Ci[302]
+	+ Qr[201] * Cr[310] - Qi[201] * Ci[310]
+	+ Qr[197] * Cr[314] - Qi[197] * Ci[314]
+	+ Qr[195] * Cr[316] - Qi[195] * Ci[316]
+	+ Qr[177] * Cr[334] - Qi[177] * Ci[334]
+	+ Qr[169] * Cr[342] - Qi[169] * Ci[342]
+	+ Qr[165] * Cr[346] - Qi[165] * Ci[346]
+	+ Qr[163] * Cr[348] - Qi[163] * Ci[348]
+	+ Qr[153] * Cr[358] - Qi[153] * Ci[358]
+	+ Qr[149] * Cr[362] - Qi[149] * Ci[362]
+	+ Qr[147] * Cr[364] - Qi[147] * Ci[364]
+	+ Qr[141] * Cr[370] - Qi[141] * Ci[370]
+	+ Qr[139] * Cr[372] - Qi[139] * Ci[372]
+	+ Qr[135] * Cr[376] - Qi[135] * Ci[376]
+	+ Qr[113] * Cr[398] - Qi[113] * Ci[398]
+	+ Qr[105] * Cr[406] - Qi[105] * Ci[406]
+	+ Qr[101] * Cr[410] - Qi[101] * Ci[410]
+	+ Qr[99] * Cr[412] - Qi[99] * Ci[412]
+	+ Qr[89] * Cr[422] - Qi[89] * Ci[422]
+	+ Qr[85] * Cr[426] - Qi[85] * Ci[426]
+	+ Qr[83] * Cr[428] - Qi[83] * Ci[428]
+	+ Qr[77] * Cr[434] - Qi[77] * Ci[434]
+	+ Qr[75] * Cr[436] - Qi[75] * Ci[436]
+	+ Qr[71] * Cr[440] - Qi[71] * Ci[440]
+	+ Qr[57] * Cr[454] - Qi[57] * Ci[454]
+	+ Qr[53] * Cr[458] - Qi[53] * Ci[458]
+	+ Qr[51] * Cr[460] - Qi[51] * Ci[460]
+	+ Qr[45] * Cr[466] - Qi[45] * Ci[466]
+	+ Qr[43] * Cr[468] - Qi[43] * Ci[468]
+	+ Qr[39] * Cr[472] - Qi[39] * Ci[472]
+	+ Qr[29] * Cr[482] - Qi[29] * Ci[482]
+	+ Qr[27] * Cr[484] - Qi[27] * Ci[484]
+	+ Qr[23] * Cr[488] - Qi[23] * Ci[488]
+	+ Qr[15] * Cr[496] - Qi[15] * Ci[496]
+	- 4. * Cr[511];
+      Ci[511] =
+	Qr[449] * Ci[62] + Qi[449] * Cr[62]
+	+ Qr[417] * Ci[94] + Qi[417] * Cr[94]
+	+ Qr[401] * Ci[110] + Qi[401] * Cr[110]
+	+ Qr[393] * Ci[118] + Qi[393] * Cr[118]
+	+ Qr[389] * Ci[122] + Qi[389] * Cr[122]
+	+ Qr[387] * Ci[124] + Qi[387] * Cr[124]
+	+ Qr[353] * Ci[158] + Qi[353] * Cr[158]
+	+ Qr[337] * Ci[174] + Qi[337] * Cr[174]
+	+ Qr[329] * Ci[182] + Qi[329] * Cr[182]
+	+ Qr[325] * Ci[186] + Qi[325] * Cr[186]
+	+ Qr[323] * Ci[188] + Qi[323] * Cr[188]
+	+ Qr[305] * Ci[206] + Qi[305] * Cr[206]
+	+ Qr[297] * Ci[214] + Qi[297] * Cr[214]
+	+ Qr[293] * Ci[218] + Qi[293] * Cr[218]
+	+ Qr[291] * Ci[220] + Qi[291] * Cr[220]
+	+ Qr[281] * Ci[230] + Qi[281] * Cr[230]
+	+ Qr[277] * Ci[234] + Qi[277] * Cr[234]
+	+ Qr[275] * Ci[236] + Qi[275] * Cr[236]
+	+ Qr[269] * Ci[242] + Qi[269] * Cr[242]
+	+ Qr[267] * Ci[244] + Qi[267] * Cr[244]
+	+ Qr[263] * Ci[248] + Qi[263] * Cr[248]
+	+ Qr[225] * Ci[286] + Qi[225] * Cr[286]
+	+ Qr[209] * Ci[302] + Qi[209] * Cr[302]
+	+ Qr[201] * Ci[310] + Qi[201] * Cr[310]
+	+ Qr[197] * Ci[314] + Qi[197] * Cr[314]
+	+ Qr[195] * Ci[316] + Qi[195] * Cr[316]
+	+ Qr[177] * Ci[334] + Qi[177] * Cr[334]
+	+ Qr[169] * Ci[342] + Qi[169] * Cr[342]
+	+ Qr[165] * Ci[346] + Qi[165] * Cr[346]
+	+ Qr[163] * Ci[348] + Qi[163] * Cr[348]
+	+ Qr[153] * Ci[358] + Qi[153] * Cr[358]
+	+ Qr[149] * Ci[362] + Qi[149] * Cr[362]
+	+ Qr[147] * Ci[364] + Qi[147] * Cr[364]
+	+ Qr[141] * Ci[370] + Qi[141] * Cr[370]
+	+ Qr[139] * Ci[372] + Qi[139] * Cr[372]
+	+ Qr[135] * Ci[376] + Qi[135] * Cr[376]
+	+ Qr[113] * Ci[398] + Qi[113] * Cr[398]
+	+ Qr[105] * Ci[406] + Qi[105] * Cr[406]
+	+ Qr[101] * Ci[410] + Qi[101] * Cr[410]
+	+ Qr[99] * Ci[412] + Qi[99] * Cr[412]
+	+ Qr[89] * Ci[422] + Qi[89] * Cr[422]
+	+ Qr[85] * Ci[426] + Qi[85] * Cr[426]
+	+ Qr[83] * Ci[428] + Qi[83] * Cr[428]
+	+ Qr[77] * Ci[434] + Qi[77] * Cr[434]
+	+ Qr[75] * Ci[436] + Qi[75] * Cr[436]
+	+ Qr[71] * Ci[440] + Qi[71] * Cr[440]
+	+ Qr[57] * Ci[454] + Qi[57] * Cr[454]
+	+ Qr[53] * Ci[458] + Qi[53] * Cr[458]
+	+ Qr[51] * Ci[460] + Qi[51] * Cr[460]
+	+ Qr[45] * Ci[466] + Qi[45] * Cr[466]
+	+ Qr[43] * Ci[468] + Qi[43] * Cr[468]
+	+ Qr[39] * Ci[472] + Qi[39] * Cr[472]
+	+ Qr[29] * Ci[482] + Qi[29] * Cr[482]
+	+ Qr[27] * Ci[484] + Qi[27] * Cr[484]
+	+ Qr[23] * Ci[488] + Qi[23] * Cr[488]
+	+ Qr[15] * Ci[496] + Qi[15] * Cr[496]
+	- 4. * Ci[511];
+      Cr[511] =
+	Qr[385] * Cr[126] - Qi[385] * Ci[126]
+	+ Qr[321] * Cr[190] - Qi[321] * Ci[190]
+	+ Qr[289] * Cr[222] - Qi[289] * Ci[222]
+	+ Qr[273] * Cr[238] - Qi[273] * Ci[238]
+	+ Qr[265] * Cr[246] - Qi[265] * Ci[246]
+	+ Qr[261] * Cr[250] - Qi[261] * Ci[250]
+	+ Qr[259] * Cr[252] - Qi[259] * Ci[252]
+	+ Qr[193] * Cr[318] - Qi[193] * Ci[318]
+	+ Qr[161] * Cr[350] - Qi[161] * Ci[350]
+	+ Qr[145] * Cr[366] - Qi[145] * Ci[366]
+	+ Qr[137] * Cr[374] - Qi[137] * Ci[374]
+	+ Qr[133] * Cr[378] - Qi[133] * Ci[378]
+	+ Qr[131] * Cr[380] - Qi[131] * Ci[380]
+	+ Qr[97] * Cr[414] - Qi[97] * Ci[414]
+	+ Qr[81] * Cr[430] - Qi[81] * Ci[430]
+	+ Qr[73] * Cr[438] - Qi[73] * Ci[438]
+	+ Qr[69] * Cr[442] - Qi[69] * Ci[442]
+	+ Qr[67] * Cr[444] - Qi[67] * Ci[444]
+	+ Qr[49] * Cr[462] - Qi[49] * Ci[462]
+	+ Qr[41] * Cr[470] - Qi[41] * Ci[470]
+	+ Qr[37] * Cr[474] - Qi[37] * Ci[474]
+	+ Qr[35] * Cr[476] - Qi[35] * Ci[476]
+	+ Qr[25] * Cr[486] - Qi[25] * Ci[486]
+	+ Qr[21] * Cr[490] - Qi[21] * Ci[490]
+	+ Qr[19] * Cr[492] - Qi[19] * Ci[492]
+	+ Qr[13] * Cr[498] - Qi[13] * Ci[498]
+	+ Qr[11] * Cr[500] - Qi[11] * Ci[500]
+	+ Qr[7] * Cr[504] - Qi[7] * Ci[504]
+	- 3. * Cr[511];
+      Ci[511] =
+	Qr[385] * Ci[126] + Qi[385] * Cr[126]
+	+ Qr[321] * Ci[190] + Qi[321] * Cr[190]
+	+ Qr[289] * Ci[222] + Qi[289] * Cr[222]
+	+ Qr[273] * Ci[238] + Qi[273] * Cr[238]
+	+ Qr[265] * Ci[246] + Qi[265] * Cr[246]
+	+ Qr[261] * Ci[250] + Qi[261] * Cr[250]
+	+ Qr[259] * Ci[252] + Qi[259] * Cr[252]
+	+ Qr[193] * Ci[318] + Qi[193] * Cr[318]
+	+ Qr[161] * Ci[350] + Qi[161] * Cr[350]
+	+ Qr[145] * Ci[366] + Qi[145] * Cr[366]
+	+ Qr[137] * Ci[374] + Qi[137] * Cr[374]
+	+ Qr[133] * Ci[378] + Qi[133] * Cr[378]
+	+ Qr[131] * Ci[380] + Qi[131] * Cr[380]
+	+ Qr[97] * Ci[414] + Qi[97] * Cr[414]
+	+ Qr[81] * Ci[430] + Qi[81] * Cr[430]
+	+ Qr[73] * Ci[438] + Qi[73] * Cr[438]
+	+ Qr[69] * Ci[442] + Qi[69] * Cr[442]
+	+ Qr[67] * Ci[444] + Qi[67] * Cr[444]
+	+ Qr[49] * Ci[462] + Qi[49] * Cr[462]
+	+ Qr[41] * Ci[470] + Qi[41] * Cr[470]
+	+ Qr[37] * Ci[474] + Qi[37] * Cr[474]
+	+ Qr[35] * Ci[476] + Qi[35] * Cr[476]
+	+ Qr[25] * Ci[486] + Qi[25] * Cr[486]
+	+ Qr[21] * Ci[490] + Qi[21] * Cr[490]
+	+ Qr[19] * Ci[492] + Qi[19] * Cr[492]
+	+ Qr[13] * Ci[498] + Qi[13] * Cr[498]
+	+ Qr[11] * Ci[500] + Qi[11] * Cr[500]
+	+ Qr[7] * Ci[504] + Qi[7] * Cr[504]
+	- 3. * Ci[511];
+      Cr[511] =
+	Qr[257] * Cr[254] - Qi[257] * Ci[254]
+	+ Qr[129] * Cr[382] - Qi[129] * Ci[382]
+	+ Qr[65] * Cr[446] - Qi[65] * Ci[446]
+	+ Qr[33] * Cr[478] - Qi[33] * Ci[478]
+	+ Qr[17] * Cr[494] - Qi[17] * Ci[494]
+	+ Qr[9] * Cr[502] - Qi[9] * Ci[502]
+	+ Qr[5] * Cr[506] - Qi[5] * Ci[506]
+	+ Qr[3] * Cr[508] - Qi[3] * Ci[508]
+	- 2. * Cr[511];
+      Ci[511] =
+	Qr[257] * Ci[254] + Qi[257] * Cr[254]
+	+ Qr[129] * Ci[382] + Qi[129] * Cr[382]
+	+ Qr[65] * Ci[446] + Qi[65] * Cr[446]
+	+ Qr[33] * Ci[478] + Qi[33] * Cr[478]
+	+ Qr[17] * Ci[494] + Qi[17] * Cr[494]
+	+ Qr[9] * Ci[502] + Qi[9] * Cr[502]
+	+ Qr[5] * Ci[506] + Qi[5] * Cr[506]
+	+ Qr[3] * Ci[508] + Qi[3] * Cr[508]
+	- 2. * Ci[511];
+      Cr[511] =
+	Qr[1] * Cr[510] - Qi[1] * Ci[510]
+	- Cr[511];
+      Ci[511] =
+	Qr[1] * Ci[510] + Qi[1] * Cr[510]
+	- Ci[511];
+    }
+
+    /**
+     * @param q Q-vector
+     * @param h Harmonics (at least 9)
+     *
+     * @return @f$ QC\{9\}@f$
+     */
+    CORRELATIONS_KERNEL Complex expand9(const QVector& q, const Harmonic* h)
+    {
+      Real    Qr[512], Qi[512];
+      Real    Cr[512], Ci[512];
+      Complex z;
+      z = q(h[0], 1); Qr[1] = z.real(); Qi[1] = z.imag();
+      z = q(h[1], 1); Qr[2] = z.real(); Qi[2] = z.imag();
+      z = q(h[0]+h[1], 2); Qr[3] = z.real(); Qi[3] = z.imag();
+      z = q(h[2], 1); Qr[4] = z.real(); Qi[4] = z.imag();
+      z = q(h[0]+h[2], 2); Qr[5] = z.real(); Qi[5] = z.imag();
+      z = q(h[1]+h[2], 2); Qr[6] = z.real(); Qi[6] = z.imag();
+      z = q(h[0]+h[1]+h[2], 3); Qr[7] = z.real(); Qi[7] = z.imag();
+      z = q(h[3], 1); Qr[8] = z.real(); Qi[8] = z.imag();
+      z = q(h[0]+h[3], 2); Qr[9] = z.real(); Qi[9] = z.imag();
+      z = q(h[1]+h[3], 2); Qr[10] = z.real(); Qi[10] = z.imag();
+      z = q(h[0]+h[1]+h[3], 3); Qr[11] = z.real(); Qi[11] = z.imag();
+      z = q(h[2]+h[3], 2); Qr[12] = z.real(); Qi[12] = z.imag();
+      z = q(h[0]+h[2]+h[3], 3); Qr[13] = z.real(); Qi[13] = z.imag();
+      z = q(h[1]+h[2]+h[3], 3); Qr[14] = z.real(); Qi[14] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3], 4); Qr[15] = z.real(); Qi[15] = z.imag();
+      z = q(h[4], 1); Qr[16] = z.real(); Qi[16] = z.imag();
+      z = q(h[0]+h[4], 2); Qr[17] = z.real(); Qi[17] = z.imag();
+      z = q(h[1]+h[4], 2); Qr[18] = z.real(); Qi[18] = z.imag();
+      z = q(h[0]+h[1]+h[4], 3); Qr[19] = z.real(); Qi[19] = z.imag();
+      z = q(h[2]+h[4], 2); Qr[20] = z.real(); Qi[20] = z.imag();
+      z = q(h[0]+h[2]+h[4], 3); Qr[21] = z.real(); Qi[21] = z.imag();
+      z = q(h[1]+h[2]+h[4], 3); Qr[22] = z.real(); Qi[22] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4], 4); Qr[23] = z.real(); Qi[23] = z.imag();
+      z = q(h[3]+h[4], 2); Qr[24] = z.real(); Qi[24] = z.imag();
+      z = q(h[0]+h[3]+h[4], 3); Qr[25] = z.real(); Qi[25] = z.imag();
+      z = q(h[1]+h[3]+h[4], 3); Qr[26] = z.real(); Qi[26] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4], 4); Qr[27] = z.real(); Qi[27] = z.imag();
+      z = q(h[2]+h[3]+h[4], 3); Qr[28] = z.real(); Qi[28] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4], 4); Qr[29] = z.real(); Qi[29] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4], 4); Qr[30] = z.real(); Qi[30] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4], 5); Qr[31] = z.real(); Qi[31] = z.imag();
+      z = q(h[5], 1); Qr[32] = z.real(); Qi[32] = z.imag();
+      z = q(h[0]+h[5], 2); Qr[33] = z.real(); Qi[33] = z.imag();
+      z = q(h[1]+h[5], 2); Qr[34] = z.real(); Qi[34] = z.imag();
+      z = q(h[0]+h[1]+h[5], 3); Qr[35] = z.real(); Qi[35] = z.imag();
+      z = q(h[2]+h[5], 2); Qr[36] = z.real(); Qi[36] = z.imag();
+      z = q(h[0]+h[2]+h[5], 3); Qr[37] = z.real(); Qi[37] = z.imag();
+      z = q(h[1]+h[2]+h[5], 3); Qr[38] = z.real(); Qi[38] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[5], 4); Qr[39] = z.real(); Qi[39] = z.imag();
+      z = q(h[3]+h[5], 2); Qr[40] = z.real(); Qi[40] = z.imag();
+      z = q(h[0]+h[3]+h[5], 3); Qr[41] = z.real(); Qi[41] = z.imag();
+      z = q(h[1]+h[3]+h[5], 3); Qr[42] = z.real(); Qi[42] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[5], 4); Qr[43] = z.real(); Qi[43] = z.imag();
+      z = q(h[2]+h[3]+h[5], 3); Qr[44] = z.real(); Qi[44] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[5], 4); Qr[45] = z.real(); Qi[45] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[5], 4); Qr[46] = z.real(); Qi[46] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[5], 5); Qr[47] = z.real(); Qi[47] = z.imag();
+      z = q(h[4]+h[5], 2); Qr[48] = z.real(); Qi[48] = z.imag();
+      z = q(h[0]+h[4]+h[5], 3); Qr[49] = z.real(); Qi[49] = z.imag();
+      z = q(h[1]+h[4]+h[5], 3); Qr[50] = z.real(); Qi[50] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[5], 4); Qr[51] = z.real(); Qi[51] = z.imag();
+      z = q(h[2]+h[4]+h[5], 3); Qr[52] = z.real(); Qi[52] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[5], 4); Qr[53] = z.real(); Qi[53] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[5], 4); Qr[54] = z.real(); Qi[54] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[5], 5); Qr[55] = z.real(); Qi[55] = z.imag();
+      z = q(h[3]+h[4]+h[5], 3); Qr[56] = z.real(); Qi[56] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[5], 4); Qr[57] = z.real(); Qi[57] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[5], 4); Qr[58] = z.real(); Qi[58] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[5], 5); Qr[59] = z.real(); Qi[59] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[5], 4); Qr[60] = z.real(); Qi[60] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[5], 5); Qr[61] = z.real(); Qi[61] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[5], 5); Qr[62] = z.real(); Qi[62] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[5], 6); Qr[63] = z.real(); Qi[63] = z.imag();
+      z = q(h[6], 1); Qr[64] = z.real(); Qi[64] = z.imag();
+      z = q(h[0]+h[6], 2); Qr[65] = z.real(); Qi[65] = z.imag();
+      z = q(h[1]+h[6], 2); Qr[66] = z.real(); Qi[66] = z.imag();
+      z = q(h[0]+h[1]+h[6], 3); Qr[67] = z.real(); Qi[67] = z.imag();
+      z = q(h[2]+h[6], 2); Qr[68] = z.real(); Qi[68] = z.imag();
+      z = q(h[0]+h[2]+h[6], 3); Qr[69] = z.real(); Qi[69] = z.imag();
+      z = q(h[1]+h[2]+h[6], 3); Qr[70] = z.real(); Qi[70] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[6], 4); Qr[71] = z.real(); Qi[71] = z.imag();
+      z = q(h[3]+h[6], 2); Qr[72] = z.real(); Qi[72] = z.imag();
+      z = q(h[0]+h[3]+h[6], 3); Qr[73] = z.real(); Qi[73] = z.imag();
+      z = q(h[1]+h[3]+h[6], 3); Qr[74] = z.real(); Qi[74] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[6], 4); Qr[75] = z.real(); Qi[75] = z.imag();
+      z = q(h[2]+h[3]+h[6], 3); Qr[76] = z.real(); Qi[76] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[6], 4); Qr[77] = z.real(); Qi[77] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[6], 4); Qr[78] = z.real(); Qi[78] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[6], 5); Qr[79] = z.real(); Qi[79] = z.imag();
+      z = q(h[4]+h[6], 2); Qr[80] = z.real(); Qi[80] = z.imag();
+      z = q(h[0]+h[4]+h[6], 3); Qr[81] = z.real(); Qi[81] = z.imag();
+      z = q(h[1]+h[4]+h[6], 3); Qr[82] = z.real(); Qi[82] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[6], 4); Qr[83] = z.real(); Qi[83] = z.imag();
+      z = q(h[2]+h[4]+h[6], 3); Qr[84] = z.real(); Qi[84] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[6], 4); Qr[85] = z.real(); Qi[85] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[6], 4); Qr[86] = z.real(); Qi[86] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[6], 5); Qr[87] = z.real(); Qi[87] = z.imag();
+      z = q(h[3]+h[4]+h[6], 3); Qr[88] = z.real(); Qi[88] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[6], 4); Qr[89] = z.real(); Qi[89] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[6], 4); Qr[90] = z.real(); Qi[90] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[6], 5); Qr[91] = z.real(); Qi[91] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[6], 4); Qr[92] = z.real(); Qi[92] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[6], 5); Qr[93] = z.real(); Qi[93] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[6], 5); Qr[94] = z.real(); Qi[94] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[6], 6); Qr[95] = z.real(); Qi[95] = z.imag();
+      z = q(h[5]+h[6], 2); Qr[96] = z.real(); Qi[96] = z.imag();
+      z = q(h[0]+h[5]+h[6], 3); Qr[97] = z.real(); Qi[97] = z.imag();
+      z = q(h[1]+h[5]+h[6], 3); Qr[98] = z.real(); Qi[98] = z.imag();
+      z = q(h[0]+h[1]+h[5]+h[6], 4); Qr[99] = z.real(); Qi[99] = z.imag();
+      z = q(h[2]+h[5]+h[6], 3); Qr[100] = z.real(); Qi[100] = z.imag();
+      z = q(h[0]+h[2]+h[5]+h[6], 4); Qr[101] = z.real(); Qi[101] = z.imag();
+      z = q(h[1]+h[2]+h[5]+h[6], 4); Qr[102] = z.real(); Qi[102] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[5]+h[6], 5); Qr[103] = z.real(); Qi[103] = z.imag();
+      z = q(h[3]+h[5]+h[6], 3); Qr[104] = z.real(); Qi[104] = z.imag();
+      z = q(h[0]+h[3]+h[5]+h[6], 4); Qr[105] = z.real(); Qi[105] = z.imag();
+      z = q(h[1]+h[3]+h[5]+h[6], 4); Qr[106] = z.real(); Qi[106] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[5]+h[6], 5); Qr[107] = z.real(); Qi[107] = z.imag();
+      z = q(h[2]+h[3]+h[5]+h[6], 4); Qr[108] = z.real(); Qi[108] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[5]+h[6], 5); Qr[109] = z.real(); Qi[109] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[5]+h[6], 5); Qr[110] = z.real(); Qi[110] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[5]+h[6], 6); Qr[111] = z.real(); Qi[111] = z.imag();
+      z = q(h[4]+h[5]+h[6], 3); Qr[112] = z.real(); Qi[112] = z.imag();
+      z = q(h[0]+h[4]+h[5]+h[6], 4); Qr[113] = z.real(); Qi[113] = z.imag();
+      z = q(h[1]+h[4]+h[5]+h[6], 4); Qr[114] = z.real(); Qi[114] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[5]+h[6], 5); Qr[115] = z.real(); Qi[115] = z.imag();
+      z = q(h[2]+h[4]+h[5]+h[6], 4); Qr[116] = z.real(); Qi[116] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[5]+h[6], 5); Qr[117] = z.real(); Qi[117] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[5]+h[6], 5); Qr[118] = z.real(); Qi[118] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[5]+h[6], 6); Qr[119] = z.real(); Qi[119] = z.imag();
+      z = q(h[3]+h[4]+h[5]+h[6], 4); Qr[120] = z.real(); Qi[120] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[5]+h[6], 5); Qr[121] = z.real(); Qi[121] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[5]+h[6], 5); Qr[122] = z.real(); Qi[122] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[5]+h[6], 6); Qr[123] = z.real(); Qi[123] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[5]+h[6], 5); Qr[124] = z.real(); Qi[124] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[5]+h[6], 6); Qr[125] = z.real(); Qi[125] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[5]+h[6], 6); Qr[126] = z.real(); Qi[126] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[5]+h[6], 7); Qr[127] = z.real(); Qi[127] = z.imag();
+      z = q(h[7], 1); Qr[128] = z.real(); Qi[128] = z.imag();
+      z = q(h[0]+h[7], 2); Qr[129] = z.real(); Qi[129] = z.imag();
+      z = q(h[1]+h[7], 2); Qr[130] = z.real(); Qi[130] = z.imag();
+      z = q(h[0]+h[1]+h[7], 3); Qr[131] = z.real(); Qi[131] = z.imag();
+      z = q(h[2]+h[7], 2); Qr[132] = z.real(); Qi[132] = z.imag();
+      z = q(h[0]+h[2]+h[7], 3); Qr[133] = z.real(); Qi[133] = z.imag();
+      z = q(h[1]+h[2]+h[7], 3); Qr[134] = z.real(); Qi[134] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[7], 4); Qr[135] = z.real(); Qi[135] = z.imag();
+      z = q(h[3]+h[7], 2); Qr[136] = z.real(); Qi[136] = z.imag();
+      z = q(h[0]+h[3]+h[7], 3); Qr[137] = z.real(); Qi[137] = z.imag();
+      z = q(h[1]+h[3]+h[7], 3); Qr[138] = z.real(); Qi[138] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[7], 4); Qr[139] = z.real(); Qi[139] = z.imag();
+      z = q(h[2]+h[3]+h[7], 3); Qr[140] = z.real(); Qi[140] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[7], 4); Qr[141] = z.real(); Qi[141] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[7], 4); Qr[142] = z.real(); Qi[142] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[7], 5); Qr[143] = z.real(); Qi[143] = z.imag();
+      z = q(h[4]+h[7], 2); Qr[144] = z.real(); Qi[144] = z.imag();
+      z = q(h[0]+h[4]+h[7], 3); Qr[145] = z.real(); Qi[145] = z.imag();
+      z = q(h[1]+h[4]+h[7], 3); Qr[146] = z.real(); Qi[146] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[7], 4); Qr[147] = z.real(); Qi[147] = z.imag();
+      z = q(h[2]+h[4]+h[7], 3); Qr[148] = z.real(); Qi[148] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[7], 4); Qr[149] = z.real(); Qi[149] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[7], 4); Qr[150] = z.real(); Qi[150] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[7], 5); Qr[151] = z.real(); Qi[151] = z.imag();
+      z = q(h[3]+h[4]+h[7], 3); Qr[152] = z.real(); Qi[152] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[7], 4); Qr[153] = z.real(); Qi[153] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[7], 4); Qr[154] = z.real(); Qi[154] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[7], 5); Qr[155] = z.real(); Qi[155] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[7], 4); Qr[156] = z.real(); Qi[156] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[7], 5); Qr[157] = z.real(); Qi[157] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[7], 5); Qr[158] = z.real(); Qi[158] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[7], 6); Qr[159] = z.real(); Qi[159] = z.imag();
+      z = q(h[5]+h[7], 2); Qr[160] = z.real(); Qi[160] = z.imag();
+      z = q(h[0]+h[5]+h[7], 3); Qr[161] = z.real(); Qi[161] = z.imag();
+      z = q(h[1]+h[5]+h[7], 3); Qr[162] = z.real(); Qi[162] = z.imag();
+      z = q(h[0]+h[1]+h[5]+h[7], 4); Qr[163] = z.real(); Qi[163] = z.imag();
+      z = q(h[2]+h[5]+h[7], 3); Qr[164] = z.real(); Qi[164] = z.imag();
+      z = q(h[0]+h[2]+h[5]+h[7], 4); Qr[165] = z.real(); Qi[165] = z.imag();
+      z = q(h[1]+h[2]+h[5]+h[7], 4); Qr[166] = z.real(); Qi[166] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[5]+h[7], 5); Qr[167] = z.real(); Qi[167] = z.imag();
+      z = q(h[3]+h[5]+h[7], 3); Qr[168] = z.real(); Qi[168] = z.imag();
+      z = q(h[0]+h[3]+h[5]+h[7], 4); Qr[169] = z.real(); Qi[169] = z.imag();
+      z = q(h[1]+h[3]+h[5]+h[7], 4); Qr[170] = z.real(); Qi[170] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[5]+h[7], 5); Qr[171] = z.real(); Qi[171] = z.imag();
+      z = q(h[2]+h[3]+h[5]+h[7], 4); Qr[172] = z.real(); Qi[172] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[5]+h[7], 5); Qr[173] = z.real(); Qi[173] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[5]+h[7], 5); Qr[174] = z.real(); Qi[174] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[5]+h[7], 6); Qr[175] = z.real(); Qi[175] = z.imag();
+      z = q(h[4]+h[5]+h[7], 3); Qr[176] = z.real(); Qi[176] = z.imag();
+      z = q(h[0]+h[4]+h[5]+h[7], 4); Qr[177] = z.real(); Qi[177] = z.imag();
+      z = q(h[1]+h[4]+h[5]+h[7], 4); Qr[178] = z.real(); Qi[178] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[5]+h[7], 5); Qr[179] = z.real(); Qi[179] = z.imag();
+      z = q(h[2]+h[4]+h[5]+h[7], 4); Qr[180] = z.real(); Qi[180] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[5]+h[7], 5); Qr[181] = z.real(); Qi[181] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[5]+h[7], 5); Qr[182] = z.real(); Qi[182] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[5]+h[7], 6); Qr[183] = z.real(); Qi[183] = z.imag();
+      z = q(h[3]+h[4]+h[5]+h[7], 4); Qr[184] = z.real(); Qi[184] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[5]+h[7], 5); Qr[185] = z.real(); Qi[185] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[5]+h[7], 5); Qr[186] = z.real(); Qi[186] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[5]+h[7], 6); Qr[187] = z.real(); Qi[187] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[5]+h[7], 5); Qr[188] = z.real(); Qi[188] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[5]+h[7], 6); Qr[189] = z.real(); Qi[189] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[5]+h[7], 6); Qr[190] = z.real(); Qi[190] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[5]+h[7], 7); Qr[191] = z.real(); Qi[191] = z.imag();
+      z = q(h[6]+h[7], 2); Qr[192] = z.real(); Qi[192] = z.imag();
+      z = q(h[0]+h[6]+h[7], 3); Qr[193] = z.real(); Qi[193] = z.imag();
+      z = q(h[1]+h[6]+h[7], 3); Qr[194] = z.real(); Qi[194] = z.imag();
+      z = q(h[0]+h[1]+h[6]+h[7], 4); Qr[195] = z.real(); Qi[195] = z.imag();
+      z = q(h[2]+h[6]+h[7], 3); Qr[196] = z.real(); Qi[196] = z.imag();
+      z = q(h[0]+h[2]+h[6]+h[7], 4); Qr[197] = z.real(); Qi[197] = z.imag();
+      z = q(h[1]+h[2]+h[6]+h[7], 4); Qr[198] = z.real(); Qi[198] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[6]+h[7], 5); Qr[199] = z.real(); Qi[199] = z.imag();
+      z = q(h[3]+h[6]+h[7], 3); Qr[200] = z.real(); Qi[200] = z.imag();
+      z = q(h[0]+h[3]+h[6]+h[7], 4); Qr[201] = z.real(); Qi[201] = z.imag();
+      z = q(h[1]+h[3]+h[6]+h[7], 4); Qr[202] = z.real(); Qi[202] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[6]+h[7], 5); Qr[203] = z.real(); Qi[203] = z.imag();
+      z = q(h[2]+h[3]+h[6]+h[7], 4); Qr[204] = z.real(); Qi[204] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[6]+h[7], 5); Qr[205] = z.real(); Qi[205] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[6]+h[7], 5); Qr[206] = z.real(); Qi[206] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[6]+h[7], 6); Qr[207] = z.real(); Qi[207] = z.imag();
+      z = q(h[4]+h[6]+h[7], 3); Qr[208] = z.real(); Qi[208] = z.imag();
+      z = q(h[0]+h[4]+h[6]+h[7], 4); Qr[209] = z.real(); Qi[209] = z.imag();
+      z = q(h[1]+h[4]+h[6]+h[7], 4); Qr[210] = z.real(); Qi[210] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[6]+h[7], 5); Qr[211] = z.real(); Qi[211] = z.imag();
+      z = q(h[2]+h[4]+h[6]+h[7], 4); Qr[212] = z.real(); Qi[212] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[6]+h[7], 5); Qr[213] = z.real(); Qi[213] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[6]+h[7], 5); Qr[214] = z.real(); Qi[214] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[6]+h[7], 6); Qr[215] = z.real(); Qi[215] = z.imag();
+      z = q(h[3]+h[4]+h[6]+h[7], 4); Qr[216] = z.real(); Qi[216] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[6]+h[7], 5); Qr[217] = z.real(); Qi[217] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[6]+h[7], 5); Qr[218] = z.real(); Qi[218] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[6]+h[7], 6); Qr[219] = z.real(); Qi[219] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[6]+h[7], 5); Qr[220] = z.real(); Qi[220] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[6]+h[7], 6); Qr[221] = z.real(); Qi[221] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[6]+h[7], 6); Qr[222] = z.real(); Qi[222] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[6]+h[7], 7); Qr[223] = z.real(); Qi[223] = z.imag();
+      z = q(h[5]+h[6]+h[7], 3); Qr[224] = z.real(); Qi[224] = z.imag();
+      z = q(h[0]+h[5]+h[6]+h[7], 4); Qr[225] = z.real(); Qi[225] = z.imag();
+      z = q(h[1]+h[5]+h[6]+h[7], 4); Qr[226] = z.real(); Qi[226] = z.imag();
+      z = q(h[0]+h[1]+h[5]+h[6]+h[7], 5); Qr[227] = z.real(); Qi[227] = z.imag();
+      z = q(h[2]+h[5]+h[6]+h[7], 4); Qr[228] = z.real(); Qi[228] = z.imag();
+      z = q(h[0]+h[2]+h[5]+h[6]+h[7], 5); Qr[229] = z.real(); Qi[229] = z.imag();
+      z = q(h[1]+h[2]+h[5]+h[6]+h[7], 5); Qr[230] = z.real(); Qi[230] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[5]+h[6]+h[7], 6); Qr[231] = z.real(); Qi[231] = z.imag();
+      z = q(h[3]+h[5]+h[6]+h[7], 4); Qr[232] = z.real(); Qi[232] = z.imag();
+      z = q(h[0]+h[3]+h[5]+h[6]+h[7], 5); Qr[233] = z.real(); Qi[233] = z.imag();
+      z = q(h[1]+h[3]+h[5]+h[6]+h[7], 5); Qr[234] = z.real(); Qi[234] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[5]+h[6]+h[7], 6); Qr[235] = z.real(); Qi[235] = z.imag();
+      z = q(h[2]+h[3]+h[5]+h[6]+h[7], 5); Qr[236] = z.real(); Qi[236] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[5]+h[6]+h[7], 6); Qr[237] = z.real(); Qi[237] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[5]+h[6]+h[7], 6); Qr[238] = z.real(); Qi[238] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[5]+h[6]+h[7], 7); Qr[239] = z.real(); Qi[239] = z.imag();
+      z = q(h[4]+h[5]+h[6]+h[7], 4); Qr[240] = z.real(); Qi[240] = z.imag();
+      z = q(h[0]+h[4]+h[5]+h[6]+h[7], 5); Qr[241] = z.real(); Qi[241] = z.imag();
+      z = q(h[1]+h[4]+h[5]+h[6]+h[7], 5); Qr[242] = z.real(); Qi[242] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[5]+h[6]+h[7], 6); Qr[243] = z.real(); Qi[243] = z.imag();
+      z = q(h[2]+h[4]+h[5]+h[6]+h[7], 5); Qr[244] = z.real(); Qi[244] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[5]+h[6]+h[7], 6); Qr[245] = z.real(); Qi[245] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[5]+h[6]+h[7], 6); Qr[246] = z.real(); Qi[246] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[5]+h[6]+h[7], 7); Qr[247] = z.real(); Qi[247] = z.imag();
+      z = q(h[3]+h[4]+h[5]+h[6]+h[7], 5); Qr[248] = z.real(); Qi[248] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[5]+h[6]+h[7], 6); Qr[249] = z.real(); Qi[249] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[5]+h[6]+h[7], 6); Qr[250] = z.real(); Qi[250] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[5]+h[6]+h[7], 7); Qr[251] = z.real(); Qi[251] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[5]+h[6]+h[7], 6); Qr[252] = z.real(); Qi[252] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[5]+h[6]+h[7], 7); Qr[253] = z.real(); Qi[253] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[5]+h[6]+h[7], 7); Qr[254] = z.real(); Qi[254] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[5]+h[6]+h[7], 8); Qr[255] = z.real(); Qi[255] = z.imag();
+      z = q(h[8], 1); Qr[256] = z.real(); Qi[256] = z.imag();
+      z = q(h[0]+h[8], 2); Qr[257] = z.real(); Qi[257] = z.imag();
+      z = q(h[1]+h[8], 2); Qr[258] = z.real(); Qi[258] = z.imag();
+      z = q(h[0]+h[1]+h[8], 3); Qr[259] = z.real(); Qi[259] = z.imag();
+      z = q(h[2]+h[8], 2); Qr[260] = z.real(); Qi[260] = z.imag();
+      z = q(h[0]+h[2]+h[8], 3); Qr[261] = z.real(); Qi[261] = z.imag();
+      z = q(h[1]+h[2]+h[8], 3); Qr[262] = z.real(); Qi[262] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[8], 4); Qr[263] = z.real(); Qi[263] = z.imag();
+      z = q(h[3]+h[8], 2); Qr[264] = z.real(); Qi[264] = z.imag();
+      z = q(h[0]+h[3]+h[8], 3); Qr[265] = z.real(); Qi[265] = z.imag();
+      z = q(h[1]+h[3]+h[8], 3); Qr[266] = z.real(); Qi[266] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[8], 4); Qr[267] = z.real(); Qi[267] = z.imag();
+      z = q(h[2]+h[3]+h[8], 3); Qr[268] = z.real(); Qi[268] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[8], 4); Qr[269] = z.real(); Qi[269] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[8], 4); Qr[270] = z.real(); Qi[270] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[8], 5); Qr[271] = z.real(); Qi[271] = z.imag();
+      z = q(h[4]+h[8], 2); Qr[272] = z.real(); Qi[272] = z.imag();
+      z = q(h[0]+h[4]+h[8], 3); Qr[273] = z.real(); Qi[273] = z.imag();
+      z = q(h[1]+h[4]+h[8], 3); Qr[274] = z.real(); Qi[274] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[8], 4); Qr[275] = z.real(); Qi[275] = z.imag();
+      z = q(h[2]+h[4]+h[8], 3); Qr[276] = z.real(); Qi[276] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[8], 4); Qr[277] = z.real(); Qi[277] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[8], 4); Qr[278] = z.real(); Qi[278] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[8], 5); Qr[279] = z.real(); Qi[279] = z.imag();
+      z = q(h[3]+h[4]+h[8], 3); Qr[280] = z.real(); Qi[280] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[8], 4); Qr[281] = z.real(); Qi[281] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[8], 4); Qr[282] = z.real(); Qi[282] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[8], 5); Qr[283] = z.real(); Qi[283] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[8], 4); Qr[284] = z.real(); Qi[284] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[8], 5); Qr[285] = z.real(); Qi[285] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[8], 5); Qr[286] = z.real(); Qi[286] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[8], 6); Qr[287] = z.real(); Qi[287] = z.imag();
+      z = q(h[5]+h[8], 2); Qr[288] = z.real(); Qi[288] = z.imag();
+      z = q(h[0]+h[5]+h[8], 3); Qr[289] = z.real(); Qi[289] = z.imag();
+      z = q(h[1]+h[5]+h[8], 3); Qr[290] = z.real(); Qi[290] = z.imag();
+      z = q(h[0]+h[1]+h[5]+h[8], 4); Qr[291] = z.real(); Qi[291] = z.imag();
+      z = q(h[2]+h[5]+h[8], 3); Qr[292] = z.real(); Qi[292] = z.imag();
+      z = q(h[0]+h[2]+h[5]+h[8], 4); Qr[293] = z.real(); Qi[293] = z.imag();
+      z = q(h[1]+h[2]+h[5]+h[8], 4); Qr[294] = z.real(); Qi[294] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[5]+h[8], 5); Qr[295] = z.real(); Qi[295] = z.imag();
+      z = q(h[3]+h[5]+h[8], 3); Qr[296] = z.real(); Qi[296] = z.imag();
+      z = q(h[0]+h[3]+h[5]+h[8], 4); Qr[297] = z.real(); Qi[297] = z.imag();
+      z = q(h[1]+h[3]+h[5]+h[8], 4); Qr[298] = z.real(); Qi[298] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[5]+h[8], 5); Qr[299] = z.real(); Qi[299] = z.imag();
+      z = q(h[2]+h[3]+h[5]+h[8], 4); Qr[300] = z.real(); Qi[300] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[5]+h[8], 5); Qr[301] = z.real(); Qi[301] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[5]+h[8], 5); Qr[302] = z.real(); Qi[302] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[5]+h[8], 6); Qr[303] = z.real(); Qi[303] = z.imag();
+      z = q(h[4]+h[5]+h[8], 3); Qr[304] = z.real(); Qi[304] = z.imag();
+      z = q(h[0]+h[4]+h[5]+h[8], 4); Qr[305] = z.real(); Qi[305] = z.imag();
+      z = q(h[1]+h[4]+h[5]+h[8], 4); Qr[306] = z.real(); Qi[306] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[5]+h[8], 5); Qr[307] = z.real(); Qi[307] = z.imag();
+      z = q(h[2]+h[4]+h[5]+h[8], 4); Qr[308] = z.real(); Qi[308] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[5]+h[8], 5); Qr[309] = z.real(); Qi[309] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[5]+h[8], 5); Qr[310] = z.real(); Qi[310] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[5]+h[8], 6); Qr[311] = z.real(); Qi[311] = z.imag();
+      z = q(h[3]+h[4]+h[5]+h[8], 4); Qr[312] = z.real(); Qi[312] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[5]+h[8], 5); Qr[313] = z.real(); Qi[313] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[5]+h[8], 5); Qr[314] = z.real(); Qi[314] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[5]+h[8], 6); Qr[315] = z.real(); Qi[315] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[5]+h[8], 5); Qr[316] = z.real(); Qi[316] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[5]+h[8], 6); Qr[317] = z.real(); Qi[317] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[5]+h[8], 6); Qr[318] = z.real(); Qi[318] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[5]+h[8], 7); Qr[319] = z.real(); Qi[319] = z.imag();
+      z = q(h[6]+h[8], 2); Qr[320] = z.real(); Qi[320] = z.imag();
+      z = q(h[0]+h[6]+h[8], 3); Qr[321] = z.real(); Qi[321] = z.imag();
+      z = q(h[1]+h[6]+h[8], 3); Qr[322] = z.real(); Qi[322] = z.imag();
+      z = q(h[0]+h[1]+h[6]+h[8], 4); Qr[323] = z.real(); Qi[323] = z.imag();
+      z = q(h[2]+h[6]+h[8], 3); Qr[324] = z.real(); Qi[324] = z.imag();
+      z = q(h[0]+h[2]+h[6]+h[8], 4); Qr[325] = z.real(); Qi[325] = z.imag();
+      z = q(h[1]+h[2]+h[6]+h[8], 4); Qr[326] = z.real(); Qi[326] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[6]+h[8], 5); Qr[327] = z.real(); Qi[327] = z.imag();
+      z = q(h[3]+h[6]+h[8], 3); Qr[328] = z.real(); Qi[328] = z.imag();
+      z = q(h[0]+h[3]+h[6]+h[8], 4); Qr[329] = z.real(); Qi[329] = z.imag();
+      z = q(h[1]+h[3]+h[6]+h[8], 4); Qr[330] = z.real(); Qi[330] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[6]+h[8], 5); Qr[331] = z.real(); Qi[331] = z.imag();
+      z = q(h[2]+h[3]+h[6]+h[8], 4); Qr[332] = z.real(); Qi[332] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[6]+h[8], 5); Qr[333] = z.real(); Qi[333] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[6]+h[8], 5); Qr[334] = z.real(); Qi[334] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[6]+h[8], 6); Qr[335] = z.real(); Qi[335] = z.imag();
+      z = q(h[4]+h[6]+h[8], 3); Qr[336] = z.real(); Qi[336] = z.imag();
+      z = q(h[0]+h[4]+h[6]+h[8], 4); Qr[337] = z.real(); Qi[337] = z.imag();
+      z = q(h[1]+h[4]+h[6]+h[8], 4); Qr[338] = z.real(); Qi[338] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[6]+h[8], 5); Qr[339] = z.real(); Qi[339] = z.imag();
+      z = q(h[2]+h[4]+h[6]+h[8], 4); Qr[340] = z.real(); Qi[340] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[6]+h[8], 5); Qr[341] = z.real(); Qi[341] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[6]+h[8], 5); Qr[342] = z.real(); Qi[342] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[6]+h[8], 6); Qr[343] = z.real(); Qi[343] = z.imag();
+      z = q(h[3]+h[4]+h[6]+h[8], 4); Qr[344] = z.real(); Qi[344] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[6]+h[8], 5); Qr[345] = z.real(); Qi[345] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[6]+h[8], 5); Qr[346] = z.real(); Qi[346] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[6]+h[8], 6); Qr[347] = z.real(); Qi[347] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[6]+h[8], 5); Qr[348] = z.real(); Qi[348] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[6]+h[8], 6); Qr[349] = z.real(); Qi[349] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[6]+h[8], 6); Qr[350] = z.real(); Qi[350] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[6]+h[8], 7); Qr[351] = z.real(); Qi[351] = z.imag();
+      z = q(h[5]+h[6]+h[8], 3); Qr[352] = z.real(); Qi[352] = z.imag();
+      z = q(h[0]+h[5]+h[6]+h[8], 4); Qr[353] = z.real(); Qi[353] = z.imag();
+      z = q(h[1]+h[5]+h[6]+h[8], 4); Qr[354] = z.real(); Qi[354] = z.imag();
+      z = q(h[0]+h[1]+h[5]+h[6]+h[8], 5); Qr[355] = z.real(); Qi[355] = z.imag();
+      z = q(h[2]+h[5]+h[6]+h[8], 4); Qr[356] = z.real(); Qi[356] = z.imag();
+      z = q(h[0]+h[2]+h[5]+h[6]+h[8], 5); Qr[357] = z.real(); Qi[357] = z.imag();
+      z = q(h[1]+h[2]+h[5]+h[6]+h[8], 5); Qr[358] = z.real(); Qi[358] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[5]+h[6]+h[8], 6); Qr[359] = z.real(); Qi[359] = z.imag();
+      z = q(h[3]+h[5]+h[6]+h[8], 4); Qr[360] = z.real(); Qi[360] = z.imag();
+      z = q(h[0]+h[3]+h[5]+h[6]+h[8], 5); Qr[361] = z.real(); Qi[361] = z.imag();
+      z = q(h[1]+h[3]+h[5]+h[6]+h[8], 5); Qr[362] = z.real(); Qi[362] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[5]+h[6]+h[8], 6); Qr[363] = z.real(); Qi[363] = z.imag();
+      z = q(h[2]+h[3]+h[5]+h[6]+h[8], 5); Qr[364] = z.real(); Qi[364] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[5]+h[6]+h[8], 6); Qr[365] = z.real(); Qi[365] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[5]+h[6]+h[8], 6); Qr[366] = z.real(); Qi[366] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[5]+h[6]+h[8], 7); Qr[367] = z.real(); Qi[367] = z.imag();
+      z = q(h[4]+h[5]+h[6]+h[8], 4); Qr[368] = z.real(); Qi[368] = z.imag();
+      z = q(h[0]+h[4]+h[5]+h[6]+h[8], 5); Qr[369] = z.real(); Qi[369] = z.imag();
+      z = q(h[1]+h[4]+h[5]+h[6]+h[8], 5); Qr[370] = z.real(); Qi[370] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[5]+h[6]+h[8], 6); Qr[371] = z.real(); Qi[371] = z.imag();
+      z = q(h[2]+h[4]+h[5]+h[6]+h[8], 5); Qr[372] = z.real(); Qi[372] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[5]+h[6]+h[8], 6); Qr[373] = z.real(); Qi[373] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[5]+h[6]+h[8], 6); Qr[374] = z.real(); Qi[374] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[5]+h[6]+h[8], 7); Qr[375] = z.real(); Qi[375] = z.imag();
+      z = q(h[3]+h[4]+h[5]+h[6]+h[8], 5); Qr[376] = z.real(); Qi[376] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[5]+h[6]+h[8], 6); Qr[377] = z.real(); Qi[377] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[5]+h[6]+h[8], 6); Qr[378] = z.real(); Qi[378] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[5]+h[6]+h[8], 7); Qr[379] = z.real(); Qi[379] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[5]+h[6]+h[8], 6); Qr[380] = z.real(); Qi[380] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[5]+h[6]+h[8], 7); Qr[381] = z.real(); Qi[381] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[5]+h[6]+h[8], 7); Qr[382] = z.real(); Qi[382] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[5]+h[6]+h[8], 8); Qr[383] = z.real(); Qi[383] = z.imag();
+      z = q(h[7]+h[8], 2); Qr[384] = z.real(); Qi[384] = z.imag();
+      z = q(h[0]+h[7]+h[8], 3); Qr[385] = z.real(); Qi[385] = z.imag();
+      z = q(h[1]+h[7]+h[8], 3); Qr[386] = z.real(); Qi[386] = z.imag();
+      z = q(h[0]+h[1]+h[7]+h[8], 4); Qr[387] = z.real(); Qi[387] = z.imag();
+      z = q(h[2]+h[7]+h[8], 3); Qr[388] = z.real(); Qi[388] = z.imag();
+      z = q(h[0]+h[2]+h[7]+h[8], 4); Qr[389] = z.real(); Qi[389] = z.imag();
+      z = q(h[1]+h[2]+h[7]+h[8], 4); Qr[390] = z.real(); Qi[390] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[7]+h[8], 5); Qr[391] = z.real(); Qi[391] = z.imag();
+      z = q(h[3]+h[7]+h[8], 3); Qr[392] = z.real(); Qi[392] = z.imag();
+      z = q(h[0]+h[3]+h[7]+h[8], 4); Qr[393] = z.real(); Qi[393] = z.imag();
+      z = q(h[1]+h[3]+h[7]+h[8], 4); Qr[394] = z.real(); Qi[394] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[7]+h[8], 5); Qr[395] = z.real(); Qi[395] = z.imag();
+      z = q(h[2]+h[3]+h[7]+h[8], 4); Qr[396] = z.real(); Qi[396] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[7]+h[8], 5); Qr[397] = z.real(); Qi[397] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[7]+h[8], 5); Qr[398] = z.real(); Qi[398] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[7]+h[8], 6); Qr[399] = z.real(); Qi[399] = z.imag();
+      z = q(h[4]+h[7]+h[8], 3); Qr[400] = z.real(); Qi[400] = z.imag();
+      z = q(h[0]+h[4]+h[7]+h[8], 4); Qr[401] = z.real(); Qi[401] = z.imag();
+      z = q(h[1]+h[4]+h[7]+h[8], 4); Qr[402] = z.real(); Qi[402] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[7]+h[8], 5); Qr[403] = z.real(); Qi[403] = z.imag();
+      z = q(h[2]+h[4]+h[7]+h[8], 4); Qr[404] = z.real(); Qi[404] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[7]+h[8], 5); Qr[405] = z.real(); Qi[405] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[7]+h[8], 5); Qr[406] = z.real(); Qi[406] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[7]+h[8], 6); Qr[407] = z.real(); Qi[407] = z.imag();
+      z = q(h[3]+h[4]+h[7]+h[8], 4); Qr[408] = z.real(); Qi[408] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[7]+h[8], 5); Qr[409] = z.real(); Qi[409] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[7]+h[8], 5); Qr[410] = z.real(); Qi[410] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[7]+h[8], 6); Qr[411] = z.real(); Qi[411] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[7]+h[8], 5); Qr[412] = z.real(); Qi[412] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[7]+h[8], 6); Qr[413] = z.real(); Qi[413] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[7]+h[8], 6); Qr[414] = z.real(); Qi[414] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[7]+h[8], 7); Qr[415] = z.real(); Qi[415] = z.imag();
+      z = q(h[5]+h[7]+h[8], 3); Qr[416] = z.real(); Qi[416] = z.imag();
+      z = q(h[0]+h[5]+h[7]+h[8], 4); Qr[417] = z.real(); Qi[417] = z.imag();
+      z = q(h[1]+h[5]+h[7]+h[8], 4); Qr[418] = z.real(); Qi[418] = z.imag();
+      z = q(h[0]+h[1]+h[5]+h[7]+h[8], 5); Qr[419] = z.real(); Qi[419] = z.imag();
+      z = q(h[2]+h[5]+h[7]+h[8], 4); Qr[420] = z.real(); Qi[420] = z.imag();
+      z = q(h[0]+h[2]+h[5]+h[7]+h[8], 5); Qr[421] = z.real(); Qi[421] = z.imag();
+      z = q(h[1]+h[2]+h[5]+h[7]+h[8], 5); Qr[422] = z.real(); Qi[422] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[5]+h[7]+h[8], 6); Qr[423] = z.real(); Qi[423] = z.imag();
+      z = q(h[3]+h[5]+h[7]+h[8], 4); Qr[424] = z.real(); Qi[424] = z.imag();
+      z = q(h[0]+h[3]+h[5]+h[7]+h[8], 5); Qr[425] = z.real(); Qi[425] = z.imag();
+      z = q(h[1]+h[3]+h[5]+h[7]+h[8], 5); Qr[426] = z.real(); Qi[426] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[5]+h[7]+h[8], 6); Qr[427] = z.real(); Qi[427] = z.imag();
+      z = q(h[2]+h[3]+h[5]+h[7]+h[8], 5); Qr[428] = z.real(); Qi[428] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[5]+h[7]+h[8], 6); Qr[429] = z.real(); Qi[429] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[5]+h[7]+h[8], 6); Qr[430] = z.real(); Qi[430] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[5]+h[7]+h[8], 7); Qr[431] = z.real(); Qi[431] = z.imag();
+      z = q(h[4]+h[5]+h[7]+h[8], 4); Qr[432] = z.real(); Qi[432] = z.imag();
+      z = q(h[0]+h[4]+h[5]+h[7]+h[8], 5); Qr[433] = z.real(); Qi[433] = z.imag();
+      z = q(h[1]+h[4]+h[5]+h[7]+h[8], 5); Qr[434] = z.real(); Qi[434] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[5]+h[7]+h[8], 6); Qr[435] = z.real(); Qi[435] = z.imag();
+      z = q(h[2]+h[4]+h[5]+h[7]+h[8], 5); Qr[436] = z.real(); Qi[436] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[5]+h[7]+h[8], 6); Qr[437] = z.real(); Qi[437] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[5]+h[7]+h[8], 6); Qr[438] = z.real(); Qi[438] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[5]+h[7]+h[8], 7); Qr[439] = z.real(); Qi[439] = z.imag();
+      z = q(h[3]+h[4]+h[5]+h[7]+h[8], 5); Qr[440] = z.real(); Qi[440] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[5]+h[7]+h[8], 6); Qr[441] = z.real(); Qi[441] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[5]+h[7]+h[8], 6); Qr[442] = z.real(); Qi[442] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[5]+h[7]+h[8], 7); Qr[443] = z.real(); Qi[443] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[5]+h[7]+h[8], 6); Qr[444] = z.real(); Qi[444] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[5]+h[7]+h[8], 7); Qr[445] = z.real(); Qi[445] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[5]+h[7]+h[8], 7); Qr[446] = z.real(); Qi[446] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[5]+h[7]+h[8], 8); Qr[447] = z.real(); Qi[447] = z.imag();
+      z = q(h[6]+h[7]+h[8], 3); Qr[448] = z.real(); Qi[448] = z.imag();
+      z = q(h[0]+h[6]+h[7]+h[8], 4); Qr[449] = z.real(); Qi[449] = z.imag();
+      z = q(h[1]+h[6]+h[7]+h[8], 4); Qr[450] = z.real(); Qi[450] = z.imag();
+      z = q(h[0]+h[1]+h[6]+h[7]+h[8], 5); Qr[451] = z.real(); Qi[451] = z.imag();
+      z = q(h[2]+h[6]+h[7]+h[8], 4); Qr[452] = z.real(); Qi[452] = z.imag();
+      z = q(h[0]+h[2]+h[6]+h[7]+h[8], 5); Qr[453] = z.real(); Qi[453] = z.imag();
+      z = q(h[1]+h[2]+h[6]+h[7]+h[8], 5); Qr[454] = z.real(); Qi[454] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[6]+h[7]+h[8], 6); Qr[455] = z.real(); Qi[455] = z.imag();
+      z = q(h[3]+h[6]+h[7]+h[8], 4); Qr[456] = z.real(); Qi[456] = z.imag();
+      z = q(h[0]+h[3]+h[6]+h[7]+h[8], 5); Qr[457] = z.real(); Qi[457] = z.imag();
+      z = q(h[1]+h[3]+h[6]+h[7]+h[8], 5); Qr[458] = z.real(); Qi[458] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[6]+h[7]+h[8], 6); Qr[459] = z.real(); Qi[459] = z.imag();
+      z = q(h[2]+h[3]+h[6]+h[7]+h[8], 5); Qr[460] = z.real(); Qi[460] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[6]+h[7]+h[8], 6); Qr[461] = z.real(); Qi[461] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[6]+h[7]+h[8], 6); Qr[462] = z.real(); Qi[462] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[6]+h[7]+h[8], 7); Qr[463] = z.real(); Qi[463] = z.imag();
+      z = q(h[4]+h[6]+h[7]+h[8], 4); Qr[464] = z.real(); Qi[464] = z.imag();
+      z = q(h[0]+h[4]+h[6]+h[7]+h[8], 5); Qr[465] = z.real(); Qi[465] = z.imag();
+      z = q(h[1]+h[4]+h[6]+h[7]+h[8], 5); Qr[466] = z.real(); Qi[466] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[6]+h[7]+h[8], 6); Qr[467] = z.real(); Qi[467] = z.imag();
+      z = q(h[2]+h[4]+h[6]+h[7]+h[8], 5); Qr[468] = z.real(); Qi[468] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[6]+h[7]+h[8], 6); Qr[469] = z.real(); Qi[469] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[6]+h[7]+h[8], 6); Qr[470] = z.real(); Qi[470] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[6]+h[7]+h[8], 7); Qr[471] = z.real(); Qi[471] = z.imag();
+      z = q(h[3]+h[4]+h[6]+h[7]+h[8], 5); Qr[472] = z.real(); Qi[472] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[6]+h[7]+h[8], 6); Qr[473] = z.real(); Qi[473] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[6]+h[7]+h[8], 6); Qr[474] = z.real(); Qi[474] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[6]+h[7]+h[8], 7); Qr[475] = z.real(); Qi[475] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[6]+h[7]+h[8], 6); Qr[476] = z.real(); Qi[476] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[6]+h[7]+h[8], 7); Qr[477] = z.real(); Qi[477] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[6]+h[7]+h[8], 7); Qr[478] = z.real(); Qi[478] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[6]+h[7]+h[8], 8); Qr[479] = z.real(); Qi[479] = z.imag();
+      z = q(h[5]+h[6]+h[7]+h[8], 4); Qr[480] = z.real(); Qi[480] = z.imag();
+      z = q(h[0]+h[5]+h[6]+h[7]+h[8], 5); Qr[481] = z.real(); Qi[481] = z.imag();
+      z = q(h[1]+h[5]+h[6]+h[7]+h[8], 5); Qr[482] = z.real(); Qi[482] = z.imag();
+      z = q(h[0]+h[1]+h[5]+h[6]+h[7]+h[8], 6); Qr[483] = z.real(); Qi[483] = z.imag();
+      z = q(h[2]+h[5]+h[6]+h[7]+h[8], 5); Qr[484] = z.real(); Qi[484] = z.imag();
+      z = q(h[0]+h[2]+h[5]+h[6]+h[7]+h[8], 6); Qr[485] = z.real(); Qi[485] = z.imag();
+      z = q(h[1]+h[2]+h[5]+h[6]+h[7]+h[8], 6); Qr[486] = z.real(); Qi[486] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[5]+h[6]+h[7]+h[8], 7); Qr[487] = z.real(); Qi[487] = z.imag();
+      z = q(h[3]+h[5]+h[6]+h[7]+h[8], 5); Qr[488] = z.real(); Qi[488] = z.imag();
+      z = q(h[0]+h[3]+h[5]+h[6]+h[7]+h[8], 6); Qr[489] = z.real(); Qi[489] = z.imag();
+      z = q(h[1]+h[3]+h[5]+h[6]+h[7]+h[8], 6); Qr[490] = z.real(); Qi[490] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[5]+h[6]+h[7]+h[8], 7); Qr[491] = z.real(); Qi[491] = z.imag();
+      z = q(h[2]+h[3]+h[5]+h[6]+h[7]+h[8], 6); Qr[492] = z.real(); Qi[492] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[5]+h[6]+h[7]+h[8], 7); Qr[493] = z.real(); Qi[493] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[5]+h[6]+h[7]+h[8], 7); Qr[494] = z.real(); Qi[494] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[5]+h[6]+h[7]+h[8], 8); Qr[495] = z.real(); Qi[495] = z.imag();
+      z = q(h[4]+h[5]+h[6]+h[7]+h[8], 5); Qr[496] = z.real(); Qi[496] = z.imag();
+      z = q(h[0]+h[4]+h[5]+h[6]+h[7]+h[8], 6); Qr[497] = z.real(); Qi[497] = z.imag();
+      z = q(h[1]+h[4]+h[5]+h[6]+h[7]+h[8], 6); Qr[498] = z.real(); Qi[498] = z.imag();
+      z = q(h[0]+h[1]+h[4]+h[5]+h[6]+h[7]+h[8], 7); Qr[499] = z.real(); Qi[499] = z.imag();
+      z = q(h[2]+h[4]+h[5]+h[6]+h[7]+h[8], 6); Qr[500] = z.real(); Qi[500] = z.imag();
+      z = q(h[0]+h[2]+h[4]+h[5]+h[6]+h[7]+h[8], 7); Qr[501] = z.real(); Qi[501] = z.imag();
+      z = q(h[1]+h[2]+h[4]+h[5]+h[6]+h[7]+h[8], 7); Qr[502] = z.real(); Qi[502] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[4]+h[5]+h[6]+h[7]+h[8], 8); Qr[503] = z.real(); Qi[503] = z.imag();
+      z = q(h[3]+h[4]+h[5]+h[6]+h[7]+h[8], 6); Qr[504] = z.real(); Qi[504] = z.imag();
+      z = q(h[0]+h[3]+h[4]+h[5]+h[6]+h[7]+h[8], 7); Qr[505] = z.real(); Qi[505] = z.imag();
+      z = q(h[1]+h[3]+h[4]+h[5]+h[6]+h[7]+h[8], 7); Qr[506] = z.real(); Qi[506] = z.imag();
+      z = q(h[0]+h[1]+h[3]+h[4]+h[5]+h[6]+h[7]+h[8], 8); Qr[507] = z.real(); Qi[507] = z.imag();
+      z = q(h[2]+h[3]+h[4]+h[5]+h[6]+h[7]+h[8], 7); Qr[508] = z.real(); Qi[508] = z.imag();
+      z = q(h[0]+h[2]+h[3]+h[4]+h[5]+h[6]+h[7]+h[8], 8); Qr[509] = z.real(); Qi[509] = z.imag();
+      z = q(h[1]+h[2]+h[3]+h[4]+h[5]+h[6]+h[7]+h[8], 8); Qr[510] = z.real(); Qi[510] = z.imag();
+      z = q(h[0]+h[1]+h[2]+h[3]+h[4]+h[5]+h[6]+h[7]+h[8], 9); Qr[511] = z.real(); Qi[511] = z.imag();
+      expand9Part0(Qr, Qi, Cr, Ci);
+      expand9Part1(Qr, Qi, Cr, Ci);
+      expand9Part2(Qr, Qi, Cr, Ci);
+      expand9Part3(Qr, Qi, Cr, Ci);
+      expand9Part4(Qr, Qi, Cr, Ci);
+      expand9Part5(Qr, Qi, Cr, Ci);
+      expand9Part6(Qr, Qi, Cr, Ci);
+      expand9Part7(Qr, Qi, Cr, Ci);
+      expand9Part8(Qr, Qi, Cr, Ci);
+      expand9Part9(Qr, Qi, Cr, Ci);
+      expand9Part10(Qr, Qi, Cr, Ci);
+      expand9Part11(Qr, Qi, Cr, Ci);
+      expand9Part12(Qr, Qi, Cr, Ci);
+      expand9Part13(Qr, Qi, Cr, Ci);
+      expand9Part14(Qr, Qi, Cr, Ci);
+      expand9Part15(Qr, Qi, Cr, Ci);
+      expand9Part16(Qr, Qi, Cr, Ci);
+      expand9Part17(Qr, Qi, Cr, Ci);
+      expand9Part18(Qr, Qi, Cr, Ci);
+      expand9Part19(Qr, Qi, Cr, Ci);
+      expand9Part20(Qr, Qi, Cr, Ci);
+      expand9Part21(Qr, Qi, Cr, Ci);
+      expand9Part22(Qr, Qi, Cr, Ci);
+      expand9Part23(Qr, Qi, Cr, Ci);
+      expand9Part24(Qr, Qi, Cr, Ci);
+      return Complex(Cr[511], Ci[511]);
+    }
+  }
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
@@ -24,8 +24,8 @@
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see http://www.gnu.org/licenses.
  */
-#include <correlations/QVector.hh>
 #include <correlations/FromQVector.hh>
+#include <correlations/Kernels.hh>
 
 namespace correlations {
   /**
@@ -34,16 +34,16 @@ namespace correlations {
   namespace closed {
     //____________________________________________________________________
     /**
-     * Structure to calculate Cumulants of up to 8th order and power from
-     * a given Q vector.
+     * Structure to calculate Cumulants of up to 10th order from a
+     * given Q vector.
      *
-     * This implementation used closed-form expression to evaluate up
-     * to @f$ QC\{8\}@f$.
-     *
-     * @note This implementation is probably one of the fastest, but
-     * it is not very flexible and it taked a very long time to
-     * compile.  A better option would probably be to use pre-defined
-     * functions with recurssion - at least up to some order
+     * This implementation uses closed-form expressions to evaluate
+     * up to @f$ QC\{8\}@f$, or up to @f$ QC\{10\}@f$ if @c
+     * CORRELATIONS_CLOSED_MAX is defined to be that.  The expressions
+     * are generated from the recurrence as straight-line code (see
+     * correlations::closed::expand), while the harmonics are given
+     * at run-time.  The expressions can also be taken from
+     * the compiled library (see correlations/Kernels.hh).
      *
      * @headerfile correlations/closed/FromQVector.hh  <correlations/closed/FromQVector.hh>
      */
@@ -56,13 +56,14 @@ namespace correlations {
        */
       FromQVector(QVector& q) : correlations::FromQVector(q)
       {
-#ifdef CORRELATIONS_CLOSED_ENABLE_U8
 	_maxFixed = 8;
-#elif  CORRELATIONS_CLOSED_ENABLE_U7
-	_maxFixed = 7;
-#else
-	_maxFixed = 6;
-#endif
+      }
+      /**
+       * Constructor of a correlator not bound to a Q-vector
+       */
+      FromQVector() : correlations::FromQVector()
+      {
+	_maxFixed = 8;
       }
       /**
        * @return Name of the correlator
@@ -72,37 +73,17 @@ namespace correlations {
       /**
        * Calculate the @a n particle correlation using harmonics @a h
        *
-       * @param n How many particles to correlate
-       * @param h Harmonic of each term
+       * @param q  Q-vector
+       * @param ws Workspace
+       * @param n  How many particles to correlate
+       * @param h  Harmonic of each term
        *
        * @return The correlator and the summed weights
        */
-      Complex ucN(const Size n, const HarmonicVector& h) const
+      Complex ucN(const QVector& q, Workspace&,
+		  const Size n, const HarmonicVector& h) const
       {
-	switch (n) {
-	case 1: return uc1(h[0]);
-	case 2: return uc2(h[0], h[1]);
-	case 3: return uc3(h[0], h[1], h[2]);
-	case 4: return uc4(h[0], h[1], h[2], h[3]);
-	case 5: return uc5(h[0], h[1], h[2], h[3], h[4]);
-	case 6: return uc6(h[0], h[1], h[2], h[3], h[4], h[5]);
-	case 7:
-#ifdef CORRELATIONS_CLOSED_ENABLE_U7
-	  return uc7(h[0], h[1], h[2], h[3], h[4], h[5], h[6]);
-#else
-	  std::cerr << "closed-form C7 disabled at compile-time" << std::endl;
-	  break;
-#endif
-	case 8:
-#ifdef CORRELATIONS_CLOSED_ENABLE_U8
-	  return uc8(h[0], h[1], h[2], h[3], h[4], h[5], h[6], h[7]);
-#else
-	  std::cerr << "closed-form C8 disabled at compile-time" << std::endl;
-	  break;
-#endif
-	}
-	std::cerr << "Number of correlators too big:" << n << std::endl;
-	return Complex();
+	return expand(q, n, &(h[0]));
       }
       /**
        * Generic 1-particle correlation
@@ -110,49 +91,56 @@ namespace correlations {
        * QC\{1\} = \langle\exp[i(\sum_j^1 h_j\phi_j)]\rangle
        * @f]
        *
+       * @param q  Q-vector
+       * @param ws Workspace
        * @param n1 Harmonics @f$ h_1@f$
        *
        * @return @f$ QC\{1\}@f$
        */
-      Complex uc1(const Harmonic n1) const
+      Complex uc1(const QVector& q, Workspace&,
+		  const Harmonic n1) const
       {
-	return _q(n1, 1);
+	return q(n1, 1);
       }
       /**
        * Do the 2-particle calculation
        *
+       * @param q  Q-vector
+       * @param ws Workspace
        * @param n1 1st Harmonic
        * @param n2 2nd Harmonic
        *
        * @return the correlator
        */
-      Complex uc2(const Harmonic n1, const Harmonic n2) const
+      Complex uc2(const QVector& q, Workspace&,
+		  const Harmonic n1, const Harmonic n2) const
       {
-	return _q(n1,1) * _q(n2,1) - _q(n1+n2,2);
+	return q(n1,1) * q(n2,1) - q(n1+n2,2);
       }
       /**
        * Do the 3-particle calculation
        *
+       * @param q  Q-vector
+       * @param ws Workspace
        * @param n1 1st Harmonic
        * @param n2 2nd Harmonic
        * @param n3 3rd Harmonic
        *
        * @return the correlator
        */
-      Complex uc3(const Harmonic n1,
+      Complex uc3(const QVector& q, Workspace&,
+		  const Harmonic n1,
 		  const Harmonic n2,
 		  const Harmonic n3) const
       {
-	const Real k2 = 2;
-	return (_q(n1,1)*_q(n2,1)*_q(n3,1)
-		- _q(n1+n2,2)*_q(n3,1)
-		- _q(n2,1)*_q(n1+n3,2)
-		- _q(n1,1)*_q(n2+n3,2)
-		+ k2*_q(n1+n2+n3,3));
+	const Harmonic h[] = { n1, n2, n3 };
+	return expand(q, 3, h);
       }
       /**
        * Do the 4-particle calculation
        *
+       * @param q  Q-vector
+       * @param ws Workspace
        * @param n1 1st Harmonic
        * @param n2 2nd Harmonic
        * @param n3 3rd Harmonic
@@ -160,32 +148,20 @@ namespace correlations {
        *
        * @return the correlator
        */
-      Complex uc4(const Harmonic n1,
+      Complex uc4(const QVector& q, Workspace&,
+		  const Harmonic n1,
 		  const Harmonic n2,
 		  const Harmonic n3,
 		  const Harmonic n4) const
       {
-	const Real k2 = 2;
-	const Real k6 = 6;
-	return (_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n4,1)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n4,1)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n4,1)
-		+ k2*_q(n1+n2+n3,3)*_q(n4,1)
-		- _q(n2,1)*_q(n3,1)*_q(n1+n4,2)
-		+ _q(n2+n3,2)*_q(n1+n4,2)
-		- _q(n1,1)*_q(n3,1)*_q(n2+n4,2)
-		+ _q(n1+n3,2)*_q(n2+n4,2)
-		+ k2*_q(n3,1)*_q(n1+n2+n4,3)
-		- _q(n1,1)*_q(n2,1)*_q(n3+n4,2)
-		+ _q(n1+n2,2)*_q(n3+n4,2)
-		+ k2*_q(n2,1)*_q(n1+n3+n4,3)
-		+ k2*_q(n1,1)*_q(n2+n3+n4,3)
-		- k6*_q(n1+n2+n3+n4,4));
+	const Harmonic h[] = { n1, n2, n3, n4 };
+	return expand(q, 4, h);
       }
       /**
        * Do the 5-particle calculation
        *
+       * @param q  Q-vector
+       * @param ws Workspace
        * @param n1 1st Harmonic
        * @param n2 2nd Harmonic
        * @param n3 3rd Harmonic
@@ -194,71 +170,21 @@ namespace correlations {
        *
        * @return The correlator
        */
-      Complex uc5(const Harmonic n1,
+      Complex uc5(const QVector& q, Workspace&,
+		  const Harmonic n1,
 		  const Harmonic n2,
 		  const Harmonic n3,
 		  const Harmonic n4,
 		  const Harmonic n5) const
       {
-	const Real k2  = 2;
-	const Real k6  = 6;
-	const Real k24 = 24;
-	return (_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)
-		-_q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n5,1)
-		-_q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n5,1)
-		-_q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n5,1)
-		+ k2*_q(n1+n2+n3,3)*_q(n4,1)*_q(n5,1)
-		-_q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n5,1)
-		+ _q(n2+n3,2)*_q(n1+n4,2)*_q(n5,1)
-		-_q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n5,1)
-		+ _q(n1+n3,2)*_q(n2+n4,2)*_q(n5,1)
-		+k2*_q(n3,1)*_q(n1+n2+n4,3)*_q(n5,1)
-		-_q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n5,1)
-		+_q(n1+n2,2)*_q(n3+n4,2)*_q(n5,1)
-		+ k2*_q(n2,1)*_q(n1+n3+n4,3)*_q(n5,1)
-		+k2*_q(n1,1)*_q(n2+n3+n4,3)*_q(n5,1)
-		-k6*_q(n1+n2+n3+n4,4)*_q(n5,1)
-		-_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n5,2)
-		+ _q(n2+n3,2)*_q(n4,1)*_q(n1+n5,2)
-		+_q(n3,1)*_q(n2+n4,2)*_q(n1+n5,2)
-		+ _q(n2,1)*_q(n3+n4,2)*_q(n1+n5,2)
-		-k2*_q(n2+n3+n4,3)*_q(n1+n5,2)
-		-_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n5,2)
-		+_q(n1+n3,2)*_q(n4,1)*_q(n2+n5,2)
-		+ _q(n3,1)*_q(n1+n4,2)*_q(n2+n5,2)
-		+_q(n1,1)*_q(n3+n4,2)*_q(n2+n5,2)
-		-k2*_q(n1+n3+n4,3)*_q(n2+n5,2)
-		+k2*_q(n3,1)*_q(n4,1)*_q(n1+n2+n5,3)
-		-k2*_q(n3+n4,2)*_q(n1+n2+n5,3)
-		-_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n5,2)
-		+_q(n1+n2,2)*_q(n4,1)*_q(n3+n5,2)
-		+_q(n2,1)*_q(n1+n4,2)*_q(n3+n5,2)
-		+_q(n1,1)*_q(n2+n4,2)*_q(n3+n5,2)
-		-k2*_q(n1+n2+n4,3)*_q(n3+n5,2)
-		+k2*_q(n2,1)*_q(n4,1)*_q(n1+n3+n5,3)
-		-k2*_q(n2+n4,2)*_q(n1+n3+n5,3)
-		+ k2*_q(n1,1)*_q(n4,1)*_q(n2+n3+n5,3)
-		-k2*_q(n1+n4,2)*_q(n2+n3+n5,3)
-		-k6*_q(n4,1)*_q(n1+n2+n3+n5,4)
-		-_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n5,2)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n4+n5,2)
-		+_q(n2,1)*_q(n1+n3,2)*_q(n4+n5,2)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n4+n5,2)
-		-k2*_q(n1+n2+n3,3)*_q(n4+n5,2)
-		+k2*_q(n2,1)*_q(n3,1)*_q(n1+n4+n5,3)
-		-k2*_q(n2+n3,2)*_q(n1+n4+n5,3)
-		+k2*_q(n1,1)*_q(n3,1)*_q(n2+n4+n5,3)
-		-k2*_q(n1+n3,2)*_q(n2+n4+n5,3)
-		-k6*_q(n3,1)*_q(n1+n2+n4+n5,4)
-		+k2*_q(n1,1)*_q(n2,1)*_q(n3+n4+n5,3)
-		-k2*_q(n1+n2,2)*_q(n3+n4+n5,3)
-		-k6*_q(n2,1)*_q(n1+n3+n4+n5,4)
-		-k6*_q(n1,1)*_q(n2+n3+n4+n5,4)
-		+k24*_q(n1+n2+n3+n4+n5,5));
+	const Harmonic h[] = { n1, n2, n3, n4, n5 };
+	return expand(q, 5, h);
       }
       /**
        * Do the 6-particle calculation
        *
+       * @param q  Q-vector
+       * @param ws Workspace
        * @param n1 1st Harmonic
        * @param n2 2nd Harmonic
        * @param n3 3rd Harmonic
@@ -268,224 +194,22 @@ namespace correlations {
        *
        * @return The correlator
        */
-      virtual Complex uc6(const Harmonic n1,
-			  const Harmonic n2,
-			  const Harmonic n3,
-			  const Harmonic n4,
-			  const Harmonic n5,
-			  const Harmonic n6) const
+      Complex uc6(const QVector& q, Workspace&,
+		  const Harmonic n1,
+		  const Harmonic n2,
+		  const Harmonic n3,
+		  const Harmonic n4,
+		  const Harmonic n5,
+		  const Harmonic n6) const
       {
-	const Real k2   = 2;
-	const Real k6   = 6;
-	const Real k24  = 24;
-	const Real k120 = 120;
-	return (_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)
-		+ k2*_q(n1+n2+n3,3)*_q(n4,1)*_q(n5,1)*_q(n6,1)
-		- _q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)
-		+ _q(n2+n3,2)*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)
-		- _q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)
-		+ _q(n1+n3,2)*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)
-		+ k2*_q(n3,1)*_q(n1+n2+n4,3)*_q(n5,1)*_q(n6,1)
-		- _q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)
-		+ _q(n1+n2,2)*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)
-		+ k2*_q(n2,1)*_q(n1+n3+n4,3)*_q(n5,1)*_q(n6,1)
-		+ k2*_q(n1,1)*_q(n2+n3+n4,3)*_q(n5,1)*_q(n6,1)
-		- k6*_q(n1+n2+n3+n4,4)*_q(n5,1)*_q(n6,1)
-		- _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)
-		+ _q(n2+n3,2)*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)
-		+ _q(n3,1)*_q(n2+n4,2)*_q(n1+n5,2)*_q(n6,1)
-		+ _q(n2,1)*_q(n3+n4,2)*_q(n1+n5,2)*_q(n6,1)
-		- k2*_q(n2+n3+n4,3)*_q(n1+n5,2)*_q(n6,1)
-		- _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)
-		+ _q(n1+n3,2)*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)
-		+ _q(n3,1)*_q(n1+n4,2)*_q(n2+n5,2)*_q(n6,1)
-		+ _q(n1,1)*_q(n3+n4,2)*_q(n2+n5,2)*_q(n6,1)
-		- k2*_q(n1+n3+n4,3)*_q(n2+n5,2)*_q(n6,1)
-		+ k2*_q(n3,1)*_q(n4,1)*_q(n1+n2+n5,3)*_q(n6,1)
-		- k2*_q(n3+n4,2)*_q(n1+n2+n5,3)*_q(n6,1)
-		- _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)
-		+ _q(n1+n2,2)*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)
-		+ _q(n2,1)*_q(n1+n4,2)*_q(n3+n5,2)*_q(n6,1)
-		+ _q(n1,1)*_q(n2+n4,2)*_q(n3+n5,2)*_q(n6,1)
-		- k2*_q(n1+n2+n4,3)*_q(n3+n5,2)*_q(n6,1)
-		+ k2*_q(n2,1)*_q(n4,1)*_q(n1+n3+n5,3)*_q(n6,1)
-		- k2*_q(n2+n4,2)*_q(n1+n3+n5,3)*_q(n6,1)
-		+ k2*_q(n1,1)*_q(n4,1)*_q(n2+n3+n5,3)*_q(n6,1)
-		- k2*_q(n1+n4,2)*_q(n2+n3+n5,3)*_q(n6,1)
-		- k6*_q(n4,1)*_q(n1+n2+n3+n5,4)*_q(n6,1)
-		- _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)
-		+ _q(n2,1)*_q(n1+n3,2)*_q(n4+n5,2)*_q(n6,1)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n4+n5,2)*_q(n6,1)
-		- k2*_q(n1+n2+n3,3)*_q(n4+n5,2)*_q(n6,1)
-		+ k2*_q(n2,1)*_q(n3,1)*_q(n1+n4+n5,3)*_q(n6,1)
-		- k2*_q(n2+n3,2)*_q(n1+n4+n5,3)*_q(n6,1)
-		+ k2*_q(n1,1)*_q(n3,1)*_q(n2+n4+n5,3)*_q(n6,1)
-		- k2*_q(n1+n3,2)*_q(n2+n4+n5,3)*_q(n6,1)
-		- k6*_q(n3,1)*_q(n1+n2+n4+n5,4)*_q(n6,1)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n3+n4+n5,3)*_q(n6,1)
-		- k2*_q(n1+n2,2)*_q(n3+n4+n5,3)*_q(n6,1)
-		- k6*_q(n2,1)*_q(n1+n3+n4+n5,4)*_q(n6,1)
-		- k6*_q(n1,1)*_q(n2+n3+n4+n5,4)*_q(n6,1)
-		+ k24*_q(n1+n2+n3+n4+n5,5)*_q(n6,1)
-		- _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)
-		+ _q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)
-		+ _q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n1+n6,2)
-		+ _q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n1+n6,2)
-		- k2*_q(n2+n3+n4,3)*_q(n5,1)*_q(n1+n6,2)
-		+ _q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n1+n6,2)
-		- _q(n3+n4,2)*_q(n2+n5,2)*_q(n1+n6,2)
-		+ _q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n1+n6,2)
-		- _q(n2+n4,2)*_q(n3+n5,2)*_q(n1+n6,2)
-		- k2*_q(n4,1)*_q(n2+n3+n5,3)*_q(n1+n6,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n1+n6,2)
-		- _q(n2+n3,2)*_q(n4+n5,2)*_q(n1+n6,2)
-		- k2*_q(n3,1)*_q(n2+n4+n5,3)*_q(n1+n6,2)
-		- k2*_q(n2,1)*_q(n3+n4+n5,3)*_q(n1+n6,2)
-		+ k6*_q(n2+n3+n4+n5,4)*_q(n1+n6,2)
-		- _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)
-		+ _q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)
-		+ _q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n2+n6,2)
-		+ _q(n1,1)*_q(n3+n4,2)*_q(n5,1)*_q(n2+n6,2)
-		- k2*_q(n1+n3+n4,3)*_q(n5,1)*_q(n2+n6,2)
-		+ _q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n2+n6,2)
-		- _q(n3+n4,2)*_q(n1+n5,2)*_q(n2+n6,2)
-		+ _q(n1,1)*_q(n4,1)*_q(n3+n5,2)*_q(n2+n6,2)
-		- _q(n1+n4,2)*_q(n3+n5,2)*_q(n2+n6,2)
-		- k2*_q(n4,1)*_q(n1+n3+n5,3)*_q(n2+n6,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n4+n5,2)*_q(n2+n6,2)
-		- _q(n1+n3,2)*_q(n4+n5,2)*_q(n2+n6,2)
-		- k2*_q(n3,1)*_q(n1+n4+n5,3)*_q(n2+n6,2)
-		- k2*_q(n1,1)*_q(n3+n4+n5,3)*_q(n2+n6,2)
-		+ k6*_q(n1+n3+n4+n5,4)*_q(n2+n6,2)
-		+ k2*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n2+n6,3)
-		- k2*_q(n3+n4,2)*_q(n5,1)*_q(n1+n2+n6,3)
-		- k2*_q(n4,1)*_q(n3+n5,2)*_q(n1+n2+n6,3)
-		- k2*_q(n3,1)*_q(n4+n5,2)*_q(n1+n2+n6,3)
-		+ 4.*_q(n3+n4+n5,3)*_q(n1+n2+n6,3)
-		- _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)
-		+ _q(n1+n2,2)*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)
-		+ _q(n2,1)*_q(n1+n4,2)*_q(n5,1)*_q(n3+n6,2)
-		+ _q(n1,1)*_q(n2+n4,2)*_q(n5,1)*_q(n3+n6,2)
-		- k2*_q(n1+n2+n4,3)*_q(n5,1)*_q(n3+n6,2)
-		+ _q(n2,1)*_q(n4,1)*_q(n1+n5,2)*_q(n3+n6,2)
-		- _q(n2+n4,2)*_q(n1+n5,2)*_q(n3+n6,2)
-		+ _q(n1,1)*_q(n4,1)*_q(n2+n5,2)*_q(n3+n6,2)
-		- _q(n1+n4,2)*_q(n2+n5,2)*_q(n3+n6,2)
-		- k2*_q(n4,1)*_q(n1+n2+n5,3)*_q(n3+n6,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n4+n5,2)*_q(n3+n6,2)
-		- _q(n1+n2,2)*_q(n4+n5,2)*_q(n3+n6,2)
-		- k2*_q(n2,1)*_q(n1+n4+n5,3)*_q(n3+n6,2)
-		- k2*_q(n1,1)*_q(n2+n4+n5,3)*_q(n3+n6,2)
-		+ k6*_q(n1+n2+n4+n5,4)*_q(n3+n6,2)
-		+ k2*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n1+n3+n6,3)
-		- k2*_q(n2+n4,2)*_q(n5,1)*_q(n1+n3+n6,3)
-		- k2*_q(n4,1)*_q(n2+n5,2)*_q(n1+n3+n6,3)
-		- k2*_q(n2,1)*_q(n4+n5,2)*_q(n1+n3+n6,3)
-		+ 4.*_q(n2+n4+n5,3)*_q(n1+n3+n6,3)
-		+ k2*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n2+n3+n6,3)
-		- k2*_q(n1+n4,2)*_q(n5,1)*_q(n2+n3+n6,3)
-		- k2*_q(n4,1)*_q(n1+n5,2)*_q(n2+n3+n6,3)
-		- k2*_q(n1,1)*_q(n4+n5,2)*_q(n2+n3+n6,3)
-		+ 4.*_q(n1+n4+n5,3)*_q(n2+n3+n6,3)
-		- k6*_q(n4,1)*_q(n5,1)*_q(n1+n2+n3+n6,4)
-		+ k6*_q(n4+n5,2)*_q(n1+n2+n3+n6,4)
-		- _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)
-		+ _q(n2,1)*_q(n1+n3,2)*_q(n5,1)*_q(n4+n6,2)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n5,1)*_q(n4+n6,2)
-		- k2*_q(n1+n2+n3,3)*_q(n5,1)*_q(n4+n6,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n1+n5,2)*_q(n4+n6,2)
-		- _q(n2+n3,2)*_q(n1+n5,2)*_q(n4+n6,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n2+n5,2)*_q(n4+n6,2)
-		- _q(n1+n3,2)*_q(n2+n5,2)*_q(n4+n6,2)
-		- k2*_q(n3,1)*_q(n1+n2+n5,3)*_q(n4+n6,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3+n5,2)*_q(n4+n6,2)
-		- _q(n1+n2,2)*_q(n3+n5,2)*_q(n4+n6,2)
-		- k2*_q(n2,1)*_q(n1+n3+n5,3)*_q(n4+n6,2)
-		- k2*_q(n1,1)*_q(n2+n3+n5,3)*_q(n4+n6,2)
-		+ k6*_q(n1+n2+n3+n5,4)*_q(n4+n6,2)
-		+ k2*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n1+n4+n6,3)
-		- k2*_q(n2+n3,2)*_q(n5,1)*_q(n1+n4+n6,3)
-		- k2*_q(n3,1)*_q(n2+n5,2)*_q(n1+n4+n6,3)
-		- k2*_q(n2,1)*_q(n3+n5,2)*_q(n1+n4+n6,3)
-		+ 4.*_q(n2+n3+n5,3)*_q(n1+n4+n6,3)
-		+ k2*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n2+n4+n6,3)
-		- k2*_q(n1+n3,2)*_q(n5,1)*_q(n2+n4+n6,3)
-		- k2*_q(n3,1)*_q(n1+n5,2)*_q(n2+n4+n6,3)
-		- k2*_q(n1,1)*_q(n3+n5,2)*_q(n2+n4+n6,3)
-		+ 4.*_q(n1+n3+n5,3)*_q(n2+n4+n6,3)
-		- k6*_q(n3,1)*_q(n5,1)*_q(n1+n2+n4+n6,4)
-		+ k6*_q(n3+n5,2)*_q(n1+n2+n4+n6,4)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n3+n4+n6,3)
-		- k2*_q(n1+n2,2)*_q(n5,1)*_q(n3+n4+n6,3)
-		- k2*_q(n2,1)*_q(n1+n5,2)*_q(n3+n4+n6,3)
-		- k2*_q(n1,1)*_q(n2+n5,2)*_q(n3+n4+n6,3)
-		+ 4.*_q(n1+n2+n5,3)*_q(n3+n4+n6,3)
-		- k6*_q(n2,1)*_q(n5,1)*_q(n1+n3+n4+n6,4)
-		+ k6*_q(n2+n5,2)*_q(n1+n3+n4+n6,4)
-		- k6*_q(n1,1)*_q(n5,1)*_q(n2+n3+n4+n6,4)
-		+ k6*_q(n1+n5,2)*_q(n2+n3+n4+n6,4)
-		- _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)
-		+ _q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n5+n6,2)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n5+n6,2)
-		- k2*_q(n1+n2+n3,3)*_q(n4,1)*_q(n5+n6,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n5+n6,2)
-		- _q(n2+n3,2)*_q(n1+n4,2)*_q(n5+n6,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n5+n6,2)
-		- _q(n1+n3,2)*_q(n2+n4,2)*_q(n5+n6,2)
-		- k2*_q(n3,1)*_q(n1+n2+n4,3)*_q(n5+n6,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n5+n6,2)
-		- _q(n1+n2,2)*_q(n3+n4,2)*_q(n5+n6,2)
-		- k2*_q(n2,1)*_q(n1+n3+n4,3)*_q(n5+n6,2)
-		- k2*_q(n1,1)*_q(n2+n3+n4,3)*_q(n5+n6,2)
-		+ k6*_q(n1+n2+n3+n4,4)*_q(n5+n6,2)
-		+ k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n5+n6,3)
-		- k2*_q(n2+n3,2)*_q(n4,1)*_q(n1+n5+n6,3)
-		- k2*_q(n3,1)*_q(n2+n4,2)*_q(n1+n5+n6,3)
-		- k2*_q(n2,1)*_q(n3+n4,2)*_q(n1+n5+n6,3)
-		+ 4.*_q(n2+n3+n4,3)*_q(n1+n5+n6,3)
-		+ k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n5+n6,3)
-		- k2*_q(n1+n3,2)*_q(n4,1)*_q(n2+n5+n6,3)
-		- k2*_q(n3,1)*_q(n1+n4,2)*_q(n2+n5+n6,3)
-		- k2*_q(n1,1)*_q(n3+n4,2)*_q(n2+n5+n6,3)
-		+ 4.*_q(n1+n3+n4,3)*_q(n2+n5+n6,3)
-		- k6*_q(n3,1)*_q(n4,1)*_q(n1+n2+n5+n6,4)
-		+ k6*_q(n3+n4,2)*_q(n1+n2+n5+n6,4)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n5+n6,3)
-		- k2*_q(n1+n2,2)*_q(n4,1)*_q(n3+n5+n6,3)
-		- k2*_q(n2,1)*_q(n1+n4,2)*_q(n3+n5+n6,3)
-		- k2*_q(n1,1)*_q(n2+n4,2)*_q(n3+n5+n6,3)
-		+ 4.*_q(n1+n2+n4,3)*_q(n3+n5+n6,3)
-		- k6*_q(n2,1)*_q(n4,1)*_q(n1+n3+n5+n6,4)
-		+ k6*_q(n2+n4,2)*_q(n1+n3+n5+n6,4)
-		- k6*_q(n1,1)*_q(n4,1)*_q(n2+n3+n5+n6,4)
-		+ k6*_q(n1+n4,2)*_q(n2+n3+n5+n6,4)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n5+n6,3)
-		- k2*_q(n1+n2,2)*_q(n3,1)*_q(n4+n5+n6,3)
-		- k2*_q(n2,1)*_q(n1+n3,2)*_q(n4+n5+n6,3)
-		- k2*_q(n1,1)*_q(n2+n3,2)*_q(n4+n5+n6,3)
-		+ 4.*_q(n1+n2+n3,3)*_q(n4+n5+n6,3)
-		- k6*_q(n2,1)*_q(n3,1)*_q(n1+n4+n5+n6,4)
-		+ k6*_q(n2+n3,2)*_q(n1+n4+n5+n6,4)
-		- k6*_q(n1,1)*_q(n3,1)*_q(n2+n4+n5+n6,4)
-		+ k6*_q(n1+n3,2)*_q(n2+n4+n5+n6,4)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n3+n4+n5+n6,4)
-		+ k6*_q(n1+n2,2)*_q(n3+n4+n5+n6,4)
-		+ k24*_q(n5,1)*_q(n1+n2+n3+n4+n6,5)
-		+ k24*_q(n4,1)*_q(n1+n2+n3+n5+n6,5)
-		+ k24*_q(n3,1)*_q(n1+n2+n4+n5+n6,5)
-		+ k24*_q(n2,1)*_q(n1+n3+n4+n5+n6,5)
-		+ k24*_q(n1,1)*_q(n2+n3+n4+n5+n6,5)
-		- k120*_q(n1+n2+n3+n4+n5+n6,6));
+	const Harmonic h[] = { n1, n2, n3, n4, n5, n6 };
+	return expand(q, 6, h);
       }
       /**
        * Do the 7-particle calculation
        *
+       * @param q  Q-vector
+       * @param ws Workspace
        * @param n1 1st Harmonic
        * @param n2 2nd Harmonic
        * @param n3 3rd Harmonic
@@ -496,5136 +220,23 @@ namespace correlations {
        *
        * @return The correlator
        */
-#ifdef CORRELATIONS_CLOSED_ENABLE_U7
-      virtual Complex uc7(const Harmonic n1,
-			  const Harmonic n2,
-			  const Harmonic n3,
-			  const Harmonic n4,
-			  const Harmonic n5,
-			  const Harmonic n6,
-			  const Harmonic n7) const
-      {
-	const Real k2   = 2;
-	const Real k4   = 4;
-	const Real k6   = 6;
-	const Real k12  = 12;
-	const Real k24  = 24;
-	const Real k120 = 120;
-	const Real k720 = 720;
-	return (_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)
-		+ k2*_q(n1+n2+n3,3)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)
-		- _q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)
-		+ _q(n2+n3,2)*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)
-		- _q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)
-		+ _q(n1+n3,2)*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)
-		+ k2*_q(n3,1)*_q(n1+n2+n4,3)*_q(n5,1)*_q(n6,1)*_q(n7,1)
-		- _q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)
-		+ _q(n1+n2,2)*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)
-		+ k2*_q(n2,1)*_q(n1+n3+n4,3)*_q(n5,1)*_q(n6,1)*_q(n7,1)
-		+ k2*_q(n1,1)*_q(n2+n3+n4,3)*_q(n5,1)*_q(n6,1)*_q(n7,1)
-		- k6*_q(n1+n2+n3+n4,4)*_q(n5,1)*_q(n6,1)*_q(n7,1)
-		- _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)
-		+ _q(n2+n3,2)*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)
-		+ _q(n3,1)*_q(n2+n4,2)*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)
-		+ _q(n2,1)*_q(n3+n4,2)*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)
-		- k2*_q(n2+n3+n4,3)*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)
-		- _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)
-		+ _q(n1+n3,2)*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)
-		+ _q(n3,1)*_q(n1+n4,2)*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)
-		+ _q(n1,1)*_q(n3+n4,2)*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)
-		- k2*_q(n1+n3+n4,3)*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)
-		+ k2*_q(n3,1)*_q(n4,1)*_q(n1+n2+n5,3)*_q(n6,1)*_q(n7,1)
-		- k2*_q(n3+n4,2)*_q(n1+n2+n5,3)*_q(n6,1)*_q(n7,1)
-		- _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)
-		+ _q(n1+n2,2)*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)
-		+ _q(n2,1)*_q(n1+n4,2)*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)
-		+ _q(n1,1)*_q(n2+n4,2)*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)
-		- k2*_q(n1+n2+n4,3)*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)
-		+ k2*_q(n2,1)*_q(n4,1)*_q(n1+n3+n5,3)*_q(n6,1)*_q(n7,1)
-		- k2*_q(n2+n4,2)*_q(n1+n3+n5,3)*_q(n6,1)*_q(n7,1)
-		+ k2*_q(n1,1)*_q(n4,1)*_q(n2+n3+n5,3)*_q(n6,1)*_q(n7,1)
-		- k2*_q(n1+n4,2)*_q(n2+n3+n5,3)*_q(n6,1)*_q(n7,1)
-		- k6*_q(n4,1)*_q(n1+n2+n3+n5,4)*_q(n6,1)*_q(n7,1)
-		- _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)
-		+ _q(n2,1)*_q(n1+n3,2)*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)
-		- k2*_q(n1+n2+n3,3)*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)
-		+ k2*_q(n2,1)*_q(n3,1)*_q(n1+n4+n5,3)*_q(n6,1)*_q(n7,1)
-		- k2*_q(n2+n3,2)*_q(n1+n4+n5,3)*_q(n6,1)*_q(n7,1)
-		+ k2*_q(n1,1)*_q(n3,1)*_q(n2+n4+n5,3)*_q(n6,1)*_q(n7,1)
-		- k2*_q(n1+n3,2)*_q(n2+n4+n5,3)*_q(n6,1)*_q(n7,1)
-		- k6*_q(n3,1)*_q(n1+n2+n4+n5,4)*_q(n6,1)*_q(n7,1)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n3+n4+n5,3)*_q(n6,1)*_q(n7,1)
-		- k2*_q(n1+n2,2)*_q(n3+n4+n5,3)*_q(n6,1)*_q(n7,1)
-		- k6*_q(n2,1)*_q(n1+n3+n4+n5,4)*_q(n6,1)*_q(n7,1)
-		- k6*_q(n1,1)*_q(n2+n3+n4+n5,4)*_q(n6,1)*_q(n7,1)
-		+ k24*_q(n1+n2+n3+n4+n5,5)*_q(n6,1)*_q(n7,1)
-		- _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)
-		+ _q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)
-		+ _q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)
-		+ _q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)
-		- k2*_q(n2+n3+n4,3)*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)
-		+ _q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n1+n6,2)*_q(n7,1)
-		- _q(n3+n4,2)*_q(n2+n5,2)*_q(n1+n6,2)*_q(n7,1)
-		+ _q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n1+n6,2)*_q(n7,1)
-		- _q(n2+n4,2)*_q(n3+n5,2)*_q(n1+n6,2)*_q(n7,1)
-		- k2*_q(n4,1)*_q(n2+n3+n5,3)*_q(n1+n6,2)*_q(n7,1)
-		+ _q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n1+n6,2)*_q(n7,1)
-		- _q(n2+n3,2)*_q(n4+n5,2)*_q(n1+n6,2)*_q(n7,1)
-		- k2*_q(n3,1)*_q(n2+n4+n5,3)*_q(n1+n6,2)*_q(n7,1)
-		- k2*_q(n2,1)*_q(n3+n4+n5,3)*_q(n1+n6,2)*_q(n7,1)
-		+ k6*_q(n2+n3+n4+n5,4)*_q(n1+n6,2)*_q(n7,1)
-		- _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)
-		+ _q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)
-		+ _q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)
-		+ _q(n1,1)*_q(n3+n4,2)*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)
-		- k2*_q(n1+n3+n4,3)*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)
-		+ _q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n2+n6,2)*_q(n7,1)
-		- _q(n3+n4,2)*_q(n1+n5,2)*_q(n2+n6,2)*_q(n7,1)
-		+ _q(n1,1)*_q(n4,1)*_q(n3+n5,2)*_q(n2+n6,2)*_q(n7,1)
-		- _q(n1+n4,2)*_q(n3+n5,2)*_q(n2+n6,2)*_q(n7,1)
-		- k2*_q(n4,1)*_q(n1+n3+n5,3)*_q(n2+n6,2)*_q(n7,1)
-		+ _q(n1,1)*_q(n3,1)*_q(n4+n5,2)*_q(n2+n6,2)*_q(n7,1)
-		- _q(n1+n3,2)*_q(n4+n5,2)*_q(n2+n6,2)*_q(n7,1)
-		- k2*_q(n3,1)*_q(n1+n4+n5,3)*_q(n2+n6,2)*_q(n7,1)
-		- k2*_q(n1,1)*_q(n3+n4+n5,3)*_q(n2+n6,2)*_q(n7,1)
-		+ k6*_q(n1+n3+n4+n5,4)*_q(n2+n6,2)*_q(n7,1)
-		+ k2*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n2+n6,3)*_q(n7,1)
-		- k2*_q(n3+n4,2)*_q(n5,1)*_q(n1+n2+n6,3)*_q(n7,1)
-		- k2*_q(n4,1)*_q(n3+n5,2)*_q(n1+n2+n6,3)*_q(n7,1)
-		- k2*_q(n3,1)*_q(n4+n5,2)*_q(n1+n2+n6,3)*_q(n7,1)
-		+ k4*_q(n3+n4+n5,3)*_q(n1+n2+n6,3)*_q(n7,1)
-		- _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)
-		+ _q(n1+n2,2)*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)
-		+ _q(n2,1)*_q(n1+n4,2)*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)
-		+ _q(n1,1)*_q(n2+n4,2)*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)
-		- k2*_q(n1+n2+n4,3)*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)
-		+ _q(n2,1)*_q(n4,1)*_q(n1+n5,2)*_q(n3+n6,2)*_q(n7,1)
-		- _q(n2+n4,2)*_q(n1+n5,2)*_q(n3+n6,2)*_q(n7,1)
-		+ _q(n1,1)*_q(n4,1)*_q(n2+n5,2)*_q(n3+n6,2)*_q(n7,1)
-		- _q(n1+n4,2)*_q(n2+n5,2)*_q(n3+n6,2)*_q(n7,1)
-		- k2*_q(n4,1)*_q(n1+n2+n5,3)*_q(n3+n6,2)*_q(n7,1)
-		+ _q(n1,1)*_q(n2,1)*_q(n4+n5,2)*_q(n3+n6,2)*_q(n7,1)
-		- _q(n1+n2,2)*_q(n4+n5,2)*_q(n3+n6,2)*_q(n7,1)
-		- k2*_q(n2,1)*_q(n1+n4+n5,3)*_q(n3+n6,2)*_q(n7,1)
-		- k2*_q(n1,1)*_q(n2+n4+n5,3)*_q(n3+n6,2)*_q(n7,1)
-		+ k6*_q(n1+n2+n4+n5,4)*_q(n3+n6,2)*_q(n7,1)
-		+ k2*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n1+n3+n6,3)*_q(n7,1)
-		- k2*_q(n2+n4,2)*_q(n5,1)*_q(n1+n3+n6,3)*_q(n7,1)
-		- k2*_q(n4,1)*_q(n2+n5,2)*_q(n1+n3+n6,3)*_q(n7,1)
-		- k2*_q(n2,1)*_q(n4+n5,2)*_q(n1+n3+n6,3)*_q(n7,1)
-		+ k4*_q(n2+n4+n5,3)*_q(n1+n3+n6,3)*_q(n7,1)
-		+ k2*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n2+n3+n6,3)*_q(n7,1)
-		- k2*_q(n1+n4,2)*_q(n5,1)*_q(n2+n3+n6,3)*_q(n7,1)
-		- k2*_q(n4,1)*_q(n1+n5,2)*_q(n2+n3+n6,3)*_q(n7,1)
-		- k2*_q(n1,1)*_q(n4+n5,2)*_q(n2+n3+n6,3)*_q(n7,1)
-		+ k4*_q(n1+n4+n5,3)*_q(n2+n3+n6,3)*_q(n7,1)
-		- k6*_q(n4,1)*_q(n5,1)*_q(n1+n2+n3+n6,4)*_q(n7,1)
-		+ k6*_q(n4+n5,2)*_q(n1+n2+n3+n6,4)*_q(n7,1)
-		- _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)
-		+ _q(n2,1)*_q(n1+n3,2)*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)
-		- k2*_q(n1+n2+n3,3)*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)
-		+ _q(n2,1)*_q(n3,1)*_q(n1+n5,2)*_q(n4+n6,2)*_q(n7,1)
-		- _q(n2+n3,2)*_q(n1+n5,2)*_q(n4+n6,2)*_q(n7,1)
-		+ _q(n1,1)*_q(n3,1)*_q(n2+n5,2)*_q(n4+n6,2)*_q(n7,1)
-		- _q(n1+n3,2)*_q(n2+n5,2)*_q(n4+n6,2)*_q(n7,1)
-		- k2*_q(n3,1)*_q(n1+n2+n5,3)*_q(n4+n6,2)*_q(n7,1)
-		+ _q(n1,1)*_q(n2,1)*_q(n3+n5,2)*_q(n4+n6,2)*_q(n7,1)
-		- _q(n1+n2,2)*_q(n3+n5,2)*_q(n4+n6,2)*_q(n7,1)
-		- k2*_q(n2,1)*_q(n1+n3+n5,3)*_q(n4+n6,2)*_q(n7,1)
-		- k2*_q(n1,1)*_q(n2+n3+n5,3)*_q(n4+n6,2)*_q(n7,1)
-		+ k6*_q(n1+n2+n3+n5,4)*_q(n4+n6,2)*_q(n7,1)
-		+ k2*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n1+n4+n6,3)*_q(n7,1)
-		- k2*_q(n2+n3,2)*_q(n5,1)*_q(n1+n4+n6,3)*_q(n7,1)
-		- k2*_q(n3,1)*_q(n2+n5,2)*_q(n1+n4+n6,3)*_q(n7,1)
-		- k2*_q(n2,1)*_q(n3+n5,2)*_q(n1+n4+n6,3)*_q(n7,1)
-		+ k4*_q(n2+n3+n5,3)*_q(n1+n4+n6,3)*_q(n7,1)
-		+ k2*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n2+n4+n6,3)*_q(n7,1)
-		- k2*_q(n1+n3,2)*_q(n5,1)*_q(n2+n4+n6,3)*_q(n7,1)
-		- k2*_q(n3,1)*_q(n1+n5,2)*_q(n2+n4+n6,3)*_q(n7,1)
-		- k2*_q(n1,1)*_q(n3+n5,2)*_q(n2+n4+n6,3)*_q(n7,1)
-		+ k4*_q(n1+n3+n5,3)*_q(n2+n4+n6,3)*_q(n7,1)
-		- k6*_q(n3,1)*_q(n5,1)*_q(n1+n2+n4+n6,4)*_q(n7,1)
-		+ k6*_q(n3+n5,2)*_q(n1+n2+n4+n6,4)*_q(n7,1)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n3+n4+n6,3)*_q(n7,1)
-		- k2*_q(n1+n2,2)*_q(n5,1)*_q(n3+n4+n6,3)*_q(n7,1)
-		- k2*_q(n2,1)*_q(n1+n5,2)*_q(n3+n4+n6,3)*_q(n7,1)
-		- k2*_q(n1,1)*_q(n2+n5,2)*_q(n3+n4+n6,3)*_q(n7,1)
-		+ k4*_q(n1+n2+n5,3)*_q(n3+n4+n6,3)*_q(n7,1)
-		- k6*_q(n2,1)*_q(n5,1)*_q(n1+n3+n4+n6,4)*_q(n7,1)
-		+ k6*_q(n2+n5,2)*_q(n1+n3+n4+n6,4)*_q(n7,1)
-		- k6*_q(n1,1)*_q(n5,1)*_q(n2+n3+n4+n6,4)*_q(n7,1)
-		+ k6*_q(n1+n5,2)*_q(n2+n3+n4+n6,4)*_q(n7,1)
-		+ k24*_q(n5,1)*_q(n1+n2+n3+n4+n6,5)*_q(n7,1)
-		- _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)
-		+ _q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)
-		- k2*_q(n1+n2+n3,3)*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)
-		+ _q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n5+n6,2)*_q(n7,1)
-		- _q(n2+n3,2)*_q(n1+n4,2)*_q(n5+n6,2)*_q(n7,1)
-		+ _q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n5+n6,2)*_q(n7,1)
-		- _q(n1+n3,2)*_q(n2+n4,2)*_q(n5+n6,2)*_q(n7,1)
-		- k2*_q(n3,1)*_q(n1+n2+n4,3)*_q(n5+n6,2)*_q(n7,1)
-		+ _q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n5+n6,2)*_q(n7,1)
-		- _q(n1+n2,2)*_q(n3+n4,2)*_q(n5+n6,2)*_q(n7,1)
-		- k2*_q(n2,1)*_q(n1+n3+n4,3)*_q(n5+n6,2)*_q(n7,1)
-		- k2*_q(n1,1)*_q(n2+n3+n4,3)*_q(n5+n6,2)*_q(n7,1)
-		+ k6*_q(n1+n2+n3+n4,4)*_q(n5+n6,2)*_q(n7,1)
-		+ k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n5+n6,3)*_q(n7,1)
-		- k2*_q(n2+n3,2)*_q(n4,1)*_q(n1+n5+n6,3)*_q(n7,1)
-		- k2*_q(n3,1)*_q(n2+n4,2)*_q(n1+n5+n6,3)*_q(n7,1)
-		- k2*_q(n2,1)*_q(n3+n4,2)*_q(n1+n5+n6,3)*_q(n7,1)
-		+ k4*_q(n2+n3+n4,3)*_q(n1+n5+n6,3)*_q(n7,1)
-		+ k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n5+n6,3)*_q(n7,1)
-		- k2*_q(n1+n3,2)*_q(n4,1)*_q(n2+n5+n6,3)*_q(n7,1)
-		- k2*_q(n3,1)*_q(n1+n4,2)*_q(n2+n5+n6,3)*_q(n7,1)
-		- k2*_q(n1,1)*_q(n3+n4,2)*_q(n2+n5+n6,3)*_q(n7,1)
-		+ k4*_q(n1+n3+n4,3)*_q(n2+n5+n6,3)*_q(n7,1)
-		- k6*_q(n3,1)*_q(n4,1)*_q(n1+n2+n5+n6,4)*_q(n7,1)
-		+ k6*_q(n3+n4,2)*_q(n1+n2+n5+n6,4)*_q(n7,1)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n5+n6,3)*_q(n7,1)
-		- k2*_q(n1+n2,2)*_q(n4,1)*_q(n3+n5+n6,3)*_q(n7,1)
-		- k2*_q(n2,1)*_q(n1+n4,2)*_q(n3+n5+n6,3)*_q(n7,1)
-		- k2*_q(n1,1)*_q(n2+n4,2)*_q(n3+n5+n6,3)*_q(n7,1)
-		+ k4*_q(n1+n2+n4,3)*_q(n3+n5+n6,3)*_q(n7,1)
-		- k6*_q(n2,1)*_q(n4,1)*_q(n1+n3+n5+n6,4)*_q(n7,1)
-		+ k6*_q(n2+n4,2)*_q(n1+n3+n5+n6,4)*_q(n7,1)
-		- k6*_q(n1,1)*_q(n4,1)*_q(n2+n3+n5+n6,4)*_q(n7,1)
-		+ k6*_q(n1+n4,2)*_q(n2+n3+n5+n6,4)*_q(n7,1)
-		+ k24*_q(n4,1)*_q(n1+n2+n3+n5+n6,5)*_q(n7,1)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n5+n6,3)*_q(n7,1)
-		- k2*_q(n1+n2,2)*_q(n3,1)*_q(n4+n5+n6,3)*_q(n7,1)
-		- k2*_q(n2,1)*_q(n1+n3,2)*_q(n4+n5+n6,3)*_q(n7,1)
-		- k2*_q(n1,1)*_q(n2+n3,2)*_q(n4+n5+n6,3)*_q(n7,1)
-		+ k4*_q(n1+n2+n3,3)*_q(n4+n5+n6,3)*_q(n7,1)
-		- k6*_q(n2,1)*_q(n3,1)*_q(n1+n4+n5+n6,4)*_q(n7,1)
-		+ k6*_q(n2+n3,2)*_q(n1+n4+n5+n6,4)*_q(n7,1)
-		- k6*_q(n1,1)*_q(n3,1)*_q(n2+n4+n5+n6,4)*_q(n7,1)
-		+ k6*_q(n1+n3,2)*_q(n2+n4+n5+n6,4)*_q(n7,1)
-		+ k24*_q(n3,1)*_q(n1+n2+n4+n5+n6,5)*_q(n7,1)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n3+n4+n5+n6,4)*_q(n7,1)
-		+ k6*_q(n1+n2,2)*_q(n3+n4+n5+n6,4)*_q(n7,1)
-		+ k24*_q(n2,1)*_q(n1+n3+n4+n5+n6,5)*_q(n7,1)
-		+ k24*_q(n1,1)*_q(n2+n3+n4+n5+n6,5)*_q(n7,1)
-		- k120*_q(n1+n2+n3+n4+n5+n6,6)*_q(n7,1)
-		- _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)
-		+ _q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)
-		+ _q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)
-		+ _q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)
-		- k2*_q(n2+n3+n4,3)*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)
-		+ _q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n1+n7,2)
-		- _q(n3+n4,2)*_q(n2+n5,2)*_q(n6,1)*_q(n1+n7,2)
-		+ _q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n1+n7,2)
-		- _q(n2+n4,2)*_q(n3+n5,2)*_q(n6,1)*_q(n1+n7,2)
-		- k2*_q(n4,1)*_q(n2+n3+n5,3)*_q(n6,1)*_q(n1+n7,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n1+n7,2)
-		- _q(n2+n3,2)*_q(n4+n5,2)*_q(n6,1)*_q(n1+n7,2)
-		- k2*_q(n3,1)*_q(n2+n4+n5,3)*_q(n6,1)*_q(n1+n7,2)
-		- k2*_q(n2,1)*_q(n3+n4+n5,3)*_q(n6,1)*_q(n1+n7,2)
-		+ k6*_q(n2+n3+n4+n5,4)*_q(n6,1)*_q(n1+n7,2)
-		+ _q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n1+n7,2)
-		- _q(n3+n4,2)*_q(n5,1)*_q(n2+n6,2)*_q(n1+n7,2)
-		- _q(n4,1)*_q(n3+n5,2)*_q(n2+n6,2)*_q(n1+n7,2)
-		- _q(n3,1)*_q(n4+n5,2)*_q(n2+n6,2)*_q(n1+n7,2)
-		+ k2*_q(n3+n4+n5,3)*_q(n2+n6,2)*_q(n1+n7,2)
-		+ _q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n1+n7,2)
-		- _q(n2+n4,2)*_q(n5,1)*_q(n3+n6,2)*_q(n1+n7,2)
-		- _q(n4,1)*_q(n2+n5,2)*_q(n3+n6,2)*_q(n1+n7,2)
-		- _q(n2,1)*_q(n4+n5,2)*_q(n3+n6,2)*_q(n1+n7,2)
-		+ k2*_q(n2+n4+n5,3)*_q(n3+n6,2)*_q(n1+n7,2)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n2+n3+n6,3)*_q(n1+n7,2)
-		+ k2*_q(n4+n5,2)*_q(n2+n3+n6,3)*_q(n1+n7,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n1+n7,2)
-		- _q(n2+n3,2)*_q(n5,1)*_q(n4+n6,2)*_q(n1+n7,2)
-		- _q(n3,1)*_q(n2+n5,2)*_q(n4+n6,2)*_q(n1+n7,2)
-		- _q(n2,1)*_q(n3+n5,2)*_q(n4+n6,2)*_q(n1+n7,2)
-		+ k2*_q(n2+n3+n5,3)*_q(n4+n6,2)*_q(n1+n7,2)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n2+n4+n6,3)*_q(n1+n7,2)
-		+ k2*_q(n3+n5,2)*_q(n2+n4+n6,3)*_q(n1+n7,2)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n3+n4+n6,3)*_q(n1+n7,2)
-		+ k2*_q(n2+n5,2)*_q(n3+n4+n6,3)*_q(n1+n7,2)
-		+ k6*_q(n5,1)*_q(n2+n3+n4+n6,4)*_q(n1+n7,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n1+n7,2)
-		- _q(n2+n3,2)*_q(n4,1)*_q(n5+n6,2)*_q(n1+n7,2)
-		- _q(n3,1)*_q(n2+n4,2)*_q(n5+n6,2)*_q(n1+n7,2)
-		- _q(n2,1)*_q(n3+n4,2)*_q(n5+n6,2)*_q(n1+n7,2)
-		+ k2*_q(n2+n3+n4,3)*_q(n5+n6,2)*_q(n1+n7,2)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n2+n5+n6,3)*_q(n1+n7,2)
-		+ k2*_q(n3+n4,2)*_q(n2+n5+n6,3)*_q(n1+n7,2)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n3+n5+n6,3)*_q(n1+n7,2)
-		+ k2*_q(n2+n4,2)*_q(n3+n5+n6,3)*_q(n1+n7,2)
-		+ k6*_q(n4,1)*_q(n2+n3+n5+n6,4)*_q(n1+n7,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4+n5+n6,3)*_q(n1+n7,2)
-		+ k2*_q(n2+n3,2)*_q(n4+n5+n6,3)*_q(n1+n7,2)
-		+ k6*_q(n3,1)*_q(n2+n4+n5+n6,4)*_q(n1+n7,2)
-		+ k6*_q(n2,1)*_q(n3+n4+n5+n6,4)*_q(n1+n7,2)
-		- k24*_q(n2+n3+n4+n5+n6,5)*_q(n1+n7,2)
-		- _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)
-		+ _q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)
-		+ _q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)
-		+ _q(n1,1)*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)
-		- k2*_q(n1+n3+n4,3)*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)
-		+ _q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n2+n7,2)
-		- _q(n3+n4,2)*_q(n1+n5,2)*_q(n6,1)*_q(n2+n7,2)
-		+ _q(n1,1)*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n2+n7,2)
-		- _q(n1+n4,2)*_q(n3+n5,2)*_q(n6,1)*_q(n2+n7,2)
-		- k2*_q(n4,1)*_q(n1+n3+n5,3)*_q(n6,1)*_q(n2+n7,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n2+n7,2)
-		- _q(n1+n3,2)*_q(n4+n5,2)*_q(n6,1)*_q(n2+n7,2)
-		- k2*_q(n3,1)*_q(n1+n4+n5,3)*_q(n6,1)*_q(n2+n7,2)
-		- k2*_q(n1,1)*_q(n3+n4+n5,3)*_q(n6,1)*_q(n2+n7,2)
-		+ k6*_q(n1+n3+n4+n5,4)*_q(n6,1)*_q(n2+n7,2)
-		+ _q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n2+n7,2)
-		- _q(n3+n4,2)*_q(n5,1)*_q(n1+n6,2)*_q(n2+n7,2)
-		- _q(n4,1)*_q(n3+n5,2)*_q(n1+n6,2)*_q(n2+n7,2)
-		- _q(n3,1)*_q(n4+n5,2)*_q(n1+n6,2)*_q(n2+n7,2)
-		+ k2*_q(n3+n4+n5,3)*_q(n1+n6,2)*_q(n2+n7,2)
-		+ _q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n2+n7,2)
-		- _q(n1+n4,2)*_q(n5,1)*_q(n3+n6,2)*_q(n2+n7,2)
-		- _q(n4,1)*_q(n1+n5,2)*_q(n3+n6,2)*_q(n2+n7,2)
-		- _q(n1,1)*_q(n4+n5,2)*_q(n3+n6,2)*_q(n2+n7,2)
-		+ k2*_q(n1+n4+n5,3)*_q(n3+n6,2)*_q(n2+n7,2)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n1+n3+n6,3)*_q(n2+n7,2)
-		+ k2*_q(n4+n5,2)*_q(n1+n3+n6,3)*_q(n2+n7,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n2+n7,2)
-		- _q(n1+n3,2)*_q(n5,1)*_q(n4+n6,2)*_q(n2+n7,2)
-		- _q(n3,1)*_q(n1+n5,2)*_q(n4+n6,2)*_q(n2+n7,2)
-		- _q(n1,1)*_q(n3+n5,2)*_q(n4+n6,2)*_q(n2+n7,2)
-		+ k2*_q(n1+n3+n5,3)*_q(n4+n6,2)*_q(n2+n7,2)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n1+n4+n6,3)*_q(n2+n7,2)
-		+ k2*_q(n3+n5,2)*_q(n1+n4+n6,3)*_q(n2+n7,2)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n3+n4+n6,3)*_q(n2+n7,2)
-		+ k2*_q(n1+n5,2)*_q(n3+n4+n6,3)*_q(n2+n7,2)
-		+ k6*_q(n5,1)*_q(n1+n3+n4+n6,4)*_q(n2+n7,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n2+n7,2)
-		- _q(n1+n3,2)*_q(n4,1)*_q(n5+n6,2)*_q(n2+n7,2)
-		- _q(n3,1)*_q(n1+n4,2)*_q(n5+n6,2)*_q(n2+n7,2)
-		- _q(n1,1)*_q(n3+n4,2)*_q(n5+n6,2)*_q(n2+n7,2)
-		+ k2*_q(n1+n3+n4,3)*_q(n5+n6,2)*_q(n2+n7,2)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n1+n5+n6,3)*_q(n2+n7,2)
-		+ k2*_q(n3+n4,2)*_q(n1+n5+n6,3)*_q(n2+n7,2)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n3+n5+n6,3)*_q(n2+n7,2)
-		+ k2*_q(n1+n4,2)*_q(n3+n5+n6,3)*_q(n2+n7,2)
-		+ k6*_q(n4,1)*_q(n1+n3+n5+n6,4)*_q(n2+n7,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4+n5+n6,3)*_q(n2+n7,2)
-		+ k2*_q(n1+n3,2)*_q(n4+n5+n6,3)*_q(n2+n7,2)
-		+ k6*_q(n3,1)*_q(n1+n4+n5+n6,4)*_q(n2+n7,2)
-		+ k6*_q(n1,1)*_q(n3+n4+n5+n6,4)*_q(n2+n7,2)
-		- k24*_q(n1+n3+n4+n5+n6,5)*_q(n2+n7,2)
-		+ k2*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n2+n7,3)
-		- k2*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n1+n2+n7,3)
-		- k2*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n1+n2+n7,3)
-		- k2*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n1+n2+n7,3)
-		+ k4*_q(n3+n4+n5,3)*_q(n6,1)*_q(n1+n2+n7,3)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n1+n2+n7,3)
-		+ k2*_q(n4+n5,2)*_q(n3+n6,2)*_q(n1+n2+n7,3)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n1+n2+n7,3)
-		+ k2*_q(n3+n5,2)*_q(n4+n6,2)*_q(n1+n2+n7,3)
-		+ k4*_q(n5,1)*_q(n3+n4+n6,3)*_q(n1+n2+n7,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n1+n2+n7,3)
-		+ k2*_q(n3+n4,2)*_q(n5+n6,2)*_q(n1+n2+n7,3)
-		+ k4*_q(n4,1)*_q(n3+n5+n6,3)*_q(n1+n2+n7,3)
-		+ k4*_q(n3,1)*_q(n4+n5+n6,3)*_q(n1+n2+n7,3)
-		- k12*_q(n3+n4+n5+n6,4)*_q(n1+n2+n7,3)
-		- _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)
-		+ _q(n1+n2,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)
-		+ _q(n2,1)*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)
-		+ _q(n1,1)*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)
-		- k2*_q(n1+n2+n4,3)*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)
-		+ _q(n2,1)*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n3+n7,2)
-		- _q(n2+n4,2)*_q(n1+n5,2)*_q(n6,1)*_q(n3+n7,2)
-		+ _q(n1,1)*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n3+n7,2)
-		- _q(n1+n4,2)*_q(n2+n5,2)*_q(n6,1)*_q(n3+n7,2)
-		- k2*_q(n4,1)*_q(n1+n2+n5,3)*_q(n6,1)*_q(n3+n7,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n4+n5,2)*_q(n6,1)*_q(n3+n7,2)
-		- _q(n1+n2,2)*_q(n4+n5,2)*_q(n6,1)*_q(n3+n7,2)
-		- k2*_q(n2,1)*_q(n1+n4+n5,3)*_q(n6,1)*_q(n3+n7,2)
-		- k2*_q(n1,1)*_q(n2+n4+n5,3)*_q(n6,1)*_q(n3+n7,2)
-		+ k6*_q(n1+n2+n4+n5,4)*_q(n6,1)*_q(n3+n7,2)
-		+ _q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n3+n7,2)
-		- _q(n2+n4,2)*_q(n5,1)*_q(n1+n6,2)*_q(n3+n7,2)
-		- _q(n4,1)*_q(n2+n5,2)*_q(n1+n6,2)*_q(n3+n7,2)
-		- _q(n2,1)*_q(n4+n5,2)*_q(n1+n6,2)*_q(n3+n7,2)
-		+ k2*_q(n2+n4+n5,3)*_q(n1+n6,2)*_q(n3+n7,2)
-		+ _q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n3+n7,2)
-		- _q(n1+n4,2)*_q(n5,1)*_q(n2+n6,2)*_q(n3+n7,2)
-		- _q(n4,1)*_q(n1+n5,2)*_q(n2+n6,2)*_q(n3+n7,2)
-		- _q(n1,1)*_q(n4+n5,2)*_q(n2+n6,2)*_q(n3+n7,2)
-		+ k2*_q(n1+n4+n5,3)*_q(n2+n6,2)*_q(n3+n7,2)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n1+n2+n6,3)*_q(n3+n7,2)
-		+ k2*_q(n4+n5,2)*_q(n1+n2+n6,3)*_q(n3+n7,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n4+n6,2)*_q(n3+n7,2)
-		- _q(n1+n2,2)*_q(n5,1)*_q(n4+n6,2)*_q(n3+n7,2)
-		- _q(n2,1)*_q(n1+n5,2)*_q(n4+n6,2)*_q(n3+n7,2)
-		- _q(n1,1)*_q(n2+n5,2)*_q(n4+n6,2)*_q(n3+n7,2)
-		+ k2*_q(n1+n2+n5,3)*_q(n4+n6,2)*_q(n3+n7,2)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n1+n4+n6,3)*_q(n3+n7,2)
-		+ k2*_q(n2+n5,2)*_q(n1+n4+n6,3)*_q(n3+n7,2)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n2+n4+n6,3)*_q(n3+n7,2)
-		+ k2*_q(n1+n5,2)*_q(n2+n4+n6,3)*_q(n3+n7,2)
-		+ k6*_q(n5,1)*_q(n1+n2+n4+n6,4)*_q(n3+n7,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5+n6,2)*_q(n3+n7,2)
-		- _q(n1+n2,2)*_q(n4,1)*_q(n5+n6,2)*_q(n3+n7,2)
-		- _q(n2,1)*_q(n1+n4,2)*_q(n5+n6,2)*_q(n3+n7,2)
-		- _q(n1,1)*_q(n2+n4,2)*_q(n5+n6,2)*_q(n3+n7,2)
-		+ k2*_q(n1+n2+n4,3)*_q(n5+n6,2)*_q(n3+n7,2)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n1+n5+n6,3)*_q(n3+n7,2)
-		+ k2*_q(n2+n4,2)*_q(n1+n5+n6,3)*_q(n3+n7,2)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n2+n5+n6,3)*_q(n3+n7,2)
-		+ k2*_q(n1+n4,2)*_q(n2+n5+n6,3)*_q(n3+n7,2)
-		+ k6*_q(n4,1)*_q(n1+n2+n5+n6,4)*_q(n3+n7,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4+n5+n6,3)*_q(n3+n7,2)
-		+ k2*_q(n1+n2,2)*_q(n4+n5+n6,3)*_q(n3+n7,2)
-		+ k6*_q(n2,1)*_q(n1+n4+n5+n6,4)*_q(n3+n7,2)
-		+ k6*_q(n1,1)*_q(n2+n4+n5+n6,4)*_q(n3+n7,2)
-		- k24*_q(n1+n2+n4+n5+n6,5)*_q(n3+n7,2)
-		+ k2*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n3+n7,3)
-		- k2*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n1+n3+n7,3)
-		- k2*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n1+n3+n7,3)
-		- k2*_q(n2,1)*_q(n4+n5,2)*_q(n6,1)*_q(n1+n3+n7,3)
-		+ k4*_q(n2+n4+n5,3)*_q(n6,1)*_q(n1+n3+n7,3)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n1+n3+n7,3)
-		+ k2*_q(n4+n5,2)*_q(n2+n6,2)*_q(n1+n3+n7,3)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n4+n6,2)*_q(n1+n3+n7,3)
-		+ k2*_q(n2+n5,2)*_q(n4+n6,2)*_q(n1+n3+n7,3)
-		+ k4*_q(n5,1)*_q(n2+n4+n6,3)*_q(n1+n3+n7,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n5+n6,2)*_q(n1+n3+n7,3)
-		+ k2*_q(n2+n4,2)*_q(n5+n6,2)*_q(n1+n3+n7,3)
-		+ k4*_q(n4,1)*_q(n2+n5+n6,3)*_q(n1+n3+n7,3)
-		+ k4*_q(n2,1)*_q(n4+n5+n6,3)*_q(n1+n3+n7,3)
-		- k12*_q(n2+n4+n5+n6,4)*_q(n1+n3+n7,3)
-		+ k2*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n2+n3+n7,3)
-		- k2*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n2+n3+n7,3)
-		- k2*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n2+n3+n7,3)
-		- k2*_q(n1,1)*_q(n4+n5,2)*_q(n6,1)*_q(n2+n3+n7,3)
-		+ k4*_q(n1+n4+n5,3)*_q(n6,1)*_q(n2+n3+n7,3)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n2+n3+n7,3)
-		+ k2*_q(n4+n5,2)*_q(n1+n6,2)*_q(n2+n3+n7,3)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n4+n6,2)*_q(n2+n3+n7,3)
-		+ k2*_q(n1+n5,2)*_q(n4+n6,2)*_q(n2+n3+n7,3)
-		+ k4*_q(n5,1)*_q(n1+n4+n6,3)*_q(n2+n3+n7,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n5+n6,2)*_q(n2+n3+n7,3)
-		+ k2*_q(n1+n4,2)*_q(n5+n6,2)*_q(n2+n3+n7,3)
-		+ k4*_q(n4,1)*_q(n1+n5+n6,3)*_q(n2+n3+n7,3)
-		+ k4*_q(n1,1)*_q(n4+n5+n6,3)*_q(n2+n3+n7,3)
-		- k12*_q(n1+n4+n5+n6,4)*_q(n2+n3+n7,3)
-		- k6*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n2+n3+n7,4)
-		+ k6*_q(n4+n5,2)*_q(n6,1)*_q(n1+n2+n3+n7,4)
-		+ k6*_q(n5,1)*_q(n4+n6,2)*_q(n1+n2+n3+n7,4)
-		+ k6*_q(n4,1)*_q(n5+n6,2)*_q(n1+n2+n3+n7,4)
-		- k12*_q(n4+n5+n6,3)*_q(n1+n2+n3+n7,4)
-		- _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)
-		+ _q(n2,1)*_q(n1+n3,2)*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)
-		- k2*_q(n1+n2+n3,3)*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n1+n5,2)*_q(n6,1)*_q(n4+n7,2)
-		- _q(n2+n3,2)*_q(n1+n5,2)*_q(n6,1)*_q(n4+n7,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n2+n5,2)*_q(n6,1)*_q(n4+n7,2)
-		- _q(n1+n3,2)*_q(n2+n5,2)*_q(n6,1)*_q(n4+n7,2)
-		- k2*_q(n3,1)*_q(n1+n2+n5,3)*_q(n6,1)*_q(n4+n7,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3+n5,2)*_q(n6,1)*_q(n4+n7,2)
-		- _q(n1+n2,2)*_q(n3+n5,2)*_q(n6,1)*_q(n4+n7,2)
-		- k2*_q(n2,1)*_q(n1+n3+n5,3)*_q(n6,1)*_q(n4+n7,2)
-		- k2*_q(n1,1)*_q(n2+n3+n5,3)*_q(n6,1)*_q(n4+n7,2)
-		+ k6*_q(n1+n2+n3+n5,4)*_q(n6,1)*_q(n4+n7,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n1+n6,2)*_q(n4+n7,2)
-		- _q(n2+n3,2)*_q(n5,1)*_q(n1+n6,2)*_q(n4+n7,2)
-		- _q(n3,1)*_q(n2+n5,2)*_q(n1+n6,2)*_q(n4+n7,2)
-		- _q(n2,1)*_q(n3+n5,2)*_q(n1+n6,2)*_q(n4+n7,2)
-		+ k2*_q(n2+n3+n5,3)*_q(n1+n6,2)*_q(n4+n7,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n2+n6,2)*_q(n4+n7,2)
-		- _q(n1+n3,2)*_q(n5,1)*_q(n2+n6,2)*_q(n4+n7,2)
-		- _q(n3,1)*_q(n1+n5,2)*_q(n2+n6,2)*_q(n4+n7,2)
-		- _q(n1,1)*_q(n3+n5,2)*_q(n2+n6,2)*_q(n4+n7,2)
-		+ k2*_q(n1+n3+n5,3)*_q(n2+n6,2)*_q(n4+n7,2)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n1+n2+n6,3)*_q(n4+n7,2)
-		+ k2*_q(n3+n5,2)*_q(n1+n2+n6,3)*_q(n4+n7,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n3+n6,2)*_q(n4+n7,2)
-		- _q(n1+n2,2)*_q(n5,1)*_q(n3+n6,2)*_q(n4+n7,2)
-		- _q(n2,1)*_q(n1+n5,2)*_q(n3+n6,2)*_q(n4+n7,2)
-		- _q(n1,1)*_q(n2+n5,2)*_q(n3+n6,2)*_q(n4+n7,2)
-		+ k2*_q(n1+n2+n5,3)*_q(n3+n6,2)*_q(n4+n7,2)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n1+n3+n6,3)*_q(n4+n7,2)
-		+ k2*_q(n2+n5,2)*_q(n1+n3+n6,3)*_q(n4+n7,2)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n2+n3+n6,3)*_q(n4+n7,2)
-		+ k2*_q(n1+n5,2)*_q(n2+n3+n6,3)*_q(n4+n7,2)
-		+ k6*_q(n5,1)*_q(n1+n2+n3+n6,4)*_q(n4+n7,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5+n6,2)*_q(n4+n7,2)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n5+n6,2)*_q(n4+n7,2)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n5+n6,2)*_q(n4+n7,2)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n5+n6,2)*_q(n4+n7,2)
-		+ k2*_q(n1+n2+n3,3)*_q(n5+n6,2)*_q(n4+n7,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n5+n6,3)*_q(n4+n7,2)
-		+ k2*_q(n2+n3,2)*_q(n1+n5+n6,3)*_q(n4+n7,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n5+n6,3)*_q(n4+n7,2)
-		+ k2*_q(n1+n3,2)*_q(n2+n5+n6,3)*_q(n4+n7,2)
-		+ k6*_q(n3,1)*_q(n1+n2+n5+n6,4)*_q(n4+n7,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n5+n6,3)*_q(n4+n7,2)
-		+ k2*_q(n1+n2,2)*_q(n3+n5+n6,3)*_q(n4+n7,2)
-		+ k6*_q(n2,1)*_q(n1+n3+n5+n6,4)*_q(n4+n7,2)
-		+ k6*_q(n1,1)*_q(n2+n3+n5+n6,4)*_q(n4+n7,2)
-		- k24*_q(n1+n2+n3+n5+n6,5)*_q(n4+n7,2)
-		+ k2*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n1+n4+n7,3)
-		- k2*_q(n2+n3,2)*_q(n5,1)*_q(n6,1)*_q(n1+n4+n7,3)
-		- k2*_q(n3,1)*_q(n2+n5,2)*_q(n6,1)*_q(n1+n4+n7,3)
-		- k2*_q(n2,1)*_q(n3+n5,2)*_q(n6,1)*_q(n1+n4+n7,3)
-		+ k4*_q(n2+n3+n5,3)*_q(n6,1)*_q(n1+n4+n7,3)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n2+n6,2)*_q(n1+n4+n7,3)
-		+ k2*_q(n3+n5,2)*_q(n2+n6,2)*_q(n1+n4+n7,3)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n3+n6,2)*_q(n1+n4+n7,3)
-		+ k2*_q(n2+n5,2)*_q(n3+n6,2)*_q(n1+n4+n7,3)
-		+ k4*_q(n5,1)*_q(n2+n3+n6,3)*_q(n1+n4+n7,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n5+n6,2)*_q(n1+n4+n7,3)
-		+ k2*_q(n2+n3,2)*_q(n5+n6,2)*_q(n1+n4+n7,3)
-		+ k4*_q(n3,1)*_q(n2+n5+n6,3)*_q(n1+n4+n7,3)
-		+ k4*_q(n2,1)*_q(n3+n5+n6,3)*_q(n1+n4+n7,3)
-		- k12*_q(n2+n3+n5+n6,4)*_q(n1+n4+n7,3)
-		+ k2*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n2+n4+n7,3)
-		- k2*_q(n1+n3,2)*_q(n5,1)*_q(n6,1)*_q(n2+n4+n7,3)
-		- k2*_q(n3,1)*_q(n1+n5,2)*_q(n6,1)*_q(n2+n4+n7,3)
-		- k2*_q(n1,1)*_q(n3+n5,2)*_q(n6,1)*_q(n2+n4+n7,3)
-		+ k4*_q(n1+n3+n5,3)*_q(n6,1)*_q(n2+n4+n7,3)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n1+n6,2)*_q(n2+n4+n7,3)
-		+ k2*_q(n3+n5,2)*_q(n1+n6,2)*_q(n2+n4+n7,3)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n3+n6,2)*_q(n2+n4+n7,3)
-		+ k2*_q(n1+n5,2)*_q(n3+n6,2)*_q(n2+n4+n7,3)
-		+ k4*_q(n5,1)*_q(n1+n3+n6,3)*_q(n2+n4+n7,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n5+n6,2)*_q(n2+n4+n7,3)
-		+ k2*_q(n1+n3,2)*_q(n5+n6,2)*_q(n2+n4+n7,3)
-		+ k4*_q(n3,1)*_q(n1+n5+n6,3)*_q(n2+n4+n7,3)
-		+ k4*_q(n1,1)*_q(n3+n5+n6,3)*_q(n2+n4+n7,3)
-		- k12*_q(n1+n3+n5+n6,4)*_q(n2+n4+n7,3)
-		- k6*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n1+n2+n4+n7,4)
-		+ k6*_q(n3+n5,2)*_q(n6,1)*_q(n1+n2+n4+n7,4)
-		+ k6*_q(n5,1)*_q(n3+n6,2)*_q(n1+n2+n4+n7,4)
-		+ k6*_q(n3,1)*_q(n5+n6,2)*_q(n1+n2+n4+n7,4)
-		- k12*_q(n3+n5+n6,3)*_q(n1+n2+n4+n7,4)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n6,1)*_q(n3+n4+n7,3)
-		- k2*_q(n1+n2,2)*_q(n5,1)*_q(n6,1)*_q(n3+n4+n7,3)
-		- k2*_q(n2,1)*_q(n1+n5,2)*_q(n6,1)*_q(n3+n4+n7,3)
-		- k2*_q(n1,1)*_q(n2+n5,2)*_q(n6,1)*_q(n3+n4+n7,3)
-		+ k4*_q(n1+n2+n5,3)*_q(n6,1)*_q(n3+n4+n7,3)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n1+n6,2)*_q(n3+n4+n7,3)
-		+ k2*_q(n2+n5,2)*_q(n1+n6,2)*_q(n3+n4+n7,3)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n2+n6,2)*_q(n3+n4+n7,3)
-		+ k2*_q(n1+n5,2)*_q(n2+n6,2)*_q(n3+n4+n7,3)
-		+ k4*_q(n5,1)*_q(n1+n2+n6,3)*_q(n3+n4+n7,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n5+n6,2)*_q(n3+n4+n7,3)
-		+ k2*_q(n1+n2,2)*_q(n5+n6,2)*_q(n3+n4+n7,3)
-		+ k4*_q(n2,1)*_q(n1+n5+n6,3)*_q(n3+n4+n7,3)
-		+ k4*_q(n1,1)*_q(n2+n5+n6,3)*_q(n3+n4+n7,3)
-		- k12*_q(n1+n2+n5+n6,4)*_q(n3+n4+n7,3)
-		- k6*_q(n2,1)*_q(n5,1)*_q(n6,1)*_q(n1+n3+n4+n7,4)
-		+ k6*_q(n2+n5,2)*_q(n6,1)*_q(n1+n3+n4+n7,4)
-		+ k6*_q(n5,1)*_q(n2+n6,2)*_q(n1+n3+n4+n7,4)
-		+ k6*_q(n2,1)*_q(n5+n6,2)*_q(n1+n3+n4+n7,4)
-		- k12*_q(n2+n5+n6,3)*_q(n1+n3+n4+n7,4)
-		- k6*_q(n1,1)*_q(n5,1)*_q(n6,1)*_q(n2+n3+n4+n7,4)
-		+ k6*_q(n1+n5,2)*_q(n6,1)*_q(n2+n3+n4+n7,4)
-		+ k6*_q(n5,1)*_q(n1+n6,2)*_q(n2+n3+n4+n7,4)
-		+ k6*_q(n1,1)*_q(n5+n6,2)*_q(n2+n3+n4+n7,4)
-		- k12*_q(n1+n5+n6,3)*_q(n2+n3+n4+n7,4)
-		+ k24*_q(n5,1)*_q(n6,1)*_q(n1+n2+n3+n4+n7,5)
-		- k24*_q(n5+n6,2)*_q(n1+n2+n3+n4+n7,5)
-		- _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)
-		+ _q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)
-		- k2*_q(n1+n2+n3,3)*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n6,1)*_q(n5+n7,2)
-		- _q(n2+n3,2)*_q(n1+n4,2)*_q(n6,1)*_q(n5+n7,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n6,1)*_q(n5+n7,2)
-		- _q(n1+n3,2)*_q(n2+n4,2)*_q(n6,1)*_q(n5+n7,2)
-		- k2*_q(n3,1)*_q(n1+n2+n4,3)*_q(n6,1)*_q(n5+n7,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n6,1)*_q(n5+n7,2)
-		- _q(n1+n2,2)*_q(n3+n4,2)*_q(n6,1)*_q(n5+n7,2)
-		- k2*_q(n2,1)*_q(n1+n3+n4,3)*_q(n6,1)*_q(n5+n7,2)
-		- k2*_q(n1,1)*_q(n2+n3+n4,3)*_q(n6,1)*_q(n5+n7,2)
-		+ k6*_q(n1+n2+n3+n4,4)*_q(n6,1)*_q(n5+n7,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n6,2)*_q(n5+n7,2)
-		- _q(n2+n3,2)*_q(n4,1)*_q(n1+n6,2)*_q(n5+n7,2)
-		- _q(n3,1)*_q(n2+n4,2)*_q(n1+n6,2)*_q(n5+n7,2)
-		- _q(n2,1)*_q(n3+n4,2)*_q(n1+n6,2)*_q(n5+n7,2)
-		+ k2*_q(n2+n3+n4,3)*_q(n1+n6,2)*_q(n5+n7,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n6,2)*_q(n5+n7,2)
-		- _q(n1+n3,2)*_q(n4,1)*_q(n2+n6,2)*_q(n5+n7,2)
-		- _q(n3,1)*_q(n1+n4,2)*_q(n2+n6,2)*_q(n5+n7,2)
-		- _q(n1,1)*_q(n3+n4,2)*_q(n2+n6,2)*_q(n5+n7,2)
-		+ k2*_q(n1+n3+n4,3)*_q(n2+n6,2)*_q(n5+n7,2)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n1+n2+n6,3)*_q(n5+n7,2)
-		+ k2*_q(n3+n4,2)*_q(n1+n2+n6,3)*_q(n5+n7,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n6,2)*_q(n5+n7,2)
-		- _q(n1+n2,2)*_q(n4,1)*_q(n3+n6,2)*_q(n5+n7,2)
-		- _q(n2,1)*_q(n1+n4,2)*_q(n3+n6,2)*_q(n5+n7,2)
-		- _q(n1,1)*_q(n2+n4,2)*_q(n3+n6,2)*_q(n5+n7,2)
-		+ k2*_q(n1+n2+n4,3)*_q(n3+n6,2)*_q(n5+n7,2)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n1+n3+n6,3)*_q(n5+n7,2)
-		+ k2*_q(n2+n4,2)*_q(n1+n3+n6,3)*_q(n5+n7,2)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n2+n3+n6,3)*_q(n5+n7,2)
-		+ k2*_q(n1+n4,2)*_q(n2+n3+n6,3)*_q(n5+n7,2)
-		+ k6*_q(n4,1)*_q(n1+n2+n3+n6,4)*_q(n5+n7,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n6,2)*_q(n5+n7,2)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n4+n6,2)*_q(n5+n7,2)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n4+n6,2)*_q(n5+n7,2)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n4+n6,2)*_q(n5+n7,2)
-		+ k2*_q(n1+n2+n3,3)*_q(n4+n6,2)*_q(n5+n7,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n4+n6,3)*_q(n5+n7,2)
-		+ k2*_q(n2+n3,2)*_q(n1+n4+n6,3)*_q(n5+n7,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n4+n6,3)*_q(n5+n7,2)
-		+ k2*_q(n1+n3,2)*_q(n2+n4+n6,3)*_q(n5+n7,2)
-		+ k6*_q(n3,1)*_q(n1+n2+n4+n6,4)*_q(n5+n7,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n4+n6,3)*_q(n5+n7,2)
-		+ k2*_q(n1+n2,2)*_q(n3+n4+n6,3)*_q(n5+n7,2)
-		+ k6*_q(n2,1)*_q(n1+n3+n4+n6,4)*_q(n5+n7,2)
-		+ k6*_q(n1,1)*_q(n2+n3+n4+n6,4)*_q(n5+n7,2)
-		- k24*_q(n1+n2+n3+n4+n6,5)*_q(n5+n7,2)
-		+ k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n1+n5+n7,3)
-		- k2*_q(n2+n3,2)*_q(n4,1)*_q(n6,1)*_q(n1+n5+n7,3)
-		- k2*_q(n3,1)*_q(n2+n4,2)*_q(n6,1)*_q(n1+n5+n7,3)
-		- k2*_q(n2,1)*_q(n3+n4,2)*_q(n6,1)*_q(n1+n5+n7,3)
-		+ k4*_q(n2+n3+n4,3)*_q(n6,1)*_q(n1+n5+n7,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n2+n6,2)*_q(n1+n5+n7,3)
-		+ k2*_q(n3+n4,2)*_q(n2+n6,2)*_q(n1+n5+n7,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n3+n6,2)*_q(n1+n5+n7,3)
-		+ k2*_q(n2+n4,2)*_q(n3+n6,2)*_q(n1+n5+n7,3)
-		+ k4*_q(n4,1)*_q(n2+n3+n6,3)*_q(n1+n5+n7,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4+n6,2)*_q(n1+n5+n7,3)
-		+ k2*_q(n2+n3,2)*_q(n4+n6,2)*_q(n1+n5+n7,3)
-		+ k4*_q(n3,1)*_q(n2+n4+n6,3)*_q(n1+n5+n7,3)
-		+ k4*_q(n2,1)*_q(n3+n4+n6,3)*_q(n1+n5+n7,3)
-		- k12*_q(n2+n3+n4+n6,4)*_q(n1+n5+n7,3)
-		+ k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n2+n5+n7,3)
-		- k2*_q(n1+n3,2)*_q(n4,1)*_q(n6,1)*_q(n2+n5+n7,3)
-		- k2*_q(n3,1)*_q(n1+n4,2)*_q(n6,1)*_q(n2+n5+n7,3)
-		- k2*_q(n1,1)*_q(n3+n4,2)*_q(n6,1)*_q(n2+n5+n7,3)
-		+ k4*_q(n1+n3+n4,3)*_q(n6,1)*_q(n2+n5+n7,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n1+n6,2)*_q(n2+n5+n7,3)
-		+ k2*_q(n3+n4,2)*_q(n1+n6,2)*_q(n2+n5+n7,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n3+n6,2)*_q(n2+n5+n7,3)
-		+ k2*_q(n1+n4,2)*_q(n3+n6,2)*_q(n2+n5+n7,3)
-		+ k4*_q(n4,1)*_q(n1+n3+n6,3)*_q(n2+n5+n7,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4+n6,2)*_q(n2+n5+n7,3)
-		+ k2*_q(n1+n3,2)*_q(n4+n6,2)*_q(n2+n5+n7,3)
-		+ k4*_q(n3,1)*_q(n1+n4+n6,3)*_q(n2+n5+n7,3)
-		+ k4*_q(n1,1)*_q(n3+n4+n6,3)*_q(n2+n5+n7,3)
-		- k12*_q(n1+n3+n4+n6,4)*_q(n2+n5+n7,3)
-		- k6*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n1+n2+n5+n7,4)
-		+ k6*_q(n3+n4,2)*_q(n6,1)*_q(n1+n2+n5+n7,4)
-		+ k6*_q(n4,1)*_q(n3+n6,2)*_q(n1+n2+n5+n7,4)
-		+ k6*_q(n3,1)*_q(n4+n6,2)*_q(n1+n2+n5+n7,4)
-		- k12*_q(n3+n4+n6,3)*_q(n1+n2+n5+n7,4)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n6,1)*_q(n3+n5+n7,3)
-		- k2*_q(n1+n2,2)*_q(n4,1)*_q(n6,1)*_q(n3+n5+n7,3)
-		- k2*_q(n2,1)*_q(n1+n4,2)*_q(n6,1)*_q(n3+n5+n7,3)
-		- k2*_q(n1,1)*_q(n2+n4,2)*_q(n6,1)*_q(n3+n5+n7,3)
-		+ k4*_q(n1+n2+n4,3)*_q(n6,1)*_q(n3+n5+n7,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n1+n6,2)*_q(n3+n5+n7,3)
-		+ k2*_q(n2+n4,2)*_q(n1+n6,2)*_q(n3+n5+n7,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n2+n6,2)*_q(n3+n5+n7,3)
-		+ k2*_q(n1+n4,2)*_q(n2+n6,2)*_q(n3+n5+n7,3)
-		+ k4*_q(n4,1)*_q(n1+n2+n6,3)*_q(n3+n5+n7,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4+n6,2)*_q(n3+n5+n7,3)
-		+ k2*_q(n1+n2,2)*_q(n4+n6,2)*_q(n3+n5+n7,3)
-		+ k4*_q(n2,1)*_q(n1+n4+n6,3)*_q(n3+n5+n7,3)
-		+ k4*_q(n1,1)*_q(n2+n4+n6,3)*_q(n3+n5+n7,3)
-		- k12*_q(n1+n2+n4+n6,4)*_q(n3+n5+n7,3)
-		- k6*_q(n2,1)*_q(n4,1)*_q(n6,1)*_q(n1+n3+n5+n7,4)
-		+ k6*_q(n2+n4,2)*_q(n6,1)*_q(n1+n3+n5+n7,4)
-		+ k6*_q(n4,1)*_q(n2+n6,2)*_q(n1+n3+n5+n7,4)
-		+ k6*_q(n2,1)*_q(n4+n6,2)*_q(n1+n3+n5+n7,4)
-		- k12*_q(n2+n4+n6,3)*_q(n1+n3+n5+n7,4)
-		- k6*_q(n1,1)*_q(n4,1)*_q(n6,1)*_q(n2+n3+n5+n7,4)
-		+ k6*_q(n1+n4,2)*_q(n6,1)*_q(n2+n3+n5+n7,4)
-		+ k6*_q(n4,1)*_q(n1+n6,2)*_q(n2+n3+n5+n7,4)
-		+ k6*_q(n1,1)*_q(n4+n6,2)*_q(n2+n3+n5+n7,4)
-		- k12*_q(n1+n4+n6,3)*_q(n2+n3+n5+n7,4)
-		+ k24*_q(n4,1)*_q(n6,1)*_q(n1+n2+n3+n5+n7,5)
-		- k24*_q(n4+n6,2)*_q(n1+n2+n3+n5+n7,5)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n6,1)*_q(n4+n5+n7,3)
-		- k2*_q(n1+n2,2)*_q(n3,1)*_q(n6,1)*_q(n4+n5+n7,3)
-		- k2*_q(n2,1)*_q(n1+n3,2)*_q(n6,1)*_q(n4+n5+n7,3)
-		- k2*_q(n1,1)*_q(n2+n3,2)*_q(n6,1)*_q(n4+n5+n7,3)
-		+ k4*_q(n1+n2+n3,3)*_q(n6,1)*_q(n4+n5+n7,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n6,2)*_q(n4+n5+n7,3)
-		+ k2*_q(n2+n3,2)*_q(n1+n6,2)*_q(n4+n5+n7,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n6,2)*_q(n4+n5+n7,3)
-		+ k2*_q(n1+n3,2)*_q(n2+n6,2)*_q(n4+n5+n7,3)
-		+ k4*_q(n3,1)*_q(n1+n2+n6,3)*_q(n4+n5+n7,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n6,2)*_q(n4+n5+n7,3)
-		+ k2*_q(n1+n2,2)*_q(n3+n6,2)*_q(n4+n5+n7,3)
-		+ k4*_q(n2,1)*_q(n1+n3+n6,3)*_q(n4+n5+n7,3)
-		+ k4*_q(n1,1)*_q(n2+n3+n6,3)*_q(n4+n5+n7,3)
-		- k12*_q(n1+n2+n3+n6,4)*_q(n4+n5+n7,3)
-		- k6*_q(n2,1)*_q(n3,1)*_q(n6,1)*_q(n1+n4+n5+n7,4)
-		+ k6*_q(n2+n3,2)*_q(n6,1)*_q(n1+n4+n5+n7,4)
-		+ k6*_q(n3,1)*_q(n2+n6,2)*_q(n1+n4+n5+n7,4)
-		+ k6*_q(n2,1)*_q(n3+n6,2)*_q(n1+n4+n5+n7,4)
-		- k12*_q(n2+n3+n6,3)*_q(n1+n4+n5+n7,4)
-		- k6*_q(n1,1)*_q(n3,1)*_q(n6,1)*_q(n2+n4+n5+n7,4)
-		+ k6*_q(n1+n3,2)*_q(n6,1)*_q(n2+n4+n5+n7,4)
-		+ k6*_q(n3,1)*_q(n1+n6,2)*_q(n2+n4+n5+n7,4)
-		+ k6*_q(n1,1)*_q(n3+n6,2)*_q(n2+n4+n5+n7,4)
-		- k12*_q(n1+n3+n6,3)*_q(n2+n4+n5+n7,4)
-		+ k24*_q(n3,1)*_q(n6,1)*_q(n1+n2+n4+n5+n7,5)
-		- k24*_q(n3+n6,2)*_q(n1+n2+n4+n5+n7,5)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n6,1)*_q(n3+n4+n5+n7,4)
-		+ k6*_q(n1+n2,2)*_q(n6,1)*_q(n3+n4+n5+n7,4)
-		+ k6*_q(n2,1)*_q(n1+n6,2)*_q(n3+n4+n5+n7,4)
-		+ k6*_q(n1,1)*_q(n2+n6,2)*_q(n3+n4+n5+n7,4)
-		- k12*_q(n1+n2+n6,3)*_q(n3+n4+n5+n7,4)
-		+ k24*_q(n2,1)*_q(n6,1)*_q(n1+n3+n4+n5+n7,5)
-		- k24*_q(n2+n6,2)*_q(n1+n3+n4+n5+n7,5)
-		+ k24*_q(n1,1)*_q(n6,1)*_q(n2+n3+n4+n5+n7,5)
-		- k24*_q(n1+n6,2)*_q(n2+n3+n4+n5+n7,5)
-		- k120*_q(n6,1)*_q(n1+n2+n3+n4+n5+n7,6)
-		- _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)
-		+ _q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)
-		- k2*_q(n1+n2+n3,3)*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n6+n7,2)
-		- _q(n2+n3,2)*_q(n1+n4,2)*_q(n5,1)*_q(n6+n7,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n6+n7,2)
-		- _q(n1+n3,2)*_q(n2+n4,2)*_q(n5,1)*_q(n6+n7,2)
-		- k2*_q(n3,1)*_q(n1+n2+n4,3)*_q(n5,1)*_q(n6+n7,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n6+n7,2)
-		- _q(n1+n2,2)*_q(n3+n4,2)*_q(n5,1)*_q(n6+n7,2)
-		- k2*_q(n2,1)*_q(n1+n3+n4,3)*_q(n5,1)*_q(n6+n7,2)
-		- k2*_q(n1,1)*_q(n2+n3+n4,3)*_q(n5,1)*_q(n6+n7,2)
-		+ k6*_q(n1+n2+n3+n4,4)*_q(n5,1)*_q(n6+n7,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n6+n7,2)
-		- _q(n2+n3,2)*_q(n4,1)*_q(n1+n5,2)*_q(n6+n7,2)
-		- _q(n3,1)*_q(n2+n4,2)*_q(n1+n5,2)*_q(n6+n7,2)
-		- _q(n2,1)*_q(n3+n4,2)*_q(n1+n5,2)*_q(n6+n7,2)
-		+ k2*_q(n2+n3+n4,3)*_q(n1+n5,2)*_q(n6+n7,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n6+n7,2)
-		- _q(n1+n3,2)*_q(n4,1)*_q(n2+n5,2)*_q(n6+n7,2)
-		- _q(n3,1)*_q(n1+n4,2)*_q(n2+n5,2)*_q(n6+n7,2)
-		- _q(n1,1)*_q(n3+n4,2)*_q(n2+n5,2)*_q(n6+n7,2)
-		+ k2*_q(n1+n3+n4,3)*_q(n2+n5,2)*_q(n6+n7,2)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n1+n2+n5,3)*_q(n6+n7,2)
-		+ k2*_q(n3+n4,2)*_q(n1+n2+n5,3)*_q(n6+n7,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n6+n7,2)
-		- _q(n1+n2,2)*_q(n4,1)*_q(n3+n5,2)*_q(n6+n7,2)
-		- _q(n2,1)*_q(n1+n4,2)*_q(n3+n5,2)*_q(n6+n7,2)
-		- _q(n1,1)*_q(n2+n4,2)*_q(n3+n5,2)*_q(n6+n7,2)
-		+ k2*_q(n1+n2+n4,3)*_q(n3+n5,2)*_q(n6+n7,2)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n1+n3+n5,3)*_q(n6+n7,2)
-		+ k2*_q(n2+n4,2)*_q(n1+n3+n5,3)*_q(n6+n7,2)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n2+n3+n5,3)*_q(n6+n7,2)
-		+ k2*_q(n1+n4,2)*_q(n2+n3+n5,3)*_q(n6+n7,2)
-		+ k6*_q(n4,1)*_q(n1+n2+n3+n5,4)*_q(n6+n7,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n6+n7,2)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n4+n5,2)*_q(n6+n7,2)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n4+n5,2)*_q(n6+n7,2)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n4+n5,2)*_q(n6+n7,2)
-		+ k2*_q(n1+n2+n3,3)*_q(n4+n5,2)*_q(n6+n7,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n4+n5,3)*_q(n6+n7,2)
-		+ k2*_q(n2+n3,2)*_q(n1+n4+n5,3)*_q(n6+n7,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n4+n5,3)*_q(n6+n7,2)
-		+ k2*_q(n1+n3,2)*_q(n2+n4+n5,3)*_q(n6+n7,2)
-		+ k6*_q(n3,1)*_q(n1+n2+n4+n5,4)*_q(n6+n7,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n4+n5,3)*_q(n6+n7,2)
-		+ k2*_q(n1+n2,2)*_q(n3+n4+n5,3)*_q(n6+n7,2)
-		+ k6*_q(n2,1)*_q(n1+n3+n4+n5,4)*_q(n6+n7,2)
-		+ k6*_q(n1,1)*_q(n2+n3+n4+n5,4)*_q(n6+n7,2)
-		- k24*_q(n1+n2+n3+n4+n5,5)*_q(n6+n7,2)
-		+ k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n6+n7,3)
-		- k2*_q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n1+n6+n7,3)
-		- k2*_q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n1+n6+n7,3)
-		- k2*_q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n1+n6+n7,3)
-		+ k4*_q(n2+n3+n4,3)*_q(n5,1)*_q(n1+n6+n7,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n1+n6+n7,3)
-		+ k2*_q(n3+n4,2)*_q(n2+n5,2)*_q(n1+n6+n7,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n1+n6+n7,3)
-		+ k2*_q(n2+n4,2)*_q(n3+n5,2)*_q(n1+n6+n7,3)
-		+ k4*_q(n4,1)*_q(n2+n3+n5,3)*_q(n1+n6+n7,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n1+n6+n7,3)
-		+ k2*_q(n2+n3,2)*_q(n4+n5,2)*_q(n1+n6+n7,3)
-		+ k4*_q(n3,1)*_q(n2+n4+n5,3)*_q(n1+n6+n7,3)
-		+ k4*_q(n2,1)*_q(n3+n4+n5,3)*_q(n1+n6+n7,3)
-		- k12*_q(n2+n3+n4+n5,4)*_q(n1+n6+n7,3)
-		+ k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n2+n6+n7,3)
-		- k2*_q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n2+n6+n7,3)
-		- k2*_q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n2+n6+n7,3)
-		- k2*_q(n1,1)*_q(n3+n4,2)*_q(n5,1)*_q(n2+n6+n7,3)
-		+ k4*_q(n1+n3+n4,3)*_q(n5,1)*_q(n2+n6+n7,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n2+n6+n7,3)
-		+ k2*_q(n3+n4,2)*_q(n1+n5,2)*_q(n2+n6+n7,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n3+n5,2)*_q(n2+n6+n7,3)
-		+ k2*_q(n1+n4,2)*_q(n3+n5,2)*_q(n2+n6+n7,3)
-		+ k4*_q(n4,1)*_q(n1+n3+n5,3)*_q(n2+n6+n7,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4+n5,2)*_q(n2+n6+n7,3)
-		+ k2*_q(n1+n3,2)*_q(n4+n5,2)*_q(n2+n6+n7,3)
-		+ k4*_q(n3,1)*_q(n1+n4+n5,3)*_q(n2+n6+n7,3)
-		+ k4*_q(n1,1)*_q(n3+n4+n5,3)*_q(n2+n6+n7,3)
-		- k12*_q(n1+n3+n4+n5,4)*_q(n2+n6+n7,3)
-		- k6*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n2+n6+n7,4)
-		+ k6*_q(n3+n4,2)*_q(n5,1)*_q(n1+n2+n6+n7,4)
-		+ k6*_q(n4,1)*_q(n3+n5,2)*_q(n1+n2+n6+n7,4)
-		+ k6*_q(n3,1)*_q(n4+n5,2)*_q(n1+n2+n6+n7,4)
-		- k12*_q(n3+n4+n5,3)*_q(n1+n2+n6+n7,4)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n3+n6+n7,3)
-		- k2*_q(n1+n2,2)*_q(n4,1)*_q(n5,1)*_q(n3+n6+n7,3)
-		- k2*_q(n2,1)*_q(n1+n4,2)*_q(n5,1)*_q(n3+n6+n7,3)
-		- k2*_q(n1,1)*_q(n2+n4,2)*_q(n5,1)*_q(n3+n6+n7,3)
-		+ k4*_q(n1+n2+n4,3)*_q(n5,1)*_q(n3+n6+n7,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n1+n5,2)*_q(n3+n6+n7,3)
-		+ k2*_q(n2+n4,2)*_q(n1+n5,2)*_q(n3+n6+n7,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n2+n5,2)*_q(n3+n6+n7,3)
-		+ k2*_q(n1+n4,2)*_q(n2+n5,2)*_q(n3+n6+n7,3)
-		+ k4*_q(n4,1)*_q(n1+n2+n5,3)*_q(n3+n6+n7,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4+n5,2)*_q(n3+n6+n7,3)
-		+ k2*_q(n1+n2,2)*_q(n4+n5,2)*_q(n3+n6+n7,3)
-		+ k4*_q(n2,1)*_q(n1+n4+n5,3)*_q(n3+n6+n7,3)
-		+ k4*_q(n1,1)*_q(n2+n4+n5,3)*_q(n3+n6+n7,3)
-		- k12*_q(n1+n2+n4+n5,4)*_q(n3+n6+n7,3)
-		- k6*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n1+n3+n6+n7,4)
-		+ k6*_q(n2+n4,2)*_q(n5,1)*_q(n1+n3+n6+n7,4)
-		+ k6*_q(n4,1)*_q(n2+n5,2)*_q(n1+n3+n6+n7,4)
-		+ k6*_q(n2,1)*_q(n4+n5,2)*_q(n1+n3+n6+n7,4)
-		- k12*_q(n2+n4+n5,3)*_q(n1+n3+n6+n7,4)
-		- k6*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n2+n3+n6+n7,4)
-		+ k6*_q(n1+n4,2)*_q(n5,1)*_q(n2+n3+n6+n7,4)
-		+ k6*_q(n4,1)*_q(n1+n5,2)*_q(n2+n3+n6+n7,4)
-		+ k6*_q(n1,1)*_q(n4+n5,2)*_q(n2+n3+n6+n7,4)
-		- k12*_q(n1+n4+n5,3)*_q(n2+n3+n6+n7,4)
-		+ k24*_q(n4,1)*_q(n5,1)*_q(n1+n2+n3+n6+n7,5)
-		- k24*_q(n4+n5,2)*_q(n1+n2+n3+n6+n7,5)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n4+n6+n7,3)
-		- k2*_q(n1+n2,2)*_q(n3,1)*_q(n5,1)*_q(n4+n6+n7,3)
-		- k2*_q(n2,1)*_q(n1+n3,2)*_q(n5,1)*_q(n4+n6+n7,3)
-		- k2*_q(n1,1)*_q(n2+n3,2)*_q(n5,1)*_q(n4+n6+n7,3)
-		+ k4*_q(n1+n2+n3,3)*_q(n5,1)*_q(n4+n6+n7,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n5,2)*_q(n4+n6+n7,3)
-		+ k2*_q(n2+n3,2)*_q(n1+n5,2)*_q(n4+n6+n7,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n5,2)*_q(n4+n6+n7,3)
-		+ k2*_q(n1+n3,2)*_q(n2+n5,2)*_q(n4+n6+n7,3)
-		+ k4*_q(n3,1)*_q(n1+n2+n5,3)*_q(n4+n6+n7,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n5,2)*_q(n4+n6+n7,3)
-		+ k2*_q(n1+n2,2)*_q(n3+n5,2)*_q(n4+n6+n7,3)
-		+ k4*_q(n2,1)*_q(n1+n3+n5,3)*_q(n4+n6+n7,3)
-		+ k4*_q(n1,1)*_q(n2+n3+n5,3)*_q(n4+n6+n7,3)
-		- k12*_q(n1+n2+n3+n5,4)*_q(n4+n6+n7,3)
-		- k6*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n1+n4+n6+n7,4)
-		+ k6*_q(n2+n3,2)*_q(n5,1)*_q(n1+n4+n6+n7,4)
-		+ k6*_q(n3,1)*_q(n2+n5,2)*_q(n1+n4+n6+n7,4)
-		+ k6*_q(n2,1)*_q(n3+n5,2)*_q(n1+n4+n6+n7,4)
-		- k12*_q(n2+n3+n5,3)*_q(n1+n4+n6+n7,4)
-		- k6*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n2+n4+n6+n7,4)
-		+ k6*_q(n1+n3,2)*_q(n5,1)*_q(n2+n4+n6+n7,4)
-		+ k6*_q(n3,1)*_q(n1+n5,2)*_q(n2+n4+n6+n7,4)
-		+ k6*_q(n1,1)*_q(n3+n5,2)*_q(n2+n4+n6+n7,4)
-		- k12*_q(n1+n3+n5,3)*_q(n2+n4+n6+n7,4)
-		+ k24*_q(n3,1)*_q(n5,1)*_q(n1+n2+n4+n6+n7,5)
-		- k24*_q(n3+n5,2)*_q(n1+n2+n4+n6+n7,5)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n3+n4+n6+n7,4)
-		+ k6*_q(n1+n2,2)*_q(n5,1)*_q(n3+n4+n6+n7,4)
-		+ k6*_q(n2,1)*_q(n1+n5,2)*_q(n3+n4+n6+n7,4)
-		+ k6*_q(n1,1)*_q(n2+n5,2)*_q(n3+n4+n6+n7,4)
-		- k12*_q(n1+n2+n5,3)*_q(n3+n4+n6+n7,4)
-		+ k24*_q(n2,1)*_q(n5,1)*_q(n1+n3+n4+n6+n7,5)
-		- k24*_q(n2+n5,2)*_q(n1+n3+n4+n6+n7,5)
-		+ k24*_q(n1,1)*_q(n5,1)*_q(n2+n3+n4+n6+n7,5)
-		- k24*_q(n1+n5,2)*_q(n2+n3+n4+n6+n7,5)
-		- k120*_q(n5,1)*_q(n1+n2+n3+n4+n6+n7,6)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5+n6+n7,3)
-		- k2*_q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n5+n6+n7,3)
-		- k2*_q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n5+n6+n7,3)
-		- k2*_q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n5+n6+n7,3)
-		+ k4*_q(n1+n2+n3,3)*_q(n4,1)*_q(n5+n6+n7,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n5+n6+n7,3)
-		+ k2*_q(n2+n3,2)*_q(n1+n4,2)*_q(n5+n6+n7,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n5+n6+n7,3)
-		+ k2*_q(n1+n3,2)*_q(n2+n4,2)*_q(n5+n6+n7,3)
-		+ k4*_q(n3,1)*_q(n1+n2+n4,3)*_q(n5+n6+n7,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n5+n6+n7,3)
-		+ k2*_q(n1+n2,2)*_q(n3+n4,2)*_q(n5+n6+n7,3)
-		+ k4*_q(n2,1)*_q(n1+n3+n4,3)*_q(n5+n6+n7,3)
-		+ k4*_q(n1,1)*_q(n2+n3+n4,3)*_q(n5+n6+n7,3)
-		- k12*_q(n1+n2+n3+n4,4)*_q(n5+n6+n7,3)
-		- k6*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n5+n6+n7,4)
-		+ k6*_q(n2+n3,2)*_q(n4,1)*_q(n1+n5+n6+n7,4)
-		+ k6*_q(n3,1)*_q(n2+n4,2)*_q(n1+n5+n6+n7,4)
-		+ k6*_q(n2,1)*_q(n3+n4,2)*_q(n1+n5+n6+n7,4)
-		- k12*_q(n2+n3+n4,3)*_q(n1+n5+n6+n7,4)
-		- k6*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n5+n6+n7,4)
-		+ k6*_q(n1+n3,2)*_q(n4,1)*_q(n2+n5+n6+n7,4)
-		+ k6*_q(n3,1)*_q(n1+n4,2)*_q(n2+n5+n6+n7,4)
-		+ k6*_q(n1,1)*_q(n3+n4,2)*_q(n2+n5+n6+n7,4)
-		- k12*_q(n1+n3+n4,3)*_q(n2+n5+n6+n7,4)
-		+ k24*_q(n3,1)*_q(n4,1)*_q(n1+n2+n5+n6+n7,5)
-		- k24*_q(n3+n4,2)*_q(n1+n2+n5+n6+n7,5)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n5+n6+n7,4)
-		+ k6*_q(n1+n2,2)*_q(n4,1)*_q(n3+n5+n6+n7,4)
-		+ k6*_q(n2,1)*_q(n1+n4,2)*_q(n3+n5+n6+n7,4)
-		+ k6*_q(n1,1)*_q(n2+n4,2)*_q(n3+n5+n6+n7,4)
-		- k12*_q(n1+n2+n4,3)*_q(n3+n5+n6+n7,4)
-		+ k24*_q(n2,1)*_q(n4,1)*_q(n1+n3+n5+n6+n7,5)
-		- k24*_q(n2+n4,2)*_q(n1+n3+n5+n6+n7,5)
-		+ k24*_q(n1,1)*_q(n4,1)*_q(n2+n3+n5+n6+n7,5)
-		- k24*_q(n1+n4,2)*_q(n2+n3+n5+n6+n7,5)
-		- k120*_q(n4,1)*_q(n1+n2+n3+n5+n6+n7,6)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n5+n6+n7,4)
-		+ k6*_q(n1+n2,2)*_q(n3,1)*_q(n4+n5+n6+n7,4)
-		+ k6*_q(n2,1)*_q(n1+n3,2)*_q(n4+n5+n6+n7,4)
-		+ k6*_q(n1,1)*_q(n2+n3,2)*_q(n4+n5+n6+n7,4)
-		- k12*_q(n1+n2+n3,3)*_q(n4+n5+n6+n7,4)
-		+ k24*_q(n2,1)*_q(n3,1)*_q(n1+n4+n5+n6+n7,5)
-		- k24*_q(n2+n3,2)*_q(n1+n4+n5+n6+n7,5)
-		+ k24*_q(n1,1)*_q(n3,1)*_q(n2+n4+n5+n6+n7,5)
-		- k24*_q(n1+n3,2)*_q(n2+n4+n5+n6+n7,5)
-		- k120*_q(n3,1)*_q(n1+n2+n4+n5+n6+n7,6)
-		+ k24*_q(n1,1)*_q(n2,1)*_q(n3+n4+n5+n6+n7,5)
-		- k24*_q(n1+n2,2)*_q(n3+n4+n5+n6+n7,5)
-		- k120*_q(n2,1)*_q(n1+n3+n4+n5+n6+n7,6)
-		- k120*_q(n1,1)*_q(n2+n3+n4+n5+n6+n7,6)
-		+ k720*_q(n1+n2+n3+n4+n5+n6+n7,7));
-      }
-#else
-      virtual Complex uc7(const Harmonic,
-			  const Harmonic,
-			  const Harmonic,
-			  const Harmonic,
-			  const Harmonic,
-			  const Harmonic,
-			  const Harmonic) const
-      {
-	std::cerr << "closed-form un-corrected 7-paritlce correlator disabled at compile-time" << std::endl;
-	return Complex(0,0);
-      }
-#endif // CORRELATIONS_CLOSED_IGNORE_U7
-#ifdef CORRELATIONS_CLOSED_ENABLE_U8
-      Complex uc8P1(const Harmonic n1,
-		    const Harmonic n2,
-		    const Harmonic n3,
-		    const Harmonic n4,
-		    const Harmonic n5,
-		    const Harmonic n6,
-		    const Harmonic n7,
-		    const Harmonic n8) const
-      {
- 	const Real k2   = 2;
-	const Real k4   = 4;
-	const Real k6   = 6;
-	const Real k12  = 12;
-	const Real k24  = 24;
-	// const Real k36  = 36;
-	// const Real k48  = 48;
-	const Real k120 = 120;
-	const Real k720 = 720;
-	return (_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n1+n2+n3,3)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- _q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ _q(n2+n3,2)*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- _q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ _q(n1+n3,2)*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n3,1)*_q(n1+n2+n4,3)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- _q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ _q(n1+n2,2)*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n2,1)*_q(n1+n3+n4,3)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n2+n3+n4,3)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- k6*_q(n1+n2+n3+n4,4)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ _q(n2+n3,2)*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ _q(n3,1)*_q(n2+n4,2)*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ _q(n2,1)*_q(n3+n4,2)*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n2+n3+n4,3)*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ _q(n1+n3,2)*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ _q(n3,1)*_q(n1+n4,2)*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ _q(n1,1)*_q(n3+n4,2)*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1+n3+n4,3)*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n3,1)*_q(n4,1)*_q(n1+n2+n5,3)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n3+n4,2)*_q(n1+n2+n5,3)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ _q(n1+n2,2)*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ _q(n2,1)*_q(n1+n4,2)*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ _q(n1,1)*_q(n2+n4,2)*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1+n2+n4,3)*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n2,1)*_q(n4,1)*_q(n1+n3+n5,3)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n2+n4,2)*_q(n1+n3+n5,3)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n4,1)*_q(n2+n3+n5,3)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1+n4,2)*_q(n2+n3+n5,3)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- k6*_q(n4,1)*_q(n1+n2+n3+n5,4)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ _q(n2,1)*_q(n1+n3,2)*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1+n2+n3,3)*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n2,1)*_q(n3,1)*_q(n1+n4+n5,3)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n2+n3,2)*_q(n1+n4+n5,3)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n3,1)*_q(n2+n4+n5,3)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1+n3,2)*_q(n2+n4+n5,3)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- k6*_q(n3,1)*_q(n1+n2+n4+n5,4)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n3+n4+n5,3)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1+n2,2)*_q(n3+n4+n5,3)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- k6*_q(n2,1)*_q(n1+n3+n4+n5,4)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- k6*_q(n1,1)*_q(n2+n3+n4+n5,4)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		+ k24*_q(n1+n2+n3+n4+n5,5)*_q(n6,1)*_q(n7,1)*_q(n8,1)
-		- _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n2+n3+n4,3)*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n1+n6,2)*_q(n7,1)*_q(n8,1)
-		- _q(n3+n4,2)*_q(n2+n5,2)*_q(n1+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n1+n6,2)*_q(n7,1)*_q(n8,1)
-		- _q(n2+n4,2)*_q(n3+n5,2)*_q(n1+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n4,1)*_q(n2+n3+n5,3)*_q(n1+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n1+n6,2)*_q(n7,1)*_q(n8,1)
-		- _q(n2+n3,2)*_q(n4+n5,2)*_q(n1+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n2+n4+n5,3)*_q(n1+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n3+n4+n5,3)*_q(n1+n6,2)*_q(n7,1)*_q(n8,1)
-		+ k6*_q(n2+n3+n4+n5,4)*_q(n1+n6,2)*_q(n7,1)*_q(n8,1)
-		- _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n1,1)*_q(n3+n4,2)*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1+n3+n4,3)*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n2+n6,2)*_q(n7,1)*_q(n8,1)
-		- _q(n3+n4,2)*_q(n1+n5,2)*_q(n2+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n1,1)*_q(n4,1)*_q(n3+n5,2)*_q(n2+n6,2)*_q(n7,1)*_q(n8,1)
-		- _q(n1+n4,2)*_q(n3+n5,2)*_q(n2+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n4,1)*_q(n1+n3+n5,3)*_q(n2+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n1,1)*_q(n3,1)*_q(n4+n5,2)*_q(n2+n6,2)*_q(n7,1)*_q(n8,1)
-		- _q(n1+n3,2)*_q(n4+n5,2)*_q(n2+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n1+n4+n5,3)*_q(n2+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n3+n4+n5,3)*_q(n2+n6,2)*_q(n7,1)*_q(n8,1)
-		+ k6*_q(n1+n3+n4+n5,4)*_q(n2+n6,2)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n2+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n3+n4,2)*_q(n5,1)*_q(n1+n2+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n4,1)*_q(n3+n5,2)*_q(n1+n2+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n4+n5,2)*_q(n1+n2+n6,3)*_q(n7,1)*_q(n8,1)
-		+ k4*_q(n3+n4+n5,3)*_q(n1+n2+n6,3)*_q(n7,1)*_q(n8,1)
-		- _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n1+n2,2)*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n2,1)*_q(n1+n4,2)*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n1,1)*_q(n2+n4,2)*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1+n2+n4,3)*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n2,1)*_q(n4,1)*_q(n1+n5,2)*_q(n3+n6,2)*_q(n7,1)*_q(n8,1)
-		- _q(n2+n4,2)*_q(n1+n5,2)*_q(n3+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n1,1)*_q(n4,1)*_q(n2+n5,2)*_q(n3+n6,2)*_q(n7,1)*_q(n8,1)
-		- _q(n1+n4,2)*_q(n2+n5,2)*_q(n3+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n4,1)*_q(n1+n2+n5,3)*_q(n3+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n1,1)*_q(n2,1)*_q(n4+n5,2)*_q(n3+n6,2)*_q(n7,1)*_q(n8,1)
-		- _q(n1+n2,2)*_q(n4+n5,2)*_q(n3+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n1+n4+n5,3)*_q(n3+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2+n4+n5,3)*_q(n3+n6,2)*_q(n7,1)*_q(n8,1)
-		+ k6*_q(n1+n2+n4+n5,4)*_q(n3+n6,2)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n1+n3+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n2+n4,2)*_q(n5,1)*_q(n1+n3+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n4,1)*_q(n2+n5,2)*_q(n1+n3+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n4+n5,2)*_q(n1+n3+n6,3)*_q(n7,1)*_q(n8,1)
-		+ k4*_q(n2+n4+n5,3)*_q(n1+n3+n6,3)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n2+n3+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1+n4,2)*_q(n5,1)*_q(n2+n3+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n4,1)*_q(n1+n5,2)*_q(n2+n3+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n4+n5,2)*_q(n2+n3+n6,3)*_q(n7,1)*_q(n8,1)
-		+ k4*_q(n1+n4+n5,3)*_q(n2+n3+n6,3)*_q(n7,1)*_q(n8,1)
-		- k6*_q(n4,1)*_q(n5,1)*_q(n1+n2+n3+n6,4)*_q(n7,1)*_q(n8,1)
-		+ k6*_q(n4+n5,2)*_q(n1+n2+n3+n6,4)*_q(n7,1)*_q(n8,1)
-		- _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n2,1)*_q(n1+n3,2)*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1+n2+n3,3)*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n2,1)*_q(n3,1)*_q(n1+n5,2)*_q(n4+n6,2)*_q(n7,1)*_q(n8,1)
-		- _q(n2+n3,2)*_q(n1+n5,2)*_q(n4+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n1,1)*_q(n3,1)*_q(n2+n5,2)*_q(n4+n6,2)*_q(n7,1)*_q(n8,1)
-		- _q(n1+n3,2)*_q(n2+n5,2)*_q(n4+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n1+n2+n5,3)*_q(n4+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n1,1)*_q(n2,1)*_q(n3+n5,2)*_q(n4+n6,2)*_q(n7,1)*_q(n8,1)
-		- _q(n1+n2,2)*_q(n3+n5,2)*_q(n4+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n1+n3+n5,3)*_q(n4+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2+n3+n5,3)*_q(n4+n6,2)*_q(n7,1)*_q(n8,1)
-		+ k6*_q(n1+n2+n3+n5,4)*_q(n4+n6,2)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n1+n4+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n2+n3,2)*_q(n5,1)*_q(n1+n4+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n2+n5,2)*_q(n1+n4+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n3+n5,2)*_q(n1+n4+n6,3)*_q(n7,1)*_q(n8,1)
-		+ k4*_q(n2+n3+n5,3)*_q(n1+n4+n6,3)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n2+n4+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1+n3,2)*_q(n5,1)*_q(n2+n4+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n1+n5,2)*_q(n2+n4+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n3+n5,2)*_q(n2+n4+n6,3)*_q(n7,1)*_q(n8,1)
-		+ k4*_q(n1+n3+n5,3)*_q(n2+n4+n6,3)*_q(n7,1)*_q(n8,1)
-		- k6*_q(n3,1)*_q(n5,1)*_q(n1+n2+n4+n6,4)*_q(n7,1)*_q(n8,1)
-		+ k6*_q(n3+n5,2)*_q(n1+n2+n4+n6,4)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n3+n4+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1+n2,2)*_q(n5,1)*_q(n3+n4+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n1+n5,2)*_q(n3+n4+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2+n5,2)*_q(n3+n4+n6,3)*_q(n7,1)*_q(n8,1)
-		+ k4*_q(n1+n2+n5,3)*_q(n3+n4+n6,3)*_q(n7,1)*_q(n8,1)
-		- k6*_q(n2,1)*_q(n5,1)*_q(n1+n3+n4+n6,4)*_q(n7,1)*_q(n8,1)
-		+ k6*_q(n2+n5,2)*_q(n1+n3+n4+n6,4)*_q(n7,1)*_q(n8,1)
-		- k6*_q(n1,1)*_q(n5,1)*_q(n2+n3+n4+n6,4)*_q(n7,1)*_q(n8,1)
-		+ k6*_q(n1+n5,2)*_q(n2+n3+n4+n6,4)*_q(n7,1)*_q(n8,1)
-		+ k24*_q(n5,1)*_q(n1+n2+n3+n4+n6,5)*_q(n7,1)*_q(n8,1)
-		- _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1+n2+n3,3)*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n5+n6,2)*_q(n7,1)*_q(n8,1)
-		- _q(n2+n3,2)*_q(n1+n4,2)*_q(n5+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n5+n6,2)*_q(n7,1)*_q(n8,1)
-		- _q(n1+n3,2)*_q(n2+n4,2)*_q(n5+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n1+n2+n4,3)*_q(n5+n6,2)*_q(n7,1)*_q(n8,1)
-		+ _q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n5+n6,2)*_q(n7,1)*_q(n8,1)
-		- _q(n1+n2,2)*_q(n3+n4,2)*_q(n5+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n1+n3+n4,3)*_q(n5+n6,2)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2+n3+n4,3)*_q(n5+n6,2)*_q(n7,1)*_q(n8,1)
-		+ k6*_q(n1+n2+n3+n4,4)*_q(n5+n6,2)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n2+n3,2)*_q(n4,1)*_q(n1+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n2+n4,2)*_q(n1+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n3+n4,2)*_q(n1+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		+ k4*_q(n2+n3+n4,3)*_q(n1+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1+n3,2)*_q(n4,1)*_q(n2+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n1+n4,2)*_q(n2+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n3+n4,2)*_q(n2+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		+ k4*_q(n1+n3+n4,3)*_q(n2+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		- k6*_q(n3,1)*_q(n4,1)*_q(n1+n2+n5+n6,4)*_q(n7,1)*_q(n8,1)
-		+ k6*_q(n3+n4,2)*_q(n1+n2+n5+n6,4)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1+n2,2)*_q(n4,1)*_q(n3+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n1+n4,2)*_q(n3+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2+n4,2)*_q(n3+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		+ k4*_q(n1+n2+n4,3)*_q(n3+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		- k6*_q(n2,1)*_q(n4,1)*_q(n1+n3+n5+n6,4)*_q(n7,1)*_q(n8,1)
-		+ k6*_q(n2+n4,2)*_q(n1+n3+n5+n6,4)*_q(n7,1)*_q(n8,1)
-		- k6*_q(n1,1)*_q(n4,1)*_q(n2+n3+n5+n6,4)*_q(n7,1)*_q(n8,1)
-		+ k6*_q(n1+n4,2)*_q(n2+n3+n5+n6,4)*_q(n7,1)*_q(n8,1)
-		+ k24*_q(n4,1)*_q(n1+n2+n3+n5+n6,5)*_q(n7,1)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1+n2,2)*_q(n3,1)*_q(n4+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n1+n3,2)*_q(n4+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2+n3,2)*_q(n4+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		+ k4*_q(n1+n2+n3,3)*_q(n4+n5+n6,3)*_q(n7,1)*_q(n8,1)
-		- k6*_q(n2,1)*_q(n3,1)*_q(n1+n4+n5+n6,4)*_q(n7,1)*_q(n8,1)
-		+ k6*_q(n2+n3,2)*_q(n1+n4+n5+n6,4)*_q(n7,1)*_q(n8,1)
-		- k6*_q(n1,1)*_q(n3,1)*_q(n2+n4+n5+n6,4)*_q(n7,1)*_q(n8,1)
-		+ k6*_q(n1+n3,2)*_q(n2+n4+n5+n6,4)*_q(n7,1)*_q(n8,1)
-		+ k24*_q(n3,1)*_q(n1+n2+n4+n5+n6,5)*_q(n7,1)*_q(n8,1)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n3+n4+n5+n6,4)*_q(n7,1)*_q(n8,1)
-		+ k6*_q(n1+n2,2)*_q(n3+n4+n5+n6,4)*_q(n7,1)*_q(n8,1)
-		+ k24*_q(n2,1)*_q(n1+n3+n4+n5+n6,5)*_q(n7,1)*_q(n8,1)
-		+ k24*_q(n1,1)*_q(n2+n3+n4+n5+n6,5)*_q(n7,1)*_q(n8,1)
-		- k120*_q(n1+n2+n3+n4+n5+n6,6)*_q(n7,1)*_q(n8,1)
-		- _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)*_q(n8,1)
-		+ _q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)*_q(n8,1)
-		+ _q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)*_q(n8,1)
-		+ _q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)*_q(n8,1)
-		- k2*_q(n2+n3+n4,3)*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)*_q(n8,1)
-		+ _q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n1+n7,2)*_q(n8,1)
-		- _q(n3+n4,2)*_q(n2+n5,2)*_q(n6,1)*_q(n1+n7,2)*_q(n8,1)
-		+ _q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n1+n7,2)*_q(n8,1)
-		- _q(n2+n4,2)*_q(n3+n5,2)*_q(n6,1)*_q(n1+n7,2)*_q(n8,1)
-		- k2*_q(n4,1)*_q(n2+n3+n5,3)*_q(n6,1)*_q(n1+n7,2)*_q(n8,1)
-		+ _q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n1+n7,2)*_q(n8,1)
-		- _q(n2+n3,2)*_q(n4+n5,2)*_q(n6,1)*_q(n1+n7,2)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n2+n4+n5,3)*_q(n6,1)*_q(n1+n7,2)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n3+n4+n5,3)*_q(n6,1)*_q(n1+n7,2)*_q(n8,1)
-		+ k6*_q(n2+n3+n4+n5,4)*_q(n6,1)*_q(n1+n7,2)*_q(n8,1)
-		+ _q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		- _q(n3+n4,2)*_q(n5,1)*_q(n2+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		- _q(n4,1)*_q(n3+n5,2)*_q(n2+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		- _q(n3,1)*_q(n4+n5,2)*_q(n2+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		+ k2*_q(n3+n4+n5,3)*_q(n2+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		+ _q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		- _q(n2+n4,2)*_q(n5,1)*_q(n3+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		- _q(n4,1)*_q(n2+n5,2)*_q(n3+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		- _q(n2,1)*_q(n4+n5,2)*_q(n3+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		+ k2*_q(n2+n4+n5,3)*_q(n3+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n2+n3+n6,3)*_q(n1+n7,2)*_q(n8,1)
-		+ k2*_q(n4+n5,2)*_q(n2+n3+n6,3)*_q(n1+n7,2)*_q(n8,1)
-		+ _q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		- _q(n2+n3,2)*_q(n5,1)*_q(n4+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		- _q(n3,1)*_q(n2+n5,2)*_q(n4+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		- _q(n2,1)*_q(n3+n5,2)*_q(n4+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		+ k2*_q(n2+n3+n5,3)*_q(n4+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n2+n4+n6,3)*_q(n1+n7,2)*_q(n8,1)
-		+ k2*_q(n3+n5,2)*_q(n2+n4+n6,3)*_q(n1+n7,2)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n3+n4+n6,3)*_q(n1+n7,2)*_q(n8,1)
-		+ k2*_q(n2+n5,2)*_q(n3+n4+n6,3)*_q(n1+n7,2)*_q(n8,1)
-		+ k6*_q(n5,1)*_q(n2+n3+n4+n6,4)*_q(n1+n7,2)*_q(n8,1)
-		+ _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		- _q(n2+n3,2)*_q(n4,1)*_q(n5+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		- _q(n3,1)*_q(n2+n4,2)*_q(n5+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		- _q(n2,1)*_q(n3+n4,2)*_q(n5+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		+ k2*_q(n2+n3+n4,3)*_q(n5+n6,2)*_q(n1+n7,2)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n2+n5+n6,3)*_q(n1+n7,2)*_q(n8,1)
-		+ k2*_q(n3+n4,2)*_q(n2+n5+n6,3)*_q(n1+n7,2)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n3+n5+n6,3)*_q(n1+n7,2)*_q(n8,1)
-		+ k2*_q(n2+n4,2)*_q(n3+n5+n6,3)*_q(n1+n7,2)*_q(n8,1)
-		+ k6*_q(n4,1)*_q(n2+n3+n5+n6,4)*_q(n1+n7,2)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4+n5+n6,3)*_q(n1+n7,2)*_q(n8,1)
-		+ k2*_q(n2+n3,2)*_q(n4+n5+n6,3)*_q(n1+n7,2)*_q(n8,1)
-		+ k6*_q(n3,1)*_q(n2+n4+n5+n6,4)*_q(n1+n7,2)*_q(n8,1)
-		+ k6*_q(n2,1)*_q(n3+n4+n5+n6,4)*_q(n1+n7,2)*_q(n8,1)
-		- k24*_q(n2+n3+n4+n5+n6,5)*_q(n1+n7,2)*_q(n8,1)
-		- _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)*_q(n8,1)
-		+ _q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)*_q(n8,1)
-		+ _q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)*_q(n8,1)
-		- k2*_q(n1+n3+n4,3)*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)*_q(n8,1)
-		+ _q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n2+n7,2)*_q(n8,1)
-		- _q(n3+n4,2)*_q(n1+n5,2)*_q(n6,1)*_q(n2+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n2+n7,2)*_q(n8,1)
-		- _q(n1+n4,2)*_q(n3+n5,2)*_q(n6,1)*_q(n2+n7,2)*_q(n8,1)
-		- k2*_q(n4,1)*_q(n1+n3+n5,3)*_q(n6,1)*_q(n2+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n2+n7,2)*_q(n8,1)
-		- _q(n1+n3,2)*_q(n4+n5,2)*_q(n6,1)*_q(n2+n7,2)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n1+n4+n5,3)*_q(n6,1)*_q(n2+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n3+n4+n5,3)*_q(n6,1)*_q(n2+n7,2)*_q(n8,1)
-		+ k6*_q(n1+n3+n4+n5,4)*_q(n6,1)*_q(n2+n7,2)*_q(n8,1)
-		+ _q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		- _q(n3+n4,2)*_q(n5,1)*_q(n1+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		- _q(n4,1)*_q(n3+n5,2)*_q(n1+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		- _q(n3,1)*_q(n4+n5,2)*_q(n1+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		+ k2*_q(n3+n4+n5,3)*_q(n1+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		- _q(n1+n4,2)*_q(n5,1)*_q(n3+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		- _q(n4,1)*_q(n1+n5,2)*_q(n3+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		- _q(n1,1)*_q(n4+n5,2)*_q(n3+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n4+n5,3)*_q(n3+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n1+n3+n6,3)*_q(n2+n7,2)*_q(n8,1)
-		+ k2*_q(n4+n5,2)*_q(n1+n3+n6,3)*_q(n2+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		- _q(n1+n3,2)*_q(n5,1)*_q(n4+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		- _q(n3,1)*_q(n1+n5,2)*_q(n4+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		- _q(n1,1)*_q(n3+n5,2)*_q(n4+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n3+n5,3)*_q(n4+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n1+n4+n6,3)*_q(n2+n7,2)*_q(n8,1)
-		+ k2*_q(n3+n5,2)*_q(n1+n4+n6,3)*_q(n2+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n3+n4+n6,3)*_q(n2+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n5,2)*_q(n3+n4+n6,3)*_q(n2+n7,2)*_q(n8,1)
-		+ k6*_q(n5,1)*_q(n1+n3+n4+n6,4)*_q(n2+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		- _q(n1+n3,2)*_q(n4,1)*_q(n5+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		- _q(n3,1)*_q(n1+n4,2)*_q(n5+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		- _q(n1,1)*_q(n3+n4,2)*_q(n5+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n3+n4,3)*_q(n5+n6,2)*_q(n2+n7,2)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n1+n5+n6,3)*_q(n2+n7,2)*_q(n8,1)
-		+ k2*_q(n3+n4,2)*_q(n1+n5+n6,3)*_q(n2+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n3+n5+n6,3)*_q(n2+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n4,2)*_q(n3+n5+n6,3)*_q(n2+n7,2)*_q(n8,1)
-		+ k6*_q(n4,1)*_q(n1+n3+n5+n6,4)*_q(n2+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4+n5+n6,3)*_q(n2+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n3,2)*_q(n4+n5+n6,3)*_q(n2+n7,2)*_q(n8,1)
-		+ k6*_q(n3,1)*_q(n1+n4+n5+n6,4)*_q(n2+n7,2)*_q(n8,1)
-		+ k6*_q(n1,1)*_q(n3+n4+n5+n6,4)*_q(n2+n7,2)*_q(n8,1)
-		- k24*_q(n1+n3+n4+n5+n6,5)*_q(n2+n7,2)*_q(n8,1)
-		+ k2*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n2+n7,3)*_q(n8,1)
-		- k2*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n1+n2+n7,3)*_q(n8,1)
-		- k2*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n1+n2+n7,3)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n1+n2+n7,3)*_q(n8,1)
-		+ k4*_q(n3+n4+n5,3)*_q(n6,1)*_q(n1+n2+n7,3)*_q(n8,1)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n1+n2+n7,3)*_q(n8,1)
-		+ k2*_q(n4+n5,2)*_q(n3+n6,2)*_q(n1+n2+n7,3)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n1+n2+n7,3)*_q(n8,1)
-		+ k2*_q(n3+n5,2)*_q(n4+n6,2)*_q(n1+n2+n7,3)*_q(n8,1)
-		+ k4*_q(n5,1)*_q(n3+n4+n6,3)*_q(n1+n2+n7,3)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n1+n2+n7,3)*_q(n8,1)
-		+ k2*_q(n3+n4,2)*_q(n5+n6,2)*_q(n1+n2+n7,3)*_q(n8,1)
-		+ k4*_q(n4,1)*_q(n3+n5+n6,3)*_q(n1+n2+n7,3)*_q(n8,1)
-		+ k4*_q(n3,1)*_q(n4+n5+n6,3)*_q(n1+n2+n7,3)*_q(n8,1)
-		- k12*_q(n3+n4+n5+n6,4)*_q(n1+n2+n7,3)*_q(n8,1)
-		- _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)*_q(n8,1)
-		+ _q(n1+n2,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)*_q(n8,1)
-		+ _q(n2,1)*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)*_q(n8,1)
-		- k2*_q(n1+n2+n4,3)*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)*_q(n8,1)
-		+ _q(n2,1)*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n3+n7,2)*_q(n8,1)
-		- _q(n2+n4,2)*_q(n1+n5,2)*_q(n6,1)*_q(n3+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n3+n7,2)*_q(n8,1)
-		- _q(n1+n4,2)*_q(n2+n5,2)*_q(n6,1)*_q(n3+n7,2)*_q(n8,1)
-		- k2*_q(n4,1)*_q(n1+n2+n5,3)*_q(n6,1)*_q(n3+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n2,1)*_q(n4+n5,2)*_q(n6,1)*_q(n3+n7,2)*_q(n8,1)
-		- _q(n1+n2,2)*_q(n4+n5,2)*_q(n6,1)*_q(n3+n7,2)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n1+n4+n5,3)*_q(n6,1)*_q(n3+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2+n4+n5,3)*_q(n6,1)*_q(n3+n7,2)*_q(n8,1)
-		+ k6*_q(n1+n2+n4+n5,4)*_q(n6,1)*_q(n3+n7,2)*_q(n8,1)
-		+ _q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		- _q(n2+n4,2)*_q(n5,1)*_q(n1+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		- _q(n4,1)*_q(n2+n5,2)*_q(n1+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		- _q(n2,1)*_q(n4+n5,2)*_q(n1+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		+ k2*_q(n2+n4+n5,3)*_q(n1+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		- _q(n1+n4,2)*_q(n5,1)*_q(n2+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		- _q(n4,1)*_q(n1+n5,2)*_q(n2+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		- _q(n1,1)*_q(n4+n5,2)*_q(n2+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n4+n5,3)*_q(n2+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n1+n2+n6,3)*_q(n3+n7,2)*_q(n8,1)
-		+ k2*_q(n4+n5,2)*_q(n1+n2+n6,3)*_q(n3+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n4+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		- _q(n1+n2,2)*_q(n5,1)*_q(n4+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		- _q(n2,1)*_q(n1+n5,2)*_q(n4+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		- _q(n1,1)*_q(n2+n5,2)*_q(n4+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n2+n5,3)*_q(n4+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n1+n4+n6,3)*_q(n3+n7,2)*_q(n8,1)
-		+ k2*_q(n2+n5,2)*_q(n1+n4+n6,3)*_q(n3+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n2+n4+n6,3)*_q(n3+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n5,2)*_q(n2+n4+n6,3)*_q(n3+n7,2)*_q(n8,1)
-		+ k6*_q(n5,1)*_q(n1+n2+n4+n6,4)*_q(n3+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		- _q(n1+n2,2)*_q(n4,1)*_q(n5+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		- _q(n2,1)*_q(n1+n4,2)*_q(n5+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		- _q(n1,1)*_q(n2+n4,2)*_q(n5+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n2+n4,3)*_q(n5+n6,2)*_q(n3+n7,2)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n1+n5+n6,3)*_q(n3+n7,2)*_q(n8,1)
-		+ k2*_q(n2+n4,2)*_q(n1+n5+n6,3)*_q(n3+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n2+n5+n6,3)*_q(n3+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n4,2)*_q(n2+n5+n6,3)*_q(n3+n7,2)*_q(n8,1)
-		+ k6*_q(n4,1)*_q(n1+n2+n5+n6,4)*_q(n3+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4+n5+n6,3)*_q(n3+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n2,2)*_q(n4+n5+n6,3)*_q(n3+n7,2)*_q(n8,1)
-		+ k6*_q(n2,1)*_q(n1+n4+n5+n6,4)*_q(n3+n7,2)*_q(n8,1)
-		+ k6*_q(n1,1)*_q(n2+n4+n5+n6,4)*_q(n3+n7,2)*_q(n8,1)
-		- k24*_q(n1+n2+n4+n5+n6,5)*_q(n3+n7,2)*_q(n8,1)
-		+ k2*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n3+n7,3)*_q(n8,1)
-		- k2*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n1+n3+n7,3)*_q(n8,1)
-		- k2*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n1+n3+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n4+n5,2)*_q(n6,1)*_q(n1+n3+n7,3)*_q(n8,1)
-		+ k4*_q(n2+n4+n5,3)*_q(n6,1)*_q(n1+n3+n7,3)*_q(n8,1)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n1+n3+n7,3)*_q(n8,1)
-		+ k2*_q(n4+n5,2)*_q(n2+n6,2)*_q(n1+n3+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n4+n6,2)*_q(n1+n3+n7,3)*_q(n8,1)
-		+ k2*_q(n2+n5,2)*_q(n4+n6,2)*_q(n1+n3+n7,3)*_q(n8,1)
-		+ k4*_q(n5,1)*_q(n2+n4+n6,3)*_q(n1+n3+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n5+n6,2)*_q(n1+n3+n7,3)*_q(n8,1)
-		+ k2*_q(n2+n4,2)*_q(n5+n6,2)*_q(n1+n3+n7,3)*_q(n8,1)
-		+ k4*_q(n4,1)*_q(n2+n5+n6,3)*_q(n1+n3+n7,3)*_q(n8,1)
-		+ k4*_q(n2,1)*_q(n4+n5+n6,3)*_q(n1+n3+n7,3)*_q(n8,1)
-		- k12*_q(n2+n4+n5+n6,4)*_q(n1+n3+n7,3)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n2+n3+n7,3)*_q(n8,1)
-		- k2*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n2+n3+n7,3)*_q(n8,1)
-		- k2*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n2+n3+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n4+n5,2)*_q(n6,1)*_q(n2+n3+n7,3)*_q(n8,1)
-		+ k4*_q(n1+n4+n5,3)*_q(n6,1)*_q(n2+n3+n7,3)*_q(n8,1)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n2+n3+n7,3)*_q(n8,1)
-		+ k2*_q(n4+n5,2)*_q(n1+n6,2)*_q(n2+n3+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n4+n6,2)*_q(n2+n3+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n5,2)*_q(n4+n6,2)*_q(n2+n3+n7,3)*_q(n8,1)
-		+ k4*_q(n5,1)*_q(n1+n4+n6,3)*_q(n2+n3+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n5+n6,2)*_q(n2+n3+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n4,2)*_q(n5+n6,2)*_q(n2+n3+n7,3)*_q(n8,1)
-		+ k4*_q(n4,1)*_q(n1+n5+n6,3)*_q(n2+n3+n7,3)*_q(n8,1)
-		+ k4*_q(n1,1)*_q(n4+n5+n6,3)*_q(n2+n3+n7,3)*_q(n8,1)
-		- k12*_q(n1+n4+n5+n6,4)*_q(n2+n3+n7,3)*_q(n8,1)
-		- k6*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n2+n3+n7,4)*_q(n8,1)
-		+ k6*_q(n4+n5,2)*_q(n6,1)*_q(n1+n2+n3+n7,4)*_q(n8,1)
-		+ k6*_q(n5,1)*_q(n4+n6,2)*_q(n1+n2+n3+n7,4)*_q(n8,1)
-		+ k6*_q(n4,1)*_q(n5+n6,2)*_q(n1+n2+n3+n7,4)*_q(n8,1)
-		- k12*_q(n4+n5+n6,3)*_q(n1+n2+n3+n7,4)*_q(n8,1)
-		- _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)*_q(n8,1)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)*_q(n8,1)
-		+ _q(n2,1)*_q(n1+n3,2)*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)*_q(n8,1)
-		- k2*_q(n1+n2+n3,3)*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)*_q(n8,1)
-		+ _q(n2,1)*_q(n3,1)*_q(n1+n5,2)*_q(n6,1)*_q(n4+n7,2)*_q(n8,1)
-		- _q(n2+n3,2)*_q(n1+n5,2)*_q(n6,1)*_q(n4+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n3,1)*_q(n2+n5,2)*_q(n6,1)*_q(n4+n7,2)*_q(n8,1)
-		- _q(n1+n3,2)*_q(n2+n5,2)*_q(n6,1)*_q(n4+n7,2)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n1+n2+n5,3)*_q(n6,1)*_q(n4+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n2,1)*_q(n3+n5,2)*_q(n6,1)*_q(n4+n7,2)*_q(n8,1)
-		- _q(n1+n2,2)*_q(n3+n5,2)*_q(n6,1)*_q(n4+n7,2)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n1+n3+n5,3)*_q(n6,1)*_q(n4+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2+n3+n5,3)*_q(n6,1)*_q(n4+n7,2)*_q(n8,1)
-		+ k6*_q(n1+n2+n3+n5,4)*_q(n6,1)*_q(n4+n7,2)*_q(n8,1)
-		+ _q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n1+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		- _q(n2+n3,2)*_q(n5,1)*_q(n1+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		- _q(n3,1)*_q(n2+n5,2)*_q(n1+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		- _q(n2,1)*_q(n3+n5,2)*_q(n1+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		+ k2*_q(n2+n3+n5,3)*_q(n1+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n2+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		- _q(n1+n3,2)*_q(n5,1)*_q(n2+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		- _q(n3,1)*_q(n1+n5,2)*_q(n2+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		- _q(n1,1)*_q(n3+n5,2)*_q(n2+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n3+n5,3)*_q(n2+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n1+n2+n6,3)*_q(n4+n7,2)*_q(n8,1)
-		+ k2*_q(n3+n5,2)*_q(n1+n2+n6,3)*_q(n4+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n3+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		- _q(n1+n2,2)*_q(n5,1)*_q(n3+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		- _q(n2,1)*_q(n1+n5,2)*_q(n3+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		- _q(n1,1)*_q(n2+n5,2)*_q(n3+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n2+n5,3)*_q(n3+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n1+n3+n6,3)*_q(n4+n7,2)*_q(n8,1)
-		+ k2*_q(n2+n5,2)*_q(n1+n3+n6,3)*_q(n4+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n2+n3+n6,3)*_q(n4+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n5,2)*_q(n2+n3+n6,3)*_q(n4+n7,2)*_q(n8,1)
-		+ k6*_q(n5,1)*_q(n1+n2+n3+n6,4)*_q(n4+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n5+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n5+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n5+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n2+n3,3)*_q(n5+n6,2)*_q(n4+n7,2)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n5+n6,3)*_q(n4+n7,2)*_q(n8,1)
-		+ k2*_q(n2+n3,2)*_q(n1+n5+n6,3)*_q(n4+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n5+n6,3)*_q(n4+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n3,2)*_q(n2+n5+n6,3)*_q(n4+n7,2)*_q(n8,1)
-		+ k6*_q(n3,1)*_q(n1+n2+n5+n6,4)*_q(n4+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n5+n6,3)*_q(n4+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n2,2)*_q(n3+n5+n6,3)*_q(n4+n7,2)*_q(n8,1)
-		+ k6*_q(n2,1)*_q(n1+n3+n5+n6,4)*_q(n4+n7,2)*_q(n8,1)
-		+ k6*_q(n1,1)*_q(n2+n3+n5+n6,4)*_q(n4+n7,2)*_q(n8,1)
-		- k24*_q(n1+n2+n3+n5+n6,5)*_q(n4+n7,2)*_q(n8,1)
-		+ k2*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n1+n4+n7,3)*_q(n8,1)
-		- k2*_q(n2+n3,2)*_q(n5,1)*_q(n6,1)*_q(n1+n4+n7,3)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n2+n5,2)*_q(n6,1)*_q(n1+n4+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n3+n5,2)*_q(n6,1)*_q(n1+n4+n7,3)*_q(n8,1)
-		+ k4*_q(n2+n3+n5,3)*_q(n6,1)*_q(n1+n4+n7,3)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n2+n6,2)*_q(n1+n4+n7,3)*_q(n8,1)
-		+ k2*_q(n3+n5,2)*_q(n2+n6,2)*_q(n1+n4+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n3+n6,2)*_q(n1+n4+n7,3)*_q(n8,1)
-		+ k2*_q(n2+n5,2)*_q(n3+n6,2)*_q(n1+n4+n7,3)*_q(n8,1)
-		+ k4*_q(n5,1)*_q(n2+n3+n6,3)*_q(n1+n4+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n5+n6,2)*_q(n1+n4+n7,3)*_q(n8,1)
-		+ k2*_q(n2+n3,2)*_q(n5+n6,2)*_q(n1+n4+n7,3)*_q(n8,1)
-		+ k4*_q(n3,1)*_q(n2+n5+n6,3)*_q(n1+n4+n7,3)*_q(n8,1)
-		+ k4*_q(n2,1)*_q(n3+n5+n6,3)*_q(n1+n4+n7,3)*_q(n8,1)
-		- k12*_q(n2+n3+n5+n6,4)*_q(n1+n4+n7,3)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n2+n4+n7,3)*_q(n8,1)
-		- k2*_q(n1+n3,2)*_q(n5,1)*_q(n6,1)*_q(n2+n4+n7,3)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n1+n5,2)*_q(n6,1)*_q(n2+n4+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n3+n5,2)*_q(n6,1)*_q(n2+n4+n7,3)*_q(n8,1)
-		+ k4*_q(n1+n3+n5,3)*_q(n6,1)*_q(n2+n4+n7,3)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n1+n6,2)*_q(n2+n4+n7,3)*_q(n8,1)
-		+ k2*_q(n3+n5,2)*_q(n1+n6,2)*_q(n2+n4+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n3+n6,2)*_q(n2+n4+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n5,2)*_q(n3+n6,2)*_q(n2+n4+n7,3)*_q(n8,1)
-		+ k4*_q(n5,1)*_q(n1+n3+n6,3)*_q(n2+n4+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n5+n6,2)*_q(n2+n4+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n3,2)*_q(n5+n6,2)*_q(n2+n4+n7,3)*_q(n8,1)
-		+ k4*_q(n3,1)*_q(n1+n5+n6,3)*_q(n2+n4+n7,3)*_q(n8,1)
-		+ k4*_q(n1,1)*_q(n3+n5+n6,3)*_q(n2+n4+n7,3)*_q(n8,1)
-		- k12*_q(n1+n3+n5+n6,4)*_q(n2+n4+n7,3)*_q(n8,1)
-		- k6*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n1+n2+n4+n7,4)*_q(n8,1)
-		+ k6*_q(n3+n5,2)*_q(n6,1)*_q(n1+n2+n4+n7,4)*_q(n8,1)
-		+ k6*_q(n5,1)*_q(n3+n6,2)*_q(n1+n2+n4+n7,4)*_q(n8,1)
-		+ k6*_q(n3,1)*_q(n5+n6,2)*_q(n1+n2+n4+n7,4)*_q(n8,1)
-		- k12*_q(n3+n5+n6,3)*_q(n1+n2+n4+n7,4)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n6,1)*_q(n3+n4+n7,3)*_q(n8,1)
-		- k2*_q(n1+n2,2)*_q(n5,1)*_q(n6,1)*_q(n3+n4+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n1+n5,2)*_q(n6,1)*_q(n3+n4+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2+n5,2)*_q(n6,1)*_q(n3+n4+n7,3)*_q(n8,1)
-		+ k4*_q(n1+n2+n5,3)*_q(n6,1)*_q(n3+n4+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n1+n6,2)*_q(n3+n4+n7,3)*_q(n8,1)
-		+ k2*_q(n2+n5,2)*_q(n1+n6,2)*_q(n3+n4+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n2+n6,2)*_q(n3+n4+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n5,2)*_q(n2+n6,2)*_q(n3+n4+n7,3)*_q(n8,1)
-		+ k4*_q(n5,1)*_q(n1+n2+n6,3)*_q(n3+n4+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n5+n6,2)*_q(n3+n4+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n2,2)*_q(n5+n6,2)*_q(n3+n4+n7,3)*_q(n8,1)
-		+ k4*_q(n2,1)*_q(n1+n5+n6,3)*_q(n3+n4+n7,3)*_q(n8,1)
-		+ k4*_q(n1,1)*_q(n2+n5+n6,3)*_q(n3+n4+n7,3)*_q(n8,1)
-		- k12*_q(n1+n2+n5+n6,4)*_q(n3+n4+n7,3)*_q(n8,1)
-		- k6*_q(n2,1)*_q(n5,1)*_q(n6,1)*_q(n1+n3+n4+n7,4)*_q(n8,1)
-		+ k6*_q(n2+n5,2)*_q(n6,1)*_q(n1+n3+n4+n7,4)*_q(n8,1)
-		+ k6*_q(n5,1)*_q(n2+n6,2)*_q(n1+n3+n4+n7,4)*_q(n8,1)
-		+ k6*_q(n2,1)*_q(n5+n6,2)*_q(n1+n3+n4+n7,4)*_q(n8,1)
-		- k12*_q(n2+n5+n6,3)*_q(n1+n3+n4+n7,4)*_q(n8,1)
-		- k6*_q(n1,1)*_q(n5,1)*_q(n6,1)*_q(n2+n3+n4+n7,4)*_q(n8,1)
-		+ k6*_q(n1+n5,2)*_q(n6,1)*_q(n2+n3+n4+n7,4)*_q(n8,1)
-		+ k6*_q(n5,1)*_q(n1+n6,2)*_q(n2+n3+n4+n7,4)*_q(n8,1)
-		+ k6*_q(n1,1)*_q(n5+n6,2)*_q(n2+n3+n4+n7,4)*_q(n8,1)
-		- k12*_q(n1+n5+n6,3)*_q(n2+n3+n4+n7,4)*_q(n8,1)
-		+ k24*_q(n5,1)*_q(n6,1)*_q(n1+n2+n3+n4+n7,5)*_q(n8,1)
-		- k24*_q(n5+n6,2)*_q(n1+n2+n3+n4+n7,5)*_q(n8,1)
-		- _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)*_q(n8,1)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)*_q(n8,1)
-		+ _q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)*_q(n8,1)
-		- k2*_q(n1+n2+n3,3)*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)*_q(n8,1)
-		+ _q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n6,1)*_q(n5+n7,2)*_q(n8,1)
-		- _q(n2+n3,2)*_q(n1+n4,2)*_q(n6,1)*_q(n5+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n6,1)*_q(n5+n7,2)*_q(n8,1)
-		- _q(n1+n3,2)*_q(n2+n4,2)*_q(n6,1)*_q(n5+n7,2)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n1+n2+n4,3)*_q(n6,1)*_q(n5+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n6,1)*_q(n5+n7,2)*_q(n8,1)
-		- _q(n1+n2,2)*_q(n3+n4,2)*_q(n6,1)*_q(n5+n7,2)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n1+n3+n4,3)*_q(n6,1)*_q(n5+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2+n3+n4,3)*_q(n6,1)*_q(n5+n7,2)*_q(n8,1)
-		+ k6*_q(n1+n2+n3+n4,4)*_q(n6,1)*_q(n5+n7,2)*_q(n8,1)
-		+ _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		- _q(n2+n3,2)*_q(n4,1)*_q(n1+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		- _q(n3,1)*_q(n2+n4,2)*_q(n1+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		- _q(n2,1)*_q(n3+n4,2)*_q(n1+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		+ k2*_q(n2+n3+n4,3)*_q(n1+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		- _q(n1+n3,2)*_q(n4,1)*_q(n2+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		- _q(n3,1)*_q(n1+n4,2)*_q(n2+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		- _q(n1,1)*_q(n3+n4,2)*_q(n2+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n3+n4,3)*_q(n2+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n1+n2+n6,3)*_q(n5+n7,2)*_q(n8,1)
-		+ k2*_q(n3+n4,2)*_q(n1+n2+n6,3)*_q(n5+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		- _q(n1+n2,2)*_q(n4,1)*_q(n3+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		- _q(n2,1)*_q(n1+n4,2)*_q(n3+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		- _q(n1,1)*_q(n2+n4,2)*_q(n3+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n2+n4,3)*_q(n3+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n1+n3+n6,3)*_q(n5+n7,2)*_q(n8,1)
-		+ k2*_q(n2+n4,2)*_q(n1+n3+n6,3)*_q(n5+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n2+n3+n6,3)*_q(n5+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n4,2)*_q(n2+n3+n6,3)*_q(n5+n7,2)*_q(n8,1)
-		+ k6*_q(n4,1)*_q(n1+n2+n3+n6,4)*_q(n5+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n4+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n4+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n4+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n2+n3,3)*_q(n4+n6,2)*_q(n5+n7,2)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n4+n6,3)*_q(n5+n7,2)*_q(n8,1)
-		+ k2*_q(n2+n3,2)*_q(n1+n4+n6,3)*_q(n5+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n4+n6,3)*_q(n5+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n3,2)*_q(n2+n4+n6,3)*_q(n5+n7,2)*_q(n8,1)
-		+ k6*_q(n3,1)*_q(n1+n2+n4+n6,4)*_q(n5+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n4+n6,3)*_q(n5+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n2,2)*_q(n3+n4+n6,3)*_q(n5+n7,2)*_q(n8,1)
-		+ k6*_q(n2,1)*_q(n1+n3+n4+n6,4)*_q(n5+n7,2)*_q(n8,1)
-		+ k6*_q(n1,1)*_q(n2+n3+n4+n6,4)*_q(n5+n7,2)*_q(n8,1)
-		- k24*_q(n1+n2+n3+n4+n6,5)*_q(n5+n7,2)*_q(n8,1)
-		+ k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n1+n5+n7,3)*_q(n8,1)
-		- k2*_q(n2+n3,2)*_q(n4,1)*_q(n6,1)*_q(n1+n5+n7,3)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n2+n4,2)*_q(n6,1)*_q(n1+n5+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n3+n4,2)*_q(n6,1)*_q(n1+n5+n7,3)*_q(n8,1)
-		+ k4*_q(n2+n3+n4,3)*_q(n6,1)*_q(n1+n5+n7,3)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n2+n6,2)*_q(n1+n5+n7,3)*_q(n8,1)
-		+ k2*_q(n3+n4,2)*_q(n2+n6,2)*_q(n1+n5+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n3+n6,2)*_q(n1+n5+n7,3)*_q(n8,1)
-		+ k2*_q(n2+n4,2)*_q(n3+n6,2)*_q(n1+n5+n7,3)*_q(n8,1)
-		+ k4*_q(n4,1)*_q(n2+n3+n6,3)*_q(n1+n5+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4+n6,2)*_q(n1+n5+n7,3)*_q(n8,1)
-		+ k2*_q(n2+n3,2)*_q(n4+n6,2)*_q(n1+n5+n7,3)*_q(n8,1)
-		+ k4*_q(n3,1)*_q(n2+n4+n6,3)*_q(n1+n5+n7,3)*_q(n8,1)
-		+ k4*_q(n2,1)*_q(n3+n4+n6,3)*_q(n1+n5+n7,3)*_q(n8,1)
-		- k12*_q(n2+n3+n4+n6,4)*_q(n1+n5+n7,3)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n2+n5+n7,3)*_q(n8,1)
-		- k2*_q(n1+n3,2)*_q(n4,1)*_q(n6,1)*_q(n2+n5+n7,3)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n1+n4,2)*_q(n6,1)*_q(n2+n5+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n3+n4,2)*_q(n6,1)*_q(n2+n5+n7,3)*_q(n8,1)
-		+ k4*_q(n1+n3+n4,3)*_q(n6,1)*_q(n2+n5+n7,3)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n1+n6,2)*_q(n2+n5+n7,3)*_q(n8,1)
-		+ k2*_q(n3+n4,2)*_q(n1+n6,2)*_q(n2+n5+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n3+n6,2)*_q(n2+n5+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n4,2)*_q(n3+n6,2)*_q(n2+n5+n7,3)*_q(n8,1)
-		+ k4*_q(n4,1)*_q(n1+n3+n6,3)*_q(n2+n5+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4+n6,2)*_q(n2+n5+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n3,2)*_q(n4+n6,2)*_q(n2+n5+n7,3)*_q(n8,1)
-		+ k4*_q(n3,1)*_q(n1+n4+n6,3)*_q(n2+n5+n7,3)*_q(n8,1)
-		+ k4*_q(n1,1)*_q(n3+n4+n6,3)*_q(n2+n5+n7,3)*_q(n8,1)
-		- k12*_q(n1+n3+n4+n6,4)*_q(n2+n5+n7,3)*_q(n8,1)
-		- k6*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n1+n2+n5+n7,4)*_q(n8,1)
-		+ k6*_q(n3+n4,2)*_q(n6,1)*_q(n1+n2+n5+n7,4)*_q(n8,1)
-		+ k6*_q(n4,1)*_q(n3+n6,2)*_q(n1+n2+n5+n7,4)*_q(n8,1)
-		+ k6*_q(n3,1)*_q(n4+n6,2)*_q(n1+n2+n5+n7,4)*_q(n8,1)
-		- k12*_q(n3+n4+n6,3)*_q(n1+n2+n5+n7,4)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n6,1)*_q(n3+n5+n7,3)*_q(n8,1)
-		- k2*_q(n1+n2,2)*_q(n4,1)*_q(n6,1)*_q(n3+n5+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n1+n4,2)*_q(n6,1)*_q(n3+n5+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2+n4,2)*_q(n6,1)*_q(n3+n5+n7,3)*_q(n8,1)
-		+ k4*_q(n1+n2+n4,3)*_q(n6,1)*_q(n3+n5+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n1+n6,2)*_q(n3+n5+n7,3)*_q(n8,1)
-		+ k2*_q(n2+n4,2)*_q(n1+n6,2)*_q(n3+n5+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n2+n6,2)*_q(n3+n5+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n4,2)*_q(n2+n6,2)*_q(n3+n5+n7,3)*_q(n8,1)
-		+ k4*_q(n4,1)*_q(n1+n2+n6,3)*_q(n3+n5+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4+n6,2)*_q(n3+n5+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n2,2)*_q(n4+n6,2)*_q(n3+n5+n7,3)*_q(n8,1)
-		+ k4*_q(n2,1)*_q(n1+n4+n6,3)*_q(n3+n5+n7,3)*_q(n8,1)
-		+ k4*_q(n1,1)*_q(n2+n4+n6,3)*_q(n3+n5+n7,3)*_q(n8,1)
-		- k12*_q(n1+n2+n4+n6,4)*_q(n3+n5+n7,3)*_q(n8,1)
-		- k6*_q(n2,1)*_q(n4,1)*_q(n6,1)*_q(n1+n3+n5+n7,4)*_q(n8,1)
-		+ k6*_q(n2+n4,2)*_q(n6,1)*_q(n1+n3+n5+n7,4)*_q(n8,1)
-		+ k6*_q(n4,1)*_q(n2+n6,2)*_q(n1+n3+n5+n7,4)*_q(n8,1)
-		+ k6*_q(n2,1)*_q(n4+n6,2)*_q(n1+n3+n5+n7,4)*_q(n8,1)
-		- k12*_q(n2+n4+n6,3)*_q(n1+n3+n5+n7,4)*_q(n8,1)
-		- k6*_q(n1,1)*_q(n4,1)*_q(n6,1)*_q(n2+n3+n5+n7,4)*_q(n8,1)
-		+ k6*_q(n1+n4,2)*_q(n6,1)*_q(n2+n3+n5+n7,4)*_q(n8,1)
-		+ k6*_q(n4,1)*_q(n1+n6,2)*_q(n2+n3+n5+n7,4)*_q(n8,1)
-		+ k6*_q(n1,1)*_q(n4+n6,2)*_q(n2+n3+n5+n7,4)*_q(n8,1)
-		- k12*_q(n1+n4+n6,3)*_q(n2+n3+n5+n7,4)*_q(n8,1)
-		+ k24*_q(n4,1)*_q(n6,1)*_q(n1+n2+n3+n5+n7,5)*_q(n8,1)
-		- k24*_q(n4+n6,2)*_q(n1+n2+n3+n5+n7,5)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n6,1)*_q(n4+n5+n7,3)*_q(n8,1)
-		- k2*_q(n1+n2,2)*_q(n3,1)*_q(n6,1)*_q(n4+n5+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n1+n3,2)*_q(n6,1)*_q(n4+n5+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2+n3,2)*_q(n6,1)*_q(n4+n5+n7,3)*_q(n8,1)
-		+ k4*_q(n1+n2+n3,3)*_q(n6,1)*_q(n4+n5+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n6,2)*_q(n4+n5+n7,3)*_q(n8,1)
-		+ k2*_q(n2+n3,2)*_q(n1+n6,2)*_q(n4+n5+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n6,2)*_q(n4+n5+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n3,2)*_q(n2+n6,2)*_q(n4+n5+n7,3)*_q(n8,1)
-		+ k4*_q(n3,1)*_q(n1+n2+n6,3)*_q(n4+n5+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n6,2)*_q(n4+n5+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n2,2)*_q(n3+n6,2)*_q(n4+n5+n7,3)*_q(n8,1)
-		+ k4*_q(n2,1)*_q(n1+n3+n6,3)*_q(n4+n5+n7,3)*_q(n8,1)
-		+ k4*_q(n1,1)*_q(n2+n3+n6,3)*_q(n4+n5+n7,3)*_q(n8,1)
-		- k12*_q(n1+n2+n3+n6,4)*_q(n4+n5+n7,3)*_q(n8,1)
-		- k6*_q(n2,1)*_q(n3,1)*_q(n6,1)*_q(n1+n4+n5+n7,4)*_q(n8,1)
-		+ k6*_q(n2+n3,2)*_q(n6,1)*_q(n1+n4+n5+n7,4)*_q(n8,1)
-		+ k6*_q(n3,1)*_q(n2+n6,2)*_q(n1+n4+n5+n7,4)*_q(n8,1)
-		+ k6*_q(n2,1)*_q(n3+n6,2)*_q(n1+n4+n5+n7,4)*_q(n8,1)
-		- k12*_q(n2+n3+n6,3)*_q(n1+n4+n5+n7,4)*_q(n8,1)
-		- k6*_q(n1,1)*_q(n3,1)*_q(n6,1)*_q(n2+n4+n5+n7,4)*_q(n8,1)
-		+ k6*_q(n1+n3,2)*_q(n6,1)*_q(n2+n4+n5+n7,4)*_q(n8,1)
-		+ k6*_q(n3,1)*_q(n1+n6,2)*_q(n2+n4+n5+n7,4)*_q(n8,1)
-		+ k6*_q(n1,1)*_q(n3+n6,2)*_q(n2+n4+n5+n7,4)*_q(n8,1)
-		- k12*_q(n1+n3+n6,3)*_q(n2+n4+n5+n7,4)*_q(n8,1)
-		+ k24*_q(n3,1)*_q(n6,1)*_q(n1+n2+n4+n5+n7,5)*_q(n8,1)
-		- k24*_q(n3+n6,2)*_q(n1+n2+n4+n5+n7,5)*_q(n8,1)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n6,1)*_q(n3+n4+n5+n7,4)*_q(n8,1)
-		+ k6*_q(n1+n2,2)*_q(n6,1)*_q(n3+n4+n5+n7,4)*_q(n8,1)
-		+ k6*_q(n2,1)*_q(n1+n6,2)*_q(n3+n4+n5+n7,4)*_q(n8,1)
-		+ k6*_q(n1,1)*_q(n2+n6,2)*_q(n3+n4+n5+n7,4)*_q(n8,1)
-		- k12*_q(n1+n2+n6,3)*_q(n3+n4+n5+n7,4)*_q(n8,1)
-		+ k24*_q(n2,1)*_q(n6,1)*_q(n1+n3+n4+n5+n7,5)*_q(n8,1)
-		- k24*_q(n2+n6,2)*_q(n1+n3+n4+n5+n7,5)*_q(n8,1)
-		+ k24*_q(n1,1)*_q(n6,1)*_q(n2+n3+n4+n5+n7,5)*_q(n8,1)
-		- k24*_q(n1+n6,2)*_q(n2+n3+n4+n5+n7,5)*_q(n8,1)
-		- k120*_q(n6,1)*_q(n1+n2+n3+n4+n5+n7,6)*_q(n8,1)
-		- _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)*_q(n8,1)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)*_q(n8,1)
-		+ _q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)*_q(n8,1)
-		- k2*_q(n1+n2+n3,3)*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)*_q(n8,1)
-		+ _q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n6+n7,2)*_q(n8,1)
-		- _q(n2+n3,2)*_q(n1+n4,2)*_q(n5,1)*_q(n6+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n6+n7,2)*_q(n8,1)
-		- _q(n1+n3,2)*_q(n2+n4,2)*_q(n5,1)*_q(n6+n7,2)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n1+n2+n4,3)*_q(n5,1)*_q(n6+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n6+n7,2)*_q(n8,1)
-		- _q(n1+n2,2)*_q(n3+n4,2)*_q(n5,1)*_q(n6+n7,2)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n1+n3+n4,3)*_q(n5,1)*_q(n6+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2+n3+n4,3)*_q(n5,1)*_q(n6+n7,2)*_q(n8,1)
-		+ k6*_q(n1+n2+n3+n4,4)*_q(n5,1)*_q(n6+n7,2)*_q(n8,1)
-		+ _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		- _q(n2+n3,2)*_q(n4,1)*_q(n1+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		- _q(n3,1)*_q(n2+n4,2)*_q(n1+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		- _q(n2,1)*_q(n3+n4,2)*_q(n1+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		+ k2*_q(n2+n3+n4,3)*_q(n1+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		- _q(n1+n3,2)*_q(n4,1)*_q(n2+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		- _q(n3,1)*_q(n1+n4,2)*_q(n2+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		- _q(n1,1)*_q(n3+n4,2)*_q(n2+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n3+n4,3)*_q(n2+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n1+n2+n5,3)*_q(n6+n7,2)*_q(n8,1)
-		+ k2*_q(n3+n4,2)*_q(n1+n2+n5,3)*_q(n6+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		- _q(n1+n2,2)*_q(n4,1)*_q(n3+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		- _q(n2,1)*_q(n1+n4,2)*_q(n3+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		- _q(n1,1)*_q(n2+n4,2)*_q(n3+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n2+n4,3)*_q(n3+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n1+n3+n5,3)*_q(n6+n7,2)*_q(n8,1)
-		+ k2*_q(n2+n4,2)*_q(n1+n3+n5,3)*_q(n6+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n2+n3+n5,3)*_q(n6+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n4,2)*_q(n2+n3+n5,3)*_q(n6+n7,2)*_q(n8,1)
-		+ k6*_q(n4,1)*_q(n1+n2+n3+n5,4)*_q(n6+n7,2)*_q(n8,1)
-		+ _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n4+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n4+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n4+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n2+n3,3)*_q(n4+n5,2)*_q(n6+n7,2)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n4+n5,3)*_q(n6+n7,2)*_q(n8,1)
-		+ k2*_q(n2+n3,2)*_q(n1+n4+n5,3)*_q(n6+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n4+n5,3)*_q(n6+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n3,2)*_q(n2+n4+n5,3)*_q(n6+n7,2)*_q(n8,1)
-		+ k6*_q(n3,1)*_q(n1+n2+n4+n5,4)*_q(n6+n7,2)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n4+n5,3)*_q(n6+n7,2)*_q(n8,1)
-		+ k2*_q(n1+n2,2)*_q(n3+n4+n5,3)*_q(n6+n7,2)*_q(n8,1)
-		+ k6*_q(n2,1)*_q(n1+n3+n4+n5,4)*_q(n6+n7,2)*_q(n8,1)
-		+ k6*_q(n1,1)*_q(n2+n3+n4+n5,4)*_q(n6+n7,2)*_q(n8,1)
-		- k24*_q(n1+n2+n3+n4+n5,5)*_q(n6+n7,2)*_q(n8,1)
-		+ k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n6+n7,3)*_q(n8,1)
-		- k2*_q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n1+n6+n7,3)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n1+n6+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n1+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n2+n3+n4,3)*_q(n5,1)*_q(n1+n6+n7,3)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n1+n6+n7,3)*_q(n8,1)
-		+ k2*_q(n3+n4,2)*_q(n2+n5,2)*_q(n1+n6+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n1+n6+n7,3)*_q(n8,1)
-		+ k2*_q(n2+n4,2)*_q(n3+n5,2)*_q(n1+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n4,1)*_q(n2+n3+n5,3)*_q(n1+n6+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n1+n6+n7,3)*_q(n8,1)
-		+ k2*_q(n2+n3,2)*_q(n4+n5,2)*_q(n1+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n3,1)*_q(n2+n4+n5,3)*_q(n1+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n2,1)*_q(n3+n4+n5,3)*_q(n1+n6+n7,3)*_q(n8,1)
-		- k12*_q(n2+n3+n4+n5,4)*_q(n1+n6+n7,3)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n2+n6+n7,3)*_q(n8,1)
-		- k2*_q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n2+n6+n7,3)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n2+n6+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n3+n4,2)*_q(n5,1)*_q(n2+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n1+n3+n4,3)*_q(n5,1)*_q(n2+n6+n7,3)*_q(n8,1)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n2+n6+n7,3)*_q(n8,1)
-		+ k2*_q(n3+n4,2)*_q(n1+n5,2)*_q(n2+n6+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n3+n5,2)*_q(n2+n6+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n4,2)*_q(n3+n5,2)*_q(n2+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n4,1)*_q(n1+n3+n5,3)*_q(n2+n6+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4+n5,2)*_q(n2+n6+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n3,2)*_q(n4+n5,2)*_q(n2+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n3,1)*_q(n1+n4+n5,3)*_q(n2+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n1,1)*_q(n3+n4+n5,3)*_q(n2+n6+n7,3)*_q(n8,1)
-		- k12*_q(n1+n3+n4+n5,4)*_q(n2+n6+n7,3)*_q(n8,1)
-		- k6*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n2+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n3+n4,2)*_q(n5,1)*_q(n1+n2+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n4,1)*_q(n3+n5,2)*_q(n1+n2+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n3,1)*_q(n4+n5,2)*_q(n1+n2+n6+n7,4)*_q(n8,1)
-		- k12*_q(n3+n4+n5,3)*_q(n1+n2+n6+n7,4)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n3+n6+n7,3)*_q(n8,1)
-		- k2*_q(n1+n2,2)*_q(n4,1)*_q(n5,1)*_q(n3+n6+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n1+n4,2)*_q(n5,1)*_q(n3+n6+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2+n4,2)*_q(n5,1)*_q(n3+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n1+n2+n4,3)*_q(n5,1)*_q(n3+n6+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n1+n5,2)*_q(n3+n6+n7,3)*_q(n8,1)
-		+ k2*_q(n2+n4,2)*_q(n1+n5,2)*_q(n3+n6+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n2+n5,2)*_q(n3+n6+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n4,2)*_q(n2+n5,2)*_q(n3+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n4,1)*_q(n1+n2+n5,3)*_q(n3+n6+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4+n5,2)*_q(n3+n6+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n2,2)*_q(n4+n5,2)*_q(n3+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n2,1)*_q(n1+n4+n5,3)*_q(n3+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n1,1)*_q(n2+n4+n5,3)*_q(n3+n6+n7,3)*_q(n8,1)
-		- k12*_q(n1+n2+n4+n5,4)*_q(n3+n6+n7,3)*_q(n8,1)
-		- k6*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n1+n3+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n2+n4,2)*_q(n5,1)*_q(n1+n3+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n4,1)*_q(n2+n5,2)*_q(n1+n3+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n2,1)*_q(n4+n5,2)*_q(n1+n3+n6+n7,4)*_q(n8,1)
-		- k12*_q(n2+n4+n5,3)*_q(n1+n3+n6+n7,4)*_q(n8,1)
-		- k6*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n2+n3+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n1+n4,2)*_q(n5,1)*_q(n2+n3+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n4,1)*_q(n1+n5,2)*_q(n2+n3+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n1,1)*_q(n4+n5,2)*_q(n2+n3+n6+n7,4)*_q(n8,1)
-		- k12*_q(n1+n4+n5,3)*_q(n2+n3+n6+n7,4)*_q(n8,1)
-		+ k24*_q(n4,1)*_q(n5,1)*_q(n1+n2+n3+n6+n7,5)*_q(n8,1)
-		- k24*_q(n4+n5,2)*_q(n1+n2+n3+n6+n7,5)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n4+n6+n7,3)*_q(n8,1)
-		- k2*_q(n1+n2,2)*_q(n3,1)*_q(n5,1)*_q(n4+n6+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n1+n3,2)*_q(n5,1)*_q(n4+n6+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2+n3,2)*_q(n5,1)*_q(n4+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n1+n2+n3,3)*_q(n5,1)*_q(n4+n6+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n5,2)*_q(n4+n6+n7,3)*_q(n8,1)
-		+ k2*_q(n2+n3,2)*_q(n1+n5,2)*_q(n4+n6+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n5,2)*_q(n4+n6+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n3,2)*_q(n2+n5,2)*_q(n4+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n3,1)*_q(n1+n2+n5,3)*_q(n4+n6+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n5,2)*_q(n4+n6+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n2,2)*_q(n3+n5,2)*_q(n4+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n2,1)*_q(n1+n3+n5,3)*_q(n4+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n1,1)*_q(n2+n3+n5,3)*_q(n4+n6+n7,3)*_q(n8,1)
-		- k12*_q(n1+n2+n3+n5,4)*_q(n4+n6+n7,3)*_q(n8,1)
-		- k6*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n1+n4+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n2+n3,2)*_q(n5,1)*_q(n1+n4+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n3,1)*_q(n2+n5,2)*_q(n1+n4+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n2,1)*_q(n3+n5,2)*_q(n1+n4+n6+n7,4)*_q(n8,1)
-		- k12*_q(n2+n3+n5,3)*_q(n1+n4+n6+n7,4)*_q(n8,1)
-		- k6*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n2+n4+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n1+n3,2)*_q(n5,1)*_q(n2+n4+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n3,1)*_q(n1+n5,2)*_q(n2+n4+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n1,1)*_q(n3+n5,2)*_q(n2+n4+n6+n7,4)*_q(n8,1)
-		- k12*_q(n1+n3+n5,3)*_q(n2+n4+n6+n7,4)*_q(n8,1)
-		+ k24*_q(n3,1)*_q(n5,1)*_q(n1+n2+n4+n6+n7,5)*_q(n8,1)
-		- k24*_q(n3+n5,2)*_q(n1+n2+n4+n6+n7,5)*_q(n8,1)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n3+n4+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n1+n2,2)*_q(n5,1)*_q(n3+n4+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n2,1)*_q(n1+n5,2)*_q(n3+n4+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n1,1)*_q(n2+n5,2)*_q(n3+n4+n6+n7,4)*_q(n8,1)
-		- k12*_q(n1+n2+n5,3)*_q(n3+n4+n6+n7,4)*_q(n8,1)
-		+ k24*_q(n2,1)*_q(n5,1)*_q(n1+n3+n4+n6+n7,5)*_q(n8,1)
-		- k24*_q(n2+n5,2)*_q(n1+n3+n4+n6+n7,5)*_q(n8,1)
-		+ k24*_q(n1,1)*_q(n5,1)*_q(n2+n3+n4+n6+n7,5)*_q(n8,1)
-		- k24*_q(n1+n5,2)*_q(n2+n3+n4+n6+n7,5)*_q(n8,1)
-		- k120*_q(n5,1)*_q(n1+n2+n3+n4+n6+n7,6)*_q(n8,1)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5+n6+n7,3)*_q(n8,1)
-		- k2*_q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n5+n6+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n5+n6+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n5+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n1+n2+n3,3)*_q(n4,1)*_q(n5+n6+n7,3)*_q(n8,1)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n5+n6+n7,3)*_q(n8,1)
-		+ k2*_q(n2+n3,2)*_q(n1+n4,2)*_q(n5+n6+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n5+n6+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n3,2)*_q(n2+n4,2)*_q(n5+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n3,1)*_q(n1+n2+n4,3)*_q(n5+n6+n7,3)*_q(n8,1)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n5+n6+n7,3)*_q(n8,1)
-		+ k2*_q(n1+n2,2)*_q(n3+n4,2)*_q(n5+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n2,1)*_q(n1+n3+n4,3)*_q(n5+n6+n7,3)*_q(n8,1)
-		+ k4*_q(n1,1)*_q(n2+n3+n4,3)*_q(n5+n6+n7,3)*_q(n8,1)
-		- k12*_q(n1+n2+n3+n4,4)*_q(n5+n6+n7,3)*_q(n8,1)
-		- k6*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n5+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n2+n3,2)*_q(n4,1)*_q(n1+n5+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n3,1)*_q(n2+n4,2)*_q(n1+n5+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n2,1)*_q(n3+n4,2)*_q(n1+n5+n6+n7,4)*_q(n8,1)
-		- k12*_q(n2+n3+n4,3)*_q(n1+n5+n6+n7,4)*_q(n8,1)
-		- k6*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n5+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n1+n3,2)*_q(n4,1)*_q(n2+n5+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n3,1)*_q(n1+n4,2)*_q(n2+n5+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n1,1)*_q(n3+n4,2)*_q(n2+n5+n6+n7,4)*_q(n8,1)
-		- k12*_q(n1+n3+n4,3)*_q(n2+n5+n6+n7,4)*_q(n8,1)
-		+ k24*_q(n3,1)*_q(n4,1)*_q(n1+n2+n5+n6+n7,5)*_q(n8,1)
-		- k24*_q(n3+n4,2)*_q(n1+n2+n5+n6+n7,5)*_q(n8,1)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n5+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n1+n2,2)*_q(n4,1)*_q(n3+n5+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n2,1)*_q(n1+n4,2)*_q(n3+n5+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n1,1)*_q(n2+n4,2)*_q(n3+n5+n6+n7,4)*_q(n8,1)
-		- k12*_q(n1+n2+n4,3)*_q(n3+n5+n6+n7,4)*_q(n8,1)
-		+ k24*_q(n2,1)*_q(n4,1)*_q(n1+n3+n5+n6+n7,5)*_q(n8,1)
-		- k24*_q(n2+n4,2)*_q(n1+n3+n5+n6+n7,5)*_q(n8,1)
-		+ k24*_q(n1,1)*_q(n4,1)*_q(n2+n3+n5+n6+n7,5)*_q(n8,1)
-		- k24*_q(n1+n4,2)*_q(n2+n3+n5+n6+n7,5)*_q(n8,1)
-		- k120*_q(n4,1)*_q(n1+n2+n3+n5+n6+n7,6)*_q(n8,1)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n5+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n1+n2,2)*_q(n3,1)*_q(n4+n5+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n2,1)*_q(n1+n3,2)*_q(n4+n5+n6+n7,4)*_q(n8,1)
-		+ k6*_q(n1,1)*_q(n2+n3,2)*_q(n4+n5+n6+n7,4)*_q(n8,1)
-		- k12*_q(n1+n2+n3,3)*_q(n4+n5+n6+n7,4)*_q(n8,1)
-		+ k24*_q(n2,1)*_q(n3,1)*_q(n1+n4+n5+n6+n7,5)*_q(n8,1)
-		- k24*_q(n2+n3,2)*_q(n1+n4+n5+n6+n7,5)*_q(n8,1)
-		+ k24*_q(n1,1)*_q(n3,1)*_q(n2+n4+n5+n6+n7,5)*_q(n8,1)
-		- k24*_q(n1+n3,2)*_q(n2+n4+n5+n6+n7,5)*_q(n8,1)
-		- k120*_q(n3,1)*_q(n1+n2+n4+n5+n6+n7,6)*_q(n8,1)
-		+ k24*_q(n1,1)*_q(n2,1)*_q(n3+n4+n5+n6+n7,5)*_q(n8,1)
-		- k24*_q(n1+n2,2)*_q(n3+n4+n5+n6+n7,5)*_q(n8,1)
-		- k120*_q(n2,1)*_q(n1+n3+n4+n5+n6+n7,6)*_q(n8,1)
-		- k120*_q(n1,1)*_q(n2+n3+n4+n5+n6+n7,6)*_q(n8,1)
-		+ k720*_q(n1+n2+n3+n4+n5+n6+n7,7)*_q(n8,1)
-		- _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n1+n8,2)
-		+ _q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n1+n8,2)
-		+ _q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n1+n8,2)
-		+ _q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n1+n8,2)
-		- k2*_q(n2+n3+n4,3)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n1+n8,2)
-		+ _q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)*_q(n1+n8,2)
-		- _q(n3+n4,2)*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)*_q(n1+n8,2)
-		+ _q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)*_q(n1+n8,2)
-		- _q(n2+n4,2)*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)*_q(n1+n8,2)
-		- k2*_q(n4,1)*_q(n2+n3+n5,3)*_q(n6,1)*_q(n7,1)*_q(n1+n8,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)*_q(n1+n8,2)
-		- _q(n2+n3,2)*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)*_q(n1+n8,2)
-		- k2*_q(n3,1)*_q(n2+n4+n5,3)*_q(n6,1)*_q(n7,1)*_q(n1+n8,2)
-		- k2*_q(n2,1)*_q(n3+n4+n5,3)*_q(n6,1)*_q(n7,1)*_q(n1+n8,2)
-		+ k6*_q(n2+n3+n4+n5,4)*_q(n6,1)*_q(n7,1)*_q(n1+n8,2)
-		+ _q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		- _q(n3+n4,2)*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		- _q(n4,1)*_q(n3+n5,2)*_q(n2+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		- _q(n3,1)*_q(n4+n5,2)*_q(n2+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		+ k2*_q(n3+n4+n5,3)*_q(n2+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		+ _q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		- _q(n2+n4,2)*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		- _q(n4,1)*_q(n2+n5,2)*_q(n3+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		- _q(n2,1)*_q(n4+n5,2)*_q(n3+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		+ k2*_q(n2+n4+n5,3)*_q(n3+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n2+n3+n6,3)*_q(n7,1)*_q(n1+n8,2)
-		+ k2*_q(n4+n5,2)*_q(n2+n3+n6,3)*_q(n7,1)*_q(n1+n8,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		- _q(n2+n3,2)*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		- _q(n3,1)*_q(n2+n5,2)*_q(n4+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		- _q(n2,1)*_q(n3+n5,2)*_q(n4+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		+ k2*_q(n2+n3+n5,3)*_q(n4+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n2+n4+n6,3)*_q(n7,1)*_q(n1+n8,2)
-		+ k2*_q(n3+n5,2)*_q(n2+n4+n6,3)*_q(n7,1)*_q(n1+n8,2)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n3+n4+n6,3)*_q(n7,1)*_q(n1+n8,2)
-		+ k2*_q(n2+n5,2)*_q(n3+n4+n6,3)*_q(n7,1)*_q(n1+n8,2)
-		+ k6*_q(n5,1)*_q(n2+n3+n4+n6,4)*_q(n7,1)*_q(n1+n8,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		- _q(n2+n3,2)*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		- _q(n3,1)*_q(n2+n4,2)*_q(n5+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		- _q(n2,1)*_q(n3+n4,2)*_q(n5+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		+ k2*_q(n2+n3+n4,3)*_q(n5+n6,2)*_q(n7,1)*_q(n1+n8,2)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n2+n5+n6,3)*_q(n7,1)*_q(n1+n8,2)
-		+ k2*_q(n3+n4,2)*_q(n2+n5+n6,3)*_q(n7,1)*_q(n1+n8,2)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n3+n5+n6,3)*_q(n7,1)*_q(n1+n8,2)
-		+ k2*_q(n2+n4,2)*_q(n3+n5+n6,3)*_q(n7,1)*_q(n1+n8,2)
-		+ k6*_q(n4,1)*_q(n2+n3+n5+n6,4)*_q(n7,1)*_q(n1+n8,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4+n5+n6,3)*_q(n7,1)*_q(n1+n8,2)
-		+ k2*_q(n2+n3,2)*_q(n4+n5+n6,3)*_q(n7,1)*_q(n1+n8,2)
-		+ k6*_q(n3,1)*_q(n2+n4+n5+n6,4)*_q(n7,1)*_q(n1+n8,2)
-		+ k6*_q(n2,1)*_q(n3+n4+n5+n6,4)*_q(n7,1)*_q(n1+n8,2)
-		- k24*_q(n2+n3+n4+n5+n6,5)*_q(n7,1)*_q(n1+n8,2)
-		+ _q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)*_q(n1+n8,2)
-		- _q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)*_q(n1+n8,2)
-		- _q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n2+n7,2)*_q(n1+n8,2)
-		- _q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n2+n7,2)*_q(n1+n8,2)
-		+ k2*_q(n3+n4+n5,3)*_q(n6,1)*_q(n2+n7,2)*_q(n1+n8,2)
-		- _q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n2+n7,2)*_q(n1+n8,2)
-		+ _q(n4+n5,2)*_q(n3+n6,2)*_q(n2+n7,2)*_q(n1+n8,2)
-		- _q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n2+n7,2)*_q(n1+n8,2)
-		+ _q(n3+n5,2)*_q(n4+n6,2)*_q(n2+n7,2)*_q(n1+n8,2)
-		+ k2*_q(n5,1)*_q(n3+n4+n6,3)*_q(n2+n7,2)*_q(n1+n8,2)
-		- _q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n2+n7,2)*_q(n1+n8,2)
-		+ _q(n3+n4,2)*_q(n5+n6,2)*_q(n2+n7,2)*_q(n1+n8,2)
-		+ k2*_q(n4,1)*_q(n3+n5+n6,3)*_q(n2+n7,2)*_q(n1+n8,2)
-		+ k2*_q(n3,1)*_q(n4+n5+n6,3)*_q(n2+n7,2)*_q(n1+n8,2)
-		- k6*_q(n3+n4+n5+n6,4)*_q(n2+n7,2)*_q(n1+n8,2)
-		+ _q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)*_q(n1+n8,2)
-		- _q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)*_q(n1+n8,2)
-		- _q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n3+n7,2)*_q(n1+n8,2)
-		- _q(n2,1)*_q(n4+n5,2)*_q(n6,1)*_q(n3+n7,2)*_q(n1+n8,2)
-		+ k2*_q(n2+n4+n5,3)*_q(n6,1)*_q(n3+n7,2)*_q(n1+n8,2)
-		- _q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n3+n7,2)*_q(n1+n8,2)
-		+ _q(n4+n5,2)*_q(n2+n6,2)*_q(n3+n7,2)*_q(n1+n8,2)
-		- _q(n2,1)*_q(n5,1)*_q(n4+n6,2)*_q(n3+n7,2)*_q(n1+n8,2)
-		+ _q(n2+n5,2)*_q(n4+n6,2)*_q(n3+n7,2)*_q(n1+n8,2)
-		+ k2*_q(n5,1)*_q(n2+n4+n6,3)*_q(n3+n7,2)*_q(n1+n8,2)
-		- _q(n2,1)*_q(n4,1)*_q(n5+n6,2)*_q(n3+n7,2)*_q(n1+n8,2)
-		+ _q(n2+n4,2)*_q(n5+n6,2)*_q(n3+n7,2)*_q(n1+n8,2)
-		+ k2*_q(n4,1)*_q(n2+n5+n6,3)*_q(n3+n7,2)*_q(n1+n8,2)
-		+ k2*_q(n2,1)*_q(n4+n5+n6,3)*_q(n3+n7,2)*_q(n1+n8,2)
-		- k6*_q(n2+n4+n5+n6,4)*_q(n3+n7,2)*_q(n1+n8,2)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n2+n3+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n4+n5,2)*_q(n6,1)*_q(n2+n3+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n5,1)*_q(n4+n6,2)*_q(n2+n3+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n4,1)*_q(n5+n6,2)*_q(n2+n3+n7,3)*_q(n1+n8,2)
-		- k4*_q(n4+n5+n6,3)*_q(n2+n3+n7,3)*_q(n1+n8,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)*_q(n1+n8,2)
-		- _q(n2+n3,2)*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)*_q(n1+n8,2)
-		- _q(n3,1)*_q(n2+n5,2)*_q(n6,1)*_q(n4+n7,2)*_q(n1+n8,2)
-		- _q(n2,1)*_q(n3+n5,2)*_q(n6,1)*_q(n4+n7,2)*_q(n1+n8,2)
-		+ k2*_q(n2+n3+n5,3)*_q(n6,1)*_q(n4+n7,2)*_q(n1+n8,2)
-		- _q(n3,1)*_q(n5,1)*_q(n2+n6,2)*_q(n4+n7,2)*_q(n1+n8,2)
-		+ _q(n3+n5,2)*_q(n2+n6,2)*_q(n4+n7,2)*_q(n1+n8,2)
-		- _q(n2,1)*_q(n5,1)*_q(n3+n6,2)*_q(n4+n7,2)*_q(n1+n8,2)
-		+ _q(n2+n5,2)*_q(n3+n6,2)*_q(n4+n7,2)*_q(n1+n8,2)
-		+ k2*_q(n5,1)*_q(n2+n3+n6,3)*_q(n4+n7,2)*_q(n1+n8,2)
-		- _q(n2,1)*_q(n3,1)*_q(n5+n6,2)*_q(n4+n7,2)*_q(n1+n8,2)
-		+ _q(n2+n3,2)*_q(n5+n6,2)*_q(n4+n7,2)*_q(n1+n8,2)
-		+ k2*_q(n3,1)*_q(n2+n5+n6,3)*_q(n4+n7,2)*_q(n1+n8,2)
-		+ k2*_q(n2,1)*_q(n3+n5+n6,3)*_q(n4+n7,2)*_q(n1+n8,2)
-		- k6*_q(n2+n3+n5+n6,4)*_q(n4+n7,2)*_q(n1+n8,2)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n2+n4+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n3+n5,2)*_q(n6,1)*_q(n2+n4+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n5,1)*_q(n3+n6,2)*_q(n2+n4+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n3,1)*_q(n5+n6,2)*_q(n2+n4+n7,3)*_q(n1+n8,2)
-		- k4*_q(n3+n5+n6,3)*_q(n2+n4+n7,3)*_q(n1+n8,2)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n6,1)*_q(n3+n4+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n2+n5,2)*_q(n6,1)*_q(n3+n4+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n5,1)*_q(n2+n6,2)*_q(n3+n4+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n2,1)*_q(n5+n6,2)*_q(n3+n4+n7,3)*_q(n1+n8,2)
-		- k4*_q(n2+n5+n6,3)*_q(n3+n4+n7,3)*_q(n1+n8,2)
-		+ k6*_q(n5,1)*_q(n6,1)*_q(n2+n3+n4+n7,4)*_q(n1+n8,2)
-		- k6*_q(n5+n6,2)*_q(n2+n3+n4+n7,4)*_q(n1+n8,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)*_q(n1+n8,2)
-		- _q(n2+n3,2)*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)*_q(n1+n8,2)
-		- _q(n3,1)*_q(n2+n4,2)*_q(n6,1)*_q(n5+n7,2)*_q(n1+n8,2)
-		- _q(n2,1)*_q(n3+n4,2)*_q(n6,1)*_q(n5+n7,2)*_q(n1+n8,2)
-		+ k2*_q(n2+n3+n4,3)*_q(n6,1)*_q(n5+n7,2)*_q(n1+n8,2)
-		- _q(n3,1)*_q(n4,1)*_q(n2+n6,2)*_q(n5+n7,2)*_q(n1+n8,2)
-		+ _q(n3+n4,2)*_q(n2+n6,2)*_q(n5+n7,2)*_q(n1+n8,2)
-		- _q(n2,1)*_q(n4,1)*_q(n3+n6,2)*_q(n5+n7,2)*_q(n1+n8,2)
-		+ _q(n2+n4,2)*_q(n3+n6,2)*_q(n5+n7,2)*_q(n1+n8,2));
-      }
-
-      Complex uc8P2(const Harmonic n1,
-		    const Harmonic n2,
-		    const Harmonic n3,
-		    const Harmonic n4,
-		    const Harmonic n5,
-		    const Harmonic n6,
-		    const Harmonic n7,
-		    const Harmonic n8) const
-      {
-	const Real k2   = 2;
-	const Real k4   = 4;
-	const Real k6   = 6;
-	const Real k12  = 12;
-	const Real k24  = 24;
-	const Real k36  = 36;
-	const Real k48  = 48;
-	const Real k120 = 120;
-	// const Real k720 = 720;
-	return (k2*_q(n4,1)*_q(n2+n3+n6,3)*_q(n5+n7,2)*_q(n1+n8,2)
-		- _q(n2,1)*_q(n3,1)*_q(n4+n6,2)*_q(n5+n7,2)*_q(n1+n8,2)
-		+ _q(n2+n3,2)*_q(n4+n6,2)*_q(n5+n7,2)*_q(n1+n8,2)
-		+ k2*_q(n3,1)*_q(n2+n4+n6,3)*_q(n5+n7,2)*_q(n1+n8,2)
-		+ k2*_q(n2,1)*_q(n3+n4+n6,3)*_q(n5+n7,2)*_q(n1+n8,2)
-		- k6*_q(n2+n3+n4+n6,4)*_q(n5+n7,2)*_q(n1+n8,2)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n2+n5+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n3+n4,2)*_q(n6,1)*_q(n2+n5+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n4,1)*_q(n3+n6,2)*_q(n2+n5+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n3,1)*_q(n4+n6,2)*_q(n2+n5+n7,3)*_q(n1+n8,2)
-		- k4*_q(n3+n4+n6,3)*_q(n2+n5+n7,3)*_q(n1+n8,2)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n6,1)*_q(n3+n5+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n2+n4,2)*_q(n6,1)*_q(n3+n5+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n4,1)*_q(n2+n6,2)*_q(n3+n5+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n2,1)*_q(n4+n6,2)*_q(n3+n5+n7,3)*_q(n1+n8,2)
-		- k4*_q(n2+n4+n6,3)*_q(n3+n5+n7,3)*_q(n1+n8,2)
-		+ k6*_q(n4,1)*_q(n6,1)*_q(n2+n3+n5+n7,4)*_q(n1+n8,2)
-		- k6*_q(n4+n6,2)*_q(n2+n3+n5+n7,4)*_q(n1+n8,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n6,1)*_q(n4+n5+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n2+n3,2)*_q(n6,1)*_q(n4+n5+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n3,1)*_q(n2+n6,2)*_q(n4+n5+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n2,1)*_q(n3+n6,2)*_q(n4+n5+n7,3)*_q(n1+n8,2)
-		- k4*_q(n2+n3+n6,3)*_q(n4+n5+n7,3)*_q(n1+n8,2)
-		+ k6*_q(n3,1)*_q(n6,1)*_q(n2+n4+n5+n7,4)*_q(n1+n8,2)
-		- k6*_q(n3+n6,2)*_q(n2+n4+n5+n7,4)*_q(n1+n8,2)
-		+ k6*_q(n2,1)*_q(n6,1)*_q(n3+n4+n5+n7,4)*_q(n1+n8,2)
-		- k6*_q(n2+n6,2)*_q(n3+n4+n5+n7,4)*_q(n1+n8,2)
-		- k24*_q(n6,1)*_q(n2+n3+n4+n5+n7,5)*_q(n1+n8,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)*_q(n1+n8,2)
-		- _q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)*_q(n1+n8,2)
-		- _q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n6+n7,2)*_q(n1+n8,2)
-		- _q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n6+n7,2)*_q(n1+n8,2)
-		+ k2*_q(n2+n3+n4,3)*_q(n5,1)*_q(n6+n7,2)*_q(n1+n8,2)
-		- _q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n6+n7,2)*_q(n1+n8,2)
-		+ _q(n3+n4,2)*_q(n2+n5,2)*_q(n6+n7,2)*_q(n1+n8,2)
-		- _q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n6+n7,2)*_q(n1+n8,2)
-		+ _q(n2+n4,2)*_q(n3+n5,2)*_q(n6+n7,2)*_q(n1+n8,2)
-		+ k2*_q(n4,1)*_q(n2+n3+n5,3)*_q(n6+n7,2)*_q(n1+n8,2)
-		- _q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n6+n7,2)*_q(n1+n8,2)
-		+ _q(n2+n3,2)*_q(n4+n5,2)*_q(n6+n7,2)*_q(n1+n8,2)
-		+ k2*_q(n3,1)*_q(n2+n4+n5,3)*_q(n6+n7,2)*_q(n1+n8,2)
-		+ k2*_q(n2,1)*_q(n3+n4+n5,3)*_q(n6+n7,2)*_q(n1+n8,2)
-		- k6*_q(n2+n3+n4+n5,4)*_q(n6+n7,2)*_q(n1+n8,2)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n2+n6+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n3+n4,2)*_q(n5,1)*_q(n2+n6+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n4,1)*_q(n3+n5,2)*_q(n2+n6+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n3,1)*_q(n4+n5,2)*_q(n2+n6+n7,3)*_q(n1+n8,2)
-		- k4*_q(n3+n4+n5,3)*_q(n2+n6+n7,3)*_q(n1+n8,2)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n3+n6+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n2+n4,2)*_q(n5,1)*_q(n3+n6+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n4,1)*_q(n2+n5,2)*_q(n3+n6+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n2,1)*_q(n4+n5,2)*_q(n3+n6+n7,3)*_q(n1+n8,2)
-		- k4*_q(n2+n4+n5,3)*_q(n3+n6+n7,3)*_q(n1+n8,2)
-		+ k6*_q(n4,1)*_q(n5,1)*_q(n2+n3+n6+n7,4)*_q(n1+n8,2)
-		- k6*_q(n4+n5,2)*_q(n2+n3+n6+n7,4)*_q(n1+n8,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n4+n6+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n2+n3,2)*_q(n5,1)*_q(n4+n6+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n3,1)*_q(n2+n5,2)*_q(n4+n6+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n2,1)*_q(n3+n5,2)*_q(n4+n6+n7,3)*_q(n1+n8,2)
-		- k4*_q(n2+n3+n5,3)*_q(n4+n6+n7,3)*_q(n1+n8,2)
-		+ k6*_q(n3,1)*_q(n5,1)*_q(n2+n4+n6+n7,4)*_q(n1+n8,2)
-		- k6*_q(n3+n5,2)*_q(n2+n4+n6+n7,4)*_q(n1+n8,2)
-		+ k6*_q(n2,1)*_q(n5,1)*_q(n3+n4+n6+n7,4)*_q(n1+n8,2)
-		- k6*_q(n2+n5,2)*_q(n3+n4+n6+n7,4)*_q(n1+n8,2)
-		- k24*_q(n5,1)*_q(n2+n3+n4+n6+n7,5)*_q(n1+n8,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5+n6+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n2+n3,2)*_q(n4,1)*_q(n5+n6+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n3,1)*_q(n2+n4,2)*_q(n5+n6+n7,3)*_q(n1+n8,2)
-		+ k2*_q(n2,1)*_q(n3+n4,2)*_q(n5+n6+n7,3)*_q(n1+n8,2)
-		- k4*_q(n2+n3+n4,3)*_q(n5+n6+n7,3)*_q(n1+n8,2)
-		+ k6*_q(n3,1)*_q(n4,1)*_q(n2+n5+n6+n7,4)*_q(n1+n8,2)
-		- k6*_q(n3+n4,2)*_q(n2+n5+n6+n7,4)*_q(n1+n8,2)
-		+ k6*_q(n2,1)*_q(n4,1)*_q(n3+n5+n6+n7,4)*_q(n1+n8,2)
-		- k6*_q(n2+n4,2)*_q(n3+n5+n6+n7,4)*_q(n1+n8,2)
-		- k24*_q(n4,1)*_q(n2+n3+n5+n6+n7,5)*_q(n1+n8,2)
-		+ k6*_q(n2,1)*_q(n3,1)*_q(n4+n5+n6+n7,4)*_q(n1+n8,2)
-		- k6*_q(n2+n3,2)*_q(n4+n5+n6+n7,4)*_q(n1+n8,2)
-		- k24*_q(n3,1)*_q(n2+n4+n5+n6+n7,5)*_q(n1+n8,2)
-		- k24*_q(n2,1)*_q(n3+n4+n5+n6+n7,5)*_q(n1+n8,2)
-		+ k120*_q(n2+n3+n4+n5+n6+n7,6)*_q(n1+n8,2)
-		- _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n2+n8,2)
-		+ _q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n2+n8,2)
-		+ _q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n2+n8,2)
-		+ _q(n1,1)*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n2+n8,2)
-		- k2*_q(n1+n3+n4,3)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n2+n8,2)
-		+ _q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)*_q(n2+n8,2)
-		- _q(n3+n4,2)*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)*_q(n2+n8,2)
-		+ _q(n1,1)*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)*_q(n2+n8,2)
-		- _q(n1+n4,2)*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)*_q(n2+n8,2)
-		- k2*_q(n4,1)*_q(n1+n3+n5,3)*_q(n6,1)*_q(n7,1)*_q(n2+n8,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)*_q(n2+n8,2)
-		- _q(n1+n3,2)*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)*_q(n2+n8,2)
-		- k2*_q(n3,1)*_q(n1+n4+n5,3)*_q(n6,1)*_q(n7,1)*_q(n2+n8,2)
-		- k2*_q(n1,1)*_q(n3+n4+n5,3)*_q(n6,1)*_q(n7,1)*_q(n2+n8,2)
-		+ k6*_q(n1+n3+n4+n5,4)*_q(n6,1)*_q(n7,1)*_q(n2+n8,2)
-		+ _q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		- _q(n3+n4,2)*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		- _q(n4,1)*_q(n3+n5,2)*_q(n1+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		- _q(n3,1)*_q(n4+n5,2)*_q(n1+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		+ k2*_q(n3+n4+n5,3)*_q(n1+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		+ _q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		- _q(n1+n4,2)*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		- _q(n4,1)*_q(n1+n5,2)*_q(n3+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		- _q(n1,1)*_q(n4+n5,2)*_q(n3+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		+ k2*_q(n1+n4+n5,3)*_q(n3+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n1+n3+n6,3)*_q(n7,1)*_q(n2+n8,2)
-		+ k2*_q(n4+n5,2)*_q(n1+n3+n6,3)*_q(n7,1)*_q(n2+n8,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		- _q(n1+n3,2)*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		- _q(n3,1)*_q(n1+n5,2)*_q(n4+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		- _q(n1,1)*_q(n3+n5,2)*_q(n4+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		+ k2*_q(n1+n3+n5,3)*_q(n4+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n1+n4+n6,3)*_q(n7,1)*_q(n2+n8,2)
-		+ k2*_q(n3+n5,2)*_q(n1+n4+n6,3)*_q(n7,1)*_q(n2+n8,2)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n3+n4+n6,3)*_q(n7,1)*_q(n2+n8,2)
-		+ k2*_q(n1+n5,2)*_q(n3+n4+n6,3)*_q(n7,1)*_q(n2+n8,2)
-		+ k6*_q(n5,1)*_q(n1+n3+n4+n6,4)*_q(n7,1)*_q(n2+n8,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		- _q(n1+n3,2)*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		- _q(n3,1)*_q(n1+n4,2)*_q(n5+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		- _q(n1,1)*_q(n3+n4,2)*_q(n5+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		+ k2*_q(n1+n3+n4,3)*_q(n5+n6,2)*_q(n7,1)*_q(n2+n8,2)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n1+n5+n6,3)*_q(n7,1)*_q(n2+n8,2)
-		+ k2*_q(n3+n4,2)*_q(n1+n5+n6,3)*_q(n7,1)*_q(n2+n8,2)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n3+n5+n6,3)*_q(n7,1)*_q(n2+n8,2)
-		+ k2*_q(n1+n4,2)*_q(n3+n5+n6,3)*_q(n7,1)*_q(n2+n8,2)
-		+ k6*_q(n4,1)*_q(n1+n3+n5+n6,4)*_q(n7,1)*_q(n2+n8,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4+n5+n6,3)*_q(n7,1)*_q(n2+n8,2)
-		+ k2*_q(n1+n3,2)*_q(n4+n5+n6,3)*_q(n7,1)*_q(n2+n8,2)
-		+ k6*_q(n3,1)*_q(n1+n4+n5+n6,4)*_q(n7,1)*_q(n2+n8,2)
-		+ k6*_q(n1,1)*_q(n3+n4+n5+n6,4)*_q(n7,1)*_q(n2+n8,2)
-		- k24*_q(n1+n3+n4+n5+n6,5)*_q(n7,1)*_q(n2+n8,2)
-		+ _q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)*_q(n2+n8,2)
-		- _q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)*_q(n2+n8,2)
-		- _q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n1+n7,2)*_q(n2+n8,2)
-		- _q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n1+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n3+n4+n5,3)*_q(n6,1)*_q(n1+n7,2)*_q(n2+n8,2)
-		- _q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n1+n7,2)*_q(n2+n8,2)
-		+ _q(n4+n5,2)*_q(n3+n6,2)*_q(n1+n7,2)*_q(n2+n8,2)
-		- _q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n1+n7,2)*_q(n2+n8,2)
-		+ _q(n3+n5,2)*_q(n4+n6,2)*_q(n1+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n5,1)*_q(n3+n4+n6,3)*_q(n1+n7,2)*_q(n2+n8,2)
-		- _q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n1+n7,2)*_q(n2+n8,2)
-		+ _q(n3+n4,2)*_q(n5+n6,2)*_q(n1+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n4,1)*_q(n3+n5+n6,3)*_q(n1+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n3,1)*_q(n4+n5+n6,3)*_q(n1+n7,2)*_q(n2+n8,2)
-		- k6*_q(n3+n4+n5+n6,4)*_q(n1+n7,2)*_q(n2+n8,2)
-		+ _q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)*_q(n2+n8,2)
-		- _q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)*_q(n2+n8,2)
-		- _q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n3+n7,2)*_q(n2+n8,2)
-		- _q(n1,1)*_q(n4+n5,2)*_q(n6,1)*_q(n3+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n1+n4+n5,3)*_q(n6,1)*_q(n3+n7,2)*_q(n2+n8,2)
-		- _q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n3+n7,2)*_q(n2+n8,2)
-		+ _q(n4+n5,2)*_q(n1+n6,2)*_q(n3+n7,2)*_q(n2+n8,2)
-		- _q(n1,1)*_q(n5,1)*_q(n4+n6,2)*_q(n3+n7,2)*_q(n2+n8,2)
-		+ _q(n1+n5,2)*_q(n4+n6,2)*_q(n3+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n5,1)*_q(n1+n4+n6,3)*_q(n3+n7,2)*_q(n2+n8,2)
-		- _q(n1,1)*_q(n4,1)*_q(n5+n6,2)*_q(n3+n7,2)*_q(n2+n8,2)
-		+ _q(n1+n4,2)*_q(n5+n6,2)*_q(n3+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n4,1)*_q(n1+n5+n6,3)*_q(n3+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n1,1)*_q(n4+n5+n6,3)*_q(n3+n7,2)*_q(n2+n8,2)
-		- k6*_q(n1+n4+n5+n6,4)*_q(n3+n7,2)*_q(n2+n8,2)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n3+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n4+n5,2)*_q(n6,1)*_q(n1+n3+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n5,1)*_q(n4+n6,2)*_q(n1+n3+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n4,1)*_q(n5+n6,2)*_q(n1+n3+n7,3)*_q(n2+n8,2)
-		- k4*_q(n4+n5+n6,3)*_q(n1+n3+n7,3)*_q(n2+n8,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)*_q(n2+n8,2)
-		- _q(n1+n3,2)*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)*_q(n2+n8,2)
-		- _q(n3,1)*_q(n1+n5,2)*_q(n6,1)*_q(n4+n7,2)*_q(n2+n8,2)
-		- _q(n1,1)*_q(n3+n5,2)*_q(n6,1)*_q(n4+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n1+n3+n5,3)*_q(n6,1)*_q(n4+n7,2)*_q(n2+n8,2)
-		- _q(n3,1)*_q(n5,1)*_q(n1+n6,2)*_q(n4+n7,2)*_q(n2+n8,2)
-		+ _q(n3+n5,2)*_q(n1+n6,2)*_q(n4+n7,2)*_q(n2+n8,2)
-		- _q(n1,1)*_q(n5,1)*_q(n3+n6,2)*_q(n4+n7,2)*_q(n2+n8,2)
-		+ _q(n1+n5,2)*_q(n3+n6,2)*_q(n4+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n5,1)*_q(n1+n3+n6,3)*_q(n4+n7,2)*_q(n2+n8,2)
-		- _q(n1,1)*_q(n3,1)*_q(n5+n6,2)*_q(n4+n7,2)*_q(n2+n8,2)
-		+ _q(n1+n3,2)*_q(n5+n6,2)*_q(n4+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n5+n6,3)*_q(n4+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n1,1)*_q(n3+n5+n6,3)*_q(n4+n7,2)*_q(n2+n8,2)
-		- k6*_q(n1+n3+n5+n6,4)*_q(n4+n7,2)*_q(n2+n8,2)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n1+n4+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n3+n5,2)*_q(n6,1)*_q(n1+n4+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n5,1)*_q(n3+n6,2)*_q(n1+n4+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n3,1)*_q(n5+n6,2)*_q(n1+n4+n7,3)*_q(n2+n8,2)
-		- k4*_q(n3+n5+n6,3)*_q(n1+n4+n7,3)*_q(n2+n8,2)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n6,1)*_q(n3+n4+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n1+n5,2)*_q(n6,1)*_q(n3+n4+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n5,1)*_q(n1+n6,2)*_q(n3+n4+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n1,1)*_q(n5+n6,2)*_q(n3+n4+n7,3)*_q(n2+n8,2)
-		- k4*_q(n1+n5+n6,3)*_q(n3+n4+n7,3)*_q(n2+n8,2)
-		+ k6*_q(n5,1)*_q(n6,1)*_q(n1+n3+n4+n7,4)*_q(n2+n8,2)
-		- k6*_q(n5+n6,2)*_q(n1+n3+n4+n7,4)*_q(n2+n8,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)*_q(n2+n8,2)
-		- _q(n1+n3,2)*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)*_q(n2+n8,2)
-		- _q(n3,1)*_q(n1+n4,2)*_q(n6,1)*_q(n5+n7,2)*_q(n2+n8,2)
-		- _q(n1,1)*_q(n3+n4,2)*_q(n6,1)*_q(n5+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n1+n3+n4,3)*_q(n6,1)*_q(n5+n7,2)*_q(n2+n8,2)
-		- _q(n3,1)*_q(n4,1)*_q(n1+n6,2)*_q(n5+n7,2)*_q(n2+n8,2)
-		+ _q(n3+n4,2)*_q(n1+n6,2)*_q(n5+n7,2)*_q(n2+n8,2)
-		- _q(n1,1)*_q(n4,1)*_q(n3+n6,2)*_q(n5+n7,2)*_q(n2+n8,2)
-		+ _q(n1+n4,2)*_q(n3+n6,2)*_q(n5+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n4,1)*_q(n1+n3+n6,3)*_q(n5+n7,2)*_q(n2+n8,2)
-		- _q(n1,1)*_q(n3,1)*_q(n4+n6,2)*_q(n5+n7,2)*_q(n2+n8,2)
-		+ _q(n1+n3,2)*_q(n4+n6,2)*_q(n5+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n4+n6,3)*_q(n5+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n1,1)*_q(n3+n4+n6,3)*_q(n5+n7,2)*_q(n2+n8,2)
-		- k6*_q(n1+n3+n4+n6,4)*_q(n5+n7,2)*_q(n2+n8,2)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n1+n5+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n3+n4,2)*_q(n6,1)*_q(n1+n5+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n4,1)*_q(n3+n6,2)*_q(n1+n5+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n3,1)*_q(n4+n6,2)*_q(n1+n5+n7,3)*_q(n2+n8,2)
-		- k4*_q(n3+n4+n6,3)*_q(n1+n5+n7,3)*_q(n2+n8,2)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n6,1)*_q(n3+n5+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n1+n4,2)*_q(n6,1)*_q(n3+n5+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n4,1)*_q(n1+n6,2)*_q(n3+n5+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n1,1)*_q(n4+n6,2)*_q(n3+n5+n7,3)*_q(n2+n8,2)
-		- k4*_q(n1+n4+n6,3)*_q(n3+n5+n7,3)*_q(n2+n8,2)
-		+ k6*_q(n4,1)*_q(n6,1)*_q(n1+n3+n5+n7,4)*_q(n2+n8,2)
-		- k6*_q(n4+n6,2)*_q(n1+n3+n5+n7,4)*_q(n2+n8,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n6,1)*_q(n4+n5+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n1+n3,2)*_q(n6,1)*_q(n4+n5+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n6,2)*_q(n4+n5+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n1,1)*_q(n3+n6,2)*_q(n4+n5+n7,3)*_q(n2+n8,2)
-		- k4*_q(n1+n3+n6,3)*_q(n4+n5+n7,3)*_q(n2+n8,2)
-		+ k6*_q(n3,1)*_q(n6,1)*_q(n1+n4+n5+n7,4)*_q(n2+n8,2)
-		- k6*_q(n3+n6,2)*_q(n1+n4+n5+n7,4)*_q(n2+n8,2)
-		+ k6*_q(n1,1)*_q(n6,1)*_q(n3+n4+n5+n7,4)*_q(n2+n8,2)
-		- k6*_q(n1+n6,2)*_q(n3+n4+n5+n7,4)*_q(n2+n8,2)
-		- k24*_q(n6,1)*_q(n1+n3+n4+n5+n7,5)*_q(n2+n8,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)*_q(n2+n8,2)
-		- _q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)*_q(n2+n8,2)
-		- _q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n6+n7,2)*_q(n2+n8,2)
-		- _q(n1,1)*_q(n3+n4,2)*_q(n5,1)*_q(n6+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n1+n3+n4,3)*_q(n5,1)*_q(n6+n7,2)*_q(n2+n8,2)
-		- _q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n6+n7,2)*_q(n2+n8,2)
-		+ _q(n3+n4,2)*_q(n1+n5,2)*_q(n6+n7,2)*_q(n2+n8,2)
-		- _q(n1,1)*_q(n4,1)*_q(n3+n5,2)*_q(n6+n7,2)*_q(n2+n8,2)
-		+ _q(n1+n4,2)*_q(n3+n5,2)*_q(n6+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n4,1)*_q(n1+n3+n5,3)*_q(n6+n7,2)*_q(n2+n8,2)
-		- _q(n1,1)*_q(n3,1)*_q(n4+n5,2)*_q(n6+n7,2)*_q(n2+n8,2)
-		+ _q(n1+n3,2)*_q(n4+n5,2)*_q(n6+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n4+n5,3)*_q(n6+n7,2)*_q(n2+n8,2)
-		+ k2*_q(n1,1)*_q(n3+n4+n5,3)*_q(n6+n7,2)*_q(n2+n8,2)
-		- k6*_q(n1+n3+n4+n5,4)*_q(n6+n7,2)*_q(n2+n8,2)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n6+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n3+n4,2)*_q(n5,1)*_q(n1+n6+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n4,1)*_q(n3+n5,2)*_q(n1+n6+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n3,1)*_q(n4+n5,2)*_q(n1+n6+n7,3)*_q(n2+n8,2)
-		- k4*_q(n3+n4+n5,3)*_q(n1+n6+n7,3)*_q(n2+n8,2)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n3+n6+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n1+n4,2)*_q(n5,1)*_q(n3+n6+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n4,1)*_q(n1+n5,2)*_q(n3+n6+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n1,1)*_q(n4+n5,2)*_q(n3+n6+n7,3)*_q(n2+n8,2)
-		- k4*_q(n1+n4+n5,3)*_q(n3+n6+n7,3)*_q(n2+n8,2)
-		+ k6*_q(n4,1)*_q(n5,1)*_q(n1+n3+n6+n7,4)*_q(n2+n8,2)
-		- k6*_q(n4+n5,2)*_q(n1+n3+n6+n7,4)*_q(n2+n8,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n4+n6+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n1+n3,2)*_q(n5,1)*_q(n4+n6+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n5,2)*_q(n4+n6+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n1,1)*_q(n3+n5,2)*_q(n4+n6+n7,3)*_q(n2+n8,2)
-		- k4*_q(n1+n3+n5,3)*_q(n4+n6+n7,3)*_q(n2+n8,2)
-		+ k6*_q(n3,1)*_q(n5,1)*_q(n1+n4+n6+n7,4)*_q(n2+n8,2)
-		- k6*_q(n3+n5,2)*_q(n1+n4+n6+n7,4)*_q(n2+n8,2)
-		+ k6*_q(n1,1)*_q(n5,1)*_q(n3+n4+n6+n7,4)*_q(n2+n8,2)
-		- k6*_q(n1+n5,2)*_q(n3+n4+n6+n7,4)*_q(n2+n8,2)
-		- k24*_q(n5,1)*_q(n1+n3+n4+n6+n7,5)*_q(n2+n8,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5+n6+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n1+n3,2)*_q(n4,1)*_q(n5+n6+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n4,2)*_q(n5+n6+n7,3)*_q(n2+n8,2)
-		+ k2*_q(n1,1)*_q(n3+n4,2)*_q(n5+n6+n7,3)*_q(n2+n8,2)
-		- k4*_q(n1+n3+n4,3)*_q(n5+n6+n7,3)*_q(n2+n8,2)
-		+ k6*_q(n3,1)*_q(n4,1)*_q(n1+n5+n6+n7,4)*_q(n2+n8,2)
-		- k6*_q(n3+n4,2)*_q(n1+n5+n6+n7,4)*_q(n2+n8,2)
-		+ k6*_q(n1,1)*_q(n4,1)*_q(n3+n5+n6+n7,4)*_q(n2+n8,2)
-		- k6*_q(n1+n4,2)*_q(n3+n5+n6+n7,4)*_q(n2+n8,2)
-		- k24*_q(n4,1)*_q(n1+n3+n5+n6+n7,5)*_q(n2+n8,2)
-		+ k6*_q(n1,1)*_q(n3,1)*_q(n4+n5+n6+n7,4)*_q(n2+n8,2)
-		- k6*_q(n1+n3,2)*_q(n4+n5+n6+n7,4)*_q(n2+n8,2)
-		- k24*_q(n3,1)*_q(n1+n4+n5+n6+n7,5)*_q(n2+n8,2)
-		- k24*_q(n1,1)*_q(n3+n4+n5+n6+n7,5)*_q(n2+n8,2)
-		+ k120*_q(n1+n3+n4+n5+n6+n7,6)*_q(n2+n8,2)
-		+ k2*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n1+n2+n8,3)
-		- k2*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n1+n2+n8,3)
-		- k2*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)*_q(n1+n2+n8,3)
-		- k2*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)*_q(n1+n2+n8,3)
-		+ k4*_q(n3+n4+n5,3)*_q(n6,1)*_q(n7,1)*_q(n1+n2+n8,3)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)*_q(n1+n2+n8,3)
-		+ k2*_q(n4+n5,2)*_q(n3+n6,2)*_q(n7,1)*_q(n1+n2+n8,3)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)*_q(n1+n2+n8,3)
-		+ k2*_q(n3+n5,2)*_q(n4+n6,2)*_q(n7,1)*_q(n1+n2+n8,3)
-		+ k4*_q(n5,1)*_q(n3+n4+n6,3)*_q(n7,1)*_q(n1+n2+n8,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)*_q(n1+n2+n8,3)
-		+ k2*_q(n3+n4,2)*_q(n5+n6,2)*_q(n7,1)*_q(n1+n2+n8,3)
-		+ k4*_q(n4,1)*_q(n3+n5+n6,3)*_q(n7,1)*_q(n1+n2+n8,3)
-		+ k4*_q(n3,1)*_q(n4+n5+n6,3)*_q(n7,1)*_q(n1+n2+n8,3)
-		- k12*_q(n3+n4+n5+n6,4)*_q(n7,1)*_q(n1+n2+n8,3)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)*_q(n1+n2+n8,3)
-		+ k2*_q(n4+n5,2)*_q(n6,1)*_q(n3+n7,2)*_q(n1+n2+n8,3)
-		+ k2*_q(n5,1)*_q(n4+n6,2)*_q(n3+n7,2)*_q(n1+n2+n8,3)
-		+ k2*_q(n4,1)*_q(n5+n6,2)*_q(n3+n7,2)*_q(n1+n2+n8,3)
-		- k4*_q(n4+n5+n6,3)*_q(n3+n7,2)*_q(n1+n2+n8,3)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)*_q(n1+n2+n8,3)
-		+ k2*_q(n3+n5,2)*_q(n6,1)*_q(n4+n7,2)*_q(n1+n2+n8,3)
-		+ k2*_q(n5,1)*_q(n3+n6,2)*_q(n4+n7,2)*_q(n1+n2+n8,3)
-		+ k2*_q(n3,1)*_q(n5+n6,2)*_q(n4+n7,2)*_q(n1+n2+n8,3)
-		- k4*_q(n3+n5+n6,3)*_q(n4+n7,2)*_q(n1+n2+n8,3)
-		+ k4*_q(n5,1)*_q(n6,1)*_q(n3+n4+n7,3)*_q(n1+n2+n8,3)
-		- k4*_q(n5+n6,2)*_q(n3+n4+n7,3)*_q(n1+n2+n8,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)*_q(n1+n2+n8,3)
-		+ k2*_q(n3+n4,2)*_q(n6,1)*_q(n5+n7,2)*_q(n1+n2+n8,3)
-		+ k2*_q(n4,1)*_q(n3+n6,2)*_q(n5+n7,2)*_q(n1+n2+n8,3)
-		+ k2*_q(n3,1)*_q(n4+n6,2)*_q(n5+n7,2)*_q(n1+n2+n8,3)
-		- k4*_q(n3+n4+n6,3)*_q(n5+n7,2)*_q(n1+n2+n8,3)
-		+ k4*_q(n4,1)*_q(n6,1)*_q(n3+n5+n7,3)*_q(n1+n2+n8,3)
-		- k4*_q(n4+n6,2)*_q(n3+n5+n7,3)*_q(n1+n2+n8,3)
-		+ k4*_q(n3,1)*_q(n6,1)*_q(n4+n5+n7,3)*_q(n1+n2+n8,3)
-		- k4*_q(n3+n6,2)*_q(n4+n5+n7,3)*_q(n1+n2+n8,3)
-		- k12*_q(n6,1)*_q(n3+n4+n5+n7,4)*_q(n1+n2+n8,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)*_q(n1+n2+n8,3)
-		+ k2*_q(n3+n4,2)*_q(n5,1)*_q(n6+n7,2)*_q(n1+n2+n8,3)
-		+ k2*_q(n4,1)*_q(n3+n5,2)*_q(n6+n7,2)*_q(n1+n2+n8,3)
-		+ k2*_q(n3,1)*_q(n4+n5,2)*_q(n6+n7,2)*_q(n1+n2+n8,3)
-		- k4*_q(n3+n4+n5,3)*_q(n6+n7,2)*_q(n1+n2+n8,3)
-		+ k4*_q(n4,1)*_q(n5,1)*_q(n3+n6+n7,3)*_q(n1+n2+n8,3)
-		- k4*_q(n4+n5,2)*_q(n3+n6+n7,3)*_q(n1+n2+n8,3)
-		+ k4*_q(n3,1)*_q(n5,1)*_q(n4+n6+n7,3)*_q(n1+n2+n8,3)
-		- k4*_q(n3+n5,2)*_q(n4+n6+n7,3)*_q(n1+n2+n8,3)
-		- k12*_q(n5,1)*_q(n3+n4+n6+n7,4)*_q(n1+n2+n8,3)
-		+ k4*_q(n3,1)*_q(n4,1)*_q(n5+n6+n7,3)*_q(n1+n2+n8,3)
-		- k4*_q(n3+n4,2)*_q(n5+n6+n7,3)*_q(n1+n2+n8,3)
-		- k12*_q(n4,1)*_q(n3+n5+n6+n7,4)*_q(n1+n2+n8,3)
-		- k12*_q(n3,1)*_q(n4+n5+n6+n7,4)*_q(n1+n2+n8,3)
-		+ k48*_q(n3+n4+n5+n6+n7,5)*_q(n1+n2+n8,3)
-		- _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n3+n8,2)
-		+ _q(n1+n2,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n3+n8,2)
-		+ _q(n2,1)*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n3+n8,2)
-		+ _q(n1,1)*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n3+n8,2)
-		- k2*_q(n1+n2+n4,3)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n3+n8,2)
-		+ _q(n2,1)*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)*_q(n3+n8,2)
-		- _q(n2+n4,2)*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)*_q(n3+n8,2)
-		+ _q(n1,1)*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)*_q(n3+n8,2)
-		- _q(n1+n4,2)*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)*_q(n3+n8,2)
-		- k2*_q(n4,1)*_q(n1+n2+n5,3)*_q(n6,1)*_q(n7,1)*_q(n3+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)*_q(n3+n8,2)
-		- _q(n1+n2,2)*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)*_q(n3+n8,2)
-		- k2*_q(n2,1)*_q(n1+n4+n5,3)*_q(n6,1)*_q(n7,1)*_q(n3+n8,2)
-		- k2*_q(n1,1)*_q(n2+n4+n5,3)*_q(n6,1)*_q(n7,1)*_q(n3+n8,2)
-		+ k6*_q(n1+n2+n4+n5,4)*_q(n6,1)*_q(n7,1)*_q(n3+n8,2)
-		+ _q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		- _q(n2+n4,2)*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		- _q(n4,1)*_q(n2+n5,2)*_q(n1+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		- _q(n2,1)*_q(n4+n5,2)*_q(n1+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		+ k2*_q(n2+n4+n5,3)*_q(n1+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		+ _q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		- _q(n1+n4,2)*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		- _q(n4,1)*_q(n1+n5,2)*_q(n2+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		- _q(n1,1)*_q(n4+n5,2)*_q(n2+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		+ k2*_q(n1+n4+n5,3)*_q(n2+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n1+n2+n6,3)*_q(n7,1)*_q(n3+n8,2)
-		+ k2*_q(n4+n5,2)*_q(n1+n2+n6,3)*_q(n7,1)*_q(n3+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		- _q(n1+n2,2)*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		- _q(n2,1)*_q(n1+n5,2)*_q(n4+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		- _q(n1,1)*_q(n2+n5,2)*_q(n4+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		+ k2*_q(n1+n2+n5,3)*_q(n4+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n1+n4+n6,3)*_q(n7,1)*_q(n3+n8,2)
-		+ k2*_q(n2+n5,2)*_q(n1+n4+n6,3)*_q(n7,1)*_q(n3+n8,2)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n2+n4+n6,3)*_q(n7,1)*_q(n3+n8,2)
-		+ k2*_q(n1+n5,2)*_q(n2+n4+n6,3)*_q(n7,1)*_q(n3+n8,2)
-		+ k6*_q(n5,1)*_q(n1+n2+n4+n6,4)*_q(n7,1)*_q(n3+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		- _q(n1+n2,2)*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		- _q(n2,1)*_q(n1+n4,2)*_q(n5+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		- _q(n1,1)*_q(n2+n4,2)*_q(n5+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		+ k2*_q(n1+n2+n4,3)*_q(n5+n6,2)*_q(n7,1)*_q(n3+n8,2)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n1+n5+n6,3)*_q(n7,1)*_q(n3+n8,2)
-		+ k2*_q(n2+n4,2)*_q(n1+n5+n6,3)*_q(n7,1)*_q(n3+n8,2)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n2+n5+n6,3)*_q(n7,1)*_q(n3+n8,2)
-		+ k2*_q(n1+n4,2)*_q(n2+n5+n6,3)*_q(n7,1)*_q(n3+n8,2)
-		+ k6*_q(n4,1)*_q(n1+n2+n5+n6,4)*_q(n7,1)*_q(n3+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4+n5+n6,3)*_q(n7,1)*_q(n3+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n4+n5+n6,3)*_q(n7,1)*_q(n3+n8,2)
-		+ k6*_q(n2,1)*_q(n1+n4+n5+n6,4)*_q(n7,1)*_q(n3+n8,2)
-		+ k6*_q(n1,1)*_q(n2+n4+n5+n6,4)*_q(n7,1)*_q(n3+n8,2)
-		- k24*_q(n1+n2+n4+n5+n6,5)*_q(n7,1)*_q(n3+n8,2)
-		+ _q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)*_q(n3+n8,2)
-		- _q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)*_q(n3+n8,2)
-		- _q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n1+n7,2)*_q(n3+n8,2)
-		- _q(n2,1)*_q(n4+n5,2)*_q(n6,1)*_q(n1+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n2+n4+n5,3)*_q(n6,1)*_q(n1+n7,2)*_q(n3+n8,2)
-		- _q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n1+n7,2)*_q(n3+n8,2)
-		+ _q(n4+n5,2)*_q(n2+n6,2)*_q(n1+n7,2)*_q(n3+n8,2)
-		- _q(n2,1)*_q(n5,1)*_q(n4+n6,2)*_q(n1+n7,2)*_q(n3+n8,2)
-		+ _q(n2+n5,2)*_q(n4+n6,2)*_q(n1+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n5,1)*_q(n2+n4+n6,3)*_q(n1+n7,2)*_q(n3+n8,2)
-		- _q(n2,1)*_q(n4,1)*_q(n5+n6,2)*_q(n1+n7,2)*_q(n3+n8,2)
-		+ _q(n2+n4,2)*_q(n5+n6,2)*_q(n1+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n4,1)*_q(n2+n5+n6,3)*_q(n1+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n2,1)*_q(n4+n5+n6,3)*_q(n1+n7,2)*_q(n3+n8,2)
-		- k6*_q(n2+n4+n5+n6,4)*_q(n1+n7,2)*_q(n3+n8,2)
-		+ _q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)*_q(n3+n8,2)
-		- _q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)*_q(n3+n8,2)
-		- _q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n2+n7,2)*_q(n3+n8,2)
-		- _q(n1,1)*_q(n4+n5,2)*_q(n6,1)*_q(n2+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n1+n4+n5,3)*_q(n6,1)*_q(n2+n7,2)*_q(n3+n8,2)
-		- _q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n2+n7,2)*_q(n3+n8,2)
-		+ _q(n4+n5,2)*_q(n1+n6,2)*_q(n2+n7,2)*_q(n3+n8,2)
-		- _q(n1,1)*_q(n5,1)*_q(n4+n6,2)*_q(n2+n7,2)*_q(n3+n8,2)
-		+ _q(n1+n5,2)*_q(n4+n6,2)*_q(n2+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n5,1)*_q(n1+n4+n6,3)*_q(n2+n7,2)*_q(n3+n8,2)
-		- _q(n1,1)*_q(n4,1)*_q(n5+n6,2)*_q(n2+n7,2)*_q(n3+n8,2)
-		+ _q(n1+n4,2)*_q(n5+n6,2)*_q(n2+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n4,1)*_q(n1+n5+n6,3)*_q(n2+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n1,1)*_q(n4+n5+n6,3)*_q(n2+n7,2)*_q(n3+n8,2)
-		- k6*_q(n1+n4+n5+n6,4)*_q(n2+n7,2)*_q(n3+n8,2)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n2+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n4+n5,2)*_q(n6,1)*_q(n1+n2+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n5,1)*_q(n4+n6,2)*_q(n1+n2+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n4,1)*_q(n5+n6,2)*_q(n1+n2+n7,3)*_q(n3+n8,2)
-		- k4*_q(n4+n5+n6,3)*_q(n1+n2+n7,3)*_q(n3+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)*_q(n3+n8,2)
-		- _q(n1+n2,2)*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)*_q(n3+n8,2)
-		- _q(n2,1)*_q(n1+n5,2)*_q(n6,1)*_q(n4+n7,2)*_q(n3+n8,2)
-		- _q(n1,1)*_q(n2+n5,2)*_q(n6,1)*_q(n4+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n1+n2+n5,3)*_q(n6,1)*_q(n4+n7,2)*_q(n3+n8,2)
-		- _q(n2,1)*_q(n5,1)*_q(n1+n6,2)*_q(n4+n7,2)*_q(n3+n8,2)
-		+ _q(n2+n5,2)*_q(n1+n6,2)*_q(n4+n7,2)*_q(n3+n8,2)
-		- _q(n1,1)*_q(n5,1)*_q(n2+n6,2)*_q(n4+n7,2)*_q(n3+n8,2)
-		+ _q(n1+n5,2)*_q(n2+n6,2)*_q(n4+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n5,1)*_q(n1+n2+n6,3)*_q(n4+n7,2)*_q(n3+n8,2)
-		- _q(n1,1)*_q(n2,1)*_q(n5+n6,2)*_q(n4+n7,2)*_q(n3+n8,2)
-		+ _q(n1+n2,2)*_q(n5+n6,2)*_q(n4+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n5+n6,3)*_q(n4+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n5+n6,3)*_q(n4+n7,2)*_q(n3+n8,2)
-		- k6*_q(n1+n2+n5+n6,4)*_q(n4+n7,2)*_q(n3+n8,2)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n6,1)*_q(n1+n4+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n2+n5,2)*_q(n6,1)*_q(n1+n4+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n5,1)*_q(n2+n6,2)*_q(n1+n4+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n2,1)*_q(n5+n6,2)*_q(n1+n4+n7,3)*_q(n3+n8,2)
-		- k4*_q(n2+n5+n6,3)*_q(n1+n4+n7,3)*_q(n3+n8,2)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n6,1)*_q(n2+n4+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n1+n5,2)*_q(n6,1)*_q(n2+n4+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n5,1)*_q(n1+n6,2)*_q(n2+n4+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n1,1)*_q(n5+n6,2)*_q(n2+n4+n7,3)*_q(n3+n8,2)
-		- k4*_q(n1+n5+n6,3)*_q(n2+n4+n7,3)*_q(n3+n8,2)
-		+ k6*_q(n5,1)*_q(n6,1)*_q(n1+n2+n4+n7,4)*_q(n3+n8,2)
-		- k6*_q(n5+n6,2)*_q(n1+n2+n4+n7,4)*_q(n3+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)*_q(n3+n8,2)
-		- _q(n1+n2,2)*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)*_q(n3+n8,2)
-		- _q(n2,1)*_q(n1+n4,2)*_q(n6,1)*_q(n5+n7,2)*_q(n3+n8,2)
-		- _q(n1,1)*_q(n2+n4,2)*_q(n6,1)*_q(n5+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n1+n2+n4,3)*_q(n6,1)*_q(n5+n7,2)*_q(n3+n8,2)
-		- _q(n2,1)*_q(n4,1)*_q(n1+n6,2)*_q(n5+n7,2)*_q(n3+n8,2)
-		+ _q(n2+n4,2)*_q(n1+n6,2)*_q(n5+n7,2)*_q(n3+n8,2)
-		- _q(n1,1)*_q(n4,1)*_q(n2+n6,2)*_q(n5+n7,2)*_q(n3+n8,2)
-		+ _q(n1+n4,2)*_q(n2+n6,2)*_q(n5+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n4,1)*_q(n1+n2+n6,3)*_q(n5+n7,2)*_q(n3+n8,2)
-		- _q(n1,1)*_q(n2,1)*_q(n4+n6,2)*_q(n5+n7,2)*_q(n3+n8,2)
-		+ _q(n1+n2,2)*_q(n4+n6,2)*_q(n5+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n4+n6,3)*_q(n5+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n4+n6,3)*_q(n5+n7,2)*_q(n3+n8,2)
-		- k6*_q(n1+n2+n4+n6,4)*_q(n5+n7,2)*_q(n3+n8,2)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n6,1)*_q(n1+n5+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n2+n4,2)*_q(n6,1)*_q(n1+n5+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n4,1)*_q(n2+n6,2)*_q(n1+n5+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n2,1)*_q(n4+n6,2)*_q(n1+n5+n7,3)*_q(n3+n8,2)
-		- k4*_q(n2+n4+n6,3)*_q(n1+n5+n7,3)*_q(n3+n8,2)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n6,1)*_q(n2+n5+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n1+n4,2)*_q(n6,1)*_q(n2+n5+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n4,1)*_q(n1+n6,2)*_q(n2+n5+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n1,1)*_q(n4+n6,2)*_q(n2+n5+n7,3)*_q(n3+n8,2)
-		- k4*_q(n1+n4+n6,3)*_q(n2+n5+n7,3)*_q(n3+n8,2)
-		+ k6*_q(n4,1)*_q(n6,1)*_q(n1+n2+n5+n7,4)*_q(n3+n8,2)
-		- k6*_q(n4+n6,2)*_q(n1+n2+n5+n7,4)*_q(n3+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n6,1)*_q(n4+n5+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n6,1)*_q(n4+n5+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n6,2)*_q(n4+n5+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n6,2)*_q(n4+n5+n7,3)*_q(n3+n8,2)
-		- k4*_q(n1+n2+n6,3)*_q(n4+n5+n7,3)*_q(n3+n8,2)
-		+ k6*_q(n2,1)*_q(n6,1)*_q(n1+n4+n5+n7,4)*_q(n3+n8,2)
-		- k6*_q(n2+n6,2)*_q(n1+n4+n5+n7,4)*_q(n3+n8,2)
-		+ k6*_q(n1,1)*_q(n6,1)*_q(n2+n4+n5+n7,4)*_q(n3+n8,2)
-		- k6*_q(n1+n6,2)*_q(n2+n4+n5+n7,4)*_q(n3+n8,2)
-		- k24*_q(n6,1)*_q(n1+n2+n4+n5+n7,5)*_q(n3+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)*_q(n3+n8,2)
-		- _q(n1+n2,2)*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)*_q(n3+n8,2)
-		- _q(n2,1)*_q(n1+n4,2)*_q(n5,1)*_q(n6+n7,2)*_q(n3+n8,2)
-		- _q(n1,1)*_q(n2+n4,2)*_q(n5,1)*_q(n6+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n1+n2+n4,3)*_q(n5,1)*_q(n6+n7,2)*_q(n3+n8,2)
-		- _q(n2,1)*_q(n4,1)*_q(n1+n5,2)*_q(n6+n7,2)*_q(n3+n8,2)
-		+ _q(n2+n4,2)*_q(n1+n5,2)*_q(n6+n7,2)*_q(n3+n8,2)
-		- _q(n1,1)*_q(n4,1)*_q(n2+n5,2)*_q(n6+n7,2)*_q(n3+n8,2)
-		+ _q(n1+n4,2)*_q(n2+n5,2)*_q(n6+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n4,1)*_q(n1+n2+n5,3)*_q(n6+n7,2)*_q(n3+n8,2)
-		- _q(n1,1)*_q(n2,1)*_q(n4+n5,2)*_q(n6+n7,2)*_q(n3+n8,2)
-		+ _q(n1+n2,2)*_q(n4+n5,2)*_q(n6+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n4+n5,3)*_q(n6+n7,2)*_q(n3+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n4+n5,3)*_q(n6+n7,2)*_q(n3+n8,2)
-		- k6*_q(n1+n2+n4+n5,4)*_q(n6+n7,2)*_q(n3+n8,2)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n1+n6+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n2+n4,2)*_q(n5,1)*_q(n1+n6+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n4,1)*_q(n2+n5,2)*_q(n1+n6+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n2,1)*_q(n4+n5,2)*_q(n1+n6+n7,3)*_q(n3+n8,2)
-		- k4*_q(n2+n4+n5,3)*_q(n1+n6+n7,3)*_q(n3+n8,2)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n2+n6+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n1+n4,2)*_q(n5,1)*_q(n2+n6+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n4,1)*_q(n1+n5,2)*_q(n2+n6+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n1,1)*_q(n4+n5,2)*_q(n2+n6+n7,3)*_q(n3+n8,2)
-		- k4*_q(n1+n4+n5,3)*_q(n2+n6+n7,3)*_q(n3+n8,2)
-		+ k6*_q(n4,1)*_q(n5,1)*_q(n1+n2+n6+n7,4)*_q(n3+n8,2)
-		- k6*_q(n4+n5,2)*_q(n1+n2+n6+n7,4)*_q(n3+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n4+n6+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n5,1)*_q(n4+n6+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n5,2)*_q(n4+n6+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n5,2)*_q(n4+n6+n7,3)*_q(n3+n8,2)
-		- k4*_q(n1+n2+n5,3)*_q(n4+n6+n7,3)*_q(n3+n8,2)
-		+ k6*_q(n2,1)*_q(n5,1)*_q(n1+n4+n6+n7,4)*_q(n3+n8,2)
-		- k6*_q(n2+n5,2)*_q(n1+n4+n6+n7,4)*_q(n3+n8,2)
-		+ k6*_q(n1,1)*_q(n5,1)*_q(n2+n4+n6+n7,4)*_q(n3+n8,2)
-		- k6*_q(n1+n5,2)*_q(n2+n4+n6+n7,4)*_q(n3+n8,2)
-		- k24*_q(n5,1)*_q(n1+n2+n4+n6+n7,5)*_q(n3+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5+n6+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n4,1)*_q(n5+n6+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n4,2)*_q(n5+n6+n7,3)*_q(n3+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n4,2)*_q(n5+n6+n7,3)*_q(n3+n8,2)
-		- k4*_q(n1+n2+n4,3)*_q(n5+n6+n7,3)*_q(n3+n8,2)
-		+ k6*_q(n2,1)*_q(n4,1)*_q(n1+n5+n6+n7,4)*_q(n3+n8,2)
-		- k6*_q(n2+n4,2)*_q(n1+n5+n6+n7,4)*_q(n3+n8,2)
-		+ k6*_q(n1,1)*_q(n4,1)*_q(n2+n5+n6+n7,4)*_q(n3+n8,2)
-		- k6*_q(n1+n4,2)*_q(n2+n5+n6+n7,4)*_q(n3+n8,2)
-		- k24*_q(n4,1)*_q(n1+n2+n5+n6+n7,5)*_q(n3+n8,2)
-		+ k6*_q(n1,1)*_q(n2,1)*_q(n4+n5+n6+n7,4)*_q(n3+n8,2)
-		- k6*_q(n1+n2,2)*_q(n4+n5+n6+n7,4)*_q(n3+n8,2)
-		- k24*_q(n2,1)*_q(n1+n4+n5+n6+n7,5)*_q(n3+n8,2)
-		- k24*_q(n1,1)*_q(n2+n4+n5+n6+n7,5)*_q(n3+n8,2)
-		+ k120*_q(n1+n2+n4+n5+n6+n7,6)*_q(n3+n8,2)
-		+ k2*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n1+n3+n8,3)
-		- k2*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n1+n3+n8,3)
-		- k2*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)*_q(n1+n3+n8,3)
-		- k2*_q(n2,1)*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)*_q(n1+n3+n8,3)
-		+ k4*_q(n2+n4+n5,3)*_q(n6,1)*_q(n7,1)*_q(n1+n3+n8,3)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)*_q(n1+n3+n8,3)
-		+ k2*_q(n4+n5,2)*_q(n2+n6,2)*_q(n7,1)*_q(n1+n3+n8,3)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)*_q(n1+n3+n8,3)
-		+ k2*_q(n2+n5,2)*_q(n4+n6,2)*_q(n7,1)*_q(n1+n3+n8,3)
-		+ k4*_q(n5,1)*_q(n2+n4+n6,3)*_q(n7,1)*_q(n1+n3+n8,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)*_q(n1+n3+n8,3)
-		+ k2*_q(n2+n4,2)*_q(n5+n6,2)*_q(n7,1)*_q(n1+n3+n8,3)
-		+ k4*_q(n4,1)*_q(n2+n5+n6,3)*_q(n7,1)*_q(n1+n3+n8,3)
-		+ k4*_q(n2,1)*_q(n4+n5+n6,3)*_q(n7,1)*_q(n1+n3+n8,3)
-		- k12*_q(n2+n4+n5+n6,4)*_q(n7,1)*_q(n1+n3+n8,3)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)*_q(n1+n3+n8,3)
-		+ k2*_q(n4+n5,2)*_q(n6,1)*_q(n2+n7,2)*_q(n1+n3+n8,3)
-		+ k2*_q(n5,1)*_q(n4+n6,2)*_q(n2+n7,2)*_q(n1+n3+n8,3)
-		+ k2*_q(n4,1)*_q(n5+n6,2)*_q(n2+n7,2)*_q(n1+n3+n8,3)
-		- k4*_q(n4+n5+n6,3)*_q(n2+n7,2)*_q(n1+n3+n8,3)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)*_q(n1+n3+n8,3)
-		+ k2*_q(n2+n5,2)*_q(n6,1)*_q(n4+n7,2)*_q(n1+n3+n8,3)
-		+ k2*_q(n5,1)*_q(n2+n6,2)*_q(n4+n7,2)*_q(n1+n3+n8,3)
-		+ k2*_q(n2,1)*_q(n5+n6,2)*_q(n4+n7,2)*_q(n1+n3+n8,3)
-		- k4*_q(n2+n5+n6,3)*_q(n4+n7,2)*_q(n1+n3+n8,3)
-		+ k4*_q(n5,1)*_q(n6,1)*_q(n2+n4+n7,3)*_q(n1+n3+n8,3)
-		- k4*_q(n5+n6,2)*_q(n2+n4+n7,3)*_q(n1+n3+n8,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)*_q(n1+n3+n8,3)
-		+ k2*_q(n2+n4,2)*_q(n6,1)*_q(n5+n7,2)*_q(n1+n3+n8,3)
-		+ k2*_q(n4,1)*_q(n2+n6,2)*_q(n5+n7,2)*_q(n1+n3+n8,3)
-		+ k2*_q(n2,1)*_q(n4+n6,2)*_q(n5+n7,2)*_q(n1+n3+n8,3)
-		- k4*_q(n2+n4+n6,3)*_q(n5+n7,2)*_q(n1+n3+n8,3)
-		+ k4*_q(n4,1)*_q(n6,1)*_q(n2+n5+n7,3)*_q(n1+n3+n8,3)
-		- k4*_q(n4+n6,2)*_q(n2+n5+n7,3)*_q(n1+n3+n8,3)
-		+ k4*_q(n2,1)*_q(n6,1)*_q(n4+n5+n7,3)*_q(n1+n3+n8,3)
-		- k4*_q(n2+n6,2)*_q(n4+n5+n7,3)*_q(n1+n3+n8,3)
-		- k12*_q(n6,1)*_q(n2+n4+n5+n7,4)*_q(n1+n3+n8,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)*_q(n1+n3+n8,3)
-		+ k2*_q(n2+n4,2)*_q(n5,1)*_q(n6+n7,2)*_q(n1+n3+n8,3)
-		+ k2*_q(n4,1)*_q(n2+n5,2)*_q(n6+n7,2)*_q(n1+n3+n8,3)
-		+ k2*_q(n2,1)*_q(n4+n5,2)*_q(n6+n7,2)*_q(n1+n3+n8,3)
-		- k4*_q(n2+n4+n5,3)*_q(n6+n7,2)*_q(n1+n3+n8,3)
-		+ k4*_q(n4,1)*_q(n5,1)*_q(n2+n6+n7,3)*_q(n1+n3+n8,3)
-		- k4*_q(n4+n5,2)*_q(n2+n6+n7,3)*_q(n1+n3+n8,3)
-		+ k4*_q(n2,1)*_q(n5,1)*_q(n4+n6+n7,3)*_q(n1+n3+n8,3)
-		- k4*_q(n2+n5,2)*_q(n4+n6+n7,3)*_q(n1+n3+n8,3)
-		- k12*_q(n5,1)*_q(n2+n4+n6+n7,4)*_q(n1+n3+n8,3)
-		+ k4*_q(n2,1)*_q(n4,1)*_q(n5+n6+n7,3)*_q(n1+n3+n8,3)
-		- k4*_q(n2+n4,2)*_q(n5+n6+n7,3)*_q(n1+n3+n8,3)
-		- k12*_q(n4,1)*_q(n2+n5+n6+n7,4)*_q(n1+n3+n8,3)
-		- k12*_q(n2,1)*_q(n4+n5+n6+n7,4)*_q(n1+n3+n8,3)
-		+ k48*_q(n2+n4+n5+n6+n7,5)*_q(n1+n3+n8,3)
-		+ k2*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n2+n3+n8,3)
-		- k2*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n2+n3+n8,3)
-		- k2*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)*_q(n2+n3+n8,3)
-		- k2*_q(n1,1)*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)*_q(n2+n3+n8,3)
-		+ k4*_q(n1+n4+n5,3)*_q(n6,1)*_q(n7,1)*_q(n2+n3+n8,3)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)*_q(n2+n3+n8,3)
-		+ k2*_q(n4+n5,2)*_q(n1+n6,2)*_q(n7,1)*_q(n2+n3+n8,3)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)*_q(n2+n3+n8,3)
-		+ k2*_q(n1+n5,2)*_q(n4+n6,2)*_q(n7,1)*_q(n2+n3+n8,3)
-		+ k4*_q(n5,1)*_q(n1+n4+n6,3)*_q(n7,1)*_q(n2+n3+n8,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)*_q(n2+n3+n8,3)
-		+ k2*_q(n1+n4,2)*_q(n5+n6,2)*_q(n7,1)*_q(n2+n3+n8,3)
-		+ k4*_q(n4,1)*_q(n1+n5+n6,3)*_q(n7,1)*_q(n2+n3+n8,3)
-		+ k4*_q(n1,1)*_q(n4+n5+n6,3)*_q(n7,1)*_q(n2+n3+n8,3)
-		- k12*_q(n1+n4+n5+n6,4)*_q(n7,1)*_q(n2+n3+n8,3)
-		- k2*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)*_q(n2+n3+n8,3)
-		+ k2*_q(n4+n5,2)*_q(n6,1)*_q(n1+n7,2)*_q(n2+n3+n8,3)
-		+ k2*_q(n5,1)*_q(n4+n6,2)*_q(n1+n7,2)*_q(n2+n3+n8,3)
-		+ k2*_q(n4,1)*_q(n5+n6,2)*_q(n1+n7,2)*_q(n2+n3+n8,3)
-		- k4*_q(n4+n5+n6,3)*_q(n1+n7,2)*_q(n2+n3+n8,3)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)*_q(n2+n3+n8,3)
-		+ k2*_q(n1+n5,2)*_q(n6,1)*_q(n4+n7,2)*_q(n2+n3+n8,3)
-		+ k2*_q(n5,1)*_q(n1+n6,2)*_q(n4+n7,2)*_q(n2+n3+n8,3)
-		+ k2*_q(n1,1)*_q(n5+n6,2)*_q(n4+n7,2)*_q(n2+n3+n8,3)
-		- k4*_q(n1+n5+n6,3)*_q(n4+n7,2)*_q(n2+n3+n8,3)
-		+ k4*_q(n5,1)*_q(n6,1)*_q(n1+n4+n7,3)*_q(n2+n3+n8,3)
-		- k4*_q(n5+n6,2)*_q(n1+n4+n7,3)*_q(n2+n3+n8,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)*_q(n2+n3+n8,3)
-		+ k2*_q(n1+n4,2)*_q(n6,1)*_q(n5+n7,2)*_q(n2+n3+n8,3)
-		+ k2*_q(n4,1)*_q(n1+n6,2)*_q(n5+n7,2)*_q(n2+n3+n8,3)
-		+ k2*_q(n1,1)*_q(n4+n6,2)*_q(n5+n7,2)*_q(n2+n3+n8,3)
-		- k4*_q(n1+n4+n6,3)*_q(n5+n7,2)*_q(n2+n3+n8,3)
-		+ k4*_q(n4,1)*_q(n6,1)*_q(n1+n5+n7,3)*_q(n2+n3+n8,3)
-		- k4*_q(n4+n6,2)*_q(n1+n5+n7,3)*_q(n2+n3+n8,3)
-		+ k4*_q(n1,1)*_q(n6,1)*_q(n4+n5+n7,3)*_q(n2+n3+n8,3)
-		- k4*_q(n1+n6,2)*_q(n4+n5+n7,3)*_q(n2+n3+n8,3)
-		- k12*_q(n6,1)*_q(n1+n4+n5+n7,4)*_q(n2+n3+n8,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)*_q(n2+n3+n8,3)
-		+ k2*_q(n1+n4,2)*_q(n5,1)*_q(n6+n7,2)*_q(n2+n3+n8,3)
-		+ k2*_q(n4,1)*_q(n1+n5,2)*_q(n6+n7,2)*_q(n2+n3+n8,3)
-		+ k2*_q(n1,1)*_q(n4+n5,2)*_q(n6+n7,2)*_q(n2+n3+n8,3)
-		- k4*_q(n1+n4+n5,3)*_q(n6+n7,2)*_q(n2+n3+n8,3)
-		+ k4*_q(n4,1)*_q(n5,1)*_q(n1+n6+n7,3)*_q(n2+n3+n8,3)
-		- k4*_q(n4+n5,2)*_q(n1+n6+n7,3)*_q(n2+n3+n8,3)
-		+ k4*_q(n1,1)*_q(n5,1)*_q(n4+n6+n7,3)*_q(n2+n3+n8,3)
-		- k4*_q(n1+n5,2)*_q(n4+n6+n7,3)*_q(n2+n3+n8,3)
-		- k12*_q(n5,1)*_q(n1+n4+n6+n7,4)*_q(n2+n3+n8,3)
-		+ k4*_q(n1,1)*_q(n4,1)*_q(n5+n6+n7,3)*_q(n2+n3+n8,3)
-		- k4*_q(n1+n4,2)*_q(n5+n6+n7,3)*_q(n2+n3+n8,3)
-		- k12*_q(n4,1)*_q(n1+n5+n6+n7,4)*_q(n2+n3+n8,3)
-		- k12*_q(n1,1)*_q(n4+n5+n6+n7,4)*_q(n2+n3+n8,3)
-		+ k48*_q(n1+n4+n5+n6+n7,5)*_q(n2+n3+n8,3)
-		- k6*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n1+n2+n3+n8,4)
-		+ k6*_q(n4+n5,2)*_q(n6,1)*_q(n7,1)*_q(n1+n2+n3+n8,4)
-		+ k6*_q(n5,1)*_q(n4+n6,2)*_q(n7,1)*_q(n1+n2+n3+n8,4)
-		+ k6*_q(n4,1)*_q(n5+n6,2)*_q(n7,1)*_q(n1+n2+n3+n8,4)
-		- k12*_q(n4+n5+n6,3)*_q(n7,1)*_q(n1+n2+n3+n8,4)
-		+ k6*_q(n5,1)*_q(n6,1)*_q(n4+n7,2)*_q(n1+n2+n3+n8,4)
-		- k6*_q(n5+n6,2)*_q(n4+n7,2)*_q(n1+n2+n3+n8,4)
-		+ k6*_q(n4,1)*_q(n6,1)*_q(n5+n7,2)*_q(n1+n2+n3+n8,4)
-		- k6*_q(n4+n6,2)*_q(n5+n7,2)*_q(n1+n2+n3+n8,4)
-		- k12*_q(n6,1)*_q(n4+n5+n7,3)*_q(n1+n2+n3+n8,4)
-		+ k6*_q(n4,1)*_q(n5,1)*_q(n6+n7,2)*_q(n1+n2+n3+n8,4)
-		- k6*_q(n4+n5,2)*_q(n6+n7,2)*_q(n1+n2+n3+n8,4)
-		- k12*_q(n5,1)*_q(n4+n6+n7,3)*_q(n1+n2+n3+n8,4)
-		- k12*_q(n4,1)*_q(n5+n6+n7,3)*_q(n1+n2+n3+n8,4)
-		+ k36*_q(n4+n5+n6+n7,4)*_q(n1+n2+n3+n8,4)
-		- _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n4+n8,2)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n4+n8,2)
-		+ _q(n2,1)*_q(n1+n3,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n4+n8,2)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n4+n8,2)
-		- k2*_q(n1+n2+n3,3)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n4+n8,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)*_q(n4+n8,2)
-		- _q(n2+n3,2)*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)*_q(n4+n8,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)*_q(n4+n8,2)
-		- _q(n1+n3,2)*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)*_q(n4+n8,2)
-		- k2*_q(n3,1)*_q(n1+n2+n5,3)*_q(n6,1)*_q(n7,1)*_q(n4+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)*_q(n4+n8,2)
-		- _q(n1+n2,2)*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)*_q(n4+n8,2)
-		- k2*_q(n2,1)*_q(n1+n3+n5,3)*_q(n6,1)*_q(n7,1)*_q(n4+n8,2)
-		- k2*_q(n1,1)*_q(n2+n3+n5,3)*_q(n6,1)*_q(n7,1)*_q(n4+n8,2)
-		+ k6*_q(n1+n2+n3+n5,4)*_q(n6,1)*_q(n7,1)*_q(n4+n8,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		- _q(n2+n3,2)*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		- _q(n3,1)*_q(n2+n5,2)*_q(n1+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		- _q(n2,1)*_q(n3+n5,2)*_q(n1+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		+ k2*_q(n2+n3+n5,3)*_q(n1+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		- _q(n1+n3,2)*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		- _q(n3,1)*_q(n1+n5,2)*_q(n2+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		- _q(n1,1)*_q(n3+n5,2)*_q(n2+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		+ k2*_q(n1+n3+n5,3)*_q(n2+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n1+n2+n6,3)*_q(n7,1)*_q(n4+n8,2)
-		+ k2*_q(n3+n5,2)*_q(n1+n2+n6,3)*_q(n7,1)*_q(n4+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		- _q(n1+n2,2)*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		- _q(n2,1)*_q(n1+n5,2)*_q(n3+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		- _q(n1,1)*_q(n2+n5,2)*_q(n3+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		+ k2*_q(n1+n2+n5,3)*_q(n3+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n1+n3+n6,3)*_q(n7,1)*_q(n4+n8,2)
-		+ k2*_q(n2+n5,2)*_q(n1+n3+n6,3)*_q(n7,1)*_q(n4+n8,2)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n2+n3+n6,3)*_q(n7,1)*_q(n4+n8,2)
-		+ k2*_q(n1+n5,2)*_q(n2+n3+n6,3)*_q(n7,1)*_q(n4+n8,2)
-		+ k6*_q(n5,1)*_q(n1+n2+n3+n6,4)*_q(n7,1)*_q(n4+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n5+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n5+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n5+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		+ k2*_q(n1+n2+n3,3)*_q(n5+n6,2)*_q(n7,1)*_q(n4+n8,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n5+n6,3)*_q(n7,1)*_q(n4+n8,2)
-		+ k2*_q(n2+n3,2)*_q(n1+n5+n6,3)*_q(n7,1)*_q(n4+n8,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n5+n6,3)*_q(n7,1)*_q(n4+n8,2)
-		+ k2*_q(n1+n3,2)*_q(n2+n5+n6,3)*_q(n7,1)*_q(n4+n8,2)
-		+ k6*_q(n3,1)*_q(n1+n2+n5+n6,4)*_q(n7,1)*_q(n4+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n5+n6,3)*_q(n7,1)*_q(n4+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n3+n5+n6,3)*_q(n7,1)*_q(n4+n8,2)
-		+ k6*_q(n2,1)*_q(n1+n3+n5+n6,4)*_q(n7,1)*_q(n4+n8,2)
-		+ k6*_q(n1,1)*_q(n2+n3+n5+n6,4)*_q(n7,1)*_q(n4+n8,2)
-		- k24*_q(n1+n2+n3+n5+n6,5)*_q(n7,1)*_q(n4+n8,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)*_q(n4+n8,2)
-		- _q(n2+n3,2)*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)*_q(n4+n8,2)
-		- _q(n3,1)*_q(n2+n5,2)*_q(n6,1)*_q(n1+n7,2)*_q(n4+n8,2)
-		- _q(n2,1)*_q(n3+n5,2)*_q(n6,1)*_q(n1+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n2+n3+n5,3)*_q(n6,1)*_q(n1+n7,2)*_q(n4+n8,2)
-		- _q(n3,1)*_q(n5,1)*_q(n2+n6,2)*_q(n1+n7,2)*_q(n4+n8,2)
-		+ _q(n3+n5,2)*_q(n2+n6,2)*_q(n1+n7,2)*_q(n4+n8,2)
-		- _q(n2,1)*_q(n5,1)*_q(n3+n6,2)*_q(n1+n7,2)*_q(n4+n8,2)
-		+ _q(n2+n5,2)*_q(n3+n6,2)*_q(n1+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n5,1)*_q(n2+n3+n6,3)*_q(n1+n7,2)*_q(n4+n8,2)
-		- _q(n2,1)*_q(n3,1)*_q(n5+n6,2)*_q(n1+n7,2)*_q(n4+n8,2)
-		+ _q(n2+n3,2)*_q(n5+n6,2)*_q(n1+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n3,1)*_q(n2+n5+n6,3)*_q(n1+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n2,1)*_q(n3+n5+n6,3)*_q(n1+n7,2)*_q(n4+n8,2)
-		- k6*_q(n2+n3+n5+n6,4)*_q(n1+n7,2)*_q(n4+n8,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)*_q(n4+n8,2)
-		- _q(n1+n3,2)*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)*_q(n4+n8,2)
-		- _q(n3,1)*_q(n1+n5,2)*_q(n6,1)*_q(n2+n7,2)*_q(n4+n8,2)
-		- _q(n1,1)*_q(n3+n5,2)*_q(n6,1)*_q(n2+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n1+n3+n5,3)*_q(n6,1)*_q(n2+n7,2)*_q(n4+n8,2)
-		- _q(n3,1)*_q(n5,1)*_q(n1+n6,2)*_q(n2+n7,2)*_q(n4+n8,2)
-		+ _q(n3+n5,2)*_q(n1+n6,2)*_q(n2+n7,2)*_q(n4+n8,2)
-		- _q(n1,1)*_q(n5,1)*_q(n3+n6,2)*_q(n2+n7,2)*_q(n4+n8,2)
-		+ _q(n1+n5,2)*_q(n3+n6,2)*_q(n2+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n5,1)*_q(n1+n3+n6,3)*_q(n2+n7,2)*_q(n4+n8,2)
-		- _q(n1,1)*_q(n3,1)*_q(n5+n6,2)*_q(n2+n7,2)*_q(n4+n8,2)
-		+ _q(n1+n3,2)*_q(n5+n6,2)*_q(n2+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n5+n6,3)*_q(n2+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n1,1)*_q(n3+n5+n6,3)*_q(n2+n7,2)*_q(n4+n8,2)
-		- k6*_q(n1+n3+n5+n6,4)*_q(n2+n7,2)*_q(n4+n8,2)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n1+n2+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n3+n5,2)*_q(n6,1)*_q(n1+n2+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n5,1)*_q(n3+n6,2)*_q(n1+n2+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n3,1)*_q(n5+n6,2)*_q(n1+n2+n7,3)*_q(n4+n8,2)
-		- k4*_q(n3+n5+n6,3)*_q(n1+n2+n7,3)*_q(n4+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)*_q(n4+n8,2)
-		- _q(n1+n2,2)*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)*_q(n4+n8,2)
-		- _q(n2,1)*_q(n1+n5,2)*_q(n6,1)*_q(n3+n7,2)*_q(n4+n8,2)
-		- _q(n1,1)*_q(n2+n5,2)*_q(n6,1)*_q(n3+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n1+n2+n5,3)*_q(n6,1)*_q(n3+n7,2)*_q(n4+n8,2)
-		- _q(n2,1)*_q(n5,1)*_q(n1+n6,2)*_q(n3+n7,2)*_q(n4+n8,2)
-		+ _q(n2+n5,2)*_q(n1+n6,2)*_q(n3+n7,2)*_q(n4+n8,2)
-		- _q(n1,1)*_q(n5,1)*_q(n2+n6,2)*_q(n3+n7,2)*_q(n4+n8,2)
-		+ _q(n1+n5,2)*_q(n2+n6,2)*_q(n3+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n5,1)*_q(n1+n2+n6,3)*_q(n3+n7,2)*_q(n4+n8,2)
-		- _q(n1,1)*_q(n2,1)*_q(n5+n6,2)*_q(n3+n7,2)*_q(n4+n8,2)
-		+ _q(n1+n2,2)*_q(n5+n6,2)*_q(n3+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n5+n6,3)*_q(n3+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n5+n6,3)*_q(n3+n7,2)*_q(n4+n8,2)
-		- k6*_q(n1+n2+n5+n6,4)*_q(n3+n7,2)*_q(n4+n8,2)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n6,1)*_q(n1+n3+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n2+n5,2)*_q(n6,1)*_q(n1+n3+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n5,1)*_q(n2+n6,2)*_q(n1+n3+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n2,1)*_q(n5+n6,2)*_q(n1+n3+n7,3)*_q(n4+n8,2)
-		- k4*_q(n2+n5+n6,3)*_q(n1+n3+n7,3)*_q(n4+n8,2)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n6,1)*_q(n2+n3+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n1+n5,2)*_q(n6,1)*_q(n2+n3+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n5,1)*_q(n1+n6,2)*_q(n2+n3+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n1,1)*_q(n5+n6,2)*_q(n2+n3+n7,3)*_q(n4+n8,2)
-		- k4*_q(n1+n5+n6,3)*_q(n2+n3+n7,3)*_q(n4+n8,2)
-		+ k6*_q(n5,1)*_q(n6,1)*_q(n1+n2+n3+n7,4)*_q(n4+n8,2)
-		- k6*_q(n5+n6,2)*_q(n1+n2+n3+n7,4)*_q(n4+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n6,1)*_q(n5+n7,2)*_q(n4+n8,2)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n6,1)*_q(n5+n7,2)*_q(n4+n8,2)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n6,1)*_q(n5+n7,2)*_q(n4+n8,2)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n6,1)*_q(n5+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n1+n2+n3,3)*_q(n6,1)*_q(n5+n7,2)*_q(n4+n8,2)
-		- _q(n2,1)*_q(n3,1)*_q(n1+n6,2)*_q(n5+n7,2)*_q(n4+n8,2)
-		+ _q(n2+n3,2)*_q(n1+n6,2)*_q(n5+n7,2)*_q(n4+n8,2)
-		- _q(n1,1)*_q(n3,1)*_q(n2+n6,2)*_q(n5+n7,2)*_q(n4+n8,2)
-		+ _q(n1+n3,2)*_q(n2+n6,2)*_q(n5+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n2+n6,3)*_q(n5+n7,2)*_q(n4+n8,2)
-		- _q(n1,1)*_q(n2,1)*_q(n3+n6,2)*_q(n5+n7,2)*_q(n4+n8,2)
-		+ _q(n1+n2,2)*_q(n3+n6,2)*_q(n5+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n3+n6,3)*_q(n5+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n3+n6,3)*_q(n5+n7,2)*_q(n4+n8,2)
-		- k6*_q(n1+n2+n3+n6,4)*_q(n5+n7,2)*_q(n4+n8,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n6,1)*_q(n1+n5+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n2+n3,2)*_q(n6,1)*_q(n1+n5+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n3,1)*_q(n2+n6,2)*_q(n1+n5+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n2,1)*_q(n3+n6,2)*_q(n1+n5+n7,3)*_q(n4+n8,2)
-		- k4*_q(n2+n3+n6,3)*_q(n1+n5+n7,3)*_q(n4+n8,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n6,1)*_q(n2+n5+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n1+n3,2)*_q(n6,1)*_q(n2+n5+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n6,2)*_q(n2+n5+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n1,1)*_q(n3+n6,2)*_q(n2+n5+n7,3)*_q(n4+n8,2)
-		- k4*_q(n1+n3+n6,3)*_q(n2+n5+n7,3)*_q(n4+n8,2)
-		+ k6*_q(n3,1)*_q(n6,1)*_q(n1+n2+n5+n7,4)*_q(n4+n8,2)
-		- k6*_q(n3+n6,2)*_q(n1+n2+n5+n7,4)*_q(n4+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n6,1)*_q(n3+n5+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n6,1)*_q(n3+n5+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n6,2)*_q(n3+n5+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n6,2)*_q(n3+n5+n7,3)*_q(n4+n8,2)
-		- k4*_q(n1+n2+n6,3)*_q(n3+n5+n7,3)*_q(n4+n8,2)
-		+ k6*_q(n2,1)*_q(n6,1)*_q(n1+n3+n5+n7,4)*_q(n4+n8,2)
-		- k6*_q(n2+n6,2)*_q(n1+n3+n5+n7,4)*_q(n4+n8,2)
-		+ k6*_q(n1,1)*_q(n6,1)*_q(n2+n3+n5+n7,4)*_q(n4+n8,2)
-		- k6*_q(n1+n6,2)*_q(n2+n3+n5+n7,4)*_q(n4+n8,2)
-		- k24*_q(n6,1)*_q(n1+n2+n3+n5+n7,5)*_q(n4+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n6+n7,2)*_q(n4+n8,2)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n5,1)*_q(n6+n7,2)*_q(n4+n8,2)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n5,1)*_q(n6+n7,2)*_q(n4+n8,2)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n5,1)*_q(n6+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n1+n2+n3,3)*_q(n5,1)*_q(n6+n7,2)*_q(n4+n8,2)
-		- _q(n2,1)*_q(n3,1)*_q(n1+n5,2)*_q(n6+n7,2)*_q(n4+n8,2)
-		+ _q(n2+n3,2)*_q(n1+n5,2)*_q(n6+n7,2)*_q(n4+n8,2)
-		- _q(n1,1)*_q(n3,1)*_q(n2+n5,2)*_q(n6+n7,2)*_q(n4+n8,2)
-		+ _q(n1+n3,2)*_q(n2+n5,2)*_q(n6+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n2+n5,3)*_q(n6+n7,2)*_q(n4+n8,2)
-		- _q(n1,1)*_q(n2,1)*_q(n3+n5,2)*_q(n6+n7,2)*_q(n4+n8,2)
-		+ _q(n1+n2,2)*_q(n3+n5,2)*_q(n6+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n3+n5,3)*_q(n6+n7,2)*_q(n4+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n3+n5,3)*_q(n6+n7,2)*_q(n4+n8,2)
-		- k6*_q(n1+n2+n3+n5,4)*_q(n6+n7,2)*_q(n4+n8,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n1+n6+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n2+n3,2)*_q(n5,1)*_q(n1+n6+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n3,1)*_q(n2+n5,2)*_q(n1+n6+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n2,1)*_q(n3+n5,2)*_q(n1+n6+n7,3)*_q(n4+n8,2)
-		- k4*_q(n2+n3+n5,3)*_q(n1+n6+n7,3)*_q(n4+n8,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n2+n6+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n1+n3,2)*_q(n5,1)*_q(n2+n6+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n5,2)*_q(n2+n6+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n1,1)*_q(n3+n5,2)*_q(n2+n6+n7,3)*_q(n4+n8,2)
-		- k4*_q(n1+n3+n5,3)*_q(n2+n6+n7,3)*_q(n4+n8,2)
-		+ k6*_q(n3,1)*_q(n5,1)*_q(n1+n2+n6+n7,4)*_q(n4+n8,2)
-		- k6*_q(n3+n5,2)*_q(n1+n2+n6+n7,4)*_q(n4+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n3+n6+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n5,1)*_q(n3+n6+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n5,2)*_q(n3+n6+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n5,2)*_q(n3+n6+n7,3)*_q(n4+n8,2)
-		- k4*_q(n1+n2+n5,3)*_q(n3+n6+n7,3)*_q(n4+n8,2)
-		+ k6*_q(n2,1)*_q(n5,1)*_q(n1+n3+n6+n7,4)*_q(n4+n8,2)
-		- k6*_q(n2+n5,2)*_q(n1+n3+n6+n7,4)*_q(n4+n8,2)
-		+ k6*_q(n1,1)*_q(n5,1)*_q(n2+n3+n6+n7,4)*_q(n4+n8,2)
-		- k6*_q(n1+n5,2)*_q(n2+n3+n6+n7,4)*_q(n4+n8,2)
-		- k24*_q(n5,1)*_q(n1+n2+n3+n6+n7,5)*_q(n4+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5+n6+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n3,1)*_q(n5+n6+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n3,2)*_q(n5+n6+n7,3)*_q(n4+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n3,2)*_q(n5+n6+n7,3)*_q(n4+n8,2)
-		- k4*_q(n1+n2+n3,3)*_q(n5+n6+n7,3)*_q(n4+n8,2)
-		+ k6*_q(n2,1)*_q(n3,1)*_q(n1+n5+n6+n7,4)*_q(n4+n8,2)
-		- k6*_q(n2+n3,2)*_q(n1+n5+n6+n7,4)*_q(n4+n8,2)
-		+ k6*_q(n1,1)*_q(n3,1)*_q(n2+n5+n6+n7,4)*_q(n4+n8,2)
-		- k6*_q(n1+n3,2)*_q(n2+n5+n6+n7,4)*_q(n4+n8,2)
-		- k24*_q(n3,1)*_q(n1+n2+n5+n6+n7,5)*_q(n4+n8,2)
-		+ k6*_q(n1,1)*_q(n2,1)*_q(n3+n5+n6+n7,4)*_q(n4+n8,2)
-		- k6*_q(n1+n2,2)*_q(n3+n5+n6+n7,4)*_q(n4+n8,2)
-		- k24*_q(n2,1)*_q(n1+n3+n5+n6+n7,5)*_q(n4+n8,2)
-		- k24*_q(n1,1)*_q(n2+n3+n5+n6+n7,5)*_q(n4+n8,2)
-		+ k120*_q(n1+n2+n3+n5+n6+n7,6)*_q(n4+n8,2)
-		+ k2*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n1+n4+n8,3)
-		- k2*_q(n2+n3,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n1+n4+n8,3)
-		- k2*_q(n3,1)*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)*_q(n1+n4+n8,3)
-		- k2*_q(n2,1)*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)*_q(n1+n4+n8,3)
-		+ k4*_q(n2+n3+n5,3)*_q(n6,1)*_q(n7,1)*_q(n1+n4+n8,3)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)*_q(n1+n4+n8,3)
-		+ k2*_q(n3+n5,2)*_q(n2+n6,2)*_q(n7,1)*_q(n1+n4+n8,3)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)*_q(n1+n4+n8,3)
-		+ k2*_q(n2+n5,2)*_q(n3+n6,2)*_q(n7,1)*_q(n1+n4+n8,3)
-		+ k4*_q(n5,1)*_q(n2+n3+n6,3)*_q(n7,1)*_q(n1+n4+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n5+n6,2)*_q(n7,1)*_q(n1+n4+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n5+n6,2)*_q(n7,1)*_q(n1+n4+n8,3)
-		+ k4*_q(n3,1)*_q(n2+n5+n6,3)*_q(n7,1)*_q(n1+n4+n8,3)
-		+ k4*_q(n2,1)*_q(n3+n5+n6,3)*_q(n7,1)*_q(n1+n4+n8,3)
-		- k12*_q(n2+n3+n5+n6,4)*_q(n7,1)*_q(n1+n4+n8,3)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)*_q(n1+n4+n8,3)
-		+ k2*_q(n3+n5,2)*_q(n6,1)*_q(n2+n7,2)*_q(n1+n4+n8,3)
-		+ k2*_q(n5,1)*_q(n3+n6,2)*_q(n2+n7,2)*_q(n1+n4+n8,3)
-		+ k2*_q(n3,1)*_q(n5+n6,2)*_q(n2+n7,2)*_q(n1+n4+n8,3)
-		- k4*_q(n3+n5+n6,3)*_q(n2+n7,2)*_q(n1+n4+n8,3)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)*_q(n1+n4+n8,3)
-		+ k2*_q(n2+n5,2)*_q(n6,1)*_q(n3+n7,2)*_q(n1+n4+n8,3)
-		+ k2*_q(n5,1)*_q(n2+n6,2)*_q(n3+n7,2)*_q(n1+n4+n8,3)
-		+ k2*_q(n2,1)*_q(n5+n6,2)*_q(n3+n7,2)*_q(n1+n4+n8,3)
-		- k4*_q(n2+n5+n6,3)*_q(n3+n7,2)*_q(n1+n4+n8,3)
-		+ k4*_q(n5,1)*_q(n6,1)*_q(n2+n3+n7,3)*_q(n1+n4+n8,3)
-		- k4*_q(n5+n6,2)*_q(n2+n3+n7,3)*_q(n1+n4+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n6,1)*_q(n5+n7,2)*_q(n1+n4+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n6,1)*_q(n5+n7,2)*_q(n1+n4+n8,3)
-		+ k2*_q(n3,1)*_q(n2+n6,2)*_q(n5+n7,2)*_q(n1+n4+n8,3)
-		+ k2*_q(n2,1)*_q(n3+n6,2)*_q(n5+n7,2)*_q(n1+n4+n8,3)
-		- k4*_q(n2+n3+n6,3)*_q(n5+n7,2)*_q(n1+n4+n8,3)
-		+ k4*_q(n3,1)*_q(n6,1)*_q(n2+n5+n7,3)*_q(n1+n4+n8,3)
-		- k4*_q(n3+n6,2)*_q(n2+n5+n7,3)*_q(n1+n4+n8,3)
-		+ k4*_q(n2,1)*_q(n6,1)*_q(n3+n5+n7,3)*_q(n1+n4+n8,3)
-		- k4*_q(n2+n6,2)*_q(n3+n5+n7,3)*_q(n1+n4+n8,3)
-		- k12*_q(n6,1)*_q(n2+n3+n5+n7,4)*_q(n1+n4+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n6+n7,2)*_q(n1+n4+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n5,1)*_q(n6+n7,2)*_q(n1+n4+n8,3)
-		+ k2*_q(n3,1)*_q(n2+n5,2)*_q(n6+n7,2)*_q(n1+n4+n8,3)
-		+ k2*_q(n2,1)*_q(n3+n5,2)*_q(n6+n7,2)*_q(n1+n4+n8,3)
-		- k4*_q(n2+n3+n5,3)*_q(n6+n7,2)*_q(n1+n4+n8,3)
-		+ k4*_q(n3,1)*_q(n5,1)*_q(n2+n6+n7,3)*_q(n1+n4+n8,3)
-		- k4*_q(n3+n5,2)*_q(n2+n6+n7,3)*_q(n1+n4+n8,3)
-		+ k4*_q(n2,1)*_q(n5,1)*_q(n3+n6+n7,3)*_q(n1+n4+n8,3)
-		- k4*_q(n2+n5,2)*_q(n3+n6+n7,3)*_q(n1+n4+n8,3)
-		- k12*_q(n5,1)*_q(n2+n3+n6+n7,4)*_q(n1+n4+n8,3)
-		+ k4*_q(n2,1)*_q(n3,1)*_q(n5+n6+n7,3)*_q(n1+n4+n8,3)
-		- k4*_q(n2+n3,2)*_q(n5+n6+n7,3)*_q(n1+n4+n8,3)
-		- k12*_q(n3,1)*_q(n2+n5+n6+n7,4)*_q(n1+n4+n8,3)
-		- k12*_q(n2,1)*_q(n3+n5+n6+n7,4)*_q(n1+n4+n8,3)
-		+ k48*_q(n2+n3+n5+n6+n7,5)*_q(n1+n4+n8,3)
-		+ k2*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n2+n4+n8,3)
-		- k2*_q(n1+n3,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n2+n4+n8,3)
-		- k2*_q(n3,1)*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)*_q(n2+n4+n8,3)
-		- k2*_q(n1,1)*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)*_q(n2+n4+n8,3)
-		+ k4*_q(n1+n3+n5,3)*_q(n6,1)*_q(n7,1)*_q(n2+n4+n8,3)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)*_q(n2+n4+n8,3)
-		+ k2*_q(n3+n5,2)*_q(n1+n6,2)*_q(n7,1)*_q(n2+n4+n8,3)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)*_q(n2+n4+n8,3)
-		+ k2*_q(n1+n5,2)*_q(n3+n6,2)*_q(n7,1)*_q(n2+n4+n8,3)
-		+ k4*_q(n5,1)*_q(n1+n3+n6,3)*_q(n7,1)*_q(n2+n4+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n5+n6,2)*_q(n7,1)*_q(n2+n4+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n5+n6,2)*_q(n7,1)*_q(n2+n4+n8,3)
-		+ k4*_q(n3,1)*_q(n1+n5+n6,3)*_q(n7,1)*_q(n2+n4+n8,3)
-		+ k4*_q(n1,1)*_q(n3+n5+n6,3)*_q(n7,1)*_q(n2+n4+n8,3)
-		- k12*_q(n1+n3+n5+n6,4)*_q(n7,1)*_q(n2+n4+n8,3)
-		- k2*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)*_q(n2+n4+n8,3)
-		+ k2*_q(n3+n5,2)*_q(n6,1)*_q(n1+n7,2)*_q(n2+n4+n8,3)
-		+ k2*_q(n5,1)*_q(n3+n6,2)*_q(n1+n7,2)*_q(n2+n4+n8,3)
-		+ k2*_q(n3,1)*_q(n5+n6,2)*_q(n1+n7,2)*_q(n2+n4+n8,3)
-		- k4*_q(n3+n5+n6,3)*_q(n1+n7,2)*_q(n2+n4+n8,3)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)*_q(n2+n4+n8,3)
-		+ k2*_q(n1+n5,2)*_q(n6,1)*_q(n3+n7,2)*_q(n2+n4+n8,3)
-		+ k2*_q(n5,1)*_q(n1+n6,2)*_q(n3+n7,2)*_q(n2+n4+n8,3)
-		+ k2*_q(n1,1)*_q(n5+n6,2)*_q(n3+n7,2)*_q(n2+n4+n8,3)
-		- k4*_q(n1+n5+n6,3)*_q(n3+n7,2)*_q(n2+n4+n8,3)
-		+ k4*_q(n5,1)*_q(n6,1)*_q(n1+n3+n7,3)*_q(n2+n4+n8,3)
-		- k4*_q(n5+n6,2)*_q(n1+n3+n7,3)*_q(n2+n4+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n6,1)*_q(n5+n7,2)*_q(n2+n4+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n6,1)*_q(n5+n7,2)*_q(n2+n4+n8,3)
-		+ k2*_q(n3,1)*_q(n1+n6,2)*_q(n5+n7,2)*_q(n2+n4+n8,3)
-		+ k2*_q(n1,1)*_q(n3+n6,2)*_q(n5+n7,2)*_q(n2+n4+n8,3)
-		- k4*_q(n1+n3+n6,3)*_q(n5+n7,2)*_q(n2+n4+n8,3)
-		+ k4*_q(n3,1)*_q(n6,1)*_q(n1+n5+n7,3)*_q(n2+n4+n8,3)
-		- k4*_q(n3+n6,2)*_q(n1+n5+n7,3)*_q(n2+n4+n8,3)
-		+ k4*_q(n1,1)*_q(n6,1)*_q(n3+n5+n7,3)*_q(n2+n4+n8,3)
-		- k4*_q(n1+n6,2)*_q(n3+n5+n7,3)*_q(n2+n4+n8,3)
-		- k12*_q(n6,1)*_q(n1+n3+n5+n7,4)*_q(n2+n4+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n6+n7,2)*_q(n2+n4+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n5,1)*_q(n6+n7,2)*_q(n2+n4+n8,3)
-		+ k2*_q(n3,1)*_q(n1+n5,2)*_q(n6+n7,2)*_q(n2+n4+n8,3)
-		+ k2*_q(n1,1)*_q(n3+n5,2)*_q(n6+n7,2)*_q(n2+n4+n8,3)
-		- k4*_q(n1+n3+n5,3)*_q(n6+n7,2)*_q(n2+n4+n8,3)
-		+ k4*_q(n3,1)*_q(n5,1)*_q(n1+n6+n7,3)*_q(n2+n4+n8,3)
-		- k4*_q(n3+n5,2)*_q(n1+n6+n7,3)*_q(n2+n4+n8,3)
-		+ k4*_q(n1,1)*_q(n5,1)*_q(n3+n6+n7,3)*_q(n2+n4+n8,3)
-		- k4*_q(n1+n5,2)*_q(n3+n6+n7,3)*_q(n2+n4+n8,3)
-		- k12*_q(n5,1)*_q(n1+n3+n6+n7,4)*_q(n2+n4+n8,3)
-		+ k4*_q(n1,1)*_q(n3,1)*_q(n5+n6+n7,3)*_q(n2+n4+n8,3)
-		- k4*_q(n1+n3,2)*_q(n5+n6+n7,3)*_q(n2+n4+n8,3)
-		- k12*_q(n3,1)*_q(n1+n5+n6+n7,4)*_q(n2+n4+n8,3)
-		- k12*_q(n1,1)*_q(n3+n5+n6+n7,4)*_q(n2+n4+n8,3)
-		+ k48*_q(n1+n3+n5+n6+n7,5)*_q(n2+n4+n8,3)
-		- k6*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n1+n2+n4+n8,4)
-		+ k6*_q(n3+n5,2)*_q(n6,1)*_q(n7,1)*_q(n1+n2+n4+n8,4)
-		+ k6*_q(n5,1)*_q(n3+n6,2)*_q(n7,1)*_q(n1+n2+n4+n8,4)
-		+ k6*_q(n3,1)*_q(n5+n6,2)*_q(n7,1)*_q(n1+n2+n4+n8,4)
-		- k12*_q(n3+n5+n6,3)*_q(n7,1)*_q(n1+n2+n4+n8,4)
-		+ k6*_q(n5,1)*_q(n6,1)*_q(n3+n7,2)*_q(n1+n2+n4+n8,4)
-		- k6*_q(n5+n6,2)*_q(n3+n7,2)*_q(n1+n2+n4+n8,4)
-		+ k6*_q(n3,1)*_q(n6,1)*_q(n5+n7,2)*_q(n1+n2+n4+n8,4)
-		- k6*_q(n3+n6,2)*_q(n5+n7,2)*_q(n1+n2+n4+n8,4)
-		- k12*_q(n6,1)*_q(n3+n5+n7,3)*_q(n1+n2+n4+n8,4)
-		+ k6*_q(n3,1)*_q(n5,1)*_q(n6+n7,2)*_q(n1+n2+n4+n8,4)
-		- k6*_q(n3+n5,2)*_q(n6+n7,2)*_q(n1+n2+n4+n8,4)
-		- k12*_q(n5,1)*_q(n3+n6+n7,3)*_q(n1+n2+n4+n8,4)
-		- k12*_q(n3,1)*_q(n5+n6+n7,3)*_q(n1+n2+n4+n8,4)
-		+ k36*_q(n3+n5+n6+n7,4)*_q(n1+n2+n4+n8,4)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n3+n4+n8,3)
-		- k2*_q(n1+n2,2)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n3+n4+n8,3)
-		- k2*_q(n2,1)*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)*_q(n3+n4+n8,3)
-		- k2*_q(n1,1)*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)*_q(n3+n4+n8,3)
-		+ k4*_q(n1+n2+n5,3)*_q(n6,1)*_q(n7,1)*_q(n3+n4+n8,3)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)*_q(n3+n4+n8,3)
-		+ k2*_q(n2+n5,2)*_q(n1+n6,2)*_q(n7,1)*_q(n3+n4+n8,3)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)*_q(n3+n4+n8,3)
-		+ k2*_q(n1+n5,2)*_q(n2+n6,2)*_q(n7,1)*_q(n3+n4+n8,3)
-		+ k4*_q(n5,1)*_q(n1+n2+n6,3)*_q(n7,1)*_q(n3+n4+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n5+n6,2)*_q(n7,1)*_q(n3+n4+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n5+n6,2)*_q(n7,1)*_q(n3+n4+n8,3)
-		+ k4*_q(n2,1)*_q(n1+n5+n6,3)*_q(n7,1)*_q(n3+n4+n8,3)
-		+ k4*_q(n1,1)*_q(n2+n5+n6,3)*_q(n7,1)*_q(n3+n4+n8,3)
-		- k12*_q(n1+n2+n5+n6,4)*_q(n7,1)*_q(n3+n4+n8,3)
-		- k2*_q(n2,1)*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)*_q(n3+n4+n8,3)
-		+ k2*_q(n2+n5,2)*_q(n6,1)*_q(n1+n7,2)*_q(n3+n4+n8,3)
-		+ k2*_q(n5,1)*_q(n2+n6,2)*_q(n1+n7,2)*_q(n3+n4+n8,3)
-		+ k2*_q(n2,1)*_q(n5+n6,2)*_q(n1+n7,2)*_q(n3+n4+n8,3)
-		- k4*_q(n2+n5+n6,3)*_q(n1+n7,2)*_q(n3+n4+n8,3)
-		- k2*_q(n1,1)*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)*_q(n3+n4+n8,3));
-      }
-      Complex uc8P3(const Harmonic n1,
-		    const Harmonic n2,
-		    const Harmonic n3,
-		    const Harmonic n4,
-		    const Harmonic n5,
-		    const Harmonic n6,
-		    const Harmonic n7,
-		    const Harmonic n8) const
-      {
-	const Real k2   = 2;
-	const Real k4   = 4;
-	const Real k6   = 6;
-	const Real k12  = 12;
-	const Real k24  = 24;
-	const Real k36  = 36;
-	const Real k48  = 48;
-	const Real k120 = 120;
-	// const Real k720 = 720;
-	return (k2*_q(n1+n5,2)*_q(n6,1)*_q(n2+n7,2)*_q(n3+n4+n8,3)
-		+ k2*_q(n5,1)*_q(n1+n6,2)*_q(n2+n7,2)*_q(n3+n4+n8,3)
-		+ k2*_q(n1,1)*_q(n5+n6,2)*_q(n2+n7,2)*_q(n3+n4+n8,3)
-		- k4*_q(n1+n5+n6,3)*_q(n2+n7,2)*_q(n3+n4+n8,3)
-		+ k4*_q(n5,1)*_q(n6,1)*_q(n1+n2+n7,3)*_q(n3+n4+n8,3)
-		- k4*_q(n5+n6,2)*_q(n1+n2+n7,3)*_q(n3+n4+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n6,1)*_q(n5+n7,2)*_q(n3+n4+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n6,1)*_q(n5+n7,2)*_q(n3+n4+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n6,2)*_q(n5+n7,2)*_q(n3+n4+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n6,2)*_q(n5+n7,2)*_q(n3+n4+n8,3)
-		- k4*_q(n1+n2+n6,3)*_q(n5+n7,2)*_q(n3+n4+n8,3)
-		+ k4*_q(n2,1)*_q(n6,1)*_q(n1+n5+n7,3)*_q(n3+n4+n8,3)
-		- k4*_q(n2+n6,2)*_q(n1+n5+n7,3)*_q(n3+n4+n8,3)
-		+ k4*_q(n1,1)*_q(n6,1)*_q(n2+n5+n7,3)*_q(n3+n4+n8,3)
-		- k4*_q(n1+n6,2)*_q(n2+n5+n7,3)*_q(n3+n4+n8,3)
-		- k12*_q(n6,1)*_q(n1+n2+n5+n7,4)*_q(n3+n4+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n6+n7,2)*_q(n3+n4+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n5,1)*_q(n6+n7,2)*_q(n3+n4+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n5,2)*_q(n6+n7,2)*_q(n3+n4+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n5,2)*_q(n6+n7,2)*_q(n3+n4+n8,3)
-		- k4*_q(n1+n2+n5,3)*_q(n6+n7,2)*_q(n3+n4+n8,3)
-		+ k4*_q(n2,1)*_q(n5,1)*_q(n1+n6+n7,3)*_q(n3+n4+n8,3)
-		- k4*_q(n2+n5,2)*_q(n1+n6+n7,3)*_q(n3+n4+n8,3)
-		+ k4*_q(n1,1)*_q(n5,1)*_q(n2+n6+n7,3)*_q(n3+n4+n8,3)
-		- k4*_q(n1+n5,2)*_q(n2+n6+n7,3)*_q(n3+n4+n8,3)
-		- k12*_q(n5,1)*_q(n1+n2+n6+n7,4)*_q(n3+n4+n8,3)
-		+ k4*_q(n1,1)*_q(n2,1)*_q(n5+n6+n7,3)*_q(n3+n4+n8,3)
-		- k4*_q(n1+n2,2)*_q(n5+n6+n7,3)*_q(n3+n4+n8,3)
-		- k12*_q(n2,1)*_q(n1+n5+n6+n7,4)*_q(n3+n4+n8,3)
-		- k12*_q(n1,1)*_q(n2+n5+n6+n7,4)*_q(n3+n4+n8,3)
-		+ k48*_q(n1+n2+n5+n6+n7,5)*_q(n3+n4+n8,3)
-		- k6*_q(n2,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n1+n3+n4+n8,4)
-		+ k6*_q(n2+n5,2)*_q(n6,1)*_q(n7,1)*_q(n1+n3+n4+n8,4)
-		+ k6*_q(n5,1)*_q(n2+n6,2)*_q(n7,1)*_q(n1+n3+n4+n8,4)
-		+ k6*_q(n2,1)*_q(n5+n6,2)*_q(n7,1)*_q(n1+n3+n4+n8,4)
-		- k12*_q(n2+n5+n6,3)*_q(n7,1)*_q(n1+n3+n4+n8,4)
-		+ k6*_q(n5,1)*_q(n6,1)*_q(n2+n7,2)*_q(n1+n3+n4+n8,4)
-		- k6*_q(n5+n6,2)*_q(n2+n7,2)*_q(n1+n3+n4+n8,4)
-		+ k6*_q(n2,1)*_q(n6,1)*_q(n5+n7,2)*_q(n1+n3+n4+n8,4)
-		- k6*_q(n2+n6,2)*_q(n5+n7,2)*_q(n1+n3+n4+n8,4)
-		- k12*_q(n6,1)*_q(n2+n5+n7,3)*_q(n1+n3+n4+n8,4)
-		+ k6*_q(n2,1)*_q(n5,1)*_q(n6+n7,2)*_q(n1+n3+n4+n8,4)
-		- k6*_q(n2+n5,2)*_q(n6+n7,2)*_q(n1+n3+n4+n8,4)
-		- k12*_q(n5,1)*_q(n2+n6+n7,3)*_q(n1+n3+n4+n8,4)
-		- k12*_q(n2,1)*_q(n5+n6+n7,3)*_q(n1+n3+n4+n8,4)
-		+ k36*_q(n2+n5+n6+n7,4)*_q(n1+n3+n4+n8,4)
-		- k6*_q(n1,1)*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n2+n3+n4+n8,4)
-		+ k6*_q(n1+n5,2)*_q(n6,1)*_q(n7,1)*_q(n2+n3+n4+n8,4)
-		+ k6*_q(n5,1)*_q(n1+n6,2)*_q(n7,1)*_q(n2+n3+n4+n8,4)
-		+ k6*_q(n1,1)*_q(n5+n6,2)*_q(n7,1)*_q(n2+n3+n4+n8,4)
-		- k12*_q(n1+n5+n6,3)*_q(n7,1)*_q(n2+n3+n4+n8,4)
-		+ k6*_q(n5,1)*_q(n6,1)*_q(n1+n7,2)*_q(n2+n3+n4+n8,4)
-		- k6*_q(n5+n6,2)*_q(n1+n7,2)*_q(n2+n3+n4+n8,4)
-		+ k6*_q(n1,1)*_q(n6,1)*_q(n5+n7,2)*_q(n2+n3+n4+n8,4)
-		- k6*_q(n1+n6,2)*_q(n5+n7,2)*_q(n2+n3+n4+n8,4)
-		- k12*_q(n6,1)*_q(n1+n5+n7,3)*_q(n2+n3+n4+n8,4)
-		+ k6*_q(n1,1)*_q(n5,1)*_q(n6+n7,2)*_q(n2+n3+n4+n8,4)
-		- k6*_q(n1+n5,2)*_q(n6+n7,2)*_q(n2+n3+n4+n8,4)
-		- k12*_q(n5,1)*_q(n1+n6+n7,3)*_q(n2+n3+n4+n8,4)
-		- k12*_q(n1,1)*_q(n5+n6+n7,3)*_q(n2+n3+n4+n8,4)
-		+ k36*_q(n1+n5+n6+n7,4)*_q(n2+n3+n4+n8,4)
-		+ k24*_q(n5,1)*_q(n6,1)*_q(n7,1)*_q(n1+n2+n3+n4+n8,5)
-		- k24*_q(n5+n6,2)*_q(n7,1)*_q(n1+n2+n3+n4+n8,5)
-		- k24*_q(n6,1)*_q(n5+n7,2)*_q(n1+n2+n3+n4+n8,5)
-		- k24*_q(n5,1)*_q(n6+n7,2)*_q(n1+n2+n3+n4+n8,5)
-		+ k48*_q(n5+n6+n7,3)*_q(n1+n2+n3+n4+n8,5)
-		- _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n7,1)*_q(n5+n8,2)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n7,1)*_q(n5+n8,2)
-		+ _q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n6,1)*_q(n7,1)*_q(n5+n8,2)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n6,1)*_q(n7,1)*_q(n5+n8,2)
-		- k2*_q(n1+n2+n3,3)*_q(n4,1)*_q(n6,1)*_q(n7,1)*_q(n5+n8,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n6,1)*_q(n7,1)*_q(n5+n8,2)
-		- _q(n2+n3,2)*_q(n1+n4,2)*_q(n6,1)*_q(n7,1)*_q(n5+n8,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n6,1)*_q(n7,1)*_q(n5+n8,2)
-		- _q(n1+n3,2)*_q(n2+n4,2)*_q(n6,1)*_q(n7,1)*_q(n5+n8,2)
-		- k2*_q(n3,1)*_q(n1+n2+n4,3)*_q(n6,1)*_q(n7,1)*_q(n5+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n6,1)*_q(n7,1)*_q(n5+n8,2)
-		- _q(n1+n2,2)*_q(n3+n4,2)*_q(n6,1)*_q(n7,1)*_q(n5+n8,2)
-		- k2*_q(n2,1)*_q(n1+n3+n4,3)*_q(n6,1)*_q(n7,1)*_q(n5+n8,2)
-		- k2*_q(n1,1)*_q(n2+n3+n4,3)*_q(n6,1)*_q(n7,1)*_q(n5+n8,2)
-		+ k6*_q(n1+n2+n3+n4,4)*_q(n6,1)*_q(n7,1)*_q(n5+n8,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		- _q(n2+n3,2)*_q(n4,1)*_q(n1+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		- _q(n3,1)*_q(n2+n4,2)*_q(n1+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		- _q(n2,1)*_q(n3+n4,2)*_q(n1+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		+ k2*_q(n2+n3+n4,3)*_q(n1+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		- _q(n1+n3,2)*_q(n4,1)*_q(n2+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		- _q(n3,1)*_q(n1+n4,2)*_q(n2+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		- _q(n1,1)*_q(n3+n4,2)*_q(n2+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		+ k2*_q(n1+n3+n4,3)*_q(n2+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n1+n2+n6,3)*_q(n7,1)*_q(n5+n8,2)
-		+ k2*_q(n3+n4,2)*_q(n1+n2+n6,3)*_q(n7,1)*_q(n5+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		- _q(n1+n2,2)*_q(n4,1)*_q(n3+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		- _q(n2,1)*_q(n1+n4,2)*_q(n3+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		- _q(n1,1)*_q(n2+n4,2)*_q(n3+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		+ k2*_q(n1+n2+n4,3)*_q(n3+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n1+n3+n6,3)*_q(n7,1)*_q(n5+n8,2)
-		+ k2*_q(n2+n4,2)*_q(n1+n3+n6,3)*_q(n7,1)*_q(n5+n8,2)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n2+n3+n6,3)*_q(n7,1)*_q(n5+n8,2)
-		+ k2*_q(n1+n4,2)*_q(n2+n3+n6,3)*_q(n7,1)*_q(n5+n8,2)
-		+ k6*_q(n4,1)*_q(n1+n2+n3+n6,4)*_q(n7,1)*_q(n5+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n4+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n4+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n4+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		+ k2*_q(n1+n2+n3,3)*_q(n4+n6,2)*_q(n7,1)*_q(n5+n8,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n4+n6,3)*_q(n7,1)*_q(n5+n8,2)
-		+ k2*_q(n2+n3,2)*_q(n1+n4+n6,3)*_q(n7,1)*_q(n5+n8,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n4+n6,3)*_q(n7,1)*_q(n5+n8,2)
-		+ k2*_q(n1+n3,2)*_q(n2+n4+n6,3)*_q(n7,1)*_q(n5+n8,2)
-		+ k6*_q(n3,1)*_q(n1+n2+n4+n6,4)*_q(n7,1)*_q(n5+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n4+n6,3)*_q(n7,1)*_q(n5+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n3+n4+n6,3)*_q(n7,1)*_q(n5+n8,2)
-		+ k6*_q(n2,1)*_q(n1+n3+n4+n6,4)*_q(n7,1)*_q(n5+n8,2)
-		+ k6*_q(n1,1)*_q(n2+n3+n4+n6,4)*_q(n7,1)*_q(n5+n8,2)
-		- k24*_q(n1+n2+n3+n4+n6,5)*_q(n7,1)*_q(n5+n8,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n1+n7,2)*_q(n5+n8,2)
-		- _q(n2+n3,2)*_q(n4,1)*_q(n6,1)*_q(n1+n7,2)*_q(n5+n8,2)
-		- _q(n3,1)*_q(n2+n4,2)*_q(n6,1)*_q(n1+n7,2)*_q(n5+n8,2)
-		- _q(n2,1)*_q(n3+n4,2)*_q(n6,1)*_q(n1+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n2+n3+n4,3)*_q(n6,1)*_q(n1+n7,2)*_q(n5+n8,2)
-		- _q(n3,1)*_q(n4,1)*_q(n2+n6,2)*_q(n1+n7,2)*_q(n5+n8,2)
-		+ _q(n3+n4,2)*_q(n2+n6,2)*_q(n1+n7,2)*_q(n5+n8,2)
-		- _q(n2,1)*_q(n4,1)*_q(n3+n6,2)*_q(n1+n7,2)*_q(n5+n8,2)
-		+ _q(n2+n4,2)*_q(n3+n6,2)*_q(n1+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n4,1)*_q(n2+n3+n6,3)*_q(n1+n7,2)*_q(n5+n8,2)
-		- _q(n2,1)*_q(n3,1)*_q(n4+n6,2)*_q(n1+n7,2)*_q(n5+n8,2)
-		+ _q(n2+n3,2)*_q(n4+n6,2)*_q(n1+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n3,1)*_q(n2+n4+n6,3)*_q(n1+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n2,1)*_q(n3+n4+n6,3)*_q(n1+n7,2)*_q(n5+n8,2)
-		- k6*_q(n2+n3+n4+n6,4)*_q(n1+n7,2)*_q(n5+n8,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n2+n7,2)*_q(n5+n8,2)
-		- _q(n1+n3,2)*_q(n4,1)*_q(n6,1)*_q(n2+n7,2)*_q(n5+n8,2)
-		- _q(n3,1)*_q(n1+n4,2)*_q(n6,1)*_q(n2+n7,2)*_q(n5+n8,2)
-		- _q(n1,1)*_q(n3+n4,2)*_q(n6,1)*_q(n2+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n1+n3+n4,3)*_q(n6,1)*_q(n2+n7,2)*_q(n5+n8,2)
-		- _q(n3,1)*_q(n4,1)*_q(n1+n6,2)*_q(n2+n7,2)*_q(n5+n8,2)
-		+ _q(n3+n4,2)*_q(n1+n6,2)*_q(n2+n7,2)*_q(n5+n8,2)
-		- _q(n1,1)*_q(n4,1)*_q(n3+n6,2)*_q(n2+n7,2)*_q(n5+n8,2)
-		+ _q(n1+n4,2)*_q(n3+n6,2)*_q(n2+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n4,1)*_q(n1+n3+n6,3)*_q(n2+n7,2)*_q(n5+n8,2)
-		- _q(n1,1)*_q(n3,1)*_q(n4+n6,2)*_q(n2+n7,2)*_q(n5+n8,2)
-		+ _q(n1+n3,2)*_q(n4+n6,2)*_q(n2+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n4+n6,3)*_q(n2+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n1,1)*_q(n3+n4+n6,3)*_q(n2+n7,2)*_q(n5+n8,2)
-		- k6*_q(n1+n3+n4+n6,4)*_q(n2+n7,2)*_q(n5+n8,2)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n1+n2+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n3+n4,2)*_q(n6,1)*_q(n1+n2+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n4,1)*_q(n3+n6,2)*_q(n1+n2+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n3,1)*_q(n4+n6,2)*_q(n1+n2+n7,3)*_q(n5+n8,2)
-		- k4*_q(n3+n4+n6,3)*_q(n1+n2+n7,3)*_q(n5+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n6,1)*_q(n3+n7,2)*_q(n5+n8,2)
-		- _q(n1+n2,2)*_q(n4,1)*_q(n6,1)*_q(n3+n7,2)*_q(n5+n8,2)
-		- _q(n2,1)*_q(n1+n4,2)*_q(n6,1)*_q(n3+n7,2)*_q(n5+n8,2)
-		- _q(n1,1)*_q(n2+n4,2)*_q(n6,1)*_q(n3+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n1+n2+n4,3)*_q(n6,1)*_q(n3+n7,2)*_q(n5+n8,2)
-		- _q(n2,1)*_q(n4,1)*_q(n1+n6,2)*_q(n3+n7,2)*_q(n5+n8,2)
-		+ _q(n2+n4,2)*_q(n1+n6,2)*_q(n3+n7,2)*_q(n5+n8,2)
-		- _q(n1,1)*_q(n4,1)*_q(n2+n6,2)*_q(n3+n7,2)*_q(n5+n8,2)
-		+ _q(n1+n4,2)*_q(n2+n6,2)*_q(n3+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n4,1)*_q(n1+n2+n6,3)*_q(n3+n7,2)*_q(n5+n8,2)
-		- _q(n1,1)*_q(n2,1)*_q(n4+n6,2)*_q(n3+n7,2)*_q(n5+n8,2)
-		+ _q(n1+n2,2)*_q(n4+n6,2)*_q(n3+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n4+n6,3)*_q(n3+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n4+n6,3)*_q(n3+n7,2)*_q(n5+n8,2)
-		- k6*_q(n1+n2+n4+n6,4)*_q(n3+n7,2)*_q(n5+n8,2)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n6,1)*_q(n1+n3+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n2+n4,2)*_q(n6,1)*_q(n1+n3+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n4,1)*_q(n2+n6,2)*_q(n1+n3+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n2,1)*_q(n4+n6,2)*_q(n1+n3+n7,3)*_q(n5+n8,2)
-		- k4*_q(n2+n4+n6,3)*_q(n1+n3+n7,3)*_q(n5+n8,2)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n6,1)*_q(n2+n3+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n1+n4,2)*_q(n6,1)*_q(n2+n3+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n4,1)*_q(n1+n6,2)*_q(n2+n3+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n1,1)*_q(n4+n6,2)*_q(n2+n3+n7,3)*_q(n5+n8,2)
-		- k4*_q(n1+n4+n6,3)*_q(n2+n3+n7,3)*_q(n5+n8,2)
-		+ k6*_q(n4,1)*_q(n6,1)*_q(n1+n2+n3+n7,4)*_q(n5+n8,2)
-		- k6*_q(n4+n6,2)*_q(n1+n2+n3+n7,4)*_q(n5+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n6,1)*_q(n4+n7,2)*_q(n5+n8,2)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n6,1)*_q(n4+n7,2)*_q(n5+n8,2)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n6,1)*_q(n4+n7,2)*_q(n5+n8,2)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n6,1)*_q(n4+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n1+n2+n3,3)*_q(n6,1)*_q(n4+n7,2)*_q(n5+n8,2)
-		- _q(n2,1)*_q(n3,1)*_q(n1+n6,2)*_q(n4+n7,2)*_q(n5+n8,2)
-		+ _q(n2+n3,2)*_q(n1+n6,2)*_q(n4+n7,2)*_q(n5+n8,2)
-		- _q(n1,1)*_q(n3,1)*_q(n2+n6,2)*_q(n4+n7,2)*_q(n5+n8,2)
-		+ _q(n1+n3,2)*_q(n2+n6,2)*_q(n4+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n2+n6,3)*_q(n4+n7,2)*_q(n5+n8,2)
-		- _q(n1,1)*_q(n2,1)*_q(n3+n6,2)*_q(n4+n7,2)*_q(n5+n8,2)
-		+ _q(n1+n2,2)*_q(n3+n6,2)*_q(n4+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n3+n6,3)*_q(n4+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n3+n6,3)*_q(n4+n7,2)*_q(n5+n8,2)
-		- k6*_q(n1+n2+n3+n6,4)*_q(n4+n7,2)*_q(n5+n8,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n6,1)*_q(n1+n4+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n2+n3,2)*_q(n6,1)*_q(n1+n4+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n3,1)*_q(n2+n6,2)*_q(n1+n4+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n2,1)*_q(n3+n6,2)*_q(n1+n4+n7,3)*_q(n5+n8,2)
-		- k4*_q(n2+n3+n6,3)*_q(n1+n4+n7,3)*_q(n5+n8,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n6,1)*_q(n2+n4+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n1+n3,2)*_q(n6,1)*_q(n2+n4+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n6,2)*_q(n2+n4+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n1,1)*_q(n3+n6,2)*_q(n2+n4+n7,3)*_q(n5+n8,2)
-		- k4*_q(n1+n3+n6,3)*_q(n2+n4+n7,3)*_q(n5+n8,2)
-		+ k6*_q(n3,1)*_q(n6,1)*_q(n1+n2+n4+n7,4)*_q(n5+n8,2)
-		- k6*_q(n3+n6,2)*_q(n1+n2+n4+n7,4)*_q(n5+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n6,1)*_q(n3+n4+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n6,1)*_q(n3+n4+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n6,2)*_q(n3+n4+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n6,2)*_q(n3+n4+n7,3)*_q(n5+n8,2)
-		- k4*_q(n1+n2+n6,3)*_q(n3+n4+n7,3)*_q(n5+n8,2)
-		+ k6*_q(n2,1)*_q(n6,1)*_q(n1+n3+n4+n7,4)*_q(n5+n8,2)
-		- k6*_q(n2+n6,2)*_q(n1+n3+n4+n7,4)*_q(n5+n8,2)
-		+ k6*_q(n1,1)*_q(n6,1)*_q(n2+n3+n4+n7,4)*_q(n5+n8,2)
-		- k6*_q(n1+n6,2)*_q(n2+n3+n4+n7,4)*_q(n5+n8,2)
-		- k24*_q(n6,1)*_q(n1+n2+n3+n4+n7,5)*_q(n5+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n6+n7,2)*_q(n5+n8,2)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n6+n7,2)*_q(n5+n8,2)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n6+n7,2)*_q(n5+n8,2)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n6+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n1+n2+n3,3)*_q(n4,1)*_q(n6+n7,2)*_q(n5+n8,2)
-		- _q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n6+n7,2)*_q(n5+n8,2)
-		+ _q(n2+n3,2)*_q(n1+n4,2)*_q(n6+n7,2)*_q(n5+n8,2)
-		- _q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n6+n7,2)*_q(n5+n8,2)
-		+ _q(n1+n3,2)*_q(n2+n4,2)*_q(n6+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n2+n4,3)*_q(n6+n7,2)*_q(n5+n8,2)
-		- _q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n6+n7,2)*_q(n5+n8,2)
-		+ _q(n1+n2,2)*_q(n3+n4,2)*_q(n6+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n3+n4,3)*_q(n6+n7,2)*_q(n5+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n3+n4,3)*_q(n6+n7,2)*_q(n5+n8,2)
-		- k6*_q(n1+n2+n3+n4,4)*_q(n6+n7,2)*_q(n5+n8,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n6+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n2+n3,2)*_q(n4,1)*_q(n1+n6+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n3,1)*_q(n2+n4,2)*_q(n1+n6+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n2,1)*_q(n3+n4,2)*_q(n1+n6+n7,3)*_q(n5+n8,2)
-		- k4*_q(n2+n3+n4,3)*_q(n1+n6+n7,3)*_q(n5+n8,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n6+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n1+n3,2)*_q(n4,1)*_q(n2+n6+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n4,2)*_q(n2+n6+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n1,1)*_q(n3+n4,2)*_q(n2+n6+n7,3)*_q(n5+n8,2)
-		- k4*_q(n1+n3+n4,3)*_q(n2+n6+n7,3)*_q(n5+n8,2)
-		+ k6*_q(n3,1)*_q(n4,1)*_q(n1+n2+n6+n7,4)*_q(n5+n8,2)
-		- k6*_q(n3+n4,2)*_q(n1+n2+n6+n7,4)*_q(n5+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n6+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n4,1)*_q(n3+n6+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n4,2)*_q(n3+n6+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n4,2)*_q(n3+n6+n7,3)*_q(n5+n8,2)
-		- k4*_q(n1+n2+n4,3)*_q(n3+n6+n7,3)*_q(n5+n8,2)
-		+ k6*_q(n2,1)*_q(n4,1)*_q(n1+n3+n6+n7,4)*_q(n5+n8,2)
-		- k6*_q(n2+n4,2)*_q(n1+n3+n6+n7,4)*_q(n5+n8,2)
-		+ k6*_q(n1,1)*_q(n4,1)*_q(n2+n3+n6+n7,4)*_q(n5+n8,2)
-		- k6*_q(n1+n4,2)*_q(n2+n3+n6+n7,4)*_q(n5+n8,2)
-		- k24*_q(n4,1)*_q(n1+n2+n3+n6+n7,5)*_q(n5+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n6+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n3,1)*_q(n4+n6+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n3,2)*_q(n4+n6+n7,3)*_q(n5+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n3,2)*_q(n4+n6+n7,3)*_q(n5+n8,2)
-		- k4*_q(n1+n2+n3,3)*_q(n4+n6+n7,3)*_q(n5+n8,2)
-		+ k6*_q(n2,1)*_q(n3,1)*_q(n1+n4+n6+n7,4)*_q(n5+n8,2)
-		- k6*_q(n2+n3,2)*_q(n1+n4+n6+n7,4)*_q(n5+n8,2)
-		+ k6*_q(n1,1)*_q(n3,1)*_q(n2+n4+n6+n7,4)*_q(n5+n8,2)
-		- k6*_q(n1+n3,2)*_q(n2+n4+n6+n7,4)*_q(n5+n8,2)
-		- k24*_q(n3,1)*_q(n1+n2+n4+n6+n7,5)*_q(n5+n8,2)
-		+ k6*_q(n1,1)*_q(n2,1)*_q(n3+n4+n6+n7,4)*_q(n5+n8,2)
-		- k6*_q(n1+n2,2)*_q(n3+n4+n6+n7,4)*_q(n5+n8,2)
-		- k24*_q(n2,1)*_q(n1+n3+n4+n6+n7,5)*_q(n5+n8,2)
-		- k24*_q(n1,1)*_q(n2+n3+n4+n6+n7,5)*_q(n5+n8,2)
-		+ k120*_q(n1+n2+n3+n4+n6+n7,6)*_q(n5+n8,2)
-		+ k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n7,1)*_q(n1+n5+n8,3)
-		- k2*_q(n2+n3,2)*_q(n4,1)*_q(n6,1)*_q(n7,1)*_q(n1+n5+n8,3)
-		- k2*_q(n3,1)*_q(n2+n4,2)*_q(n6,1)*_q(n7,1)*_q(n1+n5+n8,3)
-		- k2*_q(n2,1)*_q(n3+n4,2)*_q(n6,1)*_q(n7,1)*_q(n1+n5+n8,3)
-		+ k4*_q(n2+n3+n4,3)*_q(n6,1)*_q(n7,1)*_q(n1+n5+n8,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n2+n6,2)*_q(n7,1)*_q(n1+n5+n8,3)
-		+ k2*_q(n3+n4,2)*_q(n2+n6,2)*_q(n7,1)*_q(n1+n5+n8,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n3+n6,2)*_q(n7,1)*_q(n1+n5+n8,3)
-		+ k2*_q(n2+n4,2)*_q(n3+n6,2)*_q(n7,1)*_q(n1+n5+n8,3)
-		+ k4*_q(n4,1)*_q(n2+n3+n6,3)*_q(n7,1)*_q(n1+n5+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4+n6,2)*_q(n7,1)*_q(n1+n5+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n4+n6,2)*_q(n7,1)*_q(n1+n5+n8,3)
-		+ k4*_q(n3,1)*_q(n2+n4+n6,3)*_q(n7,1)*_q(n1+n5+n8,3)
-		+ k4*_q(n2,1)*_q(n3+n4+n6,3)*_q(n7,1)*_q(n1+n5+n8,3)
-		- k12*_q(n2+n3+n4+n6,4)*_q(n7,1)*_q(n1+n5+n8,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n2+n7,2)*_q(n1+n5+n8,3)
-		+ k2*_q(n3+n4,2)*_q(n6,1)*_q(n2+n7,2)*_q(n1+n5+n8,3)
-		+ k2*_q(n4,1)*_q(n3+n6,2)*_q(n2+n7,2)*_q(n1+n5+n8,3)
-		+ k2*_q(n3,1)*_q(n4+n6,2)*_q(n2+n7,2)*_q(n1+n5+n8,3)
-		- k4*_q(n3+n4+n6,3)*_q(n2+n7,2)*_q(n1+n5+n8,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n6,1)*_q(n3+n7,2)*_q(n1+n5+n8,3)
-		+ k2*_q(n2+n4,2)*_q(n6,1)*_q(n3+n7,2)*_q(n1+n5+n8,3)
-		+ k2*_q(n4,1)*_q(n2+n6,2)*_q(n3+n7,2)*_q(n1+n5+n8,3)
-		+ k2*_q(n2,1)*_q(n4+n6,2)*_q(n3+n7,2)*_q(n1+n5+n8,3)
-		- k4*_q(n2+n4+n6,3)*_q(n3+n7,2)*_q(n1+n5+n8,3)
-		+ k4*_q(n4,1)*_q(n6,1)*_q(n2+n3+n7,3)*_q(n1+n5+n8,3)
-		- k4*_q(n4+n6,2)*_q(n2+n3+n7,3)*_q(n1+n5+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n6,1)*_q(n4+n7,2)*_q(n1+n5+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n6,1)*_q(n4+n7,2)*_q(n1+n5+n8,3)
-		+ k2*_q(n3,1)*_q(n2+n6,2)*_q(n4+n7,2)*_q(n1+n5+n8,3)
-		+ k2*_q(n2,1)*_q(n3+n6,2)*_q(n4+n7,2)*_q(n1+n5+n8,3)
-		- k4*_q(n2+n3+n6,3)*_q(n4+n7,2)*_q(n1+n5+n8,3)
-		+ k4*_q(n3,1)*_q(n6,1)*_q(n2+n4+n7,3)*_q(n1+n5+n8,3)
-		- k4*_q(n3+n6,2)*_q(n2+n4+n7,3)*_q(n1+n5+n8,3)
-		+ k4*_q(n2,1)*_q(n6,1)*_q(n3+n4+n7,3)*_q(n1+n5+n8,3)
-		- k4*_q(n2+n6,2)*_q(n3+n4+n7,3)*_q(n1+n5+n8,3)
-		- k12*_q(n6,1)*_q(n2+n3+n4+n7,4)*_q(n1+n5+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n6+n7,2)*_q(n1+n5+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n4,1)*_q(n6+n7,2)*_q(n1+n5+n8,3)
-		+ k2*_q(n3,1)*_q(n2+n4,2)*_q(n6+n7,2)*_q(n1+n5+n8,3)
-		+ k2*_q(n2,1)*_q(n3+n4,2)*_q(n6+n7,2)*_q(n1+n5+n8,3)
-		- k4*_q(n2+n3+n4,3)*_q(n6+n7,2)*_q(n1+n5+n8,3)
-		+ k4*_q(n3,1)*_q(n4,1)*_q(n2+n6+n7,3)*_q(n1+n5+n8,3)
-		- k4*_q(n3+n4,2)*_q(n2+n6+n7,3)*_q(n1+n5+n8,3)
-		+ k4*_q(n2,1)*_q(n4,1)*_q(n3+n6+n7,3)*_q(n1+n5+n8,3)
-		- k4*_q(n2+n4,2)*_q(n3+n6+n7,3)*_q(n1+n5+n8,3)
-		- k12*_q(n4,1)*_q(n2+n3+n6+n7,4)*_q(n1+n5+n8,3)
-		+ k4*_q(n2,1)*_q(n3,1)*_q(n4+n6+n7,3)*_q(n1+n5+n8,3)
-		- k4*_q(n2+n3,2)*_q(n4+n6+n7,3)*_q(n1+n5+n8,3)
-		- k12*_q(n3,1)*_q(n2+n4+n6+n7,4)*_q(n1+n5+n8,3)
-		- k12*_q(n2,1)*_q(n3+n4+n6+n7,4)*_q(n1+n5+n8,3)
-		+ k48*_q(n2+n3+n4+n6+n7,5)*_q(n1+n5+n8,3)
-		+ k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n7,1)*_q(n2+n5+n8,3)
-		- k2*_q(n1+n3,2)*_q(n4,1)*_q(n6,1)*_q(n7,1)*_q(n2+n5+n8,3)
-		- k2*_q(n3,1)*_q(n1+n4,2)*_q(n6,1)*_q(n7,1)*_q(n2+n5+n8,3)
-		- k2*_q(n1,1)*_q(n3+n4,2)*_q(n6,1)*_q(n7,1)*_q(n2+n5+n8,3)
-		+ k4*_q(n1+n3+n4,3)*_q(n6,1)*_q(n7,1)*_q(n2+n5+n8,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n1+n6,2)*_q(n7,1)*_q(n2+n5+n8,3)
-		+ k2*_q(n3+n4,2)*_q(n1+n6,2)*_q(n7,1)*_q(n2+n5+n8,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n3+n6,2)*_q(n7,1)*_q(n2+n5+n8,3)
-		+ k2*_q(n1+n4,2)*_q(n3+n6,2)*_q(n7,1)*_q(n2+n5+n8,3)
-		+ k4*_q(n4,1)*_q(n1+n3+n6,3)*_q(n7,1)*_q(n2+n5+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4+n6,2)*_q(n7,1)*_q(n2+n5+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n4+n6,2)*_q(n7,1)*_q(n2+n5+n8,3)
-		+ k4*_q(n3,1)*_q(n1+n4+n6,3)*_q(n7,1)*_q(n2+n5+n8,3)
-		+ k4*_q(n1,1)*_q(n3+n4+n6,3)*_q(n7,1)*_q(n2+n5+n8,3)
-		- k12*_q(n1+n3+n4+n6,4)*_q(n7,1)*_q(n2+n5+n8,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n1+n7,2)*_q(n2+n5+n8,3)
-		+ k2*_q(n3+n4,2)*_q(n6,1)*_q(n1+n7,2)*_q(n2+n5+n8,3)
-		+ k2*_q(n4,1)*_q(n3+n6,2)*_q(n1+n7,2)*_q(n2+n5+n8,3)
-		+ k2*_q(n3,1)*_q(n4+n6,2)*_q(n1+n7,2)*_q(n2+n5+n8,3)
-		- k4*_q(n3+n4+n6,3)*_q(n1+n7,2)*_q(n2+n5+n8,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n6,1)*_q(n3+n7,2)*_q(n2+n5+n8,3)
-		+ k2*_q(n1+n4,2)*_q(n6,1)*_q(n3+n7,2)*_q(n2+n5+n8,3)
-		+ k2*_q(n4,1)*_q(n1+n6,2)*_q(n3+n7,2)*_q(n2+n5+n8,3)
-		+ k2*_q(n1,1)*_q(n4+n6,2)*_q(n3+n7,2)*_q(n2+n5+n8,3)
-		- k4*_q(n1+n4+n6,3)*_q(n3+n7,2)*_q(n2+n5+n8,3)
-		+ k4*_q(n4,1)*_q(n6,1)*_q(n1+n3+n7,3)*_q(n2+n5+n8,3)
-		- k4*_q(n4+n6,2)*_q(n1+n3+n7,3)*_q(n2+n5+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n6,1)*_q(n4+n7,2)*_q(n2+n5+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n6,1)*_q(n4+n7,2)*_q(n2+n5+n8,3)
-		+ k2*_q(n3,1)*_q(n1+n6,2)*_q(n4+n7,2)*_q(n2+n5+n8,3)
-		+ k2*_q(n1,1)*_q(n3+n6,2)*_q(n4+n7,2)*_q(n2+n5+n8,3)
-		- k4*_q(n1+n3+n6,3)*_q(n4+n7,2)*_q(n2+n5+n8,3)
-		+ k4*_q(n3,1)*_q(n6,1)*_q(n1+n4+n7,3)*_q(n2+n5+n8,3)
-		- k4*_q(n3+n6,2)*_q(n1+n4+n7,3)*_q(n2+n5+n8,3)
-		+ k4*_q(n1,1)*_q(n6,1)*_q(n3+n4+n7,3)*_q(n2+n5+n8,3)
-		- k4*_q(n1+n6,2)*_q(n3+n4+n7,3)*_q(n2+n5+n8,3)
-		- k12*_q(n6,1)*_q(n1+n3+n4+n7,4)*_q(n2+n5+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n6+n7,2)*_q(n2+n5+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n4,1)*_q(n6+n7,2)*_q(n2+n5+n8,3)
-		+ k2*_q(n3,1)*_q(n1+n4,2)*_q(n6+n7,2)*_q(n2+n5+n8,3)
-		+ k2*_q(n1,1)*_q(n3+n4,2)*_q(n6+n7,2)*_q(n2+n5+n8,3)
-		- k4*_q(n1+n3+n4,3)*_q(n6+n7,2)*_q(n2+n5+n8,3)
-		+ k4*_q(n3,1)*_q(n4,1)*_q(n1+n6+n7,3)*_q(n2+n5+n8,3)
-		- k4*_q(n3+n4,2)*_q(n1+n6+n7,3)*_q(n2+n5+n8,3)
-		+ k4*_q(n1,1)*_q(n4,1)*_q(n3+n6+n7,3)*_q(n2+n5+n8,3)
-		- k4*_q(n1+n4,2)*_q(n3+n6+n7,3)*_q(n2+n5+n8,3)
-		- k12*_q(n4,1)*_q(n1+n3+n6+n7,4)*_q(n2+n5+n8,3)
-		+ k4*_q(n1,1)*_q(n3,1)*_q(n4+n6+n7,3)*_q(n2+n5+n8,3)
-		- k4*_q(n1+n3,2)*_q(n4+n6+n7,3)*_q(n2+n5+n8,3)
-		- k12*_q(n3,1)*_q(n1+n4+n6+n7,4)*_q(n2+n5+n8,3)
-		- k12*_q(n1,1)*_q(n3+n4+n6+n7,4)*_q(n2+n5+n8,3)
-		+ k48*_q(n1+n3+n4+n6+n7,5)*_q(n2+n5+n8,3)
-		- k6*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n7,1)*_q(n1+n2+n5+n8,4)
-		+ k6*_q(n3+n4,2)*_q(n6,1)*_q(n7,1)*_q(n1+n2+n5+n8,4)
-		+ k6*_q(n4,1)*_q(n3+n6,2)*_q(n7,1)*_q(n1+n2+n5+n8,4)
-		+ k6*_q(n3,1)*_q(n4+n6,2)*_q(n7,1)*_q(n1+n2+n5+n8,4)
-		- k12*_q(n3+n4+n6,3)*_q(n7,1)*_q(n1+n2+n5+n8,4)
-		+ k6*_q(n4,1)*_q(n6,1)*_q(n3+n7,2)*_q(n1+n2+n5+n8,4)
-		- k6*_q(n4+n6,2)*_q(n3+n7,2)*_q(n1+n2+n5+n8,4)
-		+ k6*_q(n3,1)*_q(n6,1)*_q(n4+n7,2)*_q(n1+n2+n5+n8,4)
-		- k6*_q(n3+n6,2)*_q(n4+n7,2)*_q(n1+n2+n5+n8,4)
-		- k12*_q(n6,1)*_q(n3+n4+n7,3)*_q(n1+n2+n5+n8,4)
-		+ k6*_q(n3,1)*_q(n4,1)*_q(n6+n7,2)*_q(n1+n2+n5+n8,4)
-		- k6*_q(n3+n4,2)*_q(n6+n7,2)*_q(n1+n2+n5+n8,4)
-		- k12*_q(n4,1)*_q(n3+n6+n7,3)*_q(n1+n2+n5+n8,4)
-		- k12*_q(n3,1)*_q(n4+n6+n7,3)*_q(n1+n2+n5+n8,4)
-		+ k36*_q(n3+n4+n6+n7,4)*_q(n1+n2+n5+n8,4)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n6,1)*_q(n7,1)*_q(n3+n5+n8,3)
-		- k2*_q(n1+n2,2)*_q(n4,1)*_q(n6,1)*_q(n7,1)*_q(n3+n5+n8,3)
-		- k2*_q(n2,1)*_q(n1+n4,2)*_q(n6,1)*_q(n7,1)*_q(n3+n5+n8,3)
-		- k2*_q(n1,1)*_q(n2+n4,2)*_q(n6,1)*_q(n7,1)*_q(n3+n5+n8,3)
-		+ k4*_q(n1+n2+n4,3)*_q(n6,1)*_q(n7,1)*_q(n3+n5+n8,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n1+n6,2)*_q(n7,1)*_q(n3+n5+n8,3)
-		+ k2*_q(n2+n4,2)*_q(n1+n6,2)*_q(n7,1)*_q(n3+n5+n8,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n2+n6,2)*_q(n7,1)*_q(n3+n5+n8,3)
-		+ k2*_q(n1+n4,2)*_q(n2+n6,2)*_q(n7,1)*_q(n3+n5+n8,3)
-		+ k4*_q(n4,1)*_q(n1+n2+n6,3)*_q(n7,1)*_q(n3+n5+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4+n6,2)*_q(n7,1)*_q(n3+n5+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n4+n6,2)*_q(n7,1)*_q(n3+n5+n8,3)
-		+ k4*_q(n2,1)*_q(n1+n4+n6,3)*_q(n7,1)*_q(n3+n5+n8,3)
-		+ k4*_q(n1,1)*_q(n2+n4+n6,3)*_q(n7,1)*_q(n3+n5+n8,3)
-		- k12*_q(n1+n2+n4+n6,4)*_q(n7,1)*_q(n3+n5+n8,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n6,1)*_q(n1+n7,2)*_q(n3+n5+n8,3)
-		+ k2*_q(n2+n4,2)*_q(n6,1)*_q(n1+n7,2)*_q(n3+n5+n8,3)
-		+ k2*_q(n4,1)*_q(n2+n6,2)*_q(n1+n7,2)*_q(n3+n5+n8,3)
-		+ k2*_q(n2,1)*_q(n4+n6,2)*_q(n1+n7,2)*_q(n3+n5+n8,3)
-		- k4*_q(n2+n4+n6,3)*_q(n1+n7,2)*_q(n3+n5+n8,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n6,1)*_q(n2+n7,2)*_q(n3+n5+n8,3)
-		+ k2*_q(n1+n4,2)*_q(n6,1)*_q(n2+n7,2)*_q(n3+n5+n8,3)
-		+ k2*_q(n4,1)*_q(n1+n6,2)*_q(n2+n7,2)*_q(n3+n5+n8,3)
-		+ k2*_q(n1,1)*_q(n4+n6,2)*_q(n2+n7,2)*_q(n3+n5+n8,3)
-		- k4*_q(n1+n4+n6,3)*_q(n2+n7,2)*_q(n3+n5+n8,3)
-		+ k4*_q(n4,1)*_q(n6,1)*_q(n1+n2+n7,3)*_q(n3+n5+n8,3)
-		- k4*_q(n4+n6,2)*_q(n1+n2+n7,3)*_q(n3+n5+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n6,1)*_q(n4+n7,2)*_q(n3+n5+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n6,1)*_q(n4+n7,2)*_q(n3+n5+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n6,2)*_q(n4+n7,2)*_q(n3+n5+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n6,2)*_q(n4+n7,2)*_q(n3+n5+n8,3)
-		- k4*_q(n1+n2+n6,3)*_q(n4+n7,2)*_q(n3+n5+n8,3)
-		+ k4*_q(n2,1)*_q(n6,1)*_q(n1+n4+n7,3)*_q(n3+n5+n8,3)
-		- k4*_q(n2+n6,2)*_q(n1+n4+n7,3)*_q(n3+n5+n8,3)
-		+ k4*_q(n1,1)*_q(n6,1)*_q(n2+n4+n7,3)*_q(n3+n5+n8,3)
-		- k4*_q(n1+n6,2)*_q(n2+n4+n7,3)*_q(n3+n5+n8,3)
-		- k12*_q(n6,1)*_q(n1+n2+n4+n7,4)*_q(n3+n5+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n6+n7,2)*_q(n3+n5+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n4,1)*_q(n6+n7,2)*_q(n3+n5+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n4,2)*_q(n6+n7,2)*_q(n3+n5+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n4,2)*_q(n6+n7,2)*_q(n3+n5+n8,3)
-		- k4*_q(n1+n2+n4,3)*_q(n6+n7,2)*_q(n3+n5+n8,3)
-		+ k4*_q(n2,1)*_q(n4,1)*_q(n1+n6+n7,3)*_q(n3+n5+n8,3)
-		- k4*_q(n2+n4,2)*_q(n1+n6+n7,3)*_q(n3+n5+n8,3)
-		+ k4*_q(n1,1)*_q(n4,1)*_q(n2+n6+n7,3)*_q(n3+n5+n8,3)
-		- k4*_q(n1+n4,2)*_q(n2+n6+n7,3)*_q(n3+n5+n8,3)
-		- k12*_q(n4,1)*_q(n1+n2+n6+n7,4)*_q(n3+n5+n8,3)
-		+ k4*_q(n1,1)*_q(n2,1)*_q(n4+n6+n7,3)*_q(n3+n5+n8,3)
-		- k4*_q(n1+n2,2)*_q(n4+n6+n7,3)*_q(n3+n5+n8,3)
-		- k12*_q(n2,1)*_q(n1+n4+n6+n7,4)*_q(n3+n5+n8,3)
-		- k12*_q(n1,1)*_q(n2+n4+n6+n7,4)*_q(n3+n5+n8,3)
-		+ k48*_q(n1+n2+n4+n6+n7,5)*_q(n3+n5+n8,3)
-		- k6*_q(n2,1)*_q(n4,1)*_q(n6,1)*_q(n7,1)*_q(n1+n3+n5+n8,4)
-		+ k6*_q(n2+n4,2)*_q(n6,1)*_q(n7,1)*_q(n1+n3+n5+n8,4)
-		+ k6*_q(n4,1)*_q(n2+n6,2)*_q(n7,1)*_q(n1+n3+n5+n8,4)
-		+ k6*_q(n2,1)*_q(n4+n6,2)*_q(n7,1)*_q(n1+n3+n5+n8,4)
-		- k12*_q(n2+n4+n6,3)*_q(n7,1)*_q(n1+n3+n5+n8,4)
-		+ k6*_q(n4,1)*_q(n6,1)*_q(n2+n7,2)*_q(n1+n3+n5+n8,4)
-		- k6*_q(n4+n6,2)*_q(n2+n7,2)*_q(n1+n3+n5+n8,4)
-		+ k6*_q(n2,1)*_q(n6,1)*_q(n4+n7,2)*_q(n1+n3+n5+n8,4)
-		- k6*_q(n2+n6,2)*_q(n4+n7,2)*_q(n1+n3+n5+n8,4)
-		- k12*_q(n6,1)*_q(n2+n4+n7,3)*_q(n1+n3+n5+n8,4)
-		+ k6*_q(n2,1)*_q(n4,1)*_q(n6+n7,2)*_q(n1+n3+n5+n8,4)
-		- k6*_q(n2+n4,2)*_q(n6+n7,2)*_q(n1+n3+n5+n8,4)
-		- k12*_q(n4,1)*_q(n2+n6+n7,3)*_q(n1+n3+n5+n8,4)
-		- k12*_q(n2,1)*_q(n4+n6+n7,3)*_q(n1+n3+n5+n8,4)
-		+ k36*_q(n2+n4+n6+n7,4)*_q(n1+n3+n5+n8,4)
-		- k6*_q(n1,1)*_q(n4,1)*_q(n6,1)*_q(n7,1)*_q(n2+n3+n5+n8,4)
-		+ k6*_q(n1+n4,2)*_q(n6,1)*_q(n7,1)*_q(n2+n3+n5+n8,4)
-		+ k6*_q(n4,1)*_q(n1+n6,2)*_q(n7,1)*_q(n2+n3+n5+n8,4)
-		+ k6*_q(n1,1)*_q(n4+n6,2)*_q(n7,1)*_q(n2+n3+n5+n8,4)
-		- k12*_q(n1+n4+n6,3)*_q(n7,1)*_q(n2+n3+n5+n8,4)
-		+ k6*_q(n4,1)*_q(n6,1)*_q(n1+n7,2)*_q(n2+n3+n5+n8,4)
-		- k6*_q(n4+n6,2)*_q(n1+n7,2)*_q(n2+n3+n5+n8,4)
-		+ k6*_q(n1,1)*_q(n6,1)*_q(n4+n7,2)*_q(n2+n3+n5+n8,4)
-		- k6*_q(n1+n6,2)*_q(n4+n7,2)*_q(n2+n3+n5+n8,4)
-		- k12*_q(n6,1)*_q(n1+n4+n7,3)*_q(n2+n3+n5+n8,4)
-		+ k6*_q(n1,1)*_q(n4,1)*_q(n6+n7,2)*_q(n2+n3+n5+n8,4)
-		- k6*_q(n1+n4,2)*_q(n6+n7,2)*_q(n2+n3+n5+n8,4)
-		- k12*_q(n4,1)*_q(n1+n6+n7,3)*_q(n2+n3+n5+n8,4)
-		- k12*_q(n1,1)*_q(n4+n6+n7,3)*_q(n2+n3+n5+n8,4)
-		+ k36*_q(n1+n4+n6+n7,4)*_q(n2+n3+n5+n8,4)
-		+ k24*_q(n4,1)*_q(n6,1)*_q(n7,1)*_q(n1+n2+n3+n5+n8,5)
-		- k24*_q(n4+n6,2)*_q(n7,1)*_q(n1+n2+n3+n5+n8,5)
-		- k24*_q(n6,1)*_q(n4+n7,2)*_q(n1+n2+n3+n5+n8,5)
-		- k24*_q(n4,1)*_q(n6+n7,2)*_q(n1+n2+n3+n5+n8,5)
-		+ k48*_q(n4+n6+n7,3)*_q(n1+n2+n3+n5+n8,5)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n6,1)*_q(n7,1)*_q(n4+n5+n8,3)
-		- k2*_q(n1+n2,2)*_q(n3,1)*_q(n6,1)*_q(n7,1)*_q(n4+n5+n8,3)
-		- k2*_q(n2,1)*_q(n1+n3,2)*_q(n6,1)*_q(n7,1)*_q(n4+n5+n8,3)
-		- k2*_q(n1,1)*_q(n2+n3,2)*_q(n6,1)*_q(n7,1)*_q(n4+n5+n8,3)
-		+ k4*_q(n1+n2+n3,3)*_q(n6,1)*_q(n7,1)*_q(n4+n5+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n6,2)*_q(n7,1)*_q(n4+n5+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n1+n6,2)*_q(n7,1)*_q(n4+n5+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n6,2)*_q(n7,1)*_q(n4+n5+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n2+n6,2)*_q(n7,1)*_q(n4+n5+n8,3)
-		+ k4*_q(n3,1)*_q(n1+n2+n6,3)*_q(n7,1)*_q(n4+n5+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n6,2)*_q(n7,1)*_q(n4+n5+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n3+n6,2)*_q(n7,1)*_q(n4+n5+n8,3)
-		+ k4*_q(n2,1)*_q(n1+n3+n6,3)*_q(n7,1)*_q(n4+n5+n8,3)
-		+ k4*_q(n1,1)*_q(n2+n3+n6,3)*_q(n7,1)*_q(n4+n5+n8,3)
-		- k12*_q(n1+n2+n3+n6,4)*_q(n7,1)*_q(n4+n5+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n6,1)*_q(n1+n7,2)*_q(n4+n5+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n6,1)*_q(n1+n7,2)*_q(n4+n5+n8,3)
-		+ k2*_q(n3,1)*_q(n2+n6,2)*_q(n1+n7,2)*_q(n4+n5+n8,3)
-		+ k2*_q(n2,1)*_q(n3+n6,2)*_q(n1+n7,2)*_q(n4+n5+n8,3)
-		- k4*_q(n2+n3+n6,3)*_q(n1+n7,2)*_q(n4+n5+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n6,1)*_q(n2+n7,2)*_q(n4+n5+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n6,1)*_q(n2+n7,2)*_q(n4+n5+n8,3)
-		+ k2*_q(n3,1)*_q(n1+n6,2)*_q(n2+n7,2)*_q(n4+n5+n8,3)
-		+ k2*_q(n1,1)*_q(n3+n6,2)*_q(n2+n7,2)*_q(n4+n5+n8,3)
-		- k4*_q(n1+n3+n6,3)*_q(n2+n7,2)*_q(n4+n5+n8,3)
-		+ k4*_q(n3,1)*_q(n6,1)*_q(n1+n2+n7,3)*_q(n4+n5+n8,3)
-		- k4*_q(n3+n6,2)*_q(n1+n2+n7,3)*_q(n4+n5+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n6,1)*_q(n3+n7,2)*_q(n4+n5+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n6,1)*_q(n3+n7,2)*_q(n4+n5+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n6,2)*_q(n3+n7,2)*_q(n4+n5+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n6,2)*_q(n3+n7,2)*_q(n4+n5+n8,3)
-		- k4*_q(n1+n2+n6,3)*_q(n3+n7,2)*_q(n4+n5+n8,3)
-		+ k4*_q(n2,1)*_q(n6,1)*_q(n1+n3+n7,3)*_q(n4+n5+n8,3)
-		- k4*_q(n2+n6,2)*_q(n1+n3+n7,3)*_q(n4+n5+n8,3)
-		+ k4*_q(n1,1)*_q(n6,1)*_q(n2+n3+n7,3)*_q(n4+n5+n8,3)
-		- k4*_q(n1+n6,2)*_q(n2+n3+n7,3)*_q(n4+n5+n8,3)
-		- k12*_q(n6,1)*_q(n1+n2+n3+n7,4)*_q(n4+n5+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n6+n7,2)*_q(n4+n5+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n3,1)*_q(n6+n7,2)*_q(n4+n5+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n3,2)*_q(n6+n7,2)*_q(n4+n5+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n3,2)*_q(n6+n7,2)*_q(n4+n5+n8,3)
-		- k4*_q(n1+n2+n3,3)*_q(n6+n7,2)*_q(n4+n5+n8,3)
-		+ k4*_q(n2,1)*_q(n3,1)*_q(n1+n6+n7,3)*_q(n4+n5+n8,3)
-		- k4*_q(n2+n3,2)*_q(n1+n6+n7,3)*_q(n4+n5+n8,3)
-		+ k4*_q(n1,1)*_q(n3,1)*_q(n2+n6+n7,3)*_q(n4+n5+n8,3)
-		- k4*_q(n1+n3,2)*_q(n2+n6+n7,3)*_q(n4+n5+n8,3)
-		- k12*_q(n3,1)*_q(n1+n2+n6+n7,4)*_q(n4+n5+n8,3)
-		+ k4*_q(n1,1)*_q(n2,1)*_q(n3+n6+n7,3)*_q(n4+n5+n8,3)
-		- k4*_q(n1+n2,2)*_q(n3+n6+n7,3)*_q(n4+n5+n8,3)
-		- k12*_q(n2,1)*_q(n1+n3+n6+n7,4)*_q(n4+n5+n8,3)
-		- k12*_q(n1,1)*_q(n2+n3+n6+n7,4)*_q(n4+n5+n8,3)
-		+ k48*_q(n1+n2+n3+n6+n7,5)*_q(n4+n5+n8,3)
-		- k6*_q(n2,1)*_q(n3,1)*_q(n6,1)*_q(n7,1)*_q(n1+n4+n5+n8,4)
-		+ k6*_q(n2+n3,2)*_q(n6,1)*_q(n7,1)*_q(n1+n4+n5+n8,4)
-		+ k6*_q(n3,1)*_q(n2+n6,2)*_q(n7,1)*_q(n1+n4+n5+n8,4)
-		+ k6*_q(n2,1)*_q(n3+n6,2)*_q(n7,1)*_q(n1+n4+n5+n8,4)
-		- k12*_q(n2+n3+n6,3)*_q(n7,1)*_q(n1+n4+n5+n8,4)
-		+ k6*_q(n3,1)*_q(n6,1)*_q(n2+n7,2)*_q(n1+n4+n5+n8,4)
-		- k6*_q(n3+n6,2)*_q(n2+n7,2)*_q(n1+n4+n5+n8,4)
-		+ k6*_q(n2,1)*_q(n6,1)*_q(n3+n7,2)*_q(n1+n4+n5+n8,4)
-		- k6*_q(n2+n6,2)*_q(n3+n7,2)*_q(n1+n4+n5+n8,4)
-		- k12*_q(n6,1)*_q(n2+n3+n7,3)*_q(n1+n4+n5+n8,4)
-		+ k6*_q(n2,1)*_q(n3,1)*_q(n6+n7,2)*_q(n1+n4+n5+n8,4)
-		- k6*_q(n2+n3,2)*_q(n6+n7,2)*_q(n1+n4+n5+n8,4)
-		- k12*_q(n3,1)*_q(n2+n6+n7,3)*_q(n1+n4+n5+n8,4)
-		- k12*_q(n2,1)*_q(n3+n6+n7,3)*_q(n1+n4+n5+n8,4)
-		+ k36*_q(n2+n3+n6+n7,4)*_q(n1+n4+n5+n8,4)
-		- k6*_q(n1,1)*_q(n3,1)*_q(n6,1)*_q(n7,1)*_q(n2+n4+n5+n8,4)
-		+ k6*_q(n1+n3,2)*_q(n6,1)*_q(n7,1)*_q(n2+n4+n5+n8,4)
-		+ k6*_q(n3,1)*_q(n1+n6,2)*_q(n7,1)*_q(n2+n4+n5+n8,4)
-		+ k6*_q(n1,1)*_q(n3+n6,2)*_q(n7,1)*_q(n2+n4+n5+n8,4)
-		- k12*_q(n1+n3+n6,3)*_q(n7,1)*_q(n2+n4+n5+n8,4)
-		+ k6*_q(n3,1)*_q(n6,1)*_q(n1+n7,2)*_q(n2+n4+n5+n8,4)
-		- k6*_q(n3+n6,2)*_q(n1+n7,2)*_q(n2+n4+n5+n8,4)
-		+ k6*_q(n1,1)*_q(n6,1)*_q(n3+n7,2)*_q(n2+n4+n5+n8,4)
-		- k6*_q(n1+n6,2)*_q(n3+n7,2)*_q(n2+n4+n5+n8,4)
-		- k12*_q(n6,1)*_q(n1+n3+n7,3)*_q(n2+n4+n5+n8,4)
-		+ k6*_q(n1,1)*_q(n3,1)*_q(n6+n7,2)*_q(n2+n4+n5+n8,4)
-		- k6*_q(n1+n3,2)*_q(n6+n7,2)*_q(n2+n4+n5+n8,4)
-		- k12*_q(n3,1)*_q(n1+n6+n7,3)*_q(n2+n4+n5+n8,4)
-		- k12*_q(n1,1)*_q(n3+n6+n7,3)*_q(n2+n4+n5+n8,4)
-		+ k36*_q(n1+n3+n6+n7,4)*_q(n2+n4+n5+n8,4)
-		+ k24*_q(n3,1)*_q(n6,1)*_q(n7,1)*_q(n1+n2+n4+n5+n8,5)
-		- k24*_q(n3+n6,2)*_q(n7,1)*_q(n1+n2+n4+n5+n8,5)
-		- k24*_q(n6,1)*_q(n3+n7,2)*_q(n1+n2+n4+n5+n8,5)
-		- k24*_q(n3,1)*_q(n6+n7,2)*_q(n1+n2+n4+n5+n8,5)
-		+ k48*_q(n3+n6+n7,3)*_q(n1+n2+n4+n5+n8,5)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n6,1)*_q(n7,1)*_q(n3+n4+n5+n8,4)
-		+ k6*_q(n1+n2,2)*_q(n6,1)*_q(n7,1)*_q(n3+n4+n5+n8,4)
-		+ k6*_q(n2,1)*_q(n1+n6,2)*_q(n7,1)*_q(n3+n4+n5+n8,4)
-		+ k6*_q(n1,1)*_q(n2+n6,2)*_q(n7,1)*_q(n3+n4+n5+n8,4)
-		- k12*_q(n1+n2+n6,3)*_q(n7,1)*_q(n3+n4+n5+n8,4)
-		+ k6*_q(n2,1)*_q(n6,1)*_q(n1+n7,2)*_q(n3+n4+n5+n8,4)
-		- k6*_q(n2+n6,2)*_q(n1+n7,2)*_q(n3+n4+n5+n8,4)
-		+ k6*_q(n1,1)*_q(n6,1)*_q(n2+n7,2)*_q(n3+n4+n5+n8,4)
-		- k6*_q(n1+n6,2)*_q(n2+n7,2)*_q(n3+n4+n5+n8,4)
-		- k12*_q(n6,1)*_q(n1+n2+n7,3)*_q(n3+n4+n5+n8,4)
-		+ k6*_q(n1,1)*_q(n2,1)*_q(n6+n7,2)*_q(n3+n4+n5+n8,4)
-		- k6*_q(n1+n2,2)*_q(n6+n7,2)*_q(n3+n4+n5+n8,4)
-		- k12*_q(n2,1)*_q(n1+n6+n7,3)*_q(n3+n4+n5+n8,4)
-		- k12*_q(n1,1)*_q(n2+n6+n7,3)*_q(n3+n4+n5+n8,4)
-		+ k36*_q(n1+n2+n6+n7,4)*_q(n3+n4+n5+n8,4)
-		+ k24*_q(n2,1)*_q(n6,1)*_q(n7,1)*_q(n1+n3+n4+n5+n8,5)
-		- k24*_q(n2+n6,2)*_q(n7,1)*_q(n1+n3+n4+n5+n8,5)
-		- k24*_q(n6,1)*_q(n2+n7,2)*_q(n1+n3+n4+n5+n8,5)
-		- k24*_q(n2,1)*_q(n6+n7,2)*_q(n1+n3+n4+n5+n8,5)
-		+ k48*_q(n2+n6+n7,3)*_q(n1+n3+n4+n5+n8,5)
-		+ k24*_q(n1,1)*_q(n6,1)*_q(n7,1)*_q(n2+n3+n4+n5+n8,5)
-		- k24*_q(n1+n6,2)*_q(n7,1)*_q(n2+n3+n4+n5+n8,5)
-		- k24*_q(n6,1)*_q(n1+n7,2)*_q(n2+n3+n4+n5+n8,5)
-		- k24*_q(n1,1)*_q(n6+n7,2)*_q(n2+n3+n4+n5+n8,5)
-		+ k48*_q(n1+n6+n7,3)*_q(n2+n3+n4+n5+n8,5)
-		- k120*_q(n6,1)*_q(n7,1)*_q(n1+n2+n3+n4+n5+n8,6)
-		+ k120*_q(n6+n7,2)*_q(n1+n2+n3+n4+n5+n8,6)
-		- _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n7,1)*_q(n6+n8,2)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n7,1)*_q(n6+n8,2)
-		+ _q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n7,1)*_q(n6+n8,2)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n7,1)*_q(n6+n8,2)
-		- k2*_q(n1+n2+n3,3)*_q(n4,1)*_q(n5,1)*_q(n7,1)*_q(n6+n8,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n7,1)*_q(n6+n8,2)
-		- _q(n2+n3,2)*_q(n1+n4,2)*_q(n5,1)*_q(n7,1)*_q(n6+n8,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n7,1)*_q(n6+n8,2)
-		- _q(n1+n3,2)*_q(n2+n4,2)*_q(n5,1)*_q(n7,1)*_q(n6+n8,2)
-		- k2*_q(n3,1)*_q(n1+n2+n4,3)*_q(n5,1)*_q(n7,1)*_q(n6+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n7,1)*_q(n6+n8,2)
-		- _q(n1+n2,2)*_q(n3+n4,2)*_q(n5,1)*_q(n7,1)*_q(n6+n8,2)
-		- k2*_q(n2,1)*_q(n1+n3+n4,3)*_q(n5,1)*_q(n7,1)*_q(n6+n8,2)
-		- k2*_q(n1,1)*_q(n2+n3+n4,3)*_q(n5,1)*_q(n7,1)*_q(n6+n8,2)
-		+ k6*_q(n1+n2+n3+n4,4)*_q(n5,1)*_q(n7,1)*_q(n6+n8,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		- _q(n2+n3,2)*_q(n4,1)*_q(n1+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		- _q(n3,1)*_q(n2+n4,2)*_q(n1+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		- _q(n2,1)*_q(n3+n4,2)*_q(n1+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		+ k2*_q(n2+n3+n4,3)*_q(n1+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		- _q(n1+n3,2)*_q(n4,1)*_q(n2+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		- _q(n3,1)*_q(n1+n4,2)*_q(n2+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		- _q(n1,1)*_q(n3+n4,2)*_q(n2+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		+ k2*_q(n1+n3+n4,3)*_q(n2+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n1+n2+n5,3)*_q(n7,1)*_q(n6+n8,2)
-		+ k2*_q(n3+n4,2)*_q(n1+n2+n5,3)*_q(n7,1)*_q(n6+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		- _q(n1+n2,2)*_q(n4,1)*_q(n3+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		- _q(n2,1)*_q(n1+n4,2)*_q(n3+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		- _q(n1,1)*_q(n2+n4,2)*_q(n3+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		+ k2*_q(n1+n2+n4,3)*_q(n3+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n1+n3+n5,3)*_q(n7,1)*_q(n6+n8,2)
-		+ k2*_q(n2+n4,2)*_q(n1+n3+n5,3)*_q(n7,1)*_q(n6+n8,2)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n2+n3+n5,3)*_q(n7,1)*_q(n6+n8,2)
-		+ k2*_q(n1+n4,2)*_q(n2+n3+n5,3)*_q(n7,1)*_q(n6+n8,2)
-		+ k6*_q(n4,1)*_q(n1+n2+n3+n5,4)*_q(n7,1)*_q(n6+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n4+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n4+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n4+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		+ k2*_q(n1+n2+n3,3)*_q(n4+n5,2)*_q(n7,1)*_q(n6+n8,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n4+n5,3)*_q(n7,1)*_q(n6+n8,2)
-		+ k2*_q(n2+n3,2)*_q(n1+n4+n5,3)*_q(n7,1)*_q(n6+n8,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n4+n5,3)*_q(n7,1)*_q(n6+n8,2)
-		+ k2*_q(n1+n3,2)*_q(n2+n4+n5,3)*_q(n7,1)*_q(n6+n8,2)
-		+ k6*_q(n3,1)*_q(n1+n2+n4+n5,4)*_q(n7,1)*_q(n6+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n4+n5,3)*_q(n7,1)*_q(n6+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n3+n4+n5,3)*_q(n7,1)*_q(n6+n8,2)
-		+ k6*_q(n2,1)*_q(n1+n3+n4+n5,4)*_q(n7,1)*_q(n6+n8,2)
-		+ k6*_q(n1,1)*_q(n2+n3+n4+n5,4)*_q(n7,1)*_q(n6+n8,2)
-		- k24*_q(n1+n2+n3+n4+n5,5)*_q(n7,1)*_q(n6+n8,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n7,2)*_q(n6+n8,2)
-		- _q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n1+n7,2)*_q(n6+n8,2)
-		- _q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n1+n7,2)*_q(n6+n8,2)
-		- _q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n1+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n2+n3+n4,3)*_q(n5,1)*_q(n1+n7,2)*_q(n6+n8,2)
-		- _q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n1+n7,2)*_q(n6+n8,2)
-		+ _q(n3+n4,2)*_q(n2+n5,2)*_q(n1+n7,2)*_q(n6+n8,2)
-		- _q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n1+n7,2)*_q(n6+n8,2)
-		+ _q(n2+n4,2)*_q(n3+n5,2)*_q(n1+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n4,1)*_q(n2+n3+n5,3)*_q(n1+n7,2)*_q(n6+n8,2)
-		- _q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n1+n7,2)*_q(n6+n8,2)
-		+ _q(n2+n3,2)*_q(n4+n5,2)*_q(n1+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n3,1)*_q(n2+n4+n5,3)*_q(n1+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n2,1)*_q(n3+n4+n5,3)*_q(n1+n7,2)*_q(n6+n8,2)
-		- k6*_q(n2+n3+n4+n5,4)*_q(n1+n7,2)*_q(n6+n8,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n2+n7,2)*_q(n6+n8,2)
-		- _q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n2+n7,2)*_q(n6+n8,2)
-		- _q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n2+n7,2)*_q(n6+n8,2)
-		- _q(n1,1)*_q(n3+n4,2)*_q(n5,1)*_q(n2+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n1+n3+n4,3)*_q(n5,1)*_q(n2+n7,2)*_q(n6+n8,2)
-		- _q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n2+n7,2)*_q(n6+n8,2)
-		+ _q(n3+n4,2)*_q(n1+n5,2)*_q(n2+n7,2)*_q(n6+n8,2)
-		- _q(n1,1)*_q(n4,1)*_q(n3+n5,2)*_q(n2+n7,2)*_q(n6+n8,2)
-		+ _q(n1+n4,2)*_q(n3+n5,2)*_q(n2+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n4,1)*_q(n1+n3+n5,3)*_q(n2+n7,2)*_q(n6+n8,2)
-		- _q(n1,1)*_q(n3,1)*_q(n4+n5,2)*_q(n2+n7,2)*_q(n6+n8,2)
-		+ _q(n1+n3,2)*_q(n4+n5,2)*_q(n2+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n4+n5,3)*_q(n2+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n1,1)*_q(n3+n4+n5,3)*_q(n2+n7,2)*_q(n6+n8,2)
-		- k6*_q(n1+n3+n4+n5,4)*_q(n2+n7,2)*_q(n6+n8,2)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n2+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n3+n4,2)*_q(n5,1)*_q(n1+n2+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n4,1)*_q(n3+n5,2)*_q(n1+n2+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n3,1)*_q(n4+n5,2)*_q(n1+n2+n7,3)*_q(n6+n8,2)
-		- k4*_q(n3+n4+n5,3)*_q(n1+n2+n7,3)*_q(n6+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n3+n7,2)*_q(n6+n8,2)
-		- _q(n1+n2,2)*_q(n4,1)*_q(n5,1)*_q(n3+n7,2)*_q(n6+n8,2)
-		- _q(n2,1)*_q(n1+n4,2)*_q(n5,1)*_q(n3+n7,2)*_q(n6+n8,2)
-		- _q(n1,1)*_q(n2+n4,2)*_q(n5,1)*_q(n3+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n1+n2+n4,3)*_q(n5,1)*_q(n3+n7,2)*_q(n6+n8,2)
-		- _q(n2,1)*_q(n4,1)*_q(n1+n5,2)*_q(n3+n7,2)*_q(n6+n8,2)
-		+ _q(n2+n4,2)*_q(n1+n5,2)*_q(n3+n7,2)*_q(n6+n8,2)
-		- _q(n1,1)*_q(n4,1)*_q(n2+n5,2)*_q(n3+n7,2)*_q(n6+n8,2)
-		+ _q(n1+n4,2)*_q(n2+n5,2)*_q(n3+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n4,1)*_q(n1+n2+n5,3)*_q(n3+n7,2)*_q(n6+n8,2)
-		- _q(n1,1)*_q(n2,1)*_q(n4+n5,2)*_q(n3+n7,2)*_q(n6+n8,2)
-		+ _q(n1+n2,2)*_q(n4+n5,2)*_q(n3+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n4+n5,3)*_q(n3+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n4+n5,3)*_q(n3+n7,2)*_q(n6+n8,2)
-		- k6*_q(n1+n2+n4+n5,4)*_q(n3+n7,2)*_q(n6+n8,2)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n1+n3+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n2+n4,2)*_q(n5,1)*_q(n1+n3+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n4,1)*_q(n2+n5,2)*_q(n1+n3+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n2,1)*_q(n4+n5,2)*_q(n1+n3+n7,3)*_q(n6+n8,2)
-		- k4*_q(n2+n4+n5,3)*_q(n1+n3+n7,3)*_q(n6+n8,2)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n2+n3+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n1+n4,2)*_q(n5,1)*_q(n2+n3+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n4,1)*_q(n1+n5,2)*_q(n2+n3+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n1,1)*_q(n4+n5,2)*_q(n2+n3+n7,3)*_q(n6+n8,2)
-		- k4*_q(n1+n4+n5,3)*_q(n2+n3+n7,3)*_q(n6+n8,2)
-		+ k6*_q(n4,1)*_q(n5,1)*_q(n1+n2+n3+n7,4)*_q(n6+n8,2)
-		- k6*_q(n4+n5,2)*_q(n1+n2+n3+n7,4)*_q(n6+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n4+n7,2)*_q(n6+n8,2)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n5,1)*_q(n4+n7,2)*_q(n6+n8,2)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n5,1)*_q(n4+n7,2)*_q(n6+n8,2)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n5,1)*_q(n4+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n1+n2+n3,3)*_q(n5,1)*_q(n4+n7,2)*_q(n6+n8,2)
-		- _q(n2,1)*_q(n3,1)*_q(n1+n5,2)*_q(n4+n7,2)*_q(n6+n8,2)
-		+ _q(n2+n3,2)*_q(n1+n5,2)*_q(n4+n7,2)*_q(n6+n8,2)
-		- _q(n1,1)*_q(n3,1)*_q(n2+n5,2)*_q(n4+n7,2)*_q(n6+n8,2)
-		+ _q(n1+n3,2)*_q(n2+n5,2)*_q(n4+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n2+n5,3)*_q(n4+n7,2)*_q(n6+n8,2)
-		- _q(n1,1)*_q(n2,1)*_q(n3+n5,2)*_q(n4+n7,2)*_q(n6+n8,2)
-		+ _q(n1+n2,2)*_q(n3+n5,2)*_q(n4+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n3+n5,3)*_q(n4+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n3+n5,3)*_q(n4+n7,2)*_q(n6+n8,2)
-		- k6*_q(n1+n2+n3+n5,4)*_q(n4+n7,2)*_q(n6+n8,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n1+n4+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n2+n3,2)*_q(n5,1)*_q(n1+n4+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n3,1)*_q(n2+n5,2)*_q(n1+n4+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n2,1)*_q(n3+n5,2)*_q(n1+n4+n7,3)*_q(n6+n8,2)
-		- k4*_q(n2+n3+n5,3)*_q(n1+n4+n7,3)*_q(n6+n8,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n2+n4+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n1+n3,2)*_q(n5,1)*_q(n2+n4+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n5,2)*_q(n2+n4+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n1,1)*_q(n3+n5,2)*_q(n2+n4+n7,3)*_q(n6+n8,2)
-		- k4*_q(n1+n3+n5,3)*_q(n2+n4+n7,3)*_q(n6+n8,2)
-		+ k6*_q(n3,1)*_q(n5,1)*_q(n1+n2+n4+n7,4)*_q(n6+n8,2)
-		- k6*_q(n3+n5,2)*_q(n1+n2+n4+n7,4)*_q(n6+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n3+n4+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n5,1)*_q(n3+n4+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n5,2)*_q(n3+n4+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n5,2)*_q(n3+n4+n7,3)*_q(n6+n8,2)
-		- k4*_q(n1+n2+n5,3)*_q(n3+n4+n7,3)*_q(n6+n8,2)
-		+ k6*_q(n2,1)*_q(n5,1)*_q(n1+n3+n4+n7,4)*_q(n6+n8,2)
-		- k6*_q(n2+n5,2)*_q(n1+n3+n4+n7,4)*_q(n6+n8,2)
-		+ k6*_q(n1,1)*_q(n5,1)*_q(n2+n3+n4+n7,4)*_q(n6+n8,2)
-		- k6*_q(n1+n5,2)*_q(n2+n3+n4+n7,4)*_q(n6+n8,2)
-		- k24*_q(n5,1)*_q(n1+n2+n3+n4+n7,5)*_q(n6+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5+n7,2)*_q(n6+n8,2)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n5+n7,2)*_q(n6+n8,2)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n5+n7,2)*_q(n6+n8,2)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n5+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n1+n2+n3,3)*_q(n4,1)*_q(n5+n7,2)*_q(n6+n8,2)
-		- _q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n5+n7,2)*_q(n6+n8,2)
-		+ _q(n2+n3,2)*_q(n1+n4,2)*_q(n5+n7,2)*_q(n6+n8,2)
-		- _q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n5+n7,2)*_q(n6+n8,2)
-		+ _q(n1+n3,2)*_q(n2+n4,2)*_q(n5+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n2+n4,3)*_q(n5+n7,2)*_q(n6+n8,2)
-		- _q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n5+n7,2)*_q(n6+n8,2)
-		+ _q(n1+n2,2)*_q(n3+n4,2)*_q(n5+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n3+n4,3)*_q(n5+n7,2)*_q(n6+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n3+n4,3)*_q(n5+n7,2)*_q(n6+n8,2)
-		- k6*_q(n1+n2+n3+n4,4)*_q(n5+n7,2)*_q(n6+n8,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n5+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n2+n3,2)*_q(n4,1)*_q(n1+n5+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n3,1)*_q(n2+n4,2)*_q(n1+n5+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n2,1)*_q(n3+n4,2)*_q(n1+n5+n7,3)*_q(n6+n8,2)
-		- k4*_q(n2+n3+n4,3)*_q(n1+n5+n7,3)*_q(n6+n8,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n5+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n1+n3,2)*_q(n4,1)*_q(n2+n5+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n4,2)*_q(n2+n5+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n1,1)*_q(n3+n4,2)*_q(n2+n5+n7,3)*_q(n6+n8,2)
-		- k4*_q(n1+n3+n4,3)*_q(n2+n5+n7,3)*_q(n6+n8,2)
-		+ k6*_q(n3,1)*_q(n4,1)*_q(n1+n2+n5+n7,4)*_q(n6+n8,2)
-		- k6*_q(n3+n4,2)*_q(n1+n2+n5+n7,4)*_q(n6+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n5+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n4,1)*_q(n3+n5+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n4,2)*_q(n3+n5+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n4,2)*_q(n3+n5+n7,3)*_q(n6+n8,2)
-		- k4*_q(n1+n2+n4,3)*_q(n3+n5+n7,3)*_q(n6+n8,2)
-		+ k6*_q(n2,1)*_q(n4,1)*_q(n1+n3+n5+n7,4)*_q(n6+n8,2)
-		- k6*_q(n2+n4,2)*_q(n1+n3+n5+n7,4)*_q(n6+n8,2)
-		+ k6*_q(n1,1)*_q(n4,1)*_q(n2+n3+n5+n7,4)*_q(n6+n8,2)
-		- k6*_q(n1+n4,2)*_q(n2+n3+n5+n7,4)*_q(n6+n8,2)
-		- k24*_q(n4,1)*_q(n1+n2+n3+n5+n7,5)*_q(n6+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n5+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n3,1)*_q(n4+n5+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n3,2)*_q(n4+n5+n7,3)*_q(n6+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n3,2)*_q(n4+n5+n7,3)*_q(n6+n8,2)
-		- k4*_q(n1+n2+n3,3)*_q(n4+n5+n7,3)*_q(n6+n8,2)
-		+ k6*_q(n2,1)*_q(n3,1)*_q(n1+n4+n5+n7,4)*_q(n6+n8,2)
-		- k6*_q(n2+n3,2)*_q(n1+n4+n5+n7,4)*_q(n6+n8,2)
-		+ k6*_q(n1,1)*_q(n3,1)*_q(n2+n4+n5+n7,4)*_q(n6+n8,2)
-		- k6*_q(n1+n3,2)*_q(n2+n4+n5+n7,4)*_q(n6+n8,2)
-		- k24*_q(n3,1)*_q(n1+n2+n4+n5+n7,5)*_q(n6+n8,2)
-		+ k6*_q(n1,1)*_q(n2,1)*_q(n3+n4+n5+n7,4)*_q(n6+n8,2)
-		- k6*_q(n1+n2,2)*_q(n3+n4+n5+n7,4)*_q(n6+n8,2)
-		- k24*_q(n2,1)*_q(n1+n3+n4+n5+n7,5)*_q(n6+n8,2)
-		- k24*_q(n1,1)*_q(n2+n3+n4+n5+n7,5)*_q(n6+n8,2)
-		+ k120*_q(n1+n2+n3+n4+n5+n7,6)*_q(n6+n8,2)
-		+ k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n7,1)*_q(n1+n6+n8,3)
-		- k2*_q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n7,1)*_q(n1+n6+n8,3)
-		- k2*_q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n7,1)*_q(n1+n6+n8,3)
-		- k2*_q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n7,1)*_q(n1+n6+n8,3)
-		+ k4*_q(n2+n3+n4,3)*_q(n5,1)*_q(n7,1)*_q(n1+n6+n8,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n7,1)*_q(n1+n6+n8,3)
-		+ k2*_q(n3+n4,2)*_q(n2+n5,2)*_q(n7,1)*_q(n1+n6+n8,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n7,1)*_q(n1+n6+n8,3)
-		+ k2*_q(n2+n4,2)*_q(n3+n5,2)*_q(n7,1)*_q(n1+n6+n8,3)
-		+ k4*_q(n4,1)*_q(n2+n3+n5,3)*_q(n7,1)*_q(n1+n6+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n7,1)*_q(n1+n6+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n4+n5,2)*_q(n7,1)*_q(n1+n6+n8,3)
-		+ k4*_q(n3,1)*_q(n2+n4+n5,3)*_q(n7,1)*_q(n1+n6+n8,3)
-		+ k4*_q(n2,1)*_q(n3+n4+n5,3)*_q(n7,1)*_q(n1+n6+n8,3)
-		- k12*_q(n2+n3+n4+n5,4)*_q(n7,1)*_q(n1+n6+n8,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n2+n7,2)*_q(n1+n6+n8,3)
-		+ k2*_q(n3+n4,2)*_q(n5,1)*_q(n2+n7,2)*_q(n1+n6+n8,3)
-		+ k2*_q(n4,1)*_q(n3+n5,2)*_q(n2+n7,2)*_q(n1+n6+n8,3)
-		+ k2*_q(n3,1)*_q(n4+n5,2)*_q(n2+n7,2)*_q(n1+n6+n8,3)
-		- k4*_q(n3+n4+n5,3)*_q(n2+n7,2)*_q(n1+n6+n8,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n3+n7,2)*_q(n1+n6+n8,3)
-		+ k2*_q(n2+n4,2)*_q(n5,1)*_q(n3+n7,2)*_q(n1+n6+n8,3)
-		+ k2*_q(n4,1)*_q(n2+n5,2)*_q(n3+n7,2)*_q(n1+n6+n8,3)
-		+ k2*_q(n2,1)*_q(n4+n5,2)*_q(n3+n7,2)*_q(n1+n6+n8,3)
-		- k4*_q(n2+n4+n5,3)*_q(n3+n7,2)*_q(n1+n6+n8,3)
-		+ k4*_q(n4,1)*_q(n5,1)*_q(n2+n3+n7,3)*_q(n1+n6+n8,3)
-		- k4*_q(n4+n5,2)*_q(n2+n3+n7,3)*_q(n1+n6+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n4+n7,2)*_q(n1+n6+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n5,1)*_q(n4+n7,2)*_q(n1+n6+n8,3)
-		+ k2*_q(n3,1)*_q(n2+n5,2)*_q(n4+n7,2)*_q(n1+n6+n8,3)
-		+ k2*_q(n2,1)*_q(n3+n5,2)*_q(n4+n7,2)*_q(n1+n6+n8,3)
-		- k4*_q(n2+n3+n5,3)*_q(n4+n7,2)*_q(n1+n6+n8,3)
-		+ k4*_q(n3,1)*_q(n5,1)*_q(n2+n4+n7,3)*_q(n1+n6+n8,3)
-		- k4*_q(n3+n5,2)*_q(n2+n4+n7,3)*_q(n1+n6+n8,3)
-		+ k4*_q(n2,1)*_q(n5,1)*_q(n3+n4+n7,3)*_q(n1+n6+n8,3)
-		- k4*_q(n2+n5,2)*_q(n3+n4+n7,3)*_q(n1+n6+n8,3)
-		- k12*_q(n5,1)*_q(n2+n3+n4+n7,4)*_q(n1+n6+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5+n7,2)*_q(n1+n6+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n4,1)*_q(n5+n7,2)*_q(n1+n6+n8,3)
-		+ k2*_q(n3,1)*_q(n2+n4,2)*_q(n5+n7,2)*_q(n1+n6+n8,3)
-		+ k2*_q(n2,1)*_q(n3+n4,2)*_q(n5+n7,2)*_q(n1+n6+n8,3)
-		- k4*_q(n2+n3+n4,3)*_q(n5+n7,2)*_q(n1+n6+n8,3)
-		+ k4*_q(n3,1)*_q(n4,1)*_q(n2+n5+n7,3)*_q(n1+n6+n8,3)
-		- k4*_q(n3+n4,2)*_q(n2+n5+n7,3)*_q(n1+n6+n8,3)
-		+ k4*_q(n2,1)*_q(n4,1)*_q(n3+n5+n7,3)*_q(n1+n6+n8,3)
-		- k4*_q(n2+n4,2)*_q(n3+n5+n7,3)*_q(n1+n6+n8,3)
-		- k12*_q(n4,1)*_q(n2+n3+n5+n7,4)*_q(n1+n6+n8,3)
-		+ k4*_q(n2,1)*_q(n3,1)*_q(n4+n5+n7,3)*_q(n1+n6+n8,3)
-		- k4*_q(n2+n3,2)*_q(n4+n5+n7,3)*_q(n1+n6+n8,3)
-		- k12*_q(n3,1)*_q(n2+n4+n5+n7,4)*_q(n1+n6+n8,3)
-		- k12*_q(n2,1)*_q(n3+n4+n5+n7,4)*_q(n1+n6+n8,3)
-		+ k48*_q(n2+n3+n4+n5+n7,5)*_q(n1+n6+n8,3)
-		+ k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n7,1)*_q(n2+n6+n8,3)
-		- k2*_q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n7,1)*_q(n2+n6+n8,3)
-		- k2*_q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n7,1)*_q(n2+n6+n8,3)
-		- k2*_q(n1,1)*_q(n3+n4,2)*_q(n5,1)*_q(n7,1)*_q(n2+n6+n8,3)
-		+ k4*_q(n1+n3+n4,3)*_q(n5,1)*_q(n7,1)*_q(n2+n6+n8,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n7,1)*_q(n2+n6+n8,3)
-		+ k2*_q(n3+n4,2)*_q(n1+n5,2)*_q(n7,1)*_q(n2+n6+n8,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n3+n5,2)*_q(n7,1)*_q(n2+n6+n8,3)
-		+ k2*_q(n1+n4,2)*_q(n3+n5,2)*_q(n7,1)*_q(n2+n6+n8,3)
-		+ k4*_q(n4,1)*_q(n1+n3+n5,3)*_q(n7,1)*_q(n2+n6+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4+n5,2)*_q(n7,1)*_q(n2+n6+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n4+n5,2)*_q(n7,1)*_q(n2+n6+n8,3)
-		+ k4*_q(n3,1)*_q(n1+n4+n5,3)*_q(n7,1)*_q(n2+n6+n8,3)
-		+ k4*_q(n1,1)*_q(n3+n4+n5,3)*_q(n7,1)*_q(n2+n6+n8,3)
-		- k12*_q(n1+n3+n4+n5,4)*_q(n7,1)*_q(n2+n6+n8,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n7,2)*_q(n2+n6+n8,3)
-		+ k2*_q(n3+n4,2)*_q(n5,1)*_q(n1+n7,2)*_q(n2+n6+n8,3)
-		+ k2*_q(n4,1)*_q(n3+n5,2)*_q(n1+n7,2)*_q(n2+n6+n8,3)
-		+ k2*_q(n3,1)*_q(n4+n5,2)*_q(n1+n7,2)*_q(n2+n6+n8,3)
-		- k4*_q(n3+n4+n5,3)*_q(n1+n7,2)*_q(n2+n6+n8,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n3+n7,2)*_q(n2+n6+n8,3)
-		+ k2*_q(n1+n4,2)*_q(n5,1)*_q(n3+n7,2)*_q(n2+n6+n8,3)
-		+ k2*_q(n4,1)*_q(n1+n5,2)*_q(n3+n7,2)*_q(n2+n6+n8,3)
-		+ k2*_q(n1,1)*_q(n4+n5,2)*_q(n3+n7,2)*_q(n2+n6+n8,3)
-		- k4*_q(n1+n4+n5,3)*_q(n3+n7,2)*_q(n2+n6+n8,3)
-		+ k4*_q(n4,1)*_q(n5,1)*_q(n1+n3+n7,3)*_q(n2+n6+n8,3)
-		- k4*_q(n4+n5,2)*_q(n1+n3+n7,3)*_q(n2+n6+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n4+n7,2)*_q(n2+n6+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n5,1)*_q(n4+n7,2)*_q(n2+n6+n8,3)
-		+ k2*_q(n3,1)*_q(n1+n5,2)*_q(n4+n7,2)*_q(n2+n6+n8,3)
-		+ k2*_q(n1,1)*_q(n3+n5,2)*_q(n4+n7,2)*_q(n2+n6+n8,3)
-		- k4*_q(n1+n3+n5,3)*_q(n4+n7,2)*_q(n2+n6+n8,3)
-		+ k4*_q(n3,1)*_q(n5,1)*_q(n1+n4+n7,3)*_q(n2+n6+n8,3)
-		- k4*_q(n3+n5,2)*_q(n1+n4+n7,3)*_q(n2+n6+n8,3)
-		+ k4*_q(n1,1)*_q(n5,1)*_q(n3+n4+n7,3)*_q(n2+n6+n8,3)
-		- k4*_q(n1+n5,2)*_q(n3+n4+n7,3)*_q(n2+n6+n8,3)
-		- k12*_q(n5,1)*_q(n1+n3+n4+n7,4)*_q(n2+n6+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5+n7,2)*_q(n2+n6+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n4,1)*_q(n5+n7,2)*_q(n2+n6+n8,3)
-		+ k2*_q(n3,1)*_q(n1+n4,2)*_q(n5+n7,2)*_q(n2+n6+n8,3)
-		+ k2*_q(n1,1)*_q(n3+n4,2)*_q(n5+n7,2)*_q(n2+n6+n8,3)
-		- k4*_q(n1+n3+n4,3)*_q(n5+n7,2)*_q(n2+n6+n8,3)
-		+ k4*_q(n3,1)*_q(n4,1)*_q(n1+n5+n7,3)*_q(n2+n6+n8,3)
-		- k4*_q(n3+n4,2)*_q(n1+n5+n7,3)*_q(n2+n6+n8,3)
-		+ k4*_q(n1,1)*_q(n4,1)*_q(n3+n5+n7,3)*_q(n2+n6+n8,3)
-		- k4*_q(n1+n4,2)*_q(n3+n5+n7,3)*_q(n2+n6+n8,3)
-		- k12*_q(n4,1)*_q(n1+n3+n5+n7,4)*_q(n2+n6+n8,3)
-		+ k4*_q(n1,1)*_q(n3,1)*_q(n4+n5+n7,3)*_q(n2+n6+n8,3)
-		- k4*_q(n1+n3,2)*_q(n4+n5+n7,3)*_q(n2+n6+n8,3)
-		- k12*_q(n3,1)*_q(n1+n4+n5+n7,4)*_q(n2+n6+n8,3)
-		- k12*_q(n1,1)*_q(n3+n4+n5+n7,4)*_q(n2+n6+n8,3)
-		+ k48*_q(n1+n3+n4+n5+n7,5)*_q(n2+n6+n8,3)
-		- k6*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n7,1)*_q(n1+n2+n6+n8,4)
-		+ k6*_q(n3+n4,2)*_q(n5,1)*_q(n7,1)*_q(n1+n2+n6+n8,4)
-		+ k6*_q(n4,1)*_q(n3+n5,2)*_q(n7,1)*_q(n1+n2+n6+n8,4)
-		+ k6*_q(n3,1)*_q(n4+n5,2)*_q(n7,1)*_q(n1+n2+n6+n8,4)
-		- k12*_q(n3+n4+n5,3)*_q(n7,1)*_q(n1+n2+n6+n8,4)
-		+ k6*_q(n4,1)*_q(n5,1)*_q(n3+n7,2)*_q(n1+n2+n6+n8,4)
-		- k6*_q(n4+n5,2)*_q(n3+n7,2)*_q(n1+n2+n6+n8,4)
-		+ k6*_q(n3,1)*_q(n5,1)*_q(n4+n7,2)*_q(n1+n2+n6+n8,4)
-		- k6*_q(n3+n5,2)*_q(n4+n7,2)*_q(n1+n2+n6+n8,4)
-		- k12*_q(n5,1)*_q(n3+n4+n7,3)*_q(n1+n2+n6+n8,4)
-		+ k6*_q(n3,1)*_q(n4,1)*_q(n5+n7,2)*_q(n1+n2+n6+n8,4)
-		- k6*_q(n3+n4,2)*_q(n5+n7,2)*_q(n1+n2+n6+n8,4)
-		- k12*_q(n4,1)*_q(n3+n5+n7,3)*_q(n1+n2+n6+n8,4)
-		- k12*_q(n3,1)*_q(n4+n5+n7,3)*_q(n1+n2+n6+n8,4)
-		+ k36*_q(n3+n4+n5+n7,4)*_q(n1+n2+n6+n8,4)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n7,1)*_q(n3+n6+n8,3)
-		- k2*_q(n1+n2,2)*_q(n4,1)*_q(n5,1)*_q(n7,1)*_q(n3+n6+n8,3)
-		- k2*_q(n2,1)*_q(n1+n4,2)*_q(n5,1)*_q(n7,1)*_q(n3+n6+n8,3)
-		- k2*_q(n1,1)*_q(n2+n4,2)*_q(n5,1)*_q(n7,1)*_q(n3+n6+n8,3)
-		+ k4*_q(n1+n2+n4,3)*_q(n5,1)*_q(n7,1)*_q(n3+n6+n8,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n1+n5,2)*_q(n7,1)*_q(n3+n6+n8,3)
-		+ k2*_q(n2+n4,2)*_q(n1+n5,2)*_q(n7,1)*_q(n3+n6+n8,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n2+n5,2)*_q(n7,1)*_q(n3+n6+n8,3)
-		+ k2*_q(n1+n4,2)*_q(n2+n5,2)*_q(n7,1)*_q(n3+n6+n8,3)
-		+ k4*_q(n4,1)*_q(n1+n2+n5,3)*_q(n7,1)*_q(n3+n6+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4+n5,2)*_q(n7,1)*_q(n3+n6+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n4+n5,2)*_q(n7,1)*_q(n3+n6+n8,3)
-		+ k4*_q(n2,1)*_q(n1+n4+n5,3)*_q(n7,1)*_q(n3+n6+n8,3)
-		+ k4*_q(n1,1)*_q(n2+n4+n5,3)*_q(n7,1)*_q(n3+n6+n8,3)
-		- k12*_q(n1+n2+n4+n5,4)*_q(n7,1)*_q(n3+n6+n8,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n1+n7,2)*_q(n3+n6+n8,3)
-		+ k2*_q(n2+n4,2)*_q(n5,1)*_q(n1+n7,2)*_q(n3+n6+n8,3)
-		+ k2*_q(n4,1)*_q(n2+n5,2)*_q(n1+n7,2)*_q(n3+n6+n8,3)
-		+ k2*_q(n2,1)*_q(n4+n5,2)*_q(n1+n7,2)*_q(n3+n6+n8,3)
-		- k4*_q(n2+n4+n5,3)*_q(n1+n7,2)*_q(n3+n6+n8,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n2+n7,2)*_q(n3+n6+n8,3)
-		+ k2*_q(n1+n4,2)*_q(n5,1)*_q(n2+n7,2)*_q(n3+n6+n8,3)
-		+ k2*_q(n4,1)*_q(n1+n5,2)*_q(n2+n7,2)*_q(n3+n6+n8,3)
-		+ k2*_q(n1,1)*_q(n4+n5,2)*_q(n2+n7,2)*_q(n3+n6+n8,3)
-		- k4*_q(n1+n4+n5,3)*_q(n2+n7,2)*_q(n3+n6+n8,3)
-		+ k4*_q(n4,1)*_q(n5,1)*_q(n1+n2+n7,3)*_q(n3+n6+n8,3)
-		- k4*_q(n4+n5,2)*_q(n1+n2+n7,3)*_q(n3+n6+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n4+n7,2)*_q(n3+n6+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n5,1)*_q(n4+n7,2)*_q(n3+n6+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n5,2)*_q(n4+n7,2)*_q(n3+n6+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n5,2)*_q(n4+n7,2)*_q(n3+n6+n8,3)
-		- k4*_q(n1+n2+n5,3)*_q(n4+n7,2)*_q(n3+n6+n8,3)
-		+ k4*_q(n2,1)*_q(n5,1)*_q(n1+n4+n7,3)*_q(n3+n6+n8,3)
-		- k4*_q(n2+n5,2)*_q(n1+n4+n7,3)*_q(n3+n6+n8,3)
-		+ k4*_q(n1,1)*_q(n5,1)*_q(n2+n4+n7,3)*_q(n3+n6+n8,3)
-		- k4*_q(n1+n5,2)*_q(n2+n4+n7,3)*_q(n3+n6+n8,3)
-		- k12*_q(n5,1)*_q(n1+n2+n4+n7,4)*_q(n3+n6+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5+n7,2)*_q(n3+n6+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n4,1)*_q(n5+n7,2)*_q(n3+n6+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n4,2)*_q(n5+n7,2)*_q(n3+n6+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n4,2)*_q(n5+n7,2)*_q(n3+n6+n8,3)
-		- k4*_q(n1+n2+n4,3)*_q(n5+n7,2)*_q(n3+n6+n8,3)
-		+ k4*_q(n2,1)*_q(n4,1)*_q(n1+n5+n7,3)*_q(n3+n6+n8,3)
-		- k4*_q(n2+n4,2)*_q(n1+n5+n7,3)*_q(n3+n6+n8,3)
-		+ k4*_q(n1,1)*_q(n4,1)*_q(n2+n5+n7,3)*_q(n3+n6+n8,3)
-		- k4*_q(n1+n4,2)*_q(n2+n5+n7,3)*_q(n3+n6+n8,3)
-		- k12*_q(n4,1)*_q(n1+n2+n5+n7,4)*_q(n3+n6+n8,3)
-		+ k4*_q(n1,1)*_q(n2,1)*_q(n4+n5+n7,3)*_q(n3+n6+n8,3)
-		- k4*_q(n1+n2,2)*_q(n4+n5+n7,3)*_q(n3+n6+n8,3)
-		- k12*_q(n2,1)*_q(n1+n4+n5+n7,4)*_q(n3+n6+n8,3)
-		- k12*_q(n1,1)*_q(n2+n4+n5+n7,4)*_q(n3+n6+n8,3)
-		+ k48*_q(n1+n2+n4+n5+n7,5)*_q(n3+n6+n8,3)
-		- k6*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n7,1)*_q(n1+n3+n6+n8,4)
-		+ k6*_q(n2+n4,2)*_q(n5,1)*_q(n7,1)*_q(n1+n3+n6+n8,4)
-		+ k6*_q(n4,1)*_q(n2+n5,2)*_q(n7,1)*_q(n1+n3+n6+n8,4)
-		+ k6*_q(n2,1)*_q(n4+n5,2)*_q(n7,1)*_q(n1+n3+n6+n8,4)
-		- k12*_q(n2+n4+n5,3)*_q(n7,1)*_q(n1+n3+n6+n8,4)
-		+ k6*_q(n4,1)*_q(n5,1)*_q(n2+n7,2)*_q(n1+n3+n6+n8,4)
-		- k6*_q(n4+n5,2)*_q(n2+n7,2)*_q(n1+n3+n6+n8,4)
-		+ k6*_q(n2,1)*_q(n5,1)*_q(n4+n7,2)*_q(n1+n3+n6+n8,4)
-		- k6*_q(n2+n5,2)*_q(n4+n7,2)*_q(n1+n3+n6+n8,4)
-		- k12*_q(n5,1)*_q(n2+n4+n7,3)*_q(n1+n3+n6+n8,4)
-		+ k6*_q(n2,1)*_q(n4,1)*_q(n5+n7,2)*_q(n1+n3+n6+n8,4)
-		- k6*_q(n2+n4,2)*_q(n5+n7,2)*_q(n1+n3+n6+n8,4)
-		- k12*_q(n4,1)*_q(n2+n5+n7,3)*_q(n1+n3+n6+n8,4)
-		- k12*_q(n2,1)*_q(n4+n5+n7,3)*_q(n1+n3+n6+n8,4)
-		+ k36*_q(n2+n4+n5+n7,4)*_q(n1+n3+n6+n8,4)
-		- k6*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n7,1)*_q(n2+n3+n6+n8,4)
-		+ k6*_q(n1+n4,2)*_q(n5,1)*_q(n7,1)*_q(n2+n3+n6+n8,4)
-		+ k6*_q(n4,1)*_q(n1+n5,2)*_q(n7,1)*_q(n2+n3+n6+n8,4)
-		+ k6*_q(n1,1)*_q(n4+n5,2)*_q(n7,1)*_q(n2+n3+n6+n8,4)
-		- k12*_q(n1+n4+n5,3)*_q(n7,1)*_q(n2+n3+n6+n8,4)
-		+ k6*_q(n4,1)*_q(n5,1)*_q(n1+n7,2)*_q(n2+n3+n6+n8,4)
-		- k6*_q(n4+n5,2)*_q(n1+n7,2)*_q(n2+n3+n6+n8,4)
-		+ k6*_q(n1,1)*_q(n5,1)*_q(n4+n7,2)*_q(n2+n3+n6+n8,4)
-		- k6*_q(n1+n5,2)*_q(n4+n7,2)*_q(n2+n3+n6+n8,4)
-		- k12*_q(n5,1)*_q(n1+n4+n7,3)*_q(n2+n3+n6+n8,4)
-		+ k6*_q(n1,1)*_q(n4,1)*_q(n5+n7,2)*_q(n2+n3+n6+n8,4)
-		- k6*_q(n1+n4,2)*_q(n5+n7,2)*_q(n2+n3+n6+n8,4)
-		- k12*_q(n4,1)*_q(n1+n5+n7,3)*_q(n2+n3+n6+n8,4)
-		- k12*_q(n1,1)*_q(n4+n5+n7,3)*_q(n2+n3+n6+n8,4)
-		+ k36*_q(n1+n4+n5+n7,4)*_q(n2+n3+n6+n8,4)
-		+ k24*_q(n4,1)*_q(n5,1)*_q(n7,1)*_q(n1+n2+n3+n6+n8,5)
-		- k24*_q(n4+n5,2)*_q(n7,1)*_q(n1+n2+n3+n6+n8,5)
-		- k24*_q(n5,1)*_q(n4+n7,2)*_q(n1+n2+n3+n6+n8,5)
-		- k24*_q(n4,1)*_q(n5+n7,2)*_q(n1+n2+n3+n6+n8,5)
-		+ k48*_q(n4+n5+n7,3)*_q(n1+n2+n3+n6+n8,5)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n7,1)*_q(n4+n6+n8,3)
-		- k2*_q(n1+n2,2)*_q(n3,1)*_q(n5,1)*_q(n7,1)*_q(n4+n6+n8,3));
-      }
-      Complex uc8P4(const Harmonic n1,
-		    const Harmonic n2,
-		    const Harmonic n3,
-		    const Harmonic n4,
-		    const Harmonic n5,
-		    const Harmonic n6,
-		    const Harmonic n7,
-		    const Harmonic n8) const
+      Complex uc7(const QVector& q, Workspace&,
+		  const Harmonic n1,
+		  const Harmonic n2,
+		  const Harmonic n3,
+		  const Harmonic n4,
+		  const Harmonic n5,
+		  const Harmonic n6,
+		  const Harmonic n7) const
       {
-	const Real k2   = 2;
-	const Real k4   = 4;
-	const Real k6   = 6;
-	const Real k12  = 12;
-	const Real k24  = 24;
-	const Real k36  = 36;
-	const Real k48  = 48;
-	const Real k120 = 120;
-	const Real k720 = 720;
-	const Real k5040 = 5040;
-	return (k2*_q(n2,1)*_q(n1+n3,2)*_q(n5,1)*_q(n7,1)*_q(n4+n6+n8,3)
-		- k2*_q(n1,1)*_q(n2+n3,2)*_q(n5,1)*_q(n7,1)*_q(n4+n6+n8,3)
-		+ k4*_q(n1+n2+n3,3)*_q(n5,1)*_q(n7,1)*_q(n4+n6+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n5,2)*_q(n7,1)*_q(n4+n6+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n1+n5,2)*_q(n7,1)*_q(n4+n6+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n5,2)*_q(n7,1)*_q(n4+n6+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n2+n5,2)*_q(n7,1)*_q(n4+n6+n8,3)
-		+ k4*_q(n3,1)*_q(n1+n2+n5,3)*_q(n7,1)*_q(n4+n6+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n5,2)*_q(n7,1)*_q(n4+n6+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n3+n5,2)*_q(n7,1)*_q(n4+n6+n8,3)
-		+ k4*_q(n2,1)*_q(n1+n3+n5,3)*_q(n7,1)*_q(n4+n6+n8,3)
-		+ k4*_q(n1,1)*_q(n2+n3+n5,3)*_q(n7,1)*_q(n4+n6+n8,3)
-		- k12*_q(n1+n2+n3+n5,4)*_q(n7,1)*_q(n4+n6+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n1+n7,2)*_q(n4+n6+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n5,1)*_q(n1+n7,2)*_q(n4+n6+n8,3)
-		+ k2*_q(n3,1)*_q(n2+n5,2)*_q(n1+n7,2)*_q(n4+n6+n8,3)
-		+ k2*_q(n2,1)*_q(n3+n5,2)*_q(n1+n7,2)*_q(n4+n6+n8,3)
-		- k4*_q(n2+n3+n5,3)*_q(n1+n7,2)*_q(n4+n6+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n2+n7,2)*_q(n4+n6+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n5,1)*_q(n2+n7,2)*_q(n4+n6+n8,3)
-		+ k2*_q(n3,1)*_q(n1+n5,2)*_q(n2+n7,2)*_q(n4+n6+n8,3)
-		+ k2*_q(n1,1)*_q(n3+n5,2)*_q(n2+n7,2)*_q(n4+n6+n8,3)
-		- k4*_q(n1+n3+n5,3)*_q(n2+n7,2)*_q(n4+n6+n8,3)
-		+ k4*_q(n3,1)*_q(n5,1)*_q(n1+n2+n7,3)*_q(n4+n6+n8,3)
-		- k4*_q(n3+n5,2)*_q(n1+n2+n7,3)*_q(n4+n6+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n3+n7,2)*_q(n4+n6+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n5,1)*_q(n3+n7,2)*_q(n4+n6+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n5,2)*_q(n3+n7,2)*_q(n4+n6+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n5,2)*_q(n3+n7,2)*_q(n4+n6+n8,3)
-		- k4*_q(n1+n2+n5,3)*_q(n3+n7,2)*_q(n4+n6+n8,3)
-		+ k4*_q(n2,1)*_q(n5,1)*_q(n1+n3+n7,3)*_q(n4+n6+n8,3)
-		- k4*_q(n2+n5,2)*_q(n1+n3+n7,3)*_q(n4+n6+n8,3)
-		+ k4*_q(n1,1)*_q(n5,1)*_q(n2+n3+n7,3)*_q(n4+n6+n8,3)
-		- k4*_q(n1+n5,2)*_q(n2+n3+n7,3)*_q(n4+n6+n8,3)
-		- k12*_q(n5,1)*_q(n1+n2+n3+n7,4)*_q(n4+n6+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5+n7,2)*_q(n4+n6+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n3,1)*_q(n5+n7,2)*_q(n4+n6+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n3,2)*_q(n5+n7,2)*_q(n4+n6+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n3,2)*_q(n5+n7,2)*_q(n4+n6+n8,3)
-		- k4*_q(n1+n2+n3,3)*_q(n5+n7,2)*_q(n4+n6+n8,3)
-		+ k4*_q(n2,1)*_q(n3,1)*_q(n1+n5+n7,3)*_q(n4+n6+n8,3)
-		- k4*_q(n2+n3,2)*_q(n1+n5+n7,3)*_q(n4+n6+n8,3)
-		+ k4*_q(n1,1)*_q(n3,1)*_q(n2+n5+n7,3)*_q(n4+n6+n8,3)
-		- k4*_q(n1+n3,2)*_q(n2+n5+n7,3)*_q(n4+n6+n8,3)
-		- k12*_q(n3,1)*_q(n1+n2+n5+n7,4)*_q(n4+n6+n8,3)
-		+ k4*_q(n1,1)*_q(n2,1)*_q(n3+n5+n7,3)*_q(n4+n6+n8,3)
-		- k4*_q(n1+n2,2)*_q(n3+n5+n7,3)*_q(n4+n6+n8,3)
-		- k12*_q(n2,1)*_q(n1+n3+n5+n7,4)*_q(n4+n6+n8,3)
-		- k12*_q(n1,1)*_q(n2+n3+n5+n7,4)*_q(n4+n6+n8,3)
-		+ k48*_q(n1+n2+n3+n5+n7,5)*_q(n4+n6+n8,3)
-		- k6*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n7,1)*_q(n1+n4+n6+n8,4)
-		+ k6*_q(n2+n3,2)*_q(n5,1)*_q(n7,1)*_q(n1+n4+n6+n8,4)
-		+ k6*_q(n3,1)*_q(n2+n5,2)*_q(n7,1)*_q(n1+n4+n6+n8,4)
-		+ k6*_q(n2,1)*_q(n3+n5,2)*_q(n7,1)*_q(n1+n4+n6+n8,4)
-		- k12*_q(n2+n3+n5,3)*_q(n7,1)*_q(n1+n4+n6+n8,4)
-		+ k6*_q(n3,1)*_q(n5,1)*_q(n2+n7,2)*_q(n1+n4+n6+n8,4)
-		- k6*_q(n3+n5,2)*_q(n2+n7,2)*_q(n1+n4+n6+n8,4)
-		+ k6*_q(n2,1)*_q(n5,1)*_q(n3+n7,2)*_q(n1+n4+n6+n8,4)
-		- k6*_q(n2+n5,2)*_q(n3+n7,2)*_q(n1+n4+n6+n8,4)
-		- k12*_q(n5,1)*_q(n2+n3+n7,3)*_q(n1+n4+n6+n8,4)
-		+ k6*_q(n2,1)*_q(n3,1)*_q(n5+n7,2)*_q(n1+n4+n6+n8,4)
-		- k6*_q(n2+n3,2)*_q(n5+n7,2)*_q(n1+n4+n6+n8,4)
-		- k12*_q(n3,1)*_q(n2+n5+n7,3)*_q(n1+n4+n6+n8,4)
-		- k12*_q(n2,1)*_q(n3+n5+n7,3)*_q(n1+n4+n6+n8,4)
-		+ k36*_q(n2+n3+n5+n7,4)*_q(n1+n4+n6+n8,4)
-		- k6*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n7,1)*_q(n2+n4+n6+n8,4)
-		+ k6*_q(n1+n3,2)*_q(n5,1)*_q(n7,1)*_q(n2+n4+n6+n8,4)
-		+ k6*_q(n3,1)*_q(n1+n5,2)*_q(n7,1)*_q(n2+n4+n6+n8,4)
-		+ k6*_q(n1,1)*_q(n3+n5,2)*_q(n7,1)*_q(n2+n4+n6+n8,4)
-		- k12*_q(n1+n3+n5,3)*_q(n7,1)*_q(n2+n4+n6+n8,4)
-		+ k6*_q(n3,1)*_q(n5,1)*_q(n1+n7,2)*_q(n2+n4+n6+n8,4)
-		- k6*_q(n3+n5,2)*_q(n1+n7,2)*_q(n2+n4+n6+n8,4)
-		+ k6*_q(n1,1)*_q(n5,1)*_q(n3+n7,2)*_q(n2+n4+n6+n8,4)
-		- k6*_q(n1+n5,2)*_q(n3+n7,2)*_q(n2+n4+n6+n8,4)
-		- k12*_q(n5,1)*_q(n1+n3+n7,3)*_q(n2+n4+n6+n8,4)
-		+ k6*_q(n1,1)*_q(n3,1)*_q(n5+n7,2)*_q(n2+n4+n6+n8,4)
-		- k6*_q(n1+n3,2)*_q(n5+n7,2)*_q(n2+n4+n6+n8,4)
-		- k12*_q(n3,1)*_q(n1+n5+n7,3)*_q(n2+n4+n6+n8,4)
-		- k12*_q(n1,1)*_q(n3+n5+n7,3)*_q(n2+n4+n6+n8,4)
-		+ k36*_q(n1+n3+n5+n7,4)*_q(n2+n4+n6+n8,4)
-		+ k24*_q(n3,1)*_q(n5,1)*_q(n7,1)*_q(n1+n2+n4+n6+n8,5)
-		- k24*_q(n3+n5,2)*_q(n7,1)*_q(n1+n2+n4+n6+n8,5)
-		- k24*_q(n5,1)*_q(n3+n7,2)*_q(n1+n2+n4+n6+n8,5)
-		- k24*_q(n3,1)*_q(n5+n7,2)*_q(n1+n2+n4+n6+n8,5)
-		+ k48*_q(n3+n5+n7,3)*_q(n1+n2+n4+n6+n8,5)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n7,1)*_q(n3+n4+n6+n8,4)
-		+ k6*_q(n1+n2,2)*_q(n5,1)*_q(n7,1)*_q(n3+n4+n6+n8,4)
-		+ k6*_q(n2,1)*_q(n1+n5,2)*_q(n7,1)*_q(n3+n4+n6+n8,4)
-		+ k6*_q(n1,1)*_q(n2+n5,2)*_q(n7,1)*_q(n3+n4+n6+n8,4)
-		- k12*_q(n1+n2+n5,3)*_q(n7,1)*_q(n3+n4+n6+n8,4)
-		+ k6*_q(n2,1)*_q(n5,1)*_q(n1+n7,2)*_q(n3+n4+n6+n8,4)
-		- k6*_q(n2+n5,2)*_q(n1+n7,2)*_q(n3+n4+n6+n8,4)
-		+ k6*_q(n1,1)*_q(n5,1)*_q(n2+n7,2)*_q(n3+n4+n6+n8,4)
-		- k6*_q(n1+n5,2)*_q(n2+n7,2)*_q(n3+n4+n6+n8,4)
-		- k12*_q(n5,1)*_q(n1+n2+n7,3)*_q(n3+n4+n6+n8,4)
-		+ k6*_q(n1,1)*_q(n2,1)*_q(n5+n7,2)*_q(n3+n4+n6+n8,4)
-		- k6*_q(n1+n2,2)*_q(n5+n7,2)*_q(n3+n4+n6+n8,4)
-		- k12*_q(n2,1)*_q(n1+n5+n7,3)*_q(n3+n4+n6+n8,4)
-		- k12*_q(n1,1)*_q(n2+n5+n7,3)*_q(n3+n4+n6+n8,4)
-		+ k36*_q(n1+n2+n5+n7,4)*_q(n3+n4+n6+n8,4)
-		+ k24*_q(n2,1)*_q(n5,1)*_q(n7,1)*_q(n1+n3+n4+n6+n8,5)
-		- k24*_q(n2+n5,2)*_q(n7,1)*_q(n1+n3+n4+n6+n8,5)
-		- k24*_q(n5,1)*_q(n2+n7,2)*_q(n1+n3+n4+n6+n8,5)
-		- k24*_q(n2,1)*_q(n5+n7,2)*_q(n1+n3+n4+n6+n8,5)
-		+ k48*_q(n2+n5+n7,3)*_q(n1+n3+n4+n6+n8,5)
-		+ k24*_q(n1,1)*_q(n5,1)*_q(n7,1)*_q(n2+n3+n4+n6+n8,5)
-		- k24*_q(n1+n5,2)*_q(n7,1)*_q(n2+n3+n4+n6+n8,5)
-		- k24*_q(n5,1)*_q(n1+n7,2)*_q(n2+n3+n4+n6+n8,5)
-		- k24*_q(n1,1)*_q(n5+n7,2)*_q(n2+n3+n4+n6+n8,5)
-		+ k48*_q(n1+n5+n7,3)*_q(n2+n3+n4+n6+n8,5)
-		- k120*_q(n5,1)*_q(n7,1)*_q(n1+n2+n3+n4+n6+n8,6)
-		+ k120*_q(n5+n7,2)*_q(n1+n2+n3+n4+n6+n8,6)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n7,1)*_q(n5+n6+n8,3)
-		- k2*_q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n7,1)*_q(n5+n6+n8,3)
-		- k2*_q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n7,1)*_q(n5+n6+n8,3)
-		- k2*_q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n7,1)*_q(n5+n6+n8,3)
-		+ k4*_q(n1+n2+n3,3)*_q(n4,1)*_q(n7,1)*_q(n5+n6+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n7,1)*_q(n5+n6+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n1+n4,2)*_q(n7,1)*_q(n5+n6+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n7,1)*_q(n5+n6+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n2+n4,2)*_q(n7,1)*_q(n5+n6+n8,3)
-		+ k4*_q(n3,1)*_q(n1+n2+n4,3)*_q(n7,1)*_q(n5+n6+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n7,1)*_q(n5+n6+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n3+n4,2)*_q(n7,1)*_q(n5+n6+n8,3)
-		+ k4*_q(n2,1)*_q(n1+n3+n4,3)*_q(n7,1)*_q(n5+n6+n8,3)
-		+ k4*_q(n1,1)*_q(n2+n3+n4,3)*_q(n7,1)*_q(n5+n6+n8,3)
-		- k12*_q(n1+n2+n3+n4,4)*_q(n7,1)*_q(n5+n6+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n7,2)*_q(n5+n6+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n4,1)*_q(n1+n7,2)*_q(n5+n6+n8,3)
-		+ k2*_q(n3,1)*_q(n2+n4,2)*_q(n1+n7,2)*_q(n5+n6+n8,3)
-		+ k2*_q(n2,1)*_q(n3+n4,2)*_q(n1+n7,2)*_q(n5+n6+n8,3)
-		- k4*_q(n2+n3+n4,3)*_q(n1+n7,2)*_q(n5+n6+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n7,2)*_q(n5+n6+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n4,1)*_q(n2+n7,2)*_q(n5+n6+n8,3)
-		+ k2*_q(n3,1)*_q(n1+n4,2)*_q(n2+n7,2)*_q(n5+n6+n8,3)
-		+ k2*_q(n1,1)*_q(n3+n4,2)*_q(n2+n7,2)*_q(n5+n6+n8,3)
-		- k4*_q(n1+n3+n4,3)*_q(n2+n7,2)*_q(n5+n6+n8,3)
-		+ k4*_q(n3,1)*_q(n4,1)*_q(n1+n2+n7,3)*_q(n5+n6+n8,3)
-		- k4*_q(n3+n4,2)*_q(n1+n2+n7,3)*_q(n5+n6+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n7,2)*_q(n5+n6+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n4,1)*_q(n3+n7,2)*_q(n5+n6+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n4,2)*_q(n3+n7,2)*_q(n5+n6+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n4,2)*_q(n3+n7,2)*_q(n5+n6+n8,3)
-		- k4*_q(n1+n2+n4,3)*_q(n3+n7,2)*_q(n5+n6+n8,3)
-		+ k4*_q(n2,1)*_q(n4,1)*_q(n1+n3+n7,3)*_q(n5+n6+n8,3)
-		- k4*_q(n2+n4,2)*_q(n1+n3+n7,3)*_q(n5+n6+n8,3)
-		+ k4*_q(n1,1)*_q(n4,1)*_q(n2+n3+n7,3)*_q(n5+n6+n8,3)
-		- k4*_q(n1+n4,2)*_q(n2+n3+n7,3)*_q(n5+n6+n8,3)
-		- k12*_q(n4,1)*_q(n1+n2+n3+n7,4)*_q(n5+n6+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n7,2)*_q(n5+n6+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n3,1)*_q(n4+n7,2)*_q(n5+n6+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n3,2)*_q(n4+n7,2)*_q(n5+n6+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n3,2)*_q(n4+n7,2)*_q(n5+n6+n8,3)
-		- k4*_q(n1+n2+n3,3)*_q(n4+n7,2)*_q(n5+n6+n8,3)
-		+ k4*_q(n2,1)*_q(n3,1)*_q(n1+n4+n7,3)*_q(n5+n6+n8,3)
-		- k4*_q(n2+n3,2)*_q(n1+n4+n7,3)*_q(n5+n6+n8,3)
-		+ k4*_q(n1,1)*_q(n3,1)*_q(n2+n4+n7,3)*_q(n5+n6+n8,3)
-		- k4*_q(n1+n3,2)*_q(n2+n4+n7,3)*_q(n5+n6+n8,3)
-		- k12*_q(n3,1)*_q(n1+n2+n4+n7,4)*_q(n5+n6+n8,3)
-		+ k4*_q(n1,1)*_q(n2,1)*_q(n3+n4+n7,3)*_q(n5+n6+n8,3)
-		- k4*_q(n1+n2,2)*_q(n3+n4+n7,3)*_q(n5+n6+n8,3)
-		- k12*_q(n2,1)*_q(n1+n3+n4+n7,4)*_q(n5+n6+n8,3)
-		- k12*_q(n1,1)*_q(n2+n3+n4+n7,4)*_q(n5+n6+n8,3)
-		+ k48*_q(n1+n2+n3+n4+n7,5)*_q(n5+n6+n8,3)
-		- k6*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n7,1)*_q(n1+n5+n6+n8,4)
-		+ k6*_q(n2+n3,2)*_q(n4,1)*_q(n7,1)*_q(n1+n5+n6+n8,4)
-		+ k6*_q(n3,1)*_q(n2+n4,2)*_q(n7,1)*_q(n1+n5+n6+n8,4)
-		+ k6*_q(n2,1)*_q(n3+n4,2)*_q(n7,1)*_q(n1+n5+n6+n8,4)
-		- k12*_q(n2+n3+n4,3)*_q(n7,1)*_q(n1+n5+n6+n8,4)
-		+ k6*_q(n3,1)*_q(n4,1)*_q(n2+n7,2)*_q(n1+n5+n6+n8,4)
-		- k6*_q(n3+n4,2)*_q(n2+n7,2)*_q(n1+n5+n6+n8,4)
-		+ k6*_q(n2,1)*_q(n4,1)*_q(n3+n7,2)*_q(n1+n5+n6+n8,4)
-		- k6*_q(n2+n4,2)*_q(n3+n7,2)*_q(n1+n5+n6+n8,4)
-		- k12*_q(n4,1)*_q(n2+n3+n7,3)*_q(n1+n5+n6+n8,4)
-		+ k6*_q(n2,1)*_q(n3,1)*_q(n4+n7,2)*_q(n1+n5+n6+n8,4)
-		- k6*_q(n2+n3,2)*_q(n4+n7,2)*_q(n1+n5+n6+n8,4)
-		- k12*_q(n3,1)*_q(n2+n4+n7,3)*_q(n1+n5+n6+n8,4)
-		- k12*_q(n2,1)*_q(n3+n4+n7,3)*_q(n1+n5+n6+n8,4)
-		+ k36*_q(n2+n3+n4+n7,4)*_q(n1+n5+n6+n8,4)
-		- k6*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n7,1)*_q(n2+n5+n6+n8,4)
-		+ k6*_q(n1+n3,2)*_q(n4,1)*_q(n7,1)*_q(n2+n5+n6+n8,4)
-		+ k6*_q(n3,1)*_q(n1+n4,2)*_q(n7,1)*_q(n2+n5+n6+n8,4)
-		+ k6*_q(n1,1)*_q(n3+n4,2)*_q(n7,1)*_q(n2+n5+n6+n8,4)
-		- k12*_q(n1+n3+n4,3)*_q(n7,1)*_q(n2+n5+n6+n8,4)
-		+ k6*_q(n3,1)*_q(n4,1)*_q(n1+n7,2)*_q(n2+n5+n6+n8,4)
-		- k6*_q(n3+n4,2)*_q(n1+n7,2)*_q(n2+n5+n6+n8,4)
-		+ k6*_q(n1,1)*_q(n4,1)*_q(n3+n7,2)*_q(n2+n5+n6+n8,4)
-		- k6*_q(n1+n4,2)*_q(n3+n7,2)*_q(n2+n5+n6+n8,4)
-		- k12*_q(n4,1)*_q(n1+n3+n7,3)*_q(n2+n5+n6+n8,4)
-		+ k6*_q(n1,1)*_q(n3,1)*_q(n4+n7,2)*_q(n2+n5+n6+n8,4)
-		- k6*_q(n1+n3,2)*_q(n4+n7,2)*_q(n2+n5+n6+n8,4)
-		- k12*_q(n3,1)*_q(n1+n4+n7,3)*_q(n2+n5+n6+n8,4)
-		- k12*_q(n1,1)*_q(n3+n4+n7,3)*_q(n2+n5+n6+n8,4)
-		+ k36*_q(n1+n3+n4+n7,4)*_q(n2+n5+n6+n8,4)
-		+ k24*_q(n3,1)*_q(n4,1)*_q(n7,1)*_q(n1+n2+n5+n6+n8,5)
-		- k24*_q(n3+n4,2)*_q(n7,1)*_q(n1+n2+n5+n6+n8,5)
-		- k24*_q(n4,1)*_q(n3+n7,2)*_q(n1+n2+n5+n6+n8,5)
-		- k24*_q(n3,1)*_q(n4+n7,2)*_q(n1+n2+n5+n6+n8,5)
-		+ k48*_q(n3+n4+n7,3)*_q(n1+n2+n5+n6+n8,5)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n7,1)*_q(n3+n5+n6+n8,4)
-		+ k6*_q(n1+n2,2)*_q(n4,1)*_q(n7,1)*_q(n3+n5+n6+n8,4)
-		+ k6*_q(n2,1)*_q(n1+n4,2)*_q(n7,1)*_q(n3+n5+n6+n8,4)
-		+ k6*_q(n1,1)*_q(n2+n4,2)*_q(n7,1)*_q(n3+n5+n6+n8,4)
-		- k12*_q(n1+n2+n4,3)*_q(n7,1)*_q(n3+n5+n6+n8,4)
-		+ k6*_q(n2,1)*_q(n4,1)*_q(n1+n7,2)*_q(n3+n5+n6+n8,4)
-		- k6*_q(n2+n4,2)*_q(n1+n7,2)*_q(n3+n5+n6+n8,4)
-		+ k6*_q(n1,1)*_q(n4,1)*_q(n2+n7,2)*_q(n3+n5+n6+n8,4)
-		- k6*_q(n1+n4,2)*_q(n2+n7,2)*_q(n3+n5+n6+n8,4)
-		- k12*_q(n4,1)*_q(n1+n2+n7,3)*_q(n3+n5+n6+n8,4)
-		+ k6*_q(n1,1)*_q(n2,1)*_q(n4+n7,2)*_q(n3+n5+n6+n8,4)
-		- k6*_q(n1+n2,2)*_q(n4+n7,2)*_q(n3+n5+n6+n8,4)
-		- k12*_q(n2,1)*_q(n1+n4+n7,3)*_q(n3+n5+n6+n8,4)
-		- k12*_q(n1,1)*_q(n2+n4+n7,3)*_q(n3+n5+n6+n8,4)
-		+ k36*_q(n1+n2+n4+n7,4)*_q(n3+n5+n6+n8,4)
-		+ k24*_q(n2,1)*_q(n4,1)*_q(n7,1)*_q(n1+n3+n5+n6+n8,5)
-		- k24*_q(n2+n4,2)*_q(n7,1)*_q(n1+n3+n5+n6+n8,5)
-		- k24*_q(n4,1)*_q(n2+n7,2)*_q(n1+n3+n5+n6+n8,5)
-		- k24*_q(n2,1)*_q(n4+n7,2)*_q(n1+n3+n5+n6+n8,5)
-		+ k48*_q(n2+n4+n7,3)*_q(n1+n3+n5+n6+n8,5)
-		+ k24*_q(n1,1)*_q(n4,1)*_q(n7,1)*_q(n2+n3+n5+n6+n8,5)
-		- k24*_q(n1+n4,2)*_q(n7,1)*_q(n2+n3+n5+n6+n8,5)
-		- k24*_q(n4,1)*_q(n1+n7,2)*_q(n2+n3+n5+n6+n8,5)
-		- k24*_q(n1,1)*_q(n4+n7,2)*_q(n2+n3+n5+n6+n8,5)
-		+ k48*_q(n1+n4+n7,3)*_q(n2+n3+n5+n6+n8,5)
-		- k120*_q(n4,1)*_q(n7,1)*_q(n1+n2+n3+n5+n6+n8,6)
-		+ k120*_q(n4+n7,2)*_q(n1+n2+n3+n5+n6+n8,6)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n7,1)*_q(n4+n5+n6+n8,4)
-		+ k6*_q(n1+n2,2)*_q(n3,1)*_q(n7,1)*_q(n4+n5+n6+n8,4)
-		+ k6*_q(n2,1)*_q(n1+n3,2)*_q(n7,1)*_q(n4+n5+n6+n8,4)
-		+ k6*_q(n1,1)*_q(n2+n3,2)*_q(n7,1)*_q(n4+n5+n6+n8,4)
-		- k12*_q(n1+n2+n3,3)*_q(n7,1)*_q(n4+n5+n6+n8,4)
-		+ k6*_q(n2,1)*_q(n3,1)*_q(n1+n7,2)*_q(n4+n5+n6+n8,4)
-		- k6*_q(n2+n3,2)*_q(n1+n7,2)*_q(n4+n5+n6+n8,4)
-		+ k6*_q(n1,1)*_q(n3,1)*_q(n2+n7,2)*_q(n4+n5+n6+n8,4)
-		- k6*_q(n1+n3,2)*_q(n2+n7,2)*_q(n4+n5+n6+n8,4)
-		- k12*_q(n3,1)*_q(n1+n2+n7,3)*_q(n4+n5+n6+n8,4)
-		+ k6*_q(n1,1)*_q(n2,1)*_q(n3+n7,2)*_q(n4+n5+n6+n8,4)
-		- k6*_q(n1+n2,2)*_q(n3+n7,2)*_q(n4+n5+n6+n8,4)
-		- k12*_q(n2,1)*_q(n1+n3+n7,3)*_q(n4+n5+n6+n8,4)
-		- k12*_q(n1,1)*_q(n2+n3+n7,3)*_q(n4+n5+n6+n8,4)
-		+ k36*_q(n1+n2+n3+n7,4)*_q(n4+n5+n6+n8,4)
-		+ k24*_q(n2,1)*_q(n3,1)*_q(n7,1)*_q(n1+n4+n5+n6+n8,5)
-		- k24*_q(n2+n3,2)*_q(n7,1)*_q(n1+n4+n5+n6+n8,5)
-		- k24*_q(n3,1)*_q(n2+n7,2)*_q(n1+n4+n5+n6+n8,5)
-		- k24*_q(n2,1)*_q(n3+n7,2)*_q(n1+n4+n5+n6+n8,5)
-		+ k48*_q(n2+n3+n7,3)*_q(n1+n4+n5+n6+n8,5)
-		+ k24*_q(n1,1)*_q(n3,1)*_q(n7,1)*_q(n2+n4+n5+n6+n8,5)
-		- k24*_q(n1+n3,2)*_q(n7,1)*_q(n2+n4+n5+n6+n8,5)
-		- k24*_q(n3,1)*_q(n1+n7,2)*_q(n2+n4+n5+n6+n8,5)
-		- k24*_q(n1,1)*_q(n3+n7,2)*_q(n2+n4+n5+n6+n8,5)
-		+ k48*_q(n1+n3+n7,3)*_q(n2+n4+n5+n6+n8,5)
-		- k120*_q(n3,1)*_q(n7,1)*_q(n1+n2+n4+n5+n6+n8,6)
-		+ k120*_q(n3+n7,2)*_q(n1+n2+n4+n5+n6+n8,6)
-		+ k24*_q(n1,1)*_q(n2,1)*_q(n7,1)*_q(n3+n4+n5+n6+n8,5)
-		- k24*_q(n1+n2,2)*_q(n7,1)*_q(n3+n4+n5+n6+n8,5)
-		- k24*_q(n2,1)*_q(n1+n7,2)*_q(n3+n4+n5+n6+n8,5)
-		- k24*_q(n1,1)*_q(n2+n7,2)*_q(n3+n4+n5+n6+n8,5)
-		+ k48*_q(n1+n2+n7,3)*_q(n3+n4+n5+n6+n8,5)
-		- k120*_q(n2,1)*_q(n7,1)*_q(n1+n3+n4+n5+n6+n8,6)
-		+ k120*_q(n2+n7,2)*_q(n1+n3+n4+n5+n6+n8,6)
-		- k120*_q(n1,1)*_q(n7,1)*_q(n2+n3+n4+n5+n6+n8,6)
-		+ k120*_q(n1+n7,2)*_q(n2+n3+n4+n5+n6+n8,6)
-		+ k720*_q(n7,1)*_q(n1+n2+n3+n4+n5+n6+n8,7)
-		- _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7+n8,2)
-		+ _q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7+n8,2)
-		+ _q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7+n8,2)
-		+ _q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7+n8,2)
-		- k2*_q(n1+n2+n3,3)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n7+n8,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7+n8,2)
-		- _q(n2+n3,2)*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7+n8,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7+n8,2)
-		- _q(n1+n3,2)*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7+n8,2)
-		- k2*_q(n3,1)*_q(n1+n2+n4,3)*_q(n5,1)*_q(n6,1)*_q(n7+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7+n8,2)
-		- _q(n1+n2,2)*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n7+n8,2)
-		- k2*_q(n2,1)*_q(n1+n3+n4,3)*_q(n5,1)*_q(n6,1)*_q(n7+n8,2)
-		- k2*_q(n1,1)*_q(n2+n3+n4,3)*_q(n5,1)*_q(n6,1)*_q(n7+n8,2)
-		+ k6*_q(n1+n2+n3+n4,4)*_q(n5,1)*_q(n6,1)*_q(n7+n8,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		- _q(n2+n3,2)*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		- _q(n3,1)*_q(n2+n4,2)*_q(n1+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		- _q(n2,1)*_q(n3+n4,2)*_q(n1+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		+ k2*_q(n2+n3+n4,3)*_q(n1+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		- _q(n1+n3,2)*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		- _q(n3,1)*_q(n1+n4,2)*_q(n2+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		- _q(n1,1)*_q(n3+n4,2)*_q(n2+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		+ k2*_q(n1+n3+n4,3)*_q(n2+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n1+n2+n5,3)*_q(n6,1)*_q(n7+n8,2)
-		+ k2*_q(n3+n4,2)*_q(n1+n2+n5,3)*_q(n6,1)*_q(n7+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		- _q(n1+n2,2)*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		- _q(n2,1)*_q(n1+n4,2)*_q(n3+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		- _q(n1,1)*_q(n2+n4,2)*_q(n3+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		+ k2*_q(n1+n2+n4,3)*_q(n3+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n1+n3+n5,3)*_q(n6,1)*_q(n7+n8,2)
-		+ k2*_q(n2+n4,2)*_q(n1+n3+n5,3)*_q(n6,1)*_q(n7+n8,2)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n2+n3+n5,3)*_q(n6,1)*_q(n7+n8,2)
-		+ k2*_q(n1+n4,2)*_q(n2+n3+n5,3)*_q(n6,1)*_q(n7+n8,2)
-		+ k6*_q(n4,1)*_q(n1+n2+n3+n5,4)*_q(n6,1)*_q(n7+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n4+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n4+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		+ k2*_q(n1+n2+n3,3)*_q(n4+n5,2)*_q(n6,1)*_q(n7+n8,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n4+n5,3)*_q(n6,1)*_q(n7+n8,2)
-		+ k2*_q(n2+n3,2)*_q(n1+n4+n5,3)*_q(n6,1)*_q(n7+n8,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n4+n5,3)*_q(n6,1)*_q(n7+n8,2)
-		+ k2*_q(n1+n3,2)*_q(n2+n4+n5,3)*_q(n6,1)*_q(n7+n8,2)
-		+ k6*_q(n3,1)*_q(n1+n2+n4+n5,4)*_q(n6,1)*_q(n7+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n4+n5,3)*_q(n6,1)*_q(n7+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n3+n4+n5,3)*_q(n6,1)*_q(n7+n8,2)
-		+ k6*_q(n2,1)*_q(n1+n3+n4+n5,4)*_q(n6,1)*_q(n7+n8,2)
-		+ k6*_q(n1,1)*_q(n2+n3+n4+n5,4)*_q(n6,1)*_q(n7+n8,2)
-		- k24*_q(n1+n2+n3+n4+n5,5)*_q(n6,1)*_q(n7+n8,2)
-		+ _q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n7+n8,2)
-		- _q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n7+n8,2)
-		- _q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n1+n6,2)*_q(n7+n8,2)
-		- _q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n1+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n2+n3+n4,3)*_q(n5,1)*_q(n1+n6,2)*_q(n7+n8,2)
-		- _q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n1+n6,2)*_q(n7+n8,2)
-		+ _q(n3+n4,2)*_q(n2+n5,2)*_q(n1+n6,2)*_q(n7+n8,2)
-		- _q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n1+n6,2)*_q(n7+n8,2)
-		+ _q(n2+n4,2)*_q(n3+n5,2)*_q(n1+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n4,1)*_q(n2+n3+n5,3)*_q(n1+n6,2)*_q(n7+n8,2)
-		- _q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n1+n6,2)*_q(n7+n8,2)
-		+ _q(n2+n3,2)*_q(n4+n5,2)*_q(n1+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n3,1)*_q(n2+n4+n5,3)*_q(n1+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n2,1)*_q(n3+n4+n5,3)*_q(n1+n6,2)*_q(n7+n8,2)
-		- k6*_q(n2+n3+n4+n5,4)*_q(n1+n6,2)*_q(n7+n8,2)
-		+ _q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n7+n8,2)
-		- _q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n7+n8,2)
-		- _q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n2+n6,2)*_q(n7+n8,2)
-		- _q(n1,1)*_q(n3+n4,2)*_q(n5,1)*_q(n2+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n1+n3+n4,3)*_q(n5,1)*_q(n2+n6,2)*_q(n7+n8,2)
-		- _q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n2+n6,2)*_q(n7+n8,2)
-		+ _q(n3+n4,2)*_q(n1+n5,2)*_q(n2+n6,2)*_q(n7+n8,2)
-		- _q(n1,1)*_q(n4,1)*_q(n3+n5,2)*_q(n2+n6,2)*_q(n7+n8,2)
-		+ _q(n1+n4,2)*_q(n3+n5,2)*_q(n2+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n4,1)*_q(n1+n3+n5,3)*_q(n2+n6,2)*_q(n7+n8,2)
-		- _q(n1,1)*_q(n3,1)*_q(n4+n5,2)*_q(n2+n6,2)*_q(n7+n8,2)
-		+ _q(n1+n3,2)*_q(n4+n5,2)*_q(n2+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n4+n5,3)*_q(n2+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n1,1)*_q(n3+n4+n5,3)*_q(n2+n6,2)*_q(n7+n8,2)
-		- k6*_q(n1+n3+n4+n5,4)*_q(n2+n6,2)*_q(n7+n8,2)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n2+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n3+n4,2)*_q(n5,1)*_q(n1+n2+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n4,1)*_q(n3+n5,2)*_q(n1+n2+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n3,1)*_q(n4+n5,2)*_q(n1+n2+n6,3)*_q(n7+n8,2)
-		- k4*_q(n3+n4+n5,3)*_q(n1+n2+n6,3)*_q(n7+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n7+n8,2)
-		- _q(n1+n2,2)*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n7+n8,2)
-		- _q(n2,1)*_q(n1+n4,2)*_q(n5,1)*_q(n3+n6,2)*_q(n7+n8,2)
-		- _q(n1,1)*_q(n2+n4,2)*_q(n5,1)*_q(n3+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n1+n2+n4,3)*_q(n5,1)*_q(n3+n6,2)*_q(n7+n8,2)
-		- _q(n2,1)*_q(n4,1)*_q(n1+n5,2)*_q(n3+n6,2)*_q(n7+n8,2)
-		+ _q(n2+n4,2)*_q(n1+n5,2)*_q(n3+n6,2)*_q(n7+n8,2)
-		- _q(n1,1)*_q(n4,1)*_q(n2+n5,2)*_q(n3+n6,2)*_q(n7+n8,2)
-		+ _q(n1+n4,2)*_q(n2+n5,2)*_q(n3+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n4,1)*_q(n1+n2+n5,3)*_q(n3+n6,2)*_q(n7+n8,2)
-		- _q(n1,1)*_q(n2,1)*_q(n4+n5,2)*_q(n3+n6,2)*_q(n7+n8,2)
-		+ _q(n1+n2,2)*_q(n4+n5,2)*_q(n3+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n4+n5,3)*_q(n3+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n4+n5,3)*_q(n3+n6,2)*_q(n7+n8,2)
-		- k6*_q(n1+n2+n4+n5,4)*_q(n3+n6,2)*_q(n7+n8,2)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n1+n3+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n2+n4,2)*_q(n5,1)*_q(n1+n3+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n4,1)*_q(n2+n5,2)*_q(n1+n3+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n2,1)*_q(n4+n5,2)*_q(n1+n3+n6,3)*_q(n7+n8,2)
-		- k4*_q(n2+n4+n5,3)*_q(n1+n3+n6,3)*_q(n7+n8,2)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n2+n3+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n1+n4,2)*_q(n5,1)*_q(n2+n3+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n4,1)*_q(n1+n5,2)*_q(n2+n3+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n1,1)*_q(n4+n5,2)*_q(n2+n3+n6,3)*_q(n7+n8,2)
-		- k4*_q(n1+n4+n5,3)*_q(n2+n3+n6,3)*_q(n7+n8,2)
-		+ k6*_q(n4,1)*_q(n5,1)*_q(n1+n2+n3+n6,4)*_q(n7+n8,2)
-		- k6*_q(n4+n5,2)*_q(n1+n2+n3+n6,4)*_q(n7+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n7+n8,2)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n7+n8,2)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n5,1)*_q(n4+n6,2)*_q(n7+n8,2)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n5,1)*_q(n4+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n1+n2+n3,3)*_q(n5,1)*_q(n4+n6,2)*_q(n7+n8,2)
-		- _q(n2,1)*_q(n3,1)*_q(n1+n5,2)*_q(n4+n6,2)*_q(n7+n8,2)
-		+ _q(n2+n3,2)*_q(n1+n5,2)*_q(n4+n6,2)*_q(n7+n8,2)
-		- _q(n1,1)*_q(n3,1)*_q(n2+n5,2)*_q(n4+n6,2)*_q(n7+n8,2)
-		+ _q(n1+n3,2)*_q(n2+n5,2)*_q(n4+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n2+n5,3)*_q(n4+n6,2)*_q(n7+n8,2)
-		- _q(n1,1)*_q(n2,1)*_q(n3+n5,2)*_q(n4+n6,2)*_q(n7+n8,2)
-		+ _q(n1+n2,2)*_q(n3+n5,2)*_q(n4+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n3+n5,3)*_q(n4+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n3+n5,3)*_q(n4+n6,2)*_q(n7+n8,2)
-		- k6*_q(n1+n2+n3+n5,4)*_q(n4+n6,2)*_q(n7+n8,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n1+n4+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n2+n3,2)*_q(n5,1)*_q(n1+n4+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n3,1)*_q(n2+n5,2)*_q(n1+n4+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n2,1)*_q(n3+n5,2)*_q(n1+n4+n6,3)*_q(n7+n8,2)
-		- k4*_q(n2+n3+n5,3)*_q(n1+n4+n6,3)*_q(n7+n8,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n2+n4+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n1+n3,2)*_q(n5,1)*_q(n2+n4+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n5,2)*_q(n2+n4+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n1,1)*_q(n3+n5,2)*_q(n2+n4+n6,3)*_q(n7+n8,2)
-		- k4*_q(n1+n3+n5,3)*_q(n2+n4+n6,3)*_q(n7+n8,2)
-		+ k6*_q(n3,1)*_q(n5,1)*_q(n1+n2+n4+n6,4)*_q(n7+n8,2)
-		- k6*_q(n3+n5,2)*_q(n1+n2+n4+n6,4)*_q(n7+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n3+n4+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n5,1)*_q(n3+n4+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n5,2)*_q(n3+n4+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n5,2)*_q(n3+n4+n6,3)*_q(n7+n8,2)
-		- k4*_q(n1+n2+n5,3)*_q(n3+n4+n6,3)*_q(n7+n8,2)
-		+ k6*_q(n2,1)*_q(n5,1)*_q(n1+n3+n4+n6,4)*_q(n7+n8,2)
-		- k6*_q(n2+n5,2)*_q(n1+n3+n4+n6,4)*_q(n7+n8,2)
-		+ k6*_q(n1,1)*_q(n5,1)*_q(n2+n3+n4+n6,4)*_q(n7+n8,2)
-		- k6*_q(n1+n5,2)*_q(n2+n3+n4+n6,4)*_q(n7+n8,2)
-		- k24*_q(n5,1)*_q(n1+n2+n3+n4+n6,5)*_q(n7+n8,2)
-		+ _q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n7+n8,2)
-		- _q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n7+n8,2)
-		- _q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n5+n6,2)*_q(n7+n8,2)
-		- _q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n5+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n1+n2+n3,3)*_q(n4,1)*_q(n5+n6,2)*_q(n7+n8,2)
-		- _q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n5+n6,2)*_q(n7+n8,2)
-		+ _q(n2+n3,2)*_q(n1+n4,2)*_q(n5+n6,2)*_q(n7+n8,2)
-		- _q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n5+n6,2)*_q(n7+n8,2)
-		+ _q(n1+n3,2)*_q(n2+n4,2)*_q(n5+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n2+n4,3)*_q(n5+n6,2)*_q(n7+n8,2)
-		- _q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n5+n6,2)*_q(n7+n8,2)
-		+ _q(n1+n2,2)*_q(n3+n4,2)*_q(n5+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n3+n4,3)*_q(n5+n6,2)*_q(n7+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n3+n4,3)*_q(n5+n6,2)*_q(n7+n8,2)
-		- k6*_q(n1+n2+n3+n4,4)*_q(n5+n6,2)*_q(n7+n8,2)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n5+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n2+n3,2)*_q(n4,1)*_q(n1+n5+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n3,1)*_q(n2+n4,2)*_q(n1+n5+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n2,1)*_q(n3+n4,2)*_q(n1+n5+n6,3)*_q(n7+n8,2)
-		- k4*_q(n2+n3+n4,3)*_q(n1+n5+n6,3)*_q(n7+n8,2)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n5+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n1+n3,2)*_q(n4,1)*_q(n2+n5+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n3,1)*_q(n1+n4,2)*_q(n2+n5+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n1,1)*_q(n3+n4,2)*_q(n2+n5+n6,3)*_q(n7+n8,2)
-		- k4*_q(n1+n3+n4,3)*_q(n2+n5+n6,3)*_q(n7+n8,2)
-		+ k6*_q(n3,1)*_q(n4,1)*_q(n1+n2+n5+n6,4)*_q(n7+n8,2)
-		- k6*_q(n3+n4,2)*_q(n1+n2+n5+n6,4)*_q(n7+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n5+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n4,1)*_q(n3+n5+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n4,2)*_q(n3+n5+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n4,2)*_q(n3+n5+n6,3)*_q(n7+n8,2)
-		- k4*_q(n1+n2+n4,3)*_q(n3+n5+n6,3)*_q(n7+n8,2)
-		+ k6*_q(n2,1)*_q(n4,1)*_q(n1+n3+n5+n6,4)*_q(n7+n8,2)
-		- k6*_q(n2+n4,2)*_q(n1+n3+n5+n6,4)*_q(n7+n8,2)
-		+ k6*_q(n1,1)*_q(n4,1)*_q(n2+n3+n5+n6,4)*_q(n7+n8,2)
-		- k6*_q(n1+n4,2)*_q(n2+n3+n5+n6,4)*_q(n7+n8,2)
-		- k24*_q(n4,1)*_q(n1+n2+n3+n5+n6,5)*_q(n7+n8,2)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n5+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n1+n2,2)*_q(n3,1)*_q(n4+n5+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n2,1)*_q(n1+n3,2)*_q(n4+n5+n6,3)*_q(n7+n8,2)
-		+ k2*_q(n1,1)*_q(n2+n3,2)*_q(n4+n5+n6,3)*_q(n7+n8,2)
-		- k4*_q(n1+n2+n3,3)*_q(n4+n5+n6,3)*_q(n7+n8,2)
-		+ k6*_q(n2,1)*_q(n3,1)*_q(n1+n4+n5+n6,4)*_q(n7+n8,2)
-		- k6*_q(n2+n3,2)*_q(n1+n4+n5+n6,4)*_q(n7+n8,2)
-		+ k6*_q(n1,1)*_q(n3,1)*_q(n2+n4+n5+n6,4)*_q(n7+n8,2)
-		- k6*_q(n1+n3,2)*_q(n2+n4+n5+n6,4)*_q(n7+n8,2)
-		- k24*_q(n3,1)*_q(n1+n2+n4+n5+n6,5)*_q(n7+n8,2)
-		+ k6*_q(n1,1)*_q(n2,1)*_q(n3+n4+n5+n6,4)*_q(n7+n8,2)
-		- k6*_q(n1+n2,2)*_q(n3+n4+n5+n6,4)*_q(n7+n8,2)
-		- k24*_q(n2,1)*_q(n1+n3+n4+n5+n6,5)*_q(n7+n8,2)
-		- k24*_q(n1,1)*_q(n2+n3+n4+n5+n6,5)*_q(n7+n8,2)
-		+ k120*_q(n1+n2+n3+n4+n5+n6,6)*_q(n7+n8,2)
-		+ k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n7+n8,3)
-		- k2*_q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n7+n8,3)
-		- k2*_q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n1+n7+n8,3)
-		- k2*_q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n1+n7+n8,3)
-		+ k4*_q(n2+n3+n4,3)*_q(n5,1)*_q(n6,1)*_q(n1+n7+n8,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n1+n7+n8,3)
-		+ k2*_q(n3+n4,2)*_q(n2+n5,2)*_q(n6,1)*_q(n1+n7+n8,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n1+n7+n8,3)
-		+ k2*_q(n2+n4,2)*_q(n3+n5,2)*_q(n6,1)*_q(n1+n7+n8,3)
-		+ k4*_q(n4,1)*_q(n2+n3+n5,3)*_q(n6,1)*_q(n1+n7+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n1+n7+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n4+n5,2)*_q(n6,1)*_q(n1+n7+n8,3)
-		+ k4*_q(n3,1)*_q(n2+n4+n5,3)*_q(n6,1)*_q(n1+n7+n8,3)
-		+ k4*_q(n2,1)*_q(n3+n4+n5,3)*_q(n6,1)*_q(n1+n7+n8,3)
-		- k12*_q(n2+n3+n4+n5,4)*_q(n6,1)*_q(n1+n7+n8,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n1+n7+n8,3)
-		+ k2*_q(n3+n4,2)*_q(n5,1)*_q(n2+n6,2)*_q(n1+n7+n8,3)
-		+ k2*_q(n4,1)*_q(n3+n5,2)*_q(n2+n6,2)*_q(n1+n7+n8,3)
-		+ k2*_q(n3,1)*_q(n4+n5,2)*_q(n2+n6,2)*_q(n1+n7+n8,3)
-		- k4*_q(n3+n4+n5,3)*_q(n2+n6,2)*_q(n1+n7+n8,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n1+n7+n8,3)
-		+ k2*_q(n2+n4,2)*_q(n5,1)*_q(n3+n6,2)*_q(n1+n7+n8,3)
-		+ k2*_q(n4,1)*_q(n2+n5,2)*_q(n3+n6,2)*_q(n1+n7+n8,3)
-		+ k2*_q(n2,1)*_q(n4+n5,2)*_q(n3+n6,2)*_q(n1+n7+n8,3)
-		- k4*_q(n2+n4+n5,3)*_q(n3+n6,2)*_q(n1+n7+n8,3)
-		+ k4*_q(n4,1)*_q(n5,1)*_q(n2+n3+n6,3)*_q(n1+n7+n8,3)
-                - k4*_q(n4+n5,2)*_q(n2+n3+n6,3)*_q(n1+n7+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n1+n7+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n5,1)*_q(n4+n6,2)*_q(n1+n7+n8,3)
-		+ k2*_q(n3,1)*_q(n2+n5,2)*_q(n4+n6,2)*_q(n1+n7+n8,3)
-		+ k2*_q(n2,1)*_q(n3+n5,2)*_q(n4+n6,2)*_q(n1+n7+n8,3)
-		- k4*_q(n2+n3+n5,3)*_q(n4+n6,2)*_q(n1+n7+n8,3)
-		+ k4*_q(n3,1)*_q(n5,1)*_q(n2+n4+n6,3)*_q(n1+n7+n8,3)
-		- k4*_q(n3+n5,2)*_q(n2+n4+n6,3)*_q(n1+n7+n8,3)
-		+ k4*_q(n2,1)*_q(n5,1)*_q(n3+n4+n6,3)*_q(n1+n7+n8,3)
-		- k4*_q(n2+n5,2)*_q(n3+n4+n6,3)*_q(n1+n7+n8,3)
-		- k12*_q(n5,1)*_q(n2+n3+n4+n6,4)*_q(n1+n7+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n1+n7+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n4,1)*_q(n5+n6,2)*_q(n1+n7+n8,3)
-		+ k2*_q(n3,1)*_q(n2+n4,2)*_q(n5+n6,2)*_q(n1+n7+n8,3)
-		+ k2*_q(n2,1)*_q(n3+n4,2)*_q(n5+n6,2)*_q(n1+n7+n8,3)
-		- k4*_q(n2+n3+n4,3)*_q(n5+n6,2)*_q(n1+n7+n8,3)
-		+ k4*_q(n3,1)*_q(n4,1)*_q(n2+n5+n6,3)*_q(n1+n7+n8,3)
-		- k4*_q(n3+n4,2)*_q(n2+n5+n6,3)*_q(n1+n7+n8,3)
-		+ k4*_q(n2,1)*_q(n4,1)*_q(n3+n5+n6,3)*_q(n1+n7+n8,3)
-		- k4*_q(n2+n4,2)*_q(n3+n5+n6,3)*_q(n1+n7+n8,3)
-		- k12*_q(n4,1)*_q(n2+n3+n5+n6,4)*_q(n1+n7+n8,3)
-		+ k4*_q(n2,1)*_q(n3,1)*_q(n4+n5+n6,3)*_q(n1+n7+n8,3)
-		- k4*_q(n2+n3,2)*_q(n4+n5+n6,3)*_q(n1+n7+n8,3)
-		- k12*_q(n3,1)*_q(n2+n4+n5+n6,4)*_q(n1+n7+n8,3)
-		- k12*_q(n2,1)*_q(n3+n4+n5+n6,4)*_q(n1+n7+n8,3)
-		+ k48*_q(n2+n3+n4+n5+n6,5)*_q(n1+n7+n8,3)
-		+ k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n2+n7+n8,3)
-		- k2*_q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n2+n7+n8,3)
-		- k2*_q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n2+n7+n8,3)
-		- k2*_q(n1,1)*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n2+n7+n8,3)
-		+ k4*_q(n1+n3+n4,3)*_q(n5,1)*_q(n6,1)*_q(n2+n7+n8,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n2+n7+n8,3)
-		+ k2*_q(n3+n4,2)*_q(n1+n5,2)*_q(n6,1)*_q(n2+n7+n8,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n2+n7+n8,3)
-		+ k2*_q(n1+n4,2)*_q(n3+n5,2)*_q(n6,1)*_q(n2+n7+n8,3)
-		+ k4*_q(n4,1)*_q(n1+n3+n5,3)*_q(n6,1)*_q(n2+n7+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n2+n7+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n4+n5,2)*_q(n6,1)*_q(n2+n7+n8,3)
-		+ k4*_q(n3,1)*_q(n1+n4+n5,3)*_q(n6,1)*_q(n2+n7+n8,3)
-		+ k4*_q(n1,1)*_q(n3+n4+n5,3)*_q(n6,1)*_q(n2+n7+n8,3)
-		- k12*_q(n1+n3+n4+n5,4)*_q(n6,1)*_q(n2+n7+n8,3)
-		- k2*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n2+n7+n8,3)
-		+ k2*_q(n3+n4,2)*_q(n5,1)*_q(n1+n6,2)*_q(n2+n7+n8,3)
-		+ k2*_q(n4,1)*_q(n3+n5,2)*_q(n1+n6,2)*_q(n2+n7+n8,3)
-		+ k2*_q(n3,1)*_q(n4+n5,2)*_q(n1+n6,2)*_q(n2+n7+n8,3)
-		- k4*_q(n3+n4+n5,3)*_q(n1+n6,2)*_q(n2+n7+n8,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n2+n7+n8,3)
-		+ k2*_q(n1+n4,2)*_q(n5,1)*_q(n3+n6,2)*_q(n2+n7+n8,3)
-		+ k2*_q(n4,1)*_q(n1+n5,2)*_q(n3+n6,2)*_q(n2+n7+n8,3)
-		+ k2*_q(n1,1)*_q(n4+n5,2)*_q(n3+n6,2)*_q(n2+n7+n8,3)
-		- k4*_q(n1+n4+n5,3)*_q(n3+n6,2)*_q(n2+n7+n8,3)
-		+ k4*_q(n4,1)*_q(n5,1)*_q(n1+n3+n6,3)*_q(n2+n7+n8,3)
-                - k4*_q(n4+n5,2)*_q(n1+n3+n6,3)*_q(n2+n7+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n2+n7+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n5,1)*_q(n4+n6,2)*_q(n2+n7+n8,3)
-		+ k2*_q(n3,1)*_q(n1+n5,2)*_q(n4+n6,2)*_q(n2+n7+n8,3)
-		+ k2*_q(n1,1)*_q(n3+n5,2)*_q(n4+n6,2)*_q(n2+n7+n8,3)
-		- k4*_q(n1+n3+n5,3)*_q(n4+n6,2)*_q(n2+n7+n8,3)
-		+ k4*_q(n3,1)*_q(n5,1)*_q(n1+n4+n6,3)*_q(n2+n7+n8,3)
-		- k4*_q(n3+n5,2)*_q(n1+n4+n6,3)*_q(n2+n7+n8,3)
-                + k4*_q(n1,1)*_q(n5,1)*_q(n3+n4+n6,3)*_q(n2+n7+n8,3)
-		- k4*_q(n1+n5,2)*_q(n3+n4+n6,3)*_q(n2+n7+n8,3)
-		- k12*_q(n5,1)*_q(n1+n3+n4+n6,4)*_q(n2+n7+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n2+n7+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n4,1)*_q(n5+n6,2)*_q(n2+n7+n8,3)
-		+ k2*_q(n3,1)*_q(n1+n4,2)*_q(n5+n6,2)*_q(n2+n7+n8,3)
-		+ k2*_q(n1,1)*_q(n3+n4,2)*_q(n5+n6,2)*_q(n2+n7+n8,3)
-		- k4*_q(n1+n3+n4,3)*_q(n5+n6,2)*_q(n2+n7+n8,3)
-		+ k4*_q(n3,1)*_q(n4,1)*_q(n1+n5+n6,3)*_q(n2+n7+n8,3)
-		- k4*_q(n3+n4,2)*_q(n1+n5+n6,3)*_q(n2+n7+n8,3)
-		+ k4*_q(n1,1)*_q(n4,1)*_q(n3+n5+n6,3)*_q(n2+n7+n8,3)
-		- k4*_q(n1+n4,2)*_q(n3+n5+n6,3)*_q(n2+n7+n8,3)
-		- k12*_q(n4,1)*_q(n1+n3+n5+n6,4)*_q(n2+n7+n8,3)
-		+ k4*_q(n1,1)*_q(n3,1)*_q(n4+n5+n6,3)*_q(n2+n7+n8,3)
-		- k4*_q(n1+n3,2)*_q(n4+n5+n6,3)*_q(n2+n7+n8,3)
-		- k12*_q(n3,1)*_q(n1+n4+n5+n6,4)*_q(n2+n7+n8,3)
-		- k12*_q(n1,1)*_q(n3+n4+n5+n6,4)*_q(n2+n7+n8,3)
-		+ k48*_q(n1+n3+n4+n5+n6,5)*_q(n2+n7+n8,3)
-		- k6*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n2+n7+n8,4)
-		+ k6*_q(n3+n4,2)*_q(n5,1)*_q(n6,1)*_q(n1+n2+n7+n8,4)
-		+ k6*_q(n4,1)*_q(n3+n5,2)*_q(n6,1)*_q(n1+n2+n7+n8,4)
-		+ k6*_q(n3,1)*_q(n4+n5,2)*_q(n6,1)*_q(n1+n2+n7+n8,4)
-		- k12*_q(n3+n4+n5,3)*_q(n6,1)*_q(n1+n2+n7+n8,4)
-		+ k6*_q(n4,1)*_q(n5,1)*_q(n3+n6,2)*_q(n1+n2+n7+n8,4)
-		- k6*_q(n4+n5,2)*_q(n3+n6,2)*_q(n1+n2+n7+n8,4)
-		+ k6*_q(n3,1)*_q(n5,1)*_q(n4+n6,2)*_q(n1+n2+n7+n8,4)
-		- k6*_q(n3+n5,2)*_q(n4+n6,2)*_q(n1+n2+n7+n8,4)
-		- k12*_q(n5,1)*_q(n3+n4+n6,3)*_q(n1+n2+n7+n8,4)
-		+ k6*_q(n3,1)*_q(n4,1)*_q(n5+n6,2)*_q(n1+n2+n7+n8,4)
-		- k6*_q(n3+n4,2)*_q(n5+n6,2)*_q(n1+n2+n7+n8,4)
-		- k12*_q(n4,1)*_q(n3+n5+n6,3)*_q(n1+n2+n7+n8,4)
-		- k12*_q(n3,1)*_q(n4+n5+n6,3)*_q(n1+n2+n7+n8,4)
-		+ k36*_q(n3+n4+n5+n6,4)*_q(n1+n2+n7+n8,4)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n3+n7+n8,3)
-                - k2*_q(n1+n2,2)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n3+n7+n8,3)
-		- k2*_q(n2,1)*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n3+n7+n8,3)
-		- k2*_q(n1,1)*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n3+n7+n8,3)
-		+ k4*_q(n1+n2+n4,3)*_q(n5,1)*_q(n6,1)*_q(n3+n7+n8,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n3+n7+n8,3)
-		+ k2*_q(n2+n4,2)*_q(n1+n5,2)*_q(n6,1)*_q(n3+n7+n8,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n3+n7+n8,3)
-		+ k2*_q(n1+n4,2)*_q(n2+n5,2)*_q(n6,1)*_q(n3+n7+n8,3)
-		+ k4*_q(n4,1)*_q(n1+n2+n5,3)*_q(n6,1)*_q(n3+n7+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4+n5,2)*_q(n6,1)*_q(n3+n7+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n4+n5,2)*_q(n6,1)*_q(n3+n7+n8,3)
-		+ k4*_q(n2,1)*_q(n1+n4+n5,3)*_q(n6,1)*_q(n3+n7+n8,3)
-		+ k4*_q(n1,1)*_q(n2+n4+n5,3)*_q(n6,1)*_q(n3+n7+n8,3)
-		- k12*_q(n1+n2+n4+n5,4)*_q(n6,1)*_q(n3+n7+n8,3)
-		- k2*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n3+n7+n8,3)
-		+ k2*_q(n2+n4,2)*_q(n5,1)*_q(n1+n6,2)*_q(n3+n7+n8,3)
-		+ k2*_q(n4,1)*_q(n2+n5,2)*_q(n1+n6,2)*_q(n3+n7+n8,3)
-		+ k2*_q(n2,1)*_q(n4+n5,2)*_q(n1+n6,2)*_q(n3+n7+n8,3)
-		- k4*_q(n2+n4+n5,3)*_q(n1+n6,2)*_q(n3+n7+n8,3)
-		- k2*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n3+n7+n8,3)
-		+ k2*_q(n1+n4,2)*_q(n5,1)*_q(n2+n6,2)*_q(n3+n7+n8,3)
-		+ k2*_q(n4,1)*_q(n1+n5,2)*_q(n2+n6,2)*_q(n3+n7+n8,3)
-		+ k2*_q(n1,1)*_q(n4+n5,2)*_q(n2+n6,2)*_q(n3+n7+n8,3)
-		- k4*_q(n1+n4+n5,3)*_q(n2+n6,2)*_q(n3+n7+n8,3)
-		+ k4*_q(n4,1)*_q(n5,1)*_q(n1+n2+n6,3)*_q(n3+n7+n8,3)
-		- k4*_q(n4+n5,2)*_q(n1+n2+n6,3)*_q(n3+n7+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n4+n6,2)*_q(n3+n7+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n5,1)*_q(n4+n6,2)*_q(n3+n7+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n5,2)*_q(n4+n6,2)*_q(n3+n7+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n5,2)*_q(n4+n6,2)*_q(n3+n7+n8,3)
-		- k4*_q(n1+n2+n5,3)*_q(n4+n6,2)*_q(n3+n7+n8,3)
-		+ k4*_q(n2,1)*_q(n5,1)*_q(n1+n4+n6,3)*_q(n3+n7+n8,3)
-		- k4*_q(n2+n5,2)*_q(n1+n4+n6,3)*_q(n3+n7+n8,3)
-		+ k4*_q(n1,1)*_q(n5,1)*_q(n2+n4+n6,3)*_q(n3+n7+n8,3)
-		- k4*_q(n1+n5,2)*_q(n2+n4+n6,3)*_q(n3+n7+n8,3)
-		- k12*_q(n5,1)*_q(n1+n2+n4+n6,4)*_q(n3+n7+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5+n6,2)*_q(n3+n7+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n4,1)*_q(n5+n6,2)*_q(n3+n7+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n4,2)*_q(n5+n6,2)*_q(n3+n7+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n4,2)*_q(n5+n6,2)*_q(n3+n7+n8,3)
-		- k4*_q(n1+n2+n4,3)*_q(n5+n6,2)*_q(n3+n7+n8,3)
-		+ k4*_q(n2,1)*_q(n4,1)*_q(n1+n5+n6,3)*_q(n3+n7+n8,3)
-		- k4*_q(n2+n4,2)*_q(n1+n5+n6,3)*_q(n3+n7+n8,3)
-		+ k4*_q(n1,1)*_q(n4,1)*_q(n2+n5+n6,3)*_q(n3+n7+n8,3)
-		- k4*_q(n1+n4,2)*_q(n2+n5+n6,3)*_q(n3+n7+n8,3)
-		- k12*_q(n4,1)*_q(n1+n2+n5+n6,4)*_q(n3+n7+n8,3)
-		+ k4*_q(n1,1)*_q(n2,1)*_q(n4+n5+n6,3)*_q(n3+n7+n8,3)
-		- k4*_q(n1+n2,2)*_q(n4+n5+n6,3)*_q(n3+n7+n8,3)
-		- k12*_q(n2,1)*_q(n1+n4+n5+n6,4)*_q(n3+n7+n8,3)
-		- k12*_q(n1,1)*_q(n2+n4+n5+n6,4)*_q(n3+n7+n8,3)
-		+ k48*_q(n1+n2+n4+n5+n6,5)*_q(n3+n7+n8,3)
-		- k6*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n3+n7+n8,4)
-		+ k6*_q(n2+n4,2)*_q(n5,1)*_q(n6,1)*_q(n1+n3+n7+n8,4)
-		+ k6*_q(n4,1)*_q(n2+n5,2)*_q(n6,1)*_q(n1+n3+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n4+n5,2)*_q(n6,1)*_q(n1+n3+n7+n8,4)
-		- k12*_q(n2+n4+n5,3)*_q(n6,1)*_q(n1+n3+n7+n8,4)
-		+ k6*_q(n4,1)*_q(n5,1)*_q(n2+n6,2)*_q(n1+n3+n7+n8,4)
-		- k6*_q(n4+n5,2)*_q(n2+n6,2)*_q(n1+n3+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n5,1)*_q(n4+n6,2)*_q(n1+n3+n7+n8,4)
-		- k6*_q(n2+n5,2)*_q(n4+n6,2)*_q(n1+n3+n7+n8,4)
-		- k12*_q(n5,1)*_q(n2+n4+n6,3)*_q(n1+n3+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n4,1)*_q(n5+n6,2)*_q(n1+n3+n7+n8,4)
-		- k6*_q(n2+n4,2)*_q(n5+n6,2)*_q(n1+n3+n7+n8,4)
-		- k12*_q(n4,1)*_q(n2+n5+n6,3)*_q(n1+n3+n7+n8,4)
-		- k12*_q(n2,1)*_q(n4+n5+n6,3)*_q(n1+n3+n7+n8,4)
-		+ k36*_q(n2+n4+n5+n6,4)*_q(n1+n3+n7+n8,4)
-		- k6*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n2+n3+n7+n8,4)
-		+ k6*_q(n1+n4,2)*_q(n5,1)*_q(n6,1)*_q(n2+n3+n7+n8,4)
-		+ k6*_q(n4,1)*_q(n1+n5,2)*_q(n6,1)*_q(n2+n3+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n4+n5,2)*_q(n6,1)*_q(n2+n3+n7+n8,4)
-		- k12*_q(n1+n4+n5,3)*_q(n6,1)*_q(n2+n3+n7+n8,4)
-		+ k6*_q(n4,1)*_q(n5,1)*_q(n1+n6,2)*_q(n2+n3+n7+n8,4)
-		- k6*_q(n4+n5,2)*_q(n1+n6,2)*_q(n2+n3+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n5,1)*_q(n4+n6,2)*_q(n2+n3+n7+n8,4)
-		- k6*_q(n1+n5,2)*_q(n4+n6,2)*_q(n2+n3+n7+n8,4)
-		- k12*_q(n5,1)*_q(n1+n4+n6,3)*_q(n2+n3+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n4,1)*_q(n5+n6,2)*_q(n2+n3+n7+n8,4)
-		- k6*_q(n1+n4,2)*_q(n5+n6,2)*_q(n2+n3+n7+n8,4)
-		- k12*_q(n4,1)*_q(n1+n5+n6,3)*_q(n2+n3+n7+n8,4)
-		- k12*_q(n1,1)*_q(n4+n5+n6,3)*_q(n2+n3+n7+n8,4)
-		+ k36*_q(n1+n4+n5+n6,4)*_q(n2+n3+n7+n8,4)
-		+ k24*_q(n4,1)*_q(n5,1)*_q(n6,1)*_q(n1+n2+n3+n7+n8,5)
-		- k24*_q(n4+n5,2)*_q(n6,1)*_q(n1+n2+n3+n7+n8,5)
-		- k24*_q(n5,1)*_q(n4+n6,2)*_q(n1+n2+n3+n7+n8,5)
-		- k24*_q(n4,1)*_q(n5+n6,2)*_q(n1+n2+n3+n7+n8,5)
-		+ k48*_q(n4+n5+n6,3)*_q(n1+n2+n3+n7+n8,5)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n4+n7+n8,3)
-		- k2*_q(n1+n2,2)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n4+n7+n8,3)
-		- k2*_q(n2,1)*_q(n1+n3,2)*_q(n5,1)*_q(n6,1)*_q(n4+n7+n8,3)
-		- k2*_q(n1,1)*_q(n2+n3,2)*_q(n5,1)*_q(n6,1)*_q(n4+n7+n8,3)
-		+ k4*_q(n1+n2+n3,3)*_q(n5,1)*_q(n6,1)*_q(n4+n7+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n5,2)*_q(n6,1)*_q(n4+n7+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n1+n5,2)*_q(n6,1)*_q(n4+n7+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n5,2)*_q(n6,1)*_q(n4+n7+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n2+n5,2)*_q(n6,1)*_q(n4+n7+n8,3)
-		+ k4*_q(n3,1)*_q(n1+n2+n5,3)*_q(n6,1)*_q(n4+n7+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n5,2)*_q(n6,1)*_q(n4+n7+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n3+n5,2)*_q(n6,1)*_q(n4+n7+n8,3)
-		+ k4*_q(n2,1)*_q(n1+n3+n5,3)*_q(n6,1)*_q(n4+n7+n8,3)
-		+ k4*_q(n1,1)*_q(n2+n3+n5,3)*_q(n6,1)*_q(n4+n7+n8,3)
-		- k12*_q(n1+n2+n3+n5,4)*_q(n6,1)*_q(n4+n7+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n1+n6,2)*_q(n4+n7+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n5,1)*_q(n1+n6,2)*_q(n4+n7+n8,3)
-		+ k2*_q(n3,1)*_q(n2+n5,2)*_q(n1+n6,2)*_q(n4+n7+n8,3)
-		+ k2*_q(n2,1)*_q(n3+n5,2)*_q(n1+n6,2)*_q(n4+n7+n8,3)
-		- k4*_q(n2+n3+n5,3)*_q(n1+n6,2)*_q(n4+n7+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n2+n6,2)*_q(n4+n7+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n5,1)*_q(n2+n6,2)*_q(n4+n7+n8,3)
-		+ k2*_q(n3,1)*_q(n1+n5,2)*_q(n2+n6,2)*_q(n4+n7+n8,3)
-		+ k2*_q(n1,1)*_q(n3+n5,2)*_q(n2+n6,2)*_q(n4+n7+n8,3)
-		- k4*_q(n1+n3+n5,3)*_q(n2+n6,2)*_q(n4+n7+n8,3)
-		+ k4*_q(n3,1)*_q(n5,1)*_q(n1+n2+n6,3)*_q(n4+n7+n8,3)
-		- k4*_q(n3+n5,2)*_q(n1+n2+n6,3)*_q(n4+n7+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n3+n6,2)*_q(n4+n7+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n5,1)*_q(n3+n6,2)*_q(n4+n7+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n5,2)*_q(n3+n6,2)*_q(n4+n7+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n5,2)*_q(n3+n6,2)*_q(n4+n7+n8,3)
-		- k4*_q(n1+n2+n5,3)*_q(n3+n6,2)*_q(n4+n7+n8,3)
-		+ k4*_q(n2,1)*_q(n5,1)*_q(n1+n3+n6,3)*_q(n4+n7+n8,3)
-		- k4*_q(n2+n5,2)*_q(n1+n3+n6,3)*_q(n4+n7+n8,3)
-		+ k4*_q(n1,1)*_q(n5,1)*_q(n2+n3+n6,3)*_q(n4+n7+n8,3)
-		- k4*_q(n1+n5,2)*_q(n2+n3+n6,3)*_q(n4+n7+n8,3)
-		- k12*_q(n5,1)*_q(n1+n2+n3+n6,4)*_q(n4+n7+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5+n6,2)*_q(n4+n7+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n3,1)*_q(n5+n6,2)*_q(n4+n7+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n3,2)*_q(n5+n6,2)*_q(n4+n7+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n3,2)*_q(n5+n6,2)*_q(n4+n7+n8,3)
-		- k4*_q(n1+n2+n3,3)*_q(n5+n6,2)*_q(n4+n7+n8,3)
-		+ k4*_q(n2,1)*_q(n3,1)*_q(n1+n5+n6,3)*_q(n4+n7+n8,3)
-		- k4*_q(n2+n3,2)*_q(n1+n5+n6,3)*_q(n4+n7+n8,3)
-		+ k4*_q(n1,1)*_q(n3,1)*_q(n2+n5+n6,3)*_q(n4+n7+n8,3)
-		- k4*_q(n1+n3,2)*_q(n2+n5+n6,3)*_q(n4+n7+n8,3)
-		- k12*_q(n3,1)*_q(n1+n2+n5+n6,4)*_q(n4+n7+n8,3)
-		+ k4*_q(n1,1)*_q(n2,1)*_q(n3+n5+n6,3)*_q(n4+n7+n8,3)
-		- k4*_q(n1+n2,2)*_q(n3+n5+n6,3)*_q(n4+n7+n8,3)
-		- k12*_q(n2,1)*_q(n1+n3+n5+n6,4)*_q(n4+n7+n8,3)
-		- k12*_q(n1,1)*_q(n2+n3+n5+n6,4)*_q(n4+n7+n8,3)
-		+ k48*_q(n1+n2+n3+n5+n6,5)*_q(n4+n7+n8,3)
-		- k6*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n1+n4+n7+n8,4)
-		+ k6*_q(n2+n3,2)*_q(n5,1)*_q(n6,1)*_q(n1+n4+n7+n8,4)
-		+ k6*_q(n3,1)*_q(n2+n5,2)*_q(n6,1)*_q(n1+n4+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n3+n5,2)*_q(n6,1)*_q(n1+n4+n7+n8,4)
-		- k12*_q(n2+n3+n5,3)*_q(n6,1)*_q(n1+n4+n7+n8,4)
-		+ k6*_q(n3,1)*_q(n5,1)*_q(n2+n6,2)*_q(n1+n4+n7+n8,4)
-		- k6*_q(n3+n5,2)*_q(n2+n6,2)*_q(n1+n4+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n5,1)*_q(n3+n6,2)*_q(n1+n4+n7+n8,4)
-		- k6*_q(n2+n5,2)*_q(n3+n6,2)*_q(n1+n4+n7+n8,4)
-		- k12*_q(n5,1)*_q(n2+n3+n6,3)*_q(n1+n4+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n3,1)*_q(n5+n6,2)*_q(n1+n4+n7+n8,4)
-		- k6*_q(n2+n3,2)*_q(n5+n6,2)*_q(n1+n4+n7+n8,4)
-		- k12*_q(n3,1)*_q(n2+n5+n6,3)*_q(n1+n4+n7+n8,4)
-		- k12*_q(n2,1)*_q(n3+n5+n6,3)*_q(n1+n4+n7+n8,4)
-		+ k36*_q(n2+n3+n5+n6,4)*_q(n1+n4+n7+n8,4)
-		- k6*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n2+n4+n7+n8,4)
-		+ k6*_q(n1+n3,2)*_q(n5,1)*_q(n6,1)*_q(n2+n4+n7+n8,4)
-		+ k6*_q(n3,1)*_q(n1+n5,2)*_q(n6,1)*_q(n2+n4+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n3+n5,2)*_q(n6,1)*_q(n2+n4+n7+n8,4)
-		- k12*_q(n1+n3+n5,3)*_q(n6,1)*_q(n2+n4+n7+n8,4)
-		+ k6*_q(n3,1)*_q(n5,1)*_q(n1+n6,2)*_q(n2+n4+n7+n8,4)
-		- k6*_q(n3+n5,2)*_q(n1+n6,2)*_q(n2+n4+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n5,1)*_q(n3+n6,2)*_q(n2+n4+n7+n8,4)
-		- k6*_q(n1+n5,2)*_q(n3+n6,2)*_q(n2+n4+n7+n8,4)
-		- k12*_q(n5,1)*_q(n1+n3+n6,3)*_q(n2+n4+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n3,1)*_q(n5+n6,2)*_q(n2+n4+n7+n8,4)
-		- k6*_q(n1+n3,2)*_q(n5+n6,2)*_q(n2+n4+n7+n8,4)
-		- k12*_q(n3,1)*_q(n1+n5+n6,3)*_q(n2+n4+n7+n8,4)
-		- k12*_q(n1,1)*_q(n3+n5+n6,3)*_q(n2+n4+n7+n8,4)
-		+ k36*_q(n1+n3+n5+n6,4)*_q(n2+n4+n7+n8,4)
-		+ k24*_q(n3,1)*_q(n5,1)*_q(n6,1)*_q(n1+n2+n4+n7+n8,5)
-		- k24*_q(n3+n5,2)*_q(n6,1)*_q(n1+n2+n4+n7+n8,5)
-		- k24*_q(n5,1)*_q(n3+n6,2)*_q(n1+n2+n4+n7+n8,5)
-		- k24*_q(n3,1)*_q(n5+n6,2)*_q(n1+n2+n4+n7+n8,5)
-		+ k48*_q(n3+n5+n6,3)*_q(n1+n2+n4+n7+n8,5)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n6,1)*_q(n3+n4+n7+n8,4)
-		+ k6*_q(n1+n2,2)*_q(n5,1)*_q(n6,1)*_q(n3+n4+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n1+n5,2)*_q(n6,1)*_q(n3+n4+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n2+n5,2)*_q(n6,1)*_q(n3+n4+n7+n8,4)
-		- k12*_q(n1+n2+n5,3)*_q(n6,1)*_q(n3+n4+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n5,1)*_q(n1+n6,2)*_q(n3+n4+n7+n8,4)
-		- k6*_q(n2+n5,2)*_q(n1+n6,2)*_q(n3+n4+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n5,1)*_q(n2+n6,2)*_q(n3+n4+n7+n8,4)
-		- k6*_q(n1+n5,2)*_q(n2+n6,2)*_q(n3+n4+n7+n8,4)
-		- k12*_q(n5,1)*_q(n1+n2+n6,3)*_q(n3+n4+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n2,1)*_q(n5+n6,2)*_q(n3+n4+n7+n8,4)
-		- k6*_q(n1+n2,2)*_q(n5+n6,2)*_q(n3+n4+n7+n8,4)
-		- k12*_q(n2,1)*_q(n1+n5+n6,3)*_q(n3+n4+n7+n8,4)
-		- k12*_q(n1,1)*_q(n2+n5+n6,3)*_q(n3+n4+n7+n8,4)
-		+ k36*_q(n1+n2+n5+n6,4)*_q(n3+n4+n7+n8,4)
-		+ k24*_q(n2,1)*_q(n5,1)*_q(n6,1)*_q(n1+n3+n4+n7+n8,5)
-		- k24*_q(n2+n5,2)*_q(n6,1)*_q(n1+n3+n4+n7+n8,5)
-		- k24*_q(n5,1)*_q(n2+n6,2)*_q(n1+n3+n4+n7+n8,5)
-		- k24*_q(n2,1)*_q(n5+n6,2)*_q(n1+n3+n4+n7+n8,5)
-		+ k48*_q(n2+n5+n6,3)*_q(n1+n3+n4+n7+n8,5)
-		+ k24*_q(n1,1)*_q(n5,1)*_q(n6,1)*_q(n2+n3+n4+n7+n8,5)
-		- k24*_q(n1+n5,2)*_q(n6,1)*_q(n2+n3+n4+n7+n8,5)
-		- k24*_q(n5,1)*_q(n1+n6,2)*_q(n2+n3+n4+n7+n8,5)
-		- k24*_q(n1,1)*_q(n5+n6,2)*_q(n2+n3+n4+n7+n8,5)
-		+ k48*_q(n1+n5+n6,3)*_q(n2+n3+n4+n7+n8,5)
-		- k120*_q(n5,1)*_q(n6,1)*_q(n1+n2+n3+n4+n7+n8,6)
-		+ k120*_q(n5+n6,2)*_q(n1+n2+n3+n4+n7+n8,6)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n5+n7+n8,3)
-		- k2*_q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n5+n7+n8,3)
-		- k2*_q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n6,1)*_q(n5+n7+n8,3)
-		- k2*_q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n6,1)*_q(n5+n7+n8,3)
-		+ k4*_q(n1+n2+n3,3)*_q(n4,1)*_q(n6,1)*_q(n5+n7+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n6,1)*_q(n5+n7+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n1+n4,2)*_q(n6,1)*_q(n5+n7+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n6,1)*_q(n5+n7+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n2+n4,2)*_q(n6,1)*_q(n5+n7+n8,3)
-		+ k4*_q(n3,1)*_q(n1+n2+n4,3)*_q(n6,1)*_q(n5+n7+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n6,1)*_q(n5+n7+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n3+n4,2)*_q(n6,1)*_q(n5+n7+n8,3)
-		+ k4*_q(n2,1)*_q(n1+n3+n4,3)*_q(n6,1)*_q(n5+n7+n8,3)
-		+ k4*_q(n1,1)*_q(n2+n3+n4,3)*_q(n6,1)*_q(n5+n7+n8,3)
-		- k12*_q(n1+n2+n3+n4,4)*_q(n6,1)*_q(n5+n7+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n6,2)*_q(n5+n7+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n4,1)*_q(n1+n6,2)*_q(n5+n7+n8,3)
-		+ k2*_q(n3,1)*_q(n2+n4,2)*_q(n1+n6,2)*_q(n5+n7+n8,3)
-		+ k2*_q(n2,1)*_q(n3+n4,2)*_q(n1+n6,2)*_q(n5+n7+n8,3)
-		- k4*_q(n2+n3+n4,3)*_q(n1+n6,2)*_q(n5+n7+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n6,2)*_q(n5+n7+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n4,1)*_q(n2+n6,2)*_q(n5+n7+n8,3)
-		+ k2*_q(n3,1)*_q(n1+n4,2)*_q(n2+n6,2)*_q(n5+n7+n8,3)
-		+ k2*_q(n1,1)*_q(n3+n4,2)*_q(n2+n6,2)*_q(n5+n7+n8,3)
-		- k4*_q(n1+n3+n4,3)*_q(n2+n6,2)*_q(n5+n7+n8,3)
-		+ k4*_q(n3,1)*_q(n4,1)*_q(n1+n2+n6,3)*_q(n5+n7+n8,3)
-		- k4*_q(n3+n4,2)*_q(n1+n2+n6,3)*_q(n5+n7+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n6,2)*_q(n5+n7+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n4,1)*_q(n3+n6,2)*_q(n5+n7+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n4,2)*_q(n3+n6,2)*_q(n5+n7+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n4,2)*_q(n3+n6,2)*_q(n5+n7+n8,3)
-		- k4*_q(n1+n2+n4,3)*_q(n3+n6,2)*_q(n5+n7+n8,3)
-		+ k4*_q(n2,1)*_q(n4,1)*_q(n1+n3+n6,3)*_q(n5+n7+n8,3)
-		- k4*_q(n2+n4,2)*_q(n1+n3+n6,3)*_q(n5+n7+n8,3)
-		+ k4*_q(n1,1)*_q(n4,1)*_q(n2+n3+n6,3)*_q(n5+n7+n8,3)
-		- k4*_q(n1+n4,2)*_q(n2+n3+n6,3)*_q(n5+n7+n8,3)
-		- k12*_q(n4,1)*_q(n1+n2+n3+n6,4)*_q(n5+n7+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n6,2)*_q(n5+n7+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n3,1)*_q(n4+n6,2)*_q(n5+n7+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n3,2)*_q(n4+n6,2)*_q(n5+n7+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n3,2)*_q(n4+n6,2)*_q(n5+n7+n8,3)
-		- k4*_q(n1+n2+n3,3)*_q(n4+n6,2)*_q(n5+n7+n8,3)
-		+ k4*_q(n2,1)*_q(n3,1)*_q(n1+n4+n6,3)*_q(n5+n7+n8,3)
-		- k4*_q(n2+n3,2)*_q(n1+n4+n6,3)*_q(n5+n7+n8,3)
-		+ k4*_q(n1,1)*_q(n3,1)*_q(n2+n4+n6,3)*_q(n5+n7+n8,3)
-		- k4*_q(n1+n3,2)*_q(n2+n4+n6,3)*_q(n5+n7+n8,3)
-		- k12*_q(n3,1)*_q(n1+n2+n4+n6,4)*_q(n5+n7+n8,3)
-		+ k4*_q(n1,1)*_q(n2,1)*_q(n3+n4+n6,3)*_q(n5+n7+n8,3)
-		- k4*_q(n1+n2,2)*_q(n3+n4+n6,3)*_q(n5+n7+n8,3)
-		- k12*_q(n2,1)*_q(n1+n3+n4+n6,4)*_q(n5+n7+n8,3)
-		- k12*_q(n1,1)*_q(n2+n3+n4+n6,4)*_q(n5+n7+n8,3)
-		+ k48*_q(n1+n2+n3+n4+n6,5)*_q(n5+n7+n8,3)
-		- k6*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n1+n5+n7+n8,4)
-		+ k6*_q(n2+n3,2)*_q(n4,1)*_q(n6,1)*_q(n1+n5+n7+n8,4)
-		+ k6*_q(n3,1)*_q(n2+n4,2)*_q(n6,1)*_q(n1+n5+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n3+n4,2)*_q(n6,1)*_q(n1+n5+n7+n8,4)
-		- k12*_q(n2+n3+n4,3)*_q(n6,1)*_q(n1+n5+n7+n8,4)
-		+ k6*_q(n3,1)*_q(n4,1)*_q(n2+n6,2)*_q(n1+n5+n7+n8,4)
-		- k6*_q(n3+n4,2)*_q(n2+n6,2)*_q(n1+n5+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n4,1)*_q(n3+n6,2)*_q(n1+n5+n7+n8,4)
-		- k6*_q(n2+n4,2)*_q(n3+n6,2)*_q(n1+n5+n7+n8,4)
-		- k12*_q(n4,1)*_q(n2+n3+n6,3)*_q(n1+n5+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n3,1)*_q(n4+n6,2)*_q(n1+n5+n7+n8,4)
-		- k6*_q(n2+n3,2)*_q(n4+n6,2)*_q(n1+n5+n7+n8,4)
-		- k12*_q(n3,1)*_q(n2+n4+n6,3)*_q(n1+n5+n7+n8,4)
-		- k12*_q(n2,1)*_q(n3+n4+n6,3)*_q(n1+n5+n7+n8,4)
-		+ k36*_q(n2+n3+n4+n6,4)*_q(n1+n5+n7+n8,4)
-		- k6*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n2+n5+n7+n8,4)
-		+ k6*_q(n1+n3,2)*_q(n4,1)*_q(n6,1)*_q(n2+n5+n7+n8,4)
-		+ k6*_q(n3,1)*_q(n1+n4,2)*_q(n6,1)*_q(n2+n5+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n3+n4,2)*_q(n6,1)*_q(n2+n5+n7+n8,4)
-		- k12*_q(n1+n3+n4,3)*_q(n6,1)*_q(n2+n5+n7+n8,4)
-		+ k6*_q(n3,1)*_q(n4,1)*_q(n1+n6,2)*_q(n2+n5+n7+n8,4)
-		- k6*_q(n3+n4,2)*_q(n1+n6,2)*_q(n2+n5+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n4,1)*_q(n3+n6,2)*_q(n2+n5+n7+n8,4)
-		- k6*_q(n1+n4,2)*_q(n3+n6,2)*_q(n2+n5+n7+n8,4)
-		- k12*_q(n4,1)*_q(n1+n3+n6,3)*_q(n2+n5+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n3,1)*_q(n4+n6,2)*_q(n2+n5+n7+n8,4)
-		- k6*_q(n1+n3,2)*_q(n4+n6,2)*_q(n2+n5+n7+n8,4)
-		- k12*_q(n3,1)*_q(n1+n4+n6,3)*_q(n2+n5+n7+n8,4)
-		- k12*_q(n1,1)*_q(n3+n4+n6,3)*_q(n2+n5+n7+n8,4)
-		+ k36*_q(n1+n3+n4+n6,4)*_q(n2+n5+n7+n8,4)
-		+ k24*_q(n3,1)*_q(n4,1)*_q(n6,1)*_q(n1+n2+n5+n7+n8,5)
-		- k24*_q(n3+n4,2)*_q(n6,1)*_q(n1+n2+n5+n7+n8,5)
-		- k24*_q(n4,1)*_q(n3+n6,2)*_q(n1+n2+n5+n7+n8,5)
-		- k24*_q(n3,1)*_q(n4+n6,2)*_q(n1+n2+n5+n7+n8,5)
-		+ k48*_q(n3+n4+n6,3)*_q(n1+n2+n5+n7+n8,5)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n6,1)*_q(n3+n5+n7+n8,4)
-		+ k6*_q(n1+n2,2)*_q(n4,1)*_q(n6,1)*_q(n3+n5+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n1+n4,2)*_q(n6,1)*_q(n3+n5+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n2+n4,2)*_q(n6,1)*_q(n3+n5+n7+n8,4)
-		- k12*_q(n1+n2+n4,3)*_q(n6,1)*_q(n3+n5+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n4,1)*_q(n1+n6,2)*_q(n3+n5+n7+n8,4)
-		- k6*_q(n2+n4,2)*_q(n1+n6,2)*_q(n3+n5+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n4,1)*_q(n2+n6,2)*_q(n3+n5+n7+n8,4)
-		- k6*_q(n1+n4,2)*_q(n2+n6,2)*_q(n3+n5+n7+n8,4)
-		- k12*_q(n4,1)*_q(n1+n2+n6,3)*_q(n3+n5+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n2,1)*_q(n4+n6,2)*_q(n3+n5+n7+n8,4)
-		- k6*_q(n1+n2,2)*_q(n4+n6,2)*_q(n3+n5+n7+n8,4)
-		- k12*_q(n2,1)*_q(n1+n4+n6,3)*_q(n3+n5+n7+n8,4)
-		- k12*_q(n1,1)*_q(n2+n4+n6,3)*_q(n3+n5+n7+n8,4)
-		+ k36*_q(n1+n2+n4+n6,4)*_q(n3+n5+n7+n8,4)
-		+ k24*_q(n2,1)*_q(n4,1)*_q(n6,1)*_q(n1+n3+n5+n7+n8,5)
-		- k24*_q(n2+n4,2)*_q(n6,1)*_q(n1+n3+n5+n7+n8,5)
-		- k24*_q(n4,1)*_q(n2+n6,2)*_q(n1+n3+n5+n7+n8,5)
-		- k24*_q(n2,1)*_q(n4+n6,2)*_q(n1+n3+n5+n7+n8,5)
-		+ k48*_q(n2+n4+n6,3)*_q(n1+n3+n5+n7+n8,5)
-		+ k24*_q(n1,1)*_q(n4,1)*_q(n6,1)*_q(n2+n3+n5+n7+n8,5)
-		- k24*_q(n1+n4,2)*_q(n6,1)*_q(n2+n3+n5+n7+n8,5)
-		- k24*_q(n4,1)*_q(n1+n6,2)*_q(n2+n3+n5+n7+n8,5)
-		- k24*_q(n1,1)*_q(n4+n6,2)*_q(n2+n3+n5+n7+n8,5)
-		+ k48*_q(n1+n4+n6,3)*_q(n2+n3+n5+n7+n8,5)
-		- k120*_q(n4,1)*_q(n6,1)*_q(n1+n2+n3+n5+n7+n8,6)
-		+ k120*_q(n4+n6,2)*_q(n1+n2+n3+n5+n7+n8,6)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n6,1)*_q(n4+n5+n7+n8,4)
-		+ k6*_q(n1+n2,2)*_q(n3,1)*_q(n6,1)*_q(n4+n5+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n1+n3,2)*_q(n6,1)*_q(n4+n5+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n2+n3,2)*_q(n6,1)*_q(n4+n5+n7+n8,4)
-		- k12*_q(n1+n2+n3,3)*_q(n6,1)*_q(n4+n5+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n3,1)*_q(n1+n6,2)*_q(n4+n5+n7+n8,4)
-		- k6*_q(n2+n3,2)*_q(n1+n6,2)*_q(n4+n5+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n3,1)*_q(n2+n6,2)*_q(n4+n5+n7+n8,4)
-		- k6*_q(n1+n3,2)*_q(n2+n6,2)*_q(n4+n5+n7+n8,4)
-		- k12*_q(n3,1)*_q(n1+n2+n6,3)*_q(n4+n5+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n2,1)*_q(n3+n6,2)*_q(n4+n5+n7+n8,4)
-		- k6*_q(n1+n2,2)*_q(n3+n6,2)*_q(n4+n5+n7+n8,4)
-		- k12*_q(n2,1)*_q(n1+n3+n6,3)*_q(n4+n5+n7+n8,4)
-		- k12*_q(n1,1)*_q(n2+n3+n6,3)*_q(n4+n5+n7+n8,4)
-		+ k36*_q(n1+n2+n3+n6,4)*_q(n4+n5+n7+n8,4)
-		+ k24*_q(n2,1)*_q(n3,1)*_q(n6,1)*_q(n1+n4+n5+n7+n8,5)
-		- k24*_q(n2+n3,2)*_q(n6,1)*_q(n1+n4+n5+n7+n8,5)
-		- k24*_q(n3,1)*_q(n2+n6,2)*_q(n1+n4+n5+n7+n8,5)
-		- k24*_q(n2,1)*_q(n3+n6,2)*_q(n1+n4+n5+n7+n8,5)
-		+ k48*_q(n2+n3+n6,3)*_q(n1+n4+n5+n7+n8,5)
-		+ k24*_q(n1,1)*_q(n3,1)*_q(n6,1)*_q(n2+n4+n5+n7+n8,5)
-		- k24*_q(n1+n3,2)*_q(n6,1)*_q(n2+n4+n5+n7+n8,5)
-		- k24*_q(n3,1)*_q(n1+n6,2)*_q(n2+n4+n5+n7+n8,5)
-		- k24*_q(n1,1)*_q(n3+n6,2)*_q(n2+n4+n5+n7+n8,5)
-		+ k48*_q(n1+n3+n6,3)*_q(n2+n4+n5+n7+n8,5)
-		- k120*_q(n3,1)*_q(n6,1)*_q(n1+n2+n4+n5+n7+n8,6)
-		+ k120*_q(n3+n6,2)*_q(n1+n2+n4+n5+n7+n8,6)
-		+ k24*_q(n1,1)*_q(n2,1)*_q(n6,1)*_q(n3+n4+n5+n7+n8,5)
-		- k24*_q(n1+n2,2)*_q(n6,1)*_q(n3+n4+n5+n7+n8,5)
-		- k24*_q(n2,1)*_q(n1+n6,2)*_q(n3+n4+n5+n7+n8,5)
-		- k24*_q(n1,1)*_q(n2+n6,2)*_q(n3+n4+n5+n7+n8,5)
-		+ k48*_q(n1+n2+n6,3)*_q(n3+n4+n5+n7+n8,5)
-		- k120*_q(n2,1)*_q(n6,1)*_q(n1+n3+n4+n5+n7+n8,6)
-		+ k120*_q(n2+n6,2)*_q(n1+n3+n4+n5+n7+n8,6)
-		- k120*_q(n1,1)*_q(n6,1)*_q(n2+n3+n4+n5+n7+n8,6)
-		+ k120*_q(n1+n6,2)*_q(n2+n3+n4+n5+n7+n8,6)
-		+ k720*_q(n6,1)*_q(n1+n2+n3+n4+n5+n7+n8,7)
-		+ k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6+n7+n8,3)
-		- k2*_q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n6+n7+n8,3)
-		- k2*_q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6+n7+n8,3)
-		- k2*_q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n6+n7+n8,3)
-		+ k4*_q(n1+n2+n3,3)*_q(n4,1)*_q(n5,1)*_q(n6+n7+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n6+n7+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n1+n4,2)*_q(n5,1)*_q(n6+n7+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n6+n7+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n2+n4,2)*_q(n5,1)*_q(n6+n7+n8,3)
-		+ k4*_q(n3,1)*_q(n1+n2+n4,3)*_q(n5,1)*_q(n6+n7+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n6+n7+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n3+n4,2)*_q(n5,1)*_q(n6+n7+n8,3)
-		+ k4*_q(n2,1)*_q(n1+n3+n4,3)*_q(n5,1)*_q(n6+n7+n8,3)
-		+ k4*_q(n1,1)*_q(n2+n3+n4,3)*_q(n5,1)*_q(n6+n7+n8,3)
-		- k12*_q(n1+n2+n3+n4,4)*_q(n5,1)*_q(n6+n7+n8,3)
-		- k2*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n6+n7+n8,3)
-		+ k2*_q(n2+n3,2)*_q(n4,1)*_q(n1+n5,2)*_q(n6+n7+n8,3)
-		+ k2*_q(n3,1)*_q(n2+n4,2)*_q(n1+n5,2)*_q(n6+n7+n8,3)
-		+ k2*_q(n2,1)*_q(n3+n4,2)*_q(n1+n5,2)*_q(n6+n7+n8,3)
-		- k4*_q(n2+n3+n4,3)*_q(n1+n5,2)*_q(n6+n7+n8,3)
-		- k2*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n6+n7+n8,3)
-		+ k2*_q(n1+n3,2)*_q(n4,1)*_q(n2+n5,2)*_q(n6+n7+n8,3)
-		+ k2*_q(n3,1)*_q(n1+n4,2)*_q(n2+n5,2)*_q(n6+n7+n8,3)
-		+ k2*_q(n1,1)*_q(n3+n4,2)*_q(n2+n5,2)*_q(n6+n7+n8,3)
-		- k4*_q(n1+n3+n4,3)*_q(n2+n5,2)*_q(n6+n7+n8,3)
-		+ k4*_q(n3,1)*_q(n4,1)*_q(n1+n2+n5,3)*_q(n6+n7+n8,3)
-		- k4*_q(n3+n4,2)*_q(n1+n2+n5,3)*_q(n6+n7+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n6+n7+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n4,1)*_q(n3+n5,2)*_q(n6+n7+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n4,2)*_q(n3+n5,2)*_q(n6+n7+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n4,2)*_q(n3+n5,2)*_q(n6+n7+n8,3)
-		- k4*_q(n1+n2+n4,3)*_q(n3+n5,2)*_q(n6+n7+n8,3)
-		+ k4*_q(n2,1)*_q(n4,1)*_q(n1+n3+n5,3)*_q(n6+n7+n8,3)
-		- k4*_q(n2+n4,2)*_q(n1+n3+n5,3)*_q(n6+n7+n8,3)
-		+ k4*_q(n1,1)*_q(n4,1)*_q(n2+n3+n5,3)*_q(n6+n7+n8,3)
-		- k4*_q(n1+n4,2)*_q(n2+n3+n5,3)*_q(n6+n7+n8,3)
-		- k12*_q(n4,1)*_q(n1+n2+n3+n5,4)*_q(n6+n7+n8,3)
-		- k2*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n6+n7+n8,3)
-		+ k2*_q(n1+n2,2)*_q(n3,1)*_q(n4+n5,2)*_q(n6+n7+n8,3)
-		+ k2*_q(n2,1)*_q(n1+n3,2)*_q(n4+n5,2)*_q(n6+n7+n8,3)
-		+ k2*_q(n1,1)*_q(n2+n3,2)*_q(n4+n5,2)*_q(n6+n7+n8,3)
-		- k4*_q(n1+n2+n3,3)*_q(n4+n5,2)*_q(n6+n7+n8,3)
-		+ k4*_q(n2,1)*_q(n3,1)*_q(n1+n4+n5,3)*_q(n6+n7+n8,3)
-		- k4*_q(n2+n3,2)*_q(n1+n4+n5,3)*_q(n6+n7+n8,3)
-		+ k4*_q(n1,1)*_q(n3,1)*_q(n2+n4+n5,3)*_q(n6+n7+n8,3)
-		- k4*_q(n1+n3,2)*_q(n2+n4+n5,3)*_q(n6+n7+n8,3)
-		- k12*_q(n3,1)*_q(n1+n2+n4+n5,4)*_q(n6+n7+n8,3)
-		+ k4*_q(n1,1)*_q(n2,1)*_q(n3+n4+n5,3)*_q(n6+n7+n8,3)
-		- k4*_q(n1+n2,2)*_q(n3+n4+n5,3)*_q(n6+n7+n8,3)
-		- k12*_q(n2,1)*_q(n1+n3+n4+n5,4)*_q(n6+n7+n8,3)
-		- k12*_q(n1,1)*_q(n2+n3+n4+n5,4)*_q(n6+n7+n8,3)
-		+ k48*_q(n1+n2+n3+n4+n5,5)*_q(n6+n7+n8,3)
-		- k6*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n6+n7+n8,4)
-		+ k6*_q(n2+n3,2)*_q(n4,1)*_q(n5,1)*_q(n1+n6+n7+n8,4)
-		+ k6*_q(n3,1)*_q(n2+n4,2)*_q(n5,1)*_q(n1+n6+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n3+n4,2)*_q(n5,1)*_q(n1+n6+n7+n8,4)
-		- k12*_q(n2+n3+n4,3)*_q(n5,1)*_q(n1+n6+n7+n8,4)
-		+ k6*_q(n3,1)*_q(n4,1)*_q(n2+n5,2)*_q(n1+n6+n7+n8,4)
-		- k6*_q(n3+n4,2)*_q(n2+n5,2)*_q(n1+n6+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n4,1)*_q(n3+n5,2)*_q(n1+n6+n7+n8,4)
-		- k6*_q(n2+n4,2)*_q(n3+n5,2)*_q(n1+n6+n7+n8,4)
-		- k12*_q(n4,1)*_q(n2+n3+n5,3)*_q(n1+n6+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n3,1)*_q(n4+n5,2)*_q(n1+n6+n7+n8,4)
-		- k6*_q(n2+n3,2)*_q(n4+n5,2)*_q(n1+n6+n7+n8,4)
-		- k12*_q(n3,1)*_q(n2+n4+n5,3)*_q(n1+n6+n7+n8,4)
-		- k12*_q(n2,1)*_q(n3+n4+n5,3)*_q(n1+n6+n7+n8,4)
-		+ k36*_q(n2+n3+n4+n5,4)*_q(n1+n6+n7+n8,4)
-		- k6*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n2+n6+n7+n8,4)
-		+ k6*_q(n1+n3,2)*_q(n4,1)*_q(n5,1)*_q(n2+n6+n7+n8,4)
-		+ k6*_q(n3,1)*_q(n1+n4,2)*_q(n5,1)*_q(n2+n6+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n3+n4,2)*_q(n5,1)*_q(n2+n6+n7+n8,4)
-		- k12*_q(n1+n3+n4,3)*_q(n5,1)*_q(n2+n6+n7+n8,4)
-		+ k6*_q(n3,1)*_q(n4,1)*_q(n1+n5,2)*_q(n2+n6+n7+n8,4)
-		- k6*_q(n3+n4,2)*_q(n1+n5,2)*_q(n2+n6+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n4,1)*_q(n3+n5,2)*_q(n2+n6+n7+n8,4)
-		- k6*_q(n1+n4,2)*_q(n3+n5,2)*_q(n2+n6+n7+n8,4)
-		- k12*_q(n4,1)*_q(n1+n3+n5,3)*_q(n2+n6+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n3,1)*_q(n4+n5,2)*_q(n2+n6+n7+n8,4)
-		- k6*_q(n1+n3,2)*_q(n4+n5,2)*_q(n2+n6+n7+n8,4)
-		- k12*_q(n3,1)*_q(n1+n4+n5,3)*_q(n2+n6+n7+n8,4)
-		- k12*_q(n1,1)*_q(n3+n4+n5,3)*_q(n2+n6+n7+n8,4)
-		+ k36*_q(n1+n3+n4+n5,4)*_q(n2+n6+n7+n8,4)
-		+ k24*_q(n3,1)*_q(n4,1)*_q(n5,1)*_q(n1+n2+n6+n7+n8,5)
-		- k24*_q(n3+n4,2)*_q(n5,1)*_q(n1+n2+n6+n7+n8,5)
-		- k24*_q(n4,1)*_q(n3+n5,2)*_q(n1+n2+n6+n7+n8,5)
-		- k24*_q(n3,1)*_q(n4+n5,2)*_q(n1+n2+n6+n7+n8,5)
-		+ k48*_q(n3+n4+n5,3)*_q(n1+n2+n6+n7+n8,5)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n3+n6+n7+n8,4)
-		+ k6*_q(n1+n2,2)*_q(n4,1)*_q(n5,1)*_q(n3+n6+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n1+n4,2)*_q(n5,1)*_q(n3+n6+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n2+n4,2)*_q(n5,1)*_q(n3+n6+n7+n8,4)
-		- k12*_q(n1+n2+n4,3)*_q(n5,1)*_q(n3+n6+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n4,1)*_q(n1+n5,2)*_q(n3+n6+n7+n8,4)
-		- k6*_q(n2+n4,2)*_q(n1+n5,2)*_q(n3+n6+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n4,1)*_q(n2+n5,2)*_q(n3+n6+n7+n8,4)
-		- k6*_q(n1+n4,2)*_q(n2+n5,2)*_q(n3+n6+n7+n8,4)
-		- k12*_q(n4,1)*_q(n1+n2+n5,3)*_q(n3+n6+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n2,1)*_q(n4+n5,2)*_q(n3+n6+n7+n8,4)
-		- k6*_q(n1+n2,2)*_q(n4+n5,2)*_q(n3+n6+n7+n8,4)
-		- k12*_q(n2,1)*_q(n1+n4+n5,3)*_q(n3+n6+n7+n8,4)
-		- k12*_q(n1,1)*_q(n2+n4+n5,3)*_q(n3+n6+n7+n8,4)
-		+ k36*_q(n1+n2+n4+n5,4)*_q(n3+n6+n7+n8,4)
-		+ k24*_q(n2,1)*_q(n4,1)*_q(n5,1)*_q(n1+n3+n6+n7+n8,5)
-		- k24*_q(n2+n4,2)*_q(n5,1)*_q(n1+n3+n6+n7+n8,5)
-		- k24*_q(n4,1)*_q(n2+n5,2)*_q(n1+n3+n6+n7+n8,5)
-		- k24*_q(n2,1)*_q(n4+n5,2)*_q(n1+n3+n6+n7+n8,5)
-		+ k48*_q(n2+n4+n5,3)*_q(n1+n3+n6+n7+n8,5)
-		+ k24*_q(n1,1)*_q(n4,1)*_q(n5,1)*_q(n2+n3+n6+n7+n8,5)
-		- k24*_q(n1+n4,2)*_q(n5,1)*_q(n2+n3+n6+n7+n8,5)
-		- k24*_q(n4,1)*_q(n1+n5,2)*_q(n2+n3+n6+n7+n8,5)
-		- k24*_q(n1,1)*_q(n4+n5,2)*_q(n2+n3+n6+n7+n8,5)
-		+ k48*_q(n1+n4+n5,3)*_q(n2+n3+n6+n7+n8,5)
-		- k120*_q(n4,1)*_q(n5,1)*_q(n1+n2+n3+n6+n7+n8,6)
-		+ k120*_q(n4+n5,2)*_q(n1+n2+n3+n6+n7+n8,6)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n4+n6+n7+n8,4)
-		+ k6*_q(n1+n2,2)*_q(n3,1)*_q(n5,1)*_q(n4+n6+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n1+n3,2)*_q(n5,1)*_q(n4+n6+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n2+n3,2)*_q(n5,1)*_q(n4+n6+n7+n8,4)
-		- k12*_q(n1+n2+n3,3)*_q(n5,1)*_q(n4+n6+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n3,1)*_q(n1+n5,2)*_q(n4+n6+n7+n8,4)
-		- k6*_q(n2+n3,2)*_q(n1+n5,2)*_q(n4+n6+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n3,1)*_q(n2+n5,2)*_q(n4+n6+n7+n8,4)
-		- k6*_q(n1+n3,2)*_q(n2+n5,2)*_q(n4+n6+n7+n8,4)
-		- k12*_q(n3,1)*_q(n1+n2+n5,3)*_q(n4+n6+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n2,1)*_q(n3+n5,2)*_q(n4+n6+n7+n8,4)
-		- k6*_q(n1+n2,2)*_q(n3+n5,2)*_q(n4+n6+n7+n8,4)
-		- k12*_q(n2,1)*_q(n1+n3+n5,3)*_q(n4+n6+n7+n8,4)
-		- k12*_q(n1,1)*_q(n2+n3+n5,3)*_q(n4+n6+n7+n8,4)
-		+ k36*_q(n1+n2+n3+n5,4)*_q(n4+n6+n7+n8,4)
-		+ k24*_q(n2,1)*_q(n3,1)*_q(n5,1)*_q(n1+n4+n6+n7+n8,5)
-		- k24*_q(n2+n3,2)*_q(n5,1)*_q(n1+n4+n6+n7+n8,5)
-		- k24*_q(n3,1)*_q(n2+n5,2)*_q(n1+n4+n6+n7+n8,5)
-		- k24*_q(n2,1)*_q(n3+n5,2)*_q(n1+n4+n6+n7+n8,5)
-		+ k48*_q(n2+n3+n5,3)*_q(n1+n4+n6+n7+n8,5)
-		+ k24*_q(n1,1)*_q(n3,1)*_q(n5,1)*_q(n2+n4+n6+n7+n8,5)
-		- k24*_q(n1+n3,2)*_q(n5,1)*_q(n2+n4+n6+n7+n8,5)
-		- k24*_q(n3,1)*_q(n1+n5,2)*_q(n2+n4+n6+n7+n8,5)
-		- k24*_q(n1,1)*_q(n3+n5,2)*_q(n2+n4+n6+n7+n8,5)
-		+ k48*_q(n1+n3+n5,3)*_q(n2+n4+n6+n7+n8,5)
-		- k120*_q(n3,1)*_q(n5,1)*_q(n1+n2+n4+n6+n7+n8,6)
-		+ k120*_q(n3+n5,2)*_q(n1+n2+n4+n6+n7+n8,6)
-		+ k24*_q(n1,1)*_q(n2,1)*_q(n5,1)*_q(n3+n4+n6+n7+n8,5)
-		- k24*_q(n1+n2,2)*_q(n5,1)*_q(n3+n4+n6+n7+n8,5)
-		- k24*_q(n2,1)*_q(n1+n5,2)*_q(n3+n4+n6+n7+n8,5)
-		- k24*_q(n1,1)*_q(n2+n5,2)*_q(n3+n4+n6+n7+n8,5)
-		+ k48*_q(n1+n2+n5,3)*_q(n3+n4+n6+n7+n8,5)
-		- k120*_q(n2,1)*_q(n5,1)*_q(n1+n3+n4+n6+n7+n8,6)
-		+ k120*_q(n2+n5,2)*_q(n1+n3+n4+n6+n7+n8,6)
-		- k120*_q(n1,1)*_q(n5,1)*_q(n2+n3+n4+n6+n7+n8,6)
-		+ k120*_q(n1+n5,2)*_q(n2+n3+n4+n6+n7+n8,6)
-		+ k720*_q(n5,1)*_q(n1+n2+n3+n4+n6+n7+n8,7)
-		- k6*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n5+n6+n7+n8,4)
-		+ k6*_q(n1+n2,2)*_q(n3,1)*_q(n4,1)*_q(n5+n6+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n1+n3,2)*_q(n4,1)*_q(n5+n6+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n2+n3,2)*_q(n4,1)*_q(n5+n6+n7+n8,4)
-		- k12*_q(n1+n2+n3,3)*_q(n4,1)*_q(n5+n6+n7+n8,4)
-		+ k6*_q(n2,1)*_q(n3,1)*_q(n1+n4,2)*_q(n5+n6+n7+n8,4)
-		- k6*_q(n2+n3,2)*_q(n1+n4,2)*_q(n5+n6+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n3,1)*_q(n2+n4,2)*_q(n5+n6+n7+n8,4)
-		- k6*_q(n1+n3,2)*_q(n2+n4,2)*_q(n5+n6+n7+n8,4)
-		- k12*_q(n3,1)*_q(n1+n2+n4,3)*_q(n5+n6+n7+n8,4)
-		+ k6*_q(n1,1)*_q(n2,1)*_q(n3+n4,2)*_q(n5+n6+n7+n8,4)
-		- k6*_q(n1+n2,2)*_q(n3+n4,2)*_q(n5+n6+n7+n8,4)
-		- k12*_q(n2,1)*_q(n1+n3+n4,3)*_q(n5+n6+n7+n8,4)
-		- k12*_q(n1,1)*_q(n2+n3+n4,3)*_q(n5+n6+n7+n8,4)
-		+ k36*_q(n1+n2+n3+n4,4)*_q(n5+n6+n7+n8,4)
-		+ k24*_q(n2,1)*_q(n3,1)*_q(n4,1)*_q(n1+n5+n6+n7+n8,5)
-		- k24*_q(n2+n3,2)*_q(n4,1)*_q(n1+n5+n6+n7+n8,5)
-		- k24*_q(n3,1)*_q(n2+n4,2)*_q(n1+n5+n6+n7+n8,5)
-		- k24*_q(n2,1)*_q(n3+n4,2)*_q(n1+n5+n6+n7+n8,5)
-		+ k48*_q(n2+n3+n4,3)*_q(n1+n5+n6+n7+n8,5)
-		+ k24*_q(n1,1)*_q(n3,1)*_q(n4,1)*_q(n2+n5+n6+n7+n8,5)
-		- k24*_q(n1+n3,2)*_q(n4,1)*_q(n2+n5+n6+n7+n8,5)
-		- k24*_q(n3,1)*_q(n1+n4,2)*_q(n2+n5+n6+n7+n8,5)
-		- k24*_q(n1,1)*_q(n3+n4,2)*_q(n2+n5+n6+n7+n8,5)
-		+ k48*_q(n1+n3+n4,3)*_q(n2+n5+n6+n7+n8,5)
-		- k120*_q(n3,1)*_q(n4,1)*_q(n1+n2+n5+n6+n7+n8,6)
-		+ k120*_q(n3+n4,2)*_q(n1+n2+n5+n6+n7+n8,6)
-		+ k24*_q(n1,1)*_q(n2,1)*_q(n4,1)*_q(n3+n5+n6+n7+n8,5)
-		- k24*_q(n1+n2,2)*_q(n4,1)*_q(n3+n5+n6+n7+n8,5)
-		- k24*_q(n2,1)*_q(n1+n4,2)*_q(n3+n5+n6+n7+n8,5)
-		- k24*_q(n1,1)*_q(n2+n4,2)*_q(n3+n5+n6+n7+n8,5)
-		+ k48*_q(n1+n2+n4,3)*_q(n3+n5+n6+n7+n8,5)
-		- k120*_q(n2,1)*_q(n4,1)*_q(n1+n3+n5+n6+n7+n8,6)
-		+ k120*_q(n2+n4,2)*_q(n1+n3+n5+n6+n7+n8,6)
-		- k120*_q(n1,1)*_q(n4,1)*_q(n2+n3+n5+n6+n7+n8,6)
-		+ k120*_q(n1+n4,2)*_q(n2+n3+n5+n6+n7+n8,6)
-		+ k720*_q(n4,1)*_q(n1+n2+n3+n5+n6+n7+n8,7)
-		+ k24*_q(n1,1)*_q(n2,1)*_q(n3,1)*_q(n4+n5+n6+n7+n8,5)
-		- k24*_q(n1+n2,2)*_q(n3,1)*_q(n4+n5+n6+n7+n8,5)
-		- k24*_q(n2,1)*_q(n1+n3,2)*_q(n4+n5+n6+n7+n8,5)
-		- k24*_q(n1,1)*_q(n2+n3,2)*_q(n4+n5+n6+n7+n8,5)
-		+ k48*_q(n1+n2+n3,3)*_q(n4+n5+n6+n7+n8,5)
-		- k120*_q(n2,1)*_q(n3,1)*_q(n1+n4+n5+n6+n7+n8,6)
-		+ k120*_q(n2+n3,2)*_q(n1+n4+n5+n6+n7+n8,6)
-		- k120*_q(n1,1)*_q(n3,1)*_q(n2+n4+n5+n6+n7+n8,6)
-		+ k120*_q(n1+n3,2)*_q(n2+n4+n5+n6+n7+n8,6)
-		+ k720*_q(n3,1)*_q(n1+n2+n4+n5+n6+n7+n8,7)
-		- k120*_q(n1,1)*_q(n2,1)*_q(n3+n4+n5+n6+n7+n8,6)
-		+ k120*_q(n1+n2,2)*_q(n3+n4+n5+n6+n7+n8,6)
-		+ k720*_q(n2,1)*_q(n1+n3+n4+n5+n6+n7+n8,7)
-		+ k720*_q(n1,1)*_q(n2+n3+n4+n5+n6+n7+n8,7)
-		- k5040*_q(n1+n2+n3+n4+n5+n6+n7+n8,8));
+	const Harmonic h[] = { n1, n2, n3, n4, n5, n6, n7 };
+	return expand(q, 7, h);
       }
-#endif // CORRELATIONS_CLOSED_IGNORE_U8
       /**
        * Do the 8-particle calculation
        *
+       * @param q  Q-vector
+       * @param ws Workspace
        * @param n1 1st Harmonic
        * @param n2 2nd Harmonic
        * @param n3 3rd Harmonic
@@ -5637,8 +248,8 @@ namespace correlations {
        *
        * @return The correlator
        */
-#ifdef CORRELATIONS_CLOSED_ENABLE_U8
-      Complex uc8(const Harmonic n1,
+      Complex uc8(const QVector& q, Workspace&,
+		  const Harmonic n1,
 		  const Harmonic n2,
 		  const Harmonic n3,
 		  const Harmonic n4,
@@ -5647,25 +258,9 @@ namespace correlations {
 		  const Harmonic n7,
 		  const Harmonic n8) const
       {
-	return (uc8P1(n1,n2,n3,n4,n5,n6,n7,n8)
-		+ uc8P2(n1,n2,n3,n4,n5,n6,n7,n8)
-		+ uc8P3(n1,n2,n3,n4,n5,n6,n7,n8)
-		+ uc8P4(n1,n2,n3,n4,n5,n6,n7,n8));
-      }
-#else
-      Complex uc8(const Harmonic,
-		  const Harmonic,
-		  const Harmonic,
-		  const Harmonic,
-		  const Harmonic,
-		  const Harmonic,
-		  const Harmonic,
-		  const Harmonic) const
-      {
-	std::cerr << "closed-form un-correted 8-particle correlator disabled at compile-time" << std::endl;
-	return Complex(0,0);
+	const Harmonic h[] = { n1, n2, n3, n4, n5, n6, n7, n8 };
+	return expand(q, 8, h);
       }
-#endif // CORRELATIONS_CLOSED_IGNORE_U8
     };
   }
 }
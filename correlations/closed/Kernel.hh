@@ -0,0 +1,116 @@
+#ifndef CORRELATIONS_CLOSED_KERNEL_HH
+#define CORRELATIONS_CLOSED_KERNEL_HH
+/**
+ * @file   correlations/closed/Kernel.hh
+ * @date   Sat Oct 17 07:35:16 2026
+ *
+ * @brief  Closed-form expressions of the correlators
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <correlations/QVector.hh>
+#include <iostream>
+
+#ifndef CORRELATIONS_NOINLINE
+# ifdef __GNUC__
+/** Keeps the parts of the generated expressions out of line */
+#  define CORRELATIONS_NOINLINE __attribute__((noinline))
+# else
+#  define CORRELATIONS_NOINLINE
+# endif
+#endif
+/**
+ * @{
+ * @name Generated closed-form expressions
+ *
+ * Taking out the block @f$ B@f$ holding the first of the slots @f$
+ * S@f$ gives the recurrence
+ *
+ * @f[
+ *   C(S) = \sum_{B\subseteq S, \min S\in B} (-1)^{|B|-1}(|B|-1)!\,
+ *   Q_{\sum_{j\in B}h_j,|B|}\,C(S\setminus B)
+ * @f]
+ *
+ * with @f$ C(\emptyset)=1@f$.  This is written out as straight-line
+ * code for each order @f$ N@f$ by @c print @c -t @c closed (see
+ * correlations/progs/print.cc), one header per order, with the
+ * correlators of the @f$ 2^{N-1}@f$ sub-sets of the last @f$ N-1@f$
+ * slots calculated once each.  The number of multiplications then
+ * grows like @f$ 3^{N-1}@f$ rather than like the Bell numbers of the
+ * fully expanded expressions.  The real and imaginary parts are kept
+ * in separate arrays, and each sum is in Horner form.
+ */
+#include <correlations/closed/Expand1.hh>
+#include <correlations/closed/Expand2.hh>
+#include <correlations/closed/Expand3.hh>
+#include <correlations/closed/Expand4.hh>
+#include <correlations/closed/Expand5.hh>
+#include <correlations/closed/Expand6.hh>
+#include <correlations/closed/Expand7.hh>
+#include <correlations/closed/Expand8.hh>
+#if CORRELATIONS_CLOSED_MAX >= 9
+# include <correlations/closed/Expand9.hh>
+#endif
+#if CORRELATIONS_CLOSED_MAX >= 10
+# include <correlations/closed/Expand10.hh>
+#endif
+/* @} */
+
+namespace correlations {
+  namespace closed {
+    //____________________________________________________________________
+    /**
+     * Calculate the @a n particle correlator from its closed-form
+     * expression (the generated expand1, ..., expand10).  Include
+     * this through correlations/Kernels.hh.
+     *
+     * @param q Q-vector
+     * @param n How many particles to correlate (at most
+     * CORRELATIONS_CLOSED_MAX)
+     * @param h Harmonics (at least @a n)
+     *
+     * @return @f$ QC\{n\}@f$
+     */
+    CORRELATIONS_KERNEL Complex expand(const QVector& q, Size n,
+				       const Harmonic* h)
+    {
+      switch (n) {
+      case 1: return expand1(q, h);
+      case 2: return expand2(q, h);
+      case 3: return expand3(q, h);
+      case 4: return expand4(q, h);
+      case 5: return expand5(q, h);
+      case 6: return expand6(q, h);
+      case 7: return expand7(q, h);
+      case 8: return expand8(q, h);
+#if CORRELATIONS_CLOSED_MAX >= 9
+      case 9: return expand9(q, h);
+#endif
+#if CORRELATIONS_CLOSED_MAX >= 10
+      case 10: return expand10(q, h);
+#endif
+      }
+      std::cerr << "Number of correlators too big:" << n << std::endl;
+      return Complex();
+    }
+  }
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
@@ -0,0 +1,197 @@
+#ifndef CORRELATIONS_DAG_FROMQVECTOR_HH
+#define CORRELATIONS_DAG_FROMQVECTOR_HH
+/**
+ * @file   correlations/dag/FromQVector.hh
+ * @date   Sat Oct 17 07:04:15 2026
+ *
+ * @brief  Cumulant code using compiled expression graphs
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <correlations/FromQVector.hh>
+#include <correlations/CorrelatorDag.hh>
+#include <correlations/Kernels.hh>
+
+namespace correlations {
+  /**
+   * Namespace for calculations using compiled expression graphs
+   */
+  namespace dag {
+    //____________________________________________________________________
+    /**
+     * Structure to calculate Cumulants of arbitrary order from a
+     * given Q vector, using expression graphs with common
+     * sub-expressions eliminated (see correlations::CorrelatorDag),
+     * compiled once for a given harmonic vector.
+     *
+     * Typically the harmonics are fixed for a whole analysis.  When
+     * the correlator is prepared for a harmonic vector @f$
+     * h=(h_1,\ldots,h_m)@f$, graphs for @f$ C\{n\}(h_1,\ldots,h_n)@f$
+     * are made for @f$ n=2,\ldots,m@f$, except where all harmonics
+     * are equal.  Those, and the denominators, are calculated by
+     * correlations::FromQVector::identical.  Correlators of other
+     * harmonics are calculated by the recurrence (see
+     * correlations::recurrence::FromQVector), without making a graph.
+     *
+     * Many events, e.g., read back from a correlations::QStoreReader,
+     * can be processed at once with vector instructions (see
+     * CorrelatorDag::evaluate):
+     *
+     @code
+     const correlations::QVector* qs[n];
+     ...
+     c.calculate(qs, n, h.size(), h, results, ws);
+     @endcode
+     *
+     @code
+     correlations::HarmonicVector      h(8);
+     correlations::QVector             q(h, true);
+     correlations::dag::FromQVector    c(q, h);
+     while (moreEvents) {
+       ...
+       r += c.calculate(h);
+     }
+     @endcode
+     *
+     * @headerfile ""  <correlations/dag/FromQVector.hh>
+     */
+    struct FromQVector : public correlations::FromQVector
+    {
+      /**
+       * Constructor
+       *
+       * @param q Q vector to use
+       * @param h Harmonics to prepare graphs for
+       */
+      FromQVector(QVector& q, const HarmonicVector& h)
+	: correlations::FromQVector(q), _dags()
+      {
+	_maxFixed = 0;
+	prepare(q, h);
+      }
+      /**
+       * Constructor of a correlator not bound to a Q-vector.  Use
+       * prepare to make the graphs.
+       */
+      FromQVector()
+	: correlations::FromQVector(), _dags()
+      {
+	_maxFixed = 0;
+      }
+      /**
+       * Make the graphs for the harmonics @a h, for @f$ Q@f$-vectors
+       * laid out like @a q.  This is not thread-safe, and should be
+       * done before the correlator is used.
+       *
+       * @param q Q-vector to take the layout from
+       * @param h Harmonics
+       */
+      void prepare(const QVector& q, const HarmonicVector& h)
+      {
+	_dags.clear();
+	// Correlators of equal harmonics, and so the denominators, are
+	// calculated by correlations::FromQVector::identical
+	for (Size n = 2; n <= h.size(); n++)
+	  if (std::count(h.begin(), h.begin() + n, h[0]) != n)
+	    _dags.push_back(CorrelatorDag(q, n, h));
+      }
+      using correlations::FromQVector::calculate;
+      /**
+       * Calculate the @a n particle correlator of harmonics @a h for
+       * several events at once.  If there is a graph for @a n and @a
+       * h, it is evaluated for simd::kLanes events at a time (see
+       * CorrelatorDag::evaluate).  Otherwise, each event is
+       * calculated by itself.
+       *
+       * @param q  Q-vectors of the events
+       * @param nq Number of events
+       * @param n  Number of particles to correlate
+       * @param h  Harmonics
+       * @param r  On return, the result of each event
+       * @param ws Workspace
+       */
+      void calculate(const QVector* const* q, const size_t nq, const Size n,
+		     const HarmonicVector& h, Result* r, Workspace& ws) const
+      {
+	const CorrelatorDag* d = find(n, h);
+	for (size_t e = 0; e < nq; e++) {
+	  if (d) {
+	    ws.use(*q[e]);
+	    r[e] = Result(Complex(), denominator(*q[e], ws, n));
+	  }
+	  else
+	    r[e] = calculate(*q[e], n, h, ws);
+	}
+	if (!d) return;
+
+	Complex c[simd::kLanes];
+	for (size_t e = 0; e < nq; e += simd::kLanes) {
+	  const size_t ne = std::min(size_t(simd::kLanes), nq - e);
+	  d->evaluate(q + e, ne, c, ws.r);
+	  for (size_t l = 0; l < ne; l++) r[e+l] = c[l];
+	}
+      }
+      /**
+       * Find the graph of the @a n particle correlator of harmonics @a h
+       *
+       * @param n Number of particles
+       * @param h Harmonics
+       *
+       * @return Pointer to graph, or null if there is none
+       */
+      const CorrelatorDag* find(const Size n, const HarmonicVector& h) const
+      {
+	for (DagVector::const_iterator p = _dags.begin();
+	     p != _dags.end(); ++p)
+	  if (p->matches(n, h)) return &(*p);
+	return 0;
+      }
+      /**
+       * @return Name of the correlator
+       */
+      virtual const char* name() const { return "Compiled graph cumulant"; }
+    protected:
+      /** Type of list of graphs */
+      typedef std::vector<CorrelatorDag> DagVector;
+      /**
+       * Calculate the multi-particle correlation using a graph, or
+       * the recurrence if no graph was made for @a h
+       *
+       * @param q  Q-vector
+       * @param ws Workspace
+       * @param n  Order of correlation (number of particles to correlate)
+       * @param h  Harmonics
+       *
+       * @return @f$ QC{n}@f$
+       */
+      Complex ucN(const QVector& q, Workspace& ws,
+		  const Size n, const HarmonicVector& h) const
+      {
+	const CorrelatorDag* p = find(n, h);
+	if (p) return p->evaluate(q, ws.z);
+	return recurrence::expand(q, ws, n, &(h[0]));
+      }
+      /** Compiled graphs */
+      DagVector _dags;
+    };
+  }
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
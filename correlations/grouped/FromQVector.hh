@@ -0,0 +1,208 @@
+#ifndef CORRELATIONS_GROUPED_FROMQVECTOR_HH
+#define CORRELATIONS_GROUPED_FROMQVECTOR_HH
+/**
+ * @file   correlations/grouped/FromQVector.hh
+ * @date   Sat Oct 17 07:06:30 2026
+ *
+ * @brief  Cumulant code for harmonics grouped by multiplicity
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <correlations/FromQVector.hh>
+#include <algorithm>
+
+namespace correlations {
+  /**
+   * Namespace for calculations on harmonics grouped by multiplicity
+   */
+  namespace grouped {
+    //____________________________________________________________________
+    /**
+     * Structure to calculate Cumulants of arbitrary order from a
+     * given Q vector, treating equal harmonics as one group.
+     *
+     * In flow analyses the harmonics are nearly always heavily
+     * repeated, e.g., @f$ v_2\{8\}@f$ uses @f$ (2,2,2,2,-2,-2,-2,-2)@f$.
+     * The harmonics are therefore collapsed into @f$ G@f$ groups of
+     * distinct values @f$ v_g@f$ with multiplicities @f$ m_g@f$, and
+     * the correlator is calculated over multi-set partitions.  Let
+     * @f$ C(c)@f$ be the correlator of @f$ c_g\le m_g@f$ harmonics of
+     * each group, and @f$ f@f$ the first group with @f$ c_f>0@f$.
+     * Taking out the block that holds one particular harmonic of
+     * group @f$ f@f$, with @f$ b_g@f$ harmonics of group @f$ g@f$,
+     * gives
+     *
+     * @f[
+     *   C(c) = \sum_{b\le c, b_f\ge1} \binom{c_f-1}{b_f-1}
+     *   \prod_{g\neq f}\binom{c_g}{b_g}\, (-1)^{k-1}(k-1)!\,
+     *   Q_{\sum_g b_g v_g,k}\, C(c-b)
+     * @f]
+     *
+     * where @f$ k=\sum_g b_g@f$, and @f$ C(0)=1@f$.  All @f$
+     * \prod_g(m_g+1)@f$ values of @f$ C(c)@f$ are calculated in
+     * order, which takes @f$ \prod_g (m_g+1)(m_g+2)/2@f$ terms,
+     * instead of the Bell number @f$ B_n@f$ terms of the expanded
+     * correlator.  For @f$ v_2\{16\}@f$ that is 2025 terms rather
+     * than @f$ 10^{10}@f$, and the all-zero denominators take only
+     * @f$ (n+1)(n+2)/2@f$ terms.  For all different harmonics this
+     * degrades to @f$ 3^n@f$ terms.
+     *
+     * Nothing is prepared in advance, so any harmonics can be passed
+     * on each call.  The work buffers live in the workspace (see
+     * correlations::Workspace).
+     *
+     * @headerfile ""  <correlations/grouped/FromQVector.hh>
+     */
+    struct FromQVector : public correlations::FromQVector
+    {
+      /**
+       * Constructor
+       *
+       * @param q Q vector to use
+       */
+      FromQVector(QVector& q)
+	: correlations::FromQVector(q)
+      {
+	_maxFixed = 0;
+      }
+      /**
+       * Constructor of a correlator not bound to a Q-vector
+       */
+      FromQVector()
+	: correlations::FromQVector()
+      {
+	_maxFixed = 0;
+      }
+      /**
+       * @return Name of the correlator
+       */
+      virtual const char* name() const { return "Grouped cumulant"; }
+    protected:
+      /**
+       * Calculate the multi-particle correlation over groups of
+       * equal harmonics
+       *
+       * @param q  Q-vector
+       * @param ws Workspace
+       * @param n  Order of correlation (number of particles to correlate)
+       * @param h  Harmonics
+       *
+       * @return @f$ QC{n}@f$
+       */
+      Complex ucN(const QVector& q, Workspace& ws,
+		  const Size n, const HarmonicVector& h) const
+      {
+	if (n == 0) return Complex(1, 0);
+
+	// Group the harmonics.  v[g] is the value and m[g] the
+	// multiplicity of group g.
+	HarmonicVector& v = ws.hh;
+	v.assign(h.begin(), h.begin() + n);
+	std::sort(v.begin(), v.end());
+	ws.idx.resize(4 * n);
+	size_t* m      = &(ws.idx[0]);
+	size_t* stride = m + n;
+	size_t* c      = stride + n;
+	size_t* b      = c + n;
+	Size    ng     = 0;
+	for (Size i = 0; i < n; i++) {
+	  if (ng > 0 && v[i] == v[ng-1]) {
+	    m[ng-1]++;
+	    continue;
+	  }
+	  v[ng] = v[i];
+	  m[ng] = 1;
+	  ng++;
+	}
+	size_t ns = 1;
+	for (Size g = 0; g < ng; g++) {
+	  stride[g] = ns;
+	  c[g]      = 0;
+	  ns        *= m[g] + 1;
+	}
+
+	// Binomial coefficients, and the weights (-1)^(k-1)(k-1)! of
+	// blocks of size k
+	const size_t nb = n + 1;
+	ws.r.resize(nb * nb + nb);
+	Real* binom = &(ws.r[0]);
+	Real* w     = binom + nb * nb;
+	for (size_t i = 0; i < nb; i++) {
+	  binom[i * nb] = 1;
+	  for (size_t j = 1; j <= i; j++)
+	    binom[i * nb + j] = binom[(i-1) * nb + j - 1]
+	      + (j < i ? binom[(i-1) * nb + j] : 0);
+	}
+	w[0] = 0;
+	w[1] = 1;
+	for (size_t k = 2; k < nb; k++) w[k] = -Real(k - 1) * w[k-1];
+
+	// The correlators C(c) in order of the index sum_g c[g]
+	// stride[g], so that C(c-b) is always known before C(c)
+	if (ws.z.size() < ns) ws.z.resize(ns);
+	PlainComplex* z = &(ws.z[0]);
+	z[0] = PlainComplex(1, 0);
+	for (size_t s = 1; s < ns; s++) {
+	  Size g = 0;
+	  while (c[g] == m[g]) c[g++] = 0;
+	  c[g]++;
+	  Size f = 0;
+	  while (c[f] == 0) f++;
+
+	  // Sum over the blocks b that hold a harmonic of group f
+	  PlainComplex r;
+	  size_t       bi = stride[f];
+	  b[f]            = 1;
+	  for (Size j = f + 1; j < ng; j++) b[j] = 0;
+	  while (true) {
+	    Real     coef = binom[(c[f] - 1) * nb + b[f] - 1];
+	    Harmonic sum  = b[f] * v[f];
+	    Power    k    = b[f];
+	    for (Size j = f + 1; j < ng; j++) {
+	      if (b[j] == 0) continue;
+	      coef *= binom[c[j] * nb + b[j]];
+	      sum  += b[j] * v[j];
+	      k    += b[j];
+	    }
+	    r.mac(coef * w[k], q(sum, k), z[s - bi]);
+
+	    // Next block
+	    Size j = f;
+	    for (; j < ng; j++) {
+	      if (b[j] < c[j]) {
+		b[j]++;
+		bi += stride[j];
+		break;
+	      }
+	      const size_t first = (j == f ? 1 : 0);
+	      bi   -= (b[j] - first) * stride[j];
+	      b[j] =  first;
+	    }
+	    if (j == ng) break;
+	  }
+	  z[s] = r;
+	}
+	return z[ns - 1].complex();
+      }
+    };
+  }
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
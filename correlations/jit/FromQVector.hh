@@ -0,0 +1,324 @@
+#ifndef CORRELATIONS_JIT_FROMQVECTOR_HH
+#define CORRELATIONS_JIT_FROMQVECTOR_HH
+/**
+ * @file   correlations/jit/FromQVector.hh
+ * @date   Sat Oct 17 07:39:50 2026
+ *
+ * @brief  Cumulant code compiled to native code at run-time
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <correlations/recursive/FromQVector.hh>
+#include <correlations/CorrelatorDag.hh>
+#include <correlations/Cache.hh>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#if defined(__unix__) || defined(__unix) || defined(unix) \
+  || defined(__APPLE__)
+# include <dlfcn.h>
+# include <unistd.h>
+# define CORRELATIONS_JIT_DLOPEN
+#endif
+
+namespace correlations {
+  /**
+   * Namespace for calculations compiled to native code at run-time
+   */
+  namespace jit {
+    //____________________________________________________________________
+    /**
+     * Structure to calculate Cumulants of arbitrary order from a
+     * given Q vector, with code generated and compiled for a given
+     * harmonic vector at run-time.
+     *
+     * When the correlator is prepared for the harmonic vector @f$
+     * h=(h_1,\ldots,h_m)@f$, the expression graphs of @f$
+     * C\{n\}(h_1,\ldots,h_n)@f$, @f$ n=2,\ldots,m@f$ (see
+     * correlations::CorrelatorDag) are written out as C++ functions
+     * (see CorrelatorDag::emit), with the locations of the @f$
+     * Q@f$-vector components and all coefficients as constants.
+     * That source is compiled by the local compiler into a shared
+     * library, which is loaded, and the functions are called per
+     * event.
+     *
+     * The library is kept in a cache directory (see cacheDirectory),
+     * under a name derived from the source and the compiler command,
+     * so it is only compiled the first time a harmonic vector and
+     * @f$ Q@f$-vector layout are seen.  The compiler command is @c
+     * c++ @c -O2 @c -fPIC @c -shared unless the environment variable
+     * @c CORRELATIONS_CXX is set.
+     *
+     * If the code cannot be compiled or loaded - e.g., when there is
+     * no compiler - or for other harmonics, numbers of particles, or
+     * @f$ Q@f$-vector layouts, the correlators are calculated by
+     * correlations::recursive::FromQVector.  Correlators of equal
+     * harmonics, and the denominators, are calculated by
+     * correlations::FromQVector::identical.
+     *
+     @code
+     correlations::HarmonicVector      h(8);
+     correlations::QVector             q(h, true);
+     correlations::jit::FromQVector    c(q, h);
+     if (!c.isCompiled()) std::cerr << "Using recursion" << std::endl;
+     while (moreEvents) {
+       ...
+       r += c.calculate(h);
+     }
+     @endcode
+     *
+     * @headerfile ""  <correlations/jit/FromQVector.hh>
+     */
+    struct FromQVector : public recursive::FromQVector
+    {
+      /** Type of compiled functions */
+      typedef void (*Kernel)(const Real*, Real*);
+      /** Type of list of compiled functions */
+      typedef std::vector<Kernel> KernelVector;
+      /**
+       * Constructor
+       *
+       * @param q Q vector to use
+       * @param h Harmonics to compile code for
+       */
+      FromQVector(QVector& q, const HarmonicVector& h)
+	: recursive::FromQVector(q), _h(), _layout(), _kernels(), _handle(0),
+	  _library()
+      {
+	prepare(q, h);
+      }
+      /**
+       * Constructor of a correlator not bound to a Q-vector.  Use
+       * prepare to compile the code.
+       */
+      FromQVector()
+	: recursive::FromQVector(), _h(), _layout(), _kernels(), _handle(0),
+	  _library()
+      {}
+      /**
+       * Destructor.  Unloads the library.
+       */
+      virtual ~FromQVector() { unload(); }
+      /**
+       * Generate, compile, and load the code for the harmonics @a h,
+       * for @f$ Q@f$-vectors laid out like @a q.  This is not
+       * thread-safe, and should be done before the correlator is
+       * used.
+       *
+       * @param q Q-vector to take the layout from
+       * @param h Harmonics
+       *
+       * @return true if the code was compiled and loaded
+       */
+      bool prepare(const QVector& q, const HarmonicVector& h)
+      {
+	unload();
+	_h      = h;
+	_layout = q.layout();
+	_kernels.assign(h.size() + 1, Kernel(0));
+
+	std::ostringstream src;
+	src << "// Generated by correlations::jit::FromQVector\n\n";
+	for (Size n = 2; n <= h.size(); n++) {
+	  if (std::count(h.begin(), h.begin() + n, h[0]) == n) continue;
+	  CorrelatorDag(q, n, h).emit(src, symbol(n));
+	}
+	return load(src.str());
+      }
+      /**
+       * @return true if compiled code is used
+       */
+      bool isCompiled() const { return _handle != 0; }
+      /**
+       * @return Path of the compiled library, or empty if none
+       */
+      const std::string& library() const { return _library; }
+      /**
+       * Get the directory in which compiled code is kept (see
+       * correlations::Cache::directory)
+       *
+       * @return The directory, or empty if none could be found
+       */
+      static std::string cacheDirectory() { return Cache::directory(); }
+      /**
+       * @return Name of the correlator
+       */
+      virtual const char* name() const { return "JIT compiled cumulant"; }
+    protected:
+      /**
+       * Calculate the multi-particle correlation by compiled code if
+       * there is such for @a n and @a h, and by recursion otherwise
+       *
+       * @param q  Q-vector
+       * @param ws Workspace
+       * @param n  Order of correlation (number of particles to correlate)
+       * @param h  Harmonics
+       *
+       * @return @f$ QC{n}@f$
+       */
+      Complex ucN(const QVector& q, Workspace& ws,
+		  const Size n, const HarmonicVector& h) const
+      {
+	if (n < _kernels.size() && _kernels[n] && q.layout() == _layout
+	    && std::equal(h.begin(), h.begin() + n, _h.begin())) {
+	  Real r[2];
+	  _kernels[n](q.data(), r);
+	  return Complex(r[0], r[1]);
+	}
+	return recursive::FromQVector::ucN(q, ws, n, h);
+      }
+      /**
+       * @param n Number of particles
+       *
+       * @return Name of the compiled function of @a n particles
+       */
+      static std::string symbol(Size n)
+      {
+	std::ostringstream s;
+	s << "correlations_jit_" << n;
+	return s.str();
+      }
+      /**
+       * Compile the source @a src, unless it is already in the cache,
+       * and load it
+       *
+       * @param src Source code
+       *
+       * @return true on success
+       */
+      bool load(const std::string& src)
+      {
+#ifdef CORRELATIONS_JIT_DLOPEN
+	const char*       e    = std::getenv("CORRELATIONS_CXX");
+	const std::string cxx  = (e && *e ? e : "c++ -O2 -fPIC -shared");
+	const std::string text = "// " + cxx + '\n' + src;
+	const std::string base = Cache::path("correlations", text);
+	if (base.empty()) {
+	  std::cerr << "No cache directory for compiled code, "
+		    << "using recursion" << std::endl;
+	  return false;
+	}
+	const std::string lib  = base + ".so";
+
+	// The source is kept with the library, so that a clash of
+	// hashes is caught
+	std::ifstream      in((base + ".cc").c_str());
+	std::ostringstream old;
+	old << in.rdbuf();
+	if (access(lib.c_str(), R_OK) != 0 || old.str() != text) {
+	  // Write, compile, and log to names of our own, and rename
+	  // when done, so concurrent jobs never see a partial source,
+	  // log, or library
+	  std::ostringstream pid;
+	  pid << base << "." << getpid();
+	  const std::string code = pid.str() + ".cc";
+	  const std::string tmp  = pid.str() + ".so";
+	  const std::string log  = pid.str() + ".log";
+	  std::ofstream out(code.c_str());
+	  out << text;
+	  out.close();
+	  const std::string cmd = cxx + " -o " + quote(tmp) + " " + quote(code)
+	    + " > " + quote(log) + " 2>&1";
+	  const bool ok = (out && std::system(cmd.c_str()) == 0 &&
+			   std::rename(tmp.c_str(), lib.c_str()) == 0);
+	  std::rename(log.c_str(), (base + ".log").c_str());
+	  if (!ok) {
+	    std::cerr << "Failed to compile " << base << " (see "
+		      << base << ".log), using recursion" << std::endl;
+	    std::remove(tmp.c_str());
+	    std::remove(code.c_str());
+	    return false;
+	  }
+	  std::rename(code.c_str(), (base + ".cc").c_str());
+	}
+
+	_handle = dlopen(lib.c_str(), RTLD_NOW | RTLD_LOCAL);
+	if (!_handle) {
+	  std::cerr << "Failed to load " << lib << ": " << dlerror()
+		    << ", using recursion" << std::endl;
+	  return false;
+	}
+	_library = lib;
+	for (Size n = 2; n < _kernels.size(); n++) {
+	  // Converting an object pointer to a function pointer is not
+	  // allowed by ISO C++, so copy the bits
+	  void* f = dlsym(_handle, symbol(n).c_str());
+	  if (f) std::memcpy(&(_kernels[n]), &f, sizeof(f));
+	}
+	return true;
+#else
+	(void)src;
+	std::cerr << "No run-time compilation on this platform, "
+		  << "using recursion" << std::endl;
+	return false;
+#endif
+      }
+      /**
+       * Quote @a s for the shell, so that paths with spaces or
+       * special characters are passed as they are
+       *
+       * @param s String
+       *
+       * @return @a s in single quotes
+       */
+      static std::string quote(const std::string& s)
+      {
+	std::string r = "'";
+	for (size_t i = 0; i < s.size(); i++) {
+	  if (s[i] == '\'') r += "'\\''";
+	  else               r += s[i];
+	}
+	return r + "'";
+      }
+      /**
+       * Unload the library, if any
+       */
+      void unload()
+      {
+	std::fill(_kernels.begin(), _kernels.end(), Kernel(0));
+	_library.clear();
+#ifdef CORRELATIONS_JIT_DLOPEN
+	if (_handle) dlclose(_handle);
+#endif
+	_handle = 0;
+      }
+      /** Harmonics the code is for */
+      HarmonicVector  _h;
+      /** Layout of Q-vector the code is for */
+      QVector::Layout _layout;
+      /** Compiled function of each number of particles, or null */
+      KernelVector    _kernels;
+      /** Handle of loaded library */
+      void*           _handle;
+      /** Path of loaded library */
+      std::string     _library;
+    private:
+      /** Not copyable - the library is loaded once */
+      FromQVector(const FromQVector&);
+      /** Not assignable - the library is loaded once */
+      FromQVector& operator=(const FromQVector&);
+    };
+  }
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
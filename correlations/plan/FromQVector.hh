@@ -0,0 +1,150 @@
+#ifndef CORRELATIONS_PLAN_FROMQVECTOR_HH
+#define CORRELATIONS_PLAN_FROMQVECTOR_HH
+/**
+ * @file   correlations/plan/FromQVector.hh
+ * @date   Sat Oct 17 07:00:08 2026
+ *
+ * @brief  Cumulant code using pre-compiled plans
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <correlations/FromQVector.hh>
+#include <correlations/CorrelatorPlan.hh>
+#include <correlations/Kernels.hh>
+
+namespace correlations {
+  /**
+   * Namespace for calculations using pre-compiled plans
+   */
+  namespace plan {
+    //____________________________________________________________________
+    /**
+     * Structure to calculate Cumulants of arbitrary order from a
+     * given Q vector, using plans (see correlations::CorrelatorPlan)
+     * compiled once for a given harmonic vector.
+     *
+     * Typically the harmonics are fixed for a whole analysis.  When
+     * the correlator is prepared for a harmonic vector @f$
+     * h=(h_1,\ldots,h_m)@f$, plans for @f$ C\{n\}(h_1,\ldots,h_n)@f$
+     * are made for @f$ n=2,\ldots,m@f$, except where all harmonics
+     * are equal.  Those, and the denominators, are calculated by
+     * correlations::FromQVector::identical.  Correlators of other
+     * harmonics are calculated by the recurrence (see
+     * correlations::recurrence::FromQVector), without making a plan.
+     *
+     @code
+     correlations::HarmonicVector      h(8);
+     correlations::QVector             q(h, true);
+     correlations::plan::FromQVector   c(q, h);
+     while (moreEvents) {
+       ...
+       r += c.calculate(h);
+     }
+     @endcode
+     *
+     * @headerfile ""  <correlations/plan/FromQVector.hh>
+     */
+    struct FromQVector : public correlations::FromQVector
+    {
+      /**
+       * Constructor
+       *
+       * @param q Q vector to use
+       * @param h Harmonics to prepare plans for
+       */
+      FromQVector(QVector& q, const HarmonicVector& h)
+	: correlations::FromQVector(q), _plans()
+      {
+	_maxFixed = 0;
+	prepare(q, h);
+      }
+      /**
+       * Constructor of a correlator not bound to a Q-vector.  Use
+       * prepare to make the plans.
+       */
+      FromQVector()
+	: correlations::FromQVector(), _plans()
+      {
+	_maxFixed = 0;
+      }
+      /**
+       * Make the plans for the harmonics @a h, for @f$ Q@f$-vectors
+       * laid out like @a q.  This is not thread-safe, and should be
+       * done before the correlator is used.
+       *
+       * @param q Q-vector to take the layout from
+       * @param h Harmonics
+       */
+      void prepare(const QVector& q, const HarmonicVector& h)
+      {
+	_plans.clear();
+	// Correlators of equal harmonics, and so the denominators, are
+	// calculated by correlations::FromQVector::identical
+	for (Size n = 2; n <= h.size(); n++)
+	  if (std::count(h.begin(), h.begin() + n, h[0]) != n)
+	    _plans.push_back(CorrelatorPlan(q, n, h));
+      }
+      /**
+       * Find the plan of the @a n particle correlator of harmonics @a h
+       *
+       * @param n Number of particles
+       * @param h Harmonics
+       *
+       * @return Pointer to plan, or null if there is none
+       */
+      const CorrelatorPlan* find(const Size n, const HarmonicVector& h) const
+      {
+	for (PlanVector::const_iterator p = _plans.begin();
+	     p != _plans.end(); ++p)
+	  if (p->matches(n, h)) return &(*p);
+	return 0;
+      }
+      /**
+       * @return Name of the correlator
+       */
+      virtual const char* name() const { return "Planned cumulant"; }
+    protected:
+      /** Type of list of plans */
+      typedef std::vector<CorrelatorPlan> PlanVector;
+      /**
+       * Calculate the multi-particle correlation using a plan, or
+       * the recurrence if no plan was made for @a h
+       *
+       * @param q  Q-vector
+       * @param ws Workspace
+       * @param n  Order of correlation (number of particles to correlate)
+       * @param h  Harmonics
+       *
+       * @return @f$ QC{n}@f$
+       */
+      Complex ucN(const QVector& q, Workspace& ws,
+		  const Size n, const HarmonicVector& h) const
+      {
+	const CorrelatorPlan* p = find(n, h);
+	if (p) return p->evaluate(q, ws.z);
+	return recurrence::expand(q, ws, n, &(h[0]));
+      }
+      /** Pre-compiled plans */
+      PlanVector _plans;
+    };
+  }
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
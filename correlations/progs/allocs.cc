@@ -0,0 +1,321 @@
+/**
+ * @file   correlations/progs/allocs.cc
+ * @date   Sat Oct 17 06:56:57 2026
+ *
+ * @brief  Count heap allocations per event
+ *
+ * The program takes a number of options.  Do
+ * <pre class="shell">
+ * ./allocs -h
+ * </pre>
+ * for information.
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <correlations/Types.hh>
+#include <correlations/QVector.hh>
+#include <correlations/Workspace.hh>
+#include <correlations/closed/FromQVector.hh>
+#include <correlations/recurrence/FromQVector.hh>
+#include <correlations/recursive/FromQVector.hh>
+#include <correlations/recursive/NestedLoops.hh>
+#include <correlations/Incremental.hh>
+#include <correlations/plan/FromQVector.hh>
+#include <correlations/dag/FromQVector.hh>
+#include <correlations/AutoCorrelator.hh>
+#include <correlations/test/Printer.hh>
+#include <correlations/test/Random.hh>
+#include <iomanip>
+#include <cstdlib>
+#include <new>
+
+/** Number of allocations made so far */
+static unsigned long nAllocs = 0;
+
+/**
+ * Allocate memory, counting the number of allocations
+ *
+ * @param n Number of bytes
+ *
+ * @return Pointer to memory
+ */
+void* operator new(std::size_t n) throw(std::bad_alloc)
+{
+  nAllocs++;
+  void* p = std::malloc(n ? n : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+/**
+ * Allocate memory, counting the number of allocations
+ *
+ * @param n Number of bytes
+ *
+ * @return Pointer to memory
+ */
+void* operator new[](std::size_t n) throw(std::bad_alloc)
+{
+  return operator new(n);
+}
+/**
+ * Free memory
+ *
+ * @param p Pointer to memory
+ */
+void operator delete(void* p) throw() { std::free(p); }
+/**
+ * Free memory
+ *
+ * @param p Pointer to memory
+ */
+void operator delete[](void* p) throw() { std::free(p); }
+
+/**
+ * Show usage information
+ *
+ * @param prog Run name
+ */
+void
+usage(const char* prog)
+{
+  using correlations::test::helpline;
+  std::cout << "Usage: " << prog << " [OPTIONS]\n\n"
+            << "Options:" << std::endl;
+
+  helpline(std::cout, 'h', "",       "This help",                   "");
+  helpline(std::cout, 'e', "NEVENTS","Number of events",            "20");
+  helpline(std::cout, 'w', "NWARM",  "Number of warm-up events",    "2");
+  helpline(std::cout, 'm', "NPART",  "Number of particles/event",   "30");
+  helpline(std::cout, 'n', "MAXN",   "Largest correlator",          "8");
+  helpline(std::cout, 'l', "MAXL",   "Largest nested-loop correlator","3");
+}
+
+/**
+ * Entry point for program.
+ *
+ * Generate a number of random events, and for each event fill the
+ * Q-vector and calculate correlators up to @c MAXN with all the
+ * algorithms - through both the bound and the workspace interface
+ * of correlations::FromQVector - as well as with nested loops up to
+ * @c MAXL.  The number of heap allocations per event is printed for
+ * each algorithm.  After the first few (warm-up) events, no
+ * allocations should be made.  A correlations::plan::FromQVector
+ * and a correlations::dag::FromQVector, neither prepared, and a
+ * correlations::AutoCorrelator prepared for equal harmonics only,
+ * are also run, so that all their correlators are calculated by the
+ * fall-back, and compared to the recurrence.  Finally, a
+ * correlations::Incremental is filled without weights and compared
+ * to one filled with unit weights.  If no allocations are made and
+ * the results agree, the program exits with 0, and otherwise with 1.
+ *
+ * @param argc Number of arguments
+ * @param argv Vector of arguments
+ *
+ * @return 0 if no allocations were made after warm-up, and the
+ * unprepared correlators agree with the recurrence, and null
+ * weights with unit weights
+ */
+int
+main(int argc, char** argv)
+{
+  using correlations::QVector;
+  using correlations::Real;
+  using correlations::RealVector;
+  using correlations::HarmonicVector;
+  using correlations::Result;
+  using correlations::Size;
+  using correlations::Workspace;
+  using correlations::test::Random;
+
+  unsigned int nEvents = 20;
+  unsigned int nWarm   = 2;
+  unsigned int mult    = 30;
+  Size         maxN    = 8;
+  Size         maxL    = 3;
+  for (int i = 1; i < argc; i++) {
+    if (argv[i][0] == '-') {
+      switch (argv[i][1]) {
+      case 'h': usage(argv[0]); return 0;
+      case 'e': nEvents = atoi(argv[++i]); break;
+      case 'w': nWarm   = atoi(argv[++i]); break;
+      case 'm': mult    = atoi(argv[++i]); break;
+      case 'n': maxN    = atoi(argv[++i]); break;
+      case 'l': maxL    = atoi(argv[++i]); break;
+      default:
+        std::cerr << argv[0] << ": Unknown option " << argv[i] << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  HarmonicVector h(maxN);
+  Random::seed(54321);
+  for (size_t i = 0; i < h.size(); i++) h[i] = Random::asHarmonic(-6, 6);
+
+  RealVector phis(mult);
+  RealVector weights(mult);
+  RealVector ones(mult, 1);
+  QVector    q(h, true);
+  Workspace  ws[8];
+  correlations::closed::FromQVector     closed(q);
+  correlations::recurrence::FromQVector recurrence(q);
+  correlations::recursive::FromQVector  recursive(q);
+  correlations::recursive::NestedLoops  loops(phis, weights);
+  correlations::closed::FromQVector     wsClosed;
+  correlations::recurrence::FromQVector wsRecurrence;
+  correlations::recursive::FromQVector  wsRecursive;
+  correlations::plan::FromQVector       wsPlan;
+  correlations::dag::FromQVector        wsDag;
+  correlations::Incremental             unitWeights(h);
+  correlations::Incremental             nullWeights(h);
+
+  // Prepared for equal harmonics only, so other harmonics of all
+  // orders - also above the closed forms - go to the fall-back
+  const Size     nAuto = 10;
+  HarmonicVector equal(nAuto, 2);
+  HarmonicVector g(nAuto);
+  for (Size i = 0; i < nAuto; i++) g[i] = (i % 2 ? -1 : 1) * (i / 2 + 1);
+  QVector                      qa(30, nAuto, true);
+  correlations::AutoCorrelator wsAuto(qa, equal, false);
+
+  const char* names[] = { "fill", "closed", "recurrence", "recursive",
+                          "closed(ws)", "recurrence(ws)", "recursive(ws)",
+                          "nested loops", "h1..h8", "plan(unprepared)",
+                          "dag(unprepared)", "incremental",
+                          "auto(unprepared)", "nested loops(ws)", 0 };
+  const size_t nTasks = 14;
+  std::vector<unsigned long> counts(nTasks, 0);
+  const Size maxClosed = (maxN < 6 ? maxN : 6);
+  Result     r;
+  bool       same = true;
+  bool       unit = true;
+
+  for (unsigned int e = 0; e < nEvents + nWarm; e++) {
+    for (size_t i = 0; i < mult; i++) {
+      phis[i]    = Random::asReal(0, 2 * M_PI);
+      weights[i] = Random::asReal(0.5, 1.5);
+    }
+    for (size_t t = 0; t < nTasks; t++) {
+      const unsigned long before = nAllocs;
+      switch (t) {
+      case 0:
+        q.reset();
+        q.fill(&(phis[0]), &(weights[0]), mult);
+        break;
+      case 1:
+        for (Size n = 1; n <= maxClosed; n++) r += closed.calculate(n, h);
+        break;
+      case 2:
+        for (Size n = 1; n <= maxN; n++) r += recurrence.calculate(n, h);
+        break;
+      case 3:
+        for (Size n = 1; n <= maxN; n++) r += recursive.calculate(n, h);
+        break;
+      case 4:
+        for (Size n = 1; n <= maxClosed; n++)
+          r += wsClosed.calculate(q, n, h, ws[0]);
+        break;
+      case 5:
+        for (Size n = 1; n <= maxN; n++)
+          r += wsRecurrence.calculate(q, n, h, ws[1]);
+        break;
+      case 6:
+        for (Size n = 1; n <= maxN; n++)
+          r += wsRecursive.calculate(q, n, h, ws[2]);
+        break;
+      case 7:
+        for (Size n = 1; n <= maxL; n++) r += loops.calculate(n, h);
+        break;
+      case 8:
+        r += recurrence.calculate(h[0], h[1], h[2], h[3]);
+        break;
+      case 9:
+        // No plans were made, so all goes through the fall-back
+        for (Size n = 1; n <= maxN; n++) {
+          const Result p = wsPlan.calculate(q, n, h, ws[3]);
+          const Result c = wsRecurrence.calculate(q, n, h, ws[1]);
+          if (std::abs(p.eval() - c.eval()) > 1e-9 * std::abs(c.eval()))
+            same = false;
+          r += p;
+        }
+        break;
+      case 10:
+        for (Size n = 1; n <= maxN; n++) {
+          const Result d = wsDag.calculate(q, n, h, ws[4]);
+          const Result c = wsRecurrence.calculate(q, n, h, ws[1]);
+          if (std::abs(d.eval() - c.eval()) > 1e-9 * std::abs(c.eval()))
+            same = false;
+          r += d;
+        }
+        break;
+      case 11:
+        // Null weights must be the same as unit weights
+        unitWeights.reset();
+        nullWeights.reset();
+        unitWeights.fill(&(phis[0]), &(ones[0]), mult);
+        nullWeights.fill(&(phis[0]), 0, mult);
+        for (Size n = 1; n <= maxN; n++) {
+          const Result a = nullWeights.calculate(n, h);
+          const Result b = unitWeights.calculate(n, h);
+          if (a.eval() != b.eval()) unit = false;
+          r += a;
+        }
+        break;
+      case 12:
+        qa.reset();
+        qa.fill(&(phis[0]), &(weights[0]), mult);
+        for (Size n = 1; n <= nAuto; n++) {
+          const Result a = wsAuto.calculate(qa, n, g, ws[5]);
+          const Result c = wsRecurrence.calculate(qa, n, g, ws[6]);
+          if (std::abs(a.eval() - c.eval()) > 1e-9 * std::abs(c.eval()))
+            same = false;
+          r += a;
+        }
+        break;
+      case 13:
+        for (Size n = 1; n <= maxL; n++) r += loops.calculate(n, h, ws[7]);
+        break;
+      }
+      if (e >= nWarm) counts[t] += nAllocs - before;
+    }
+  }
+
+  bool ok = true;
+  std::cout << "Allocations per event after " << nWarm << " warm-up events"
+            << std::endl;
+  for (size_t t = 0; t < nTasks; t++) {
+    const Real perEvent = Real(counts[t]) / (nEvents ? nEvents : 1);
+    std::cout << "  " << std::left << std::setw(16) << names[t]
+              << std::right << std::setw(10) << perEvent << std::endl;
+    if (counts[t] > 0) ok = false;
+  }
+  if (!same) {
+    std::cout << "Unprepared plan, graph, or automatic correlator "
+              << "differs from recurrence" << std::endl;
+    ok = false;
+  }
+  if (!unit) {
+    std::cout << "Null weights differ from unit weights" << std::endl;
+    ok = false;
+  }
+  std::cout << "Result: " << r.eval() << std::endl;
+  return ok ? 0 : 1;
+}
+//
+// EOF
+//
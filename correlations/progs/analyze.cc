@@ -55,6 +55,19 @@ usage(const char* prog)
   helpline(std::cout, 'o', "FILENAME","Output file name",           "MODE.dat");
   helpline(std::cout, 'n', "MAXH",    "Maximum correlator",         "6");
   helpline(std::cout, 't', "MODE",    "Which algorithm to use",     "closed");
+  helpline(std::cout, 's', "STORAGE", "Q-vector storage",           "full");
+  helpline(std::cout, 'u', "",        "Do not use weights",         "false");
+  helpline(std::cout, 'j', "NTHREADS","Threads to fill Q-vector",   "1");
+  helpline(std::cout, 'Q', "FILENAME","Read Q-vector store",        "");
+  helpline(std::cout, 'q', "FILENAME","Write Q-vector store",       "");
+  helpline(std::cout, 'N', "MAXN",    "Largest harmonic in store",  "24");
+  helpline(std::cout, 'P', "MAXP",    "Largest power in store",     "8");
+  std::cout << "\nMODE is one of: closed, recurrence, recursive, plan, dag,\n"
+            << "grouped, incremental, jit, auto"
+            << std::endl;
+  std::cout << "\nSTORAGE is a comma separated list of: "
+            << "full, half, sparse, aos, soa,\n"
+            << "harmonic, power" << std::endl;
 }
 
 struct to_upper
@@ -93,6 +106,12 @@ struct to_lower
  * form, full loop calculations, and @c recursive.dat for recursive
  * cumulant and nested loop calculations
  *
+ * With the option @c -q, the @f$ Q@f$-vectors of the events, up to
+ * the harmonic and power given by @c -N and @c -P, are written to a
+ * store (see correlations::QStoreWriter).  With the option @c -Q, the
+ * @f$ Q@f$-vectors are read from such a store instead of the
+ * observations from the data file, and no nested loops are done.
+ *
  * @param argc Number of arguments
  * @param argv Vector of arguments
  *
@@ -103,10 +122,17 @@ main(int argc, char** argv)
 {
   bool           loops     = true;
   bool           verbose   = false;
+  bool           weights   = true;
   unsigned short maxH      = 6;
+  unsigned int   nThreads  = 1;
+  unsigned short maxQN     = 24;
+  unsigned short maxQP     = 8;
   std::string    input("data.dat");
   std::string    output("");
   std::string    smode("closed");
+  std::string    sstore("full");
+  std::string    qin("");
+  std::string    qout("");
   for (int i = 1; i < argc; i++) {
     if (argv[i][0] == '-') {
       switch (argv[i][1]) {
@@ -114,10 +140,17 @@ main(int argc, char** argv)
       case 'l': loops     = false; break;
       case 'L': loops     = true;  break;
       case 'v': verbose   = true;  break;
+      case 'u': weights   = false; break;
       case 'n': maxH      = atoi(argv[++i]); break;
+      case 'j': nThreads  = atoi(argv[++i]); break;
+      case 'Q': qin       = argv[++i]; break;
+      case 'q': qout      = argv[++i]; break;
+      case 'N': maxQN     = atoi(argv[++i]); break;
+      case 'P': maxQP     = atoi(argv[++i]); break;
       case 'i': input     = argv[++i]; break;
       case 'o': output    = argv[++i]; break;
       case 't': smode     = argv[++i]; break;
+      case 's': sstore    = argv[++i]; break;
       default:
         std::cerr << argv[0] << ": Unknown option " << argv[i] << std::endl;
         return 1;
@@ -127,11 +160,25 @@ main(int argc, char** argv)
   using correlations::test::Tester;
 
   std::transform(smode.begin(),smode.end(), smode.begin(), to_upper());
+  std::transform(sstore.begin(),sstore.end(), sstore.begin(), to_upper());
   std::ifstream in(input.c_str());
 
-  Tester t(in, Tester::str2mode(smode), maxH, loops, verbose);
+  Tester t(in, Tester::str2mode(smode), maxH, loops, verbose,
+           Tester::str2storage(sstore), weights, nThreads);
+  correlations::QStoreReader* reader = 0;
+  correlations::QStoreWriter* writer = 0;
+  if (!qin.empty()) {
+    reader = new correlations::QStoreReader(qin);
+    if (!t.readStore(reader)) return 1;
+  }
+  else if (!qout.empty()) {
+    writer = new correlations::QStoreWriter(qout, maxQN, maxQP, weights);
+    t.writeStore(writer);
+  }
   while (t.event()) {};
   t.end(std::cout);
+  delete reader;
+  delete writer;
 
   in.close();
 
@@ -0,0 +1,272 @@
+/**
+ * @file   correlations/progs/bench.cc
+ * @date   Sat Oct 17 06:38:04 2026
+ *
+ * @brief  Benchmark the Q-vector storage layouts
+ *
+ * The program takes a number of options.  Do
+ * <pre class="shell">
+ * ./bench -h
+ * </pre>
+ * for information.
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <correlations/Types.hh>
+#include <correlations/QVector.hh>
+#include <correlations/closed/FromQVector.hh>
+#include <correlations/recurrence/FromQVector.hh>
+#include <correlations/recursive/FromQVector.hh>
+#include <correlations/grouped/FromQVector.hh>
+#include <correlations/plan/FromQVector.hh>
+#include <correlations/dag/FromQVector.hh>
+#include <correlations/jit/FromQVector.hh>
+#include <correlations/test/Printer.hh>
+#include <correlations/test/Random.hh>
+#include <correlations/test/Stopwatch.hh>
+#include <algorithm>
+#include <iomanip>
+#include <cstdlib>
+
+/**
+ * Show usage information
+ *
+ * @param prog Run name
+ */
+void
+usage(const char* prog)
+{
+  using correlations::test::helpline;
+  std::cout << "Usage: " << prog << " [OPTIONS]\n\n"
+            << "Options:" << std::endl;
+
+  helpline(std::cout, 'h', "",       "This help",                   "");
+  helpline(std::cout, 'e', "NEVENTS","Number of events",            "100");
+  helpline(std::cout, 'm', "NPART",  "Number of particles/event",   "500");
+  helpline(std::cout, 'r', "REPEAT", "Evaluations per event",       "10");
+  helpline(std::cout, 'u', "",       "Do not use weights",          "false");
+}
+
+/**
+ * A Q-vector layout to benchmark
+ */
+struct Layout
+{
+  const char*  name;    /**< Name of layout */
+  unsigned int storage; /**< Storage flags */
+};
+
+/**
+ * Entry point for program.
+ *
+ * Generate a number of random events, and for each Q-vector layout
+ * (see correlations::QVector::EStorage) time the filling of the
+ * Q-vector and the evaluation of @f$ QC\{6\}@f$ and @f$ QC\{8\}@f$.
+ * Both are evaluated with the closed form expressions.  Then time
+ * the engines for those two orders, and for each order from 2 to
+ * 8.
+ *
+ * @param argc Number of arguments
+ * @param argv Vector of arguments
+ *
+ * @return 0 on success
+ */
+int
+main(int argc, char** argv)
+{
+  using correlations::QVector;
+  using correlations::Real;
+  using correlations::RealVector;
+  using correlations::HarmonicVector;
+  using correlations::Result;
+  using correlations::test::Random;
+  using correlations::test::Stopwatch;
+
+  unsigned int nEvents = 100;
+  unsigned int mult    = 500;
+  unsigned int repeat  = 10;
+  bool         weights = true;
+  for (int i = 1; i < argc; i++) {
+    if (argv[i][0] == '-') {
+      switch (argv[i][1]) {
+      case 'h': usage(argv[0]); return 0;
+      case 'e': nEvents = atoi(argv[++i]); break;
+      case 'm': mult    = atoi(argv[++i]); break;
+      case 'r': repeat  = atoi(argv[++i]); break;
+      case 'u': weights = false; break;
+      default:
+        std::cerr << argv[0] << ": Unknown option " << argv[i] << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  HarmonicVector h(8);
+  Random::seed(54321);
+  for (size_t i = 0; i < h.size(); i++) h[i] = Random::asHarmonic(-6, 6);
+  RealVector phis(nEvents * mult);
+  RealVector ws(nEvents * mult);
+  for (size_t i = 0; i < phis.size(); i++) {
+    phis[i] = Random::asReal(0, 2 * M_PI);
+    ws[i]   = Random::asReal(0.5, 1.5);
+  }
+
+  const Layout layouts[] = {
+    { "AoS harmonic-major", QVector::kFull },
+    { "AoS power-major",    QVector::kPowerMajor },
+    { "SoA harmonic-major", QVector::kSoA },
+    { "SoA power-major",    QVector::kSoA|QVector::kPowerMajor },
+    { 0, 0 }
+  };
+  std::cout << nEvents << " events of " << mult << " particles, "
+            << repeat << " evaluations/event\n"
+            << std::left << std::setw(20) << "Layout" << std::right
+            << std::setw(12) << "fill [ms]" << std::setw(12) << "uc6 [ms]"
+            << std::setw(12) << "uc8 [ms]" << std::setw(14) << "QC{6}"
+            << std::setw(14) << "QC{8}"
+            << std::endl;
+
+  Stopwatch* s = Stopwatch::create();
+  for (const Layout* l = layouts; l->name; l++) {
+    QVector q(h, weights, l->storage);
+    correlations::closed::FromQVector c6(q);
+    correlations::closed::FromQVector& c8 = c6;
+    Real           tFill = 0, t6 = 0, t8 = 0;
+    Result         r6, r8;
+    HarmonicVector hh(h);
+    for (size_t e = 0; e < nEvents; e++) {
+      s->start(true);
+      q.reset();
+      q.fill(&(phis[e * mult]), &(ws[e * mult]), mult);
+      tFill += s->stop();
+
+      s->start(true);
+      // Rotate the harmonics so that the compiler cannot hoist the
+      // evaluation out of the loop
+      for (size_t i = 0; i < repeat; i++) {
+        std::rotate(hh.begin(), hh.begin() + 1, hh.end());
+        r6 += c6.calculate(6, hh);
+      }
+      t6 += s->stop();
+
+      s->start(true);
+      for (size_t i = 0; i < repeat; i++) {
+        std::rotate(hh.begin(), hh.begin() + 1, hh.end());
+        r8 += c8.calculate(8, hh);
+      }
+      t8 += s->stop();
+    }
+    const Real norm = 1000. / nEvents;
+    std::cout << std::left << std::setw(20) << l->name << std::right
+              << std::fixed << std::setprecision(4)
+              << std::setw(12) << tFill * norm
+              << std::setw(12) << t6 * norm
+              << std::setw(12) << t8 * norm
+              << std::scientific << std::setprecision(5)
+              << std::setw(14) << r6.eval().real()
+              << std::setw(14) << r8.eval().real() << std::endl;
+  }
+
+  // Evaluate the correlators of all events, one event at a time and
+  // simd::kLanes events at a time, and with code compiled at run-time
+  std::vector<QVector> qs(nEvents, QVector(h, weights));
+  std::vector<const QVector*> pq(nEvents);
+  for (size_t e = 0; e < nEvents; e++) {
+    qs[e].fill(&(phis[e * mult]), &(ws[e * mult]), mult);
+    pq[e] = &(qs[e]);
+  }
+  correlations::closed::FromQVector     closed;
+  correlations::recurrence::FromQVector recurrence;
+  correlations::dag::FromQVector        dag(qs[0], h);
+  correlations::jit::FromQVector        jit(qs[0], h);
+  correlations::Workspace               space;
+  std::vector<Result>                   res(nEvents);
+  std::cout << "\n" << nEvents << " events evaluated " << repeat
+            << " times, " << correlations::simd::kLanes
+            << " events per batch\n"
+            << std::left << std::setw(20) << "Engine" << std::right
+            << std::setw(12) << "uc6 [ms]" << std::setw(12) << "uc8 [ms]"
+            << std::setw(14) << "QC{6}" << std::setw(14) << "QC{8}"
+            << std::endl;
+  const char* engines[] = { "closed", "recurrence", "dag", "dag batched",
+                            "jit", 0 };
+  for (size_t k = 0; engines[k]; k++) {
+    Real   t[2] = { 0, 0 };
+    Result r[2];
+    for (size_t j = 0; j < 2; j++) {
+      const correlations::Size n = (j == 0 ? 6 : 8);
+      s->start(true);
+      for (size_t i = 0; i < repeat; i++) {
+        if (k == 3) {
+          dag.calculate(&(pq[0]), nEvents, n, h, &(res[0]), space);
+          for (size_t e = 0; e < nEvents; e++) r[j] += res[e];
+          continue;
+        }
+        for (size_t e = 0; e < nEvents; e++) {
+          if (k == 4)      r[j] += jit.calculate(qs[e], n, h, space);
+          else if (k == 2) r[j] += dag.calculate(qs[e], n, h, space);
+          else if (k == 1) r[j] += recurrence.calculate(qs[e], n, h, space);
+          else             r[j] += closed.calculate(qs[e], n, h, space);
+        }
+      }
+      t[j] = s->stop();
+    }
+    const Real norm = 1000. / nEvents;
+    std::cout << std::left << std::setw(20) << engines[k] << std::right
+              << std::fixed << std::setprecision(4)
+              << std::setw(12) << t[0] * norm
+              << std::setw(12) << t[1] * norm
+              << std::scientific << std::setprecision(5)
+              << std::setw(14) << r[0].eval().real()
+              << std::setw(14) << r[1].eval().real() << std::endl;
+  }
+
+  // Time per event of each engine and order
+  correlations::recursive::FromQVector recursive;
+  correlations::grouped::FromQVector   grouped;
+  correlations::plan::FromQVector      plan(qs[0], h);
+  const correlations::FromQVector* byOrder[] = { &closed, &recurrence,
+                                                 &recursive, &grouped,
+                                                 &plan, &dag, 0 };
+  const char* orderNames[] = { "closed", "recurrence", "recursive",
+                               "grouped", "plan", "dag", 0 };
+  std::cout << "\nTime per event [us] of each order\n"
+            << std::left << std::setw(6) << "Order" << std::right;
+  for (size_t k = 0; orderNames[k]; k++)
+    std::cout << std::setw(12) << orderNames[k];
+  std::cout << std::endl;
+  for (correlations::Size n = 2; n <= h.size(); n++) {
+    std::cout << std::left << std::setw(6) << n << std::right
+              << std::fixed << std::setprecision(4);
+    for (size_t k = 0; byOrder[k]; k++) {
+      Result r;
+      s->start(true);
+      for (size_t i = 0; i < repeat; i++)
+        for (size_t e = 0; e < nEvents; e++)
+          r += byOrder[k]->calculate(qs[e], n, h, space);
+      const Real t = s->stop();
+      std::cout << std::setw(12) << t * 1e6 / nEvents / repeat;
+    }
+    std::cout << std::endl;
+  }
+  delete s;
+  return 0;
+}
+//
+// EOF
+//
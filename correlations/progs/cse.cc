@@ -0,0 +1,148 @@
+/**
+ * @file   correlations/progs/cse.cc
+ * @date   Sat Oct 17 07:04:15 2026
+ *
+ * @brief  Show operation counts with and without common
+ * sub-expression elimination
+ *
+ * The program takes a number of options.  Do
+ * <pre class="shell">
+ * ./cse -h
+ * </pre>
+ * for information.
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <correlations/Types.hh>
+#include <correlations/QVector.hh>
+#include <correlations/CorrelatorDag.hh>
+#include <correlations/test/Printer.hh>
+#include <correlations/test/Random.hh>
+#include <iomanip>
+#include <cstdlib>
+
+/**
+ * Show usage information
+ *
+ * @param prog Run name
+ */
+void
+usage(const char* prog)
+{
+  using correlations::test::helpline;
+  std::cout << "Usage: " << prog << " [OPTIONS]\n\n"
+            << "Options:" << std::endl;
+
+  helpline(std::cout, 'h', "",       "This help",                   "");
+  helpline(std::cout, 'n', "MINN",   "Smallest correlator",         "6");
+  helpline(std::cout, 'N', "MAXN",   "Largest correlator",          "12");
+  helpline(std::cout, 'k', "HARM",   "Use only this harmonic",      "random");
+  helpline(std::cout, 'p', "",       "Print instructions",          "false");
+}
+
+/**
+ * Entry point for program.
+ *
+ * For each order from @c MINN to @c MAXN, make the expression graph
+ * (see correlations::CorrelatorDag) of the correlator, and print
+ * the number of operations needed to evaluate the fully expanded
+ * correlator, and the number of operations after common
+ * sub-expressions have been eliminated.  The harmonics are random
+ * and mostly different, unless a single harmonic is given with
+ * @c -k, as for @f$ v_2\{n\}@f$.  It is also checked that each
+ * graph uses no more registers than it has values live at once.
+ *
+ * @param argc Number of arguments
+ * @param argv Vector of arguments
+ *
+ * @return 0 on success, 1 if a graph uses too many registers
+ */
+int
+main(int argc, char** argv)
+{
+  using correlations::CorrelatorDag;
+  using correlations::QVector;
+  using correlations::Real;
+  using correlations::HarmonicVector;
+  using correlations::Size;
+  using correlations::test::Random;
+
+  Size minN   = 6;
+  Size maxN   = 12;
+  int  harm   = 0;
+  bool fixed  = false;
+  bool code   = false;
+  for (int i = 1; i < argc; i++) {
+    if (argv[i][0] == '-') {
+      switch (argv[i][1]) {
+      case 'h': usage(argv[0]); return 0;
+      case 'n': minN  = atoi(argv[++i]); break;
+      case 'N': maxN  = atoi(argv[++i]); break;
+      case 'k': harm  = atoi(argv[++i]); fixed = true; break;
+      case 'p': code  = true; break;
+      default:
+        std::cerr << argv[0] << ": Unknown option " << argv[i] << std::endl;
+        return 1;
+      }
+    }
+  }
+
+  HarmonicVector h(maxN);
+  Random::seed(54321);
+  for (size_t i = 0; i < h.size(); i++)
+    h[i] = fixed ? harm : Random::asHarmonic(-6, 6);
+  QVector q(h, true);
+  bool    ok = true;
+
+  std::cout << std::setw(3) << "n"
+            << std::setw(13) << "terms" << std::setw(14) << "mul"
+            << std::setw(13) << "add" << " |"
+            << std::setw(7) << "nodes" << std::setw(8) << "factors"
+            << std::setw(9) << "mul" << std::setw(9) << "add"
+            << std::setw(7) << "regs" << " |" << std::setw(12) << "saving"
+            << std::endl;
+  for (Size n = minN; n <= maxN; n++) {
+    CorrelatorDag d(q, n, h);
+    Real mul = 0, add = 0;
+    Real terms = CorrelatorDag::naive(n, mul, add);
+    Real after = d.nMultiplications() + d.nAdditions();
+    std::cout << std::setw(3) << n << std::fixed << std::setprecision(0)
+              << std::setw(13) << terms << std::setw(14) << mul
+              << std::setw(13) << add << " |"
+              << std::setw(7) << d.nNodes() << std::setw(8) << d.nFactors()
+              << std::setw(9) << d.nMultiplications()
+              << std::setw(9) << d.nAdditions()
+              << std::setw(7) << d.nRegisters() << " |"
+              << std::setprecision(1) << std::setw(11)
+              << (after > 0 ? (mul + add) / after : 1) << "x" << std::endl;
+    if (d.nRegisters() != d.nLive()) {
+      std::cerr << "Graph of " << n << " particles uses " << d.nRegisters()
+                << " registers, but at most " << d.nLive()
+                << " values are live at once" << std::endl;
+      ok = false;
+    }
+    if (!code) continue;
+    std::cout.unsetf(std::ios::fixed);
+    std::cout << std::setprecision(6);
+    d.print(std::cout);
+  }
+  return ok ? 0 : 1;
+}
+//
+// EOF
+//
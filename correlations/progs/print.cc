@@ -17,6 +17,8 @@
  *   ./print -n 8 -t latex
  *   ./print -n 5 -t C++
  *   ./print -n 12 -t maxima
+ *   ./print -n 10 -t cost -k 2,2,2,2,-2,-2,-2,-2,2,-2 -m 500
+ *   ./print -n 10 -t closed -o correlations/closed/Expand
  * @endverbatim
  */
 /*
@@ -36,11 +38,17 @@
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see http://www.gnu.org/licenses.
  */
+#include <correlations/Cost.hh>
 #include <iostream>
+#include <iomanip>
 #include <algorithm>
 #include <vector>
 #include <iterator>
 #include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
 /** Type of real variables */
 typedef double Real;
 /** Type of powers */
@@ -382,6 +390,93 @@ struct Latex : public Printer
 };
 
 
+//____________________________________________________________________
+/**
+ * Count the operations of the expressions instead of printing them.
+ * Each function is one line with the number of complex
+ * multiplications, additions, @f$ Q@f$-vector loads and calls of the
+ * lower order functions.  At the end, the operations per event of
+ * each engine (see correlations::CostModel) are printed.
+ */
+struct Count : public Printer
+{
+  Count(std::ostream& out, const correlations::HarmonicVector& h, Size m)
+    : Printer(out), mH(h), mM(m), mN(0), mMul(0), mAdd(0), mLoads(0),
+      mCalls(0)
+  {}
+  Printer& start()
+  {
+    mOut << "# Operations of each function\n"
+	 << "# " << std::setw(3) << "n"   << ' '
+	 << std::setw(12) << "mul"   << ' '
+	 << std::setw(12) << "add"   << ' '
+	 << std::setw(12) << "loads" << ' '
+	 << std::setw(12) << "calls" << std::endl;
+    return *this;
+  }
+  Printer& stop(Size n)
+  {
+    correlations::HarmonicVector h(mH.begin(), mH.begin() + n);
+    mOut << "\n# Operations per event of each engine, harmonics";
+    for (Size i = 0; i < n; i++) mOut << (i == 0 ? ' ' : ',') << h[i];
+    mOut << ", multiplicity " << mM << '\n';
+    correlations::CostModel::print(mOut, h, mM);
+    return *this;
+  }
+  Printer& beginFunc(const SizeVector::iterator& begin,
+		     const SizeVector::iterator& end)
+  {
+    mN     = end - begin;
+    mMul   = 0;
+    mAdd   = 0;
+    mLoads = 0;
+    mCalls = 0;
+    return *this;
+  }
+  Printer& endFunc()
+  {
+    mOut << "  " << std::setw(3) << mN << ' '
+	 << std::setw(12) << mMul   << ' '
+	 << std::setw(12) << mAdd   << ' '
+	 << std::setw(12) << mLoads << ' '
+	 << std::setw(12) << mCalls << std::endl;
+    return *this;
+  }
+  /** The factor is folded in, and all but the first term are added */
+  Printer& beginTerm(char, double)
+  {
+    if (mLoads > 0) mAdd++;
+    return *this;
+  }
+  Printer& endTerm() { return *this; }
+  Printer& call(const SizeVector::iterator&, const SizeVector::iterator&)
+  {
+    mCalls++;
+    return *this;
+  }
+  Printer& access(const SizeVector::iterator&, const SizeVector::iterator&)
+  {
+    mLoads++;
+    return *this;
+  }
+  Printer& mult() { mMul++; return *this; }
+  /** Harmonics */
+  correlations::HarmonicVector mH;
+  /** Multiplicity for nested loops */
+  Size mM;
+  /** Order of current function */
+  Size mN;
+  /** Number of multiplications */
+  Real mMul;
+  /** Number of additions */
+  Real mAdd;
+  /** Number of loads */
+  Real mLoads;
+  /** Number of calls */
+  Real mCalls;
+};
+
+
 //____________________________________________________________________
 /**
  * Show the multi particle correlator as a recursive expression
@@ -451,6 +546,215 @@ void show_multi(const Size n,
   o.endFunc();
 }
 
+//____________________________________________________________________
+/**
+ * Count the elements of a set
+ *
+ * @param s Set of slots, one bit per slot
+ *
+ * @return Number of elements
+ */
+Size bits(unsigned s)
+{
+  Size n = 0;
+  for (; s; s &= s - 1) n++;
+  return n;
+}
+
+//____________________________________________________________________
+/**
+ * Write the real or imaginary part of the sum over the blocks @f$
+ * B@f$ of @a k slots holding the first slot of @a s, of @f$ Q_B
+ * C(S\setminus B)@f$
+ *
+ * @param o  Output stream
+ * @param s  Set of slots
+ * @param k  Number of slots in each block
+ * @param im If true, write the imaginary part
+ *
+ * @return Number of terms
+ */
+size_t closed_sum(std::ostream& o, const unsigned s, const Size k, bool im)
+{
+  const unsigned f = s & (0u - s);
+  const unsigned r = s & ~f;
+  size_t         n = 0;
+  // All sub-sets t of the rest, from the largest down
+  for (unsigned t = r; ; t = (t - 1) & r) {
+    if (bits(t) == k - 1) {
+      const unsigned b = t | f;
+      const unsigned c = r & ~t;
+      if (n++ > 0) o << "\n\t+ ";
+      if (!c)      o << (im ? "Qi[" : "Qr[") << b << ']';
+      else if (im) o << "Qr[" << b << "] * Ci[" << c << "] + Qi[" << b
+		     << "] * Cr[" << c << ']';
+      else         o << "Qr[" << b << "] * Cr[" << c << "] - Qi[" << b
+		     << "] * Ci[" << c << ']';
+    }
+    if (t == 0) break;
+  }
+  return n;
+}
+
+//____________________________________________________________________
+/**
+ * Write the closed-form expression of the @a n particle correlator
+ * as a C++ function @c correlations::closed::expand<n>, with common
+ * sub-expressions eliminated.
+ *
+ * Each @f$ Q@f$-vector component is read once.  The correlators
+ * @f$ C(S)@f$ of the sub-sets of the last @f$ n-1@f$ slots are
+ * calculated once each, in increasing order, by taking out the block
+ * @f$ B@f$ holding the first slot of @f$ S@f$ (see
+ * correlations/closed/Kernel.hh).  The blocks are grouped by size
+ * @f$ k@f$, and the weights @f$ (-1)^{k-1}(k-1)!@f$ are applied in
+ * Horner form,
+ *
+ * @f[
+ *   C(S) = x_1 - (x_2 - 2(x_3 - 3(x_4 - \ldots)))
+ * @f]
+ *
+ * where @f$ x_k=\sum_{|B|=k} Q_B C(S\setminus B)@f$.
+ *
+ * The real and imaginary parts are written out, as compilers take
+ * very long to optimise many complex multiplications with their
+ * checks for infinities (see C99 Annex G).  For the same reason the
+ * correlators are calculated by functions of at most @a chunk terms
+ * each, which are not inlined.  The output is a header, which uses
+ * the macros @c CORRELATIONS_KERNEL and @c CORRELATIONS_NOINLINE of
+ * correlations/closed/Kernel.hh.
+ *
+ * @param o     Output stream
+ * @param n     Order of correlator
+ * @param file  Name of the file written, for the documentation
+ * @param chunk Number of terms per function
+ */
+void closed_order(std::ostream& o, const Size n, const std::string& file,
+		  const size_t chunk=256)
+{
+  const unsigned full = (1u << n) - 1;
+  o << "// Generated by print -t closed -- do not edit\n"
+    << "#ifndef CORRELATIONS_CLOSED_EXPAND" << n << "_HH\n"
+    << "#define CORRELATIONS_CLOSED_EXPAND" << n << "_HH\n"
+    << "/**\n"
+    << " * @file   " << file << "\n"
+    << " *\n"
+    << " * @brief  Closed-form expression of the " << n
+    << " particle correlator\n"
+    << " *\n"
+    << " * Generated by @c print @c -t @c closed.  Include this through\n"
+    << " * correlations/Kernels.hh.\n"
+    << " */\n"
+    << "#include <correlations/QVector.hh>\n\n"
+    << "namespace correlations {\n"
+    << "  namespace closed {";
+
+  // Only split into parts kept out of line if there is more than
+  // one part
+  std::ostream none(0);
+  size_t       total = 0;
+  for (unsigned s = 2; s <= full + 1; s += 2) {
+    const unsigned t = (s > full ? full : s);
+    for (Size j = bits(t); j > 0; j--) total += closed_sum(none, t, j, 0);
+  }
+  const char* attr = (total > chunk ? " CORRELATIONS_NOINLINE" : "");
+
+  // Correlators of the sub-sets of the last n-1 slots, and then of
+  // all slots
+  size_t terms  = chunk;
+  Size   chunks = 0;
+  for (unsigned s = 2; s <= full + 1; s += 2) {
+    const unsigned t = (s > full ? full : s);
+    const Size     k = bits(t);
+    if (terms >= chunk) {
+      if (chunks > 0) o << "    }\n";
+      o << "\n    /** Part " << chunks << " of expand" << n << " */\n"
+	<< "    inline" << attr << " void\n"
+	<< "    expand" << n << "Part" << chunks
+	<< "(const Real* Qr, const Real* Qi, Real* Cr, Real* Ci)\n"
+	<< "    {";
+      chunks++;
+      terms = 0;
+    }
+    o << '\n';
+    for (Size j = k; j > 0; j--) {
+      for (int im = 0; im < 2; im++) {
+	const char* c = (im ? "Ci[" : "Cr[");
+	o << "      " << c << t << "] =\n\t";
+	terms += closed_sum(o, t, j, im);
+	if (j < k) {
+	  o << "\n\t- ";
+	  if (j > 1) o << j << ". * ";
+	  o << c << t << ']';
+	}
+	o << ";\n";
+      }
+    }
+  }
+  o << "    }\n\n"
+    << "    /**\n"
+    << "     * @param q Q-vector\n"
+    << "     * @param h Harmonics (at least " << n << ")\n"
+    << "     *\n"
+    << "     * @return @f$ QC\\{" << n << "\\}@f$\n"
+    << "     */\n"
+    << "    CORRELATIONS_KERNEL Complex expand" << n
+    << "(const QVector& q, const Harmonic* h)\n"
+    << "    {\n"
+    << "      Real    Qr[" << (full + 1) << "], Qi[" << (full + 1) << "];\n"
+    << "      Real    Cr[" << (full + 1) << "], Ci[" << (full + 1) << "];\n"
+    << "      Complex z;\n";
+  for (unsigned b = 1; b <= full; b++) {
+    o << "      z = q(";
+    for (Size i = 0, j = 0; i < n; i++)
+      if (b & (1u << i)) o << (j++ ? "+" : "") << "h[" << i << ']';
+    o << ", " << bits(b) << "); Qr[" << b << "] = z.real(); Qi[" << b
+      << "] = z.imag();\n";
+  }
+  for (Size i = 0; i < chunks; i++)
+    o << "      expand" << n << "Part" << i << "(Qr, Qi, Cr, Ci);\n";
+  o << "      return Complex(Cr[" << full << "], Ci[" << full << "]);\n"
+    << "    }\n"
+    << "  }\n"
+    << "}\n"
+    << "#endif\n"
+    << "// Local Variables:\n"
+    << "//  mode: C++\n"
+    << "// End:" << std::endl;
+}
+
+//____________________________________________________________________
+/**
+ * Write the closed-form expressions of the correlators of @f$
+ * 1,\ldots,n@f$ particles, one header per order, to @a
+ * prefix<order>.hh.  The checked-in correlations/closed/Expand1.hh,
+ * ..., are made by
+ *
+ * @verbatim
+ *   ./print -t closed -n 10 -o correlations/closed/Expand
+ * @endverbatim
+ *
+ * @param n      Largest order
+ * @param prefix Prefix of file names
+ *
+ * @return true on success
+ */
+bool closed_orders(const Size n, const std::string& prefix)
+{
+  for (Size i = 1; i <= n; i++) {
+    std::ostringstream name;
+    name << prefix << i << ".hh";
+    std::ofstream out(name.str().c_str());
+    closed_order(out, i, name.str());
+    out.close();
+    if (!out) {
+      std::cerr << "Failed to write " << name.str() << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
 //____________________________________________________________________
 struct to_lower
 {
@@ -463,12 +767,18 @@ void usage(const char* prog)
   std::cout << "Usage: " << prog << " [OPTIONS]\n\n"
 	    << "Options:\n"
 	    << "  -n  NUMBER   Largest correlator to print\n"
-	    << "  -t  TYPE     How to print\n\n"
-	    << "  -d           Show differential equations"
+	    << "  -t  TYPE     How to print\n"
+	    << "  -k  LIST     Comma separated harmonics for cost\n"
+	    << "  -m  NUMBER   Multiplicity for cost of nested loops\n"
+	    << "  -o  PREFIX   Prefix of files for closed\n"
+	    << "  -d           Show differential equations\n\n"
 	    << "TYPE can be one of\n\n"
 	    << "  maxima    Input to Maxima CAS\n"
 	    << "  c++       C++ functions\n"
 	    << "  latex     LaTeX equations\n"
+	    << "  cost      Operation counts, and those of each engine\n"
+	    << "  closed    C++ closed-form expressions, one header per order\n\n"
+	    << "The harmonics default to 1,2,...,n\n"
 	    << std::flush;
 }
 
@@ -477,7 +787,10 @@ int
 main(int argc, char** argv)
 {
   Size         n = 4;
+  Size         m = 100;
   std::string  t = "maxima";
+  std::string  k = "";
+  std::string  o = "correlations/closed/Expand";
   // bool         d = false;
 
   for (int i = 1; i < argc; i++) {
@@ -490,6 +803,9 @@ main(int argc, char** argv)
     case 'h': usage(argv[0]); return 0;
     case 'n': n = atoi(argv[++i]); break;
     case 't': t = argv[++i]; break;
+    case 'k': k = argv[++i]; break;
+    case 'm': m = atoi(argv[++i]); break;
+    case 'o': o = argv[++i]; break;
     // case 'd': d = true; break;
     default:
       std::cerr << argv[0] << ": Unknown option " << argv[i] << std::endl;
@@ -498,11 +814,26 @@ main(int argc, char** argv)
   }
 
   std::transform(t.begin(), t.end(), t.begin(), to_lower());
+  if (t == "closed") return closed_orders(n, o) ? 0 : 1;
+
+  correlations::HarmonicVector h;
+  for (size_t b = 0; b < k.size(); ) {
+    size_t e = std::min(k.find(',', b), k.size());
+    h.push_back(atoi(k.substr(b, e - b).c_str()));
+    b = e + 1;
+  }
+  if (h.empty())
+    for (Size i = 1; i <= n; i++) h.push_back(i);
+  if (h.size() < n) {
+    std::cerr << "Need " << n << " harmonics, got " << h.size() << std::endl;
+    return 1;
+  }
 
   Printer* p = 0;
   if      (t == "maxima")            p = new Maxima(std::cout);
   else if (t == "cxx" || t == "c++") p = new Cxx(std::cout);
   else if (t == "latex")             p = new Latex(std::cout);
+  else if (t == "cost")              p = new Count(std::cout, h, m);
   if (!p) {
     std::cerr << "No printer defined for " << t << std::endl;
     return 1;
@@ -50,6 +50,9 @@ usage(const char* prog)
   helpline(std::cout, 'm', "NPART", "Least number of particles/events", "800");
   helpline(std::cout, 'M', "NPART", "Largest number of particles/events",
            "1000");
+  helpline(std::cout, 'q', "FILENAME", "Also write Q-vector store", "");
+  helpline(std::cout, 'N', "MAXN", "Largest harmonic in store", "24");
+  helpline(std::cout, 'P', "MAXP", "Largest power in store", "8");
 }
 
 /**
@@ -62,6 +65,10 @@ usage(const char* prog)
  * specified with options @c -m and @c -M.  The result is written to
  * the file given by the option @c -i, or @c data.dat if not specified
  *
+ * If the option @c -q is given, the @f$ Q@f$-vectors of the events,
+ * up to the harmonic and power given by @c -N and @c -P, are also
+ * written to a store (see correlations::QStoreWriter).
+ *
  * @param argc Number of arguments
  * @param argv Vector of arguments
  *
@@ -74,7 +81,10 @@ main(int argc,
   unsigned short nEvents = 100;
   unsigned short minN = 800;
   unsigned short maxN = 1000;
+  unsigned short maxQN = 24;
+  unsigned short maxQP = 8;
   std::string output("data.dat");
+  std::string store("");
   for (int i = 1; i < argc; i++) {
     if (argv[i][0] == '-') {
       switch (argv[i][1]) {
@@ -93,6 +103,15 @@ main(int argc,
       case 'o':
         output = argv[++i];
         break;
+      case 'q':
+        store = argv[++i];
+        break;
+      case 'N':
+        maxQN = atoi(argv[++i]);
+        break;
+      case 'P':
+        maxQP = atoi(argv[++i]);
+        break;
       default:
         std::cerr << argv[0] << ": Unknown option " << argv[i] << std::endl;
         return 1;
@@ -101,9 +120,13 @@ main(int argc,
   }
   std::ofstream out(output.c_str());
   correlations::test::WriteData writer(minN, maxN);
+  correlations::QStoreWriter* qstore = 0;
+  if (!store.empty())
+    qstore = new correlations::QStoreWriter(store, maxQN, maxQP);
   for (unsigned short ev = 0; ev < nEvents; ev++)
-    writer.event(out, ev);
+    writer.event(out, ev, qstore);
   out.close();
+  delete qstore;
   return 0;
 }
 /*
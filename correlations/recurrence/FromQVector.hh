@@ -25,8 +25,7 @@
  * along with this program.  If not, see http://www.gnu.org/licenses.
  */
 #include <correlations/FromQVector.hh>
-#include <algorithm>
-#include <numeric>
+#include <correlations/Kernels.hh>
 
 namespace correlations {
   /**
@@ -52,6 +51,10 @@ namespace correlations {
        * @param q Q vector to use
        */
       FromQVector(QVector& q) : correlations::FromQVector(q) { _maxFixed=3; }
+      /**
+       * Constructor of a correlator not bound to a Q-vector
+       */
+      FromQVector() : correlations::FromQVector() { _maxFixed=3; }
       /**
        * @return Name of the correlator
        */
@@ -67,44 +70,53 @@ namespace correlations {
        * QC\{1\} = \langle\exp[i(h_1\phi_1)]\rangle
        * @f]
        *
+       * @param q  Q-vector
+       * @param ws Workspace
        * @param n1 Harmonics @f$ h_1@f$
        *
        * @return @f$ QC\{1\}@f$
        */
-      Complex uc1(const Harmonic n1) const
+      Complex uc1(const QVector& q, Workspace&,
+                  const Harmonic n1) const
       {
-        return _q(n1, 1);
+        return q(n1, 1);
       }
       /**
        * Do the 2-particle calculation
        *
+       * @param q  Q-vector
+       * @param ws Workspace
        * @param n1 1st Harmonic
        * @param n2 2nd Harmonic
        *
        * @return the correlator
        */
-      Complex uc2(const Harmonic n1, const Harmonic n2) const
+      Complex uc2(const QVector& q, Workspace&,
+                  const Harmonic n1, const Harmonic n2) const
       {
-        return _q(n1,1) * _q(n2,1) - _q(n1+n2,2);
+        return q(n1,1) * q(n2,1) - q(n1+n2,2);
       }
       /**
        * Do the 3-particle calculation
        *
+       * @param q  Q-vector
+       * @param ws Workspace
        * @param n1 1st Harmonic
        * @param n2 2nd Harmonic
        * @param n3 3rd Harmonic
        *
        * @return the correlator
        */
-      Complex uc3(const Harmonic n1,
+      Complex uc3(const QVector& q, Workspace& ws,
+                  const Harmonic n1,
                   const Harmonic n2,
                   const Harmonic n3) const
       {
         const Real k2 = 2;
-        return (uc2(n1,n2) * _q(n3,1)
-                - _q(n2,1) * _q(n1+n3,2)
-                - _q(n1,1) * _q(n2+n3,2)
-                + k2 * _q(n1+n2+n3,3));
+        return (uc2(q, ws, n1,n2) * q(n3,1)
+                - q(n2,1) * q(n1+n3,2)
+                - q(n1,1) * q(n2+n3,2)
+                + k2 * q(n1+n2+n3,3));
       }
       /**
        * Do the 4-particle calculation
@@ -119,6 +131,8 @@ namespace correlations {
        *   - 6 QC_{1+2+3+4}\{1\}^4
        * @f]
        *
+       * @param q  Q-vector
+       * @param ws Workspace
        * @param n1 1st Harmonic
        * @param n2 2nd Harmonic
        * @param n3 3rd Harmonic
@@ -126,21 +140,22 @@ namespace correlations {
        *
        * @return the correlator
        */
-      Complex uc4(const Harmonic n1,
+      Complex uc4(const QVector& q, Workspace& ws,
+                  const Harmonic n1,
                   const Harmonic n2,
                   const Harmonic n3,
                   const Harmonic n4) const
       {
         const Real k2 = 2;
         const Real k6 = 6;
-        return (uc3(n1,n2,n3)*_q(n4,1)
-                - uc2(n2,n3) * _q(n1+n4,2)
-                - uc2(n1,n3) * _q(n2+n4,2)
-                - uc2(n1,n2) * _q(n3+n4,2)
-                + k2 * uc1(n3) * _q(n1+n2+n4,3)
-                + k2 * uc1(n2) * _q(n1+n3+n4,3)
-                + k2 * uc1(n1) * _q(n2+n3+n4,3)
-                - k6 * _q(n1+n2+n3+n4,4));
+        return (uc3(q, ws, n1,n2,n3)*q(n4,1)
+                - uc2(q, ws, n2,n3) * q(n1+n4,2)
+                - uc2(q, ws, n1,n3) * q(n2+n4,2)
+                - uc2(q, ws, n1,n2) * q(n3+n4,2)
+                + k2 * uc1(q, ws, n3) * q(n1+n2+n4,3)
+                + k2 * uc1(q, ws, n2) * q(n1+n3+n4,3)
+                + k2 * uc1(q, ws, n1) * q(n2+n3+n4,3)
+                - k6 * q(n1+n2+n3+n4,4));
       }
       /**
        * @f[
@@ -163,6 +178,8 @@ namespace correlations {
        * @f]
        *
        *
+       * @param q  Q-vector
+       * @param ws Workspace
        * @param n1 1st Harmonic
        * @param n2 2nd Harmonic
        * @param n3 3rd Harmonic
@@ -171,7 +188,8 @@ namespace correlations {
        *
        * @return The correlator
        */
-      Complex uc5(const Harmonic n1,
+      Complex uc5(const QVector& q, Workspace& ws,
+                  const Harmonic n1,
                   const Harmonic n2,
                   const Harmonic n3,
                   const Harmonic n4,
@@ -180,195 +198,40 @@ namespace correlations {
         const Real k2  = 2;
         const Real k6  = 6;
         const Real k24 = 24;
-        return (uc4(n1,n2,n3,n4) * _q(n5, 1)
-                - uc3(n2,n3,n4) * _q(n1+n5,2)
-                - uc3(n1,n3,n4) * _q(n2+n5,2)
-                - uc3(n1,n2,n4) * _q(n3+n5,2)
-                - uc3(n1,n2,n3) * _q(n4+n5,2)
-                + k2 * uc2(n3,n4) * _q(n1+n2+n5,3)
-                + k2 * uc2(n2,n4) * _q(n1+n3+n5,3)
-                + k2 * uc2(n1,n4) * _q(n2+n3+n5,3)
-                + k2 * uc2(n2,n3) * _q(n1+n4+n5,3)
-                + k2 * uc2(n1,n3) * _q(n2+n4+n5,3)
-                + k2 * uc2(n1,2)  * _q(n3+n4+n5,3)
-                - k6 * uc1(n4)    * _q(n1+n2+n3+n5,4)
-                - k6 * uc1(n3)    * _q(n1+n2+n4+n5,4)
-                - k6 * uc1(n2)    * _q(n1+n3+n4+n5,4)
-                - k6 * uc1(n1)    * _q(n2+n3+n4+n5,4)
-                + k24 * _q(n1+n2+n3+n4+n5,5));
+        return (uc4(q, ws, n1,n2,n3,n4) * q(n5, 1)
+                - uc3(q, ws, n2,n3,n4) * q(n1+n5,2)
+                - uc3(q, ws, n1,n3,n4) * q(n2+n5,2)
+                - uc3(q, ws, n1,n2,n4) * q(n3+n5,2)
+                - uc3(q, ws, n1,n2,n3) * q(n4+n5,2)
+                + k2 * uc2(q, ws, n3,n4) * q(n1+n2+n5,3)
+                + k2 * uc2(q, ws, n2,n4) * q(n1+n3+n5,3)
+                + k2 * uc2(q, ws, n1,n4) * q(n2+n3+n5,3)
+                + k2 * uc2(q, ws, n2,n3) * q(n1+n4+n5,3)
+                + k2 * uc2(q, ws, n1,n3) * q(n2+n4+n5,3)
+                + k2 * uc2(q, ws, n1,2)  * q(n3+n4+n5,3)
+                - k6 * uc1(q, ws, n4)    * q(n1+n2+n3+n5,4)
+                - k6 * uc1(q, ws, n3)    * q(n1+n2+n4+n5,4)
+                - k6 * uc1(q, ws, n2)    * q(n1+n3+n4+n5,4)
+                - k6 * uc1(q, ws, n1)    * q(n2+n3+n4+n5,4)
+                + k24 * q(n1+n2+n3+n4+n5,5));
       }
       /* @} */
       /**
-       * @{
-       * @name Arbitrary order calculations using recursion
-       */
-      /** A vector of harmonic orders */
-      typedef std::vector<Size> SizeVector;
-      /**
-       * Return the next combination of @a k element from the range
-       * [@a first, @a last).
+       * Calculate the multi-particle correlation by recursion (see
+       * correlations::recurrence::expand)
        *
-       * @param first  Start of the range
-       * @param k      Number of elements to get
-       * @param last   End of range
-       *
-       * @return true if there are more (unique) combinations
-       */
-      static bool nextCombination(const SizeVector::iterator first,
-                                  SizeVector::iterator       k,
-                                  const SizeVector::iterator last)
-      {
-        /* Credits: Mark Nelson http://marknelson.us */
-        if ((first == last) /* No range? */
-            || (first == k) /* Nothing to select? */
-            || (last == k)  /* Nothing to select? */) return false;
-        SizeVector::iterator i1 = first;
-        SizeVector::iterator i2 = last;
-        ++i1; // Go in one
-        if (last == i1)
-          // If this point to the end, there's nothing to selec from
-          return false;
-
-        // Point to the second to last
-        i1 = last;
-        --i1;
-        // Point at the end of our selection
-        i1 = k;
-        --i2;
-
-        // Then loop backward to the start
-        while (first != i1) {
-          if (*--i1 < *i2) {
-            // If the value at marker is less than the last entry,
-            // then point to our division
-            SizeVector::iterator j = k;
-
-            // and if it's not smaller than current value, step into
-            // unused territory
-            while (!(*i1 < *j)) ++j;
-
-            // Swap the greater value with our current object
-            std::iter_swap(i1,j);
-
-            // Increment one
-            ++i1;
-            ++j;
-
-            // and go back to the divider
-            i2 = k;
-
-            // Rotate elements in the range i1->j, and put them at the end
-            std::rotate(i1,j,last);
-
-            // Then, while we haven't found our greater value,
-            // increment into unused territory
-            while (last != j) {
-              ++j;
-              ++i2;
-            }
-
-            // And rotate
-            std::rotate(k,i2,last);
-            return true;
-          }
-        }
-        // And rotate
-        std::rotate(first,k,last);
-        return false;
-      }
-      /**
-       * Calculate the multi-particle correlation
-       *
-       * The calculation is done using the following algorithm
-       *
-       * @verbatim
-       *    C = (0,0)
-       *    for k from n-1 downto 0 do
-       *       for each combination c of k harmonics except h_n do
-       *         let m = sum of harmonics not in c
-       *         let p = number of harmonics not in c
-       *         let s = -1^(n-k)
-       *         C += s * (n-1-k)! * QC{k}(combination) * Q(m,p)
-       *       end for each c
-       *    end for k
-       * @endverbatim
-       *
-       * @param n Order of correlation (number of particles to correlate)
-       * @param h Harmonics
-       *
-       * @return @f$ QC{n}@f$
-       */
-      Complex ucN(const Size n, const HarmonicVector& h) const
-      {
-        SizeVector v(n-1); // Allocate cache here
-        return ucN2(n, h, v);
-      }
-      /**
-       * Calculate the multi-particle correlation
-       *
-       * The calculation is done using the following algorithm
-       *
-       * @verbatim
-       *    C = (0,0)
-       *    for k from n-1 downto 0 do
-       *       for each combination c of k harmonics except h_n do
-       *         let m = sum of harmonics not in c
-       *         let p = number of harmonics not in c
-       *         let s = -1^(n-k)
-       *         C += s * (n-1-k)! * QC{k}(combination) * Q(m,p)
-       *       end for each c
-       *    end for k
-       * @endverbatim
-       *
-       * @param n Order of correlation (number of particles to correlate)
-       * @param h Harmonics
-       * @param v Cache - note, this is larger than it need be, so we
-       * take care of iterations by being explicit about the bounds
+       * @param q  Q-vector
+       * @param ws Workspace
+       * @param n  Order of correlation (number of particles to correlate)
+       * @param h  Harmonics
        *
        * @return @f$ QC{n}@f$
        */
-      Complex ucN2(const Size n,
-                  const HarmonicVector& h,
-                  SizeVector v) const
+      Complex ucN(const QVector& q, Workspace& ws,
+                  const Size n, const HarmonicVector& h) const
       {
-        if (n == 0) return Complex(1,0);
-        if (n == 1) return uc1(h[0]);
-
-        // Make vector of harmonics - expensive allocation
-        HarmonicVector hh(n);
-        hh[n-1] =  h[n-1];
-
-        // Make vector of indices
-        // SizeVector v(n-1);
-        // for (size_t i = 0; i < v.size(); i++) v[i] = i;
-
-        Complex r; // = x;
-        Real    f = 1;
-        Real    s = 1;
-        Power   p = 1;
-        for (Size m = n; m > 0; m--) {
-          // Reset indices for combinations
-          for (size_t i = 0; i < size_t(n-1); i++) v[i] = i;
-          Size k  =  m-1;
-          do {
-            for (size_t i = 0; i < size_t(n-1); i++) hh[i] = h[v[i]];
-            // Harmonic second = 0;
-            // for (size_t i = k; i < n-1; i++) second += h[v[i]];
-
-            Complex t = ucN2(k, hh, v);
-
-            // The calculation
-            Harmonic a = std::accumulate(hh.begin()+k, hh.begin()+n,0);
-            Complex  x = s * f * t * _q(a, p);
-            r += x;
-          } while (nextCombination(v.begin(), v.begin()+k, v.begin()+n-1));
-          f       *= (n-k);
-          s       *= -1;
-          p++;
-        }
-        return r;
+        return expand(q, ws, n, &(h[0]));
       }
-      /* @} */
     };
   }
 }
@@ -0,0 +1,131 @@
+#ifndef CORRELATIONS_RECURRENCE_KERNEL_HH
+#define CORRELATIONS_RECURRENCE_KERNEL_HH
+/**
+ * @file   correlations/recurrence/Kernel.hh
+ * @date   Sat Oct 17 07:35:16 2026
+ *
+ * @brief  Correlators of arbitrary order by recursion
+ */
+/*
+ * Multi-particle correlations
+ * Copyright (C) 2013 K.Gulbrandsen, A.Bilandzic, C.H. Christensen.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see http://www.gnu.org/licenses.
+ */
+#include <correlations/QVector.hh>
+#include <correlations/Workspace.hh>
+#include <iostream>
+
+namespace correlations {
+  namespace recurrence {
+    //____________________________________________________________________
+    /**
+     * Calculate the multi-particle correlation
+     *
+     * The calculation is done using the following algorithm
+     *
+     * @verbatim
+     *    C = (0,0)
+     *    for k from n-1 downto 0 do
+     *       for each combination c of k harmonics except h_n do
+     *         let m = sum of harmonics not in c
+     *         let p = number of harmonics not in c
+     *         let s = -1^(n-k)
+     *         C += s * (n-1-k)! * QC{k}(combination) * Q(m,p)
+     *       end for each c
+     *    end for k
+     * @endverbatim
+     *
+     * The correlator of each combination is found the same way.
+     * Rather than recursing, the correlators of all sub-sets of the
+     * first @f$ n-1@f$ slots are calculated once each, smallest
+     * first, from the terms listed in correlations::Combinations, so
+     * the work grows like @f$ 3^{n-1}@f$ rather than like the Bell
+     * numbers.  The sums of harmonics of all sub-sets are made once
+     * per call.  Beyond Combinations::kMaxOrder slots, the terms
+     * are enumerated as they are needed.
+     *
+     * Include this through correlations/Kernels.hh.
+     *
+     * @param q  Q-vector
+     * @param ws Workspace
+     * @param n  Order of correlation (number of particles to correlate)
+     * @param h  Harmonics
+     *
+     * @return @f$ QC{n}@f$
+     */
+    CORRELATIONS_KERNEL Complex expand(const QVector& q, Workspace& ws,
+                                       const Size n, const Harmonic* h)
+    {
+      if (n == 0) return Complex(1,0);
+      if (n == 1) return q(h[0], 1);
+      if (n >= 8 * sizeof(unsigned)) {
+        std::cerr << "Number of correlators too big:" << n << std::endl;
+        return Complex();
+      }
+      // Sums of harmonics, and correlators, of all sub-sets.  These
+      // are only allocated the first time we see this n.
+      const size_t need = size_t(1) << n;
+      if (ws.hh.size() < need) ws.hh.resize(need);
+      if (ws.z.size()  < need) ws.z.resize(need);
+      Harmonic*     a = &(ws.hh[0]);
+      PlainComplex* c = &(ws.z[0]);
+      a[0] = 0;
+      for (Size i = 0; i < n; i++)
+        for (size_t b = size_t(1) << i; b < (size_t(2) << i); b++)
+          a[b] = a[b - (size_t(1) << i)] + h[i];
+      c[0] = PlainComplex(1,0);
+
+      if (n <= Combinations::kMaxOrder) {
+        const Combinations::Table& t  = ws.comb.table(n);
+        const Combinations::Term*  x  = &(t.terms[0]);
+        const Combinations::Term*  x0 = x;
+        for (size_t s = 0; s < t.sets.size(); s++) {
+          const Combinations::Term* xe = x0 + t.ends[s];
+          PlainComplex r;
+          for (; x != xe; ++x) r.mac(x->f, c[x->c], q(a[x->b], x->p));
+          c[t.sets[s]] = r;
+        }
+        return c[need - 1].complex();
+      }
+
+      // Too many slots to tabulate - enumerate the sub-sets directly
+      if (ws.r.size() < size_t(n) + 1) ws.r.resize(n + 1);
+      Real* f = &(ws.r[0]);
+      f[1] = 1;
+      for (Size p = 2; p <= n; p++) f[p] = -f[p - 1] * (p - 1);
+      const unsigned half = 1u << (n - 1);
+      for (unsigned s = 1; s <= half; s++) {
+        const unsigned set  = (s == half ? unsigned(need - 1) : s);
+        unsigned       last = set;
+        while (last & (last - 1)) last &= last - 1;
+        const unsigned rest = set & ~last;
+        PlainComplex   r;
+        for (unsigned u = rest; ; u = (u - 1) & rest) {
+          const unsigned b = set & ~u;
+          Power          p = 0;
+          for (unsigned v = b; v; v &= v - 1) p++;
+          r.mac(f[p], c[u], q(a[b], p));
+          if (u == 0) break;
+        }
+        c[set] = r;
+      }
+      return c[need - 1].complex();
+    }
+  }
+}
+#endif
+// Local Variables:
+//  mode: C++
+// End:
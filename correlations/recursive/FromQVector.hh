@@ -25,6 +25,7 @@
  * along with this program.  If not, see http://www.gnu.org/licenses.
  */
 #include <correlations/FromQVector.hh>
+#include <algorithm>
 
 
 namespace correlations {
@@ -41,6 +42,13 @@ namespace correlations {
      * QC\{n\}@f$ or - for a limited number of @f$ n@f$ specific
      * recursive functions.
      *
+     * The same intermediate states of the recursion are reached
+     * along many paths, so results of intermediate states are
+     * memoized in the workspace (see correlations::Workspace).  The
+     * memo is shared by all calls for the same @f$Q@f$-vector
+     * content, and cleared when that changes, so it never outlives
+     * an event.
+     *
      * @headerfile ""  <correlations/recursive/FromQVector.hh>
      */
     struct FromQVector: public correlations::FromQVector
@@ -50,7 +58,19 @@ namespace correlations {
        *
        * @param q Q vector to use
        */
-      FromQVector(QVector& q) : correlations::FromQVector(q) { _maxFixed = 0; }
+      FromQVector(QVector& q)
+	: correlations::FromQVector(q)
+      {
+	_maxFixed = 0;
+      }
+      /**
+       * Constructor of a correlator not bound to a Q-vector
+       */
+      FromQVector()
+	: correlations::FromQVector()
+      {
+	_maxFixed = 0;
+      }
       /**
        *  Destructor
        */
@@ -65,7 +85,9 @@ namespace correlations {
        * @name Arbitrary order calculations using recursion
        */
       /** A vector of harmonic orders */
-      typedef std::vector<Size> SizeVector;
+      typedef Workspace::SizeVector SizeVector;
+      /** Smallest number of slots for which results are memoized */
+      enum { kMinMemo = 6 };
       /**
        * Calculate the multi-particle correlation
        *
@@ -91,55 +113,100 @@ namespace correlations {
        *    end for i
        * @endverbatim
        *
-       * @param n Order of correlation (number of particles to correlate)
-       * @param h Harmonics
+       * @param q  Q-vector
+       * @param ws Workspace
+       * @param n  Order of correlation (number of particles to correlate)
+       * @param h  Harmonics
        *
        * @return @f$ QC{n}@f$
        */
-      Complex ucN(const Size n, const HarmonicVector& h) const
+      Complex ucN(const QVector& q, Workspace& ws,
+		  const Size n, const HarmonicVector& h) const
       {
-#ifndef _REENTRANT
-        static SizeVector cnt(0);
-        static HarmonicVector hh(0);
-        cnt.resize(std::max(Size(cnt.size()), n));
-	hh.resize(std::max(hh.size(), h.size()));
-        hh.insert(hh.begin(), h.begin(), h.end());
-#else
-        SizeVector cnt(n);
-        HarmonicVector hh(h.begin(), h.end());
-#endif
-        std::fill(cnt.begin(), cnt.end(), 1);
-
-        return ucN2(n, hh, cnt);
+        ws.cnt.assign(n, 1);
+        ws.hh.assign(h.begin(), h.begin() + n);
+        return ucN2(q, ws, n, ws.hh, ws.cnt);
       }
       /**
        * Calculate the multi-particle correlation
        *
        *
+       * @param q   Q-vector
+       * @param ws  Workspace
        * @param n   Order of correlation (number of particles to correlate)
        * @param h   Harmonics
        * @param cnt Vector of term counts
        *
        * @return @f$ QC{n}@f$
        */
-      Complex ucN2(const Size n, HarmonicVector& h, SizeVector& cnt) const
+      Complex ucN2(const QVector& q, Workspace& ws, const Size n,
+		   HarmonicVector& h, SizeVector& cnt) const
       {
-        Size    j = n-1;
-        Complex c = _q(h[j], cnt[j]);
-        if (n == 1) return c;
+        Size         j = n-1;
+        PlainComplex c = q(h[j], cnt[j]);
+        if (n == 1) return c.complex();
 
-        c *= ucN2(j, h, cnt);
+        c *= memoN2(q, ws, j, h, cnt);
 
-        if (cnt[j] > 1) return c;
+        if (cnt[j] > 1) return c.complex();
 
         for (Size i = 0; i < (n-1); i++) {
           h[i]   += h[j];
           cnt[i] =  cnt[i] + 1;
-          c      -= Real(cnt[i] - 1) * ucN2(j, h, cnt);
+          c      -= (Real(cnt[i] - 1)
+                     * PlainComplex(memoN2(q, ws, j, h, cnt)));
 
           cnt[i]--;
           h[i] -= h[j];
         }
+        return c.complex();
+      }
+      /**
+       * Look up the result of ucN2 for the state of the first @a n
+       * slots in the memo, and calculate and store it if not found.
+       *
+       * The result is @e not symmetric under arbitrary permutations
+       * of the slots: a slot with a count larger than one can only
+       * absorb slots that come after it.  It is, however, symmetric
+       * under permutations of slots with count one that are not
+       * separated by a slot with larger count.  The key is therefore
+       * the ordered list of (harmonic,count) pairs, with each run of
+       * count-one slots sorted.
+       *
+       * @param q   Q-vector
+       * @param ws  Workspace holding the memo
+       * @param n   Number of slots
+       * @param h   Harmonics
+       * @param cnt Vector of term counts
+       *
+       * @return ucN2(q, ws, n, h, cnt)
+       */
+      Complex memoN2(const QVector& q, Workspace& ws, const Size n,
+		     HarmonicVector& h, SizeVector& cnt) const
+      {
+        // Small states are cheaper to calculate than to look up
+        if (n < kMinMemo) return ucN2(q, ws, n, h, cnt);
+
+        Memo&             m = ws.memo;
+        std::vector<int>& a = m.arena;
+        const size_t      o = a.size();
+        a.resize(o + n + 1);
+        a[o] = n;
+        for (Size i = 0; i < n; i++) a[o+1+i] = int(h[i]) * 256 + cnt[i];
+        for (Size i = 0; i < n; ) {
+          Size e = i;
+          while (e < n && cnt[e] == 1) e++;
+          if (e - i > 1) std::sort(a.begin() + o + 1 + i, a.begin() + o + 1 + e);
+          i = (e == i ? i + 1 : e);
+        }
+        size_t       slot = 0;
+        const size_t hit  = m.find(o, slot);
+        if (hit != Memo::kNone) {
+          a.resize(o);
+          return m.values[hit];
+        }
+        const Complex c = ucN2(q, ws, n, h, cnt);
+        m.insert(o, c);
         return c;
       }
       /* @} */
@@ -25,6 +25,7 @@
  * along with this program.  If not, see http://www.gnu.org/licenses.
  */
 #include <correlations/NestedLoops.hh>
+#include <correlations/Workspace.hh>
 
 namespace correlations {
   namespace recursive {
@@ -32,7 +33,10 @@ namespace correlations {
     /**
      * Structure to calculate the cumulants using nested loops
      *
-     * This calculates the loop using recursion
+     * This calculates the loop using recursion.  The scratch space
+     * of the loops lives in a correlations::Workspace, so that
+     * several threads can use the same object at the same time, each
+     * with its own workspace (see calculate).
      *
      * @headerfile ""  <correlations/recursive/NestedLoops.hh>
      */
@@ -48,8 +52,30 @@ namespace correlations {
       NestedLoops(RealVector& phis,
 		  RealVector& weights,
 		  bool        useWeights=true)
-	: correlations::NestedLoops(phis, weights, useWeights)
+	: correlations::NestedLoops(phis, weights, useWeights),
+	  _ws()
       {}
+      using correlations::NestedLoops::calculate;
+      /**
+       * Calculate the @a n particle correlation using harmonics @a
+       * h.  Apart from the workspace @a ws, nothing is modified.
+       *
+       * @param n  How many particles to correlate
+       * @param h  Harmonic of each term
+       * @param ws Workspace to use
+       *
+       * @return The correlator and the summed weights
+       */
+      Result calculate(const Size n, const HarmonicVector& h,
+		       Workspace& ws) const
+      {
+	Complex  c;
+	Real     sumw = 0;
+	if (ws.r.size()   < 2 * n) ws.r.resize(2 * n);
+	if (ws.cnt.size() < n)     ws.cnt.resize(n);
+	loop(0, n, &(ws.cnt[0]), h, &(ws.r[0]), &(ws.r[n]), c, sumw);
+	return Result(c, sumw);
+      }
       /**
        * @return Name of the correlator
        */
@@ -96,18 +122,10 @@ namespace correlations {
        */
       Result cN(const Size n, const HarmonicVector& h) const
       {
-	Complex  c;
-	Real     sumw = 0;
-	Real*    p    = new Real[n];
-	Real*    w    = new Real[n];
-	Size*    idx  = new Size[n];
-	loop(0, n, idx, h, p, w, c, sumw);
-	Result r(c, sumw);
-	delete [] p;
-	delete [] w;
-	delete [] idx;
-	return r;
+	return calculate(n, h, _ws);
       }
+      /** Workspace used by Correlator::calculate */
+      mutable Workspace _ws;
     };
   }
 }
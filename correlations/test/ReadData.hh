@@ -55,10 +55,11 @@ namespace correlations {
       /**
        * Constructor
        *
-       * @param input Stream to read from
+       * @param input    Stream to read from
+       * @param nThreads Number of threads to fill Q-vector with
        */
-      ReadData(std::istream& input)
-	: _input(input), _phiR(0)
+      ReadData(std::istream& input, unsigned int nThreads=1)
+	: _input(input), _phiR(0), _nThreads(nThreads)
       {
       }
       virtual ~ReadData() {}
@@ -119,19 +120,20 @@ namespace correlations {
 	  s2 >> phi >> weight;
 	  phis[id]    = phi;
 	  weights[id] = weight;
-
-	  q.fill(phi, weight);
 	} while (true);
 	if (id != -2)
 	  // Not a trailer
 	  return false;
 
+	q.fill(&(phis[0]), &(weights[0]), mult, _nThreads);
+
 	return true;
       }
       Real phiR() const {return _phiR; }
     protected:
       std::istream& _input;
       Real _phiR;
+      unsigned int _nThreads;
     };
   }
 }
@@ -28,6 +28,13 @@
 #include <correlations/recursive/NestedLoops.hh>
 #include <correlations/recurrence/FromQVector.hh>
 #include <correlations/closed/FromQVector.hh>
+#include <correlations/plan/FromQVector.hh>
+#include <correlations/dag/FromQVector.hh>
+#include <correlations/grouped/FromQVector.hh>
+#include <correlations/jit/FromQVector.hh>
+#include <correlations/AutoCorrelator.hh>
+#include <correlations/Incremental.hh>
+#include <correlations/QStore.hh>
 #include <correlations/test/Random.hh>
 #include <correlations/test/ReadData.hh>
 #include <correlations/test/Printer.hh>
@@ -53,7 +60,8 @@ namespace correlations
        */
       enum EMode
       {
-        CLOSED, RECURRENCE, RECURSIVE
+        CLOSED, RECURRENCE, RECURSIVE, PLAN, DAG, GROUPED, INCREMENTAL, JIT,
+        AUTO
       };
       /**
        * @param s Input string
@@ -69,9 +77,53 @@ namespace correlations
           return RECURRENCE;
         else if (s == "RECURSIVE")
           return RECURSIVE;
+        else if (s == "PLAN")
+          return PLAN;
+        else if (s == "DAG")
+          return DAG;
+        else if (s == "GROUPED")
+          return GROUPED;
+        else if (s == "INCREMENTAL")
+          return INCREMENTAL;
+        else if (s == "JIT")
+          return JIT;
+        else if (s == "AUTO")
+          return AUTO;
         std::cerr << "Unknown mode: " << s << " assuming CLOSED" << std::endl;
         return CLOSED;
       }
+      /**
+       * @param s Input string - a comma separated list of storage
+       * options
+       *
+       * @return Storage mode flags (see QVector::EStorage)
+       */
+      static unsigned int
+      str2storage(const std::string& s)
+      {
+        unsigned int ret = QVector::kFull;
+        std::stringstream in(s);
+        std::string t;
+        while (std::getline(in, t, ',')) {
+          if (t.empty() || t == "FULL")
+            continue;
+          else if (t == "HALF")
+            ret |= QVector::kHalf;
+          else if (t == "SPARSE")
+            ret |= QVector::kSparse;
+          else if (t == "SOA")
+            ret |= QVector::kSoA;
+          else if (t == "AOS")
+            ret &= ~QVector::kSoA;
+          else if (t == "POWER")
+            ret |= QVector::kPowerMajor;
+          else if (t == "HARMONIC")
+            ret &= ~QVector::kPowerMajor;
+          else
+            std::cerr << "Unknown storage: " << t << " ignored" << std::endl;
+        }
+        return ret;
+      }
       /**
        * Constructor
        *
@@ -80,11 +132,19 @@ namespace correlations
        * @param maxN     Max # of particles to correlate
        * @param doNested Whether to run nested loop code
        * @param verbose  Whether to be verbose
+       * @param storage  Q-vector storage mode (see QVector::EStorage)
+       * @param weights  Whether to use weights
+       * @param nThreads Number of threads to fill Q-vector with
        */
       Tester(std::istream& input, EMode mode = CLOSED, Size maxN = 8,
-          bool doNested = false, bool verbose = false) :
-          _h(maxN), _phis(), _weights(), _r(input), _q(0, 0, true), _c(0), _n(
-              0), _rC(0), _rN(0), _s(0), _tC(0), _tN(0), _e(0), _v(verbose)
+          bool doNested = false, bool verbose = false,
+          unsigned int storage = QVector::kFull, bool weights = true,
+          unsigned int nThreads = 1) :
+          _h(maxN), _phis(), _weights(), _r(input, nThreads),
+          _q(0, 0, weights, storage),
+          _c(0), _i(0), _n(
+              0), _rC(0), _rN(0), _s(0), _tC(0), _tN(0), _e(0), _v(verbose),
+          _store(0), _storeOut(0)
       {
         if (_v)
           std::cout << "Harmonics:" << std::flush;
@@ -115,17 +175,41 @@ namespace correlations
         case CLOSED:
           _c = new correlations::closed::FromQVector(_q);
           break;
+        case PLAN:
+          _c = new correlations::plan::FromQVector(_q, _h);
+          break;
+        case DAG:
+          _c = new correlations::dag::FromQVector(_q, _h);
+          break;
+        case GROUPED:
+          _c = new correlations::grouped::FromQVector(_q);
+          break;
+        case INCREMENTAL:
+          _c = _i = new correlations::Incremental(_h, weights);
+          break;
+        case JIT:
+          _c = new correlations::jit::FromQVector(_q, _h);
+          break;
+        case AUTO:
+          _c = new correlations::AutoCorrelator(_q, _h);
+          break;
           }
         if (doNested)
           switch (mode)
             {
           case RECURSIVE:
           case RECURRENCE:
+          case PLAN:
+          case DAG:
+          case GROUPED:
+          case INCREMENTAL:
+          case JIT:
+          case AUTO:
             _n = new correlations::recursive::NestedLoops(_phis, _weights,
-                true);
+                weights);
             break;
           case CLOSED:
-            _n = new correlations::NestedLoops(_phis, _weights, true);
+            _n = new correlations::NestedLoops(_phis, _weights, weights);
             break;
             }
         if (_v)
@@ -143,6 +227,51 @@ namespace correlations
       ~Tester()
       {
       }
+      /**
+       * Read @f$ Q@f$-vectors from a store instead of observations
+       * from the input stream.  Nested loops cannot be done in this
+       * case, and are disabled.
+       *
+       * @param store Store to read from
+       *
+       * @return false if the harmonics do not fit in the store
+       */
+      bool
+      readStore(QStoreReader* store)
+      {
+        if (!store || !store->isOpen())
+          return false;
+        if (_i)
+          {
+            std::cerr << "Incremental correlator needs observations, "
+                << "not Q-vectors" << std::endl;
+            return false;
+          }
+        if (!store->fits(_h, _rC.size() + 1))
+          {
+            std::cerr << "Harmonics do not fit in Q-vector store with "
+                << "maxN=" << store->maxN() << " and maxP="
+                << store->maxP() << std::endl;
+            return false;
+          }
+        _store = store;
+        delete _n;
+        _n = 0;
+        _rN.resize(0);
+        _tN.resize(0);
+        return true;
+      }
+      /**
+       * Also write the @f$ Q@f$-vectors of events read from the input
+       * stream to a store
+       *
+       * @param store Store to write to
+       */
+      void
+      writeStore(QStoreWriter* store)
+      {
+        _storeOut = store;
+      }
       /**
        * Make a single event
        *
@@ -151,8 +280,28 @@ namespace correlations
       event()
       {
         _q.reset();
-        if (!_r.event(_q, _phis, _weights))
+        if (_store)
+          {
+            if (!_store->event())
+              return false;
+            _q += _store->q();
+          }
+        else if (!_r.event(_q, _phis, _weights))
           return false;
+        else if (_storeOut)
+          {
+            // Empty events are stored too, to keep the event numbers
+            if (_phis.empty())
+              _storeOut->event(0, 0, 0);
+            else
+              _storeOut->event(&(_phis[0]), &(_weights[0]), _phis.size());
+          }
+        if (_i)
+          {
+            _i->reset();
+            if (!_phis.empty())
+              _i->fill(&(_phis[0]), &(_weights[0]), _phis.size());
+          }
 
         _e++;
         if (_v)
@@ -243,7 +392,9 @@ namespace correlations
       /** Our Q vector */
       QVector _q;
       /** Correlator that uses cumulants */
-      FromQVector* _c;
+      Correlator* _c;
+      /** The same, if it is updated per observation */
+      Incremental* _i;
       /** Correlator that uses nested loops */
       NestedLoops* _n;
       /** Cumulant results */
@@ -260,6 +411,10 @@ namespace correlations
       Size _e;
       /** Be verbose */
       bool _v;
+      /** Q-vector store to read from, if any */
+      QStoreReader* _store;
+      /** Q-vector store to write to, if any */
+      QStoreWriter* _storeOut;
     };
   }
 }
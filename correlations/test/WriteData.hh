@@ -29,6 +29,7 @@
 #include <correlations/test/Distribution.hh>
 #include <correlations/test/Weights.hh>
 #include <correlations/test/Stopwatch.hh>
+#include <correlations/QStore.hh>
 #include <fstream>
 
 namespace correlations {
@@ -56,15 +57,18 @@ namespace correlations {
 	: _d(),
 	  _w(),
 	  _minN(minN),
-	  _maxN(maxN)
+	  _maxN(maxN),
+	  _phis(),
+	  _weights()
       {}
       /**
        * Create one event
        *
-       * @param o  Output stream
-       * @param ev Event number
+       * @param o     Output stream
+       * @param ev    Event number
+       * @param store If not null, also store the event @f$ Q@f$-vector
        */
-      void event(std::ostream& o, Size ev)
+      void event(std::ostream& o, Size ev, QStoreWriter* store=0)
       {
 	_d.setup(Random::asReal(0, 2 * M_PI));
 
@@ -73,6 +77,8 @@ namespace correlations {
 	// Write out a header:
 	//   -1  multiplicity event_no phiR
 	o << -1 << "\t" << mult << "\t" << ev << "\t" << _d._v[0] << std::endl;
+	_phis.resize(mult);
+	_weights.resize(mult);
 
 	// Generate observations
 	for (Size ipart = 0; ipart < mult; ipart++) {
@@ -82,7 +88,10 @@ namespace correlations {
 	  // Write particle line:
 	  //   no phi weight
 	  o << ipart << "\t" << phi << "\t" << weight << std::endl;
+	  _phis[ipart]    = phi;
+	  _weights[ipart] = weight;
 	}
+	if (store) store->event(&(_phis[0]), &(_weights[0]), mult);
 	// Write trailer:
 	//   -2 multiplicity event_no
 	o << -2 << "\t" << mult << "\t" << ev << std::endl;
@@ -155,6 +164,10 @@ namespace correlations {
       Size _minN;
       /** Larges multiplicity */
       Size _maxN;
+      /** Observations of current event */
+      RealVector _phis;
+      /** Weights of current event */
+      RealVector _weights;
     };
   }
 }
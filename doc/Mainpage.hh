@@ -74,6 +74,30 @@
  * That is, all code is 'inline'.  That means that there is no need to
  * compile a library or the like first.
  *
+ * Optionally, the kernels of the closed-form and recurrence
+ * correlators can be compiled once into a static and shared library
+ *
+ * <pre class="shell">make lib</pre>
+ *
+ * The library is built for any machine of the architecture.  To
+ * tune it for the build machine, at the cost of it not running on
+ * older ones, add @c NATIVE=1.
+ *
+ * Code compiled with @c -DCORRELATIONS_LIBRARY then only sees the
+ * declarations of the kernels, which saves compile time and object
+ * size, and must be linked with <tt>-lcorrelations</tt> (see
+ * correlations/Kernels.hh).  <tt>make install</tt> installs the
+ * libraries too, if they have been built.
+ *
+ * The closed-form expressions are C++ written out by <tt>./print -t
+ * closed</tt>, one header per order (correlations/closed/Expand1.hh,
+ * ...), with the real and imaginary parts kept apart and the sums in
+ * Horner form.  They are checked in, and are regenerated by
+ * <tt>make closed</tt>.  Orders 9 and 10 take long to compile, so
+ * building them once into the library, with <tt>make lib
+ * FULL=1</tt>, is the cheap way to get correlators of up to 10
+ * particles.
+ *
  * @subsection usage_other Using in Another Project 
  * 
  * To use the code in some other project located at say
@@ -135,6 +159,12 @@
  *   data file generated for correlations
  * - <a href="compare_8cc-example.html">compare.cc</a> compares the
  *   results of two different runs of analyze.cc
+ * - <a href="allocs_8cc-example.html">allocs.cc</a> checks that no
+ *   heap memory is allocated per event once the correlators have
+ *   warmed up
+ * - <a href="cse_8cc-example.html">cse.cc</a> shows the number of
+ *   operations needed per correlator, before and after common
+ *   sub-expressions are eliminated
  *
  * To build and run the tests, do
  *
@@ -142,13 +172,13 @@
  * make test
  * </pre>
  *
- * @note By default, only up to 6-particle correlators are defined for
- * the so-called 'fixed-form' (see @ref algo), but 7 and 8-particle
+ * @note By default, up to 8-particle correlators are defined for the
+ * so-called 'fixed-form' (see @ref algo), but 9 and 10-particle
  * correlators can be enabled by doing
  * <pre class="shell">
- * make test USE7=1 USE=8
+ * make test FULL=1
  * </pre>
- * Do note, that compilation will take a very long time in this case.
+ * Do note, that compilation will take longer in this case.
  *
  * All of these programs allow for a set of options.  To see which
  * options are accepted, do
@@ -175,13 +205,13 @@
  * </pre>
  * (notice the change of case)
  *
- * @note By default, only up to 6-particle correlators are defined for
- * the so-called 'fixed-form' (see @ref algo), but 7 and 8-particle
+ * @note By default, up to 8-particle correlators are defined for the
+ * so-called 'fixed-form' (see @ref algo), but 9 and 10-particle
  * correlators can be enabled by doing
  * <pre class="shell">
- * make Test USE7=1 USE=8
+ * make Test FULL=1
  * </pre>
- * Do note, that compilation will take a very long time in this case.
+ * Do note, that compilation will take longer in this case.
  *
  * The scripts can also be executed in the interpretive environment -
  * but should always be <a
@@ -233,18 +263,90 @@
  * - correlations::recurrence::FromQVector which used recursion to
  *   simplify the expression, and has the added feature that it can
  *   calculate any order correlator - provided enough computing time
- *   and memory.
+ *   and memory.  The correlators of all sub-sets of the harmonics
+ *   are calculated once each, from tables of the terms (see
+ *   correlations::Combinations).
  * - correlations::closed::FromQVector which uses closed-form
- *   expression for the correlators.  This means that we are limited
- *   to the order for which we have generated these closed forms.
- *   Note, one can use the program print.cc to generate this, should
- *   it be needed.
+ *   expression for the correlators.  The expressions are generated
+ *   from the recurrence by print.cc (see correlations::closed::expand)
+ *   for up to 8 particles, or 10 if @c CORRELATIONS_CLOSED_MAX is
+ *   defined to be that.  The program print.cc can print the fully
+ *   expanded expressions.
+ * - correlations::plan::FromQVector which, for a harmonic vector
+ *   fixed for the whole analysis, compiles each correlator once into
+ *   a flat list of terms (see correlations::CorrelatorPlan), and
+ *   evaluates that per event.  This works for any order, and is
+ *   about as fast as the closed-form expressions.
+ * - correlations::dag::FromQVector which, like the above, compiles
+ *   the correlators for a fixed harmonic vector, but into a graph
+ *   where common sub-expressions are calculated only once (see
+ *   correlations::CorrelatorDag).  The number of operations grows
+ *   like @f$ 3^n@f$ rather than like the Bell numbers, so this is
+ *   the fastest for large orders.  Many events, e.g., from a
+ *   @f$ Q@f$-vector store, can be evaluated at once with vector
+ *   instructions, one event per lane.
+ * - correlations::grouped::FromQVector which collapses equal
+ *   harmonics into groups, and sums over partitions of the groups
+ *   with combinatorial weights.  Nothing is prepared in advance, and
+ *   for the heavily repeated harmonics of flow analyses, e.g., @f$
+ *   v_2\{16\}@f$, the number of terms grows only polynomially with
+ *   the order.
+ * - correlations::jit::FromQVector which writes the expression graphs
+ *   (see correlations::CorrelatorDag) of a fixed harmonic vector out
+ *   as C++ code, with all
+ *   locations and coefficients as constants, and compiles and loads
+ *   that at run-time.  The compiled code is cached (by default in
+ *   <tt>~/.cache/correlations</tt>), and if there is no compiler,
+ *   correlations::recursive::FromQVector is used instead.
+ * - correlations::AutoCorrelator which times the above (except the
+ *   run-time compiled code) for each order of a harmonic vector, and
+ *   uses the fastest.  The timings are kept in the same cache
+ *   directory (see correlations::Cache), so that later jobs start
+ *   right away.
+ *
+ * Whatever the implementation, correlators where all harmonics are
+ * equal - e.g., @f$ v_2\{n\}@f$ with only positive harmonics, or
+ * the all-zero denominators - are calculated from the power sums
+ * @f$ Q_{ik,i}@f$ with the Newton identities (see
+ * correlations::FromQVector::identical).  That takes @f$ O(n^2)@f$
+ * operations, so the denominators are essentially free, and even
+ * orders like 32 are possible.
  *
  * Similarly to correlations::recursive::FromQVector, there is a
  * sub-class of correlations::NestedLoops -
  * correlations::recursive::NestedLoops which does the nested loops
  * using recursion.
  *
+ * Which of these is the fastest depends on the order, and on which
+ * of the harmonics are equal.  correlations::CostModel counts the
+ * complex multiplications, additions, @f$ Q@f$-vector loads, and
+ * calls each of them does per event, and estimates the cost from
+ * that.  correlations::AutoCorrelator uses these estimates to skip
+ * timing engines that are far too slow.  The program print.cc prints
+ * tables of these
+ *
+ * <pre class="shell">
+ * make print
+ * ./print -n 8 -t cost -k 2,2,2,2,-2,-2,-2,-2
+ * </pre>
+ *
+ * For correlators needed while the observations of an event come
+ * in, e.g., in an online trigger, correlations::Incremental keeps
+ * the sums over distinct observations for every subset of the
+ * harmonics.  Each observation updates those in @f$ O(m2^m)@f$ for
+ * @f$ m@f$ harmonics, and the correlators can then be read at any
+ * moment for free.
+ *
+ * A correlations::FromQVector can be bound to a
+ * correlations::QVector when it is constructed, as in the example
+ * above, or be constructed without one and get the
+ * @f$Q@f$-vector and a correlations::Workspace on each call to
+ * correlations::FromQVector::calculate.  In the latter case the
+ * correlator is not modified by the calculation - all caches and
+ * scratch space live in the workspace - so one correlator can be
+ * used by several threads, each with its own @f$Q@f$-vector and
+ * workspace, to process events in parallel.
+ *
  * @note The recursive algorithms could probably be implemented using
  * template recursion to let the compiler (and not run-time) deal with
  * branching, etc., which could speed up this tremendously.
@@ -262,6 +364,39 @@
  * it's weight. Observations are added to the @f$ Q@f$-vector using
  * the member function correlations::QVector::fill.
  *
+ * All observations of an event can be added in one go by passing
+ * arrays of @f$\phi@f$ and weights to correlations::QVector::fill.
+ * This uses vector instructions (AVX2 or AVX-512, see
+ * correlations::simd) if the compiler is told to target them, e.g.,
+ * by
+ * <pre class="shell">
+ * make test NATIVE=1
+ * </pre>
+ *
+ * For very large events, the observations can be split over several
+ * threads, each filling a partial @f$ Q@f$-vector that is then
+ * merged (see correlations::QVector::merge).  This requires OpenMP,
+ * e.g., <tt>make OMP=1</tt>.  @f$ Q@f$-vectors can also be
+ * subtracted, e.g., to get the @f$ Q@f$-vector of all but a
+ * sub-event.
+ *
+ * The @f$ Q@f$-vectors of events can be saved to a binary store
+ * with correlations::QStoreWriter, and read back (memory mapped)
+ * with correlations::QStoreReader.  Any correlator can then be
+ * evaluated for other harmonics, as long as they fit in the stored
+ * maximum harmonic and power, without reading the observations
+ * again.  See the options @c -q and @c -Q of analyze.cc.
+ *
+ * How the components are laid out in memory can be chosen when
+ * constructing the correlations::QVector (see
+ * correlations::QVector::EStorage).  The program bench.cc times
+ * filling and @f$ QC\{6\}@f$, @f$ QC\{8\}@f$ for each layout, and
+ * each engine for each order up to 8
+ * <pre class="shell">
+ * make bench NATIVE=1
+ * ./bench
+ * </pre>
+ *
  * @section impl Implementation notes.
  *
  * - All code lives in the namespace correlations. This to minimize
@@ -272,6 +407,10 @@
  *   one to easily change the underlying types should the need be -
  *   e.g., changing correlations::Real to be an alias for long double
  *   rather than double would allow for greater precision.
+ * - Inside the kernels, complex numbers are
+ *   correlations::PlainComplex, whose products are the plain
+ *   formula without the checks for infinities that @c std::complex
+ *   does in ISO C++ mode.  Results are still correlations::Complex.
  * - The methods are implemented in plain C++.
  * - Testing code is available in correlations::test
  *
@@ -314,7 +453,18 @@
  * running Analyze.C twice.
  *
  * @example print.cc A simple program that dumps the expressions for
- * the correlations using @f$ Q@f$-vector input and recursion.
+ * the correlations using @f$ Q@f$-vector input and recursion,
+ * counts the operations of each implementation, or writes the
+ * closed-form expressions out as C++.
+ *
+ * @example bench.cc A simple program that benchmarks the
+ * correlations::QVector storage layouts.
+ *
+ * @example allocs.cc A simple program that counts the heap
+ * allocations made per event.
+ *
+ * @example cse.cc A simple program that shows the number of
+ * operations with and without common sub-expression elimination.
  *
  */
 